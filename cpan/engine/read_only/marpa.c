@@ -26,8 +26,8 @@
  * It is not intended to be modified directly
  */
 
-/*1450:*/
-#line 17309 "./marpa.w"
+/*1652:*/
+#line 21316 "./marpa.w"
 
 
 #include "config.h"
@@ -36,8 +36,13 @@
 #define MARPA_DEBUG 0
 #endif
 
+#ifndef MARPA_COMPACT_YIM
+#define MARPA_COMPACT_YIM 0
+#endif
+
 #include "marpa.h"
 #include "marpa_ami.h"
+#include <time.h> 
 #define PRIVATE_NOT_INLINE static
 #define PRIVATE static inline \
 
@@ -46,6 +51,9 @@ MARPA_LIB_MAJOR_VERSION!=MARPA_MAJOR_VERSION \
 ||MARPA_LIB_MINOR_VERSION!=MARPA_MINOR_VERSION \
 ||MARPA_LIB_MICRO_VERSION!=MARPA_MICRO_VERSION \
 ) 
+#define Allocator_of_G(g) (&(g) ->t_allocator) 
+#define Chunk_Cache_of_G(g) ((g) ->t_chunk_cache) 
+#define DEFAULT_CHUNK_CACHE_MAX (64*1024) 
 #define XSY_Count_of_G(g) (MARPA_DSTACK_LENGTH((g) ->t_xsy_stack) ) 
 #define XSY_by_ID(id) (*MARPA_DSTACK_INDEX(g->t_xsy_stack,XSY,(id) ) )  \
 
@@ -122,6 +130,8 @@ Nulled_XSYIDs_of_XSY(XSY_by_ID(xsyid) )
 #define NSY_is_Nulling(nsy) ((nsy) ->t_nsy_is_nulling) 
 #define LHS_CIL_of_NSY(nsy) ((nsy) ->t_lhs_cil) 
 #define LHS_CIL_of_NSYID(nsyid) LHS_CIL_of_NSY(NSY_by_ID(nsyid) ) 
+#define Lookahead_CIL_of_NSY(nsy) ((nsy) ->t_lookahead_cil) 
+#define Lookahead_CIL_of_NSYID(nsyid) Lookahead_CIL_of_NSY(NSY_by_ID(nsyid) ) 
 #define NSY_is_Semantic(nsy) ((nsy) ->t_is_semantic) 
 #define NSYID_is_Semantic(nsyid) (NSY_is_Semantic(NSY_by_ID(nsyid) ) ) 
 #define Source_XSY_of_NSY(nsy) ((nsy) ->t_source_xsy) 
@@ -184,6 +194,7 @@ ID_of_XSY(Source_XSY_of_NSYID(nsyid) )
 #define Rank_of_IRL(irl) ((irl) ->t_rank) 
 #define First_AHM_of_IRL(irl) ((irl) ->t_first_ahm) 
 #define First_AHM_of_IRLID(irlid) (IRL_by_ID(irlid) ->t_first_ahm) 
+#define Precompute_Stats_of_G(g) ((g) ->t_precompute_stats) 
 #define IRL_is_CHAF(irl) ((irl) ->t_is_chaf) 
 #define AHM_by_ID(id) (g->t_ahms+(id) ) 
 #define ID_of_AHM(ahm) (AHMID) ((ahm) -g->t_ahms) 
@@ -217,6 +228,7 @@ ID_of_XSY(Source_XSY_of_NSYID(nsyid) )
 (SYMI_of_IRL(irl) +Length_of_IRL(irl) -1) 
 #define Predicted_IRL_CIL_of_AHM(ahm) ((ahm) ->t_predicted_irl_cil) 
 #define LHS_CIL_of_AHM(ahm) ((ahm) ->t_lhs_cil) 
+#define Prediction_Bundle_of_AHM(ahm) ((ahm) ->t_prediction_bundle) 
 #define ZWA_CIL_of_AHM(ahm) ((ahm) ->t_zwa_cil) 
 #define AHM_predicts_ZWA(ahm) ((ahm) ->t_predicts_zwa) 
 #define Completion_XSYIDs_of_AHM(ahm) ((ahm) ->t_completion_xsyids) 
@@ -284,19 +296,17 @@ XRL_Position_of_AHM(ahm) <0 \
 LHS_NSYID_of_AHM(AHM_of_YIM(yim) ) 
 #define YIM_is_Completion(item)  \
 (AHM_is_Completion(AHM_of_YIM(item) ) ) 
-#define YS_of_YIM(yim) ((yim) ->t_key.t_set) 
+#define YS_of_YIM(yim) ((yim) ->t_set) 
 #define YS_Ord_of_YIM(yim) (Ord_of_YS(YS_of_YIM(yim) ) ) 
 #define Ord_of_YIM(yim) ((yim) ->t_ordinal) 
 #define Earleme_of_YIM(yim) Earleme_of_YS(YS_of_YIM(yim) ) 
-#define AHM_of_YIM(yim) ((yim) ->t_key.t_ahm) 
-#define AHMID_of_YIM(yim) ID_of_AHM(AHM_of_YIM(yim) ) 
 #define Postdot_NSYID_of_YIM(yim) Postdot_NSYID_of_AHM(AHM_of_YIM(yim) ) 
 #define IRL_of_YIM(yim) IRL_of_AHM(AHM_of_YIM(yim) ) 
 #define IRLID_of_YIM(yim) ID_of_IRL(IRL_of_YIM(yim) ) 
 #define XRL_of_YIM(yim) XRL_of_AHM(AHM_of_YIM(yim) ) 
 #define Origin_Earleme_of_YIM(yim) (Earleme_of_YS(Origin_of_YIM(yim) ) ) 
 #define Origin_Ord_of_YIM(yim) (Ord_of_YS(Origin_of_YIM(yim) ) ) 
-#define Origin_of_YIM(yim) ((yim) ->t_key.t_origin) 
+#define Origin_of_YIM(yim) ((yim) ->t_origin) 
 #define YIM_ORDINAL_WIDTH 16
 #define YIM_ORDINAL_CLAMP(x) (((1<<(YIM_ORDINAL_WIDTH) ) -1) &(x) ) 
 #define YIM_FATAL_THRESHOLD ((1<<(YIM_ORDINAL_WIDTH) ) -2) 
@@ -304,6 +314,8 @@ LHS_NSYID_of_AHM(AHM_of_YIM(yim) )
 #define YIM_is_Active(yim) ((yim) ->t_is_active) 
 #define YIM_was_Scanned(yim) ((yim) ->t_was_scanned) 
 #define YIM_was_Fusion(yim) ((yim) ->t_was_fusion) 
+#define AHMs_of_YS(set) ((set) ->t_ahms) 
+#define Sizeof_Unsourced_YIM (offsetof(YIM_Object,t_container) ) 
 #define NO_SOURCE (0U) 
 #define SOURCE_IS_TOKEN (1U) 
 #define SOURCE_IS_COMPLETION (2U) 
@@ -401,6 +413,7 @@ LV_First_Leo_SRCL_of_YIM(item) :NULL)  \
 #define Start_YS_of_ALT(alt) ((alt) ->t_start_earley_set) 
 #define Start_Earleme_of_ALT(alt) Earleme_of_YS(Start_YS_of_ALT(alt) ) 
 #define End_Earleme_of_ALT(alt) ((alt) ->t_end_earleme) 
+#define R_Generation(r) ((r) ->t_generation) 
 #define Work_YIMs_of_R(r) MARPA_DSTACK_BASE((r) ->t_yim_work_stack,YIM) 
 #define Work_YIM_Count_of_R(r) MARPA_DSTACK_LENGTH((r) ->t_yim_work_stack) 
 #define WORK_YIMS_CLEAR(r) MARPA_DSTACK_CLEAR((r) ->t_yim_work_stack) 
@@ -408,6 +421,25 @@ LV_First_Leo_SRCL_of_YIM(item) :NULL)  \
 #define WORK_YIM_ITEM(r,ix) (*MARPA_DSTACK_INDEX((r) ->t_yim_work_stack,YIM,ix) ) 
 #define P_YS_of_R_by_Ord(r,ord) MARPA_DSTACK_INDEX((r) ->t_earley_set_stack,YS,(ord) ) 
 #define YS_of_R_by_Ord(r,ord) (*P_YS_of_R_by_Ord((r) ,(ord) ) ) 
+#define R_is_Forgetful(r) ((r) ->t_is_forgetful) 
+#define YS_Obs_of_R(r) ((r) ->t_ys_obs) 
+#define YS_Batch_is_Closed(r) ((r) ->t_ys_batch_is_closed) 
+#define YS_is_Needed(set) ((set) ->t_is_needed) 
+#define YS_is_Root(set) ((set) ->t_is_root) 
+#define YS_is_Forgotten(set) ((set) ->t_is_forgotten) 
+#define YS_FORGET_INTERVAL 64
+#define R_is_Lookahead_Filtered(r) ((r) ->t_is_lookahead_filtered) 
+#define R_is_Link_Free(r) ((r) ->t_is_link_free) 
+#define Sizeof_Link_Free_YIM  \
+(offsetof(YIM_Object,t_container) +sizeof(SRCL) )  \
+
+#define IMAGE_MAGIC 0x4d524931
+#define IMAGE_IS_REJECTED 0x1
+#define IMAGE_IS_ACTIVE 0x2
+#define IMAGE_WAS_SCANNED 0x4
+#define IMAGE_WAS_FUSION 0x8
+#define G_IMAGE_MAGIC 0x4d474931 \
+
 #define LIM_is_Populated(leo) (Origin_of_LIM(leo) !=NULL) 
 #define RULEID_of_PROGRESS(report) ((report) ->t_rule_id) 
 #define Position_of_PROGRESS(report) ((report) ->t_position) 
@@ -459,17 +491,20 @@ WHEID_of_IRL(IRL_of_OR(or) )  \
 
 #define TRV_has_Soft_Error(trv) ((trv) ->t_trv_soft_error) 
 #define R_of_TRV(trv) ((trv) ->t_trv_recce) 
+#define R_Generation_of_TRV(trv) ((trv) ->t_trv_r_generation) 
 #define TRV_is_Trivial(trv) ((trv) ->t_is_trivial) 
 #define LIM_of_LTRV(ltrv) ((ltrv) ->t_ltrv_lim) 
 #define YS_of_LTRV(ltrv) (YS_of_YIM(LIM_of_LTRV(ltrv) )  \
 
 #define LTRV_has_Soft_Error(ltrv) ((ltrv) ->t_ltrv_soft_error) 
 #define R_of_LTRV(ltrv) ((ltrv) ->t_ltrv_recce) 
+#define R_Generation_of_LTRV(ltrv) ((ltrv) ->t_ltrv_r_generation) 
 #define PIM_of_PTRV(ptrv) ((ptrv) ->t_ptrv_pim) 
 #define YS_of_PTRV(ptrv) ((ptrv) ->t_ptrv_ys)  \
 
 #define PTRV_has_Soft_Error(ptrv) ((ptrv) ->t_ptrv_soft_error) 
 #define R_of_PTRV(ptrv) ((ptrv) ->t_ptrv_recce) 
+#define R_Generation_of_PTRV(ptrv) ((ptrv) ->t_ptrv_r_generation) 
 #define PTRV_is_Trivial(ptrv) ((ptrv) ->t_is_trivial) 
 #define ORs_of_B(b) ((b) ->t_or_nodes) 
 #define OR_of_B_by_ID(b,id) (ORs_of_B(b) [(id) ]) 
@@ -551,10 +586,12 @@ FSTACK_INDEX((tree) ->t_nook_stack,NOOK_Object,nook_id)
 #define BV_BITS(bv) *(bv-3) 
 #define BV_SIZE(bv) *(bv-2) 
 #define BV_MASK(bv) *(bv-1) 
-#define FSTACK_DECLARE(stack,type) struct{int t_count;type*t_base;}stack;
+#define FSTACK_DECLARE(stack,type) struct{int t_count;type*t_base; \
+struct marpa_allocator_s t_allocator;}stack;
 #define FSTACK_CLEAR(stack) ((stack) .t_count= 0) 
-#define FSTACK_INIT(stack,type,n) (FSTACK_CLEAR(stack) , \
-((stack) .t_base= marpa_new(type,n) ) ) 
+#define FSTACK_INIT(stack,type,n,allocator) (FSTACK_CLEAR(stack) , \
+((stack) .t_allocator= *(allocator) ) , \
+((stack) .t_base= marpa_a_new(&(stack) .t_allocator,type,n) ) ) 
 #define FSTACK_SAFE(stack) ((stack) .t_base= NULL) 
 #define FSTACK_BASE(stack,type) ((type*) (stack) .t_base) 
 #define FSTACK_INDEX(this,type,ix) (FSTACK_BASE((this) ,type) +(ix) ) 
@@ -565,11 +602,11 @@ FSTACK_INDEX((tree) ->t_nook_stack,NOOK_Object,nook_id)
 #define FSTACK_PUSH(stack) ((stack) .t_base+stack.t_count++) 
 #define FSTACK_POP(stack) ((stack) .t_count<=0?NULL:(stack) .t_base+(--(stack) .t_count) ) 
 #define FSTACK_IS_INITIALIZED(stack) ((stack) .t_base) 
-#define FSTACK_DESTROY(stack) (my_free((stack) .t_base) )  \
+#define FSTACK_DESTROY(stack) (marpa__a_free(&(stack) .t_allocator,(stack) .t_base) )  \
 
 #define DQUEUE_DECLARE(this) struct s_dqueue this
-#define DQUEUE_INIT(this,type,initial_size)  \
-((this.t_current= 0) ,MARPA_DSTACK_INIT(this.t_stack,type,initial_size) ) 
+#define DQUEUE_INIT(this,type,initial_size,allocator)  \
+((this.t_current= 0) ,MARPA_DSTACK_INIT(this.t_stack,type,initial_size,(allocator) ) ) 
 #define DQUEUE_PUSH(this,type) MARPA_DSTACK_PUSH(this.t_stack,type) 
 #define DQUEUE_POP(this,type) MARPA_DSTACK_POP(this.t_stack,type) 
 #define DQUEUE_NEXT(this,type) (this.t_current>=MARPA_DSTACK_LENGTH(this.t_stack)  \
@@ -577,7 +614,7 @@ FSTACK_INDEX((tree) ->t_nook_stack,NOOK_Object,nook_id)
 :(MARPA_DSTACK_BASE(this.t_stack,type) ) +this.t_current++) 
 #define DQUEUE_BASE(this,type) MARPA_DSTACK_BASE(this.t_stack,type) 
 #define DQUEUE_END(this) MARPA_DSTACK_LENGTH(this.t_stack) 
-#define STOLEN_DQUEUE_DATA_FREE(data) MARPA_STOLEN_DSTACK_DATA_FREE(data)  \
+#define STOLEN_DQUEUE_DATA_FREE(allocator,data) MARPA_STOLEN_DSTACK_DATA_FREE(allocator,data)  \
 
 #define Count_of_CIL(cil) (cil[0]) 
 #define Item_of_CIL(cil,ix) (cil[1+(ix) ]) 
@@ -593,49 +630,53 @@ FSTACK_INDEX((tree) ->t_nook_stack,NOOK_Object,nook_id)
 #define MARPA_INTERNAL_ERROR(message) (set_error(g,MARPA_ERR_INTERNAL,(message) ,0u) ) 
 #define MARPA_ERROR(code) (set_error(g,(code) ,NULL,0u) ) 
 #define MARPA_FATAL(code) (set_error(g,(code) ,NULL,FATAL_FLAG) ) 
+#define DSTACK_Bytes(stack,type)  \
+((size_t) MARPA_DSTACK_CAPACITY(stack) *sizeof(type) ) 
+#define MEMORY_CHECK_INTERVAL 256
+#define Memory_Limit_of_R(r) ((r) ->t_memory_limit) 
 
-#line 17319 "./marpa.w"
+#line 21331 "./marpa.w"
 
 #include "marpa_obs.h"
 #include "marpa_avl.h"
-/*107:*/
-#line 1034 "./marpa.w"
+/*117:*/
+#line 1142 "./marpa.w"
 
 struct s_g_event;
 typedef struct s_g_event*GEV;
-/*:107*//*143:*/
-#line 1263 "./marpa.w"
+/*:117*//*153:*/
+#line 1371 "./marpa.w"
 
 struct s_xsy;
 typedef struct s_xsy*XSY;
 typedef const struct s_xsy*XSY_Const;
 
-/*:143*//*454:*/
-#line 4862 "./marpa.w"
+/*:153*//*473:*/
+#line 5100 "./marpa.w"
 
 struct s_ahm;
 typedef struct s_ahm*AHM;
 typedef Marpa_AHM_ID AHMID;
 
-/*:454*//*531:*/
-#line 5800 "./marpa.w"
+/*:473*//*553:*/
+#line 6119 "./marpa.w"
 
 struct s_g_zwa;
 struct s_r_zwa;
-/*:531*//*538:*/
-#line 5837 "./marpa.w"
+/*:553*//*560:*/
+#line 6156 "./marpa.w"
 
 struct s_zwp;
-/*:538*//*631:*/
-#line 6731 "./marpa.w"
+/*:560*//*655:*/
+#line 7064 "./marpa.w"
 
 struct s_earley_set;
 typedef struct s_earley_set*YS;
 typedef const struct s_earley_set*YS_Const;
 struct s_earley_set_key;
 typedef struct s_earley_set_key*YSK;
-/*:631*//*653:*/
-#line 6947 "./marpa.w"
+/*:655*//*677:*/
+#line 7292 "./marpa.w"
 
 struct s_earley_item;
 typedef struct s_earley_item*YIM;
@@ -643,118 +684,135 @@ typedef const struct s_earley_item*YIM_Const;
 struct s_earley_item_key;
 typedef struct s_earley_item_key*YIK;
 
-/*:653*//*663:*/
-#line 7121 "./marpa.w"
+/*:677*//*692:*/
+#line 7544 "./marpa.w"
 
 struct s_earley_ix;
 typedef struct s_earley_ix*YIX;
-/*:663*//*666:*/
-#line 7157 "./marpa.w"
+/*:692*//*695:*/
+#line 7580 "./marpa.w"
 
 struct s_leo_item;
 typedef struct s_leo_item*LIM;
-/*:666*//*702:*/
-#line 7554 "./marpa.w"
+/*:695*//*731:*/
+#line 7992 "./marpa.w"
 
 struct s_alternative;
 typedef struct s_alternative*ALT;
 typedef const struct s_alternative*ALT_Const;
-/*:702*//*859:*/
-#line 10032 "./marpa.w"
+/*:731*//*759:*/
+#line 8459 "./marpa.w"
+
+struct s_checkpoint;
+typedef struct s_checkpoint*CHECKPOINT;
+/*:759*//*820:*/
+#line 9690 "./marpa.w"
+
+struct s_ys_batch;
+typedef struct s_ys_batch*YS_BATCH;
+/*:820*//*864:*/
+#line 10244 "./marpa.w"
+
+struct s_image_writer;
+typedef struct s_image_writer*IMAGE_WRITER;
+struct s_image_reader;
+typedef struct s_image_reader*IMAGE_READER;
+/*:864*//*1032:*/
+#line 13493 "./marpa.w"
 
 struct s_ur_node_stack;
 struct s_ur_node;
 typedef struct s_ur_node_stack*URS;
 typedef struct s_ur_node*UR;
 typedef const struct s_ur_node*UR_Const;
-/*:859*//*880:*/
-#line 10294 "./marpa.w"
+/*:1032*//*1053:*/
+#line 13756 "./marpa.w"
 
 union u_or_node;
 typedef union u_or_node*OR;
-/*:880*//*902:*/
-#line 10659 "./marpa.w"
+/*:1053*//*1075:*/
+#line 14122 "./marpa.w"
 
 struct s_draft_and_node;
 typedef struct s_draft_and_node*DAND;
-/*:902*//*928:*/
-#line 11058 "./marpa.w"
+/*:1075*//*1101:*/
+#line 14521 "./marpa.w"
 
 struct s_and_node;
 typedef struct s_and_node*AND;
-/*:928*//*934:*/
-#line 11119 "./marpa.w"
+/*:1101*//*1107:*/
+#line 14582 "./marpa.w"
 
 typedef struct marpa_traverser*TRAVERSER;
-/*:934*//*978:*/
-#line 11635 "./marpa.w"
+/*:1107*//*1154:*/
+#line 15138 "./marpa.w"
 
 typedef struct marpa_ltraverser*LTRAVERSER;
-/*:978*//*1004:*/
-#line 11801 "./marpa.w"
+/*:1154*//*1183:*/
+#line 15320 "./marpa.w"
 
 typedef struct marpa_ptraverser*PTRAVERSER;
-/*:1004*//*1035:*/
-#line 12082 "./marpa.w"
+/*:1183*//*1217:*/
+#line 15624 "./marpa.w"
 
 typedef struct marpa_bocage*BOCAGE;
-/*:1035*//*1051:*/
-#line 12232 "./marpa.w"
+/*:1217*//*1233:*/
+#line 15787 "./marpa.w"
 
 struct s_bocage_setup_per_ys;
-/*:1051*//*1115:*/
-#line 12986 "./marpa.w"
+/*:1233*//*1297:*/
+#line 16542 "./marpa.w"
 
 typedef Marpa_Tree TREE;
-/*:1115*//*1146:*/
-#line 13395 "./marpa.w"
+/*:1297*//*1328:*/
+#line 16953 "./marpa.w"
 
 struct s_nook;
 typedef struct s_nook*NOOK;
-/*:1146*//*1150:*/
-#line 13440 "./marpa.w"
+/*:1328*//*1332:*/
+#line 16998 "./marpa.w"
 
 typedef struct s_value*VALUE;
-/*:1150*//*1263:*/
-#line 15009 "./marpa.w"
+/*:1332*//*1449:*/
+#line 18736 "./marpa.w"
 
 struct s_dqueue;
 typedef struct s_dqueue*DQUEUE;
-/*:1263*//*1269:*/
-#line 15063 "./marpa.w"
+/*:1449*//*1455:*/
+#line 18790 "./marpa.w"
 
 struct s_cil_arena;
-/*:1269*//*1289:*/
-#line 15398 "./marpa.w"
+/*:1455*//*1475:*/
+#line 19126 "./marpa.w"
 
 struct s_per_earley_set_list;
 typedef struct s_per_earley_set_list*PSL;
-/*:1289*//*1291:*/
-#line 15413 "./marpa.w"
+/*:1475*//*1477:*/
+#line 19141 "./marpa.w"
 
 struct s_per_earley_set_arena;
 typedef struct s_per_earley_set_arena*PSAR;
-/*:1291*/
-#line 17322 "./marpa.w"
+/*:1477*/
+#line 21334 "./marpa.w"
 
-/*49:*/
-#line 666 "./marpa.w"
+/*51:*/
+#line 705 "./marpa.w"
 
 typedef struct marpa_g*GRAMMAR;
 
-/*:49*//*142:*/
-#line 1261 "./marpa.w"
+/*:51*//*152:*/
+#line 1369 "./marpa.w"
 
 typedef Marpa_Symbol_ID XSYID;
-/*:142*//*216:*/
-#line 1904 "./marpa.w"
+/*:152*//*226:*/
+#line 2012 "./marpa.w"
 
 struct s_nsy;
 typedef struct s_nsy*NSY;
 typedef Marpa_NSY_ID NSYID;
 
-/*:216*//*255:*/
-#line 2189 "./marpa.w"
+/*:226*//*267:*/
+#line 2307 "./marpa.w"
 
 struct s_xrl;
 typedef struct s_xrl*XRL;
@@ -762,108 +820,108 @@ typedef XRL RULE;
 typedef Marpa_Rule_ID RULEID;
 typedef Marpa_Rule_ID XRLID;
 
-/*:255*//*328:*/
-#line 2920 "./marpa.w"
+/*:267*//*340:*/
+#line 3038 "./marpa.w"
 
 struct s_irl;
 typedef struct s_irl*IRL;
 typedef Marpa_IRL_ID IRLID;
 
-/*:328*//*471:*/
-#line 4978 "./marpa.w"
+/*:340*//*490:*/
+#line 5216 "./marpa.w"
 typedef int SYMI;
-/*:471*//*532:*/
-#line 5809 "./marpa.w"
+/*:490*//*554:*/
+#line 6128 "./marpa.w"
 
 typedef Marpa_Assertion_ID ZWAID;
 typedef struct s_g_zwa*GZWA;
 typedef struct s_r_zwa*ZWA;
 
-/*:532*//*539:*/
-#line 5840 "./marpa.w"
+/*:554*//*561:*/
+#line 6159 "./marpa.w"
 
 typedef struct s_zwp*ZWP;
 typedef const struct s_zwp*ZWP_Const;
-/*:539*//*552:*/
-#line 6036 "./marpa.w"
+/*:561*//*574:*/
+#line 6355 "./marpa.w"
 
 typedef struct marpa_r*RECCE;
-/*:552*//*628:*/
-#line 6721 "./marpa.w"
+/*:574*//*652:*/
+#line 7054 "./marpa.w"
 typedef Marpa_Earleme JEARLEME;
 
-/*:628*//*630:*/
-#line 6725 "./marpa.w"
+/*:652*//*654:*/
+#line 7058 "./marpa.w"
 typedef Marpa_Earley_Set_ID YSID;
-/*:630*//*655:*/
-#line 6988 "./marpa.w"
+/*:654*//*684:*/
+#line 7408 "./marpa.w"
 
 typedef int YIMID;
 
-/*:655*//*673:*/
-#line 7203 "./marpa.w"
+/*:684*//*702:*/
+#line 7626 "./marpa.w"
 
 typedef union _Marpa_PIM_Object PIM_Object;
 typedef union _Marpa_PIM_Object*PIM;
 
-/*:673*//*682:*/
-#line 7283 "./marpa.w"
+/*:702*//*711:*/
+#line 7706 "./marpa.w"
 
 struct s_source;
 typedef struct s_source*SRC;
 typedef const struct s_source*SRC_Const;
-/*:682*//*686:*/
-#line 7311 "./marpa.w"
+/*:711*//*715:*/
+#line 7734 "./marpa.w"
 
 typedef struct marpa_source_link_s*SRCL;
-/*:686*//*827:*/
-#line 9630 "./marpa.w"
+/*:715*//*996:*/
+#line 12947 "./marpa.w"
 
 typedef struct marpa_progress_item*PROGRESS;
-/*:827*//*879:*/
-#line 10291 "./marpa.w"
+/*:996*//*1052:*/
+#line 13753 "./marpa.w"
 
 typedef Marpa_Or_Node_ID ORID;
 
-/*:879*//*901:*/
-#line 10648 "./marpa.w"
+/*:1052*//*1074:*/
+#line 14111 "./marpa.w"
 
 typedef int WHEID;
 
-/*:901*//*927:*/
-#line 11054 "./marpa.w"
+/*:1074*//*1100:*/
+#line 14517 "./marpa.w"
 
 typedef Marpa_And_Node_ID ANDID;
 
-/*:927*//*1145:*/
-#line 13391 "./marpa.w"
+/*:1100*//*1327:*/
+#line 16949 "./marpa.w"
 
 typedef Marpa_Nook_ID NOOKID;
-/*:1145*//*1200:*/
-#line 14179 "./marpa.w"
+/*:1327*//*1382:*/
+#line 17738 "./marpa.w"
 
 typedef unsigned int LBW;
 typedef LBW*LBV;
 
-/*:1200*//*1208:*/
-#line 14271 "./marpa.w"
+/*:1382*//*1391:*/
+#line 17844 "./marpa.w"
 
 typedef LBW Bit_Vector_Word;
 typedef Bit_Vector_Word*Bit_Vector;
-/*:1208*//*1266:*/
-#line 15030 "./marpa.w"
+/*:1391*//*1452:*/
+#line 18757 "./marpa.w"
 
 typedef int*CIL;
 
-/*:1266*//*1270:*/
-#line 15066 "./marpa.w"
+/*:1452*//*1456:*/
+#line 18793 "./marpa.w"
 
 typedef struct s_cil_arena*CILAR;
-/*:1270*/
-#line 17323 "./marpa.w"
+/*:1456*/
+#line 21335 "./marpa.w"
 
-/*1268:*/
-#line 15055 "./marpa.w"
+/*1454:*/
+#line 18782 "./marpa.w"
 
 struct s_cil_arena{
 struct marpa_obstack*t_obs;
@@ -872,36 +930,45 @@ MARPA_DSTACK_DECLARE(t_buffer);
 };
 typedef struct s_cil_arena CILAR_Object;
 
-/*:1268*/
-#line 17324 "./marpa.w"
+/*:1454*/
+#line 21336 "./marpa.w"
 
-/*48:*/
-#line 660 "./marpa.w"
+/*50:*/
+#line 699 "./marpa.w"
 struct marpa_g{
-/*133:*/
-#line 1208 "./marpa.w"
+/*143:*/
+#line 1316 "./marpa.w"
 
 int t_is_ok;
 
-/*:133*/
-#line 661 "./marpa.w"
+/*:143*/
+#line 700 "./marpa.w"
+
+/*61:*/
+#line 800 "./marpa.w"
+
+struct marpa_allocator_s t_allocator;
 
-/*59:*/
-#line 749 "./marpa.w"
+/*:61*//*64:*/
+#line 821 "./marpa.w"
+
+struct marpa_obstack_cache*t_chunk_cache;
+/*:64*//*69:*/
+#line 857 "./marpa.w"
 
 MARPA_DSTACK_DECLARE(t_xsy_stack);
 MARPA_DSTACK_DECLARE(t_nsy_stack);
 
-/*:59*//*68:*/
-#line 808 "./marpa.w"
+/*:69*//*78:*/
+#line 916 "./marpa.w"
 
 MARPA_DSTACK_DECLARE(t_xrl_stack);
 MARPA_DSTACK_DECLARE(t_irl_stack);
-/*:68*//*103:*/
-#line 1003 "./marpa.w"
+/*:78*//*113:*/
+#line 1111 "./marpa.w"
 Bit_Vector t_bv_nsyid_is_terminal;
-/*:103*//*105:*/
-#line 1012 "./marpa.w"
+/*:113*//*115:*/
+#line 1120 "./marpa.w"
 
 Bit_Vector t_lbv_xsyid_is_completion_event;
 Bit_Vector t_lbv_xsyid_completion_event_starts_active;
@@ -909,179 +976,183 @@ Bit_Vector t_lbv_xsyid_is_nulled_event;
 Bit_Vector t_lbv_xsyid_nulled_event_starts_active;
 Bit_Vector t_lbv_xsyid_is_prediction_event;
 Bit_Vector t_lbv_xsyid_prediction_event_starts_active;
-/*:105*//*112:*/
-#line 1056 "./marpa.w"
+/*:115*//*122:*/
+#line 1164 "./marpa.w"
 
 MARPA_DSTACK_DECLARE(t_events);
-/*:112*//*120:*/
-#line 1130 "./marpa.w"
+/*:122*//*130:*/
+#line 1238 "./marpa.w"
 
 MARPA_AVL_TREE t_xrl_tree;
-/*:120*//*124:*/
-#line 1160 "./marpa.w"
+/*:130*//*134:*/
+#line 1268 "./marpa.w"
 
 struct marpa_obstack*t_obs;
 struct marpa_obstack*t_xrl_obs;
-/*:124*//*127:*/
-#line 1177 "./marpa.w"
+/*:134*//*137:*/
+#line 1285 "./marpa.w"
 
 CILAR_Object t_cilar;
-/*:127*//*135:*/
-#line 1223 "./marpa.w"
+/*:137*//*145:*/
+#line 1331 "./marpa.w"
 
 const char*t_error_string;
-/*:135*//*459:*/
-#line 4888 "./marpa.w"
+/*:145*//*384:*/
+#line 3446 "./marpa.w"
+
+struct marpa_precompute_stats t_precompute_stats;
+/*:384*//*478:*/
+#line 5126 "./marpa.w"
 
 AHM t_ahms;
-/*:459*//*533:*/
-#line 5816 "./marpa.w"
+/*:478*//*555:*/
+#line 6135 "./marpa.w"
 
 MARPA_DSTACK_DECLARE(t_gzwa_stack);
-/*:533*//*541:*/
-#line 5855 "./marpa.w"
+/*:555*//*563:*/
+#line 6174 "./marpa.w"
 
 MARPA_AVL_TREE t_zwp_tree;
-/*:541*/
-#line 662 "./marpa.w"
+/*:563*/
+#line 701 "./marpa.w"
 
-/*53:*/
-#line 696 "./marpa.w"
+/*55:*/
+#line 743 "./marpa.w"
 int t_ref_count;
-/*:53*//*78:*/
-#line 858 "./marpa.w"
+/*:55*//*88:*/
+#line 966 "./marpa.w"
 XSYID t_start_xsy_id;
-/*:78*//*82:*/
-#line 895 "./marpa.w"
+/*:88*//*92:*/
+#line 1003 "./marpa.w"
 
 IRL t_start_irl;
-/*:82*//*85:*/
-#line 909 "./marpa.w"
+/*:92*//*95:*/
+#line 1017 "./marpa.w"
 
 int t_external_size;
-/*:85*//*88:*/
-#line 923 "./marpa.w"
+/*:95*//*98:*/
+#line 1031 "./marpa.w"
 int t_max_rule_length;
-/*:88*//*92:*/
-#line 936 "./marpa.w"
+/*:98*//*102:*/
+#line 1044 "./marpa.w"
 Marpa_Rank t_default_rank;
-/*:92*//*136:*/
-#line 1225 "./marpa.w"
+/*:102*//*146:*/
+#line 1333 "./marpa.w"
 
 Marpa_Error_Code t_error;
-/*:136*//*161:*/
-#line 1389 "./marpa.w"
+/*:146*//*171:*/
+#line 1497 "./marpa.w"
 int t_force_valued;
-/*:161*//*457:*/
-#line 4880 "./marpa.w"
+/*:171*//*476:*/
+#line 5118 "./marpa.w"
 
 int t_ahm_count;
-/*:457*//*472:*/
-#line 4980 "./marpa.w"
+/*:476*//*491:*/
+#line 5218 "./marpa.w"
 
 int t_symbol_instance_count;
-/*:472*/
-#line 663 "./marpa.w"
+/*:491*/
+#line 702 "./marpa.w"
 
-/*97:*/
-#line 971 "./marpa.w"
+/*107:*/
+#line 1079 "./marpa.w"
 BITFIELD t_is_precomputed:1;
-/*:97*//*100:*/
-#line 983 "./marpa.w"
+/*:107*//*110:*/
+#line 1091 "./marpa.w"
 BITFIELD t_has_cycle:1;
-/*:100*/
-#line 664 "./marpa.w"
+/*:110*/
+#line 703 "./marpa.w"
 
 };
-/*:48*//*111:*/
-#line 1049 "./marpa.w"
+/*:50*//*121:*/
+#line 1157 "./marpa.w"
 
 struct s_g_event{
 int t_type;
 int t_value;
 };
 typedef struct s_g_event GEV_Object;
-/*:111*//*144:*/
-#line 1268 "./marpa.w"
+/*:121*//*154:*/
+#line 1376 "./marpa.w"
 
 struct s_xsy{
-/*202:*/
-#line 1804 "./marpa.w"
+/*212:*/
+#line 1912 "./marpa.w"
 
 CIL t_nulled_event_xsyids;
-/*:202*//*205:*/
-#line 1831 "./marpa.w"
+/*:212*//*215:*/
+#line 1939 "./marpa.w"
 NSY t_nsy_equivalent;
-/*:205*//*209:*/
-#line 1863 "./marpa.w"
+/*:215*//*219:*/
+#line 1971 "./marpa.w"
 NSY t_nulling_nsy;
-/*:209*/
-#line 1270 "./marpa.w"
+/*:219*/
+#line 1378 "./marpa.w"
 
-/*145:*/
-#line 1277 "./marpa.w"
+/*155:*/
+#line 1385 "./marpa.w"
 XSYID t_symbol_id;
 
-/*:145*//*150:*/
-#line 1310 "./marpa.w"
+/*:155*//*160:*/
+#line 1418 "./marpa.w"
 
 Marpa_Rank t_rank;
-/*:150*/
-#line 1271 "./marpa.w"
+/*:160*/
+#line 1379 "./marpa.w"
 
-/*154:*/
-#line 1357 "./marpa.w"
+/*164:*/
+#line 1465 "./marpa.w"
 BITFIELD t_is_lhs:1;
-/*:154*//*156:*/
-#line 1364 "./marpa.w"
+/*:164*//*166:*/
+#line 1472 "./marpa.w"
 BITFIELD t_is_sequence_lhs:1;
-/*:156*//*158:*/
-#line 1378 "./marpa.w"
+/*:166*//*168:*/
+#line 1486 "./marpa.w"
 
 BITFIELD t_is_valued:1;
 BITFIELD t_is_valued_locked:1;
-/*:158*//*166:*/
-#line 1448 "./marpa.w"
+/*:168*//*176:*/
+#line 1556 "./marpa.w"
 BITFIELD t_is_accessible:1;
-/*:166*//*169:*/
-#line 1469 "./marpa.w"
+/*:176*//*179:*/
+#line 1577 "./marpa.w"
 BITFIELD t_is_counted:1;
-/*:169*//*172:*/
-#line 1485 "./marpa.w"
+/*:179*//*182:*/
+#line 1593 "./marpa.w"
 BITFIELD t_is_nulling:1;
-/*:172*//*175:*/
-#line 1502 "./marpa.w"
+/*:182*//*185:*/
+#line 1610 "./marpa.w"
 BITFIELD t_is_nullable:1;
-/*:175*//*178:*/
-#line 1523 "./marpa.w"
+/*:185*//*188:*/
+#line 1631 "./marpa.w"
 
 BITFIELD t_is_terminal:1;
 BITFIELD t_is_locked_terminal:1;
-/*:178*//*183:*/
-#line 1570 "./marpa.w"
+/*:188*//*193:*/
+#line 1678 "./marpa.w"
 BITFIELD t_is_productive:1;
-/*:183*//*186:*/
-#line 1591 "./marpa.w"
+/*:193*//*196:*/
+#line 1699 "./marpa.w"
 
 BITFIELD t_is_completion_event:1;
 BITFIELD t_completion_event_starts_active:1;
-/*:186*//*191:*/
-#line 1661 "./marpa.w"
+/*:196*//*201:*/
+#line 1769 "./marpa.w"
 
 BITFIELD t_is_nulled_event:1;
 BITFIELD t_nulled_event_starts_active:1;
-/*:191*//*196:*/
-#line 1734 "./marpa.w"
+/*:201*//*206:*/
+#line 1842 "./marpa.w"
 
 BITFIELD t_is_prediction_event:1;
 BITFIELD t_prediction_event_starts_active:1;
-/*:196*/
-#line 1272 "./marpa.w"
+/*:206*/
+#line 1380 "./marpa.w"
 
 };
 
-/*:144*//*217:*/
-#line 1919 "./marpa.w"
+/*:154*//*227:*/
+#line 2027 "./marpa.w"
 
 struct s_unvalued_token_or_node{
 int t_or_node_type;
@@ -1089,186 +1160,189 @@ NSYID t_nsyid;
 };
 
 struct s_nsy{
-/*236:*/
-#line 2056 "./marpa.w"
+/*246:*/
+#line 2164 "./marpa.w"
 CIL t_lhs_cil;
-/*:236*//*241:*/
-#line 2087 "./marpa.w"
+/*:246*//*248:*/
+#line 2174 "./marpa.w"
+CIL t_lookahead_cil;
+/*:248*//*253:*/
+#line 2205 "./marpa.w"
 XSY t_source_xsy;
-/*:241*//*245:*/
-#line 2110 "./marpa.w"
+/*:253*//*257:*/
+#line 2228 "./marpa.w"
 
 XRL t_lhs_xrl;
 int t_xrl_offset;
-/*:245*/
-#line 1926 "./marpa.w"
+/*:257*/
+#line 2034 "./marpa.w"
 
-/*250:*/
-#line 2163 "./marpa.w"
+/*262:*/
+#line 2281 "./marpa.w"
 Marpa_Rank t_rank;
-/*:250*/
-#line 1927 "./marpa.w"
+/*:262*/
+#line 2035 "./marpa.w"
 
-/*227:*/
-#line 2011 "./marpa.w"
+/*237:*/
+#line 2119 "./marpa.w"
 BITFIELD t_is_start:1;
-/*:227*//*230:*/
-#line 2025 "./marpa.w"
+/*:237*//*240:*/
+#line 2133 "./marpa.w"
 BITFIELD t_is_lhs:1;
-/*:230*//*233:*/
-#line 2039 "./marpa.w"
+/*:240*//*243:*/
+#line 2147 "./marpa.w"
 BITFIELD t_nsy_is_nulling:1;
-/*:233*//*238:*/
-#line 2064 "./marpa.w"
+/*:243*//*250:*/
+#line 2182 "./marpa.w"
 BITFIELD t_is_semantic:1;
-/*:238*/
-#line 1928 "./marpa.w"
+/*:250*/
+#line 2036 "./marpa.w"
 
 struct s_unvalued_token_or_node t_nulling_or_node;
 struct s_unvalued_token_or_node t_unvalued_or_node;
 };
-/*:217*//*254:*/
-#line 2180 "./marpa.w"
+/*:227*//*266:*/
+#line 2298 "./marpa.w"
 
 struct s_xrl{
-/*267:*/
-#line 2483 "./marpa.w"
+/*279:*/
+#line 2601 "./marpa.w"
 int t_rhs_length;
-/*:267*//*275:*/
-#line 2548 "./marpa.w"
+/*:279*//*287:*/
+#line 2666 "./marpa.w"
 Marpa_Rule_ID t_id;
 
-/*:275*//*276:*/
-#line 2551 "./marpa.w"
+/*:287*//*288:*/
+#line 2669 "./marpa.w"
 
 Marpa_Rank t_rank;
-/*:276*/
-#line 2182 "./marpa.w"
+/*:288*/
+#line 2300 "./marpa.w"
 
-/*280:*/
-#line 2600 "./marpa.w"
+/*292:*/
+#line 2718 "./marpa.w"
 
 BITFIELD t_null_ranks_high:1;
-/*:280*//*284:*/
-#line 2641 "./marpa.w"
+/*:292*//*296:*/
+#line 2759 "./marpa.w"
 BITFIELD t_is_bnf:1;
-/*:284*//*286:*/
-#line 2647 "./marpa.w"
+/*:296*//*298:*/
+#line 2765 "./marpa.w"
 BITFIELD t_is_sequence:1;
-/*:286*//*288:*/
-#line 2661 "./marpa.w"
+/*:298*//*300:*/
+#line 2779 "./marpa.w"
 int t_minimum;
-/*:288*//*291:*/
-#line 2687 "./marpa.w"
+/*:300*//*303:*/
+#line 2805 "./marpa.w"
 XSYID t_separator_id;
-/*:291*//*296:*/
-#line 2724 "./marpa.w"
+/*:303*//*308:*/
+#line 2842 "./marpa.w"
 BITFIELD t_is_discard:1;
-/*:296*//*300:*/
-#line 2764 "./marpa.w"
+/*:308*//*312:*/
+#line 2882 "./marpa.w"
 BITFIELD t_is_proper_separation:1;
-/*:300*//*304:*/
-#line 2785 "./marpa.w"
+/*:312*//*316:*/
+#line 2903 "./marpa.w"
 BITFIELD t_is_loop:1;
-/*:304*//*307:*/
-#line 2803 "./marpa.w"
+/*:316*//*319:*/
+#line 2921 "./marpa.w"
 BITFIELD t_is_nulling:1;
-/*:307*//*310:*/
-#line 2822 "./marpa.w"
+/*:319*//*322:*/
+#line 2940 "./marpa.w"
 BITFIELD t_is_nullable:1;
-/*:310*//*314:*/
-#line 2841 "./marpa.w"
+/*:322*//*326:*/
+#line 2959 "./marpa.w"
 BITFIELD t_is_accessible:1;
-/*:314*//*317:*/
-#line 2860 "./marpa.w"
+/*:326*//*329:*/
+#line 2978 "./marpa.w"
 BITFIELD t_is_productive:1;
-/*:317*//*320:*/
-#line 2878 "./marpa.w"
+/*:329*//*332:*/
+#line 2996 "./marpa.w"
 BITFIELD t_is_used:1;
-/*:320*/
-#line 2183 "./marpa.w"
+/*:332*/
+#line 2301 "./marpa.w"
 
-/*268:*/
-#line 2486 "./marpa.w"
+/*280:*/
+#line 2604 "./marpa.w"
 Marpa_Symbol_ID t_symbols[1];
 
 
-/*:268*/
-#line 2184 "./marpa.w"
+/*:280*/
+#line 2302 "./marpa.w"
 
 };
-/*:254*//*326:*/
-#line 2909 "./marpa.w"
+/*:266*//*338:*/
+#line 3027 "./marpa.w"
 
 struct s_irl{
-/*359:*/
-#line 3122 "./marpa.w"
+/*371:*/
+#line 3240 "./marpa.w"
 XRL t_source_xrl;
-/*:359*//*365:*/
-#line 3171 "./marpa.w"
+/*:371*//*377:*/
+#line 3289 "./marpa.w"
 AHM t_first_ahm;
-/*:365*/
-#line 2911 "./marpa.w"
+/*:377*/
+#line 3029 "./marpa.w"
 
-/*329:*/
-#line 2931 "./marpa.w"
+/*341:*/
+#line 3049 "./marpa.w"
 IRLID t_irl_id;
 
-/*:329*//*336:*/
-#line 2968 "./marpa.w"
+/*:341*//*348:*/
+#line 3086 "./marpa.w"
 int t_length;
-/*:336*//*338:*/
-#line 2983 "./marpa.w"
+/*:348*//*350:*/
+#line 3101 "./marpa.w"
 int t_ahm_count;
 
-/*:338*//*350:*/
-#line 3062 "./marpa.w"
+/*:350*//*362:*/
+#line 3180 "./marpa.w"
 int t_real_symbol_count;
-/*:350*//*353:*/
-#line 3080 "./marpa.w"
+/*:362*//*365:*/
+#line 3198 "./marpa.w"
 int t_virtual_start;
-/*:353*//*356:*/
-#line 3100 "./marpa.w"
+/*:365*//*368:*/
+#line 3218 "./marpa.w"
 int t_virtual_end;
-/*:356*//*362:*/
-#line 3149 "./marpa.w"
+/*:368*//*374:*/
+#line 3267 "./marpa.w"
 Marpa_Rank t_rank;
-/*:362*//*473:*/
-#line 4986 "./marpa.w"
+/*:374*//*493:*/
+#line 5226 "./marpa.w"
 
 int t_symbol_instance_base;
 int t_last_proper_symi;
-/*:473*/
-#line 2912 "./marpa.w"
+/*:493*/
+#line 3030 "./marpa.w"
 
-/*341:*/
-#line 3016 "./marpa.w"
+/*353:*/
+#line 3134 "./marpa.w"
 BITFIELD t_is_virtual_lhs:1;
-/*:341*//*344:*/
-#line 3032 "./marpa.w"
+/*:353*//*356:*/
+#line 3150 "./marpa.w"
 BITFIELD t_is_virtual_rhs:1;
-/*:344*//*347:*/
-#line 3051 "./marpa.w"
+/*:356*//*359:*/
+#line 3169 "./marpa.w"
 BITFIELD t_is_right_recursive:1;
-/*:347*//*409:*/
-#line 4071 "./marpa.w"
+/*:359*//*428:*/
+#line 4309 "./marpa.w"
 BITFIELD t_is_chaf:1;
-/*:409*/
-#line 2913 "./marpa.w"
+/*:428*/
+#line 3031 "./marpa.w"
 
-/*331:*/
-#line 2936 "./marpa.w"
+/*343:*/
+#line 3054 "./marpa.w"
 
 NSYID t_nsyid_array[1];
 
-/*:331*/
-#line 2914 "./marpa.w"
+/*:343*/
+#line 3032 "./marpa.w"
 
 };
 typedef struct s_irl IRL_Object;
 
-/*:326*//*378:*/
-#line 3359 "./marpa.w"
+/*:338*//*397:*/
+#line 3597 "./marpa.w"
 
 struct sym_rule_pair
 {
@@ -1276,96 +1350,101 @@ XSYID t_symid;
 RULEID t_ruleid;
 };
 
-/*:378*//*453:*/
-#line 4856 "./marpa.w"
+/*:397*//*472:*/
+#line 5094 "./marpa.w"
 
 struct s_ahm{
-/*463:*/
-#line 4908 "./marpa.w"
+/*482:*/
+#line 5146 "./marpa.w"
 
 IRL t_irl;
 
-/*:463*//*476:*/
-#line 5001 "./marpa.w"
+/*:482*//*496:*/
+#line 5241 "./marpa.w"
 
 CIL t_predicted_irl_cil;
 CIL t_lhs_cil;
 
-/*:476*//*477:*/
-#line 5009 "./marpa.w"
+/*:496*//*497:*/
+#line 5257 "./marpa.w"
+
+CIL t_prediction_bundle;
+
+/*:497*//*498:*/
+#line 5264 "./marpa.w"
 
 CIL t_zwa_cil;
 
-/*:477*//*499:*/
-#line 5253 "./marpa.w"
+/*:498*//*520:*/
+#line 5508 "./marpa.w"
 
 CIL t_completion_xsyids;
 CIL t_nulled_xsyids;
 CIL t_prediction_xsyids;
 
-/*:499*//*503:*/
-#line 5283 "./marpa.w"
+/*:520*//*524:*/
+#line 5538 "./marpa.w"
 
 XRL t_xrl;
-/*:503*//*506:*/
-#line 5312 "./marpa.w"
+/*:524*//*527:*/
+#line 5567 "./marpa.w"
 
 CIL t_event_ahmids;
-/*:506*/
-#line 4858 "./marpa.w"
+/*:527*/
+#line 5096 "./marpa.w"
 
-/*464:*/
-#line 4918 "./marpa.w"
+/*483:*/
+#line 5156 "./marpa.w"
 NSYID t_postdot_nsyid;
 
-/*:464*//*465:*/
-#line 4927 "./marpa.w"
+/*:483*//*484:*/
+#line 5165 "./marpa.w"
 
 int t_leading_nulls;
 
-/*:465*//*466:*/
-#line 4940 "./marpa.w"
+/*:484*//*485:*/
+#line 5178 "./marpa.w"
 
 int t_position;
 
-/*:466*//*468:*/
-#line 4956 "./marpa.w"
+/*:485*//*487:*/
+#line 5194 "./marpa.w"
 
 int t_quasi_position;
 
-/*:468*//*470:*/
-#line 4976 "./marpa.w"
+/*:487*//*489:*/
+#line 5214 "./marpa.w"
 
 int t_symbol_instance;
-/*:470*//*504:*/
-#line 5291 "./marpa.w"
+/*:489*//*525:*/
+#line 5546 "./marpa.w"
 
 int t_xrl_position;
 
-/*:504*//*507:*/
-#line 5316 "./marpa.w"
+/*:525*//*528:*/
+#line 5571 "./marpa.w"
 
 int t_event_group_size;
-/*:507*/
-#line 4859 "./marpa.w"
+/*:528*/
+#line 5097 "./marpa.w"
 
-/*478:*/
-#line 5018 "./marpa.w"
+/*499:*/
+#line 5273 "./marpa.w"
 
 BITFIELD t_predicts_zwa:1;
 
-/*:478*//*502:*/
-#line 5274 "./marpa.w"
+/*:499*//*523:*/
+#line 5529 "./marpa.w"
 
 BITFIELD t_was_predicted:1;
 BITFIELD t_is_initial:1;
 
-/*:502*/
-#line 4860 "./marpa.w"
+/*:523*/
+#line 5098 "./marpa.w"
 
 };
-/*:453*//*537:*/
-#line 5830 "./marpa.w"
+/*:472*//*559:*/
+#line 6149 "./marpa.w"
 
 struct s_g_zwa{
 ZWAID t_id;
@@ -1373,8 +1452,8 @@ BITFIELD t_default_value:1;
 };
 typedef struct s_g_zwa GZWA_Object;
 
-/*:537*//*540:*/
-#line 5847 "./marpa.w"
+/*:559*//*562:*/
+#line 6166 "./marpa.w"
 
 struct s_zwp{
 XRLID t_xrl_id;
@@ -1383,8 +1462,8 @@ ZWAID t_zwaid;
 };
 typedef struct s_zwp ZWP_Object;
 
-/*:540*//*621:*/
-#line 6667 "./marpa.w"
+/*:562*//*645:*/
+#line 7000 "./marpa.w"
 
 struct s_r_zwa{
 ZWAID t_id;
@@ -1394,54 +1473,69 @@ BITFIELD t_memoized_value:1;
 };
 typedef struct s_r_zwa ZWA_Object;
 
-/*:621*//*632:*/
-#line 6737 "./marpa.w"
+/*:645*//*656:*/
+#line 7070 "./marpa.w"
 
 struct s_earley_set_key{
 JEARLEME t_earleme;
 };
 typedef struct s_earley_set_key YSK_Object;
-/*:632*//*633:*/
-#line 6742 "./marpa.w"
+/*:656*//*657:*/
+#line 7075 "./marpa.w"
 
 struct s_earley_set{
 YSK_Object t_key;
 PIM*t_postdot_ary;
 YS t_next_earley_set;
-/*635:*/
-#line 6758 "./marpa.w"
+/*659:*/
+#line 7092 "./marpa.w"
 
 YIM*t_earley_items;
 
-/*:635*//*1300:*/
-#line 15501 "./marpa.w"
+/*:659*//*681:*/
+#line 7377 "./marpa.w"
+
+#if MARPA_COMPACT_YIM
+AHM t_ahms;
+#endif
+/*:681*//*1486:*/
+#line 19231 "./marpa.w"
 
 PSL t_dot_psl;
-/*:1300*/
-#line 6747 "./marpa.w"
+/*:1486*/
+#line 7080 "./marpa.w"
 
 int t_postdot_sym_count;
-/*634:*/
-#line 6755 "./marpa.w"
+/*658:*/
+#line 7089 "./marpa.w"
 
 int t_yim_count;
-/*:634*//*636:*/
-#line 6769 "./marpa.w"
+/*:658*//*660:*/
+#line 7103 "./marpa.w"
 
 int t_ordinal;
-/*:636*//*640:*/
-#line 6787 "./marpa.w"
+/*:660*//*664:*/
+#line 7121 "./marpa.w"
 
 int t_value;
 void*t_pvalue;
-/*:640*/
-#line 6749 "./marpa.w"
+/*:664*/
+#line 7082 "./marpa.w"
+
+/*833:*/
+#line 9806 "./marpa.w"
+
+BITFIELD t_is_needed:1;
+BITFIELD t_is_root:1;
+BITFIELD t_is_forgotten:1;
+/*:833*/
+#line 7083 "./marpa.w"
 
 };
 typedef struct s_earley_set YS_Object;
 
-/*:633*//*664:*/
-#line 7124 "./marpa.w"
+/*:657*//*693:*/
+#line 7547 "./marpa.w"
 
 struct s_earley_ix{
 PIM t_next;
@@ -1450,18 +1544,18 @@ YIM t_earley_item;
 };
 typedef struct s_earley_ix YIX_Object;
 
-/*:664*//*667:*/
-#line 7160 "./marpa.w"
+/*:693*//*696:*/
+#line 7583 "./marpa.w"
 
 struct s_leo_item{
 YIX_Object t_earley_ix;
-/*668:*/
-#line 7176 "./marpa.w"
+/*697:*/
+#line 7599 "./marpa.w"
 
 CIL t_cil;
 
-/*:668*/
-#line 7163 "./marpa.w"
+/*:697*/
+#line 7586 "./marpa.w"
 
 YS t_origin;
 AHM t_top_ahm;
@@ -1474,8 +1568,8 @@ BITFIELD t_is_active:1;
 };
 typedef struct s_leo_item LIM_Object;
 
-/*:667*//*703:*/
-#line 7565 "./marpa.w"
+/*:696*//*732:*/
+#line 8003 "./marpa.w"
 
 struct s_alternative{
 YS t_start_earley_set;
@@ -1486,8 +1580,57 @@ BITFIELD t_is_valued:1;
 };
 typedef struct s_alternative ALT_Object;
 
-/*:703*//*860:*/
-#line 10048 "./marpa.w"
+/*:732*//*760:*/
+#line 8462 "./marpa.w"
+
+struct s_checkpoint{
+struct marpa_obstack_mark t_mark;
+struct marpa_obstack_mark t_copy_mark;
+YS t_latest_ys;
+ALT t_alternatives;
+Bit_Vector t_bv_nsyid_is_expected;
+LBV t_valued_terminal;
+LBV t_unvalued_terminal;
+LBV t_valued;
+LBV t_unvalued;
+LBV t_valued_locked;
+JEARLEME t_current_earleme;
+JEARLEME t_furthest_earleme;
+int t_alternative_count;
+int t_valued_change_count;
+BITFIELD t_input_phase:2;
+BITFIELD t_is_exhausted:1;
+};
+typedef struct s_checkpoint CHECKPOINT_Object;
+
+/*:760*//*821:*/
+#line 9693 "./marpa.w"
+
+struct s_ys_batch{
+struct marpa_obstack*t_obs;
+YS_BATCH t_next;
+YSID t_first_ysid;
+BITFIELD t_is_needed:1;
+};
+/*:821*//*865:*/
+#line 10249 "./marpa.w"
+
+struct s_image_writer{
+unsigned char*t_buffer;
+size_t t_capacity;
+size_t t_length;
+};
+typedef struct s_image_writer IMAGE_WRITER_Object;
+struct s_image_reader{
+const unsigned char*t_image;
+size_t t_length;
+size_t t_offset;
+int t_is_bad;
+};
+typedef struct s_image_reader IMAGE_READER_Object;
+
+/*:865*//*1033:*/
+#line 13509 "./marpa.w"
 
 struct s_ur_node_stack{
 struct marpa_obstack*t_obs;
@@ -1495,8 +1638,8 @@ UR t_base;
 UR t_top;
 };
 
-/*:860*//*861:*/
-#line 10055 "./marpa.w"
+/*:1033*//*1034:*/
+#line 13516 "./marpa.w"
 
 struct s_ur_node{
 UR t_prev;
@@ -1505,80 +1648,80 @@ YIM t_earley_item;
 };
 typedef struct s_ur_node UR_Object;
 
-/*:861*//*884:*/
-#line 10337 "./marpa.w"
+/*:1034*//*1057:*/
+#line 13799 "./marpa.w"
 
 struct s_draft_or_node
 {
-/*883:*/
-#line 10330 "./marpa.w"
+/*1056:*/
+#line 13792 "./marpa.w"
 
-/*882:*/
-#line 10327 "./marpa.w"
+/*1055:*/
+#line 13789 "./marpa.w"
 
 int t_position;
 
-/*:882*/
-#line 10331 "./marpa.w"
+/*:1055*/
+#line 13793 "./marpa.w"
 
 int t_end_set_ordinal;
 int t_start_set_ordinal;
 ORID t_id;
 IRL t_irl;
 
-/*:883*/
-#line 10340 "./marpa.w"
+/*:1056*/
+#line 13802 "./marpa.w"
 
 DAND t_draft_and_node;
 };
 
-/*:884*//*885:*/
-#line 10344 "./marpa.w"
+/*:1057*//*1058:*/
+#line 13806 "./marpa.w"
 
 struct s_final_or_node
 {
-/*883:*/
-#line 10330 "./marpa.w"
+/*1056:*/
+#line 13792 "./marpa.w"
 
-/*882:*/
-#line 10327 "./marpa.w"
+/*1055:*/
+#line 13789 "./marpa.w"
 
 int t_position;
 
-/*:882*/
-#line 10331 "./marpa.w"
+/*:1055*/
+#line 13793 "./marpa.w"
 
 int t_end_set_ordinal;
 int t_start_set_ordinal;
 ORID t_id;
 IRL t_irl;
 
-/*:883*/
-#line 10347 "./marpa.w"
+/*:1056*/
+#line 13809 "./marpa.w"
 
 int t_first_and_node_id;
 int t_and_node_count;
 };
 
-/*:885*//*886:*/
-#line 10352 "./marpa.w"
+/*:1058*//*1059:*/
+#line 13814 "./marpa.w"
 
 struct s_valued_token_or_node
 {
-/*882:*/
-#line 10327 "./marpa.w"
+/*1055:*/
+#line 13789 "./marpa.w"
 
 int t_position;
 
-/*:882*/
-#line 10355 "./marpa.w"
+/*:1055*/
+#line 13817 "./marpa.w"
 
 NSYID t_nsyid;
 int t_value;
 };
 
-/*:886*//*887:*/
-#line 10363 "./marpa.w"
+/*:1059*//*1060:*/
+#line 13825 "./marpa.w"
 
 union u_or_node{
 struct s_draft_or_node t_draft;
@@ -1587,8 +1730,8 @@ struct s_valued_token_or_node t_token;
 };
 typedef union u_or_node OR_Object;
 
-/*:887*//*903:*/
-#line 10666 "./marpa.w"
+/*:1060*//*1076:*/
+#line 14129 "./marpa.w"
 
 struct s_draft_and_node{
 DAND t_next;
@@ -1597,8 +1740,8 @@ OR t_cause;
 };
 typedef struct s_draft_and_node DAND_Object;
 
-/*:903*//*929:*/
-#line 11065 "./marpa.w"
+/*:1076*//*1102:*/
+#line 14528 "./marpa.w"
 
 struct s_and_node{
 OR t_current;
@@ -1607,55 +1750,55 @@ OR t_cause;
 };
 typedef struct s_and_node AND_Object;
 
-/*:929*//*1052:*/
-#line 12238 "./marpa.w"
+/*:1102*//*1234:*/
+#line 15793 "./marpa.w"
 
 struct s_bocage_setup_per_ys{
 OR*t_or_node_by_item;
 PSL t_or_psl;
 PSL t_and_psl;
 };
-/*:1052*//*1078:*/
-#line 12459 "./marpa.w"
+/*:1234*//*1260:*/
+#line 16014 "./marpa.w"
 
 struct marpa_order{
 struct marpa_obstack*t_ordering_obs;
 ANDID**t_and_node_orderings;
-/*1081:*/
-#line 12477 "./marpa.w"
+/*1263:*/
+#line 16032 "./marpa.w"
 
 BOCAGE t_bocage;
 
-/*:1081*/
-#line 12463 "./marpa.w"
+/*:1263*/
+#line 16018 "./marpa.w"
 
-/*1084:*/
-#line 12497 "./marpa.w"
+/*1266:*/
+#line 16052 "./marpa.w"
 int t_ref_count;
-/*:1084*//*1091:*/
-#line 12553 "./marpa.w"
+/*:1266*//*1273:*/
+#line 16109 "./marpa.w"
 int t_ambiguity_metric;
 
-/*:1091*//*1097:*/
-#line 12665 "./marpa.w"
+/*:1273*//*1279:*/
+#line 16221 "./marpa.w"
 int t_high_rank_count;
-/*:1097*/
-#line 12464 "./marpa.w"
+/*:1279*/
+#line 16019 "./marpa.w"
 
-/*1095:*/
-#line 12647 "./marpa.w"
+/*1277:*/
+#line 16203 "./marpa.w"
 
 BITFIELD t_is_nulling:1;
-/*:1095*/
-#line 12465 "./marpa.w"
+/*:1277*/
+#line 16020 "./marpa.w"
 
 BITFIELD t_is_frozen:1;
 };
-/*:1078*//*1116:*/
-#line 12998 "./marpa.w"
+/*:1260*//*1298:*/
+#line 16554 "./marpa.w"
 
-/*1147:*/
-#line 13406 "./marpa.w"
+/*1329:*/
+#line 16964 "./marpa.w"
 
 struct s_nook{
 OR t_or_node;
@@ -1668,99 +1811,99 @@ BITFIELD t_is_predecessor_of_parent:1;
 };
 typedef struct s_nook NOOK_Object;
 
-/*:1147*/
-#line 12999 "./marpa.w"
+/*:1329*/
+#line 16555 "./marpa.w"
 
-/*1152:*/
-#line 13454 "./marpa.w"
+/*1334:*/
+#line 17012 "./marpa.w"
 
 struct s_value{
 struct marpa_value public;
 Marpa_Tree t_tree;
-/*1156:*/
-#line 13532 "./marpa.w"
+/*1338:*/
+#line 17090 "./marpa.w"
 
 struct marpa_obstack*t_obs;
-/*:1156*//*1161:*/
-#line 13579 "./marpa.w"
+/*:1338*//*1343:*/
+#line 17137 "./marpa.w"
 
 MARPA_DSTACK_DECLARE(t_virtual_stack);
-/*:1161*//*1186:*/
-#line 13752 "./marpa.w"
+/*:1343*//*1368:*/
+#line 17311 "./marpa.w"
 
 LBV t_xsy_is_valued;
 LBV t_xrl_is_valued;
 LBV t_valued_locked;
 
-/*:1186*/
-#line 13458 "./marpa.w"
+/*:1368*/
+#line 17016 "./marpa.w"
 
-/*1166:*/
-#line 13627 "./marpa.w"
+/*1348:*/
+#line 17186 "./marpa.w"
 
 int t_ref_count;
-/*:1166*//*1173:*/
-#line 13685 "./marpa.w"
+/*:1348*//*1355:*/
+#line 17244 "./marpa.w"
 
 unsigned int t_generation;
 
-/*:1173*//*1181:*/
-#line 13727 "./marpa.w"
+/*:1355*//*1363:*/
+#line 17286 "./marpa.w"
 
 NOOKID t_nook;
-/*:1181*/
-#line 13459 "./marpa.w"
+/*:1363*/
+#line 17017 "./marpa.w"
 
 int t_token_type;
 int t_next_value_type;
-/*1176:*/
-#line 13698 "./marpa.w"
+/*1358:*/
+#line 17257 "./marpa.w"
 
 BITFIELD t_is_nulling:1;
-/*:1176*//*1178:*/
-#line 13705 "./marpa.w"
+/*:1358*//*1360:*/
+#line 17264 "./marpa.w"
 
 BITFIELD t_trace:1;
-/*:1178*/
-#line 13462 "./marpa.w"
+/*:1360*/
+#line 17020 "./marpa.w"
 
 };
 
-/*:1152*/
-#line 13000 "./marpa.w"
+/*:1334*/
+#line 16556 "./marpa.w"
 
 struct marpa_tree{
 FSTACK_DECLARE(t_nook_stack,NOOK_Object)
 FSTACK_DECLARE(t_nook_worklist,int)
 Bit_Vector t_or_node_in_use;
 Marpa_Order t_order;
-/*1122:*/
-#line 13071 "./marpa.w"
+/*1304:*/
+#line 16627 "./marpa.w"
 
 int t_ref_count;
-/*:1122*//*1127:*/
-#line 13124 "./marpa.w"
+/*:1304*//*1309:*/
+#line 16682 "./marpa.w"
 unsigned int t_generation;
-/*:1127*/
-#line 13006 "./marpa.w"
+/*:1309*/
+#line 16562 "./marpa.w"
 
-/*1131:*/
-#line 13184 "./marpa.w"
+/*1313:*/
+#line 16742 "./marpa.w"
 
 BITFIELD t_is_exhausted:1;
-/*:1131*//*1134:*/
-#line 13192 "./marpa.w"
+/*:1313*//*1316:*/
+#line 16750 "./marpa.w"
 
 BITFIELD t_is_nulling:1;
 
-/*:1134*/
-#line 13007 "./marpa.w"
+/*:1316*/
+#line 16563 "./marpa.w"
 
 int t_parse_count;
 };
 
-/*:1116*//*1243:*/
-#line 14793 "./marpa.w"
+/*:1298*//*1427:*/
+#line 18376 "./marpa.w"
 
 struct s_bit_matrix{
 int t_row_count;
@@ -1769,13 +1912,13 @@ Bit_Vector_Word t_row_data[1];
 typedef struct s_bit_matrix*Bit_Matrix;
 typedef struct s_bit_matrix Bit_Matrix_Object;
 
-/*:1243*//*1264:*/
-#line 15012 "./marpa.w"
+/*:1427*//*1450:*/
+#line 18739 "./marpa.w"
 
 struct s_dqueue{int t_current;struct marpa_dstack_s t_stack;};
 
-/*:1264*//*1290:*/
-#line 15404 "./marpa.w"
+/*:1450*//*1476:*/
+#line 19132 "./marpa.w"
 
 struct s_per_earley_set_list{
 PSL t_prev;
@@ -1784,31 +1927,32 @@ PSL*t_owner;
 void*t_data[1];
 };
 typedef struct s_per_earley_set_list PSL_Object;
-/*:1290*//*1292:*/
-#line 15429 "./marpa.w"
+/*:1476*//*1478:*/
+#line 19157 "./marpa.w"
 
 struct s_per_earley_set_arena{
 int t_psl_length;
 PSL t_first_psl;
 PSL t_first_free_psl;
+struct marpa_allocator_s t_allocator;
 };
 typedef struct s_per_earley_set_arena PSAR_Object;
-/*:1292*/
-#line 17325 "./marpa.w"
+/*:1478*/
+#line 21337 "./marpa.w"
 
-/*672:*/
-#line 7198 "./marpa.w"
+/*701:*/
+#line 7621 "./marpa.w"
 
 union _Marpa_PIM_Object{
 LIM_Object t_leo;
 YIX_Object t_earley;
 };
-/*:672*/
-#line 17326 "./marpa.w"
+/*:701*/
+#line 21338 "./marpa.w"
 
 
-/*:1450*//*1451:*/
-#line 17331 "./marpa.w"
+/*:1652*//*1653:*/
+#line 21343 "./marpa.w"
 
 /*40:*/
 #line 570 "./marpa.w"
@@ -1817,19 +1961,24 @@ const int marpa_major_version= MARPA_LIB_MAJOR_VERSION;
 const int marpa_minor_version= MARPA_LIB_MINOR_VERSION;
 const int marpa_micro_version= MARPA_LIB_MICRO_VERSION;
 
-/*:40*//*833:*/
-#line 9656 "./marpa.w"
+/*:40*//*386:*/
+#line 3450 "./marpa.w"
+
+static const struct marpa_precompute_stats precompute_stats_zero= {0};
+
+/*:386*//*1002:*/
+#line 12973 "./marpa.w"
 
 static const struct marpa_progress_item progress_report_not_ready= {-2,-2,-2};
 
-/*:833*//*888:*/
-#line 10371 "./marpa.w"
+/*:1002*//*1061:*/
+#line 13833 "./marpa.w"
 
 static const int dummy_or_node_type= DUMMY_OR_NODE;
 static const OR dummy_or_node= (OR)&dummy_or_node_type;
 
-/*:888*//*1209:*/
-#line 14278 "./marpa.w"
+/*:1061*//*1392:*/
+#line 17851 "./marpa.w"
 
 static const unsigned int bv_wordbits= lbv_wordbits;
 static const unsigned int bv_modmask= lbv_wordbits-1u;
@@ -1837,57 +1986,69 @@ static const unsigned int bv_hiddenwords= 3;
 static const unsigned int bv_lsb= lbv_lsb;
 static const unsigned int bv_msb= lbv_msb;
 
-/*:1209*/
-#line 17332 "./marpa.w"
+/*:1392*/
+#line 21344 "./marpa.w"
 
 
-/*:1451*//*1452:*/
-#line 17334 "./marpa.w"
+/*:1653*//*1654:*/
+#line 21346 "./marpa.w"
 
-/*553:*/
-#line 6038 "./marpa.w"
+/*575:*/
+#line 6357 "./marpa.w"
 
 struct marpa_r{
-/*561:*/
-#line 6118 "./marpa.w"
+/*583:*/
+#line 6441 "./marpa.w"
 
 GRAMMAR t_grammar;
-/*:561*//*568:*/
-#line 6145 "./marpa.w"
+/*:583*//*590:*/
+#line 6468 "./marpa.w"
 
 YS t_first_earley_set;
 YS t_latest_earley_set;
 JEARLEME t_current_earleme;
-/*:568*//*580:*/
-#line 6228 "./marpa.w"
+/*:590*//*602:*/
+#line 6551 "./marpa.w"
 
 Bit_Vector t_lbv_xsyid_completion_event_is_active;
 Bit_Vector t_lbv_xsyid_nulled_event_is_active;
 Bit_Vector t_lbv_xsyid_prediction_event_is_active;
-/*:580*//*583:*/
-#line 6253 "./marpa.w"
+/*:602*//*605:*/
+#line 6576 "./marpa.w"
 Bit_Vector t_bv_nsyid_is_expected;
-/*:583*//*587:*/
-#line 6330 "./marpa.w"
+/*:605*//*609:*/
+#line 6653 "./marpa.w"
 LBV t_nsy_expected_is_event;
-/*:587*//*609:*/
-#line 6604 "./marpa.w"
+/*:609*//*631:*/
+#line 6927 "./marpa.w"
 
 Bit_Vector t_bv_irl_seen;
 MARPA_DSTACK_DECLARE(t_irl_cil_stack);
-/*:609*//*618:*/
-#line 6658 "./marpa.w"
+/*:631*//*634:*/
+#line 6941 "./marpa.w"
+
+Bit_Vector t_bv_ahm_predicted;
+/*:634*//*642:*/
+#line 6991 "./marpa.w"
 struct marpa_obstack*t_obs;
-/*:618*//*622:*/
-#line 6679 "./marpa.w"
+/*:642*//*646:*/
+#line 7012 "./marpa.w"
 
 ZWA t_zwas;
-/*:622*//*704:*/
-#line 7575 "./marpa.w"
+/*:646*//*733:*/
+#line 8013 "./marpa.w"
 
 MARPA_DSTACK_DECLARE(t_alternatives);
-/*:704*//*721:*/
-#line 7862 "./marpa.w"
+/*:733*//*749:*/
+#line 8316 "./marpa.w"
+
+struct marpa_obstack_mark t_reset_mark;
+/*:749*//*761:*/
+#line 8483 "./marpa.w"
+
+MARPA_DSTACK_DECLARE(t_checkpoints);
+/*:761*//*770:*/
+#line 8729 "./marpa.w"
 
 LBV t_valued_terminal;
 LBV t_unvalued_terminal;
@@ -1895,115 +2056,158 @@ LBV t_valued;
 LBV t_unvalued;
 LBV t_valued_locked;
 
-/*:721*//*729:*/
-#line 8075 "./marpa.w"
+/*:770*//*780:*/
+#line 8950 "./marpa.w"
 MARPA_DSTACK_DECLARE(t_yim_work_stack);
-/*:729*//*733:*/
-#line 8090 "./marpa.w"
+/*:780*//*784:*/
+#line 8965 "./marpa.w"
 MARPA_DSTACK_DECLARE(t_completion_stack);
-/*:733*//*737:*/
-#line 8101 "./marpa.w"
+/*:784*//*788:*/
+#line 8976 "./marpa.w"
 MARPA_DSTACK_DECLARE(t_earley_set_stack);
-/*:737*//*774:*/
-#line 8731 "./marpa.w"
+/*:788*//*822:*/
+#line 9700 "./marpa.w"
+
+struct marpa_obstack*t_ys_obs;
+YS_BATCH t_first_ys_batch;
+YS_BATCH t_latest_ys_batch;
+/*:822*//*846:*/
+#line 10030 "./marpa.w"
+
+Bit_Vector t_bv_lookahead;
+/*:846*//*943:*/
+#line 12047 "./marpa.w"
 
 Bit_Vector t_bv_lim_symbols;
 Bit_Vector t_bv_pim_symbols;
 void**t_pim_workarea;
-/*:774*//*793:*/
-#line 9015 "./marpa.w"
+/*:943*//*962:*/
+#line 12331 "./marpa.w"
 
 void**t_lim_chain;
-/*:793*//*828:*/
-#line 9632 "./marpa.w"
+/*:962*//*997:*/
+#line 12949 "./marpa.w"
 
 const struct marpa_progress_item*t_current_report_item;
 MARPA_AVL_TRAV t_progress_report_traverser;
-/*:828*//*862:*/
-#line 10064 "./marpa.w"
+/*:997*//*1013:*/
+#line 13321 "./marpa.w"
+
+Bit_Vector t_bv_completed_xrl;
+/*:1013*//*1035:*/
+#line 13525 "./marpa.w"
 
 struct s_ur_node_stack t_ur_node_stack;
-/*:862*//*1293:*/
-#line 15437 "./marpa.w"
+/*:1035*//*1479:*/
+#line 19166 "./marpa.w"
 
 PSAR_Object t_dot_psar_object;
-/*:1293*//*1344:*/
-#line 15905 "./marpa.w"
+/*:1479*//*1538:*/
+#line 19754 "./marpa.w"
+size_t t_memory_limit;
+/*:1538*//*1546:*/
+#line 19889 "./marpa.w"
 
 struct s_earley_set*t_trace_earley_set;
-/*:1344*//*1351:*/
-#line 15981 "./marpa.w"
+/*:1546*//*1553:*/
+#line 19975 "./marpa.w"
 
 YIM t_trace_earley_item;
-/*:1351*//*1365:*/
-#line 16180 "./marpa.w"
+/*:1553*//*1567:*/
+#line 20179 "./marpa.w"
 
 PIM*t_trace_pim_nsy_p;
 PIM t_trace_postdot_item;
-/*:1365*//*1372:*/
-#line 16329 "./marpa.w"
+/*:1567*//*1574:*/
+#line 20328 "./marpa.w"
 
 SRCL t_trace_source_link;
-/*:1372*/
-#line 6040 "./marpa.w"
+/*:1574*/
+#line 6359 "./marpa.w"
 
-/*556:*/
-#line 6068 "./marpa.w"
+/*578:*/
+#line 6388 "./marpa.w"
 int t_ref_count;
-/*:556*//*572:*/
-#line 6182 "./marpa.w"
+/*:578*//*594:*/
+#line 6505 "./marpa.w"
 int t_earley_item_warning_threshold;
-/*:572*//*576:*/
-#line 6211 "./marpa.w"
+/*:594*//*598:*/
+#line 6534 "./marpa.w"
 JEARLEME t_furthest_earleme;
-/*:576*//*581:*/
-#line 6232 "./marpa.w"
+/*:598*//*603:*/
+#line 6555 "./marpa.w"
 
 int t_active_event_count;
-/*:581*//*616:*/
-#line 6651 "./marpa.w"
+/*:603*//*640:*/
+#line 6984 "./marpa.w"
 YSID t_first_inconsistent_ys;
-/*:616*//*637:*/
-#line 6773 "./marpa.w"
+/*:640*//*661:*/
+#line 7107 "./marpa.w"
 
 int t_earley_set_count;
-/*:637*/
-#line 6041 "./marpa.w"
+/*:661*//*751:*/
+#line 8335 "./marpa.w"
+unsigned int t_generation;
+/*:751*//*771:*/
+#line 8739 "./marpa.w"
+int t_valued_change_count;
+/*:771*//*835:*/
+#line 9825 "./marpa.w"
 
-/*565:*/
-#line 6136 "./marpa.w"
+YSID t_next_forget_ysid;
+/*:835*/
+#line 6360 "./marpa.w"
+
+/*587:*/
+#line 6459 "./marpa.w"
 
 BITFIELD t_input_phase:2;
-/*:565*//*605:*/
-#line 6571 "./marpa.w"
+/*:587*//*627:*/
+#line 6894 "./marpa.w"
 
 BITFIELD t_use_leo_flag:1;
 BITFIELD t_is_using_leo:1;
-/*:605*//*612:*/
-#line 6623 "./marpa.w"
+/*:627*//*636:*/
+#line 6956 "./marpa.w"
 BITFIELD t_is_exhausted:1;
-/*:612*//*1373:*/
-#line 16331 "./marpa.w"
+/*:636*//*815:*/
+#line 9638 "./marpa.w"
+
+BITFIELD t_is_forgetful:1;
+/*:815*//*823:*/
+#line 9704 "./marpa.w"
+
+BITFIELD t_ys_batch_is_closed:1;
+/*:823*//*844:*/
+#line 10022 "./marpa.w"
+
+BITFIELD t_is_lookahead_filtered:1;
+/*:844*//*854:*/
+#line 10154 "./marpa.w"
+
+BITFIELD t_is_link_free:1;
+/*:854*//*1575:*/
+#line 20330 "./marpa.w"
 
 BITFIELD t_trace_source_type:3;
-/*:1373*/
-#line 6042 "./marpa.w"
+/*:1575*/
+#line 6361 "./marpa.w"
 
 };
 
-/*:553*/
-#line 17335 "./marpa.w"
+/*:575*/
+#line 21347 "./marpa.w"
 
-/*683:*/
-#line 7287 "./marpa.w"
+/*712:*/
+#line 7710 "./marpa.w"
 
 struct s_token_source{
 NSYID t_nsyid;
 int t_value;
 };
 
-/*:683*//*684:*/
-#line 7296 "./marpa.w"
+/*:712*//*713:*/
+#line 7719 "./marpa.w"
 
 struct s_source{
 void*t_predecessor;
@@ -2016,8 +2220,8 @@ BITFIELD t_is_active:1;
 
 };
 
-/*:684*//*687:*/
-#line 7313 "./marpa.w"
+/*:713*//*716:*/
+#line 7736 "./marpa.w"
 
 struct marpa_source_link_s{
 SRCL t_next;
@@ -2025,8 +2229,8 @@ struct s_source t_source;
 };
 typedef struct marpa_source_link_s SRCL_Object;
 
-/*:687*//*688:*/
-#line 7320 "./marpa.w"
+/*:716*//*717:*/
+#line 7743 "./marpa.w"
 
 struct s_ambiguous_source{
 SRCL t_leo;
@@ -2034,19 +2238,19 @@ SRCL t_token;
 SRCL t_completion;
 };
 
-/*:688*//*689:*/
-#line 7327 "./marpa.w"
+/*:717*//*718:*/
+#line 7750 "./marpa.w"
 
 union u_source_container{
 struct s_ambiguous_source t_ambiguous;
 struct marpa_source_link_s t_unique;
 };
 
-/*:689*/
-#line 17336 "./marpa.w"
+/*:718*/
+#line 21348 "./marpa.w"
 
-/*654:*/
-#line 6967 "./marpa.w"
+/*678:*/
+#line 7315 "./marpa.w"
 
 struct s_earley_item_key{
 AHM t_ahm;
@@ -2055,198 +2259,234 @@ YS t_set;
 };
 typedef struct s_earley_item_key YIK_Object;
 struct s_earley_item{
-YIK_Object t_key;
-union u_source_container t_container;
+YS t_origin;
+YS t_set;
+#if MARPA_COMPACT_YIM
+AHMID t_ahmid;
+#else
+AHM t_ahm;
+#endif
 BITFIELD t_ordinal:YIM_ORDINAL_WIDTH;
 BITFIELD t_source_type:3;
 BITFIELD t_is_rejected:1;
 BITFIELD t_is_active:1;
 BITFIELD t_was_scanned:1;
 BITFIELD t_was_fusion:1;
+union u_source_container t_container;
 };
 typedef struct s_earley_item YIM_Object;
+/*680:*/
+#line 7364 "./marpa.w"
+
+#if MARPA_COMPACT_YIM
+#define AHM_of_YIM(yim) (AHMs_of_YS(YS_of_YIM(yim)) + (yim)->t_ahmid)
+#define AHMID_of_YIM(yim) ((AHMID)(yim)->t_ahmid)
+#define AHM_of_YIM_Set(yim, ahm) \
+  ((yim)->t_ahmid =  (AHMID)((ahm) - AHMs_of_YS(YS_of_YIM(yim))))
+#define AHM_is_Unsourced(ahm) AHM_is_Prediction(ahm)
+#else
+#define AHM_of_YIM(yim) ((yim)->t_ahm)
+#define AHMID_of_YIM(yim) ID_of_AHM(AHM_of_YIM(yim))
+#define AHM_of_YIM_Set(yim, ahm) ((yim)->t_ahm =  (ahm))
+#define AHM_is_Unsourced(ahm) ((void)(ahm), 0)
+#endif
+/*:680*/
+#line 7339 "./marpa.w"
+
 
-/*:654*/
-#line 17337 "./marpa.w"
+/*:678*/
+#line 21349 "./marpa.w"
 
-/*935:*/
-#line 11122 "./marpa.w"
+/*1108:*/
+#line 14585 "./marpa.w"
 
 struct marpa_traverser{
-/*936:*/
-#line 11137 "./marpa.w"
+/*1109:*/
+#line 14600 "./marpa.w"
 
 YIM t_trv_yim;
 SRCL t_trv_leo_srcl;
 SRCL t_trv_token_srcl;
 SRCL t_trv_completion_srcl;
 
-/*:936*//*942:*/
-#line 11162 "./marpa.w"
+/*:1109*//*1115:*/
+#line 14625 "./marpa.w"
 
 RECCE t_trv_recce;
-/*:942*/
-#line 11124 "./marpa.w"
+/*:1115*/
+#line 14587 "./marpa.w"
 
-/*959:*/
-#line 11467 "./marpa.w"
+/*1118:*/
+#line 14637 "./marpa.w"
+
+unsigned int t_trv_r_generation;
+/*:1118*//*1135:*/
+#line 14963 "./marpa.w"
 
 int t_ref_count;
-/*:959*/
-#line 11125 "./marpa.w"
+/*:1135*/
+#line 14588 "./marpa.w"
 
-/*938:*/
-#line 11150 "./marpa.w"
+/*1111:*/
+#line 14613 "./marpa.w"
 
 int t_trv_soft_error;
-/*:938*//*966:*/
-#line 11523 "./marpa.w"
+/*:1111*//*1142:*/
+#line 15020 "./marpa.w"
 
 BITFIELD t_is_trivial:1;
-/*:966*/
-#line 11126 "./marpa.w"
+/*:1142*/
+#line 14589 "./marpa.w"
 
 };
 typedef struct marpa_traverser TRAVERSER_Object;
 
-/*:935*/
-#line 17338 "./marpa.w"
+/*:1108*/
+#line 21350 "./marpa.w"
 
-/*979:*/
-#line 11638 "./marpa.w"
+/*1155:*/
+#line 15141 "./marpa.w"
 
 struct marpa_ltraverser{
-/*980:*/
-#line 11650 "./marpa.w"
+/*1156:*/
+#line 15153 "./marpa.w"
 
 LIM t_ltrv_lim;
 
-/*:980*//*986:*/
-#line 11672 "./marpa.w"
+/*:1156*//*1162:*/
+#line 15175 "./marpa.w"
 
 RECCE t_ltrv_recce;
-/*:986*/
-#line 11640 "./marpa.w"
+/*:1162*/
+#line 15143 "./marpa.w"
+
+/*1165:*/
+#line 15187 "./marpa.w"
 
-/*996:*/
-#line 11741 "./marpa.w"
+unsigned int t_ltrv_r_generation;
+/*:1165*//*1175:*/
+#line 15259 "./marpa.w"
 
 int t_ref_count;
-/*:996*/
-#line 11641 "./marpa.w"
+/*:1175*/
+#line 15144 "./marpa.w"
 
-/*982:*/
-#line 11660 "./marpa.w"
+/*1158:*/
+#line 15163 "./marpa.w"
 
 int t_ltrv_soft_error;
-/*:982*/
-#line 11642 "./marpa.w"
+/*:1158*/
+#line 15145 "./marpa.w"
 
 };
 typedef struct marpa_ltraverser LTRAVERSER_Object;
 
-/*:979*/
-#line 17339 "./marpa.w"
+/*:1155*/
+#line 21351 "./marpa.w"
 
-/*1005:*/
-#line 11804 "./marpa.w"
+/*1184:*/
+#line 15323 "./marpa.w"
 
 struct marpa_ptraverser{
-/*1006:*/
-#line 11816 "./marpa.w"
+/*1185:*/
+#line 15335 "./marpa.w"
 
 PIM t_ptrv_pim;
 YS t_ptrv_ys;
 
-/*:1006*//*1012:*/
-#line 11839 "./marpa.w"
+/*:1185*//*1191:*/
+#line 15358 "./marpa.w"
 
 RECCE t_ptrv_recce;
-/*:1012*/
-#line 11806 "./marpa.w"
+/*:1191*/
+#line 15325 "./marpa.w"
 
-/*1023:*/
-#line 11995 "./marpa.w"
+/*1194:*/
+#line 15370 "./marpa.w"
+
+unsigned int t_ptrv_r_generation;
+/*:1194*//*1205:*/
+#line 15535 "./marpa.w"
 
 int t_ref_count;
-/*:1023*/
-#line 11807 "./marpa.w"
+/*:1205*/
+#line 15326 "./marpa.w"
 
-/*1008:*/
-#line 11827 "./marpa.w"
+/*1187:*/
+#line 15346 "./marpa.w"
 
 int t_ptrv_soft_error;
-/*:1008*//*1030:*/
-#line 12051 "./marpa.w"
+/*:1187*//*1212:*/
+#line 15592 "./marpa.w"
 
 BITFIELD t_is_trivial:1;
-/*:1030*/
-#line 11808 "./marpa.w"
+/*:1212*/
+#line 15327 "./marpa.w"
 
 };
 typedef struct marpa_ptraverser PTRAVERSER_Object;
 
-/*:1005*/
-#line 17340 "./marpa.w"
+/*:1184*/
+#line 21352 "./marpa.w"
 
-/*1036:*/
-#line 12084 "./marpa.w"
+/*1218:*/
+#line 15626 "./marpa.w"
 
 struct marpa_bocage{
-/*1037:*/
-#line 12098 "./marpa.w"
+/*1219:*/
+#line 15640 "./marpa.w"
 
 OR*t_or_nodes;
 AND t_and_nodes;
-/*:1037*//*1041:*/
-#line 12127 "./marpa.w"
+/*:1219*//*1223:*/
+#line 15671 "./marpa.w"
 
 GRAMMAR t_grammar;
 
-/*:1041*//*1045:*/
-#line 12144 "./marpa.w"
+/*:1223*//*1227:*/
+#line 15688 "./marpa.w"
 
 struct marpa_obstack*t_obs;
-/*:1045*//*1048:*/
-#line 12212 "./marpa.w"
+/*:1227*//*1230:*/
+#line 15767 "./marpa.w"
 
 LBV t_valued_bv;
 LBV t_valued_locked_bv;
 
-/*:1048*/
-#line 12086 "./marpa.w"
+/*:1230*/
+#line 15628 "./marpa.w"
 
-/*1038:*/
-#line 12101 "./marpa.w"
+/*1220:*/
+#line 15643 "./marpa.w"
 
 int t_or_node_capacity;
 int t_or_node_count;
 int t_and_node_count;
 ORID t_top_or_node_id;
 
-/*:1038*//*1062:*/
-#line 12360 "./marpa.w"
+/*:1220*//*1244:*/
+#line 15915 "./marpa.w"
 int t_ambiguity_metric;
-/*:1062*//*1066:*/
-#line 12374 "./marpa.w"
+/*:1244*//*1248:*/
+#line 15929 "./marpa.w"
 int t_ref_count;
-/*:1066*/
-#line 12087 "./marpa.w"
+/*:1248*/
+#line 15629 "./marpa.w"
 
-/*1073:*/
-#line 12431 "./marpa.w"
+/*1255:*/
+#line 15986 "./marpa.w"
 
 BITFIELD t_is_nulling:1;
-/*:1073*/
-#line 12088 "./marpa.w"
+/*:1255*/
+#line 15630 "./marpa.w"
 
 };
 
-/*:1036*/
-#line 17341 "./marpa.w"
+/*:1218*/
+#line 21353 "./marpa.w"
 
 
-/*:1452*/
+/*:1654*/
 
 #line 1 "./marpa.c.p40"
 static RULE rule_new(GRAMMAR g,
@@ -2263,6 +2503,17 @@ static int zwp_cmp (
     void *param  UNUSED);
 static Marpa_Error_Code invalid_source_type_code(unsigned int type);
 static void earley_item_ambiguate (struct marpa_r * r, YIM item);
+static void earley_sets_forget(RECCE r);
+static void
+r_image_write (RECCE r, IMAGE_WRITER w);
+static int
+ys_image_read (RECCE r, IMAGE_READER rd, YS * sets, YS set);
+static int
+r_image_read (RECCE r, IMAGE_READER rd);
+static void
+g_image_write (GRAMMAR g, IMAGE_WRITER w);
+static int
+g_image_read (GRAMMAR g, IMAGE_READER rd);
 static void
 postdot_items_create (RECCE r,
   Bit_Vector bv_ok_for_chain,
@@ -2272,7 +2523,8 @@ static int report_item_cmp (
     const void* bp,
     void *param  UNUSED);
 static int bv_scan(Bit_Vector bv, int raw_start, int* raw_min, int* raw_max);
-static void transitive_closure(Bit_Matrix matrix);
+static void
+transitive_closure (MARPA_ALLOCATOR allocator, Bit_Matrix matrix);
 static int
 cil_cmp (const void *ap, const void *bp, void *param  UNUSED);
 static void
@@ -2310,6 +2562,8 @@ static inline void
 irl_finish( GRAMMAR g, IRL irl);
 static inline Marpa_Symbol_ID rule_lhs_get(RULE rule);
 static inline Marpa_Symbol_ID* rule_rhs_get(RULE rule);
+static inline void
+phase_clock (clock_t * p_phase_start, double *p_nanoseconds);
 static inline int ahm_is_valid(
 GRAMMAR g, AHMID item_id);
 static inline void
@@ -2321,6 +2575,7 @@ static inline void recce_free(struct marpa_r *r);
 static inline YS ys_at_current_earleme(RECCE r);
 static inline YS
 earley_set_new( RECCE r, JEARLEME id);
+static inline YIM earley_item_alloc(const RECCE r, const AHM ahm);
 static inline YIM earley_item_create(const RECCE r,
     const YIK_Object key);
 static inline YIM
@@ -2350,12 +2605,60 @@ static inline void trigger_events(RECCE r);
 static inline int trigger_trivial_events(RECCE r);
 static inline void earley_set_update_items(RECCE r, YS set);
 static inline void r_update_earley_sets(RECCE r);
+static inline YS
+ys_of_r_by_ord (RECCE r, YSID ysid);
+static inline void ys_batch_new(RECCE r);
+static inline void ys_batches_free(RECCE r);
+static inline void
+predicted_ahms_init (RECCE r);
+static inline void
+image_int_write (IMAGE_WRITER w, int value);
+static inline void
+image_lbv_write (IMAGE_WRITER w, LBV lbv, int bits);
+static inline void
+image_yim_ref_write (IMAGE_WRITER w, YIM yim);
+static inline void
+image_lim_ref_write (IMAGE_WRITER w, LIM lim);
+static inline void
+image_srcl_write (IMAGE_WRITER w, SRCL srcl, unsigned int source_type);
+static inline void
+image_srcl_chain_write (IMAGE_WRITER w, SRCL first_srcl,
+                        unsigned int source_type);
+static inline unsigned int
+grammar_image_hash (GRAMMAR g);
+static inline int
+image_int_read (IMAGE_READER rd);
+static inline int
+image_int_read_ranged (IMAGE_READER rd, int min, int limit);
+static inline int
+image_count_read (IMAGE_READER rd, int min_ints);
+static inline void
+image_lbv_read (IMAGE_READER rd, LBV lbv, int bits);
+static inline YIM
+image_yim_ref_read (IMAGE_READER rd, YS * sets, YS set);
+static inline LIM
+image_lim_ref_read (IMAGE_READER rd, YS * sets, YS set);
+static inline void
+image_srcl_read (IMAGE_READER rd, YS * sets, YS set, SRCL srcl,
+                 unsigned int source_type, int nsy_count);
+static inline SRCL
+image_srcl_chain_read (RECCE r, IMAGE_READER rd, YS * sets, YS set,
+                       unsigned int source_type);
+static inline void
+image_cil_write (IMAGE_WRITER w, CIL cil);
+static inline CIL
+image_cil_read (IMAGE_READER rd, CILAR cilar, int limit);
 static inline int alternative_is_acceptable(ALT alternative);
 static inline void
 progress_report_items_insert(MARPA_AVL_TREE report_tree,
   AHM report_ahm,
     YIM origin_yim);
-static inline void ur_node_stack_init(URS stack);
+static inline void
+completed_rules_insert(Bit_Vector bv_completed,
+  AHM report_ahm,
+    YIM origin_yim);
+static inline void ur_node_stack_init(URS stack,
+  struct marpa_obstack_cache *chunk_cache);
 static inline void ur_node_stack_reset(URS stack);
 static inline void ur_node_stack_destroy(URS stack);
 static inline UR ur_node_new(URS stack, UR prev);
@@ -2451,19 +2754,21 @@ static inline Bit_Vector
 lbv_obs_new0 (struct marpa_obstack *obs, int bits);
 static inline LBV lbv_clone(
   struct marpa_obstack* obs, LBV old_lbv, int bits);
+static inline LBV lbv_copy(
+  LBV lbv_to, LBV lbv_from, int bits);
 static inline LBV lbv_fill(
   LBV lbv, int bits);
 static inline unsigned int bv_bits_to_size(int bits);
 static inline unsigned int bv_bits_to_unused_mask(int bits);
-static inline Bit_Vector bv_create(int bits);
+static inline Bit_Vector bv_create(MARPA_ALLOCATOR allocator, int bits);
 static inline Bit_Vector
 bv_obs_create (struct marpa_obstack *obs, int bits);
-static inline Bit_Vector bv_shadow(Bit_Vector bv);
+static inline Bit_Vector bv_shadow(MARPA_ALLOCATOR allocator, Bit_Vector bv);
 static inline Bit_Vector bv_obs_shadow(struct marpa_obstack * obs, Bit_Vector bv);
 static inline Bit_Vector bv_copy(Bit_Vector bv_to, Bit_Vector bv_from);
-static inline Bit_Vector bv_clone(Bit_Vector bv);
+static inline Bit_Vector bv_clone(MARPA_ALLOCATOR allocator, Bit_Vector bv);
 static inline Bit_Vector bv_obs_clone(struct marpa_obstack *obs, Bit_Vector bv);
-static inline void bv_free(Bit_Vector vector);
+static inline void bv_free(MARPA_ALLOCATOR allocator, Bit_Vector vector);
 static inline void bv_fill(Bit_Vector bv);
 static inline void bv_clear(Bit_Vector bv);
 static inline void bv_over_clear(Bit_Vector bv, int raw_bit);
@@ -2473,6 +2778,7 @@ static inline int bv_bit_test(Bit_Vector vector, int raw_bit);
 static inline int
 bv_bit_test_then_set (Bit_Vector vector, int raw_bit);
 static inline int bv_is_empty(Bit_Vector addr);
+static inline int bv_is_equal(Bit_Vector X, Bit_Vector Y);
 static inline void bv_not(Bit_Vector X, Bit_Vector Y);
 static inline void bv_and(Bit_Vector X, Bit_Vector Y, Bit_Vector Z);
 static inline void bv_or(Bit_Vector X, Bit_Vector Y, Bit_Vector Z);
@@ -2495,7 +2801,7 @@ static inline void matrix_bit_set(Bit_Matrix matrix, int row, int column);
 static inline void matrix_bit_clear(Bit_Matrix matrix, int row, int column);
 static inline int matrix_bit_test(Bit_Matrix matrix, int row, int column);
 static inline void
-cilar_init (const CILAR cilar);
+cilar_init (const CILAR cilar, MARPA_ALLOCATOR allocator);
 static inline void
 cilar_buffer_reinit (const CILAR cilar);
 static inline void cilar_destroy(const CILAR cilar);
@@ -2511,10 +2817,11 @@ static inline CIL cil_merge_one(CILAR cilar, CIL cil, int new_element);
 static inline void
 psar_safe (const PSAR psar);
 static inline void
-psar_init (const PSAR psar, int length);
+psar_init (const PSAR psar, int length, MARPA_ALLOCATOR allocator);
 static inline void psar_destroy(const PSAR psar);
 static inline PSL psl_new(const PSAR psar);
 static inline void psar_reset(const PSAR psar);
+static inline void psar_clear(const PSAR psar);
 static inline void psar_dealloc(const PSAR psar);
 static inline void psl_claim(
     PSL* const psl_owner, const PSAR psar);
@@ -2525,54 +2832,60 @@ static inline PSL psl_claim_by_es(
 static inline PSL psl_alloc(const PSAR psar);
 static inline Marpa_Error_Code
 clear_error (GRAMMAR g);
+static inline size_t
+recce_memory_usage (RECCE r);
+static inline size_t
+bocage_memory_usage (BOCAGE b);
+static inline int
+memory_limit_is_exceeded (RECCE r, size_t extra);
 static inline void trace_earley_item_clear(RECCE r);
 static inline void trace_source_link_clear(RECCE r);
 
-/*1453:*/
-#line 17343 "./marpa.w"
+/*1655:*/
+#line 21355 "./marpa.w"
 
-/*1342:*/
-#line 15881 "./marpa.w"
+/*1530:*/
+#line 19637 "./marpa.w"
 
 extern void*(*const marpa__out_of_memory)(void);
 
-/*:1342*//*1433:*/
-#line 17155 "./marpa.w"
+/*:1530*//*1635:*/
+#line 21162 "./marpa.w"
 
 extern int marpa__default_debug_handler(const char*format,...);
 extern int(*marpa__debug_handler)(const char*,...);
 extern int marpa__debug_level;
 
-/*:1433*/
-#line 17344 "./marpa.w"
+/*:1635*/
+#line 21356 "./marpa.w"
 
 #if MARPA_DEBUG
-/*1438:*/
-#line 17187 "./marpa.w"
+/*1640:*/
+#line 21194 "./marpa.w"
 
 static const char*yim_tag_safe(
 char*buffer,GRAMMAR g,YIM yim)UNUSED;
 static const char*yim_tag(GRAMMAR g,YIM yim)UNUSED;
-/*:1438*//*1440:*/
-#line 17213 "./marpa.w"
+/*:1640*//*1642:*/
+#line 21220 "./marpa.w"
 
 static char*lim_tag_safe(char*buffer,LIM lim)UNUSED;
 static char*lim_tag(LIM lim)UNUSED;
-/*:1440*//*1442:*/
-#line 17239 "./marpa.w"
+/*:1642*//*1644:*/
+#line 21246 "./marpa.w"
 
 static const char*or_tag_safe(char*buffer,OR or)UNUSED;
 static const char*or_tag(OR or)UNUSED;
-/*:1442*//*1444:*/
-#line 17271 "./marpa.w"
+/*:1644*//*1646:*/
+#line 21278 "./marpa.w"
 
 static const char*ahm_tag_safe(char*buffer,AHM ahm)UNUSED;
 static const char*ahm_tag(AHM ahm)UNUSED;
-/*:1444*/
-#line 17346 "./marpa.w"
+/*:1646*/
+#line 21358 "./marpa.w"
 
-/*1439:*/
-#line 17192 "./marpa.w"
+/*1641:*/
+#line 21199 "./marpa.w"
 
 static const char*
 yim_tag_safe(char*buffer,GRAMMAR g,YIM yim)
@@ -2591,8 +2904,8 @@ yim_tag(GRAMMAR g,YIM yim)
 return yim_tag_safe(DEBUG_yim_tag_buffer,g,yim);
 }
 
-/*:1439*//*1441:*/
-#line 17218 "./marpa.w"
+/*:1641*//*1643:*/
+#line 21225 "./marpa.w"
 
 static char*
 lim_tag_safe(char*buffer,LIM lim)
@@ -2609,8 +2922,8 @@ lim_tag(LIM lim)
 return lim_tag_safe(DEBUG_lim_tag_buffer,lim);
 }
 
-/*:1441*//*1443:*/
-#line 17243 "./marpa.w"
+/*:1643*//*1645:*/
+#line 21250 "./marpa.w"
 
 static const char*
 or_tag_safe(char*buffer,OR or)
@@ -2632,8 +2945,8 @@ or_tag(OR or)
 return or_tag_safe(DEBUG_or_tag_buffer,or);
 }
 
-/*:1443*//*1445:*/
-#line 17274 "./marpa.w"
+/*:1645*//*1647:*/
+#line 21281 "./marpa.w"
 
 static const char*
 ahm_tag_safe(char*buffer,AHM ahm)
@@ -2655,19 +2968,19 @@ ahm_tag(AHM ahm)
 return ahm_tag_safe(DEBUG_ahm_tag_buffer,ahm);
 }
 
-/*:1445*/
-#line 17347 "./marpa.w"
+/*:1647*/
+#line 21359 "./marpa.w"
 
 #endif
-/*1437:*/
-#line 17179 "./marpa.w"
+/*1639:*/
+#line 21186 "./marpa.w"
 
 int(*marpa__debug_handler)(const char*,...)= 
 marpa__default_debug_handler;
 int marpa__debug_level= 0;
 
-/*:1437*/
-#line 17349 "./marpa.w"
+/*:1639*/
+#line 21361 "./marpa.w"
 
 /*41:*/
 #line 581 "./marpa.w"
@@ -2699,7 +3012,7 @@ return 0;
 }
 
 /*:42*//*45:*/
-#line 622 "./marpa.w"
+#line 624 "./marpa.w"
 
 int marpa_c_init(Marpa_Config*config)
 {
@@ -2708,11 +3021,28 @@ marpa__debug_level,STRLOC);
 config->t_is_ok= I_AM_OK;
 config->t_error= MARPA_ERR_NONE;
 config->t_error_string= NULL;
+config->t_allocator= NULL;
+config->t_allocator_context= NULL;
+return 0;
+}
+
+/*:45*//*47:*/
+#line 659 "./marpa.w"
+
+int marpa_c_allocator_set(Marpa_Config*config,
+Marpa_Allocator allocator,void*context)
+{
+if(config->t_is_ok!=I_AM_OK){
+config->t_error= MARPA_ERR_I_AM_NOT_OK;
+return-2;
+}
+config->t_allocator= allocator;
+config->t_allocator_context= context;
 return 0;
 }
 
-/*:45*//*46:*/
-#line 633 "./marpa.w"
+/*:47*//*48:*/
+#line 672 "./marpa.w"
 
 Marpa_Error_Code marpa_c_error(Marpa_Config*config,const char**p_error_string)
 {
@@ -2735,76 +3065,87 @@ return"[no tag]";
 #endif
 }
 
-/*:46*//*51:*/
-#line 674 "./marpa.w"
+/*:48*//*53:*/
+#line 715 "./marpa.w"
 
 Marpa_Grammar marpa_g_new(Marpa_Config*configuration)
 {
 GRAMMAR g;
+struct marpa_allocator_s allocator= {NULL,NULL};
 MARPA_OFF_DEBUG3("Debugging at level %ld is on: %s\n",
 marpa__debug_level,STRLOC);
 if(configuration&&configuration->t_is_ok!=I_AM_OK){
 configuration->t_error= MARPA_ERR_I_AM_NOT_OK;
 return NULL;
 }
-g= my_malloc(sizeof(struct marpa_g));
+if(configuration){
+allocator.t_function= configuration->t_allocator;
+allocator.t_context= configuration->t_allocator_context;
+}
+g= marpa__a_malloc(&allocator,sizeof(struct marpa_g));
+*Allocator_of_G(g)= allocator;
 
 
 g->t_is_ok= 0;
-/*54:*/
-#line 697 "./marpa.w"
+/*56:*/
+#line 744 "./marpa.w"
 
 g->t_ref_count= 1;
 
-/*:54*//*60:*/
-#line 753 "./marpa.w"
+/*:56*//*65:*/
+#line 823 "./marpa.w"
+
+Chunk_Cache_of_G(g)= 
+marpa__obs_cache_new(Allocator_of_G(g),DEFAULT_CHUNK_CACHE_MAX);
+/*:65*//*70:*/
+#line 861 "./marpa.w"
 
-MARPA_DSTACK_INIT2(g->t_xsy_stack,XSY);
+MARPA_DSTACK_INIT2(g->t_xsy_stack,XSY,Allocator_of_G(g));
 MARPA_DSTACK_SAFE(g->t_nsy_stack);
 
-/*:60*//*69:*/
-#line 811 "./marpa.w"
+/*:70*//*79:*/
+#line 919 "./marpa.w"
 
-MARPA_DSTACK_INIT2(g->t_xrl_stack,RULE);
+MARPA_DSTACK_INIT2(g->t_xrl_stack,RULE,Allocator_of_G(g));
 MARPA_DSTACK_SAFE(g->t_irl_stack);
 
-/*:69*//*79:*/
-#line 859 "./marpa.w"
+/*:79*//*89:*/
+#line 967 "./marpa.w"
 
 g->t_start_xsy_id= -1;
-/*:79*//*83:*/
-#line 897 "./marpa.w"
+/*:89*//*93:*/
+#line 1005 "./marpa.w"
 
 g->t_start_irl= NULL;
 
-/*:83*//*86:*/
-#line 911 "./marpa.w"
+/*:93*//*96:*/
+#line 1019 "./marpa.w"
 
 External_Size_of_G(g)= 0;
 
-/*:86*//*89:*/
-#line 924 "./marpa.w"
+/*:96*//*99:*/
+#line 1032 "./marpa.w"
 
 g->t_max_rule_length= 0;
 
-/*:89*//*93:*/
-#line 937 "./marpa.w"
+/*:99*//*103:*/
+#line 1045 "./marpa.w"
 
 g->t_default_rank= 0;
-/*:93*//*98:*/
-#line 972 "./marpa.w"
+/*:103*//*108:*/
+#line 1080 "./marpa.w"
 
 g->t_is_precomputed= 0;
-/*:98*//*101:*/
-#line 984 "./marpa.w"
+/*:108*//*111:*/
+#line 1092 "./marpa.w"
 
 g->t_has_cycle= 0;
-/*:101*//*104:*/
-#line 1004 "./marpa.w"
+/*:111*//*114:*/
+#line 1112 "./marpa.w"
 g->t_bv_nsyid_is_terminal= NULL;
 
-/*:104*//*106:*/
-#line 1019 "./marpa.w"
+/*:114*//*116:*/
+#line 1127 "./marpa.w"
 
 g->t_lbv_xsyid_is_completion_event= NULL;
 g->t_lbv_xsyid_completion_event_starts_active= NULL;
@@ -2813,51 +3154,59 @@ g->t_lbv_xsyid_nulled_event_starts_active= NULL;
 g->t_lbv_xsyid_is_prediction_event= NULL;
 g->t_lbv_xsyid_prediction_event_starts_active= NULL;
 
-/*:106*//*113:*/
-#line 1060 "./marpa.w"
+/*:116*//*123:*/
+#line 1168 "./marpa.w"
 
-MARPA_DSTACK_INIT(g->t_events,GEV_Object,INITIAL_G_EVENTS_CAPACITY);
-/*:113*//*121:*/
-#line 1132 "./marpa.w"
+MARPA_DSTACK_INIT(g->t_events,GEV_Object,INITIAL_G_EVENTS_CAPACITY,Allocator_of_G(g));
+/*:123*//*131:*/
+#line 1240 "./marpa.w"
 
-(g)->t_xrl_tree= _marpa_avl_create(duplicate_rule_cmp,NULL);
-/*:121*//*125:*/
-#line 1163 "./marpa.w"
+(g)->t_xrl_tree= _marpa_avl_create(duplicate_rule_cmp,NULL,Allocator_of_G(g));
+/*:131*//*135:*/
+#line 1271 "./marpa.w"
 
-g->t_obs= marpa_obs_init;
-g->t_xrl_obs= marpa_obs_init;
-/*:125*//*128:*/
-#line 1179 "./marpa.w"
+g->t_obs= marpa_obs_init(Allocator_of_G(g));
+g->t_xrl_obs= marpa_obs_init(Allocator_of_G(g));
+/*:135*//*138:*/
+#line 1287 "./marpa.w"
 
-cilar_init(&(g)->t_cilar);
-/*:128*//*137:*/
-#line 1227 "./marpa.w"
+cilar_init(&(g)->t_cilar,Allocator_of_G(g));
+/*:138*//*147:*/
+#line 1335 "./marpa.w"
 
 g->t_error= MARPA_ERR_NONE;
 g->t_error_string= NULL;
-/*:137*//*162:*/
-#line 1390 "./marpa.w"
+/*:147*//*172:*/
+#line 1498 "./marpa.w"
 
 g->t_force_valued= 0;
-/*:162*//*458:*/
-#line 4882 "./marpa.w"
+/*:172*//*385:*/
+#line 3448 "./marpa.w"
+
+Precompute_Stats_of_G(g)= precompute_stats_zero;
+/*:385*//*477:*/
+#line 5120 "./marpa.w"
 
 g->t_ahm_count= 0;
 
-/*:458*//*460:*/
-#line 4890 "./marpa.w"
+/*:477*//*479:*/
+#line 5128 "./marpa.w"
 
 g->t_ahms= NULL;
-/*:460*//*534:*/
-#line 5818 "./marpa.w"
+/*:479*//*492:*/
+#line 5220 "./marpa.w"
 
-MARPA_DSTACK_INIT2(g->t_gzwa_stack,GZWA);
-/*:534*//*542:*/
-#line 5857 "./marpa.w"
+SYMI_Count_of_G(g)= 0;
+/*:492*//*556:*/
+#line 6137 "./marpa.w"
 
-(g)->t_zwp_tree= _marpa_avl_create(zwp_cmp,NULL);
-/*:542*/
-#line 688 "./marpa.w"
+MARPA_DSTACK_INIT2(g->t_gzwa_stack,GZWA,Allocator_of_G(g));
+/*:556*//*564:*/
+#line 6176 "./marpa.w"
+
+(g)->t_zwp_tree= _marpa_avl_create(zwp_cmp,NULL,Allocator_of_G(g));
+/*:564*/
+#line 735 "./marpa.w"
 
 
 
@@ -2865,8 +3214,8 @@ g->t_is_ok= I_AM_OK;
 return g;
 }
 
-/*:51*//*55:*/
-#line 707 "./marpa.w"
+/*:53*//*57:*/
+#line 754 "./marpa.w"
 
 PRIVATE
 void
@@ -2883,8 +3232,8 @@ void
 marpa_g_unref(Marpa_Grammar g)
 {grammar_unref(g);}
 
-/*:55*//*57:*/
-#line 724 "./marpa.w"
+/*:57*//*59:*/
+#line 771 "./marpa.w"
 
 PRIVATE GRAMMAR
 grammar_ref(GRAMMAR g)
@@ -2897,106 +3246,176 @@ Marpa_Grammar
 marpa_g_ref(Marpa_Grammar g)
 {return grammar_ref(g);}
 
-/*:57*//*58:*/
-#line 736 "./marpa.w"
+/*:59*//*60:*/
+#line 785 "./marpa.w"
 
 PRIVATE
 void grammar_free(GRAMMAR g)
 {
-/*61:*/
-#line 757 "./marpa.w"
+struct marpa_allocator_s allocator= *Allocator_of_G(g);
+/*66:*/
+#line 826 "./marpa.w"
+
+marpa__obs_cache_unref(Chunk_Cache_of_G(g));
+
+/*:66*//*71:*/
+#line 865 "./marpa.w"
 
 {
 MARPA_DSTACK_DESTROY(g->t_xsy_stack);
 MARPA_DSTACK_DESTROY(g->t_nsy_stack);
 }
 
-/*:61*//*70:*/
-#line 815 "./marpa.w"
+/*:71*//*80:*/
+#line 923 "./marpa.w"
 
 MARPA_DSTACK_DESTROY(g->t_irl_stack);
 MARPA_DSTACK_DESTROY(g->t_xrl_stack);
 
-/*:70*//*114:*/
-#line 1062 "./marpa.w"
+/*:80*//*124:*/
+#line 1170 "./marpa.w"
 MARPA_DSTACK_DESTROY(g->t_events);
 
-/*:114*//*123:*/
-#line 1139 "./marpa.w"
+/*:124*//*133:*/
+#line 1247 "./marpa.w"
 
-/*122:*/
-#line 1134 "./marpa.w"
+/*132:*/
+#line 1242 "./marpa.w"
 
 {
 _marpa_avl_destroy((g)->t_xrl_tree);
 (g)->t_xrl_tree= NULL;
 }
-/*:122*/
-#line 1140 "./marpa.w"
+/*:132*/
+#line 1248 "./marpa.w"
 
 
-/*:123*//*126:*/
-#line 1166 "./marpa.w"
+/*:133*//*136:*/
+#line 1274 "./marpa.w"
 
 marpa_obs_free(g->t_obs);
 marpa_obs_free(g->t_xrl_obs);
 
-/*:126*//*129:*/
-#line 1181 "./marpa.w"
+/*:136*//*139:*/
+#line 1289 "./marpa.w"
 
 cilar_destroy(&(g)->t_cilar);
 
-/*:129*//*461:*/
-#line 4892 "./marpa.w"
+/*:139*//*480:*/
+#line 5130 "./marpa.w"
 
-my_free(g->t_ahms);
+marpa__a_free(Allocator_of_G(g),g->t_ahms);
 
-/*:461*//*535:*/
-#line 5820 "./marpa.w"
+/*:480*//*557:*/
+#line 6139 "./marpa.w"
 
 MARPA_DSTACK_DESTROY(g->t_gzwa_stack);
 
-/*:535*//*543:*/
-#line 5859 "./marpa.w"
+/*:557*//*565:*/
+#line 6178 "./marpa.w"
 
 {
 _marpa_avl_destroy((g)->t_zwp_tree);
 (g)->t_zwp_tree= NULL;
 }
 
-/*:543*//*544:*/
-#line 5865 "./marpa.w"
+/*:565*//*566:*/
+#line 6184 "./marpa.w"
 
-/*122:*/
-#line 1134 "./marpa.w"
+/*132:*/
+#line 1242 "./marpa.w"
 
 {
 _marpa_avl_destroy((g)->t_xrl_tree);
 (g)->t_xrl_tree= NULL;
 }
-/*:122*/
-#line 5866 "./marpa.w"
+/*:132*/
+#line 6185 "./marpa.w"
 
 
-/*:544*/
-#line 740 "./marpa.w"
+/*:566*/
+#line 790 "./marpa.w"
+
+marpa__a_free(&allocator,g);
+}
+
+/*:60*//*67:*/
+#line 833 "./marpa.w"
+
+size_t
+marpa_g_chunk_cache_max(Marpa_Grammar g)
+{
+/*1501:*/
+#line 19384 "./marpa.w"
+
+const size_t failure_indicator= (size_t)-2;
+
+/*:1501*/
+#line 837 "./marpa.w"
+
+/*1521:*/
+#line 19518 "./marpa.w"
+
+if(HEADER_VERSION_MISMATCH){
+MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
+return failure_indicator;
+}
+if(_MARPA_UNLIKELY(!IS_G_OK(g))){
+MARPA_ERROR(g->t_error);
+return failure_indicator;
+}
+
+/*:1521*/
+#line 838 "./marpa.w"
+
+return marpa_obs_cache_max(Chunk_Cache_of_G(g));
+}
+
+/*:67*//*68:*/
+#line 842 "./marpa.w"
+
+size_t
+marpa_g_chunk_cache_max_set(Marpa_Grammar g,size_t max)
+{
+/*1501:*/
+#line 19384 "./marpa.w"
+
+const size_t failure_indicator= (size_t)-2;
 
-my_free(g);
+/*:1501*/
+#line 846 "./marpa.w"
+
+/*1521:*/
+#line 19518 "./marpa.w"
+
+if(HEADER_VERSION_MISMATCH){
+MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
+return failure_indicator;
+}
+if(_MARPA_UNLIKELY(!IS_G_OK(g))){
+MARPA_ERROR(g->t_error);
+return failure_indicator;
+}
+
+/*:1521*/
+#line 847 "./marpa.w"
+
+marpa__obs_cache_max_set(Chunk_Cache_of_G(g),max);
+return max;
 }
 
-/*:58*//*63:*/
-#line 765 "./marpa.w"
+/*:68*//*73:*/
+#line 873 "./marpa.w"
 
 int marpa_g_highest_symbol_id(Marpa_Grammar g){
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 875 "./marpa.w"
 
-/*:1313*/
-#line 767 "./marpa.w"
-
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -3007,14 +3426,14 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 768 "./marpa.w"
+/*:1521*/
+#line 876 "./marpa.w"
 
 return XSY_Count_of_G(g)-1;
 }
 
-/*:63*//*65:*/
-#line 777 "./marpa.w"
+/*:73*//*75:*/
+#line 885 "./marpa.w"
 
 PRIVATE
 void symbol_add(GRAMMAR g,XSY symbol)
@@ -3024,35 +3443,34 @@ const XSYID new_id= MARPA_DSTACK_LENGTH((g)->t_xsy_stack);
 symbol->t_symbol_id= new_id;
 }
 
-/*:65*//*66:*/
-#line 789 "./marpa.w"
+/*:75*//*76:*/
+#line 897 "./marpa.w"
 
 PRIVATE int xsy_id_is_valid(GRAMMAR g,XSYID xsy_id)
 {
 return!XSYID_is_Malformed(xsy_id)&&XSYID_of_G_Exists(xsy_id);
 }
 
-/*:66*//*67:*/
-#line 798 "./marpa.w"
+/*:76*//*77:*/
+#line 906 "./marpa.w"
 
 PRIVATE int nsy_is_valid(GRAMMAR g,NSYID nsyid)
 {
 return nsyid>=0&&nsyid<NSY_Count_of_G(g);
 }
 
-/*:67*//*74:*/
-#line 822 "./marpa.w"
+/*:77*//*84:*/
+#line 930 "./marpa.w"
 
 int marpa_g_highest_rule_id(Marpa_Grammar g){
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 932 "./marpa.w"
 
-/*:1313*/
-#line 824 "./marpa.w"
-
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -3063,21 +3481,20 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 825 "./marpa.w"
+/*:1521*/
+#line 933 "./marpa.w"
 
 return XRL_Count_of_G(g)-1;
 }
 int _marpa_g_irl_count(Marpa_Grammar g){
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 937 "./marpa.w"
 
-/*:1313*/
-#line 829 "./marpa.w"
-
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -3088,14 +3505,14 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 830 "./marpa.w"
+/*:1521*/
+#line 938 "./marpa.w"
 
 return IRL_Count_of_G(g);
 }
 
-/*:74*//*76:*/
-#line 840 "./marpa.w"
+/*:84*//*86:*/
+#line 948 "./marpa.w"
 
 PRIVATE void
 rule_add(GRAMMAR g,RULE rule)
@@ -3107,20 +3524,19 @@ External_Size_of_G(g)+= 1+Length_of_XRL(rule);
 g->t_max_rule_length= MAX(Length_of_XRL(rule),g->t_max_rule_length);
 }
 
-/*:76*//*80:*/
-#line 861 "./marpa.w"
+/*:86*//*90:*/
+#line 969 "./marpa.w"
 
 Marpa_Symbol_ID marpa_g_start_symbol(Marpa_Grammar g)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 972 "./marpa.w"
 
-/*:1313*/
-#line 864 "./marpa.w"
-
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -3131,8 +3547,8 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 865 "./marpa.w"
+/*:1521*/
+#line 973 "./marpa.w"
 
 if(g->t_start_xsy_id<0){
 MARPA_ERROR(MARPA_ERR_NO_START_SYMBOL);
@@ -3140,20 +3556,19 @@ return-1;
 }
 return g->t_start_xsy_id;
 }
-/*:80*//*81:*/
-#line 878 "./marpa.w"
+/*:90*//*91:*/
+#line 986 "./marpa.w"
 
 Marpa_Symbol_ID marpa_g_start_symbol_set(Marpa_Grammar g,Marpa_Symbol_ID xsy_id)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 989 "./marpa.w"
 
-/*:1313*/
-#line 881 "./marpa.w"
-
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -3164,58 +3579,57 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 882 "./marpa.w"
+/*:1521*/
+#line 990 "./marpa.w"
 
-/*1314:*/
-#line 15634 "./marpa.w"
+/*1502:*/
+#line 19390 "./marpa.w"
 
 if(_MARPA_UNLIKELY(G_is_Precomputed(g))){
 MARPA_ERROR(MARPA_ERR_PRECOMPUTED);
 return failure_indicator;
 }
 
-/*:1314*/
-#line 883 "./marpa.w"
+/*:1502*/
+#line 991 "./marpa.w"
 
-/*1316:*/
-#line 15645 "./marpa.w"
+/*1504:*/
+#line 19401 "./marpa.w"
 
 if(_MARPA_UNLIKELY(XSYID_is_Malformed(xsy_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_SYMBOL_ID);
 return failure_indicator;
 }
-/*:1316*/
-#line 884 "./marpa.w"
+/*:1504*/
+#line 992 "./marpa.w"
 
-/*1317:*/
-#line 15652 "./marpa.w"
+/*1505:*/
+#line 19408 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!XSYID_of_G_Exists(xsy_id))){
 MARPA_ERROR(MARPA_ERR_NO_SUCH_SYMBOL_ID);
 return-1;
 }
-/*:1317*/
-#line 885 "./marpa.w"
+/*:1505*/
+#line 993 "./marpa.w"
 
 return g->t_start_xsy_id= xsy_id;
 }
 
-/*:81*//*94:*/
-#line 939 "./marpa.w"
+/*:91*//*104:*/
+#line 1047 "./marpa.w"
 
 Marpa_Rank marpa_g_default_rank(Marpa_Grammar g)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
-
-/*:1313*/
-#line 942 "./marpa.w"
+/*:1500*/
+#line 1050 "./marpa.w"
 
 clear_error(g);
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -3226,26 +3640,25 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 944 "./marpa.w"
+/*:1521*/
+#line 1052 "./marpa.w"
 
 return Default_Rank_of_G(g);
 }
-/*:94*//*95:*/
-#line 949 "./marpa.w"
+/*:104*//*105:*/
+#line 1057 "./marpa.w"
 
 Marpa_Rank marpa_g_default_rank_set(Marpa_Grammar g,Marpa_Rank rank)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
-
-/*:1313*/
-#line 952 "./marpa.w"
+/*:1500*/
+#line 1060 "./marpa.w"
 
 clear_error(g);
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -3256,19 +3669,19 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 954 "./marpa.w"
+/*:1521*/
+#line 1062 "./marpa.w"
 
-/*1314:*/
-#line 15634 "./marpa.w"
+/*1502:*/
+#line 19390 "./marpa.w"
 
 if(_MARPA_UNLIKELY(G_is_Precomputed(g))){
 MARPA_ERROR(MARPA_ERR_PRECOMPUTED);
 return failure_indicator;
 }
 
-/*:1314*/
-#line 955 "./marpa.w"
+/*:1502*/
+#line 1063 "./marpa.w"
 
 if(_MARPA_UNLIKELY(rank<MINIMUM_RANK))
 {
@@ -3283,20 +3696,19 @@ return failure_indicator;
 return Default_Rank_of_G(g)= rank;
 }
 
-/*:95*//*99:*/
-#line 974 "./marpa.w"
+/*:105*//*109:*/
+#line 1082 "./marpa.w"
 
 int marpa_g_is_precomputed(Marpa_Grammar g)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 1085 "./marpa.w"
 
-/*:1313*/
-#line 977 "./marpa.w"
-
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -3307,26 +3719,25 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 978 "./marpa.w"
+/*:1521*/
+#line 1086 "./marpa.w"
 
 return G_is_Precomputed(g);
 }
 
-/*:99*//*102:*/
-#line 986 "./marpa.w"
+/*:109*//*112:*/
+#line 1094 "./marpa.w"
 
 int marpa_g_has_cycle(Marpa_Grammar g)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 1097 "./marpa.w"
 
-/*:1313*/
-#line 989 "./marpa.w"
-
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -3337,14 +3748,14 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 990 "./marpa.w"
+/*:1521*/
+#line 1098 "./marpa.w"
 
 return g->t_has_cycle;
 }
 
-/*:102*//*116:*/
-#line 1072 "./marpa.w"
+/*:112*//*126:*/
+#line 1180 "./marpa.w"
 
 PRIVATE
 void event_new(GRAMMAR g,int type)
@@ -3355,8 +3766,8 @@ GEV end_of_stack= G_EVENT_PUSH(g);
 end_of_stack->t_type= type;
 end_of_stack->t_value= 0;
 }
-/*:116*//*117:*/
-#line 1082 "./marpa.w"
+/*:126*//*127:*/
+#line 1190 "./marpa.w"
 
 PRIVATE
 void int_event_new(GRAMMAR g,int type,int value)
@@ -3368,19 +3779,18 @@ end_of_stack->t_type= type;
 end_of_stack->t_value= value;
 }
 
-/*:117*//*118:*/
-#line 1093 "./marpa.w"
+/*:127*//*128:*/
+#line 1201 "./marpa.w"
 
 Marpa_Event_Type
 marpa_g_event(Marpa_Grammar g,Marpa_Event*public_event,
 int ix)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
-
-/*:1313*/
-#line 1098 "./marpa.w"
+/*:1500*/
+#line 1206 "./marpa.w"
 
 MARPA_DSTACK events= &g->t_events;
 GEV internal_event;
@@ -3401,21 +3811,20 @@ public_event->t_value= internal_event->t_value;
 return type;
 }
 
-/*:118*//*119:*/
-#line 1118 "./marpa.w"
+/*:128*//*129:*/
+#line 1226 "./marpa.w"
 
 Marpa_Event_Type
 marpa_g_event_count(Marpa_Grammar g)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 1230 "./marpa.w"
 
-/*:1313*/
-#line 1122 "./marpa.w"
-
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -3426,14 +3835,14 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 1123 "./marpa.w"
+/*:1521*/
+#line 1231 "./marpa.w"
 
 return MARPA_DSTACK_LENGTH(g->t_events);
 }
 
-/*:119*//*139:*/
-#line 1238 "./marpa.w"
+/*:129*//*149:*/
+#line 1346 "./marpa.w"
 
 Marpa_Error_Code marpa_g_error(Marpa_Grammar g,const char**p_error_string)
 {
@@ -3445,8 +3854,8 @@ if(p_error_string){
 return error_code;
 }
 
-/*:139*//*140:*/
-#line 1249 "./marpa.w"
+/*:149*//*150:*/
+#line 1357 "./marpa.w"
 
 Marpa_Error_Code
 marpa_g_error_clear(Marpa_Grammar g)
@@ -3455,93 +3864,93 @@ clear_error(g);
 return g->t_error;
 }
 
-/*:140*//*146:*/
-#line 1279 "./marpa.w"
+/*:150*//*156:*/
+#line 1387 "./marpa.w"
 
 PRIVATE XSY
 symbol_new(GRAMMAR g)
 {
 XSY xsy= marpa_obs_new(g->t_obs,struct s_xsy,1);
-/*151:*/
-#line 1312 "./marpa.w"
+/*161:*/
+#line 1420 "./marpa.w"
 
 xsy->t_rank= Default_Rank_of_G(g);
-/*:151*//*155:*/
-#line 1358 "./marpa.w"
+/*:161*//*165:*/
+#line 1466 "./marpa.w"
 
 XSY_is_LHS(xsy)= 0;
 
-/*:155*//*157:*/
-#line 1365 "./marpa.w"
+/*:165*//*167:*/
+#line 1473 "./marpa.w"
 
 XSY_is_Sequence_LHS(xsy)= 0;
 
-/*:157*//*159:*/
-#line 1381 "./marpa.w"
+/*:167*//*169:*/
+#line 1489 "./marpa.w"
 
 XSY_is_Valued(xsy)= g->t_force_valued?1:0;
 XSY_is_Valued_Locked(xsy)= g->t_force_valued?1:0;
 
-/*:159*//*167:*/
-#line 1449 "./marpa.w"
+/*:169*//*177:*/
+#line 1557 "./marpa.w"
 
 xsy->t_is_accessible= 0;
-/*:167*//*170:*/
-#line 1470 "./marpa.w"
+/*:177*//*180:*/
+#line 1578 "./marpa.w"
 
 xsy->t_is_counted= 0;
-/*:170*//*173:*/
-#line 1486 "./marpa.w"
+/*:180*//*183:*/
+#line 1594 "./marpa.w"
 
 xsy->t_is_nulling= 0;
-/*:173*//*176:*/
-#line 1503 "./marpa.w"
+/*:183*//*186:*/
+#line 1611 "./marpa.w"
 
 xsy->t_is_nullable= 0;
-/*:176*//*179:*/
-#line 1526 "./marpa.w"
+/*:186*//*189:*/
+#line 1634 "./marpa.w"
 
 xsy->t_is_terminal= 0;
 xsy->t_is_locked_terminal= 0;
-/*:179*//*184:*/
-#line 1571 "./marpa.w"
+/*:189*//*194:*/
+#line 1679 "./marpa.w"
 
 xsy->t_is_productive= 0;
-/*:184*//*187:*/
-#line 1594 "./marpa.w"
+/*:194*//*197:*/
+#line 1702 "./marpa.w"
 
 xsy->t_is_completion_event= 0;
 xsy->t_completion_event_starts_active= 0;
-/*:187*//*192:*/
-#line 1664 "./marpa.w"
+/*:197*//*202:*/
+#line 1772 "./marpa.w"
 
 xsy->t_is_nulled_event= 0;
 xsy->t_nulled_event_starts_active= 0;
-/*:192*//*197:*/
-#line 1737 "./marpa.w"
+/*:202*//*207:*/
+#line 1845 "./marpa.w"
 
 xsy->t_is_prediction_event= 0;
 xsy->t_prediction_event_starts_active= 0;
-/*:197*//*203:*/
-#line 1816 "./marpa.w"
+/*:207*//*213:*/
+#line 1924 "./marpa.w"
 
 Nulled_XSYIDs_of_XSY(xsy)= NULL;
 
-/*:203*//*206:*/
-#line 1832 "./marpa.w"
+/*:213*//*216:*/
+#line 1940 "./marpa.w"
 NSY_of_XSY(xsy)= NULL;
-/*:206*//*210:*/
-#line 1864 "./marpa.w"
+/*:216*//*220:*/
+#line 1972 "./marpa.w"
 Nulling_NSY_of_XSY(xsy)= NULL;
-/*:210*/
-#line 1284 "./marpa.w"
+/*:220*/
+#line 1392 "./marpa.w"
 
 symbol_add(g,xsy);
 return xsy;
 }
 
-/*:146*//*147:*/
-#line 1289 "./marpa.w"
+/*:156*//*157:*/
+#line 1397 "./marpa.w"
 
 Marpa_Symbol_ID
 marpa_g_symbol_new(Marpa_Grammar g)
@@ -3550,20 +3959,19 @@ const XSY symbol= symbol_new(g);
 return ID_of_XSY(symbol);
 }
 
-/*:147*//*149:*/
-#line 1298 "./marpa.w"
+/*:157*//*159:*/
+#line 1406 "./marpa.w"
 
 int marpa_g_symbol_is_start(Marpa_Grammar g,Marpa_Symbol_ID xsy_id)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 1409 "./marpa.w"
 
-/*:1313*/
-#line 1301 "./marpa.w"
-
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -3574,50 +3982,49 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 1302 "./marpa.w"
+/*:1521*/
+#line 1410 "./marpa.w"
 
-/*1316:*/
-#line 15645 "./marpa.w"
+/*1504:*/
+#line 19401 "./marpa.w"
 
 if(_MARPA_UNLIKELY(XSYID_is_Malformed(xsy_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_SYMBOL_ID);
 return failure_indicator;
 }
-/*:1316*/
-#line 1303 "./marpa.w"
+/*:1504*/
+#line 1411 "./marpa.w"
 
-/*1317:*/
-#line 15652 "./marpa.w"
+/*1505:*/
+#line 19408 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!XSYID_of_G_Exists(xsy_id))){
 MARPA_ERROR(MARPA_ERR_NO_SUCH_SYMBOL_ID);
 return-1;
 }
-/*:1317*/
-#line 1304 "./marpa.w"
+/*:1505*/
+#line 1412 "./marpa.w"
 
 if(g->t_start_xsy_id<0)return 0;
 return xsy_id==g->t_start_xsy_id?1:0;
 }
 
-/*:149*//*152:*/
-#line 1315 "./marpa.w"
+/*:159*//*162:*/
+#line 1423 "./marpa.w"
 
 int marpa_g_symbol_rank(Marpa_Grammar g,
 Marpa_Symbol_ID xsy_id)
 {
 XSY xsy;
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
-
-/*:1313*/
-#line 1320 "./marpa.w"
+/*:1500*/
+#line 1428 "./marpa.w"
 
 clear_error(g);
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -3628,50 +4035,49 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 1322 "./marpa.w"
+/*:1521*/
+#line 1430 "./marpa.w"
 
-/*1316:*/
-#line 15645 "./marpa.w"
+/*1504:*/
+#line 19401 "./marpa.w"
 
 if(_MARPA_UNLIKELY(XSYID_is_Malformed(xsy_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_SYMBOL_ID);
 return failure_indicator;
 }
-/*:1316*/
-#line 1323 "./marpa.w"
+/*:1504*/
+#line 1431 "./marpa.w"
 
-/*1318:*/
-#line 15657 "./marpa.w"
+/*1506:*/
+#line 19413 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!XSYID_of_G_Exists(xsy_id))){
 MARPA_ERROR(MARPA_ERR_NO_SUCH_SYMBOL_ID);
 return failure_indicator;
 }
 
-/*:1318*/
-#line 1324 "./marpa.w"
+/*:1506*/
+#line 1432 "./marpa.w"
 
 xsy= XSY_by_ID(xsy_id);
 return Rank_of_XSY(xsy);
 }
-/*:152*//*153:*/
-#line 1328 "./marpa.w"
+/*:162*//*163:*/
+#line 1436 "./marpa.w"
 
 int marpa_g_symbol_rank_set(
 Marpa_Grammar g,Marpa_Symbol_ID xsy_id,Marpa_Rank rank)
 {
 XSY xsy;
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
-
-/*:1313*/
-#line 1333 "./marpa.w"
+/*:1500*/
+#line 1441 "./marpa.w"
 
 clear_error(g);
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -3682,40 +4088,40 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 1335 "./marpa.w"
+/*:1521*/
+#line 1443 "./marpa.w"
 
-/*1314:*/
-#line 15634 "./marpa.w"
+/*1502:*/
+#line 19390 "./marpa.w"
 
 if(_MARPA_UNLIKELY(G_is_Precomputed(g))){
 MARPA_ERROR(MARPA_ERR_PRECOMPUTED);
 return failure_indicator;
 }
 
-/*:1314*/
-#line 1336 "./marpa.w"
+/*:1502*/
+#line 1444 "./marpa.w"
 
-/*1316:*/
-#line 15645 "./marpa.w"
+/*1504:*/
+#line 19401 "./marpa.w"
 
 if(_MARPA_UNLIKELY(XSYID_is_Malformed(xsy_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_SYMBOL_ID);
 return failure_indicator;
 }
-/*:1316*/
-#line 1337 "./marpa.w"
+/*:1504*/
+#line 1445 "./marpa.w"
 
-/*1318:*/
-#line 15657 "./marpa.w"
+/*1506:*/
+#line 19413 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!XSYID_of_G_Exists(xsy_id))){
 MARPA_ERROR(MARPA_ERR_NO_SUCH_SYMBOL_ID);
 return failure_indicator;
 }
 
-/*:1318*/
-#line 1338 "./marpa.w"
+/*:1506*/
+#line 1446 "./marpa.w"
 
 xsy= XSY_by_ID(xsy_id);
 if(_MARPA_UNLIKELY(rank<MINIMUM_RANK))
@@ -3731,18 +4137,17 @@ return failure_indicator;
 return Rank_of_XSY(xsy)= rank;
 }
 
-/*:153*//*163:*/
-#line 1392 "./marpa.w"
+/*:163*//*173:*/
+#line 1500 "./marpa.w"
 
 int marpa_g_force_valued(Marpa_Grammar g)
 {
 XSYID xsyid;
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
-
-/*:1313*/
-#line 1396 "./marpa.w"
+/*:1500*/
+#line 1504 "./marpa.w"
 
 for(xsyid= 0;xsyid<XSY_Count_of_G(g);xsyid++){
 const XSY xsy= XSY_by_ID(xsyid);
@@ -3758,76 +4163,74 @@ g->t_force_valued= 1;
 return 0;
 }
 
-/*:163*//*164:*/
-#line 1411 "./marpa.w"
+/*:173*//*174:*/
+#line 1519 "./marpa.w"
 
 int marpa_g_symbol_is_valued(
 Marpa_Grammar g,
 Marpa_Symbol_ID xsy_id)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 1524 "./marpa.w"
 
-/*:1313*/
-#line 1416 "./marpa.w"
-
-/*1316:*/
-#line 15645 "./marpa.w"
+/*1504:*/
+#line 19401 "./marpa.w"
 
 if(_MARPA_UNLIKELY(XSYID_is_Malformed(xsy_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_SYMBOL_ID);
 return failure_indicator;
 }
-/*:1316*/
-#line 1417 "./marpa.w"
+/*:1504*/
+#line 1525 "./marpa.w"
 
-/*1317:*/
-#line 15652 "./marpa.w"
+/*1505:*/
+#line 19408 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!XSYID_of_G_Exists(xsy_id))){
 MARPA_ERROR(MARPA_ERR_NO_SUCH_SYMBOL_ID);
 return-1;
 }
-/*:1317*/
-#line 1418 "./marpa.w"
+/*:1505*/
+#line 1526 "./marpa.w"
 
 return XSY_is_Valued(XSY_by_ID(xsy_id));
 }
 
-/*:164*//*165:*/
-#line 1422 "./marpa.w"
+/*:174*//*175:*/
+#line 1530 "./marpa.w"
 
 int marpa_g_symbol_is_valued_set(
 Marpa_Grammar g,Marpa_Symbol_ID xsy_id,int value)
 {
 XSY symbol;
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 1535 "./marpa.w"
 
-/*:1313*/
-#line 1427 "./marpa.w"
-
-/*1316:*/
-#line 15645 "./marpa.w"
+/*1504:*/
+#line 19401 "./marpa.w"
 
 if(_MARPA_UNLIKELY(XSYID_is_Malformed(xsy_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_SYMBOL_ID);
 return failure_indicator;
 }
-/*:1316*/
-#line 1428 "./marpa.w"
+/*:1504*/
+#line 1536 "./marpa.w"
 
-/*1317:*/
-#line 15652 "./marpa.w"
+/*1505:*/
+#line 19408 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!XSYID_of_G_Exists(xsy_id))){
 MARPA_ERROR(MARPA_ERR_NO_SUCH_SYMBOL_ID);
 return-1;
 }
-/*:1317*/
-#line 1429 "./marpa.w"
+/*:1505*/
+#line 1537 "./marpa.w"
 
 symbol= XSY_by_ID(xsy_id);
 if(_MARPA_UNLIKELY(value<0||value> 1))
@@ -3845,20 +4248,19 @@ XSY_is_Valued(symbol)= Boolean(value);
 return value;
 }
 
-/*:165*//*168:*/
-#line 1457 "./marpa.w"
+/*:175*//*178:*/
+#line 1565 "./marpa.w"
 
 int marpa_g_symbol_is_accessible(Marpa_Grammar g,Marpa_Symbol_ID xsy_id)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 1568 "./marpa.w"
 
-/*:1313*/
-#line 1460 "./marpa.w"
-
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -3869,57 +4271,56 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 1461 "./marpa.w"
+/*:1521*/
+#line 1569 "./marpa.w"
 
-/*1315:*/
-#line 15640 "./marpa.w"
+/*1503:*/
+#line 19396 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!G_is_Precomputed(g))){
 MARPA_ERROR(MARPA_ERR_NOT_PRECOMPUTED);
 return failure_indicator;
 }
-/*:1315*/
-#line 1462 "./marpa.w"
+/*:1503*/
+#line 1570 "./marpa.w"
 
-/*1316:*/
-#line 15645 "./marpa.w"
+/*1504:*/
+#line 19401 "./marpa.w"
 
 if(_MARPA_UNLIKELY(XSYID_is_Malformed(xsy_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_SYMBOL_ID);
 return failure_indicator;
 }
-/*:1316*/
-#line 1463 "./marpa.w"
+/*:1504*/
+#line 1571 "./marpa.w"
 
-/*1317:*/
-#line 15652 "./marpa.w"
+/*1505:*/
+#line 19408 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!XSYID_of_G_Exists(xsy_id))){
 MARPA_ERROR(MARPA_ERR_NO_SUCH_SYMBOL_ID);
 return-1;
 }
-/*:1317*/
-#line 1464 "./marpa.w"
+/*:1505*/
+#line 1572 "./marpa.w"
 
 return XSY_is_Accessible(XSY_by_ID(xsy_id));
 }
 
-/*:168*//*171:*/
-#line 1472 "./marpa.w"
+/*:178*//*181:*/
+#line 1580 "./marpa.w"
 
 int marpa_g_symbol_is_counted(Marpa_Grammar g,
 Marpa_Symbol_ID xsy_id)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 1584 "./marpa.w"
 
-/*:1313*/
-#line 1476 "./marpa.w"
-
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -3930,46 +4331,45 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 1477 "./marpa.w"
+/*:1521*/
+#line 1585 "./marpa.w"
 
-/*1316:*/
-#line 15645 "./marpa.w"
+/*1504:*/
+#line 19401 "./marpa.w"
 
 if(_MARPA_UNLIKELY(XSYID_is_Malformed(xsy_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_SYMBOL_ID);
 return failure_indicator;
 }
-/*:1316*/
-#line 1478 "./marpa.w"
+/*:1504*/
+#line 1586 "./marpa.w"
 
-/*1317:*/
-#line 15652 "./marpa.w"
+/*1505:*/
+#line 19408 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!XSYID_of_G_Exists(xsy_id))){
 MARPA_ERROR(MARPA_ERR_NO_SUCH_SYMBOL_ID);
 return-1;
 }
-/*:1317*/
-#line 1479 "./marpa.w"
+/*:1505*/
+#line 1587 "./marpa.w"
 
 return XSY_by_ID(xsy_id)->t_is_counted;
 }
 
-/*:171*//*174:*/
-#line 1488 "./marpa.w"
+/*:181*//*184:*/
+#line 1596 "./marpa.w"
 
 int marpa_g_symbol_is_nulling(Marpa_Grammar g,Marpa_Symbol_ID xsy_id)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 1599 "./marpa.w"
 
-/*:1313*/
-#line 1491 "./marpa.w"
-
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -3980,56 +4380,55 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 1492 "./marpa.w"
+/*:1521*/
+#line 1600 "./marpa.w"
 
-/*1315:*/
-#line 15640 "./marpa.w"
+/*1503:*/
+#line 19396 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!G_is_Precomputed(g))){
 MARPA_ERROR(MARPA_ERR_NOT_PRECOMPUTED);
 return failure_indicator;
 }
-/*:1315*/
-#line 1493 "./marpa.w"
+/*:1503*/
+#line 1601 "./marpa.w"
 
-/*1316:*/
-#line 15645 "./marpa.w"
+/*1504:*/
+#line 19401 "./marpa.w"
 
 if(_MARPA_UNLIKELY(XSYID_is_Malformed(xsy_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_SYMBOL_ID);
 return failure_indicator;
 }
-/*:1316*/
-#line 1494 "./marpa.w"
+/*:1504*/
+#line 1602 "./marpa.w"
 
-/*1317:*/
-#line 15652 "./marpa.w"
+/*1505:*/
+#line 19408 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!XSYID_of_G_Exists(xsy_id))){
 MARPA_ERROR(MARPA_ERR_NO_SUCH_SYMBOL_ID);
 return-1;
 }
-/*:1317*/
-#line 1495 "./marpa.w"
+/*:1505*/
+#line 1603 "./marpa.w"
 
 return XSY_is_Nulling(XSY_by_ID(xsy_id));
 }
 
-/*:174*//*177:*/
-#line 1505 "./marpa.w"
+/*:184*//*187:*/
+#line 1613 "./marpa.w"
 
 int marpa_g_symbol_is_nullable(Marpa_Grammar g,Marpa_Symbol_ID xsy_id)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 1616 "./marpa.w"
 
-/*:1313*/
-#line 1508 "./marpa.w"
-
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -4040,57 +4439,56 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 1509 "./marpa.w"
+/*:1521*/
+#line 1617 "./marpa.w"
 
-/*1315:*/
-#line 15640 "./marpa.w"
+/*1503:*/
+#line 19396 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!G_is_Precomputed(g))){
 MARPA_ERROR(MARPA_ERR_NOT_PRECOMPUTED);
 return failure_indicator;
 }
-/*:1315*/
-#line 1510 "./marpa.w"
+/*:1503*/
+#line 1618 "./marpa.w"
 
-/*1316:*/
-#line 15645 "./marpa.w"
+/*1504:*/
+#line 19401 "./marpa.w"
 
 if(_MARPA_UNLIKELY(XSYID_is_Malformed(xsy_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_SYMBOL_ID);
 return failure_indicator;
 }
-/*:1316*/
-#line 1511 "./marpa.w"
+/*:1504*/
+#line 1619 "./marpa.w"
 
-/*1317:*/
-#line 15652 "./marpa.w"
+/*1505:*/
+#line 19408 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!XSYID_of_G_Exists(xsy_id))){
 MARPA_ERROR(MARPA_ERR_NO_SUCH_SYMBOL_ID);
 return-1;
 }
-/*:1317*/
-#line 1512 "./marpa.w"
+/*:1505*/
+#line 1620 "./marpa.w"
 
 return XSYID_is_Nullable(xsy_id);
 }
 
-/*:177*//*181:*/
-#line 1532 "./marpa.w"
+/*:187*//*191:*/
+#line 1640 "./marpa.w"
 
 int marpa_g_symbol_is_terminal(Marpa_Grammar g,
 Marpa_Symbol_ID xsy_id)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 1644 "./marpa.w"
 
-/*:1313*/
-#line 1536 "./marpa.w"
-
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -4101,47 +4499,46 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 1537 "./marpa.w"
+/*:1521*/
+#line 1645 "./marpa.w"
 
-/*1316:*/
-#line 15645 "./marpa.w"
+/*1504:*/
+#line 19401 "./marpa.w"
 
 if(_MARPA_UNLIKELY(XSYID_is_Malformed(xsy_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_SYMBOL_ID);
 return failure_indicator;
 }
-/*:1316*/
-#line 1538 "./marpa.w"
+/*:1504*/
+#line 1646 "./marpa.w"
 
-/*1317:*/
-#line 15652 "./marpa.w"
+/*1505:*/
+#line 19408 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!XSYID_of_G_Exists(xsy_id))){
 MARPA_ERROR(MARPA_ERR_NO_SUCH_SYMBOL_ID);
 return-1;
 }
-/*:1317*/
-#line 1539 "./marpa.w"
+/*:1505*/
+#line 1647 "./marpa.w"
 
 return XSYID_is_Terminal(xsy_id);
 }
-/*:181*//*182:*/
-#line 1542 "./marpa.w"
+/*:191*//*192:*/
+#line 1650 "./marpa.w"
 
 int marpa_g_symbol_is_terminal_set(
 Marpa_Grammar g,Marpa_Symbol_ID xsy_id,int value)
 {
 XSY symbol;
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 1655 "./marpa.w"
 
-/*:1313*/
-#line 1547 "./marpa.w"
-
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -4152,39 +4549,39 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 1548 "./marpa.w"
+/*:1521*/
+#line 1656 "./marpa.w"
 
-/*1314:*/
-#line 15634 "./marpa.w"
+/*1502:*/
+#line 19390 "./marpa.w"
 
 if(_MARPA_UNLIKELY(G_is_Precomputed(g))){
 MARPA_ERROR(MARPA_ERR_PRECOMPUTED);
 return failure_indicator;
 }
 
-/*:1314*/
-#line 1549 "./marpa.w"
+/*:1502*/
+#line 1657 "./marpa.w"
 
-/*1316:*/
-#line 15645 "./marpa.w"
+/*1504:*/
+#line 19401 "./marpa.w"
 
 if(_MARPA_UNLIKELY(XSYID_is_Malformed(xsy_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_SYMBOL_ID);
 return failure_indicator;
 }
-/*:1316*/
-#line 1550 "./marpa.w"
+/*:1504*/
+#line 1658 "./marpa.w"
 
-/*1317:*/
-#line 15652 "./marpa.w"
+/*1505:*/
+#line 19408 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!XSYID_of_G_Exists(xsy_id))){
 MARPA_ERROR(MARPA_ERR_NO_SUCH_SYMBOL_ID);
 return-1;
 }
-/*:1317*/
-#line 1551 "./marpa.w"
+/*:1505*/
+#line 1659 "./marpa.w"
 
 symbol= XSY_by_ID(xsy_id);
 if(_MARPA_UNLIKELY(value<0||value> 1))
@@ -4202,22 +4599,21 @@ XSY_is_Locked_Terminal(symbol)= 1;
 return XSY_is_Terminal(symbol)= Boolean(value);
 }
 
-/*:182*//*185:*/
-#line 1573 "./marpa.w"
+/*:192*//*195:*/
+#line 1681 "./marpa.w"
 
 int marpa_g_symbol_is_productive(
 Marpa_Grammar g,
 Marpa_Symbol_ID xsy_id)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 1686 "./marpa.w"
 
-/*:1313*/
-#line 1578 "./marpa.w"
-
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -4228,57 +4624,56 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 1579 "./marpa.w"
+/*:1521*/
+#line 1687 "./marpa.w"
 
-/*1315:*/
-#line 15640 "./marpa.w"
+/*1503:*/
+#line 19396 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!G_is_Precomputed(g))){
 MARPA_ERROR(MARPA_ERR_NOT_PRECOMPUTED);
 return failure_indicator;
 }
-/*:1315*/
-#line 1580 "./marpa.w"
+/*:1503*/
+#line 1688 "./marpa.w"
 
-/*1316:*/
-#line 15645 "./marpa.w"
+/*1504:*/
+#line 19401 "./marpa.w"
 
 if(_MARPA_UNLIKELY(XSYID_is_Malformed(xsy_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_SYMBOL_ID);
 return failure_indicator;
 }
-/*:1316*/
-#line 1581 "./marpa.w"
+/*:1504*/
+#line 1689 "./marpa.w"
 
-/*1317:*/
-#line 15652 "./marpa.w"
+/*1505:*/
+#line 19408 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!XSYID_of_G_Exists(xsy_id))){
 MARPA_ERROR(MARPA_ERR_NO_SUCH_SYMBOL_ID);
 return-1;
 }
-/*:1317*/
-#line 1582 "./marpa.w"
+/*:1505*/
+#line 1690 "./marpa.w"
 
 return XSY_is_Productive(XSY_by_ID(xsy_id));
 }
 
-/*:185*//*188:*/
-#line 1597 "./marpa.w"
+/*:195*//*198:*/
+#line 1705 "./marpa.w"
 
 int marpa_g_symbol_is_completion_event(Marpa_Grammar g,
 Marpa_Symbol_ID xsy_id)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 1709 "./marpa.w"
 
-/*:1313*/
-#line 1601 "./marpa.w"
-
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -4289,47 +4684,46 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 1602 "./marpa.w"
+/*:1521*/
+#line 1710 "./marpa.w"
 
-/*1316:*/
-#line 15645 "./marpa.w"
+/*1504:*/
+#line 19401 "./marpa.w"
 
 if(_MARPA_UNLIKELY(XSYID_is_Malformed(xsy_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_SYMBOL_ID);
 return failure_indicator;
 }
-/*:1316*/
-#line 1603 "./marpa.w"
+/*:1504*/
+#line 1711 "./marpa.w"
 
-/*1317:*/
-#line 15652 "./marpa.w"
+/*1505:*/
+#line 19408 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!XSYID_of_G_Exists(xsy_id))){
 MARPA_ERROR(MARPA_ERR_NO_SUCH_SYMBOL_ID);
 return-1;
 }
-/*:1317*/
-#line 1604 "./marpa.w"
+/*:1505*/
+#line 1712 "./marpa.w"
 
 return XSYID_is_Completion_Event(xsy_id);
 }
-/*:188*//*189:*/
-#line 1607 "./marpa.w"
+/*:198*//*199:*/
+#line 1715 "./marpa.w"
 
 int marpa_g_symbol_is_completion_event_set(
 Marpa_Grammar g,Marpa_Symbol_ID xsy_id,int value)
 {
 XSY xsy;
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 1720 "./marpa.w"
 
-/*:1313*/
-#line 1612 "./marpa.w"
-
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -4340,39 +4734,39 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 1613 "./marpa.w"
+/*:1521*/
+#line 1721 "./marpa.w"
 
-/*1314:*/
-#line 15634 "./marpa.w"
+/*1502:*/
+#line 19390 "./marpa.w"
 
 if(_MARPA_UNLIKELY(G_is_Precomputed(g))){
 MARPA_ERROR(MARPA_ERR_PRECOMPUTED);
 return failure_indicator;
 }
 
-/*:1314*/
-#line 1614 "./marpa.w"
+/*:1502*/
+#line 1722 "./marpa.w"
 
-/*1316:*/
-#line 15645 "./marpa.w"
+/*1504:*/
+#line 19401 "./marpa.w"
 
 if(_MARPA_UNLIKELY(XSYID_is_Malformed(xsy_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_SYMBOL_ID);
 return failure_indicator;
 }
-/*:1316*/
-#line 1615 "./marpa.w"
+/*:1504*/
+#line 1723 "./marpa.w"
 
-/*1317:*/
-#line 15652 "./marpa.w"
+/*1505:*/
+#line 19408 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!XSYID_of_G_Exists(xsy_id))){
 MARPA_ERROR(MARPA_ERR_NO_SUCH_SYMBOL_ID);
 return-1;
 }
-/*:1317*/
-#line 1616 "./marpa.w"
+/*:1505*/
+#line 1724 "./marpa.w"
 
 xsy= XSY_by_ID(xsy_id);
 switch(value){
@@ -4383,23 +4777,22 @@ return XSY_is_Completion_Event(xsy)= Boolean(value);
 MARPA_ERROR(MARPA_ERR_INVALID_BOOLEAN);
 return failure_indicator;
 }
-/*:189*//*190:*/
-#line 1626 "./marpa.w"
+/*:199*//*200:*/
+#line 1734 "./marpa.w"
 
 int
 marpa_g_completion_symbol_activate(Marpa_Grammar g,
 Marpa_Symbol_ID xsy_id,
 int reactivate)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 1740 "./marpa.w"
 
-/*:1313*/
-#line 1632 "./marpa.w"
-
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -4410,39 +4803,39 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 1633 "./marpa.w"
+/*:1521*/
+#line 1741 "./marpa.w"
 
-/*1314:*/
-#line 15634 "./marpa.w"
+/*1502:*/
+#line 19390 "./marpa.w"
 
 if(_MARPA_UNLIKELY(G_is_Precomputed(g))){
 MARPA_ERROR(MARPA_ERR_PRECOMPUTED);
 return failure_indicator;
 }
 
-/*:1314*/
-#line 1634 "./marpa.w"
+/*:1502*/
+#line 1742 "./marpa.w"
 
-/*1316:*/
-#line 15645 "./marpa.w"
+/*1504:*/
+#line 19401 "./marpa.w"
 
 if(_MARPA_UNLIKELY(XSYID_is_Malformed(xsy_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_SYMBOL_ID);
 return failure_indicator;
 }
-/*:1316*/
-#line 1635 "./marpa.w"
+/*:1504*/
+#line 1743 "./marpa.w"
 
-/*1317:*/
-#line 15652 "./marpa.w"
+/*1505:*/
+#line 19408 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!XSYID_of_G_Exists(xsy_id))){
 MARPA_ERROR(MARPA_ERR_NO_SUCH_SYMBOL_ID);
 return-1;
 }
-/*:1317*/
-#line 1636 "./marpa.w"
+/*:1505*/
+#line 1744 "./marpa.w"
 
 switch(reactivate){
 case 0:
@@ -4463,21 +4856,20 @@ MARPA_ERROR(MARPA_ERR_INVALID_BOOLEAN);
 return failure_indicator;
 }
 
-/*:190*//*193:*/
-#line 1667 "./marpa.w"
+/*:200*//*203:*/
+#line 1775 "./marpa.w"
 
 int marpa_g_symbol_is_nulled_event(Marpa_Grammar g,
 Marpa_Symbol_ID xsy_id)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 1779 "./marpa.w"
 
-/*:1313*/
-#line 1671 "./marpa.w"
-
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -4488,48 +4880,47 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 1672 "./marpa.w"
+/*:1521*/
+#line 1780 "./marpa.w"
 
-/*1316:*/
-#line 15645 "./marpa.w"
+/*1504:*/
+#line 19401 "./marpa.w"
 
 if(_MARPA_UNLIKELY(XSYID_is_Malformed(xsy_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_SYMBOL_ID);
 return failure_indicator;
 }
-/*:1316*/
-#line 1673 "./marpa.w"
+/*:1504*/
+#line 1781 "./marpa.w"
 
-/*1317:*/
-#line 15652 "./marpa.w"
+/*1505:*/
+#line 19408 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!XSYID_of_G_Exists(xsy_id))){
 MARPA_ERROR(MARPA_ERR_NO_SUCH_SYMBOL_ID);
 return-1;
 }
-/*:1317*/
-#line 1674 "./marpa.w"
+/*:1505*/
+#line 1782 "./marpa.w"
 
 return XSYID_is_Nulled_Event(xsy_id);
 }
 
-/*:193*//*194:*/
-#line 1680 "./marpa.w"
+/*:203*//*204:*/
+#line 1788 "./marpa.w"
 
 int marpa_g_symbol_is_nulled_event_set(
 Marpa_Grammar g,Marpa_Symbol_ID xsy_id,int value)
 {
 XSY xsy;
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 1793 "./marpa.w"
 
-/*:1313*/
-#line 1685 "./marpa.w"
-
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -4540,39 +4931,39 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 1686 "./marpa.w"
+/*:1521*/
+#line 1794 "./marpa.w"
 
-/*1314:*/
-#line 15634 "./marpa.w"
+/*1502:*/
+#line 19390 "./marpa.w"
 
 if(_MARPA_UNLIKELY(G_is_Precomputed(g))){
 MARPA_ERROR(MARPA_ERR_PRECOMPUTED);
 return failure_indicator;
 }
 
-/*:1314*/
-#line 1687 "./marpa.w"
+/*:1502*/
+#line 1795 "./marpa.w"
 
-/*1316:*/
-#line 15645 "./marpa.w"
+/*1504:*/
+#line 19401 "./marpa.w"
 
 if(_MARPA_UNLIKELY(XSYID_is_Malformed(xsy_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_SYMBOL_ID);
 return failure_indicator;
 }
-/*:1316*/
-#line 1688 "./marpa.w"
+/*:1504*/
+#line 1796 "./marpa.w"
 
-/*1317:*/
-#line 15652 "./marpa.w"
+/*1505:*/
+#line 19408 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!XSYID_of_G_Exists(xsy_id))){
 MARPA_ERROR(MARPA_ERR_NO_SUCH_SYMBOL_ID);
 return-1;
 }
-/*:1317*/
-#line 1689 "./marpa.w"
+/*:1505*/
+#line 1797 "./marpa.w"
 
 xsy= XSY_by_ID(xsy_id);
 switch(value){
@@ -4583,23 +4974,22 @@ return XSY_is_Nulled_Event(xsy)= Boolean(value);
 MARPA_ERROR(MARPA_ERR_INVALID_BOOLEAN);
 return failure_indicator;
 }
-/*:194*//*195:*/
-#line 1699 "./marpa.w"
+/*:204*//*205:*/
+#line 1807 "./marpa.w"
 
 int
 marpa_g_nulled_symbol_activate(Marpa_Grammar g,
 Marpa_Symbol_ID xsy_id,
 int reactivate)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 1813 "./marpa.w"
 
-/*:1313*/
-#line 1705 "./marpa.w"
-
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -4610,39 +5000,39 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 1706 "./marpa.w"
+/*:1521*/
+#line 1814 "./marpa.w"
 
-/*1314:*/
-#line 15634 "./marpa.w"
+/*1502:*/
+#line 19390 "./marpa.w"
 
 if(_MARPA_UNLIKELY(G_is_Precomputed(g))){
 MARPA_ERROR(MARPA_ERR_PRECOMPUTED);
 return failure_indicator;
 }
 
-/*:1314*/
-#line 1707 "./marpa.w"
+/*:1502*/
+#line 1815 "./marpa.w"
 
-/*1316:*/
-#line 15645 "./marpa.w"
+/*1504:*/
+#line 19401 "./marpa.w"
 
 if(_MARPA_UNLIKELY(XSYID_is_Malformed(xsy_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_SYMBOL_ID);
 return failure_indicator;
 }
-/*:1316*/
-#line 1708 "./marpa.w"
+/*:1504*/
+#line 1816 "./marpa.w"
 
-/*1317:*/
-#line 15652 "./marpa.w"
+/*1505:*/
+#line 19408 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!XSYID_of_G_Exists(xsy_id))){
 MARPA_ERROR(MARPA_ERR_NO_SUCH_SYMBOL_ID);
 return-1;
 }
-/*:1317*/
-#line 1709 "./marpa.w"
+/*:1505*/
+#line 1817 "./marpa.w"
 
 switch(reactivate){
 case 0:
@@ -4663,21 +5053,20 @@ MARPA_ERROR(MARPA_ERR_INVALID_BOOLEAN);
 return failure_indicator;
 }
 
-/*:195*//*198:*/
-#line 1740 "./marpa.w"
+/*:205*//*208:*/
+#line 1848 "./marpa.w"
 
 int marpa_g_symbol_is_prediction_event(Marpa_Grammar g,
 Marpa_Symbol_ID xsy_id)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 1852 "./marpa.w"
 
-/*:1313*/
-#line 1744 "./marpa.w"
-
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -4688,47 +5077,46 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 1745 "./marpa.w"
+/*:1521*/
+#line 1853 "./marpa.w"
 
-/*1316:*/
-#line 15645 "./marpa.w"
+/*1504:*/
+#line 19401 "./marpa.w"
 
 if(_MARPA_UNLIKELY(XSYID_is_Malformed(xsy_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_SYMBOL_ID);
 return failure_indicator;
 }
-/*:1316*/
-#line 1746 "./marpa.w"
+/*:1504*/
+#line 1854 "./marpa.w"
 
-/*1317:*/
-#line 15652 "./marpa.w"
+/*1505:*/
+#line 19408 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!XSYID_of_G_Exists(xsy_id))){
 MARPA_ERROR(MARPA_ERR_NO_SUCH_SYMBOL_ID);
 return-1;
 }
-/*:1317*/
-#line 1747 "./marpa.w"
+/*:1505*/
+#line 1855 "./marpa.w"
 
 return XSYID_is_Prediction_Event(xsy_id);
 }
-/*:198*//*199:*/
-#line 1750 "./marpa.w"
+/*:208*//*209:*/
+#line 1858 "./marpa.w"
 
 int marpa_g_symbol_is_prediction_event_set(
 Marpa_Grammar g,Marpa_Symbol_ID xsy_id,int value)
 {
 XSY xsy;
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 1863 "./marpa.w"
 
-/*:1313*/
-#line 1755 "./marpa.w"
-
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -4739,39 +5127,39 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 1756 "./marpa.w"
+/*:1521*/
+#line 1864 "./marpa.w"
 
-/*1314:*/
-#line 15634 "./marpa.w"
+/*1502:*/
+#line 19390 "./marpa.w"
 
 if(_MARPA_UNLIKELY(G_is_Precomputed(g))){
 MARPA_ERROR(MARPA_ERR_PRECOMPUTED);
 return failure_indicator;
 }
 
-/*:1314*/
-#line 1757 "./marpa.w"
+/*:1502*/
+#line 1865 "./marpa.w"
 
-/*1316:*/
-#line 15645 "./marpa.w"
+/*1504:*/
+#line 19401 "./marpa.w"
 
 if(_MARPA_UNLIKELY(XSYID_is_Malformed(xsy_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_SYMBOL_ID);
 return failure_indicator;
 }
-/*:1316*/
-#line 1758 "./marpa.w"
+/*:1504*/
+#line 1866 "./marpa.w"
 
-/*1317:*/
-#line 15652 "./marpa.w"
+/*1505:*/
+#line 19408 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!XSYID_of_G_Exists(xsy_id))){
 MARPA_ERROR(MARPA_ERR_NO_SUCH_SYMBOL_ID);
 return-1;
 }
-/*:1317*/
-#line 1759 "./marpa.w"
+/*:1505*/
+#line 1867 "./marpa.w"
 
 xsy= XSY_by_ID(xsy_id);
 switch(value){
@@ -4782,23 +5170,22 @@ return XSY_is_Prediction_Event(xsy)= Boolean(value);
 MARPA_ERROR(MARPA_ERR_INVALID_BOOLEAN);
 return failure_indicator;
 }
-/*:199*//*200:*/
-#line 1769 "./marpa.w"
+/*:209*//*210:*/
+#line 1877 "./marpa.w"
 
 int
 marpa_g_prediction_symbol_activate(Marpa_Grammar g,
 Marpa_Symbol_ID xsy_id,
 int reactivate)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 1883 "./marpa.w"
 
-/*:1313*/
-#line 1775 "./marpa.w"
-
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -4809,39 +5196,39 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 1776 "./marpa.w"
+/*:1521*/
+#line 1884 "./marpa.w"
 
-/*1314:*/
-#line 15634 "./marpa.w"
+/*1502:*/
+#line 19390 "./marpa.w"
 
 if(_MARPA_UNLIKELY(G_is_Precomputed(g))){
 MARPA_ERROR(MARPA_ERR_PRECOMPUTED);
 return failure_indicator;
 }
 
-/*:1314*/
-#line 1777 "./marpa.w"
+/*:1502*/
+#line 1885 "./marpa.w"
 
-/*1316:*/
-#line 15645 "./marpa.w"
+/*1504:*/
+#line 19401 "./marpa.w"
 
 if(_MARPA_UNLIKELY(XSYID_is_Malformed(xsy_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_SYMBOL_ID);
 return failure_indicator;
 }
-/*:1316*/
-#line 1778 "./marpa.w"
+/*:1504*/
+#line 1886 "./marpa.w"
 
-/*1317:*/
-#line 15652 "./marpa.w"
+/*1505:*/
+#line 19408 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!XSYID_of_G_Exists(xsy_id))){
 MARPA_ERROR(MARPA_ERR_NO_SUCH_SYMBOL_ID);
 return-1;
 }
-/*:1317*/
-#line 1779 "./marpa.w"
+/*:1505*/
+#line 1887 "./marpa.w"
 
 switch(reactivate){
 case 0:
@@ -4862,11 +5249,11 @@ MARPA_ERROR(MARPA_ERR_INVALID_BOOLEAN);
 return failure_indicator;
 }
 
-/*:200*//*201:*/
-#line 1799 "./marpa.w"
+/*:210*//*211:*/
+#line 1907 "./marpa.w"
 
-/*:201*//*207:*/
-#line 1833 "./marpa.w"
+/*:211*//*217:*/
+#line 1941 "./marpa.w"
 
 Marpa_NSY_ID _marpa_g_xsy_nsy(
 Marpa_Grammar g,
@@ -4874,40 +5261,39 @@ Marpa_Symbol_ID xsy_id)
 {
 XSY xsy;
 NSY nsy;
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 1948 "./marpa.w"
 
-/*:1313*/
-#line 1840 "./marpa.w"
-
-/*1316:*/
-#line 15645 "./marpa.w"
+/*1504:*/
+#line 19401 "./marpa.w"
 
 if(_MARPA_UNLIKELY(XSYID_is_Malformed(xsy_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_SYMBOL_ID);
 return failure_indicator;
 }
-/*:1316*/
-#line 1841 "./marpa.w"
+/*:1504*/
+#line 1949 "./marpa.w"
 
-/*1317:*/
-#line 15652 "./marpa.w"
+/*1505:*/
+#line 19408 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!XSYID_of_G_Exists(xsy_id))){
 MARPA_ERROR(MARPA_ERR_NO_SUCH_SYMBOL_ID);
 return-1;
 }
-/*:1317*/
-#line 1842 "./marpa.w"
+/*:1505*/
+#line 1950 "./marpa.w"
 
 xsy= XSY_by_ID(xsy_id);
 nsy= NSY_of_XSY(xsy);
 return nsy?ID_of_NSY(nsy):-1;
 }
 
-/*:207*//*211:*/
-#line 1865 "./marpa.w"
+/*:217*//*221:*/
+#line 1973 "./marpa.w"
 
 Marpa_NSY_ID _marpa_g_xsy_nulling_nsy(
 Marpa_Grammar g,
@@ -4915,40 +5301,39 @@ Marpa_Symbol_ID xsy_id)
 {
 XSY xsy;
 NSY nsy;
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 1980 "./marpa.w"
 
-/*:1313*/
-#line 1872 "./marpa.w"
-
-/*1316:*/
-#line 15645 "./marpa.w"
+/*1504:*/
+#line 19401 "./marpa.w"
 
 if(_MARPA_UNLIKELY(XSYID_is_Malformed(xsy_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_SYMBOL_ID);
 return failure_indicator;
 }
-/*:1316*/
-#line 1873 "./marpa.w"
+/*:1504*/
+#line 1981 "./marpa.w"
 
-/*1317:*/
-#line 15652 "./marpa.w"
+/*1505:*/
+#line 19408 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!XSYID_of_G_Exists(xsy_id))){
 MARPA_ERROR(MARPA_ERR_NO_SUCH_SYMBOL_ID);
 return-1;
 }
-/*:1317*/
-#line 1874 "./marpa.w"
+/*:1505*/
+#line 1982 "./marpa.w"
 
 xsy= XSY_by_ID(xsy_id);
 nsy= Nulling_NSY_of_XSY(xsy);
 return nsy?ID_of_NSY(nsy):-1;
 }
 
-/*:211*//*213:*/
-#line 1886 "./marpa.w"
+/*:221*//*223:*/
+#line 1994 "./marpa.w"
 
 PRIVATE
 NSY symbol_alias_create(GRAMMAR g,XSY symbol)
@@ -4960,8 +5345,8 @@ NSY_is_Nulling(alias_nsy)= 1;
 return alias_nsy;
 }
 
-/*:213*//*220:*/
-#line 1944 "./marpa.w"
+/*:223*//*230:*/
+#line 2052 "./marpa.w"
 
 PRIVATE NSY
 nsy_start(GRAMMAR g)
@@ -4969,51 +5354,55 @@ nsy_start(GRAMMAR g)
 const NSY nsy= marpa_obs_new(g->t_obs,struct s_nsy,1);
 ID_of_NSY(nsy)= MARPA_DSTACK_LENGTH((g)->t_nsy_stack);
 *MARPA_DSTACK_PUSH((g)->t_nsy_stack,NSY)= nsy;
-/*218:*/
-#line 1936 "./marpa.w"
+/*228:*/
+#line 2044 "./marpa.w"
 
 nsy->t_nulling_or_node.t_or_node_type= NULLING_TOKEN_OR_NODE;
 
 nsy->t_unvalued_or_node.t_or_node_type= UNVALUED_TOKEN_OR_NODE;
 nsy->t_unvalued_or_node.t_nsyid= ID_of_NSY(nsy);
 
-/*:218*//*228:*/
-#line 2012 "./marpa.w"
+/*:228*//*238:*/
+#line 2120 "./marpa.w"
 NSY_is_Start(nsy)= 0;
-/*:228*//*231:*/
-#line 2026 "./marpa.w"
+/*:238*//*241:*/
+#line 2134 "./marpa.w"
 NSY_is_LHS(nsy)= 0;
-/*:231*//*234:*/
-#line 2040 "./marpa.w"
+/*:241*//*244:*/
+#line 2148 "./marpa.w"
 NSY_is_Nulling(nsy)= 0;
-/*:234*//*237:*/
-#line 2057 "./marpa.w"
+/*:244*//*247:*/
+#line 2165 "./marpa.w"
 LHS_CIL_of_NSY(nsy)= NULL;
 
-/*:237*//*239:*/
-#line 2065 "./marpa.w"
+/*:247*//*249:*/
+#line 2175 "./marpa.w"
+Lookahead_CIL_of_NSY(nsy)= NULL;
+
+/*:249*//*251:*/
+#line 2183 "./marpa.w"
 NSY_is_Semantic(nsy)= 0;
-/*:239*//*242:*/
-#line 2088 "./marpa.w"
+/*:251*//*254:*/
+#line 2206 "./marpa.w"
 Source_XSY_of_NSY(nsy)= NULL;
-/*:242*//*246:*/
-#line 2113 "./marpa.w"
+/*:254*//*258:*/
+#line 2231 "./marpa.w"
 
 LHS_XRL_of_NSY(nsy)= NULL;
 XRL_Offset_of_NSY(nsy)= -1;
 
-/*:246*//*251:*/
-#line 2164 "./marpa.w"
+/*:258*//*263:*/
+#line 2282 "./marpa.w"
 
 Rank_of_NSY(nsy)= Default_Rank_of_G(g)*EXTERNAL_RANK_FACTOR+MAXIMUM_CHAF_RANK;
-/*:251*/
-#line 1951 "./marpa.w"
+/*:263*/
+#line 2059 "./marpa.w"
 
 return nsy;
 }
 
-/*:220*//*221:*/
-#line 1957 "./marpa.w"
+/*:230*//*231:*/
+#line 2065 "./marpa.w"
 
 PRIVATE NSY
 nsy_new(GRAMMAR g,XSY source)
@@ -5024,8 +5413,8 @@ Rank_of_NSY(new_nsy)= NSY_Rank_by_XSY(source);
 return new_nsy;
 }
 
-/*:221*//*222:*/
-#line 1969 "./marpa.w"
+/*:231*//*232:*/
+#line 2077 "./marpa.w"
 
 PRIVATE NSY
 semantic_nsy_new(GRAMMAR g,XSY source)
@@ -5035,8 +5424,8 @@ NSY_is_Semantic(new_nsy)= 1;
 return new_nsy;
 }
 
-/*:222*//*223:*/
-#line 1980 "./marpa.w"
+/*:232*//*233:*/
+#line 2088 "./marpa.w"
 
 PRIVATE NSY
 nsy_clone(GRAMMAR g,XSY xsy)
@@ -5049,19 +5438,18 @@ NSY_is_Nulling(new_nsy)= XSY_is_Nulling(xsy);
 return new_nsy;
 }
 
-/*:223*//*226:*/
-#line 2002 "./marpa.w"
+/*:233*//*236:*/
+#line 2110 "./marpa.w"
 
 int _marpa_g_nsy_count(Marpa_Grammar g){
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 2112 "./marpa.w"
 
-/*:1313*/
-#line 2004 "./marpa.w"
-
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -5072,26 +5460,25 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 2005 "./marpa.w"
+/*:1521*/
+#line 2113 "./marpa.w"
 
 return NSY_Count_of_G(g);
 }
 
-/*:226*//*229:*/
-#line 2013 "./marpa.w"
+/*:236*//*239:*/
+#line 2121 "./marpa.w"
 
 int _marpa_g_nsy_is_start(Marpa_Grammar g,Marpa_NSY_ID nsy_id)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 2124 "./marpa.w"
 
-/*:1313*/
-#line 2016 "./marpa.w"
-
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -5102,46 +5489,45 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 2017 "./marpa.w"
+/*:1521*/
+#line 2125 "./marpa.w"
 
-/*1315:*/
-#line 15640 "./marpa.w"
+/*1503:*/
+#line 19396 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!G_is_Precomputed(g))){
 MARPA_ERROR(MARPA_ERR_NOT_PRECOMPUTED);
 return failure_indicator;
 }
-/*:1315*/
-#line 2018 "./marpa.w"
+/*:1503*/
+#line 2126 "./marpa.w"
 
-/*1319:*/
-#line 15663 "./marpa.w"
+/*1507:*/
+#line 19419 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!nsy_is_valid(g,nsy_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_NSYID);
 return failure_indicator;
 }
-/*:1319*/
-#line 2019 "./marpa.w"
+/*:1507*/
+#line 2127 "./marpa.w"
 
 return NSY_is_Start(NSY_by_ID(nsy_id));
 }
 
-/*:229*//*232:*/
-#line 2027 "./marpa.w"
+/*:239*//*242:*/
+#line 2135 "./marpa.w"
 
 int _marpa_g_nsy_is_lhs(Marpa_Grammar g,Marpa_NSY_ID nsy_id)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 2138 "./marpa.w"
 
-/*:1313*/
-#line 2030 "./marpa.w"
-
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -5152,46 +5538,45 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 2031 "./marpa.w"
+/*:1521*/
+#line 2139 "./marpa.w"
 
-/*1315:*/
-#line 15640 "./marpa.w"
+/*1503:*/
+#line 19396 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!G_is_Precomputed(g))){
 MARPA_ERROR(MARPA_ERR_NOT_PRECOMPUTED);
 return failure_indicator;
 }
-/*:1315*/
-#line 2032 "./marpa.w"
+/*:1503*/
+#line 2140 "./marpa.w"
 
-/*1319:*/
-#line 15663 "./marpa.w"
+/*1507:*/
+#line 19419 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!nsy_is_valid(g,nsy_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_NSYID);
 return failure_indicator;
 }
-/*:1319*/
-#line 2033 "./marpa.w"
+/*:1507*/
+#line 2141 "./marpa.w"
 
 return NSY_is_LHS(NSY_by_ID(nsy_id));
 }
 
-/*:232*//*235:*/
-#line 2041 "./marpa.w"
+/*:242*//*245:*/
+#line 2149 "./marpa.w"
 
 int _marpa_g_nsy_is_nulling(Marpa_Grammar g,Marpa_NSY_ID nsy_id)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 2152 "./marpa.w"
 
-/*:1313*/
-#line 2044 "./marpa.w"
-
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -5202,109 +5587,106 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 2045 "./marpa.w"
+/*:1521*/
+#line 2153 "./marpa.w"
 
-/*1315:*/
-#line 15640 "./marpa.w"
+/*1503:*/
+#line 19396 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!G_is_Precomputed(g))){
 MARPA_ERROR(MARPA_ERR_NOT_PRECOMPUTED);
 return failure_indicator;
 }
-/*:1315*/
-#line 2046 "./marpa.w"
+/*:1503*/
+#line 2154 "./marpa.w"
 
-/*1319:*/
-#line 15663 "./marpa.w"
+/*1507:*/
+#line 19419 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!nsy_is_valid(g,nsy_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_NSYID);
 return failure_indicator;
 }
-/*:1319*/
-#line 2047 "./marpa.w"
+/*:1507*/
+#line 2155 "./marpa.w"
 
 return NSY_is_Nulling(NSY_by_ID(nsy_id));
 }
 
-/*:235*//*240:*/
-#line 2066 "./marpa.w"
+/*:245*//*252:*/
+#line 2184 "./marpa.w"
 
 int _marpa_g_nsy_is_semantic(
 Marpa_Grammar g,
 Marpa_IRL_ID nsy_id)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 2189 "./marpa.w"
 
-/*:1313*/
-#line 2071 "./marpa.w"
-
-/*1319:*/
-#line 15663 "./marpa.w"
+/*1507:*/
+#line 19419 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!nsy_is_valid(g,nsy_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_NSYID);
 return failure_indicator;
 }
-/*:1319*/
-#line 2072 "./marpa.w"
+/*:1507*/
+#line 2190 "./marpa.w"
 
 return NSYID_is_Semantic(nsy_id);
 }
 
-/*:240*//*243:*/
-#line 2089 "./marpa.w"
+/*:252*//*255:*/
+#line 2207 "./marpa.w"
 
 Marpa_Rule_ID _marpa_g_source_xsy(
 Marpa_Grammar g,
 Marpa_IRL_ID nsy_id)
 {
 XSY source_xsy;
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 2213 "./marpa.w"
 
-/*:1313*/
-#line 2095 "./marpa.w"
-
-/*1319:*/
-#line 15663 "./marpa.w"
+/*1507:*/
+#line 19419 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!nsy_is_valid(g,nsy_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_NSYID);
 return failure_indicator;
 }
-/*:1319*/
-#line 2096 "./marpa.w"
+/*:1507*/
+#line 2214 "./marpa.w"
 
 source_xsy= Source_XSY_of_NSYID(nsy_id);
 return ID_of_XSY(source_xsy);
 }
 
-/*:243*//*248:*/
-#line 2124 "./marpa.w"
+/*:255*//*260:*/
+#line 2242 "./marpa.w"
 
 Marpa_Rule_ID _marpa_g_nsy_lhs_xrl(Marpa_Grammar g,Marpa_NSY_ID nsy_id)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 2245 "./marpa.w"
 
-/*:1313*/
-#line 2127 "./marpa.w"
-
-/*1319:*/
-#line 15663 "./marpa.w"
+/*1507:*/
+#line 19419 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!nsy_is_valid(g,nsy_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_NSYID);
 return failure_indicator;
 }
-/*:1319*/
-#line 2128 "./marpa.w"
+/*:1507*/
+#line 2246 "./marpa.w"
 
 {
 const NSY nsy= NSY_by_ID(nsy_id);
@@ -5315,62 +5697,60 @@ return ID_of_XRL(lhs_xrl);
 return-1;
 }
 
-/*:248*//*249:*/
-#line 2148 "./marpa.w"
+/*:260*//*261:*/
+#line 2266 "./marpa.w"
 
 int _marpa_g_nsy_xrl_offset(Marpa_Grammar g,Marpa_NSY_ID nsy_id)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
-
-/*:1313*/
-#line 2151 "./marpa.w"
+/*:1500*/
+#line 2269 "./marpa.w"
 
 NSY nsy;
-/*1319:*/
-#line 15663 "./marpa.w"
+/*1507:*/
+#line 19419 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!nsy_is_valid(g,nsy_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_NSYID);
 return failure_indicator;
 }
-/*:1319*/
-#line 2153 "./marpa.w"
+/*:1507*/
+#line 2271 "./marpa.w"
 
 nsy= NSY_by_ID(nsy_id);
 return XRL_Offset_of_NSY(nsy);
 }
 
-/*:249*//*252:*/
-#line 2166 "./marpa.w"
+/*:261*//*264:*/
+#line 2284 "./marpa.w"
 
 Marpa_Rank _marpa_g_nsy_rank(
 Marpa_Grammar g,
 Marpa_NSY_ID nsy_id)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 2289 "./marpa.w"
 
-/*:1313*/
-#line 2171 "./marpa.w"
-
-/*1319:*/
-#line 15663 "./marpa.w"
+/*1507:*/
+#line 19419 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!nsy_is_valid(g,nsy_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_NSYID);
 return failure_indicator;
 }
-/*:1319*/
-#line 2172 "./marpa.w"
+/*:1507*/
+#line 2290 "./marpa.w"
 
 return Rank_of_NSY(NSY_by_ID(nsy_id));
 }
 
-/*:252*//*258:*/
-#line 2207 "./marpa.w"
+/*:264*//*270:*/
+#line 2325 "./marpa.w"
 
 PRIVATE
 XRL xrl_start(GRAMMAR g,const XSYID lhs,const XSYID*rhs,int length)
@@ -5395,66 +5775,66 @@ return xrl;
 PRIVATE
 XRL xrl_finish(GRAMMAR g,XRL rule)
 {
-/*277:*/
-#line 2553 "./marpa.w"
+/*289:*/
+#line 2671 "./marpa.w"
 
 rule->t_rank= Default_Rank_of_G(g);
-/*:277*//*281:*/
-#line 2602 "./marpa.w"
+/*:289*//*293:*/
+#line 2720 "./marpa.w"
 
 rule->t_null_ranks_high= 0;
-/*:281*//*285:*/
-#line 2642 "./marpa.w"
+/*:293*//*297:*/
+#line 2760 "./marpa.w"
 
 rule->t_is_bnf= 0;
 
-/*:285*//*287:*/
-#line 2648 "./marpa.w"
+/*:297*//*299:*/
+#line 2766 "./marpa.w"
 
 rule->t_is_sequence= 0;
 
-/*:287*//*289:*/
-#line 2662 "./marpa.w"
+/*:299*//*301:*/
+#line 2780 "./marpa.w"
 
 rule->t_minimum= -1;
-/*:289*//*292:*/
-#line 2688 "./marpa.w"
+/*:301*//*304:*/
+#line 2806 "./marpa.w"
 
 Separator_of_XRL(rule)= -1;
-/*:292*//*297:*/
-#line 2725 "./marpa.w"
+/*:304*//*309:*/
+#line 2843 "./marpa.w"
 
 rule->t_is_discard= 0;
-/*:297*//*301:*/
-#line 2765 "./marpa.w"
+/*:309*//*313:*/
+#line 2883 "./marpa.w"
 
 rule->t_is_proper_separation= 0;
-/*:301*//*305:*/
-#line 2786 "./marpa.w"
+/*:313*//*317:*/
+#line 2904 "./marpa.w"
 
 rule->t_is_loop= 0;
-/*:305*//*308:*/
-#line 2804 "./marpa.w"
+/*:317*//*320:*/
+#line 2922 "./marpa.w"
 
 XRL_is_Nulling(rule)= 0;
-/*:308*//*311:*/
-#line 2823 "./marpa.w"
+/*:320*//*323:*/
+#line 2941 "./marpa.w"
 
 XRL_is_Nullable(rule)= 0;
-/*:311*//*315:*/
-#line 2842 "./marpa.w"
+/*:323*//*327:*/
+#line 2960 "./marpa.w"
 
 XRL_is_Accessible(rule)= 1;
-/*:315*//*318:*/
-#line 2861 "./marpa.w"
+/*:327*//*330:*/
+#line 2979 "./marpa.w"
 
 XRL_is_Productive(rule)= 1;
-/*:318*//*321:*/
-#line 2880 "./marpa.w"
+/*:330*//*333:*/
+#line 2998 "./marpa.w"
 
 XRL_is_Used(rule)= 0;
-/*:321*/
-#line 2231 "./marpa.w"
+/*:333*/
+#line 2349 "./marpa.w"
 
 rule_add(g,rule);
 return rule;
@@ -5470,8 +5850,8 @@ rule= marpa_obs_finish(g->t_xrl_obs);
 return rule;
 }
 
-/*:258*//*259:*/
-#line 2247 "./marpa.w"
+/*:270*//*271:*/
+#line 2365 "./marpa.w"
 
 PRIVATE IRL
 irl_start(GRAMMAR g,int length)
@@ -5485,51 +5865,51 @@ irl= marpa__obs_alloc(g->t_obs,sizeof_irl,ALIGNOF(IRL_Object));
 
 ID_of_IRL(irl)= MARPA_DSTACK_LENGTH((g)->t_irl_stack);
 Length_of_IRL(irl)= length;
-/*342:*/
-#line 3017 "./marpa.w"
+/*354:*/
+#line 3135 "./marpa.w"
 
 IRL_has_Virtual_LHS(irl)= 0;
-/*:342*//*345:*/
-#line 3033 "./marpa.w"
+/*:354*//*357:*/
+#line 3151 "./marpa.w"
 
 IRL_has_Virtual_RHS(irl)= 0;
-/*:345*//*348:*/
-#line 3052 "./marpa.w"
+/*:357*//*360:*/
+#line 3170 "./marpa.w"
 
 IRL_is_Right_Recursive(irl)= 0;
 
-/*:348*//*351:*/
-#line 3063 "./marpa.w"
+/*:360*//*363:*/
+#line 3181 "./marpa.w"
 Real_SYM_Count_of_IRL(irl)= 0;
-/*:351*//*354:*/
-#line 3081 "./marpa.w"
+/*:363*//*366:*/
+#line 3199 "./marpa.w"
 irl->t_virtual_start= -1;
-/*:354*//*357:*/
-#line 3101 "./marpa.w"
+/*:366*//*369:*/
+#line 3219 "./marpa.w"
 irl->t_virtual_end= -1;
-/*:357*//*360:*/
-#line 3123 "./marpa.w"
+/*:369*//*372:*/
+#line 3241 "./marpa.w"
 Source_XRL_of_IRL(irl)= NULL;
-/*:360*//*363:*/
-#line 3150 "./marpa.w"
+/*:372*//*375:*/
+#line 3268 "./marpa.w"
 
 Rank_of_IRL(irl)= Default_Rank_of_G(g)*EXTERNAL_RANK_FACTOR+MAXIMUM_CHAF_RANK;
-/*:363*//*366:*/
-#line 3172 "./marpa.w"
+/*:375*//*378:*/
+#line 3290 "./marpa.w"
 
 First_AHM_of_IRL(irl)= NULL;
 
-/*:366*//*410:*/
-#line 4072 "./marpa.w"
+/*:378*//*429:*/
+#line 4310 "./marpa.w"
 
 IRL_is_CHAF(irl)= 0;
-/*:410*//*474:*/
-#line 4989 "./marpa.w"
+/*:429*//*494:*/
+#line 5229 "./marpa.w"
 
 Last_Proper_SYMI_of_IRL(irl)= -1;
 
-/*:474*/
-#line 2260 "./marpa.w"
+/*:494*/
+#line 2378 "./marpa.w"
 
 *MARPA_DSTACK_PUSH((g)->t_irl_stack,IRL)= irl;
 return irl;
@@ -5542,24 +5922,23 @@ const NSY lhs_nsy= LHS_of_IRL(irl);
 NSY_is_LHS(lhs_nsy)= 1;
 }
 
-/*:259*//*261:*/
-#line 2286 "./marpa.w"
+/*:271*//*273:*/
+#line 2404 "./marpa.w"
 
 Marpa_Rule_ID
 marpa_g_rule_new(Marpa_Grammar g,
 Marpa_Symbol_ID lhs_id,Marpa_Symbol_ID*rhs_ids,int length)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
-
-/*:1313*/
-#line 2291 "./marpa.w"
+/*:1500*/
+#line 2409 "./marpa.w"
 
 Marpa_Rule_ID rule_id;
 RULE rule;
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -5570,19 +5949,19 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 2294 "./marpa.w"
+/*:1521*/
+#line 2412 "./marpa.w"
 
-/*1314:*/
-#line 15634 "./marpa.w"
+/*1502:*/
+#line 19390 "./marpa.w"
 
 if(_MARPA_UNLIKELY(G_is_Precomputed(g))){
 MARPA_ERROR(MARPA_ERR_PRECOMPUTED);
 return failure_indicator;
 }
 
-/*:1314*/
-#line 2295 "./marpa.w"
+/*:1502*/
+#line 2413 "./marpa.w"
 
 if(_MARPA_UNLIKELY(length> MAX_RHS_LENGTH))
 {
@@ -5628,8 +6007,8 @@ rule_id= rule->t_id;
 return rule_id;
 }
 
-/*:261*//*262:*/
-#line 2340 "./marpa.w"
+/*:273*//*274:*/
+#line 2458 "./marpa.w"
 
 Marpa_Rule_ID marpa_g_sequence_new(Marpa_Grammar g,
 Marpa_Symbol_ID lhs_id,Marpa_Symbol_ID rhs_id,Marpa_Symbol_ID separator_id,
@@ -5637,15 +6016,14 @@ int min,int flags)
 {
 RULE original_rule;
 RULEID original_rule_id= -2;
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 2465 "./marpa.w"
 
-/*:1313*/
-#line 2347 "./marpa.w"
-
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -5656,22 +6034,22 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 2348 "./marpa.w"
+/*:1521*/
+#line 2466 "./marpa.w"
 
-/*1314:*/
-#line 15634 "./marpa.w"
+/*1502:*/
+#line 19390 "./marpa.w"
 
 if(_MARPA_UNLIKELY(G_is_Precomputed(g))){
 MARPA_ERROR(MARPA_ERR_PRECOMPUTED);
 return failure_indicator;
 }
 
-/*:1314*/
-#line 2349 "./marpa.w"
+/*:1502*/
+#line 2467 "./marpa.w"
 
-/*264:*/
-#line 2380 "./marpa.w"
+/*276:*/
+#line 2498 "./marpa.w"
 
 {
 if(separator_id!=-1)
@@ -5702,11 +6080,11 @@ goto FAILURE;
 }
 }
 
-/*:264*/
-#line 2350 "./marpa.w"
+/*:276*/
+#line 2468 "./marpa.w"
 
-/*263:*/
-#line 2358 "./marpa.w"
+/*275:*/
+#line 2476 "./marpa.w"
 
 {
 original_rule= rule_new(g,lhs_id,&rhs_id,1);
@@ -5729,16 +6107,16 @@ XSY_by_ID(separator_id)->t_is_counted= 1;
 }
 }
 
-/*:263*/
-#line 2351 "./marpa.w"
+/*:275*/
+#line 2469 "./marpa.w"
 
 return original_rule_id;
 FAILURE:
 return failure_indicator;
 }
 
-/*:262*//*266:*/
-#line 2433 "./marpa.w"
+/*:274*//*278:*/
+#line 2551 "./marpa.w"
 
 PRIVATE_NOT_INLINE int
 duplicate_rule_cmp(const void*ap,const void*bp,void*param UNUSED)
@@ -5768,25 +6146,24 @@ return diff;
 return 0;
 }
 
-/*:266*//*269:*/
-#line 2489 "./marpa.w"
+/*:278*//*281:*/
+#line 2607 "./marpa.w"
 
 PRIVATE Marpa_Symbol_ID rule_lhs_get(RULE rule)
 {
 return rule->t_symbols[0];}
-/*:269*//*270:*/
-#line 2493 "./marpa.w"
+/*:281*//*282:*/
+#line 2611 "./marpa.w"
 
 Marpa_Symbol_ID marpa_g_rule_lhs(Marpa_Grammar g,Marpa_Rule_ID xrl_id){
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 2613 "./marpa.w"
 
-/*:1313*/
-#line 2495 "./marpa.w"
-
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -5797,53 +6174,52 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 2496 "./marpa.w"
+/*:1521*/
+#line 2614 "./marpa.w"
 
-/*1325:*/
-#line 15701 "./marpa.w"
+/*1513:*/
+#line 19457 "./marpa.w"
 
 if(_MARPA_UNLIKELY(XRLID_is_Malformed(xrl_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_RULE_ID);
 return failure_indicator;
 }
 
-/*:1325*/
-#line 2497 "./marpa.w"
+/*:1513*/
+#line 2615 "./marpa.w"
 
-/*1323:*/
-#line 15689 "./marpa.w"
+/*1511:*/
+#line 19445 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!XRLID_of_G_Exists(xrl_id))){
 MARPA_ERROR(MARPA_ERR_NO_SUCH_RULE_ID);
 return-1;
 }
 
-/*:1323*/
-#line 2498 "./marpa.w"
+/*:1511*/
+#line 2616 "./marpa.w"
 
 return rule_lhs_get(XRL_by_ID(xrl_id));
 }
-/*:270*//*271:*/
-#line 2501 "./marpa.w"
+/*:282*//*283:*/
+#line 2619 "./marpa.w"
 
 PRIVATE Marpa_Symbol_ID*rule_rhs_get(RULE rule)
 {
 return rule->t_symbols+1;}
-/*:271*//*272:*/
-#line 2505 "./marpa.w"
+/*:283*//*284:*/
+#line 2623 "./marpa.w"
 
 Marpa_Symbol_ID marpa_g_rule_rhs(Marpa_Grammar g,Marpa_Rule_ID xrl_id,int ix){
 RULE rule;
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 2626 "./marpa.w"
 
-/*:1313*/
-#line 2508 "./marpa.w"
-
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -5854,30 +6230,30 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 2509 "./marpa.w"
+/*:1521*/
+#line 2627 "./marpa.w"
 
-/*1325:*/
-#line 15701 "./marpa.w"
+/*1513:*/
+#line 19457 "./marpa.w"
 
 if(_MARPA_UNLIKELY(XRLID_is_Malformed(xrl_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_RULE_ID);
 return failure_indicator;
 }
 
-/*:1325*/
-#line 2510 "./marpa.w"
+/*:1513*/
+#line 2628 "./marpa.w"
 
-/*1323:*/
-#line 15689 "./marpa.w"
+/*1511:*/
+#line 19445 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!XRLID_of_G_Exists(xrl_id))){
 MARPA_ERROR(MARPA_ERR_NO_SUCH_RULE_ID);
 return-1;
 }
 
-/*:1323*/
-#line 2511 "./marpa.w"
+/*:1511*/
+#line 2629 "./marpa.w"
 
 rule= XRL_by_ID(xrl_id);
 if(ix<0){
@@ -5891,19 +6267,18 @@ return failure_indicator;
 return RHS_ID_of_RULE(rule,ix);
 }
 
-/*:272*//*273:*/
-#line 2524 "./marpa.w"
+/*:284*//*285:*/
+#line 2642 "./marpa.w"
 
 int marpa_g_rule_length(Marpa_Grammar g,Marpa_Rule_ID xrl_id){
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 2644 "./marpa.w"
 
-/*:1313*/
-#line 2526 "./marpa.w"
-
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -5914,51 +6289,50 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 2527 "./marpa.w"
+/*:1521*/
+#line 2645 "./marpa.w"
 
-/*1325:*/
-#line 15701 "./marpa.w"
+/*1513:*/
+#line 19457 "./marpa.w"
 
 if(_MARPA_UNLIKELY(XRLID_is_Malformed(xrl_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_RULE_ID);
 return failure_indicator;
 }
 
-/*:1325*/
-#line 2528 "./marpa.w"
+/*:1513*/
+#line 2646 "./marpa.w"
 
-/*1323:*/
-#line 15689 "./marpa.w"
+/*1511:*/
+#line 19445 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!XRLID_of_G_Exists(xrl_id))){
 MARPA_ERROR(MARPA_ERR_NO_SUCH_RULE_ID);
 return-1;
 }
 
-/*:1323*/
-#line 2529 "./marpa.w"
+/*:1511*/
+#line 2647 "./marpa.w"
 
 return Length_of_XRL(XRL_by_ID(xrl_id));
 }
 
-/*:273*//*278:*/
-#line 2556 "./marpa.w"
+/*:285*//*290:*/
+#line 2674 "./marpa.w"
 
 int marpa_g_rule_rank(Marpa_Grammar g,
 Marpa_Rule_ID xrl_id)
 {
 XRL xrl;
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
-
-/*:1313*/
-#line 2561 "./marpa.w"
+/*:1500*/
+#line 2679 "./marpa.w"
 
 clear_error(g);
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -5969,51 +6343,50 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 2563 "./marpa.w"
+/*:1521*/
+#line 2681 "./marpa.w"
 
-/*1325:*/
-#line 15701 "./marpa.w"
+/*1513:*/
+#line 19457 "./marpa.w"
 
 if(_MARPA_UNLIKELY(XRLID_is_Malformed(xrl_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_RULE_ID);
 return failure_indicator;
 }
 
-/*:1325*/
-#line 2564 "./marpa.w"
+/*:1513*/
+#line 2682 "./marpa.w"
 
-/*1324:*/
-#line 15695 "./marpa.w"
+/*1512:*/
+#line 19451 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!XRLID_of_G_Exists(xrl_id))){
 MARPA_ERROR(MARPA_ERR_NO_SUCH_RULE_ID);
 return failure_indicator;
 }
-/*:1324*/
-#line 2565 "./marpa.w"
+/*:1512*/
+#line 2683 "./marpa.w"
 
 clear_error(g);
 xrl= XRL_by_ID(xrl_id);
 return Rank_of_XRL(xrl);
 }
-/*:278*//*279:*/
-#line 2570 "./marpa.w"
+/*:290*//*291:*/
+#line 2688 "./marpa.w"
 
 int marpa_g_rule_rank_set(
 Marpa_Grammar g,Marpa_Rule_ID xrl_id,Marpa_Rank rank)
 {
 XRL xrl;
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
-
-/*:1313*/
-#line 2575 "./marpa.w"
+/*:1500*/
+#line 2693 "./marpa.w"
 
 clear_error(g);
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -6024,40 +6397,40 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 2577 "./marpa.w"
+/*:1521*/
+#line 2695 "./marpa.w"
 
-/*1314:*/
-#line 15634 "./marpa.w"
+/*1502:*/
+#line 19390 "./marpa.w"
 
 if(_MARPA_UNLIKELY(G_is_Precomputed(g))){
 MARPA_ERROR(MARPA_ERR_PRECOMPUTED);
 return failure_indicator;
 }
 
-/*:1314*/
-#line 2578 "./marpa.w"
+/*:1502*/
+#line 2696 "./marpa.w"
 
-/*1325:*/
-#line 15701 "./marpa.w"
+/*1513:*/
+#line 19457 "./marpa.w"
 
 if(_MARPA_UNLIKELY(XRLID_is_Malformed(xrl_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_RULE_ID);
 return failure_indicator;
 }
 
-/*:1325*/
-#line 2579 "./marpa.w"
+/*:1513*/
+#line 2697 "./marpa.w"
 
-/*1324:*/
-#line 15695 "./marpa.w"
+/*1512:*/
+#line 19451 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!XRLID_of_G_Exists(xrl_id))){
 MARPA_ERROR(MARPA_ERR_NO_SUCH_RULE_ID);
 return failure_indicator;
 }
-/*:1324*/
-#line 2580 "./marpa.w"
+/*:1512*/
+#line 2698 "./marpa.w"
 
 xrl= XRL_by_ID(xrl_id);
 if(_MARPA_UNLIKELY(rank<MINIMUM_RANK))
@@ -6073,22 +6446,21 @@ return failure_indicator;
 return Rank_of_XRL(xrl)= rank;
 }
 
-/*:279*//*282:*/
-#line 2606 "./marpa.w"
+/*:291*//*294:*/
+#line 2724 "./marpa.w"
 
 int marpa_g_rule_null_high(Marpa_Grammar g,
 Marpa_Rule_ID xrl_id)
 {
 XRL xrl;
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 2729 "./marpa.w"
 
-/*:1313*/
-#line 2611 "./marpa.w"
-
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -6099,50 +6471,49 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 2612 "./marpa.w"
+/*:1521*/
+#line 2730 "./marpa.w"
 
-/*1325:*/
-#line 15701 "./marpa.w"
+/*1513:*/
+#line 19457 "./marpa.w"
 
 if(_MARPA_UNLIKELY(XRLID_is_Malformed(xrl_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_RULE_ID);
 return failure_indicator;
 }
 
-/*:1325*/
-#line 2613 "./marpa.w"
+/*:1513*/
+#line 2731 "./marpa.w"
 
-/*1323:*/
-#line 15689 "./marpa.w"
+/*1511:*/
+#line 19445 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!XRLID_of_G_Exists(xrl_id))){
 MARPA_ERROR(MARPA_ERR_NO_SUCH_RULE_ID);
 return-1;
 }
 
-/*:1323*/
-#line 2614 "./marpa.w"
+/*:1511*/
+#line 2732 "./marpa.w"
 
 xrl= XRL_by_ID(xrl_id);
 return Null_Ranks_High_of_RULE(xrl);
 }
-/*:282*//*283:*/
-#line 2618 "./marpa.w"
+/*:294*//*295:*/
+#line 2736 "./marpa.w"
 
 int marpa_g_rule_null_high_set(
 Marpa_Grammar g,Marpa_Rule_ID xrl_id,int flag)
 {
 XRL xrl;
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 2741 "./marpa.w"
 
-/*:1313*/
-#line 2623 "./marpa.w"
-
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -6153,41 +6524,41 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 2624 "./marpa.w"
+/*:1521*/
+#line 2742 "./marpa.w"
 
-/*1314:*/
-#line 15634 "./marpa.w"
+/*1502:*/
+#line 19390 "./marpa.w"
 
 if(_MARPA_UNLIKELY(G_is_Precomputed(g))){
 MARPA_ERROR(MARPA_ERR_PRECOMPUTED);
 return failure_indicator;
 }
 
-/*:1314*/
-#line 2625 "./marpa.w"
+/*:1502*/
+#line 2743 "./marpa.w"
 
-/*1325:*/
-#line 15701 "./marpa.w"
+/*1513:*/
+#line 19457 "./marpa.w"
 
 if(_MARPA_UNLIKELY(XRLID_is_Malformed(xrl_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_RULE_ID);
 return failure_indicator;
 }
 
-/*:1325*/
-#line 2626 "./marpa.w"
+/*:1513*/
+#line 2744 "./marpa.w"
 
-/*1323:*/
-#line 15689 "./marpa.w"
+/*1511:*/
+#line 19445 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!XRLID_of_G_Exists(xrl_id))){
 MARPA_ERROR(MARPA_ERR_NO_SUCH_RULE_ID);
 return-1;
 }
 
-/*:1323*/
-#line 2627 "./marpa.w"
+/*:1511*/
+#line 2745 "./marpa.w"
 
 xrl= XRL_by_ID(xrl_id);
 if(_MARPA_UNLIKELY(flag<0||flag> 1))
@@ -6198,23 +6569,22 @@ return failure_indicator;
 return Null_Ranks_High_of_RULE(xrl)= Boolean(flag);
 }
 
-/*:283*//*290:*/
-#line 2664 "./marpa.w"
+/*:295*//*302:*/
+#line 2782 "./marpa.w"
 
 int marpa_g_sequence_min(
 Marpa_Grammar g,
 Marpa_Rule_ID xrl_id)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
-
-/*:1313*/
-#line 2669 "./marpa.w"
+/*:1500*/
+#line 2787 "./marpa.w"
 
 XRL xrl;
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -6225,29 +6595,29 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 2671 "./marpa.w"
+/*:1521*/
+#line 2789 "./marpa.w"
 
-/*1325:*/
-#line 15701 "./marpa.w"
+/*1513:*/
+#line 19457 "./marpa.w"
 
 if(_MARPA_UNLIKELY(XRLID_is_Malformed(xrl_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_RULE_ID);
 return failure_indicator;
 }
 
-/*:1325*/
-#line 2672 "./marpa.w"
+/*:1513*/
+#line 2790 "./marpa.w"
 
-/*1324:*/
-#line 15695 "./marpa.w"
+/*1512:*/
+#line 19451 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!XRLID_of_G_Exists(xrl_id))){
 MARPA_ERROR(MARPA_ERR_NO_SUCH_RULE_ID);
 return failure_indicator;
 }
-/*:1324*/
-#line 2673 "./marpa.w"
+/*:1512*/
+#line 2791 "./marpa.w"
 
 xrl= XRL_by_ID(xrl_id);
 if(!XRL_is_Sequence(xrl))
@@ -6258,23 +6628,22 @@ return-1;
 return Minimum_of_XRL(xrl);
 }
 
-/*:290*//*293:*/
-#line 2690 "./marpa.w"
+/*:302*//*305:*/
+#line 2808 "./marpa.w"
 
 Marpa_Symbol_ID marpa_g_sequence_separator(
 Marpa_Grammar g,
 Marpa_Rule_ID xrl_id)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
-
-/*:1313*/
-#line 2695 "./marpa.w"
+/*:1500*/
+#line 2813 "./marpa.w"
 
 XRL xrl;
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -6285,29 +6654,29 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 2697 "./marpa.w"
+/*:1521*/
+#line 2815 "./marpa.w"
 
-/*1325:*/
-#line 15701 "./marpa.w"
+/*1513:*/
+#line 19457 "./marpa.w"
 
 if(_MARPA_UNLIKELY(XRLID_is_Malformed(xrl_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_RULE_ID);
 return failure_indicator;
 }
 
-/*:1325*/
-#line 2698 "./marpa.w"
+/*:1513*/
+#line 2816 "./marpa.w"
 
-/*1324:*/
-#line 15695 "./marpa.w"
+/*1512:*/
+#line 19451 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!XRLID_of_G_Exists(xrl_id))){
 MARPA_ERROR(MARPA_ERR_NO_SUCH_RULE_ID);
 return failure_indicator;
 }
-/*:1324*/
-#line 2699 "./marpa.w"
+/*:1512*/
+#line 2817 "./marpa.w"
 
 xrl= XRL_by_ID(xrl_id);
 if(!XRL_is_Sequence(xrl))
@@ -6318,22 +6687,21 @@ return failure_indicator;
 return Separator_of_XRL(xrl);
 }
 
-/*:293*//*298:*/
-#line 2727 "./marpa.w"
+/*:305*//*310:*/
+#line 2845 "./marpa.w"
 
 int _marpa_g_rule_is_keep_separation(
 Marpa_Grammar g,
 Marpa_Rule_ID xrl_id)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 2850 "./marpa.w"
 
-/*:1313*/
-#line 2732 "./marpa.w"
-
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -6344,50 +6712,49 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 2733 "./marpa.w"
+/*:1521*/
+#line 2851 "./marpa.w"
 
-/*1325:*/
-#line 15701 "./marpa.w"
+/*1513:*/
+#line 19457 "./marpa.w"
 
 if(_MARPA_UNLIKELY(XRLID_is_Malformed(xrl_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_RULE_ID);
 return failure_indicator;
 }
 
-/*:1325*/
-#line 2734 "./marpa.w"
+/*:1513*/
+#line 2852 "./marpa.w"
 
-/*1323:*/
-#line 15689 "./marpa.w"
+/*1511:*/
+#line 19445 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!XRLID_of_G_Exists(xrl_id))){
 MARPA_ERROR(MARPA_ERR_NO_SUCH_RULE_ID);
 return-1;
 }
 
-/*:1323*/
-#line 2735 "./marpa.w"
+/*:1511*/
+#line 2853 "./marpa.w"
 
 return!XRL_by_ID(xrl_id)->t_is_discard;
 }
 
-/*:298*//*302:*/
-#line 2767 "./marpa.w"
+/*:310*//*314:*/
+#line 2885 "./marpa.w"
 
 int marpa_g_rule_is_proper_separation(
 Marpa_Grammar g,
 Marpa_Rule_ID xrl_id)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 2890 "./marpa.w"
 
-/*:1313*/
-#line 2772 "./marpa.w"
-
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -6398,48 +6765,47 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 2773 "./marpa.w"
+/*:1521*/
+#line 2891 "./marpa.w"
 
-/*1325:*/
-#line 15701 "./marpa.w"
+/*1513:*/
+#line 19457 "./marpa.w"
 
 if(_MARPA_UNLIKELY(XRLID_is_Malformed(xrl_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_RULE_ID);
 return failure_indicator;
 }
 
-/*:1325*/
-#line 2774 "./marpa.w"
+/*:1513*/
+#line 2892 "./marpa.w"
 
-/*1323:*/
-#line 15689 "./marpa.w"
+/*1511:*/
+#line 19445 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!XRLID_of_G_Exists(xrl_id))){
 MARPA_ERROR(MARPA_ERR_NO_SUCH_RULE_ID);
 return-1;
 }
 
-/*:1323*/
-#line 2775 "./marpa.w"
+/*:1511*/
+#line 2893 "./marpa.w"
 
 return XRL_is_Proper_Separation(XRL_by_ID(xrl_id));
 }
 
-/*:302*//*306:*/
-#line 2788 "./marpa.w"
+/*:314*//*318:*/
+#line 2906 "./marpa.w"
 
 int marpa_g_rule_is_loop(Marpa_Grammar g,Marpa_Rule_ID xrl_id)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 2909 "./marpa.w"
 
-/*:1313*/
-#line 2791 "./marpa.w"
-
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -6450,69 +6816,68 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 2792 "./marpa.w"
+/*:1521*/
+#line 2910 "./marpa.w"
 
-/*1315:*/
-#line 15640 "./marpa.w"
+/*1503:*/
+#line 19396 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!G_is_Precomputed(g))){
 MARPA_ERROR(MARPA_ERR_NOT_PRECOMPUTED);
 return failure_indicator;
 }
-/*:1315*/
-#line 2793 "./marpa.w"
+/*:1503*/
+#line 2911 "./marpa.w"
 
-/*1325:*/
-#line 15701 "./marpa.w"
+/*1513:*/
+#line 19457 "./marpa.w"
 
 if(_MARPA_UNLIKELY(XRLID_is_Malformed(xrl_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_RULE_ID);
 return failure_indicator;
 }
 
-/*:1325*/
-#line 2794 "./marpa.w"
+/*:1513*/
+#line 2912 "./marpa.w"
 
-/*1323:*/
-#line 15689 "./marpa.w"
+/*1511:*/
+#line 19445 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!XRLID_of_G_Exists(xrl_id))){
 MARPA_ERROR(MARPA_ERR_NO_SUCH_RULE_ID);
 return-1;
 }
 
-/*:1323*/
-#line 2795 "./marpa.w"
+/*:1511*/
+#line 2913 "./marpa.w"
 
-/*1315:*/
-#line 15640 "./marpa.w"
+/*1503:*/
+#line 19396 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!G_is_Precomputed(g))){
 MARPA_ERROR(MARPA_ERR_NOT_PRECOMPUTED);
 return failure_indicator;
 }
-/*:1315*/
-#line 2796 "./marpa.w"
+/*:1503*/
+#line 2914 "./marpa.w"
 
 return XRL_by_ID(xrl_id)->t_is_loop;
 }
 
-/*:306*//*309:*/
-#line 2806 "./marpa.w"
+/*:318*//*321:*/
+#line 2924 "./marpa.w"
 
 int marpa_g_rule_is_nulling(Marpa_Grammar g,Marpa_Rule_ID xrl_id)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
-
-/*:1313*/
-#line 2809 "./marpa.w"
+/*:1500*/
+#line 2927 "./marpa.w"
 
 XRL xrl;
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -6523,60 +6888,59 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 2811 "./marpa.w"
+/*:1521*/
+#line 2929 "./marpa.w"
 
-/*1315:*/
-#line 15640 "./marpa.w"
+/*1503:*/
+#line 19396 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!G_is_Precomputed(g))){
 MARPA_ERROR(MARPA_ERR_NOT_PRECOMPUTED);
 return failure_indicator;
 }
-/*:1315*/
-#line 2812 "./marpa.w"
+/*:1503*/
+#line 2930 "./marpa.w"
 
-/*1325:*/
-#line 15701 "./marpa.w"
+/*1513:*/
+#line 19457 "./marpa.w"
 
 if(_MARPA_UNLIKELY(XRLID_is_Malformed(xrl_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_RULE_ID);
 return failure_indicator;
 }
 
-/*:1325*/
-#line 2813 "./marpa.w"
+/*:1513*/
+#line 2931 "./marpa.w"
 
-/*1323:*/
-#line 15689 "./marpa.w"
+/*1511:*/
+#line 19445 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!XRLID_of_G_Exists(xrl_id))){
 MARPA_ERROR(MARPA_ERR_NO_SUCH_RULE_ID);
 return-1;
 }
 
-/*:1323*/
-#line 2814 "./marpa.w"
+/*:1511*/
+#line 2932 "./marpa.w"
 
 xrl= XRL_by_ID(xrl_id);
 return XRL_is_Nulling(xrl);
 }
 
-/*:309*//*312:*/
-#line 2825 "./marpa.w"
+/*:321*//*324:*/
+#line 2943 "./marpa.w"
 
 int marpa_g_rule_is_nullable(Marpa_Grammar g,Marpa_Rule_ID xrl_id)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
-
-/*:1313*/
-#line 2828 "./marpa.w"
+/*:1500*/
+#line 2946 "./marpa.w"
 
 XRL xrl;
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -6587,60 +6951,59 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 2830 "./marpa.w"
+/*:1521*/
+#line 2948 "./marpa.w"
 
-/*1315:*/
-#line 15640 "./marpa.w"
+/*1503:*/
+#line 19396 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!G_is_Precomputed(g))){
 MARPA_ERROR(MARPA_ERR_NOT_PRECOMPUTED);
 return failure_indicator;
 }
-/*:1315*/
-#line 2831 "./marpa.w"
+/*:1503*/
+#line 2949 "./marpa.w"
 
-/*1325:*/
-#line 15701 "./marpa.w"
+/*1513:*/
+#line 19457 "./marpa.w"
 
 if(_MARPA_UNLIKELY(XRLID_is_Malformed(xrl_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_RULE_ID);
 return failure_indicator;
 }
 
-/*:1325*/
-#line 2832 "./marpa.w"
+/*:1513*/
+#line 2950 "./marpa.w"
 
-/*1323:*/
-#line 15689 "./marpa.w"
+/*1511:*/
+#line 19445 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!XRLID_of_G_Exists(xrl_id))){
 MARPA_ERROR(MARPA_ERR_NO_SUCH_RULE_ID);
 return-1;
 }
 
-/*:1323*/
-#line 2833 "./marpa.w"
+/*:1511*/
+#line 2951 "./marpa.w"
 
 xrl= XRL_by_ID(xrl_id);
 return XRL_is_Nullable(xrl);
 }
 
-/*:312*//*316:*/
-#line 2844 "./marpa.w"
+/*:324*//*328:*/
+#line 2962 "./marpa.w"
 
 int marpa_g_rule_is_accessible(Marpa_Grammar g,Marpa_Rule_ID xrl_id)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
-
-/*:1313*/
-#line 2847 "./marpa.w"
+/*:1500*/
+#line 2965 "./marpa.w"
 
 XRL xrl;
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -6651,60 +7014,59 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 2849 "./marpa.w"
+/*:1521*/
+#line 2967 "./marpa.w"
 
-/*1315:*/
-#line 15640 "./marpa.w"
+/*1503:*/
+#line 19396 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!G_is_Precomputed(g))){
 MARPA_ERROR(MARPA_ERR_NOT_PRECOMPUTED);
 return failure_indicator;
 }
-/*:1315*/
-#line 2850 "./marpa.w"
+/*:1503*/
+#line 2968 "./marpa.w"
 
-/*1325:*/
-#line 15701 "./marpa.w"
+/*1513:*/
+#line 19457 "./marpa.w"
 
 if(_MARPA_UNLIKELY(XRLID_is_Malformed(xrl_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_RULE_ID);
 return failure_indicator;
 }
 
-/*:1325*/
-#line 2851 "./marpa.w"
+/*:1513*/
+#line 2969 "./marpa.w"
 
-/*1323:*/
-#line 15689 "./marpa.w"
+/*1511:*/
+#line 19445 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!XRLID_of_G_Exists(xrl_id))){
 MARPA_ERROR(MARPA_ERR_NO_SUCH_RULE_ID);
 return-1;
 }
 
-/*:1323*/
-#line 2852 "./marpa.w"
+/*:1511*/
+#line 2970 "./marpa.w"
 
 xrl= XRL_by_ID(xrl_id);
 return XRL_is_Accessible(xrl);
 }
 
-/*:316*//*319:*/
-#line 2863 "./marpa.w"
+/*:328*//*331:*/
+#line 2981 "./marpa.w"
 
 int marpa_g_rule_is_productive(Marpa_Grammar g,Marpa_Rule_ID xrl_id)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
-
-/*:1313*/
-#line 2866 "./marpa.w"
+/*:1500*/
+#line 2984 "./marpa.w"
 
 XRL xrl;
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -6715,126 +7077,123 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 2868 "./marpa.w"
+/*:1521*/
+#line 2986 "./marpa.w"
 
-/*1315:*/
-#line 15640 "./marpa.w"
+/*1503:*/
+#line 19396 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!G_is_Precomputed(g))){
 MARPA_ERROR(MARPA_ERR_NOT_PRECOMPUTED);
 return failure_indicator;
 }
-/*:1315*/
-#line 2869 "./marpa.w"
+/*:1503*/
+#line 2987 "./marpa.w"
 
-/*1325:*/
-#line 15701 "./marpa.w"
+/*1513:*/
+#line 19457 "./marpa.w"
 
 if(_MARPA_UNLIKELY(XRLID_is_Malformed(xrl_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_RULE_ID);
 return failure_indicator;
 }
 
-/*:1325*/
-#line 2870 "./marpa.w"
+/*:1513*/
+#line 2988 "./marpa.w"
 
-/*1323:*/
-#line 15689 "./marpa.w"
+/*1511:*/
+#line 19445 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!XRLID_of_G_Exists(xrl_id))){
 MARPA_ERROR(MARPA_ERR_NO_SUCH_RULE_ID);
 return-1;
 }
 
-/*:1323*/
-#line 2871 "./marpa.w"
+/*:1511*/
+#line 2989 "./marpa.w"
 
 xrl= XRL_by_ID(xrl_id);
 return XRL_is_Productive(xrl);
 }
 
-/*:319*//*322:*/
-#line 2882 "./marpa.w"
+/*:331*//*334:*/
+#line 3000 "./marpa.w"
 
 int
 _marpa_g_rule_is_used(Marpa_Grammar g,Marpa_Rule_ID xrl_id)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 3004 "./marpa.w"
 
-/*:1313*/
-#line 2886 "./marpa.w"
-
-/*1325:*/
-#line 15701 "./marpa.w"
+/*1513:*/
+#line 19457 "./marpa.w"
 
 if(_MARPA_UNLIKELY(XRLID_is_Malformed(xrl_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_RULE_ID);
 return failure_indicator;
 }
 
-/*:1325*/
-#line 2887 "./marpa.w"
+/*:1513*/
+#line 3005 "./marpa.w"
 
-/*1323:*/
-#line 15689 "./marpa.w"
+/*1511:*/
+#line 19445 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!XRLID_of_G_Exists(xrl_id))){
 MARPA_ERROR(MARPA_ERR_NO_SUCH_RULE_ID);
 return-1;
 }
 
-/*:1323*/
-#line 2888 "./marpa.w"
+/*:1511*/
+#line 3006 "./marpa.w"
 
 return XRL_is_Used(XRL_by_ID(xrl_id));
 }
 
-/*:322*//*324:*/
-#line 2895 "./marpa.w"
+/*:334*//*336:*/
+#line 3013 "./marpa.w"
 
 Marpa_Rule_ID
 _marpa_g_irl_semantic_equivalent(Marpa_Grammar g,Marpa_IRL_ID irl_id)
 {
 IRL irl;
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 3018 "./marpa.w"
 
-/*:1313*/
-#line 2900 "./marpa.w"
-
-/*1322:*/
-#line 15681 "./marpa.w"
+/*1510:*/
+#line 19437 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!IRLID_of_G_is_Valid(irl_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_IRLID);
 return failure_indicator;
 }
-/*:1322*/
-#line 2901 "./marpa.w"
+/*:1510*/
+#line 3019 "./marpa.w"
 
 irl= IRL_by_ID(irl_id);
 if(IRL_has_Virtual_LHS(irl))return-1;
 return ID_of_XRL(Source_XRL_of_IRL(irl));
 }
 
-/*:324*//*333:*/
-#line 2942 "./marpa.w"
+/*:336*//*345:*/
+#line 3060 "./marpa.w"
 
 Marpa_NSY_ID _marpa_g_irl_lhs(Marpa_Grammar g,Marpa_IRL_ID irl_id){
 IRL irl;
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 3063 "./marpa.w"
 
-/*:1313*/
-#line 2945 "./marpa.w"
-
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -6845,47 +7204,46 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 2946 "./marpa.w"
+/*:1521*/
+#line 3064 "./marpa.w"
 
-/*1315:*/
-#line 15640 "./marpa.w"
+/*1503:*/
+#line 19396 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!G_is_Precomputed(g))){
 MARPA_ERROR(MARPA_ERR_NOT_PRECOMPUTED);
 return failure_indicator;
 }
-/*:1315*/
-#line 2947 "./marpa.w"
+/*:1503*/
+#line 3065 "./marpa.w"
 
-/*1322:*/
-#line 15681 "./marpa.w"
+/*1510:*/
+#line 19437 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!IRLID_of_G_is_Valid(irl_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_IRLID);
 return failure_indicator;
 }
-/*:1322*/
-#line 2948 "./marpa.w"
+/*:1510*/
+#line 3066 "./marpa.w"
 
 irl= IRL_by_ID(irl_id);
 return LHSID_of_IRL(irl);
 }
 
-/*:333*//*335:*/
-#line 2955 "./marpa.w"
+/*:345*//*347:*/
+#line 3073 "./marpa.w"
 
 Marpa_NSY_ID _marpa_g_irl_rhs(Marpa_Grammar g,Marpa_IRL_ID irl_id,int ix){
 IRL irl;
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 3076 "./marpa.w"
 
-/*:1313*/
-#line 2958 "./marpa.w"
-
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -6896,47 +7254,46 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 2959 "./marpa.w"
+/*:1521*/
+#line 3077 "./marpa.w"
 
-/*1315:*/
-#line 15640 "./marpa.w"
+/*1503:*/
+#line 19396 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!G_is_Precomputed(g))){
 MARPA_ERROR(MARPA_ERR_NOT_PRECOMPUTED);
 return failure_indicator;
 }
-/*:1315*/
-#line 2960 "./marpa.w"
+/*:1503*/
+#line 3078 "./marpa.w"
 
-/*1322:*/
-#line 15681 "./marpa.w"
+/*1510:*/
+#line 19437 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!IRLID_of_G_is_Valid(irl_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_IRLID);
 return failure_indicator;
 }
-/*:1322*/
-#line 2961 "./marpa.w"
+/*:1510*/
+#line 3079 "./marpa.w"
 
 irl= IRL_by_ID(irl_id);
 if(Length_of_IRL(irl)<=ix)return-1;
 return RHSID_of_IRL(irl,ix);
 }
 
-/*:335*//*337:*/
-#line 2969 "./marpa.w"
+/*:347*//*349:*/
+#line 3087 "./marpa.w"
 
 int _marpa_g_irl_length(Marpa_Grammar g,Marpa_IRL_ID irl_id){
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 3089 "./marpa.w"
 
-/*:1313*/
-#line 2971 "./marpa.w"
-
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -6947,313 +7304,312 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 2972 "./marpa.w"
+/*:1521*/
+#line 3090 "./marpa.w"
 
-/*1315:*/
-#line 15640 "./marpa.w"
+/*1503:*/
+#line 19396 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!G_is_Precomputed(g))){
 MARPA_ERROR(MARPA_ERR_NOT_PRECOMPUTED);
 return failure_indicator;
 }
-/*:1315*/
-#line 2973 "./marpa.w"
+/*:1503*/
+#line 3091 "./marpa.w"
 
-/*1322:*/
-#line 15681 "./marpa.w"
+/*1510:*/
+#line 19437 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!IRLID_of_G_is_Valid(irl_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_IRLID);
 return failure_indicator;
 }
-/*:1322*/
-#line 2974 "./marpa.w"
+/*:1510*/
+#line 3092 "./marpa.w"
 
 return Length_of_IRL(IRL_by_ID(irl_id));
 }
 
-/*:337*//*343:*/
-#line 3019 "./marpa.w"
+/*:349*//*355:*/
+#line 3137 "./marpa.w"
 
 int _marpa_g_irl_is_virtual_lhs(
 Marpa_Grammar g,
 Marpa_IRL_ID irl_id)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 3142 "./marpa.w"
 
-/*:1313*/
-#line 3024 "./marpa.w"
-
-/*1315:*/
-#line 15640 "./marpa.w"
+/*1503:*/
+#line 19396 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!G_is_Precomputed(g))){
 MARPA_ERROR(MARPA_ERR_NOT_PRECOMPUTED);
 return failure_indicator;
 }
-/*:1315*/
-#line 3025 "./marpa.w"
+/*:1503*/
+#line 3143 "./marpa.w"
 
-/*1322:*/
-#line 15681 "./marpa.w"
+/*1510:*/
+#line 19437 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!IRLID_of_G_is_Valid(irl_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_IRLID);
 return failure_indicator;
 }
-/*:1322*/
-#line 3026 "./marpa.w"
+/*:1510*/
+#line 3144 "./marpa.w"
 
 return IRL_has_Virtual_LHS(IRL_by_ID(irl_id));
 }
 
-/*:343*//*346:*/
-#line 3035 "./marpa.w"
+/*:355*//*358:*/
+#line 3153 "./marpa.w"
 
 int _marpa_g_irl_is_virtual_rhs(
 Marpa_Grammar g,
 Marpa_IRL_ID irl_id)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 3158 "./marpa.w"
 
-/*:1313*/
-#line 3040 "./marpa.w"
-
-/*1315:*/
-#line 15640 "./marpa.w"
+/*1503:*/
+#line 19396 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!G_is_Precomputed(g))){
 MARPA_ERROR(MARPA_ERR_NOT_PRECOMPUTED);
 return failure_indicator;
 }
-/*:1315*/
-#line 3041 "./marpa.w"
+/*:1503*/
+#line 3159 "./marpa.w"
 
-/*1322:*/
-#line 15681 "./marpa.w"
+/*1510:*/
+#line 19437 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!IRLID_of_G_is_Valid(irl_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_IRLID);
 return failure_indicator;
 }
-/*:1322*/
-#line 3042 "./marpa.w"
+/*:1510*/
+#line 3160 "./marpa.w"
 
 return IRL_has_Virtual_RHS(IRL_by_ID(irl_id));
 }
 
-/*:346*//*352:*/
-#line 3064 "./marpa.w"
+/*:358*//*364:*/
+#line 3182 "./marpa.w"
 
 int _marpa_g_real_symbol_count(
 Marpa_Grammar g,
 Marpa_IRL_ID irl_id)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 3187 "./marpa.w"
 
-/*:1313*/
-#line 3069 "./marpa.w"
-
-/*1315:*/
-#line 15640 "./marpa.w"
+/*1503:*/
+#line 19396 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!G_is_Precomputed(g))){
 MARPA_ERROR(MARPA_ERR_NOT_PRECOMPUTED);
 return failure_indicator;
 }
-/*:1315*/
-#line 3070 "./marpa.w"
+/*:1503*/
+#line 3188 "./marpa.w"
 
-/*1322:*/
-#line 15681 "./marpa.w"
+/*1510:*/
+#line 19437 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!IRLID_of_G_is_Valid(irl_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_IRLID);
 return failure_indicator;
 }
-/*:1322*/
-#line 3071 "./marpa.w"
+/*:1510*/
+#line 3189 "./marpa.w"
 
 return Real_SYM_Count_of_IRL(IRL_by_ID(irl_id));
 }
 
-/*:352*//*355:*/
-#line 3082 "./marpa.w"
+/*:364*//*367:*/
+#line 3200 "./marpa.w"
 
 int _marpa_g_virtual_start(
 Marpa_Grammar g,
 Marpa_IRL_ID irl_id)
 {
 IRL irl;
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 3206 "./marpa.w"
 
-/*:1313*/
-#line 3088 "./marpa.w"
-
-/*1315:*/
-#line 15640 "./marpa.w"
+/*1503:*/
+#line 19396 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!G_is_Precomputed(g))){
 MARPA_ERROR(MARPA_ERR_NOT_PRECOMPUTED);
 return failure_indicator;
 }
-/*:1315*/
-#line 3089 "./marpa.w"
+/*:1503*/
+#line 3207 "./marpa.w"
 
-/*1322:*/
-#line 15681 "./marpa.w"
+/*1510:*/
+#line 19437 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!IRLID_of_G_is_Valid(irl_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_IRLID);
 return failure_indicator;
 }
-/*:1322*/
-#line 3090 "./marpa.w"
+/*:1510*/
+#line 3208 "./marpa.w"
 
 irl= IRL_by_ID(irl_id);
 return Virtual_Start_of_IRL(irl);
 }
 
-/*:355*//*358:*/
-#line 3102 "./marpa.w"
+/*:367*//*370:*/
+#line 3220 "./marpa.w"
 
 int _marpa_g_virtual_end(
 Marpa_Grammar g,
 Marpa_IRL_ID irl_id)
 {
 IRL irl;
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 3226 "./marpa.w"
 
-/*:1313*/
-#line 3108 "./marpa.w"
-
-/*1315:*/
-#line 15640 "./marpa.w"
+/*1503:*/
+#line 19396 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!G_is_Precomputed(g))){
 MARPA_ERROR(MARPA_ERR_NOT_PRECOMPUTED);
 return failure_indicator;
 }
-/*:1315*/
-#line 3109 "./marpa.w"
+/*:1503*/
+#line 3227 "./marpa.w"
 
-/*1322:*/
-#line 15681 "./marpa.w"
+/*1510:*/
+#line 19437 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!IRLID_of_G_is_Valid(irl_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_IRLID);
 return failure_indicator;
 }
-/*:1322*/
-#line 3110 "./marpa.w"
+/*:1510*/
+#line 3228 "./marpa.w"
 
 irl= IRL_by_ID(irl_id);
 return Virtual_End_of_IRL(irl);
 }
 
-/*:358*//*361:*/
-#line 3124 "./marpa.w"
+/*:370*//*373:*/
+#line 3242 "./marpa.w"
 
 Marpa_Rule_ID _marpa_g_source_xrl(
 Marpa_Grammar g,
 Marpa_IRL_ID irl_id)
 {
 XRL source_xrl;
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 3248 "./marpa.w"
 
-/*:1313*/
-#line 3130 "./marpa.w"
-
-/*1322:*/
-#line 15681 "./marpa.w"
+/*1510:*/
+#line 19437 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!IRLID_of_G_is_Valid(irl_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_IRLID);
 return failure_indicator;
 }
-/*:1322*/
-#line 3131 "./marpa.w"
+/*:1510*/
+#line 3249 "./marpa.w"
 
 source_xrl= Source_XRL_of_IRL(IRL_by_ID(irl_id));
 return source_xrl?ID_of_XRL(source_xrl):-1;
 }
 
-/*:361*//*364:*/
-#line 3152 "./marpa.w"
+/*:373*//*376:*/
+#line 3270 "./marpa.w"
 
 Marpa_Rank _marpa_g_irl_rank(
 Marpa_Grammar g,
 Marpa_IRL_ID irl_id)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 3275 "./marpa.w"
 
-/*:1313*/
-#line 3157 "./marpa.w"
-
-/*1322:*/
-#line 15681 "./marpa.w"
+/*1510:*/
+#line 19437 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!IRLID_of_G_is_Valid(irl_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_IRLID);
 return failure_indicator;
 }
-/*:1322*/
-#line 3158 "./marpa.w"
+/*:1510*/
+#line 3276 "./marpa.w"
 
 return Rank_of_IRL(IRL_by_ID(irl_id));
 }
 
-/*:364*//*368:*/
-#line 3192 "./marpa.w"
+/*:376*//*380:*/
+#line 3310 "./marpa.w"
 
 int marpa_g_precompute(Marpa_Grammar g)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
-
-/*:1313*/
-#line 3195 "./marpa.w"
+/*:1500*/
+#line 3313 "./marpa.w"
 
 int return_value= failure_indicator;
-struct marpa_obstack*obs_precompute= marpa_obs_init;
-/*373:*/
-#line 3321 "./marpa.w"
+struct marpa_obstack*obs_precompute= marpa_obs_init(Allocator_of_G(g));
+/*387:*/
+#line 3453 "./marpa.w"
+
+clock_t precompute_start= clock();
+clock_t phase_start= precompute_start;
+struct marpa_precompute_stats*const stats= &Precompute_Stats_of_G(g);
+
+/*:387*//*392:*/
+#line 3559 "./marpa.w"
 
 XRLID xrl_count= XRL_Count_of_G(g);
 XSYID pre_census_xsy_count= XSY_Count_of_G(g);
 XSYID post_census_xsy_count= -1;
 
-/*:373*//*377:*/
-#line 3355 "./marpa.w"
+/*:392*//*396:*/
+#line 3593 "./marpa.w"
 
 XSYID start_xsy_id= g->t_start_xsy_id;
 
-/*:377*//*390:*/
-#line 3658 "./marpa.w"
+/*:396*//*409:*/
+#line 3896 "./marpa.w"
 
 Bit_Matrix reach_matrix= NULL;
 
-/*:390*/
-#line 3198 "./marpa.w"
+/*:409*/
+#line 3316 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -7264,34 +7620,34 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 3199 "./marpa.w"
+/*:1521*/
+#line 3317 "./marpa.w"
 
 G_EVENTS_CLEAR(g);
-/*374:*/
-#line 3326 "./marpa.w"
+/*393:*/
+#line 3564 "./marpa.w"
 
 if(_MARPA_UNLIKELY(xrl_count<=0)){
 MARPA_ERROR(MARPA_ERR_NO_RULES);
 goto FAILURE;
 }
 
-/*:374*/
-#line 3201 "./marpa.w"
+/*:393*/
+#line 3319 "./marpa.w"
 
-/*1314:*/
-#line 15634 "./marpa.w"
+/*1502:*/
+#line 19390 "./marpa.w"
 
 if(_MARPA_UNLIKELY(G_is_Precomputed(g))){
 MARPA_ERROR(MARPA_ERR_PRECOMPUTED);
 return failure_indicator;
 }
 
-/*:1314*/
-#line 3202 "./marpa.w"
+/*:1502*/
+#line 3320 "./marpa.w"
 
-/*376:*/
-#line 3336 "./marpa.w"
+/*395:*/
+#line 3574 "./marpa.w"
 
 {
 if(_MARPA_UNLIKELY(start_xsy_id<0))
@@ -7311,68 +7667,69 @@ goto FAILURE;
 }
 }
 
-/*:376*/
-#line 3203 "./marpa.w"
+/*:395*/
+#line 3321 "./marpa.w"
 
+*stats= precompute_stats_zero;
 
 
 
 
 MARPA_OFF_DEBUG3("At %s, ahm count is %ld",STRLOC,(long)(g->t_ahm_count));
 
-/*122:*/
-#line 1134 "./marpa.w"
+/*132:*/
+#line 1242 "./marpa.w"
 
 {
 _marpa_avl_destroy((g)->t_xrl_tree);
 (g)->t_xrl_tree= NULL;
 }
-/*:122*/
-#line 3210 "./marpa.w"
+/*:132*/
+#line 3329 "./marpa.w"
 
 
 
 
 {
-/*382:*/
-#line 3537 "./marpa.w"
+/*401:*/
+#line 3775 "./marpa.w"
 
 Bit_Vector terminal_v= NULL;
 
-/*:382*//*383:*/
-#line 3540 "./marpa.w"
+/*:401*//*402:*/
+#line 3778 "./marpa.w"
 
 Bit_Vector lhs_v= NULL;
 Bit_Vector empty_lhs_v= NULL;
 
-/*:383*//*384:*/
-#line 3545 "./marpa.w"
+/*:402*//*403:*/
+#line 3783 "./marpa.w"
 
 RULEID**xrl_list_x_rh_sym= NULL;
 RULEID**xrl_list_x_lh_sym= NULL;
 
-/*:384*//*388:*/
-#line 3604 "./marpa.w"
+/*:403*//*407:*/
+#line 3842 "./marpa.w"
 
 Bit_Vector productive_v= NULL;
 Bit_Vector nullable_v= NULL;
 
-/*:388*/
-#line 3215 "./marpa.w"
+/*:407*/
+#line 3334 "./marpa.w"
 
-/*372:*/
-#line 3306 "./marpa.w"
+/*391:*/
+#line 3542 "./marpa.w"
 
 {
-/*380:*/
-#line 3379 "./marpa.w"
+/*399:*/
+#line 3617 "./marpa.w"
 
 {
 Marpa_Rule_ID rule_id;
 
 
 
-const MARPA_AVL_TREE rhs_avl_tree= _marpa_avl_create(sym_rule_cmp,NULL);
+const MARPA_AVL_TREE rhs_avl_tree= _marpa_avl_create(sym_rule_cmp,NULL,Allocator_of_G(g));
 
 
 struct sym_rule_pair*const p_rh_sym_rule_pair_base= 
@@ -7382,7 +7739,7 @@ struct sym_rule_pair*p_rh_sym_rule_pairs= p_rh_sym_rule_pair_base;
 
 
 
-const MARPA_AVL_TREE lhs_avl_tree= _marpa_avl_create(sym_rule_cmp,NULL);
+const MARPA_AVL_TREE lhs_avl_tree= _marpa_avl_create(sym_rule_cmp,NULL,Allocator_of_G(g));
 struct sym_rule_pair*const p_lh_sym_rule_pair_base= 
 marpa_obs_new(MARPA_AVL_OBSTACK(lhs_avl_tree),struct sym_rule_pair,
 (size_t)xrl_count);
@@ -7490,11 +7847,11 @@ _marpa_avl_destroy(lhs_avl_tree);
 
 }
 
-/*:380*/
-#line 3308 "./marpa.w"
+/*:399*/
+#line 3544 "./marpa.w"
 
-/*381:*/
-#line 3506 "./marpa.w"
+/*400:*/
+#line 3744 "./marpa.w"
 
 {
 XSYID symid;
@@ -7525,11 +7882,12 @@ XSY_is_Terminal(symbol)= 1;
 }
 }
 
-/*:381*/
-#line 3309 "./marpa.w"
+/*:400*/
+#line 3545 "./marpa.w"
 
-/*389:*/
-#line 3626 "./marpa.w"
+phase_clock(&phase_start,&stats->t_census_ns);
+/*408:*/
+#line 3864 "./marpa.w"
 
 {
 XRLID rule_id;
@@ -7559,14 +7917,14 @@ separator_id);
 }
 }
 }
-transitive_closure(reach_matrix);
+transitive_closure(Allocator_of_G(g),reach_matrix);
 }
 
-/*:389*/
-#line 3310 "./marpa.w"
+/*:408*/
+#line 3547 "./marpa.w"
 
-/*385:*/
-#line 3549 "./marpa.w"
+/*404:*/
+#line 3787 "./marpa.w"
 
 {
 int min,max,start;
@@ -7595,11 +7953,11 @@ goto FAILURE;
 }
 }
 
-/*:385*/
-#line 3311 "./marpa.w"
+/*:404*/
+#line 3548 "./marpa.w"
 
-/*386:*/
-#line 3577 "./marpa.w"
+/*405:*/
+#line 3815 "./marpa.w"
 
 {
 productive_v= bv_obs_shadow(obs_precompute,nullable_v);
@@ -7621,22 +7979,23 @@ symbol->t_is_productive= 1;
 }
 }
 
-/*:386*/
-#line 3312 "./marpa.w"
+/*:405*/
+#line 3549 "./marpa.w"
 
-/*387:*/
-#line 3598 "./marpa.w"
+phase_clock(&phase_start,&stats->t_closure_ns);
+/*406:*/
+#line 3836 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!bv_bit_test(productive_v,start_xsy_id)))
 {
 MARPA_ERROR(MARPA_ERR_UNPRODUCTIVE_START);
 goto FAILURE;
 }
-/*:387*/
-#line 3313 "./marpa.w"
+/*:406*/
+#line 3551 "./marpa.w"
 
-/*391:*/
-#line 3663 "./marpa.w"
+/*410:*/
+#line 3901 "./marpa.w"
 
 {
 Bit_Vector accessible_v= 
@@ -7655,14 +8014,14 @@ symbol->t_is_accessible= 1;
 XSY_by_ID(start_xsy_id)->t_is_accessible= 1;
 }
 
-/*:391*/
-#line 3314 "./marpa.w"
+/*:410*/
+#line 3552 "./marpa.w"
 
-/*392:*/
-#line 3683 "./marpa.w"
+/*411:*/
+#line 3921 "./marpa.w"
 
 {
-Bit_Vector reaches_terminal_v= bv_shadow(terminal_v);
+Bit_Vector reaches_terminal_v= bv_shadow(Allocator_of_G(g),terminal_v);
 int nulling_terminal_found= 0;
 int min,max,start;
 for(start= 0;bv_scan(lhs_v,start,&min,&max);start= max+2)
@@ -7686,7 +8045,7 @@ productive_id);
 }
 }
 }
-bv_free(reaches_terminal_v);
+bv_free(Allocator_of_G(g),reaches_terminal_v);
 if(_MARPA_UNLIKELY(nulling_terminal_found))
 {
 MARPA_ERROR(MARPA_ERR_NULLING_TERMINAL);
@@ -7694,11 +8053,11 @@ goto FAILURE;
 }
 }
 
-/*:392*/
-#line 3315 "./marpa.w"
+/*:411*/
+#line 3553 "./marpa.w"
 
-/*393:*/
-#line 3722 "./marpa.w"
+/*412:*/
+#line 3960 "./marpa.w"
 
 {
 XRLID xrl_id;
@@ -7710,8 +8069,8 @@ const XSY lhs= XSY_by_ID(lhs_id);
 XRL_is_Accessible(xrl)= XSY_is_Accessible(lhs);
 if(XRL_is_Sequence(xrl))
 {
-/*395:*/
-#line 3773 "./marpa.w"
+/*414:*/
+#line 4011 "./marpa.w"
 
 {
 const XSYID rhs_id= RHS_ID_of_XRL(xrl,0);
@@ -7768,13 +8127,13 @@ XRL_is_Used(xrl)= 0;
 if(XRL_is_Nulling(xrl))XRL_is_Used(xrl)= 0;
 }
 
-/*:395*/
-#line 3733 "./marpa.w"
+/*:414*/
+#line 3971 "./marpa.w"
 
 continue;
 }
-/*394:*/
-#line 3742 "./marpa.w"
+/*413:*/
+#line 3980 "./marpa.w"
 
 {
 int rh_ix;
@@ -7799,17 +8158,17 @@ XRL_is_Used(xrl)= XRL_is_Accessible(xrl)&&XRL_is_Productive(xrl)
 &&!XRL_is_Nulling(xrl);
 }
 
-/*:394*/
-#line 3736 "./marpa.w"
+/*:413*/
+#line 3974 "./marpa.w"
 
 }
 }
 
-/*:393*/
-#line 3316 "./marpa.w"
+/*:412*/
+#line 3554 "./marpa.w"
 
-/*396:*/
-#line 3838 "./marpa.w"
+/*415:*/
+#line 4076 "./marpa.w"
 
 if(0)
 {
@@ -7831,11 +8190,11 @@ XSY_is_Valued_Locked(xsy)= 1;
 }
 }
 
-/*:396*/
-#line 3317 "./marpa.w"
+/*:415*/
+#line 3555 "./marpa.w"
 
-/*397:*/
-#line 3867 "./marpa.w"
+/*416:*/
+#line 4105 "./marpa.w"
 
 {
 XSYID xsyid;
@@ -7847,7 +8206,7 @@ int nullable_xsy_count= 0;
 
 
 
-void*matrix_buffer= my_malloc(matrix_sizeof(
+void*matrix_buffer= marpa__a_malloc(Allocator_of_G(g),matrix_sizeof(
 pre_census_xsy_count,
 pre_census_xsy_count));
 Bit_Matrix nullification_matrix= 
@@ -7877,7 +8236,7 @@ rhs_id);
 }
 }
 }
-transitive_closure(nullification_matrix);
+transitive_closure(Allocator_of_G(g),nullification_matrix);
 for(xsyid= 0;xsyid<pre_census_xsy_count;xsyid++)
 {
 Bit_Vector bv_nullifications_by_to_xsy= 
@@ -7885,27 +8244,28 @@ matrix_row(nullification_matrix,xsyid);
 Nulled_XSYIDs_of_XSYID(xsyid)= 
 cil_bv_add(&g->t_cilar,bv_nullifications_by_to_xsy);
 }
-my_free(matrix_buffer);
+marpa__a_free(Allocator_of_G(g),matrix_buffer);
 }
 
-/*:397*/
-#line 3318 "./marpa.w"
+/*:416*/
+#line 3556 "./marpa.w"
 
 }
 
-/*:372*/
-#line 3216 "./marpa.w"
+/*:391*/
+#line 3335 "./marpa.w"
 
-/*448:*/
-#line 4742 "./marpa.w"
+phase_clock(&phase_start,&stats->t_census_ns);
+/*467:*/
+#line 4980 "./marpa.w"
 
 {
 int loop_rule_count= 0;
 Bit_Matrix unit_transition_matrix= 
 matrix_obs_create(obs_precompute,xrl_count,
 xrl_count);
-/*449:*/
-#line 4763 "./marpa.w"
+/*468:*/
+#line 5001 "./marpa.w"
 
 {
 Marpa_Rule_ID rule_id;
@@ -7933,8 +8293,8 @@ if(nonnullable_count==1)
 
 
 
-/*450:*/
-#line 4818 "./marpa.w"
+/*469:*/
+#line 5056 "./marpa.w"
 
 {
 RULEID*p_xrl= xrl_list_x_lh_sym[nonnullable_id];
@@ -7949,8 +8309,8 @@ to_rule_id);
 }
 }
 
-/*:450*/
-#line 4791 "./marpa.w"
+/*:469*/
+#line 5029 "./marpa.w"
 
 }
 else if(nonnullable_count==0)
@@ -7968,8 +8328,8 @@ continue;
 
 
 
-/*450:*/
-#line 4818 "./marpa.w"
+/*469:*/
+#line 5056 "./marpa.w"
 
 {
 RULEID*p_xrl= xrl_list_x_lh_sym[nonnullable_id];
@@ -7984,20 +8344,20 @@ to_rule_id);
 }
 }
 
-/*:450*/
-#line 4809 "./marpa.w"
+/*:469*/
+#line 5047 "./marpa.w"
 
 }
 }
 }
 }
 
-/*:449*/
-#line 4748 "./marpa.w"
+/*:468*/
+#line 4986 "./marpa.w"
 
-transitive_closure(unit_transition_matrix);
-/*451:*/
-#line 4832 "./marpa.w"
+transitive_closure(Allocator_of_G(g),unit_transition_matrix);
+/*470:*/
+#line 5070 "./marpa.w"
 
 {
 XRLID rule_id;
@@ -8014,8 +8374,8 @@ rule->t_is_loop= 1;
 }
 }
 
-/*:451*/
-#line 4750 "./marpa.w"
+/*:470*/
+#line 4988 "./marpa.w"
 
 if(loop_rule_count)
 {
@@ -8024,59 +8384,60 @@ int_event_new(g,MARPA_EVENT_LOOP_RULES,loop_rule_count);
 }
 }
 
-/*:448*/
-#line 3217 "./marpa.w"
+/*:467*/
+#line 3337 "./marpa.w"
 
+phase_clock(&phase_start,&stats->t_loop_ns);
 }
 
 
 
-/*515:*/
-#line 5430 "./marpa.w"
+/*536:*/
+#line 5685 "./marpa.w"
 
-MARPA_DSTACK_INIT(g->t_irl_stack,IRL,2*MARPA_DSTACK_CAPACITY(g->t_xrl_stack));
+MARPA_DSTACK_INIT(g->t_irl_stack,IRL,2*MARPA_DSTACK_CAPACITY(g->t_xrl_stack),Allocator_of_G(g));
 
-/*:515*/
-#line 3222 "./marpa.w"
+/*:536*/
+#line 3343 "./marpa.w"
 
-/*516:*/
-#line 5438 "./marpa.w"
+/*537:*/
+#line 5693 "./marpa.w"
 
 {
-MARPA_DSTACK_INIT(g->t_nsy_stack,NSY,2*MARPA_DSTACK_CAPACITY(g->t_xsy_stack));
+MARPA_DSTACK_INIT(g->t_nsy_stack,NSY,2*MARPA_DSTACK_CAPACITY(g->t_xsy_stack),Allocator_of_G(g));
 }
 
-/*:516*/
-#line 3223 "./marpa.w"
+/*:537*/
+#line 3344 "./marpa.w"
 
-/*413:*/
-#line 4089 "./marpa.w"
+/*432:*/
+#line 4327 "./marpa.w"
 
 {
-/*414:*/
-#line 4120 "./marpa.w"
+/*433:*/
+#line 4358 "./marpa.w"
 
 Marpa_Rule_ID rule_id;
 int pre_chaf_rule_count;
 
-/*:414*//*417:*/
-#line 4178 "./marpa.w"
+/*:433*//*436:*/
+#line 4416 "./marpa.w"
 
 int factor_count;
 int*factor_positions;
-/*:417*/
-#line 4091 "./marpa.w"
+/*:436*/
+#line 4329 "./marpa.w"
 
-/*418:*/
-#line 4181 "./marpa.w"
+/*437:*/
+#line 4419 "./marpa.w"
 
 factor_positions= marpa_obs_new(obs_precompute,int,g->t_max_rule_length);
 
-/*:418*/
-#line 4092 "./marpa.w"
+/*:437*/
+#line 4330 "./marpa.w"
 
-/*415:*/
-#line 4126 "./marpa.w"
+/*434:*/
+#line 4364 "./marpa.w"
 
 {
 XSYID xsy_id;
@@ -8100,8 +8461,8 @@ Nulling_NSY_of_XSY(xsy_to_clone)= symbol_alias_create(g,xsy_to_clone);
 }
 }
 
-/*:415*/
-#line 4093 "./marpa.w"
+/*:434*/
+#line 4331 "./marpa.w"
 
 pre_chaf_rule_count= XRL_Count_of_G(g);
 for(rule_id= 0;rule_id<pre_chaf_rule_count;rule_id++)
@@ -8115,8 +8476,8 @@ if(!XRL_is_Used(rule))
 continue;
 if(XRL_is_Sequence(rule))
 {
-/*398:*/
-#line 3920 "./marpa.w"
+/*417:*/
+#line 4158 "./marpa.w"
 
 {
 const XSYID lhs_id= LHS_ID_of_RULE(rule);
@@ -8138,8 +8499,8 @@ separator_nsyid= ID_of_NSY(separator_nsy);
 }
 
 LHS_XRL_of_NSY(internal_lhs_nsy)= rule;
-/*399:*/
-#line 3949 "./marpa.w"
+/*418:*/
+#line 4187 "./marpa.w"
 
 {
 IRL rewrite_irl= irl_start(g,1);
@@ -8152,12 +8513,12 @@ Rank_of_IRL(rewrite_irl)= IRL_Rank_by_XRL(rule);
 IRL_has_Virtual_RHS(rewrite_irl)= 1;
 }
 
-/*:399*/
-#line 3941 "./marpa.w"
+/*:418*/
+#line 4179 "./marpa.w"
 
 if(separator_nsyid>=0&&!XRL_is_Proper_Separation(rule)){
-/*400:*/
-#line 3962 "./marpa.w"
+/*419:*/
+#line 4200 "./marpa.w"
 
 {
 IRL rewrite_irl;
@@ -8172,12 +8533,12 @@ IRL_has_Virtual_RHS(rewrite_irl)= 1;
 Real_SYM_Count_of_IRL(rewrite_irl)= 1;
 }
 
-/*:400*/
-#line 3943 "./marpa.w"
+/*:419*/
+#line 4181 "./marpa.w"
 
 }
-/*401:*/
-#line 3979 "./marpa.w"
+/*420:*/
+#line 4217 "./marpa.w"
 
 {
 const IRL rewrite_irl= irl_start(g,1);
@@ -8189,11 +8550,11 @@ Rank_of_IRL(rewrite_irl)= IRL_Rank_by_XRL(rule);
 IRL_has_Virtual_LHS(rewrite_irl)= 1;
 Real_SYM_Count_of_IRL(rewrite_irl)= 1;
 }
-/*:401*/
-#line 3945 "./marpa.w"
+/*:420*/
+#line 4183 "./marpa.w"
 
-/*402:*/
-#line 3990 "./marpa.w"
+/*421:*/
+#line 4228 "./marpa.w"
 
 {
 IRL rewrite_irl;
@@ -8213,18 +8574,18 @@ IRL_has_Virtual_RHS(rewrite_irl)= 1;
 Real_SYM_Count_of_IRL(rewrite_irl)= length-1;
 }
 
-/*:402*/
-#line 3946 "./marpa.w"
+/*:421*/
+#line 4184 "./marpa.w"
 
 }
 
-/*:398*/
-#line 4106 "./marpa.w"
+/*:417*/
+#line 4344 "./marpa.w"
 
 continue;
 }
-/*416:*/
-#line 4157 "./marpa.w"
+/*435:*/
+#line 4395 "./marpa.w"
 
 {
 int rhs_ix;
@@ -8246,14 +8607,14 @@ nullable_suffix_ix= rhs_ix+1;
 
 }
 }
-/*:416*/
-#line 4109 "./marpa.w"
+/*:435*/
+#line 4347 "./marpa.w"
 
 
 if(factor_count> 0)
 {
-/*419:*/
-#line 4185 "./marpa.w"
+/*438:*/
+#line 4423 "./marpa.w"
 
 {
 const XRL chaf_xrl= rule;
@@ -8271,8 +8632,8 @@ int piece_end,piece_start= 0;
 for(unprocessed_factor_count= factor_count-factor_position_ix;
 unprocessed_factor_count>=3;
 unprocessed_factor_count= factor_count-factor_position_ix){
-/*422:*/
-#line 4221 "./marpa.w"
+/*441:*/
+#line 4459 "./marpa.w"
 
 NSY chaf_virtual_nsy;
 NSYID chaf_virtual_nsyid;
@@ -8283,8 +8644,8 @@ piece_end= second_factor_position-1;
 
 
 
-/*420:*/
-#line 4211 "./marpa.w"
+/*439:*/
+#line 4449 "./marpa.w"
 
 {
 const XSYID chaf_xrl_lhs_id= LHS_ID_of_XRL(chaf_xrl);
@@ -8292,17 +8653,17 @@ chaf_virtual_nsy= nsy_new(g,XSY_by_ID(chaf_xrl_lhs_id));
 chaf_virtual_nsyid= ID_of_NSY(chaf_virtual_nsy);
 }
 
-/*:420*/
-#line 4231 "./marpa.w"
+/*:439*/
+#line 4469 "./marpa.w"
 
-/*423:*/
-#line 4250 "./marpa.w"
+/*442:*/
+#line 4488 "./marpa.w"
 
 {
 {
 const int real_symbol_count= piece_end-piece_start+1;
-/*428:*/
-#line 4348 "./marpa.w"
+/*447:*/
+#line 4586 "./marpa.w"
 
 {
 int piece_ix;
@@ -8317,8 +8678,8 @@ NSYID_by_XSYID(RHS_ID_of_RULE(rule,piece_start+piece_ix));
 RHSID_of_IRL(chaf_irl,chaf_irl_length-1)= chaf_virtual_nsyid;
 irl_finish(g,chaf_irl);
 Rank_of_IRL(chaf_irl)= IRL_CHAF_Rank_by_XRL(rule,3);
-/*440:*/
-#line 4651 "./marpa.w"
+/*459:*/
+#line 4889 "./marpa.w"
 
 {
 const int is_virtual_lhs= (piece_start> 0);
@@ -8334,17 +8695,17 @@ LHS_XRL_of_NSY(current_lhs_nsy)= chaf_xrl;
 XRL_Offset_of_NSY(current_lhs_nsy)= piece_start;
 }
 
-/*:440*/
-#line 4362 "./marpa.w"
+/*:459*/
+#line 4600 "./marpa.w"
 
 }
 
-/*:428*/
-#line 4254 "./marpa.w"
+/*:447*/
+#line 4492 "./marpa.w"
 ;
 }
-/*424:*/
-#line 4264 "./marpa.w"
+/*443:*/
+#line 4502 "./marpa.w"
 
 {
 int piece_ix;
@@ -8367,8 +8728,8 @@ Nulling_NSYID_by_XSYID(RHS_ID_of_RULE(rule,piece_start+piece_ix));
 }
 irl_finish(g,chaf_irl);
 Rank_of_IRL(chaf_irl)= IRL_CHAF_Rank_by_XRL(rule,2);
-/*440:*/
-#line 4651 "./marpa.w"
+/*459:*/
+#line 4889 "./marpa.w"
 
 {
 const int is_virtual_lhs= (piece_start> 0);
@@ -8384,18 +8745,18 @@ LHS_XRL_of_NSY(current_lhs_nsy)= chaf_xrl;
 XRL_Offset_of_NSY(current_lhs_nsy)= piece_start;
 }
 
-/*:440*/
-#line 4286 "./marpa.w"
+/*:459*/
+#line 4524 "./marpa.w"
 
 }
 
-/*:424*/
-#line 4256 "./marpa.w"
+/*:443*/
+#line 4494 "./marpa.w"
 ;
 {
 const int real_symbol_count= piece_end-piece_start+1;
-/*430:*/
-#line 4394 "./marpa.w"
+/*449:*/
+#line 4632 "./marpa.w"
 
 {
 int piece_ix;
@@ -8420,8 +8781,8 @@ NSYID_by_XSYID(RHS_ID_of_RULE(rule,piece_start+piece_ix));
 RHSID_of_IRL(chaf_irl,chaf_irl_length-1)= chaf_virtual_nsyid;
 irl_finish(g,chaf_irl);
 Rank_of_IRL(chaf_irl)= IRL_CHAF_Rank_by_XRL(rule,1);
-/*440:*/
-#line 4651 "./marpa.w"
+/*459:*/
+#line 4889 "./marpa.w"
 
 {
 const int is_virtual_lhs= (piece_start> 0);
@@ -8437,17 +8798,17 @@ LHS_XRL_of_NSY(current_lhs_nsy)= chaf_xrl;
 XRL_Offset_of_NSY(current_lhs_nsy)= piece_start;
 }
 
-/*:440*/
-#line 4418 "./marpa.w"
+/*:459*/
+#line 4656 "./marpa.w"
 
 }
 
-/*:430*/
-#line 4259 "./marpa.w"
+/*:449*/
+#line 4497 "./marpa.w"
 ;
 }
-/*425:*/
-#line 4294 "./marpa.w"
+/*444:*/
+#line 4532 "./marpa.w"
 
 {
 if(piece_start<nullable_suffix_ix)
@@ -8486,8 +8847,8 @@ Nulling_NSYID_by_XSYID(RHS_ID_of_RULE
 }
 irl_finish(g,chaf_irl);
 Rank_of_IRL(chaf_irl)= IRL_CHAF_Rank_by_XRL(rule,0);
-/*440:*/
-#line 4651 "./marpa.w"
+/*459:*/
+#line 4889 "./marpa.w"
 
 {
 const int is_virtual_lhs= (piece_start> 0);
@@ -8503,25 +8864,25 @@ LHS_XRL_of_NSY(current_lhs_nsy)= chaf_xrl;
 XRL_Offset_of_NSY(current_lhs_nsy)= piece_start;
 }
 
-/*:440*/
-#line 4332 "./marpa.w"
+/*:459*/
+#line 4570 "./marpa.w"
 
 }
 }
 
-/*:425*/
-#line 4261 "./marpa.w"
+/*:444*/
+#line 4499 "./marpa.w"
 ;
 }
 
-/*:423*/
-#line 4232 "./marpa.w"
+/*:442*/
+#line 4470 "./marpa.w"
 
 factor_position_ix++;
 }else{
 piece_end= second_factor_position;
-/*420:*/
-#line 4211 "./marpa.w"
+/*439:*/
+#line 4449 "./marpa.w"
 
 {
 const XSYID chaf_xrl_lhs_id= LHS_ID_of_XRL(chaf_xrl);
@@ -8529,16 +8890,16 @@ chaf_virtual_nsy= nsy_new(g,XSY_by_ID(chaf_xrl_lhs_id));
 chaf_virtual_nsyid= ID_of_NSY(chaf_virtual_nsy);
 }
 
-/*:420*/
-#line 4236 "./marpa.w"
+/*:439*/
+#line 4474 "./marpa.w"
 
-/*427:*/
-#line 4338 "./marpa.w"
+/*446:*/
+#line 4576 "./marpa.w"
 
 {
 const int real_symbol_count= piece_end-piece_start+1;
-/*428:*/
-#line 4348 "./marpa.w"
+/*447:*/
+#line 4586 "./marpa.w"
 
 {
 int piece_ix;
@@ -8553,8 +8914,8 @@ NSYID_by_XSYID(RHS_ID_of_RULE(rule,piece_start+piece_ix));
 RHSID_of_IRL(chaf_irl,chaf_irl_length-1)= chaf_virtual_nsyid;
 irl_finish(g,chaf_irl);
 Rank_of_IRL(chaf_irl)= IRL_CHAF_Rank_by_XRL(rule,3);
-/*440:*/
-#line 4651 "./marpa.w"
+/*459:*/
+#line 4889 "./marpa.w"
 
 {
 const int is_virtual_lhs= (piece_start> 0);
@@ -8570,16 +8931,16 @@ LHS_XRL_of_NSY(current_lhs_nsy)= chaf_xrl;
 XRL_Offset_of_NSY(current_lhs_nsy)= piece_start;
 }
 
-/*:440*/
-#line 4362 "./marpa.w"
+/*:459*/
+#line 4600 "./marpa.w"
 
 }
 
-/*:428*/
-#line 4341 "./marpa.w"
+/*:447*/
+#line 4579 "./marpa.w"
 
-/*429:*/
-#line 4366 "./marpa.w"
+/*448:*/
+#line 4604 "./marpa.w"
 
 {
 int piece_ix;
@@ -8604,8 +8965,8 @@ NSYID_by_XSYID(RHS_ID_of_RULE(rule,piece_start+piece_ix));
 RHSID_of_IRL(chaf_irl,chaf_irl_length-1)= chaf_virtual_nsyid;
 irl_finish(g,chaf_irl);
 Rank_of_IRL(chaf_irl)= IRL_CHAF_Rank_by_XRL(rule,2);
-/*440:*/
-#line 4651 "./marpa.w"
+/*459:*/
+#line 4889 "./marpa.w"
 
 {
 const int is_virtual_lhs= (piece_start> 0);
@@ -8621,16 +8982,16 @@ LHS_XRL_of_NSY(current_lhs_nsy)= chaf_xrl;
 XRL_Offset_of_NSY(current_lhs_nsy)= piece_start;
 }
 
-/*:440*/
-#line 4390 "./marpa.w"
+/*:459*/
+#line 4628 "./marpa.w"
 
 }
 
-/*:429*/
-#line 4342 "./marpa.w"
+/*:448*/
+#line 4580 "./marpa.w"
 
-/*430:*/
-#line 4394 "./marpa.w"
+/*449:*/
+#line 4632 "./marpa.w"
 
 {
 int piece_ix;
@@ -8655,8 +9016,8 @@ NSYID_by_XSYID(RHS_ID_of_RULE(rule,piece_start+piece_ix));
 RHSID_of_IRL(chaf_irl,chaf_irl_length-1)= chaf_virtual_nsyid;
 irl_finish(g,chaf_irl);
 Rank_of_IRL(chaf_irl)= IRL_CHAF_Rank_by_XRL(rule,1);
-/*440:*/
-#line 4651 "./marpa.w"
+/*459:*/
+#line 4889 "./marpa.w"
 
 {
 const int is_virtual_lhs= (piece_start> 0);
@@ -8672,16 +9033,16 @@ LHS_XRL_of_NSY(current_lhs_nsy)= chaf_xrl;
 XRL_Offset_of_NSY(current_lhs_nsy)= piece_start;
 }
 
-/*:440*/
-#line 4418 "./marpa.w"
+/*:459*/
+#line 4656 "./marpa.w"
 
 }
 
-/*:430*/
-#line 4343 "./marpa.w"
+/*:449*/
+#line 4581 "./marpa.w"
 
-/*431:*/
-#line 4422 "./marpa.w"
+/*450:*/
+#line 4660 "./marpa.w"
 
 {
 int piece_ix;
@@ -8716,8 +9077,8 @@ NSYID_by_XSYID(RHS_ID_of_RULE(rule,piece_start+piece_ix));
 RHSID_of_IRL(chaf_irl,chaf_irl_length-1)= chaf_virtual_nsyid;
 irl_finish(g,chaf_irl);
 Rank_of_IRL(chaf_irl)= IRL_CHAF_Rank_by_XRL(rule,0);
-/*440:*/
-#line 4651 "./marpa.w"
+/*459:*/
+#line 4889 "./marpa.w"
 
 {
 const int is_virtual_lhs= (piece_start> 0);
@@ -8733,18 +9094,18 @@ LHS_XRL_of_NSY(current_lhs_nsy)= chaf_xrl;
 XRL_Offset_of_NSY(current_lhs_nsy)= piece_start;
 }
 
-/*:440*/
-#line 4456 "./marpa.w"
+/*:459*/
+#line 4694 "./marpa.w"
 
 }
 
-/*:431*/
-#line 4344 "./marpa.w"
+/*:450*/
+#line 4582 "./marpa.w"
 
 }
 
-/*:427*/
-#line 4237 "./marpa.w"
+/*:446*/
+#line 4475 "./marpa.w"
 
 factor_position_ix+= 2;
 }
@@ -8752,21 +9113,21 @@ current_lhs_nsy= chaf_virtual_nsy;
 current_lhs_nsyid= chaf_virtual_nsyid;
 piece_start= piece_end+1;
 
-/*:422*/
-#line 4202 "./marpa.w"
+/*:441*/
+#line 4440 "./marpa.w"
 
 }
 if(unprocessed_factor_count==2){
-/*432:*/
-#line 4461 "./marpa.w"
+/*451:*/
+#line 4699 "./marpa.w"
 
 {
 const int first_factor_position= factor_positions[factor_position_ix];
 const int second_factor_position= factor_positions[factor_position_ix+1];
 const int real_symbol_count= Length_of_XRL(rule)-piece_start;
 piece_end= Length_of_XRL(rule)-1;
-/*433:*/
-#line 4474 "./marpa.w"
+/*452:*/
+#line 4712 "./marpa.w"
 
 {
 int piece_ix;
@@ -8780,8 +9141,8 @@ NSYID_by_XSYID(RHS_ID_of_RULE(rule,piece_start+piece_ix));
 }
 irl_finish(g,chaf_irl);
 Rank_of_IRL(chaf_irl)= IRL_CHAF_Rank_by_XRL(rule,3);
-/*440:*/
-#line 4651 "./marpa.w"
+/*459:*/
+#line 4889 "./marpa.w"
 
 {
 const int is_virtual_lhs= (piece_start> 0);
@@ -8797,16 +9158,16 @@ LHS_XRL_of_NSY(current_lhs_nsy)= chaf_xrl;
 XRL_Offset_of_NSY(current_lhs_nsy)= piece_start;
 }
 
-/*:440*/
-#line 4487 "./marpa.w"
+/*:459*/
+#line 4725 "./marpa.w"
 
 }
 
-/*:433*/
-#line 4467 "./marpa.w"
+/*:452*/
+#line 4705 "./marpa.w"
 
-/*434:*/
-#line 4491 "./marpa.w"
+/*453:*/
+#line 4729 "./marpa.w"
 
 {
 int piece_ix;
@@ -8830,8 +9191,8 @@ NSYID_by_XSYID(RHS_ID_of_RULE(rule,piece_start+piece_ix));
 }
 irl_finish(g,chaf_irl);
 Rank_of_IRL(chaf_irl)= IRL_CHAF_Rank_by_XRL(rule,2);
-/*440:*/
-#line 4651 "./marpa.w"
+/*459:*/
+#line 4889 "./marpa.w"
 
 {
 const int is_virtual_lhs= (piece_start> 0);
@@ -8847,16 +9208,16 @@ LHS_XRL_of_NSY(current_lhs_nsy)= chaf_xrl;
 XRL_Offset_of_NSY(current_lhs_nsy)= piece_start;
 }
 
-/*:440*/
-#line 4514 "./marpa.w"
+/*:459*/
+#line 4752 "./marpa.w"
 
 }
 
-/*:434*/
-#line 4468 "./marpa.w"
+/*:453*/
+#line 4706 "./marpa.w"
 
-/*435:*/
-#line 4518 "./marpa.w"
+/*454:*/
+#line 4756 "./marpa.w"
 
 {
 int piece_ix;
@@ -8880,8 +9241,8 @@ NSYID_by_XSYID(RHS_ID_of_RULE(rule,piece_start+piece_ix));
 }
 irl_finish(g,chaf_irl);
 Rank_of_IRL(chaf_irl)= IRL_CHAF_Rank_by_XRL(rule,1);
-/*440:*/
-#line 4651 "./marpa.w"
+/*459:*/
+#line 4889 "./marpa.w"
 
 {
 const int is_virtual_lhs= (piece_start> 0);
@@ -8897,16 +9258,16 @@ LHS_XRL_of_NSY(current_lhs_nsy)= chaf_xrl;
 XRL_Offset_of_NSY(current_lhs_nsy)= piece_start;
 }
 
-/*:440*/
-#line 4541 "./marpa.w"
+/*:459*/
+#line 4779 "./marpa.w"
 
 }
 
-/*:435*/
-#line 4469 "./marpa.w"
+/*:454*/
+#line 4707 "./marpa.w"
 
-/*436:*/
-#line 4546 "./marpa.w"
+/*455:*/
+#line 4784 "./marpa.w"
 
 {
 if(piece_start<nullable_suffix_ix){
@@ -8944,8 +9305,8 @@ NSYID_by_XSYID(RHS_ID_of_RULE(rule,piece_start+piece_ix));
 
 irl_finish(g,chaf_irl);
 Rank_of_IRL(chaf_irl)= IRL_CHAF_Rank_by_XRL(rule,0);
-/*440:*/
-#line 4651 "./marpa.w"
+/*459:*/
+#line 4889 "./marpa.w"
 
 {
 const int is_virtual_lhs= (piece_start> 0);
@@ -8961,31 +9322,31 @@ LHS_XRL_of_NSY(current_lhs_nsy)= chaf_xrl;
 XRL_Offset_of_NSY(current_lhs_nsy)= piece_start;
 }
 
-/*:440*/
-#line 4583 "./marpa.w"
+/*:459*/
+#line 4821 "./marpa.w"
 
 }
 }
 
-/*:436*/
-#line 4470 "./marpa.w"
+/*:455*/
+#line 4708 "./marpa.w"
 
 }
 
-/*:432*/
-#line 4205 "./marpa.w"
+/*:451*/
+#line 4443 "./marpa.w"
 
 }else{
-/*437:*/
-#line 4588 "./marpa.w"
+/*456:*/
+#line 4826 "./marpa.w"
 
 {
 int real_symbol_count;
 const int first_factor_position= factor_positions[factor_position_ix];
 piece_end= Length_of_XRL(rule)-1;
 real_symbol_count= piece_end-piece_start+1;
-/*438:*/
-#line 4599 "./marpa.w"
+/*457:*/
+#line 4837 "./marpa.w"
 
 {
 int piece_ix;
@@ -8999,8 +9360,8 @@ NSYID_by_XSYID(RHS_ID_of_RULE(rule,piece_start+piece_ix));
 }
 irl_finish(g,chaf_irl);
 Rank_of_IRL(chaf_irl)= IRL_CHAF_Rank_by_XRL(rule,3);
-/*440:*/
-#line 4651 "./marpa.w"
+/*459:*/
+#line 4889 "./marpa.w"
 
 {
 const int is_virtual_lhs= (piece_start> 0);
@@ -9016,16 +9377,16 @@ LHS_XRL_of_NSY(current_lhs_nsy)= chaf_xrl;
 XRL_Offset_of_NSY(current_lhs_nsy)= piece_start;
 }
 
-/*:440*/
-#line 4612 "./marpa.w"
+/*:459*/
+#line 4850 "./marpa.w"
 
 }
 
-/*:438*/
-#line 4594 "./marpa.w"
+/*:457*/
+#line 4832 "./marpa.w"
 
-/*439:*/
-#line 4617 "./marpa.w"
+/*458:*/
+#line 4855 "./marpa.w"
 
 {
 if(piece_start<nullable_suffix_ix)
@@ -9052,8 +9413,8 @@ NSYID_by_XSYID(RHS_ID_of_RULE
 }
 irl_finish(g,chaf_irl);
 Rank_of_IRL(chaf_irl)= IRL_CHAF_Rank_by_XRL(rule,0);
-/*440:*/
-#line 4651 "./marpa.w"
+/*459:*/
+#line 4889 "./marpa.w"
 
 {
 const int is_virtual_lhs= (piece_start> 0);
@@ -9069,30 +9430,30 @@ LHS_XRL_of_NSY(current_lhs_nsy)= chaf_xrl;
 XRL_Offset_of_NSY(current_lhs_nsy)= piece_start;
 }
 
-/*:440*/
-#line 4643 "./marpa.w"
+/*:459*/
+#line 4881 "./marpa.w"
 
 }
 }
 
-/*:439*/
-#line 4595 "./marpa.w"
+/*:458*/
+#line 4833 "./marpa.w"
 
 }
 
-/*:437*/
-#line 4207 "./marpa.w"
+/*:456*/
+#line 4445 "./marpa.w"
 
 }
 }
 
-/*:419*/
-#line 4113 "./marpa.w"
+/*:438*/
+#line 4351 "./marpa.w"
 
 continue;
 }
-/*260:*/
-#line 2272 "./marpa.w"
+/*272:*/
+#line 2390 "./marpa.w"
 
 {
 int symbol_ix;
@@ -9107,23 +9468,23 @@ NSYID_by_XSYID(rule->t_symbols[symbol_ix]);
 irl_finish(g,new_irl);
 }
 
-/*:260*/
-#line 4116 "./marpa.w"
+/*:272*/
+#line 4354 "./marpa.w"
 
 }
 }
 
-/*:413*/
-#line 3224 "./marpa.w"
+/*:432*/
+#line 3345 "./marpa.w"
 
-/*442:*/
-#line 4669 "./marpa.w"
+/*461:*/
+#line 4907 "./marpa.w"
 
 {
 const XSY start_xsy= XSY_by_ID(start_xsy_id);
 if(_MARPA_LIKELY(!XSY_is_Nulling(start_xsy))){
-/*443:*/
-#line 4677 "./marpa.w"
+/*462:*/
+#line 4915 "./marpa.w"
 {
 IRL new_start_irl;
 
@@ -9140,18 +9501,19 @@ g->t_start_irl= new_start_irl;
 
 }
 
-/*:443*/
-#line 4673 "./marpa.w"
+/*:462*/
+#line 4911 "./marpa.w"
 
 }
 }
 
-/*:442*/
-#line 3225 "./marpa.w"
+/*:461*/
+#line 3346 "./marpa.w"
 
 post_census_xsy_count= XSY_Count_of_G(g);
-/*527:*/
-#line 5627 "./marpa.w"
+phase_clock(&phase_start,&stats->t_rewrite_ns);
+/*549:*/
+#line 5937 "./marpa.w"
 
 {
 int xsyid;
@@ -9196,26 +9558,27 @@ lbv_bit_set(g->t_lbv_xsyid_prediction_event_starts_active,xsyid);
 }
 }
 
-/*:527*/
-#line 3227 "./marpa.w"
+/*:549*/
+#line 3349 "./marpa.w"
 
+phase_clock(&phase_start,&stats->t_event_ns);
 
 
 
 if(!G_is_Trivial(g)){
-/*514:*/
-#line 5421 "./marpa.w"
+/*535:*/
+#line 5676 "./marpa.w"
 
 const RULEID irl_count= IRL_Count_of_G(g);
 const NSYID nsy_count= NSY_Count_of_G(g);
 Bit_Matrix nsy_by_right_nsy_matrix;
 Bit_Matrix prediction_nsy_by_irl_matrix;
 
-/*:514*/
-#line 3233 "./marpa.w"
+/*:535*/
+#line 3356 "./marpa.w"
 
-/*517:*/
-#line 5443 "./marpa.w"
+/*538:*/
+#line 5698 "./marpa.w"
 
 {
 NSYID lhsid;
@@ -9223,7 +9586,7 @@ NSYID lhsid;
 
 
 
-void*matrix_buffer= my_malloc(matrix_sizeof(
+void*matrix_buffer= marpa__a_malloc(Allocator_of_G(g),matrix_sizeof(
 nsy_count,irl_count));
 Bit_Matrix irl_by_lhs_matrix= 
 matrix_buffer_create(matrix_buffer,nsy_count,irl_count);
@@ -9257,15 +9620,15 @@ cil_buffer_push(&g->t_cilar,irlid);
 LHS_CIL_of_NSYID(lhsid)= cil_buffer_add(&g->t_cilar);
 }
 
-my_free(matrix_buffer);
+marpa__a_free(Allocator_of_G(g),matrix_buffer);
 
 }
 
-/*:517*/
-#line 3234 "./marpa.w"
+/*:538*/
+#line 3357 "./marpa.w"
 
-/*488:*/
-#line 5077 "./marpa.w"
+/*509:*/
+#line 5332 "./marpa.w"
 
 {
 IRLID irl_id;
@@ -9275,8 +9638,8 @@ AHM current_item;
 int symbol_instance_of_next_rule= 0;
 for(irl_id= 0;irl_id<irl_count;irl_id++){
 const IRL irl= IRL_by_ID(irl_id);
-/*490:*/
-#line 5130 "./marpa.w"
+/*511:*/
+#line 5385 "./marpa.w"
 
 {
 int rhs_ix;
@@ -9289,16 +9652,16 @@ if(!NSY_is_Nulling(nsy))ahm_count++;
 ahm_count++;
 }
 
-/*:490*/
-#line 5086 "./marpa.w"
+/*:511*/
+#line 5341 "./marpa.w"
 
 }
-current_item= base_item= marpa_new(struct s_ahm,ahm_count);
+current_item= base_item= marpa_a_new(Allocator_of_G(g),struct s_ahm,ahm_count);
 for(irl_id= 0;irl_id<irl_count;irl_id++){
 const IRL irl= IRL_by_ID(irl_id);
 SYMI_of_IRL(irl)= symbol_instance_of_next_rule;
-/*489:*/
-#line 5105 "./marpa.w"
+/*510:*/
+#line 5360 "./marpa.w"
 
 {
 int leading_nulls= 0;
@@ -9310,12 +9673,12 @@ NSYID rh_nsyid= RHSID_of_IRL(irl,rhs_ix);
 if(!NSY_is_Nulling(NSY_by_ID(rh_nsyid)))
 {
 Last_Proper_SYMI_of_IRL(irl)= symbol_instance_of_next_rule+rhs_ix;
-/*491:*/
-#line 5142 "./marpa.w"
+/*512:*/
+#line 5397 "./marpa.w"
 
 {
-/*493:*/
-#line 5165 "./marpa.w"
+/*514:*/
+#line 5420 "./marpa.w"
 
 {
 IRL_of_AHM(current_item)= irl;
@@ -9334,19 +9697,19 @@ AHM_is_Initial(current_item)= 0;
 AHM_was_Predicted(current_item)= 0;
 AHM_is_Initial(current_item)= 0;
 }
-/*508:*/
-#line 5318 "./marpa.w"
+/*529:*/
+#line 5573 "./marpa.w"
 
 Event_AHMIDs_of_AHM(current_item)= NULL;
 Event_Group_Size_of_AHM(current_item)= 0;
 
-/*:508*/
-#line 5183 "./marpa.w"
+/*:529*/
+#line 5438 "./marpa.w"
 
 }
 
-/*:493*/
-#line 5144 "./marpa.w"
+/*:514*/
+#line 5399 "./marpa.w"
 
 AHM_predicts_ZWA(current_item)= 0;
 
@@ -9359,8 +9722,8 @@ SYMI_of_AHM(current_item)
 memoize_xrl_data_for_AHM(current_item,irl);
 }
 
-/*:491*/
-#line 5116 "./marpa.w"
+/*:512*/
+#line 5371 "./marpa.w"
 
 current_item++;
 leading_nulls= 0;
@@ -9370,12 +9733,12 @@ else
 leading_nulls++;
 }
 }
-/*492:*/
-#line 5156 "./marpa.w"
+/*513:*/
+#line 5411 "./marpa.w"
 
 {
-/*493:*/
-#line 5165 "./marpa.w"
+/*514:*/
+#line 5420 "./marpa.w"
 
 {
 IRL_of_AHM(current_item)= irl;
@@ -9394,19 +9757,19 @@ AHM_is_Initial(current_item)= 0;
 AHM_was_Predicted(current_item)= 0;
 AHM_is_Initial(current_item)= 0;
 }
-/*508:*/
-#line 5318 "./marpa.w"
+/*529:*/
+#line 5573 "./marpa.w"
 
 Event_AHMIDs_of_AHM(current_item)= NULL;
 Event_Group_Size_of_AHM(current_item)= 0;
 
-/*:508*/
-#line 5183 "./marpa.w"
+/*:529*/
+#line 5438 "./marpa.w"
 
 }
 
-/*:493*/
-#line 5158 "./marpa.w"
+/*:514*/
+#line 5413 "./marpa.w"
 
 Postdot_NSYID_of_AHM(current_item)= -1;
 Position_of_AHM(current_item)= -1;
@@ -9414,15 +9777,15 @@ SYMI_of_AHM(current_item)= SYMI_of_IRL(irl)+Position_of_AHM(current_item-1);
 memoize_xrl_data_for_AHM(current_item,irl);
 }
 
-/*:492*/
-#line 5125 "./marpa.w"
+/*:513*/
+#line 5380 "./marpa.w"
 
 current_item++;
 AHM_Count_of_IRL(irl)= (int)(current_item-first_ahm_of_irl);
 }
 
-/*:489*/
-#line 5092 "./marpa.w"
+/*:510*/
+#line 5347 "./marpa.w"
 
 {
 symbol_instance_of_next_rule+= Length_of_IRL(irl);
@@ -9432,9 +9795,9 @@ SYMI_Count_of_G(g)= symbol_instance_of_next_rule;
 MARPA_ASSERT(ahm_count==current_item-base_item);
 AHM_Count_of_G(g)= ahm_count;
 MARPA_DEBUG3("At %s, Setting debug count to %ld",STRLOC,(long)ahm_count);
-g->t_ahms= marpa_renew(struct s_ahm,base_item,ahm_count);
-/*496:*/
-#line 5236 "./marpa.w"
+g->t_ahms= marpa_a_renew(Allocator_of_G(g),struct s_ahm,base_item,ahm_count);
+/*517:*/
+#line 5491 "./marpa.w"
 
 {
 AHM items= g->t_ahms;
@@ -9447,21 +9810,22 @@ First_AHM_of_IRL(irl)= item;
 }
 }
 
-/*:496*/
-#line 5102 "./marpa.w"
+/*:517*/
+#line 5357 "./marpa.w"
 
 }
 
-/*:488*/
-#line 3235 "./marpa.w"
+/*:509*/
+#line 3358 "./marpa.w"
 
-/*520:*/
-#line 5496 "./marpa.w"
+phase_clock(&phase_start,&stats->t_ahm_ns);
+/*541:*/
+#line 5751 "./marpa.w"
 {
 Bit_Matrix prediction_nsy_by_nsy_matrix= 
 matrix_obs_create(obs_precompute,nsy_count,nsy_count);
-/*521:*/
-#line 5504 "./marpa.w"
+/*542:*/
+#line 5760 "./marpa.w"
 
 {
 IRLID irl_id;
@@ -9492,15 +9856,15 @@ to_nsyid);
 }
 }
 
-/*:521*/
-#line 5499 "./marpa.w"
+/*:542*/
+#line 5754 "./marpa.w"
 
-transitive_closure(prediction_nsy_by_nsy_matrix);
-/*522:*/
-#line 5541 "./marpa.w"
+transitive_closure(Allocator_of_G(g),prediction_nsy_by_nsy_matrix);
+/*543:*/
+#line 5797 "./marpa.w"
 {
-/*523:*/
-#line 5545 "./marpa.w"
+/*544:*/
+#line 5801 "./marpa.w"
 
 {
 NSYID from_nsyid;
@@ -9537,26 +9901,63 @@ from_nsyid,irlid);
 }
 }
 
-/*:523*/
-#line 5542 "./marpa.w"
+/*:544*/
+#line 5798 "./marpa.w"
+
+}
+
+/*:543*/
+#line 5756 "./marpa.w"
 
+/*545:*/
+#line 5843 "./marpa.w"
+
+{
+NSYID nsyid;
+const Bit_Vector bv_lookahead_ahms= 
+bv_obs_create(obs_precompute,AHM_Count_of_G(g));
+for(nsyid= 0;nsyid<nsy_count;nsyid++)
+{
+IRLID irl_id;
+if(NSY_is_LHS(NSY_by_ID(nsyid)))
+{
+Lookahead_CIL_of_NSYID(nsyid)= cil_empty(&g->t_cilar);
+continue;
+}
+bv_clear(bv_lookahead_ahms);
+for(irl_id= 0;irl_id<irl_count;irl_id++)
+{
+const AHM first_ahm= First_AHM_of_IRLID(irl_id);
+const NSYID postdot_nsyid= Postdot_NSYID_of_AHM(first_ahm);
+if(postdot_nsyid<0)
+continue;
+if(postdot_nsyid==nsyid
+||matrix_bit_test(prediction_nsy_by_nsy_matrix,
+postdot_nsyid,nsyid))
+{
+bv_bit_set(bv_lookahead_ahms,ID_of_AHM(first_ahm));
+}
+}
+Lookahead_CIL_of_NSYID(nsyid)= 
+cil_bv_add(&g->t_cilar,bv_lookahead_ahms);
+}
 }
 
-/*:522*/
-#line 5501 "./marpa.w"
+/*:545*/
+#line 5757 "./marpa.w"
 
 }
 
-/*:520*/
-#line 3236 "./marpa.w"
+/*:541*/
+#line 3360 "./marpa.w"
 
-/*510:*/
-#line 5331 "./marpa.w"
+/*531:*/
+#line 5586 "./marpa.w"
 {
 nsy_by_right_nsy_matrix= 
 matrix_obs_create(obs_precompute,nsy_count,nsy_count);
-/*511:*/
-#line 5342 "./marpa.w"
+/*532:*/
+#line 5597 "./marpa.w"
 
 {
 IRLID irl_id;
@@ -9582,12 +9983,12 @@ break;
 }
 }
 
-/*:511*/
-#line 5334 "./marpa.w"
+/*:532*/
+#line 5589 "./marpa.w"
 
-transitive_closure(nsy_by_right_nsy_matrix);
-/*512:*/
-#line 5367 "./marpa.w"
+transitive_closure(Allocator_of_G(g),nsy_by_right_nsy_matrix);
+/*533:*/
+#line 5622 "./marpa.w"
 
 {
 IRLID irl_id;
@@ -9615,12 +10016,12 @@ break;
 }
 }
 
-/*:512*/
-#line 5336 "./marpa.w"
+/*:533*/
+#line 5591 "./marpa.w"
 
 matrix_clear(nsy_by_right_nsy_matrix);
-/*513:*/
-#line 5394 "./marpa.w"
+/*534:*/
+#line 5649 "./marpa.w"
 
 {
 IRLID irl_id;
@@ -9647,21 +10048,23 @@ break;
 }
 }
 
-/*:513*/
-#line 5338 "./marpa.w"
+/*:534*/
+#line 5593 "./marpa.w"
 
-transitive_closure(nsy_by_right_nsy_matrix);
+transitive_closure(Allocator_of_G(g),nsy_by_right_nsy_matrix);
 }
 
-/*:510*/
-#line 3237 "./marpa.w"
+/*:531*/
+#line 3361 "./marpa.w"
 
-/*525:*/
-#line 5582 "./marpa.w"
+phase_clock(&phase_start,&stats->t_prediction_matrix_ns);
+/*547:*/
+#line 5878 "./marpa.w"
 
 {
 AHMID ahm_id;
 const int ahm_count= AHM_Count_of_G(g);
+const Bit_Vector bv_bundle= bv_obs_create(obs_precompute,ahm_count);
 for(ahm_id= 0;ahm_id<ahm_count;ahm_id++)
 {
 const AHM ahm= AHM_by_ID(ahm_id);
@@ -9670,22 +10073,35 @@ if(postdot_nsyid<0)
 {
 Predicted_IRL_CIL_of_AHM(ahm)= cil_empty(&g->t_cilar);
 LHS_CIL_of_AHM(ahm)= cil_empty(&g->t_cilar);
+Prediction_Bundle_of_AHM(ahm)= cil_empty(&g->t_cilar);
 }
 else
 {
-Predicted_IRL_CIL_of_AHM(ahm)= 
+int cil_ix;
+CIL predicted_irl_cil;
+int predicted_irl_count;
+Predicted_IRL_CIL_of_AHM(ahm)= predicted_irl_cil= 
 cil_bv_add(&g->t_cilar,
 matrix_row(prediction_nsy_by_irl_matrix,postdot_nsyid));
 LHS_CIL_of_AHM(ahm)= LHS_CIL_of_NSYID(postdot_nsyid);
+predicted_irl_count= Count_of_CIL(predicted_irl_cil);
+bv_clear(bv_bundle);
+for(cil_ix= 0;cil_ix<predicted_irl_count;cil_ix++)
+{
+const IRLID irlid= Item_of_CIL(predicted_irl_cil,cil_ix);
+bv_bit_set(bv_bundle,ID_of_AHM(First_AHM_of_IRLID(irlid)));
+}
+Prediction_Bundle_of_AHM(ahm)= 
+cil_bv_add(&g->t_cilar,bv_bundle);
 }
 }
 }
 
-/*:525*/
-#line 3238 "./marpa.w"
+/*:547*/
+#line 3363 "./marpa.w"
 
-/*526:*/
-#line 5606 "./marpa.w"
+/*548:*/
+#line 5916 "./marpa.w"
 
 {
 int xsy_id;
@@ -9706,18 +10122,18 @@ ID_of_NSY(nsy));
 }
 }
 
-/*:526*/
-#line 3239 "./marpa.w"
+/*:548*/
+#line 3364 "./marpa.w"
 
-/*528:*/
-#line 5671 "./marpa.w"
+/*550:*/
+#line 5981 "./marpa.w"
 
 {
 AHMID ahm_id;
 const int ahm_count_of_g= AHM_Count_of_G(g);
-const LBV bv_completion_xsyid= bv_create(post_census_xsy_count);
-const LBV bv_prediction_xsyid= bv_create(post_census_xsy_count);
-const LBV bv_nulled_xsyid= bv_create(post_census_xsy_count);
+const LBV bv_completion_xsyid= bv_create(Allocator_of_G(g),post_census_xsy_count);
+const LBV bv_prediction_xsyid= bv_create(Allocator_of_G(g),post_census_xsy_count);
+const LBV bv_nulled_xsyid= bv_create(Allocator_of_G(g),post_census_xsy_count);
 const CILAR cilar= &g->t_cilar;
 for(ahm_id= 0;ahm_id<ahm_count_of_g;ahm_id++)
 {
@@ -9772,16 +10188,17 @@ Nulled_XSYIDs_of_AHM(ahm)= cil_bv_add(cilar,bv_nulled_xsyid);
 Prediction_XSYIDs_of_AHM(ahm)= 
 cil_bv_add(cilar,bv_prediction_xsyid);
 }
-bv_free(bv_completion_xsyid);
-bv_free(bv_prediction_xsyid);
-bv_free(bv_nulled_xsyid);
+bv_free(Allocator_of_G(g),bv_completion_xsyid);
+bv_free(Allocator_of_G(g),bv_prediction_xsyid);
+bv_free(Allocator_of_G(g),bv_nulled_xsyid);
 }
 
-/*:528*/
-#line 3241 "./marpa.w"
+/*:550*/
+#line 3366 "./marpa.w"
 
-/*529:*/
-#line 5737 "./marpa.w"
+phase_clock(&phase_start,&stats->t_cil_ns);
+/*551:*/
+#line 6047 "./marpa.w"
 
 {
 AHMID ahm_id;
@@ -9798,18 +10215,27 @@ ahm_is_event?cil_singleton(cilar,ahm_id):cil_empty(cilar);
 }
 }
 
-/*:529*/
-#line 3242 "./marpa.w"
+/*:551*/
+#line 3368 "./marpa.w"
 
-/*530:*/
-#line 5753 "./marpa.w"
+/*552:*/
+#line 6069 "./marpa.w"
 
 {
 const int ahm_count_of_g= AHM_Count_of_G(g);
+AHMID*const event_leo_ahm_ids= 
+marpa_obs_new(obs_precompute,AHMID,ahm_count_of_g);
+int event_leo_ahm_count= 0;
 AHMID outer_ahm_id;
 for(outer_ahm_id= 0;outer_ahm_id<ahm_count_of_g;outer_ahm_id++)
 {
-AHMID inner_ahm_id;
+const AHM outer_ahm= AHM_by_ID(outer_ahm_id);
+if(AHM_has_Event(outer_ahm)&&AHM_is_Leo_Completion(outer_ahm))
+event_leo_ahm_ids[event_leo_ahm_count++]= outer_ahm_id;
+}
+for(outer_ahm_id= 0;outer_ahm_id<ahm_count_of_g;outer_ahm_id++)
+{
+int event_leo_ahm_ix;
 const AHM outer_ahm= AHM_by_ID(outer_ahm_id);
 
 
@@ -9824,18 +10250,12 @@ continue;
 
 }
 outer_nsyid= LHSID_of_AHM(outer_ahm);
-for(inner_ahm_id= 0;inner_ahm_id<ahm_count_of_g;
-inner_ahm_id++)
+for(event_leo_ahm_ix= 0;event_leo_ahm_ix<event_leo_ahm_count;
+event_leo_ahm_ix++)
 {
-NSYID inner_nsyid;
-const AHM inner_ahm= AHM_by_ID(inner_ahm_id);
-if(!AHM_has_Event(inner_ahm))
-continue;
-
-if(!AHM_is_Leo_Completion(inner_ahm))
-continue;
-
-inner_nsyid= LHSID_of_AHM(inner_ahm);
+const AHM inner_ahm= 
+AHM_by_ID(event_leo_ahm_ids[event_leo_ahm_ix]);
+const NSYID inner_nsyid= LHSID_of_AHM(inner_ahm);
 if(matrix_bit_test(nsy_by_right_nsy_matrix,
 outer_nsyid,
 inner_nsyid))
@@ -9849,11 +10269,11 @@ Event_Group_Size_of_AHM(outer_ahm)++;
 }
 }
 
-/*:530*/
-#line 3243 "./marpa.w"
+/*:552*/
+#line 3369 "./marpa.w"
 
-/*549:*/
-#line 5958 "./marpa.w"
+/*571:*/
+#line 6277 "./marpa.w"
 
 {
 AHMID ahm_id;
@@ -9895,11 +10315,11 @@ ZWA_CIL_of_AHM(ahm)= cil_buffer_add(&g->t_cilar);
 }
 }
 
-/*:549*/
-#line 3244 "./marpa.w"
+/*:571*/
+#line 3370 "./marpa.w"
 
-/*550:*/
-#line 6003 "./marpa.w"
+/*572:*/
+#line 6322 "./marpa.w"
 
 {
 AHMID ahm_id;
@@ -9928,9 +10348,10 @@ break;
 }
 }
 
-/*:550*/
-#line 3245 "./marpa.w"
+/*:572*/
+#line 3371 "./marpa.w"
 
+phase_clock(&phase_start,&stats->t_event_ns);
 }
 g->t_is_precomputed= 1;
 if(g->t_has_cycle)
@@ -9938,24 +10359,89 @@ if(g->t_has_cycle)
 MARPA_ERROR(MARPA_ERR_GRAMMAR_HAS_CYCLE);
 goto FAILURE;
 }
-/*369:*/
-#line 3267 "./marpa.w"
+/*381:*/
+#line 3396 "./marpa.w"
 
 {cilar_buffer_reinit(&g->t_cilar);}
-/*:369*/
-#line 3253 "./marpa.w"
+/*:381*/
+#line 3380 "./marpa.w"
 
 return_value= 0;
 goto CLEANUP;
 FAILURE:;
 goto CLEANUP;
 CLEANUP:;
+phase_clock(&precompute_start,&stats->t_total_ns);
+stats->t_precompute_obstack_bytes= marpa_obs_allocated(obs_precompute);
 marpa_obs_free(obs_precompute);
 return return_value;
 }
 
-/*:368*//*379:*/
-#line 3366 "./marpa.w"
+/*:380*//*388:*/
+#line 3462 "./marpa.w"
+
+PRIVATE void
+phase_clock(clock_t*p_phase_start,double*p_nanoseconds)
+{
+const clock_t now= clock();
+*p_nanoseconds+= 
+(double)(now-*p_phase_start)*(1.0e9/(double)CLOCKS_PER_SEC);
+*p_phase_start= now;
+}
+
+/*:388*//*389:*/
+#line 3490 "./marpa.w"
+
+int
+marpa_g_precompute_stats(Marpa_Grammar g,Marpa_Precompute_Stats*p_stats)
+{
+/*1500:*/
+#line 19380 "./marpa.w"
+const int failure_indicator= -2;
+/*:1500*/
+#line 3494 "./marpa.w"
+
+/*1521:*/
+#line 19518 "./marpa.w"
+
+if(HEADER_VERSION_MISMATCH){
+MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
+return failure_indicator;
+}
+if(_MARPA_UNLIKELY(!IS_G_OK(g))){
+MARPA_ERROR(g->t_error);
+return failure_indicator;
+}
+
+/*:1521*/
+#line 3495 "./marpa.w"
+
+/*1503:*/
+#line 19396 "./marpa.w"
+
+if(_MARPA_UNLIKELY(!G_is_Precomputed(g))){
+MARPA_ERROR(MARPA_ERR_NOT_PRECOMPUTED);
+return failure_indicator;
+}
+/*:1503*/
+#line 3496 "./marpa.w"
+
+*p_stats= Precompute_Stats_of_G(g);
+p_stats->t_xsy_count= XSY_Count_of_G(g);
+p_stats->t_xrl_count= XRL_Count_of_G(g);
+p_stats->t_nsy_count= NSY_Count_of_G(g);
+p_stats->t_irl_count= IRL_Count_of_G(g);
+p_stats->t_ahm_count= AHM_Count_of_G(g);
+p_stats->t_cil_count= (int)marpa_avl_count(g->t_cilar.t_avl);
+p_stats->t_grammar_obstack_bytes= 
+marpa_obs_allocated(g->t_obs)
++marpa_obs_allocated(g->t_xrl_obs)
++marpa_obs_allocated(g->t_cilar.t_obs);
+return 0;
+}
+
+/*:389*//*398:*/
+#line 3604 "./marpa.w"
 
 PRIVATE_NOT_INLINE int sym_rule_cmp(
 const void*ap,
@@ -9969,45 +10455,44 @@ if(result)return result;
 return pair_a->t_ruleid-pair_b->t_ruleid;
 }
 
-/*:379*//*412:*/
-#line 4078 "./marpa.w"
+/*:398*//*431:*/
+#line 4316 "./marpa.w"
 
 int _marpa_g_irl_is_chaf(
 Marpa_Grammar g,
 Marpa_IRL_ID irl_id)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 4321 "./marpa.w"
 
-/*:1313*/
-#line 4083 "./marpa.w"
-
-/*1315:*/
-#line 15640 "./marpa.w"
+/*1503:*/
+#line 19396 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!G_is_Precomputed(g))){
 MARPA_ERROR(MARPA_ERR_NOT_PRECOMPUTED);
 return failure_indicator;
 }
-/*:1315*/
-#line 4084 "./marpa.w"
+/*:1503*/
+#line 4322 "./marpa.w"
 
-/*1322:*/
-#line 15681 "./marpa.w"
+/*1510:*/
+#line 19437 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!IRLID_of_G_is_Valid(irl_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_IRLID);
 return failure_indicator;
 }
-/*:1322*/
-#line 4085 "./marpa.w"
+/*:1510*/
+#line 4323 "./marpa.w"
 
 return IRL_is_CHAF(IRL_by_ID(irl_id));
 }
 
-/*:412*//*462:*/
-#line 4896 "./marpa.w"
+/*:431*//*481:*/
+#line 5134 "./marpa.w"
 
 PRIVATE int ahm_is_valid(
 GRAMMAR g,AHMID item_id)
@@ -10015,212 +10500,206 @@ GRAMMAR g,AHMID item_id)
 return item_id<(AHMID)AHM_Count_of_G(g)&&item_id>=0;
 }
 
-/*:462*//*479:*/
-#line 5022 "./marpa.w"
+/*:481*//*500:*/
+#line 5277 "./marpa.w"
 
 int _marpa_g_ahm_count(Marpa_Grammar g){
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 5279 "./marpa.w"
 
-/*:1313*/
-#line 5024 "./marpa.w"
-
-/*1315:*/
-#line 15640 "./marpa.w"
+/*1503:*/
+#line 19396 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!G_is_Precomputed(g))){
 MARPA_ERROR(MARPA_ERR_NOT_PRECOMPUTED);
 return failure_indicator;
 }
-/*:1315*/
-#line 5025 "./marpa.w"
+/*:1503*/
+#line 5280 "./marpa.w"
 
 return AHM_Count_of_G(g);
 }
 
-/*:479*//*480:*/
-#line 5029 "./marpa.w"
+/*:500*//*501:*/
+#line 5284 "./marpa.w"
 
 Marpa_IRL_ID _marpa_g_ahm_irl(Marpa_Grammar g,
 Marpa_AHM_ID item_id){
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 5287 "./marpa.w"
 
-/*:1313*/
-#line 5032 "./marpa.w"
-
-/*1315:*/
-#line 15640 "./marpa.w"
+/*1503:*/
+#line 19396 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!G_is_Precomputed(g))){
 MARPA_ERROR(MARPA_ERR_NOT_PRECOMPUTED);
 return failure_indicator;
 }
-/*:1315*/
-#line 5033 "./marpa.w"
+/*:1503*/
+#line 5288 "./marpa.w"
 
-/*1328:*/
-#line 15724 "./marpa.w"
+/*1516:*/
+#line 19480 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!ahm_is_valid(g,item_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_AIMID);
 return failure_indicator;
 }
 
-/*:1328*/
-#line 5034 "./marpa.w"
+/*:1516*/
+#line 5289 "./marpa.w"
 
 return IRLID_of_AHM(AHM_by_ID(item_id));
 }
 
-/*:480*//*482:*/
-#line 5039 "./marpa.w"
+/*:501*//*503:*/
+#line 5294 "./marpa.w"
 
 int _marpa_g_ahm_position(Marpa_Grammar g,
 Marpa_AHM_ID item_id){
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 5297 "./marpa.w"
 
-/*:1313*/
-#line 5042 "./marpa.w"
-
-/*1315:*/
-#line 15640 "./marpa.w"
+/*1503:*/
+#line 19396 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!G_is_Precomputed(g))){
 MARPA_ERROR(MARPA_ERR_NOT_PRECOMPUTED);
 return failure_indicator;
 }
-/*:1315*/
-#line 5043 "./marpa.w"
+/*:1503*/
+#line 5298 "./marpa.w"
 
-/*1328:*/
-#line 15724 "./marpa.w"
+/*1516:*/
+#line 19480 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!ahm_is_valid(g,item_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_AIMID);
 return failure_indicator;
 }
 
-/*:1328*/
-#line 5044 "./marpa.w"
+/*:1516*/
+#line 5299 "./marpa.w"
 
 return Position_of_AHM(AHM_by_ID(item_id));
 }
 
-/*:482*//*483:*/
-#line 5048 "./marpa.w"
+/*:503*//*504:*/
+#line 5303 "./marpa.w"
 
 int _marpa_g_ahm_raw_position(Marpa_Grammar g,
 Marpa_AHM_ID item_id){
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 5306 "./marpa.w"
 
-/*:1313*/
-#line 5051 "./marpa.w"
-
-/*1315:*/
-#line 15640 "./marpa.w"
+/*1503:*/
+#line 19396 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!G_is_Precomputed(g))){
 MARPA_ERROR(MARPA_ERR_NOT_PRECOMPUTED);
 return failure_indicator;
 }
-/*:1315*/
-#line 5052 "./marpa.w"
+/*:1503*/
+#line 5307 "./marpa.w"
 
-/*1328:*/
-#line 15724 "./marpa.w"
+/*1516:*/
+#line 19480 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!ahm_is_valid(g,item_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_AIMID);
 return failure_indicator;
 }
 
-/*:1328*/
-#line 5053 "./marpa.w"
+/*:1516*/
+#line 5308 "./marpa.w"
 
 return Raw_Position_of_AHM(AHM_by_ID(item_id));
 }
 
-/*:483*//*484:*/
-#line 5057 "./marpa.w"
+/*:504*//*505:*/
+#line 5312 "./marpa.w"
 
 int _marpa_g_ahm_null_count(Marpa_Grammar g,
 Marpa_AHM_ID item_id){
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 5315 "./marpa.w"
 
-/*:1313*/
-#line 5060 "./marpa.w"
-
-/*1315:*/
-#line 15640 "./marpa.w"
+/*1503:*/
+#line 19396 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!G_is_Precomputed(g))){
 MARPA_ERROR(MARPA_ERR_NOT_PRECOMPUTED);
 return failure_indicator;
 }
-/*:1315*/
-#line 5061 "./marpa.w"
+/*:1503*/
+#line 5316 "./marpa.w"
 
-/*1328:*/
-#line 15724 "./marpa.w"
+/*1516:*/
+#line 19480 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!ahm_is_valid(g,item_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_AIMID);
 return failure_indicator;
 }
 
-/*:1328*/
-#line 5062 "./marpa.w"
+/*:1516*/
+#line 5317 "./marpa.w"
 
 return Null_Count_of_AHM(AHM_by_ID(item_id));
 }
 
-/*:484*//*486:*/
-#line 5067 "./marpa.w"
+/*:505*//*507:*/
+#line 5322 "./marpa.w"
 
 Marpa_Symbol_ID _marpa_g_ahm_postdot(Marpa_Grammar g,
 Marpa_AHM_ID item_id){
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 5325 "./marpa.w"
 
-/*:1313*/
-#line 5070 "./marpa.w"
-
-/*1315:*/
-#line 15640 "./marpa.w"
+/*1503:*/
+#line 19396 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!G_is_Precomputed(g))){
 MARPA_ERROR(MARPA_ERR_NOT_PRECOMPUTED);
 return failure_indicator;
 }
-/*:1315*/
-#line 5071 "./marpa.w"
+/*:1503*/
+#line 5326 "./marpa.w"
 
-/*1328:*/
-#line 15724 "./marpa.w"
+/*1516:*/
+#line 19480 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!ahm_is_valid(g,item_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_AIMID);
 return failure_indicator;
 }
 
-/*:1328*/
-#line 5072 "./marpa.w"
+/*:1516*/
+#line 5327 "./marpa.w"
 
 return Postdot_NSYID_of_AHM(AHM_by_ID(item_id));
 }
 
-/*:486*//*494:*/
-#line 5186 "./marpa.w"
+/*:507*//*515:*/
+#line 5441 "./marpa.w"
 
 PRIVATE void
 memoize_xrl_data_for_AHM(AHM current_item,IRL irl)
@@ -10263,8 +10742,8 @@ XRL_Position_of_AHM(current_item)= irl_position;
 return;
 }
 
-/*:494*//*545:*/
-#line 5868 "./marpa.w"
+/*:515*//*567:*/
+#line 6187 "./marpa.w"
 
 PRIVATE_NOT_INLINE int zwp_cmp(
 const void*ap,
@@ -10280,23 +10759,22 @@ if(subkey)return subkey;
 return ZWAID_of_ZWP(zwp_a)-ZWAID_of_ZWP(zwp_b);
 }
 
-/*:545*//*546:*/
-#line 5883 "./marpa.w"
+/*:567*//*568:*/
+#line 6202 "./marpa.w"
 
 Marpa_Assertion_ID
 marpa_g_zwa_new(Marpa_Grammar g,int default_value)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
-
-/*:1313*/
-#line 5887 "./marpa.w"
+/*:1500*/
+#line 6206 "./marpa.w"
 
 ZWAID zwa_id;
 GZWA gzwa;
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -10307,19 +10785,19 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 5890 "./marpa.w"
+/*:1521*/
+#line 6209 "./marpa.w"
 
-/*1314:*/
-#line 15634 "./marpa.w"
+/*1502:*/
+#line 19390 "./marpa.w"
 
 if(_MARPA_UNLIKELY(G_is_Precomputed(g))){
 MARPA_ERROR(MARPA_ERR_PRECOMPUTED);
 return failure_indicator;
 }
 
-/*:1314*/
-#line 5891 "./marpa.w"
+/*:1502*/
+#line 6210 "./marpa.w"
 
 if(_MARPA_UNLIKELY(default_value<0||default_value> 1))
 {
@@ -10334,21 +10812,20 @@ gzwa->t_default_value= default_value?1:0;
 return zwa_id;
 }
 
-/*:546*//*547:*/
-#line 5905 "./marpa.w"
+/*:568*//*569:*/
+#line 6224 "./marpa.w"
 
 Marpa_Assertion_ID
 marpa_g_highest_zwa_id(Marpa_Grammar g)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 6228 "./marpa.w"
 
-/*:1313*/
-#line 5909 "./marpa.w"
-
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -10359,33 +10836,32 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 5910 "./marpa.w"
+/*:1521*/
+#line 6229 "./marpa.w"
 
 return ZWA_Count_of_G(g)-1;
 }
 
-/*:547*//*548:*/
-#line 5917 "./marpa.w"
+/*:569*//*570:*/
+#line 6236 "./marpa.w"
 
 int
 marpa_g_zwa_place(Marpa_Grammar g,
 Marpa_Assertion_ID zwaid,
 Marpa_Rule_ID xrl_id,int rhs_ix)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
-
-/*:1313*/
-#line 5923 "./marpa.w"
+/*:1500*/
+#line 6242 "./marpa.w"
 
 void*avl_insert_result;
 ZWP zwp;
 XRL xrl;
 int xrl_length;
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -10396,62 +10872,62 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 5928 "./marpa.w"
+/*:1521*/
+#line 6247 "./marpa.w"
 
-/*1314:*/
-#line 15634 "./marpa.w"
+/*1502:*/
+#line 19390 "./marpa.w"
 
 if(_MARPA_UNLIKELY(G_is_Precomputed(g))){
 MARPA_ERROR(MARPA_ERR_PRECOMPUTED);
 return failure_indicator;
 }
 
-/*:1314*/
-#line 5929 "./marpa.w"
+/*:1502*/
+#line 6248 "./marpa.w"
 
-/*1325:*/
-#line 15701 "./marpa.w"
+/*1513:*/
+#line 19457 "./marpa.w"
 
 if(_MARPA_UNLIKELY(XRLID_is_Malformed(xrl_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_RULE_ID);
 return failure_indicator;
 }
 
-/*:1325*/
-#line 5930 "./marpa.w"
+/*:1513*/
+#line 6249 "./marpa.w"
 
-/*1323:*/
-#line 15689 "./marpa.w"
+/*1511:*/
+#line 19445 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!XRLID_of_G_Exists(xrl_id))){
 MARPA_ERROR(MARPA_ERR_NO_SUCH_RULE_ID);
 return-1;
 }
 
-/*:1323*/
-#line 5931 "./marpa.w"
+/*:1511*/
+#line 6250 "./marpa.w"
 
-/*1327:*/
-#line 15713 "./marpa.w"
+/*1515:*/
+#line 19469 "./marpa.w"
 
 if(_MARPA_UNLIKELY(ZWAID_is_Malformed(zwaid))){
 MARPA_ERROR(MARPA_ERR_INVALID_ASSERTION_ID);
 return failure_indicator;
 }
 
-/*:1327*/
-#line 5932 "./marpa.w"
+/*:1515*/
+#line 6251 "./marpa.w"
 
-/*1326:*/
-#line 15707 "./marpa.w"
+/*1514:*/
+#line 19463 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!ZWAID_of_G_Exists(zwaid))){
 MARPA_ERROR(MARPA_ERR_NO_SUCH_ASSERTION_ID);
 return failure_indicator;
 }
-/*:1326*/
-#line 5933 "./marpa.w"
+/*:1514*/
+#line 6252 "./marpa.w"
 
 xrl= XRL_by_ID(xrl_id);
 if(rhs_ix<-1){
@@ -10474,98 +10950,103 @@ avl_insert_result= _marpa_avl_insert(g->t_zwp_tree,zwp);
 return avl_insert_result?-1:0;
 }
 
-/*:548*//*554:*/
-#line 6049 "./marpa.w"
+/*:570*//*576:*/
+#line 6368 "./marpa.w"
 
 Marpa_Recognizer marpa_r_new(Marpa_Grammar g)
 {
 RECCE r;
 int nsy_count;
 int irl_count;
-/*1312:*/
-#line 15626 "./marpa.w"
+/*1499:*/
+#line 19377 "./marpa.w"
 void*const failure_indicator= NULL;
-/*:1312*/
-#line 6055 "./marpa.w"
+/*:1499*/
+#line 6374 "./marpa.w"
 
-/*1315:*/
-#line 15640 "./marpa.w"
+/*1503:*/
+#line 19396 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!G_is_Precomputed(g))){
 MARPA_ERROR(MARPA_ERR_NOT_PRECOMPUTED);
 return failure_indicator;
 }
-/*:1315*/
-#line 6056 "./marpa.w"
+/*:1503*/
+#line 6375 "./marpa.w"
 
 nsy_count= NSY_Count_of_G(g);
 irl_count= IRL_Count_of_G(g);
-r= my_malloc(sizeof(struct marpa_r));
-/*619:*/
-#line 6659 "./marpa.w"
-r->t_obs= marpa_obs_init;
-/*:619*/
-#line 6060 "./marpa.w"
-
-/*557:*/
-#line 6069 "./marpa.w"
+r= marpa__a_malloc(Allocator_of_G(g),sizeof(struct marpa_r));
+/*643:*/
+#line 6992 "./marpa.w"
+r->t_obs= marpa_obs_cache_init(Chunk_Cache_of_G(g));
+/*:643*/
+#line 6379 "./marpa.w"
+
+/*579:*/
+#line 6389 "./marpa.w"
 
 r->t_ref_count= 1;
 
-/*:557*//*562:*/
-#line 6120 "./marpa.w"
+/*:579*//*584:*/
+#line 6443 "./marpa.w"
 
 {
 G_of_R(r)= g;
 grammar_ref(g);
 }
-/*:562*//*567:*/
-#line 6139 "./marpa.w"
+/*:584*//*589:*/
+#line 6462 "./marpa.w"
 
 Input_Phase_of_R(r)= R_BEFORE_INPUT;
 
-/*:567*//*569:*/
-#line 6149 "./marpa.w"
+/*:589*//*591:*/
+#line 6472 "./marpa.w"
 
 r->t_first_earley_set= NULL;
 r->t_latest_earley_set= NULL;
 r->t_current_earleme= -1;
 
-/*:569*//*573:*/
-#line 6183 "./marpa.w"
+/*:591*//*595:*/
+#line 6506 "./marpa.w"
 
 r->t_earley_item_warning_threshold= 
 MAX(DEFAULT_YIM_WARNING_THRESHOLD,AHM_Count_of_G(g)*3);
-/*:573*//*577:*/
-#line 6212 "./marpa.w"
+/*:595*//*599:*/
+#line 6535 "./marpa.w"
 r->t_furthest_earleme= 0;
-/*:577*//*584:*/
-#line 6254 "./marpa.w"
+/*:599*//*606:*/
+#line 6577 "./marpa.w"
 
 r->t_bv_nsyid_is_expected= bv_obs_create(r->t_obs,nsy_count);
-/*:584*//*588:*/
-#line 6331 "./marpa.w"
+/*:606*//*610:*/
+#line 6654 "./marpa.w"
 
 r->t_nsy_expected_is_event= lbv_obs_new0(r->t_obs,nsy_count);
-/*:588*//*606:*/
-#line 6574 "./marpa.w"
+/*:610*//*628:*/
+#line 6897 "./marpa.w"
 
 r->t_use_leo_flag= 1;
 r->t_is_using_leo= 0;
-/*:606*//*610:*/
-#line 6607 "./marpa.w"
+/*:628*//*632:*/
+#line 6930 "./marpa.w"
 
 r->t_bv_irl_seen= bv_obs_create(r->t_obs,irl_count);
-MARPA_DSTACK_INIT2(r->t_irl_cil_stack,CIL);
-/*:610*//*613:*/
-#line 6624 "./marpa.w"
+MARPA_DSTACK_INIT2(r->t_irl_cil_stack,CIL,Allocator_of_G(g));
+/*:632*//*635:*/
+#line 6943 "./marpa.w"
+
+r->t_bv_ahm_predicted= bv_obs_create(r->t_obs,AHM_Count_of_G(g));
+
+/*:635*//*637:*/
+#line 6957 "./marpa.w"
 r->t_is_exhausted= 0;
-/*:613*//*617:*/
-#line 6652 "./marpa.w"
+/*:637*//*641:*/
+#line 6985 "./marpa.w"
 r->t_first_inconsistent_ys= -1;
 
-/*:617*//*623:*/
-#line 6681 "./marpa.w"
+/*:641*//*647:*/
+#line 7014 "./marpa.w"
 
 {
 ZWAID zwaid;
@@ -10581,72 +11062,123 @@ Memo_YSID_of_ZWA(zwa)= -1;
 }
 }
 
-/*:623*//*638:*/
-#line 6775 "./marpa.w"
+/*:647*//*662:*/
+#line 7109 "./marpa.w"
 
 r->t_earley_set_count= 0;
 
-/*:638*//*705:*/
-#line 7578 "./marpa.w"
+/*:662*//*734:*/
+#line 8016 "./marpa.w"
+
+MARPA_DSTACK_INIT2(r->t_alternatives,ALT_Object,Allocator_of_G(g));
+/*:734*//*752:*/
+#line 8336 "./marpa.w"
+r->t_generation= 0;
+
+/*:752*//*762:*/
+#line 8485 "./marpa.w"
 
-MARPA_DSTACK_INIT2(r->t_alternatives,ALT_Object);
-/*:705*//*730:*/
-#line 8076 "./marpa.w"
+MARPA_DSTACK_INIT(r->t_checkpoints,CHECKPOINT_Object,8,Allocator_of_G(g));
+/*:762*//*772:*/
+#line 8740 "./marpa.w"
+r->t_valued_change_count= 0;
+
+/*:772*//*781:*/
+#line 8951 "./marpa.w"
 MARPA_DSTACK_SAFE(r->t_yim_work_stack);
-/*:730*//*734:*/
-#line 8091 "./marpa.w"
+/*:781*//*785:*/
+#line 8966 "./marpa.w"
 MARPA_DSTACK_SAFE(r->t_completion_stack);
-/*:734*//*738:*/
-#line 8102 "./marpa.w"
+/*:785*//*789:*/
+#line 8977 "./marpa.w"
 MARPA_DSTACK_SAFE(r->t_earley_set_stack);
-/*:738*//*829:*/
-#line 9635 "./marpa.w"
+/*:789*//*816:*/
+#line 9640 "./marpa.w"
+
+R_is_Forgetful(r)= 0;
+
+/*:816*//*824:*/
+#line 9706 "./marpa.w"
+
+YS_Obs_of_R(r)= r->t_obs;
+r->t_first_ys_batch= NULL;
+r->t_latest_ys_batch= NULL;
+YS_Batch_is_Closed(r)= 1;
+/*:824*//*836:*/
+#line 9827 "./marpa.w"
+
+r->t_next_forget_ysid= YS_FORGET_INTERVAL;
+/*:836*//*845:*/
+#line 10024 "./marpa.w"
+
+R_is_Lookahead_Filtered(r)= 0;
+
+/*:845*//*847:*/
+#line 10032 "./marpa.w"
+
+r->t_bv_lookahead= bv_obs_create(r->t_obs,nsy_count);
+
+/*:847*//*855:*/
+#line 10156 "./marpa.w"
+
+R_is_Link_Free(r)= 0;
+
+/*:855*//*998:*/
+#line 12952 "./marpa.w"
 
 r->t_current_report_item= &progress_report_not_ready;
 r->t_progress_report_traverser= NULL;
-/*:829*//*863:*/
-#line 10070 "./marpa.w"
+/*:998*//*1014:*/
+#line 13323 "./marpa.w"
 
-ur_node_stack_init(URS_of_R(r));
-/*:863*//*1345:*/
-#line 15907 "./marpa.w"
+r->t_bv_completed_xrl= bv_obs_create(r->t_obs,XRL_Count_of_G(g));
+
+/*:1014*//*1036:*/
+#line 13531 "./marpa.w"
+
+ur_node_stack_init(URS_of_R(r),Chunk_Cache_of_G(g));
+/*:1036*//*1539:*/
+#line 19755 "./marpa.w"
+Memory_Limit_of_R(r)= 0;
+/*:1539*//*1547:*/
+#line 19891 "./marpa.w"
 
 r->t_trace_earley_set= NULL;
 
-/*:1345*//*1352:*/
-#line 15983 "./marpa.w"
+/*:1547*//*1554:*/
+#line 19977 "./marpa.w"
 
 r->t_trace_earley_item= NULL;
 
-/*:1352*//*1366:*/
-#line 16183 "./marpa.w"
+/*:1554*//*1568:*/
+#line 20182 "./marpa.w"
 
 r->t_trace_pim_nsy_p= NULL;
 r->t_trace_postdot_item= NULL;
-/*:1366*//*1374:*/
-#line 16333 "./marpa.w"
+/*:1568*//*1576:*/
+#line 20332 "./marpa.w"
 
 r->t_trace_source_link= NULL;
 r->t_trace_source_type= NO_SOURCE;
 
-/*:1374*/
-#line 6061 "./marpa.w"
+/*:1576*/
+#line 6380 "./marpa.w"
 
-/*1294:*/
-#line 15439 "./marpa.w"
+/*1480:*/
+#line 19168 "./marpa.w"
 
 {
 if(G_is_Trivial(g)){
 psar_safe(Dot_PSAR_of_R(r));
 }else{
-psar_init(Dot_PSAR_of_R(r),AHM_Count_of_G(g));
+psar_init(Dot_PSAR_of_R(r),AHM_Count_of_G(g),Allocator_of_G(g));
 }
 }
-/*:1294*/
-#line 6062 "./marpa.w"
+/*:1480*/
+#line 6381 "./marpa.w"
 
-/*582:*/
-#line 6234 "./marpa.w"
+/*604:*/
+#line 6557 "./marpa.w"
 
 {
 NSYID xsy_count= XSY_Count_of_G(g);
@@ -10662,14 +11194,22 @@ bv_count(g->t_lbv_xsyid_is_completion_event)
 +bv_count(g->t_lbv_xsyid_is_prediction_event);
 }
 
-/*:582*/
-#line 6063 "./marpa.w"
+/*:604*/
+#line 6382 "./marpa.w"
+
+/*750:*/
+#line 8320 "./marpa.w"
+
+marpa_obs_mark(r->t_obs,&r->t_reset_mark);
+
+/*:750*/
+#line 6383 "./marpa.w"
 
 return r;
 }
 
-/*:554*//*558:*/
-#line 6073 "./marpa.w"
+/*:576*//*580:*/
+#line 6393 "./marpa.w"
 
 PRIVATE void
 recce_unref(RECCE r)
@@ -10687,8 +11227,8 @@ marpa_r_unref(Marpa_Recognizer r)
 recce_unref(r);
 }
 
-/*:558*//*559:*/
-#line 6091 "./marpa.w"
+/*:580*//*581:*/
+#line 6411 "./marpa.w"
 
 PRIVATE
 RECCE recce_ref(RECCE r)
@@ -10703,91 +11243,99 @@ marpa_r_ref(Marpa_Recognizer r)
 return recce_ref(r);
 }
 
-/*:559*//*560:*/
-#line 6105 "./marpa.w"
+/*:581*//*582:*/
+#line 6427 "./marpa.w"
 
 PRIVATE
 void recce_free(struct marpa_r*r)
 {
-/*563:*/
-#line 6125 "./marpa.w"
+/*585:*/
+#line 6448 "./marpa.w"
 
 const GRAMMAR g= G_of_R(r);
-/*:563*/
-#line 6109 "./marpa.w"
+/*:585*/
+#line 6431 "./marpa.w"
 
-/*564:*/
-#line 6127 "./marpa.w"
+struct marpa_allocator_s allocator= *Allocator_of_G(g);
+/*586:*/
+#line 6450 "./marpa.w"
 grammar_unref(g);
 
-/*:564*//*611:*/
-#line 6610 "./marpa.w"
+/*:586*//*633:*/
+#line 6933 "./marpa.w"
 
 MARPA_DSTACK_DESTROY(r->t_irl_cil_stack);
 
-/*:611*//*706:*/
-#line 7580 "./marpa.w"
+/*:633*//*735:*/
+#line 8018 "./marpa.w"
 MARPA_DSTACK_DESTROY(r->t_alternatives);
 
-/*:706*//*732:*/
-#line 8084 "./marpa.w"
+/*:735*//*763:*/
+#line 8487 "./marpa.w"
+MARPA_DSTACK_DESTROY(r->t_checkpoints);
+
+/*:763*//*783:*/
+#line 8959 "./marpa.w"
 MARPA_DSTACK_DESTROY(r->t_yim_work_stack);
 
-/*:732*//*736:*/
-#line 8099 "./marpa.w"
+/*:783*//*787:*/
+#line 8974 "./marpa.w"
 MARPA_DSTACK_DESTROY(r->t_completion_stack);
 
-/*:736*//*739:*/
-#line 8103 "./marpa.w"
+/*:787*//*790:*/
+#line 8978 "./marpa.w"
 MARPA_DSTACK_DESTROY(r->t_earley_set_stack);
 
-/*:739*//*831:*/
-#line 9644 "./marpa.w"
+/*:790*//*1000:*/
+#line 12961 "./marpa.w"
 
-/*830:*/
-#line 9638 "./marpa.w"
+/*999:*/
+#line 12955 "./marpa.w"
 
 r->t_current_report_item= &progress_report_not_ready;
 if(r->t_progress_report_traverser){
 _marpa_avl_destroy(MARPA_TREE_OF_AVL_TRAV(r->t_progress_report_traverser));
 }
 r->t_progress_report_traverser= NULL;
-/*:830*/
-#line 9645 "./marpa.w"
+/*:999*/
+#line 12962 "./marpa.w"
 ;
-/*:831*//*864:*/
-#line 10072 "./marpa.w"
+/*:1000*//*1037:*/
+#line 13533 "./marpa.w"
 
 ur_node_stack_destroy(URS_of_R(r));
 
-/*:864*//*1295:*/
-#line 15447 "./marpa.w"
+/*:1037*//*1481:*/
+#line 19176 "./marpa.w"
 
 psar_destroy(Dot_PSAR_of_R(r));
-/*:1295*/
-#line 6110 "./marpa.w"
+/*:1481*/
+#line 6433 "./marpa.w"
 
-/*620:*/
-#line 6660 "./marpa.w"
+/*644:*/
+#line 6993 "./marpa.w"
 marpa_obs_free(r->t_obs);
 
-/*:620*/
-#line 6111 "./marpa.w"
+/*:644*//*825:*/
+#line 9715 "./marpa.w"
+ys_batches_free(r);
+/*:825*/
+#line 6434 "./marpa.w"
 
-my_free(r);
+marpa__a_free(&allocator,r);
 }
 
-/*:560*//*570:*/
-#line 6157 "./marpa.w"
+/*:582*//*592:*/
+#line 6480 "./marpa.w"
 
 Marpa_Earleme marpa_r_current_earleme(Marpa_Recognizer r)
 {
-/*563:*/
-#line 6125 "./marpa.w"
+/*585:*/
+#line 6448 "./marpa.w"
 
 const GRAMMAR g= G_of_R(r);
-/*:563*/
-#line 6160 "./marpa.w"
+/*:585*/
+#line 6483 "./marpa.w"
 
 if(_MARPA_UNLIKELY(Input_Phase_of_R(r)==R_BEFORE_INPUT)){
 MARPA_ERROR(MARPA_ERR_RECCE_NOT_STARTED);
@@ -10796,8 +11344,8 @@ return-1;
 return Current_Earleme_of_R(r);
 }
 
-/*:570*//*571:*/
-#line 6172 "./marpa.w"
+/*:592*//*593:*/
+#line 6495 "./marpa.w"
 
 PRIVATE YS ys_at_current_earleme(RECCE r)
 {
@@ -10806,8 +11354,8 @@ if(Earleme_of_YS(latest)==Current_Earleme_of_R(r))return latest;
 return NULL;
 }
 
-/*:571*//*574:*/
-#line 6186 "./marpa.w"
+/*:593*//*596:*/
+#line 6509 "./marpa.w"
 
 int
 marpa_r_earley_item_warning_threshold(Marpa_Recognizer r)
@@ -10815,8 +11363,8 @@ marpa_r_earley_item_warning_threshold(Marpa_Recognizer r)
 return r->t_earley_item_warning_threshold;
 }
 
-/*:574*//*575:*/
-#line 6195 "./marpa.w"
+/*:596*//*597:*/
+#line 6518 "./marpa.w"
 
 int
 marpa_r_earley_item_warning_threshold_set(Marpa_Recognizer r,int threshold)
@@ -10826,38 +11374,37 @@ r->t_earley_item_warning_threshold= new_threshold;
 return new_threshold;
 }
 
-/*:575*//*578:*/
-#line 6213 "./marpa.w"
+/*:597*//*600:*/
+#line 6536 "./marpa.w"
 
 unsigned int marpa_r_furthest_earleme(Marpa_Recognizer r)
 {return(unsigned int)Furthest_Earleme_of_R(r);}
 
-/*:578*//*585:*/
-#line 6262 "./marpa.w"
+/*:600*//*607:*/
+#line 6585 "./marpa.w"
 
 int marpa_r_terminals_expected(Marpa_Recognizer r,Marpa_Symbol_ID*buffer)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 6588 "./marpa.w"
 
-/*:1313*/
-#line 6265 "./marpa.w"
-
-/*563:*/
-#line 6125 "./marpa.w"
+/*585:*/
+#line 6448 "./marpa.w"
 
 const GRAMMAR g= G_of_R(r);
-/*:563*/
-#line 6266 "./marpa.w"
+/*:585*/
+#line 6589 "./marpa.w"
 
 NSYID xsy_count;
 Bit_Vector bv_terminals;
 int min,max,start;
 int next_buffer_ix= 0;
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -10868,22 +11415,22 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 6272 "./marpa.w"
+/*:1521*/
+#line 6595 "./marpa.w"
 
-/*1330:*/
-#line 15738 "./marpa.w"
+/*1518:*/
+#line 19494 "./marpa.w"
 
 if(_MARPA_UNLIKELY(Input_Phase_of_R(r)==R_BEFORE_INPUT)){
 MARPA_ERROR(MARPA_ERR_RECCE_NOT_STARTED);
 return failure_indicator;
 }
-/*:1330*/
-#line 6273 "./marpa.w"
+/*:1518*/
+#line 6596 "./marpa.w"
 
 
 xsy_count= XSY_Count_of_G(g);
-bv_terminals= bv_create(xsy_count);
+bv_terminals= bv_create(Allocator_of_G(g),xsy_count);
 for(start= 0;bv_scan(r->t_bv_nsyid_is_expected,start,&min,&max);
 start= max+2)
 {
@@ -10903,34 +11450,33 @@ for(xsyid= min;xsyid<=max;xsyid++)
 buffer[next_buffer_ix++]= xsyid;
 }
 }
-bv_free(bv_terminals);
+bv_free(Allocator_of_G(g),bv_terminals);
 return next_buffer_ix;
 }
 
-/*:585*//*586:*/
-#line 6300 "./marpa.w"
+/*:607*//*608:*/
+#line 6623 "./marpa.w"
 
 int marpa_r_terminal_is_expected(Marpa_Recognizer r,
 Marpa_Symbol_ID xsy_id)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 6627 "./marpa.w"
 
-/*:1313*/
-#line 6304 "./marpa.w"
-
-/*563:*/
-#line 6125 "./marpa.w"
+/*585:*/
+#line 6448 "./marpa.w"
 
 const GRAMMAR g= G_of_R(r);
-/*:563*/
-#line 6305 "./marpa.w"
+/*:585*/
+#line 6628 "./marpa.w"
 
 XSY xsy;
 NSY nsy;
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -10941,39 +11487,39 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 6308 "./marpa.w"
+/*:1521*/
+#line 6631 "./marpa.w"
 
-/*1330:*/
-#line 15738 "./marpa.w"
+/*1518:*/
+#line 19494 "./marpa.w"
 
 if(_MARPA_UNLIKELY(Input_Phase_of_R(r)==R_BEFORE_INPUT)){
 MARPA_ERROR(MARPA_ERR_RECCE_NOT_STARTED);
 return failure_indicator;
 }
-/*:1330*/
-#line 6309 "./marpa.w"
+/*:1518*/
+#line 6632 "./marpa.w"
 
-/*1316:*/
-#line 15645 "./marpa.w"
+/*1504:*/
+#line 19401 "./marpa.w"
 
 if(_MARPA_UNLIKELY(XSYID_is_Malformed(xsy_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_SYMBOL_ID);
 return failure_indicator;
 }
-/*:1316*/
-#line 6310 "./marpa.w"
+/*:1504*/
+#line 6633 "./marpa.w"
 
-/*1318:*/
-#line 15657 "./marpa.w"
+/*1506:*/
+#line 19413 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!XSYID_of_G_Exists(xsy_id))){
 MARPA_ERROR(MARPA_ERR_NO_SUCH_SYMBOL_ID);
 return failure_indicator;
 }
 
-/*:1318*/
-#line 6311 "./marpa.w"
+/*:1506*/
+#line 6634 "./marpa.w"
 
 xsy= XSY_by_ID(xsy_id);
 if(_MARPA_UNLIKELY(!XSY_is_Terminal(xsy))){
@@ -10984,8 +11530,8 @@ if(_MARPA_UNLIKELY(!nsy))return 0;
 return bv_bit_test(r->t_bv_nsyid_is_expected,ID_of_NSY(nsy));
 }
 
-/*:586*//*589:*/
-#line 6334 "./marpa.w"
+/*:608*//*611:*/
+#line 6657 "./marpa.w"
 
 int
 marpa_r_expected_symbol_event_set(Marpa_Recognizer r,Marpa_Symbol_ID xsy_id,
@@ -10994,22 +11540,21 @@ int value)
 XSY xsy;
 NSY nsy;
 NSYID nsyid;
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 6665 "./marpa.w"
 
-/*:1313*/
-#line 6342 "./marpa.w"
-
-/*563:*/
-#line 6125 "./marpa.w"
+/*585:*/
+#line 6448 "./marpa.w"
 
 const GRAMMAR g= G_of_R(r);
-/*:563*/
-#line 6343 "./marpa.w"
+/*:585*/
+#line 6666 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -11020,28 +11565,28 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 6344 "./marpa.w"
+/*:1521*/
+#line 6667 "./marpa.w"
 
-/*1316:*/
-#line 15645 "./marpa.w"
+/*1504:*/
+#line 19401 "./marpa.w"
 
 if(_MARPA_UNLIKELY(XSYID_is_Malformed(xsy_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_SYMBOL_ID);
 return failure_indicator;
 }
-/*:1316*/
-#line 6345 "./marpa.w"
+/*:1504*/
+#line 6668 "./marpa.w"
 
-/*1317:*/
-#line 15652 "./marpa.w"
+/*1505:*/
+#line 19408 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!XSYID_of_G_Exists(xsy_id))){
 MARPA_ERROR(MARPA_ERR_NO_SUCH_SYMBOL_ID);
 return-1;
 }
-/*:1317*/
-#line 6346 "./marpa.w"
+/*:1505*/
+#line 6669 "./marpa.w"
 
 if(_MARPA_UNLIKELY(value<0||value> 1))
 {
@@ -11067,29 +11612,28 @@ lbv_bit_clear(r->t_nsy_expected_is_event,nsyid);
 return value;
 }
 
-/*:589*//*591:*/
-#line 6385 "./marpa.w"
+/*:611*//*613:*/
+#line 6708 "./marpa.w"
 
 int
 marpa_r_completion_symbol_activate(Marpa_Recognizer r,
 Marpa_Symbol_ID xsy_id,int reactivate)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 6713 "./marpa.w"
 
-/*:1313*/
-#line 6390 "./marpa.w"
-
-/*563:*/
-#line 6125 "./marpa.w"
+/*585:*/
+#line 6448 "./marpa.w"
 
 const GRAMMAR g= G_of_R(r);
-/*:563*/
-#line 6391 "./marpa.w"
+/*:585*/
+#line 6714 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -11100,28 +11644,28 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 6392 "./marpa.w"
+/*:1521*/
+#line 6715 "./marpa.w"
 
-/*1316:*/
-#line 15645 "./marpa.w"
+/*1504:*/
+#line 19401 "./marpa.w"
 
 if(_MARPA_UNLIKELY(XSYID_is_Malformed(xsy_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_SYMBOL_ID);
 return failure_indicator;
 }
-/*:1316*/
-#line 6393 "./marpa.w"
+/*:1504*/
+#line 6716 "./marpa.w"
 
-/*1317:*/
-#line 15652 "./marpa.w"
+/*1505:*/
+#line 19408 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!XSYID_of_G_Exists(xsy_id))){
 MARPA_ERROR(MARPA_ERR_NO_SUCH_SYMBOL_ID);
 return-1;
 }
-/*:1317*/
-#line 6394 "./marpa.w"
+/*:1505*/
+#line 6717 "./marpa.w"
 
 switch(reactivate){
 case 0:
@@ -11146,29 +11690,28 @@ MARPA_ERROR(MARPA_ERR_INVALID_BOOLEAN);
 return failure_indicator;
 }
 
-/*:591*//*593:*/
-#line 6432 "./marpa.w"
+/*:613*//*615:*/
+#line 6755 "./marpa.w"
 
 int
 marpa_r_nulled_symbol_activate(Marpa_Recognizer r,Marpa_Symbol_ID xsy_id,
 int reactivate)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 6760 "./marpa.w"
 
-/*:1313*/
-#line 6437 "./marpa.w"
-
-/*563:*/
-#line 6125 "./marpa.w"
+/*585:*/
+#line 6448 "./marpa.w"
 
 const GRAMMAR g= G_of_R(r);
-/*:563*/
-#line 6438 "./marpa.w"
+/*:585*/
+#line 6761 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -11179,28 +11722,28 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 6439 "./marpa.w"
+/*:1521*/
+#line 6762 "./marpa.w"
 
-/*1316:*/
-#line 15645 "./marpa.w"
+/*1504:*/
+#line 19401 "./marpa.w"
 
 if(_MARPA_UNLIKELY(XSYID_is_Malformed(xsy_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_SYMBOL_ID);
 return failure_indicator;
 }
-/*:1316*/
-#line 6440 "./marpa.w"
+/*:1504*/
+#line 6763 "./marpa.w"
 
-/*1317:*/
-#line 15652 "./marpa.w"
+/*1505:*/
+#line 19408 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!XSYID_of_G_Exists(xsy_id))){
 MARPA_ERROR(MARPA_ERR_NO_SUCH_SYMBOL_ID);
 return-1;
 }
-/*:1317*/
-#line 6441 "./marpa.w"
+/*:1505*/
+#line 6764 "./marpa.w"
 
 switch(reactivate){
 case 0:
@@ -11225,29 +11768,28 @@ MARPA_ERROR(MARPA_ERR_INVALID_BOOLEAN);
 return failure_indicator;
 }
 
-/*:593*//*595:*/
-#line 6479 "./marpa.w"
+/*:615*//*617:*/
+#line 6802 "./marpa.w"
 
 int
 marpa_r_prediction_symbol_activate(Marpa_Recognizer r,
 Marpa_Symbol_ID xsy_id,int reactivate)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 6807 "./marpa.w"
 
-/*:1313*/
-#line 6484 "./marpa.w"
-
-/*563:*/
-#line 6125 "./marpa.w"
+/*585:*/
+#line 6448 "./marpa.w"
 
 const GRAMMAR g= G_of_R(r);
-/*:563*/
-#line 6485 "./marpa.w"
+/*:585*/
+#line 6808 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -11258,28 +11800,28 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 6486 "./marpa.w"
+/*:1521*/
+#line 6809 "./marpa.w"
 
-/*1316:*/
-#line 15645 "./marpa.w"
+/*1504:*/
+#line 19401 "./marpa.w"
 
 if(_MARPA_UNLIKELY(XSYID_is_Malformed(xsy_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_SYMBOL_ID);
 return failure_indicator;
 }
-/*:1316*/
-#line 6487 "./marpa.w"
+/*:1504*/
+#line 6810 "./marpa.w"
 
-/*1317:*/
-#line 15652 "./marpa.w"
+/*1505:*/
+#line 19408 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!XSYID_of_G_Exists(xsy_id))){
 MARPA_ERROR(MARPA_ERR_NO_SUCH_SYMBOL_ID);
 return-1;
 }
-/*:1317*/
-#line 6488 "./marpa.w"
+/*:1505*/
+#line 6811 "./marpa.w"
 
 switch(reactivate){
 case 0:
@@ -11304,27 +11846,26 @@ MARPA_ERROR(MARPA_ERR_INVALID_BOOLEAN);
 return failure_indicator;
 }
 
-/*:595*//*607:*/
-#line 6580 "./marpa.w"
+/*:617*//*629:*/
+#line 6903 "./marpa.w"
 
 int _marpa_r_is_use_leo(Marpa_Recognizer r)
 {
-/*563:*/
-#line 6125 "./marpa.w"
+/*585:*/
+#line 6448 "./marpa.w"
 
 const GRAMMAR g= G_of_R(r);
-/*:563*/
-#line 6583 "./marpa.w"
+/*:585*/
+#line 6906 "./marpa.w"
 
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 6907 "./marpa.w"
 
-/*:1313*/
-#line 6584 "./marpa.w"
-
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -11335,33 +11876,32 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 6585 "./marpa.w"
+/*:1521*/
+#line 6908 "./marpa.w"
 
 return r->t_use_leo_flag;
 }
-/*:607*//*608:*/
-#line 6588 "./marpa.w"
+/*:629*//*630:*/
+#line 6911 "./marpa.w"
 
 int _marpa_r_is_use_leo_set(
 Marpa_Recognizer r,int value)
 {
-/*563:*/
-#line 6125 "./marpa.w"
+/*585:*/
+#line 6448 "./marpa.w"
 
 const GRAMMAR g= G_of_R(r);
-/*:563*/
-#line 6592 "./marpa.w"
+/*:585*/
+#line 6915 "./marpa.w"
 
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 6916 "./marpa.w"
 
-/*:1313*/
-#line 6593 "./marpa.w"
-
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -11372,43 +11912,42 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 6594 "./marpa.w"
+/*:1521*/
+#line 6917 "./marpa.w"
 
-/*1329:*/
-#line 15733 "./marpa.w"
+/*1517:*/
+#line 19489 "./marpa.w"
 
 if(_MARPA_UNLIKELY(Input_Phase_of_R(r)!=R_BEFORE_INPUT)){
 MARPA_ERROR(MARPA_ERR_RECCE_STARTED);
 return failure_indicator;
 }
-/*:1329*/
-#line 6595 "./marpa.w"
+/*:1517*/
+#line 6918 "./marpa.w"
 
 return r->t_use_leo_flag= value?1:0;
 }
 
-/*:608*//*615:*/
-#line 6635 "./marpa.w"
+/*:630*//*639:*/
+#line 6968 "./marpa.w"
 
 int marpa_r_is_exhausted(Marpa_Recognizer r)
 {
-/*563:*/
-#line 6125 "./marpa.w"
+/*585:*/
+#line 6448 "./marpa.w"
 
 const GRAMMAR g= G_of_R(r);
-/*:563*/
-#line 6638 "./marpa.w"
+/*:585*/
+#line 6971 "./marpa.w"
 
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 6972 "./marpa.w"
 
-/*:1313*/
-#line 6639 "./marpa.w"
-
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -11419,34 +11958,33 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 6640 "./marpa.w"
+/*:1521*/
+#line 6973 "./marpa.w"
 
 return R_is_Exhausted(r);
 }
 
-/*:615*//*642:*/
-#line 6794 "./marpa.w"
+/*:639*//*666:*/
+#line 7128 "./marpa.w"
 
 int marpa_r_earley_set_value(Marpa_Recognizer r,Marpa_Earley_Set_ID set_id)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
-
-/*:1313*/
-#line 6797 "./marpa.w"
+/*:1500*/
+#line 7131 "./marpa.w"
 
 YS earley_set;
-/*563:*/
-#line 6125 "./marpa.w"
+/*585:*/
+#line 6448 "./marpa.w"
 
 const GRAMMAR g= G_of_R(r);
-/*:563*/
-#line 6799 "./marpa.w"
+/*:585*/
+#line 7133 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -11457,18 +11995,18 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 6800 "./marpa.w"
+/*:1521*/
+#line 7134 "./marpa.w"
 
-/*1330:*/
-#line 15738 "./marpa.w"
+/*1518:*/
+#line 19494 "./marpa.w"
 
 if(_MARPA_UNLIKELY(Input_Phase_of_R(r)==R_BEFORE_INPUT)){
 MARPA_ERROR(MARPA_ERR_RECCE_NOT_STARTED);
 return failure_indicator;
 }
-/*:1330*/
-#line 6801 "./marpa.w"
+/*:1518*/
+#line 7135 "./marpa.w"
 
 if(set_id<0)
 {
@@ -11481,34 +12019,38 @@ if(!YS_Ord_is_Valid(r,set_id))
 MARPA_ERROR(MARPA_ERR_NO_EARLEY_SET_AT_LOCATION);
 return failure_indicator;
 }
-earley_set= YS_of_R_by_Ord(r,set_id);
+earley_set= ys_of_r_by_ord(r,set_id);
+if(_MARPA_UNLIKELY(!earley_set))
+{
+MARPA_ERROR(MARPA_ERR_EARLEY_SET_FORGOTTEN);
+return failure_indicator;
+}
 return Value_of_YS(earley_set);
 }
 
-/*:642*//*643:*/
-#line 6817 "./marpa.w"
+/*:666*//*667:*/
+#line 7156 "./marpa.w"
 
 int
 marpa_r_earley_set_values(Marpa_Recognizer r,Marpa_Earley_Set_ID set_id,
 int*p_value,void**p_pvalue)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
-
-/*:1313*/
-#line 6822 "./marpa.w"
+/*:1500*/
+#line 7161 "./marpa.w"
 
 YS earley_set;
-/*563:*/
-#line 6125 "./marpa.w"
+/*585:*/
+#line 6448 "./marpa.w"
 
 const GRAMMAR g= G_of_R(r);
-/*:563*/
-#line 6824 "./marpa.w"
+/*:585*/
+#line 7163 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -11519,18 +12061,18 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 6825 "./marpa.w"
+/*:1521*/
+#line 7164 "./marpa.w"
 
-/*1330:*/
-#line 15738 "./marpa.w"
+/*1518:*/
+#line 19494 "./marpa.w"
 
 if(_MARPA_UNLIKELY(Input_Phase_of_R(r)==R_BEFORE_INPUT)){
 MARPA_ERROR(MARPA_ERR_RECCE_NOT_STARTED);
 return failure_indicator;
 }
-/*:1330*/
-#line 6826 "./marpa.w"
+/*:1518*/
+#line 7165 "./marpa.w"
 
 if(set_id<0)
 {
@@ -11543,34 +12085,38 @@ if(!YS_Ord_is_Valid(r,set_id))
 MARPA_ERROR(MARPA_ERR_NO_EARLEY_SET_AT_LOCATION);
 return failure_indicator;
 }
-earley_set= YS_of_R_by_Ord(r,set_id);
+earley_set= ys_of_r_by_ord(r,set_id);
+if(_MARPA_UNLIKELY(!earley_set))
+{
+MARPA_ERROR(MARPA_ERR_EARLEY_SET_FORGOTTEN);
+return failure_indicator;
+}
 if(p_value)*p_value= Value_of_YS(earley_set);
 if(p_pvalue)*p_pvalue= PValue_of_YS(earley_set);
 return 1;
 }
 
-/*:643*//*644:*/
-#line 6844 "./marpa.w"
+/*:667*//*668:*/
+#line 7188 "./marpa.w"
 
 int marpa_r_latest_earley_set_value_set(Marpa_Recognizer r,int value)
 {
 YS earley_set;
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 7192 "./marpa.w"
 
-/*:1313*/
-#line 6848 "./marpa.w"
-
-/*563:*/
-#line 6125 "./marpa.w"
+/*585:*/
+#line 6448 "./marpa.w"
 
 const GRAMMAR g= G_of_R(r);
-/*:563*/
-#line 6849 "./marpa.w"
+/*:585*/
+#line 7193 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -11581,46 +12127,45 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 6850 "./marpa.w"
+/*:1521*/
+#line 7194 "./marpa.w"
 
-/*1330:*/
-#line 15738 "./marpa.w"
+/*1518:*/
+#line 19494 "./marpa.w"
 
 if(_MARPA_UNLIKELY(Input_Phase_of_R(r)==R_BEFORE_INPUT)){
 MARPA_ERROR(MARPA_ERR_RECCE_NOT_STARTED);
 return failure_indicator;
 }
-/*:1330*/
-#line 6851 "./marpa.w"
+/*:1518*/
+#line 7195 "./marpa.w"
 
 earley_set= Latest_YS_of_R(r);
 return Value_of_YS(earley_set)= value;
 }
 
-/*:644*//*645:*/
-#line 6856 "./marpa.w"
+/*:668*//*669:*/
+#line 7200 "./marpa.w"
 
 int marpa_r_latest_earley_set_values_set(Marpa_Recognizer r,int value,
 void*pvalue)
 {
 YS earley_set;
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 7205 "./marpa.w"
 
-/*:1313*/
-#line 6861 "./marpa.w"
-
-/*563:*/
-#line 6125 "./marpa.w"
+/*585:*/
+#line 6448 "./marpa.w"
 
 const GRAMMAR g= G_of_R(r);
-/*:563*/
-#line 6862 "./marpa.w"
+/*:585*/
+#line 7206 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -11631,18 +12176,18 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 6863 "./marpa.w"
+/*:1521*/
+#line 7207 "./marpa.w"
 
-/*1330:*/
-#line 15738 "./marpa.w"
+/*1518:*/
+#line 19494 "./marpa.w"
 
 if(_MARPA_UNLIKELY(Input_Phase_of_R(r)==R_BEFORE_INPUT)){
 MARPA_ERROR(MARPA_ERR_RECCE_NOT_STARTED);
 return failure_indicator;
 }
-/*:1330*/
-#line 6864 "./marpa.w"
+/*:1518*/
+#line 7208 "./marpa.w"
 
 earley_set= Latest_YS_of_R(r);
 Value_of_YS(earley_set)= value;
@@ -11650,15 +12195,18 @@ PValue_of_YS(earley_set)= pvalue;
 return 1;
 }
 
-/*:645*//*646:*/
-#line 6872 "./marpa.w"
+/*:669*//*670:*/
+#line 7216 "./marpa.w"
 
 PRIVATE YS
 earley_set_new(RECCE r,JEARLEME id)
 {
 YSK_Object key;
 YS set;
-set= marpa_obs_new(r->t_obs,YS_Object,1);
+if(R_is_Forgetful(r)&&YS_Batch_is_Closed(r)){
+ys_batch_new(r);
+}
+set= marpa_obs_new(YS_Obs_of_R(r),YS_Object,1);
 key.t_earleme= id;
 set->t_key= key;
 set->t_postdot_ary= NULL;
@@ -11667,48 +12215,80 @@ YIM_Count_of_YS(set)= 0;
 set->t_ordinal= r->t_earley_set_count++;
 YIMs_of_YS(set)= NULL;
 Next_YS_of_YS(set)= NULL;
-/*641:*/
-#line 6790 "./marpa.w"
+/*665:*/
+#line 7124 "./marpa.w"
 
 Value_of_YS(set)= -1;
 PValue_of_YS(set)= NULL;
 
-/*:641*//*1301:*/
-#line 15503 "./marpa.w"
+/*:665*//*682:*/
+#line 7381 "./marpa.w"
+
+#if MARPA_COMPACT_YIM
+AHMs_of_YS(set)= G_of_R(r)->t_ahms;
+#endif
+
+/*:682*//*834:*/
+#line 9810 "./marpa.w"
+
+YS_is_Needed(set)= 1;
+YS_is_Root(set)= 1;
+YS_is_Forgotten(set)= 0;
+
+/*:834*//*1487:*/
+#line 19233 "./marpa.w"
 
 {set->t_dot_psl= NULL;}
 
-/*:1301*/
-#line 6887 "./marpa.w"
+/*:1487*/
+#line 7234 "./marpa.w"
 
 return set;
 }
 
-/*:646*//*656:*/
-#line 6997 "./marpa.w"
+/*:670*//*683:*/
+#line 7390 "./marpa.w"
+
+PRIVATE YIM earley_item_alloc(const RECCE r,const AHM ahm)
+{
+if(AHM_is_Unsourced(ahm))
+{
+return marpa__obs_alloc(YS_Obs_of_R(r),
+Sizeof_Unsourced_YIM,ALIGNOF(YIM_Object));
+}
+if(R_is_Link_Free(r))
+{
+return marpa__obs_alloc(YS_Obs_of_R(r),
+Sizeof_Link_Free_YIM,ALIGNOF(YIM_Object));
+}
+return marpa_obs_new(YS_Obs_of_R(r),struct s_earley_item,1);
+}
+
+/*:683*//*685:*/
+#line 7417 "./marpa.w"
 
 PRIVATE YIM earley_item_create(const RECCE r,
 const YIK_Object key)
 {
-/*1312:*/
-#line 15626 "./marpa.w"
+/*1499:*/
+#line 19377 "./marpa.w"
 void*const failure_indicator= NULL;
-/*:1312*/
-#line 7001 "./marpa.w"
+/*:1499*/
+#line 7421 "./marpa.w"
 
-/*563:*/
-#line 6125 "./marpa.w"
+/*585:*/
+#line 6448 "./marpa.w"
 
 const GRAMMAR g= G_of_R(r);
-/*:563*/
-#line 7002 "./marpa.w"
+/*:585*/
+#line 7422 "./marpa.w"
 
 YIM new_item;
 YIM*end_of_work_stack;
 const YS set= key.t_set;
 const int count= ++YIM_Count_of_YS(set);
-/*658:*/
-#line 7056 "./marpa.w"
+/*687:*/
+#line 7479 "./marpa.w"
 
 if(_MARPA_UNLIKELY(count>=YIM_FATAL_THRESHOLD))
 {
@@ -11716,14 +12296,17 @@ MARPA_FATAL(MARPA_ERR_YIM_COUNT);
 return failure_indicator;
 }
 
-/*:658*/
-#line 7007 "./marpa.w"
+/*:687*/
+#line 7427 "./marpa.w"
 
-new_item= marpa_obs_new(r->t_obs,struct s_earley_item,1);
-new_item->t_key= key;
+new_item= earley_item_alloc(r,key.t_ahm);
+Origin_of_YIM(new_item)= key.t_origin;
+YS_of_YIM(new_item)= set;
+AHM_of_YIM_Set(new_item,key.t_ahm);
 new_item->t_source_type= NO_SOURCE;
 YIM_is_Rejected(new_item)= 0;
 YIM_is_Active(new_item)= 1;
+if(!R_is_Link_Free(r)&&!AHM_is_Unsourced(key.t_ahm))
 {
 SRC unique_yim_src= SRC_of_YIM(new_item);
 SRC_is_Rejected(unique_yim_src)= 0;
@@ -11735,8 +12318,8 @@ end_of_work_stack= WORK_YIM_PUSH(r);
 return new_item;
 }
 
-/*:656*//*657:*/
-#line 7024 "./marpa.w"
+/*:685*//*686:*/
+#line 7447 "./marpa.w"
 
 PRIVATE YIM
 earley_item_assign(const RECCE r,const YS set,const YS origin,
@@ -11768,8 +12351,8 @@ PSL_Datum(psl,ahm_id)= yim;
 return yim;
 }
 
-/*:657*//*662:*/
-#line 7092 "./marpa.w"
+/*:686*//*691:*/
+#line 7515 "./marpa.w"
 
 PRIVATE_NOT_INLINE Marpa_Error_Code invalid_source_type_code(unsigned int type)
 {
@@ -11788,8 +12371,8 @@ return MARPA_ERR_SOURCE_TYPE_IS_AMBIGUOUS;
 return MARPA_ERR_SOURCE_TYPE_IS_UNKNOWN;
 }
 
-/*:662*//*674:*/
-#line 7213 "./marpa.w"
+/*:691*//*703:*/
+#line 7636 "./marpa.w"
 
 PRIVATE PIM*
 pim_nsy_p_find(YS set,NSYID nsyid)
@@ -11810,8 +12393,8 @@ hi= trial-1;
 }
 return NULL;
 }
-/*:674*//*675:*/
-#line 7233 "./marpa.w"
+/*:703*//*704:*/
+#line 7656 "./marpa.w"
 
 PRIVATE PIM first_pim_of_ys_by_nsyid(YS set,NSYID nsyid)
 {
@@ -11819,8 +12402,8 @@ PIM*pim_nsy_p= pim_nsy_p_find(set,nsyid);
 return pim_nsy_p?*pim_nsy_p:NULL;
 }
 
-/*:675*//*693:*/
-#line 7390 "./marpa.w"
+/*:704*//*722:*/
+#line 7813 "./marpa.w"
 
 PRIVATE
 SRCL unique_srcl_new(struct marpa_obstack*t_obs)
@@ -11831,8 +12414,8 @@ SRCL_is_Active(new_srcl)= 1;
 return new_srcl;
 }
 
-/*:693*//*694:*/
-#line 7400 "./marpa.w"
+/*:722*//*723:*/
+#line 7823 "./marpa.w"
 PRIVATE
 void
 tkn_link_add(RECCE r,
@@ -11842,6 +12425,22 @@ ALT alternative)
 {
 SRCL new_link;
 unsigned int previous_source_type= Source_Type_of_YIM(item);
+if(R_is_Link_Free(r))
+{
+/*860:*/
+#line 10203 "./marpa.w"
+
+if(previous_source_type==NO_SOURCE)
+{
+Source_Type_of_YIM(item)= SOURCE_IS_AMBIGUOUS;
+LV_First_Leo_SRCL_of_YIM(item)= NULL;
+}
+
+/*:860*/
+#line 7834 "./marpa.w"
+
+return;
+}
 if(previous_source_type==NO_SOURCE)
 {
 const SRCL source_link= SRCL_of_YIM(item);
@@ -11856,7 +12455,7 @@ if(previous_source_type!=SOURCE_IS_AMBIGUOUS)
 {
 earley_item_ambiguate(r,item);
 }
-new_link= unique_srcl_new(r->t_obs);
+new_link= unique_srcl_new(YS_Obs_of_R(r));
 new_link->t_next= LV_First_Token_SRCL_of_YIM(item);
 new_link->t_source.t_predecessor= predecessor;
 NSYID_of_Source(new_link->t_source)= NSYID_of_ALT(alternative);
@@ -11864,8 +12463,8 @@ Value_of_Source(new_link->t_source)= Value_of_ALT(alternative);
 LV_First_Token_SRCL_of_YIM(item)= new_link;
 }
 
-/*:694*//*695:*/
-#line 7431 "./marpa.w"
+/*:723*//*724:*/
+#line 7859 "./marpa.w"
 
 PRIVATE
 void
@@ -11876,6 +12475,22 @@ YIM cause)
 {
 SRCL new_link;
 unsigned int previous_source_type= Source_Type_of_YIM(item);
+if(R_is_Link_Free(r))
+{
+/*860:*/
+#line 10203 "./marpa.w"
+
+if(previous_source_type==NO_SOURCE)
+{
+Source_Type_of_YIM(item)= SOURCE_IS_AMBIGUOUS;
+LV_First_Leo_SRCL_of_YIM(item)= NULL;
+}
+
+/*:860*/
+#line 7871 "./marpa.w"
+
+return;
+}
 if(previous_source_type==NO_SOURCE)
 {
 const SRCL source_link= SRCL_of_YIM(item);
@@ -11889,15 +12504,15 @@ if(previous_source_type!=SOURCE_IS_AMBIGUOUS)
 {
 earley_item_ambiguate(r,item);
 }
-new_link= unique_srcl_new(r->t_obs);
+new_link= unique_srcl_new(YS_Obs_of_R(r));
 new_link->t_next= LV_First_Completion_SRCL_of_YIM(item);
 new_link->t_source.t_predecessor= predecessor;
 Cause_of_Source(new_link->t_source)= cause;
 LV_First_Completion_SRCL_of_YIM(item)= new_link;
 }
 
-/*:695*//*696:*/
-#line 7461 "./marpa.w"
+/*:724*//*725:*/
+#line 7894 "./marpa.w"
 
 PRIVATE void
 leo_link_add(RECCE r,
@@ -11907,6 +12522,22 @@ YIM cause)
 {
 SRCL new_link;
 unsigned int previous_source_type= Source_Type_of_YIM(item);
+if(R_is_Link_Free(r))
+{
+/*860:*/
+#line 10203 "./marpa.w"
+
+if(previous_source_type==NO_SOURCE)
+{
+Source_Type_of_YIM(item)= SOURCE_IS_AMBIGUOUS;
+LV_First_Leo_SRCL_of_YIM(item)= NULL;
+}
+
+/*:860*/
+#line 7905 "./marpa.w"
+
+previous_source_type= SOURCE_IS_AMBIGUOUS;
+}
 if(previous_source_type==NO_SOURCE)
 {
 const SRCL source_link= SRCL_of_YIM(item);
@@ -11920,15 +12551,15 @@ if(previous_source_type!=SOURCE_IS_AMBIGUOUS)
 {
 earley_item_ambiguate(r,item);
 }
-new_link= unique_srcl_new(r->t_obs);
+new_link= unique_srcl_new(YS_Obs_of_R(r));
 new_link->t_next= LV_First_Leo_SRCL_of_YIM(item);
 new_link->t_source.t_predecessor= predecessor;
 Cause_of_Source(new_link->t_source)= cause;
 LV_First_Leo_SRCL_of_YIM(item)= new_link;
 }
 
-/*:696*//*698:*/
-#line 7510 "./marpa.w"
+/*:725*//*727:*/
+#line 7948 "./marpa.w"
 
 PRIVATE_NOT_INLINE
 void earley_item_ambiguate(struct marpa_r*r,YIM item)
@@ -11937,53 +12568,53 @@ unsigned int previous_source_type= Source_Type_of_YIM(item);
 Source_Type_of_YIM(item)= SOURCE_IS_AMBIGUOUS;
 switch(previous_source_type)
 {
-case SOURCE_IS_TOKEN:/*699:*/
-#line 7527 "./marpa.w"
+case SOURCE_IS_TOKEN:/*728:*/
+#line 7965 "./marpa.w"
 {
-SRCL new_link= marpa_obs_new(r->t_obs,SRCL_Object,1);
+SRCL new_link= marpa_obs_new(YS_Obs_of_R(r),SRCL_Object,1);
 *new_link= *SRCL_of_YIM(item);
 LV_First_Leo_SRCL_of_YIM(item)= NULL;
 LV_First_Completion_SRCL_of_YIM(item)= NULL;
 LV_First_Token_SRCL_of_YIM(item)= new_link;
 }
 
-/*:699*/
-#line 7518 "./marpa.w"
+/*:728*/
+#line 7956 "./marpa.w"
 
 return;
-case SOURCE_IS_COMPLETION:/*700:*/
-#line 7535 "./marpa.w"
+case SOURCE_IS_COMPLETION:/*729:*/
+#line 7973 "./marpa.w"
 {
-SRCL new_link= marpa_obs_new(r->t_obs,SRCL_Object,1);
+SRCL new_link= marpa_obs_new(YS_Obs_of_R(r),SRCL_Object,1);
 *new_link= *SRCL_of_YIM(item);
 LV_First_Leo_SRCL_of_YIM(item)= NULL;
 LV_First_Completion_SRCL_of_YIM(item)= new_link;
 LV_First_Token_SRCL_of_YIM(item)= NULL;
 }
 
-/*:700*/
-#line 7520 "./marpa.w"
+/*:729*/
+#line 7958 "./marpa.w"
 
 return;
-case SOURCE_IS_LEO:/*701:*/
-#line 7543 "./marpa.w"
+case SOURCE_IS_LEO:/*730:*/
+#line 7981 "./marpa.w"
 {
-SRCL new_link= marpa_obs_new(r->t_obs,SRCL_Object,1);
+SRCL new_link= marpa_obs_new(YS_Obs_of_R(r),SRCL_Object,1);
 *new_link= *SRCL_of_YIM(item);
 LV_First_Leo_SRCL_of_YIM(item)= new_link;
 LV_First_Completion_SRCL_of_YIM(item)= NULL;
 LV_First_Token_SRCL_of_YIM(item)= NULL;
 }
 
-/*:701*/
-#line 7522 "./marpa.w"
+/*:730*/
+#line 7960 "./marpa.w"
 
 return;
 }
 }
 
-/*:698*//*708:*/
-#line 7586 "./marpa.w"
+/*:727*//*737:*/
+#line 8024 "./marpa.w"
 
 PRIVATE int
 alternative_insertion_point(RECCE r,ALT new_alternative)
@@ -12017,8 +12648,8 @@ return outcome> 0?trial+1:trial;
 }
 }
 
-/*:708*//*710:*/
-#line 7630 "./marpa.w"
+/*:737*//*739:*/
+#line 8068 "./marpa.w"
 
 PRIVATE int alternative_cmp(const ALT_Const a,const ALT_Const b)
 {
@@ -12029,8 +12660,8 @@ if(subkey)return subkey;
 return Start_Earleme_of_ALT(a)-Start_Earleme_of_ALT(b);
 }
 
-/*:710*//*711:*/
-#line 7647 "./marpa.w"
+/*:739*//*740:*/
+#line 8085 "./marpa.w"
 
 PRIVATE ALT alternative_pop(RECCE r,JEARLEME earleme)
 {
@@ -12050,8 +12681,8 @@ return NULL;
 return MARPA_DSTACK_POP(*alternatives,ALT_Object);
 }
 
-/*:711*//*713:*/
-#line 7674 "./marpa.w"
+/*:740*//*742:*/
+#line 8112 "./marpa.w"
 
 PRIVATE int alternative_insert(RECCE r,ALT new_alternative)
 {
@@ -12074,8 +12705,8 @@ base_of_stack[insertion_point]= *new_alternative;
 return insertion_point;
 }
 
-/*:713*//*714:*/
-#line 7697 "./marpa.w"
+/*:742*//*743:*/
+#line 8135 "./marpa.w"
 int marpa_r_start_input(Marpa_Recognizer r)
 {
 int return_value= 1;
@@ -12085,44 +12716,43 @@ YIK_Object key;
 IRL start_irl;
 AHM start_ahm;
 
-/*563:*/
-#line 6125 "./marpa.w"
+/*585:*/
+#line 6448 "./marpa.w"
 
 const GRAMMAR g= G_of_R(r);
-/*:563*/
-#line 7706 "./marpa.w"
+/*:585*/
+#line 8144 "./marpa.w"
 
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 8145 "./marpa.w"
 
-/*:1313*/
-#line 7707 "./marpa.w"
 
-
-/*1329:*/
-#line 15733 "./marpa.w"
+/*1517:*/
+#line 19489 "./marpa.w"
 
 if(_MARPA_UNLIKELY(Input_Phase_of_R(r)!=R_BEFORE_INPUT)){
 MARPA_ERROR(MARPA_ERR_RECCE_STARTED);
 return failure_indicator;
 }
-/*:1329*/
-#line 7709 "./marpa.w"
+/*:1517*/
+#line 8147 "./marpa.w"
 
 {
-/*716:*/
-#line 7827 "./marpa.w"
+/*745:*/
+#line 8273 "./marpa.w"
 
 const NSYID nsy_count= NSY_Count_of_G(g);
 const NSYID xsy_count= XSY_Count_of_G(g);
-Bit_Vector bv_ok_for_chain= bv_create(nsy_count);
-/*:716*/
-#line 7711 "./marpa.w"
+Bit_Vector bv_ok_for_chain= bv_create(Allocator_of_G(g),nsy_count);
+/*:745*/
+#line 8149 "./marpa.w"
 
 Current_Earleme_of_R(r)= 0;
-/*722:*/
-#line 7869 "./marpa.w"
+/*773:*/
+#line 8742 "./marpa.w"
 
 {
 XSYID xsy_id;
@@ -12157,8 +12787,8 @@ lbv_bit_set(r->t_unvalued_terminal,xsy_id);
 }
 }
 
-/*:722*/
-#line 7713 "./marpa.w"
+/*:773*/
+#line 8151 "./marpa.w"
 
 G_EVENTS_CLEAR(g);
 
@@ -12168,8 +12798,8 @@ First_YS_of_R(r)= set0;
 
 if(G_is_Trivial(g)){
 return_value+= trigger_trivial_events(r);
-/*614:*/
-#line 6625 "./marpa.w"
+/*638:*/
+#line 6958 "./marpa.w"
 
 {
 R_is_Exhausted(r)= 1;
@@ -12177,46 +12807,46 @@ Input_Phase_of_R(r)= R_AFTER_INPUT;
 event_new(g,MARPA_EVENT_EXHAUSTED);
 }
 
-/*:614*/
-#line 7722 "./marpa.w"
+/*:638*/
+#line 8160 "./marpa.w"
 
 goto CLEANUP;
 }
 Input_Phase_of_R(r)= R_DURING_INPUT;
 psar_reset(Dot_PSAR_of_R(r));
-/*775:*/
-#line 8735 "./marpa.w"
+/*944:*/
+#line 12051 "./marpa.w"
 
 r->t_bv_lim_symbols= bv_obs_create(r->t_obs,nsy_count);
 r->t_bv_pim_symbols= bv_obs_create(r->t_obs,nsy_count);
 r->t_pim_workarea= marpa_obs_new(r->t_obs,void*,nsy_count);
-/*:775*//*794:*/
-#line 9017 "./marpa.w"
+/*:944*//*963:*/
+#line 12333 "./marpa.w"
 
 r->t_lim_chain= marpa_obs_new(r->t_obs,void*,2*nsy_count);
-/*:794*/
-#line 7727 "./marpa.w"
+/*:963*/
+#line 8165 "./marpa.w"
 
-/*731:*/
-#line 8077 "./marpa.w"
+/*782:*/
+#line 8952 "./marpa.w"
 
 {
 if(!MARPA_DSTACK_IS_INITIALIZED(r->t_yim_work_stack))
 {
-MARPA_DSTACK_INIT2(r->t_yim_work_stack,YIM);
+MARPA_DSTACK_INIT2(r->t_yim_work_stack,YIM,Allocator_of_G(g));
 }
 }
-/*:731*//*735:*/
-#line 8092 "./marpa.w"
+/*:782*//*786:*/
+#line 8967 "./marpa.w"
 
 {
 if(!MARPA_DSTACK_IS_INITIALIZED(r->t_completion_stack))
 {
-MARPA_DSTACK_INIT2(r->t_completion_stack,YIM);
+MARPA_DSTACK_INIT2(r->t_completion_stack,YIM,Allocator_of_G(g));
 }
 }
-/*:735*/
-#line 7728 "./marpa.w"
+/*:786*/
+#line 8166 "./marpa.w"
 
 
 start_irl= g->t_start_irl;
@@ -12232,6 +12862,7 @@ earley_item_create(r,key);
 
 bv_clear(r->t_bv_irl_seen);
 bv_bit_set(r->t_bv_irl_seen,ID_of_IRL(start_irl));
+predicted_ahms_init(r);
 MARPA_DSTACK_CLEAR(r->t_irl_cil_stack);
 *MARPA_DSTACK_PUSH(r->t_irl_cil_stack,CIL)= LHS_CIL_of_AHM(start_ahm);
 
@@ -12254,6 +12885,13 @@ const AHM prediction_ahm= First_AHM_of_IRL(prediction_irl);
 
 
 
+
+if(bv_bit_test(r->t_bv_ahm_predicted,
+ID_of_AHM(prediction_ahm)))
+continue;
+
+
+
 if(!evaluate_zwas(r,0,prediction_ahm))continue;
 key.t_ahm= prediction_ahm;
 earley_item_create(r,key);
@@ -12269,20 +12907,20 @@ earley_set_update_items(r,set0);
 r->t_is_using_leo= r->t_use_leo_flag;
 trigger_events(r);
 CLEANUP:;
-/*717:*/
-#line 7831 "./marpa.w"
+/*746:*/
+#line 8277 "./marpa.w"
 
-bv_free(bv_ok_for_chain);
+bv_free(Allocator_of_G(g),bv_ok_for_chain);
 
-/*:717*/
-#line 7780 "./marpa.w"
+/*:746*/
+#line 8226 "./marpa.w"
 
 }
 return return_value;
 }
 
-/*:714*//*715:*/
-#line 7785 "./marpa.w"
+/*:743*//*744:*/
+#line 8231 "./marpa.w"
 
 PRIVATE
 int evaluate_zwas(RECCE r,YSID ysid,AHM ahm)
@@ -12325,32 +12963,439 @@ return 1;
 }
 
 
-/*:715*//*723:*/
-#line 7909 "./marpa.w"
+/*:744*//*753:*/
+#line 8340 "./marpa.w"
 
-Marpa_Earleme marpa_r_alternative(
-Marpa_Recognizer r,
-Marpa_Symbol_ID tkn_xsy_id,
-int value,
-int length)
+int marpa_r_reset(Marpa_Recognizer r)
 {
-/*563:*/
-#line 6125 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
+const int failure_indicator= -2;
+/*:1500*/
+#line 8343 "./marpa.w"
+
+/*585:*/
+#line 6448 "./marpa.w"
 
 const GRAMMAR g= G_of_R(r);
-/*:563*/
-#line 7916 "./marpa.w"
+/*:585*/
+#line 8344 "./marpa.w"
 
-YS current_earley_set;
-const JEARLEME current_earleme= Current_Earleme_of_R(r);
-JEARLEME target_earleme;
-NSYID tkn_nsyid;
-if(_MARPA_UNLIKELY(!R_is_Consistent(r)))
-{
-MARPA_ERROR(MARPA_ERR_RECCE_IS_INCONSISTENT);
-return MARPA_ERR_RECCE_IS_INCONSISTENT;
-}
-if(_MARPA_UNLIKELY(Input_Phase_of_R(r)!=R_DURING_INPUT))
+/*1521:*/
+#line 19518 "./marpa.w"
+
+if(HEADER_VERSION_MISMATCH){
+MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
+return failure_indicator;
+}
+if(_MARPA_UNLIKELY(!IS_G_OK(g))){
+MARPA_ERROR(g->t_error);
+return failure_indicator;
+}
+
+/*:1521*/
+#line 8345 "./marpa.w"
+
+{
+const unsigned int next_generation= R_Generation(r)+1;
+if(next_generation> UINT_MAX-42)
+{
+MARPA_ERROR(MARPA_ERR_DEVELOPMENT);
+return failure_indicator;
+}
+R_Generation(r)= next_generation;
+}
+/*999:*/
+#line 12955 "./marpa.w"
+
+r->t_current_report_item= &progress_report_not_ready;
+if(r->t_progress_report_traverser){
+_marpa_avl_destroy(MARPA_TREE_OF_AVL_TRAV(r->t_progress_report_traverser));
+}
+r->t_progress_report_traverser= NULL;
+/*:999*/
+#line 8355 "./marpa.w"
+
+
+
+
+if(!G_is_Trivial(g)){
+psar_clear(Dot_PSAR_of_R(r));
+}
+/*754:*/
+#line 8371 "./marpa.w"
+
+{
+ZWAID zwaid;
+const int zwa_count= ZWA_Count_of_R(r);
+bv_clear(r->t_bv_lookahead);
+Input_Phase_of_R(r)= R_BEFORE_INPUT;
+First_YS_of_R(r)= NULL;
+Latest_YS_of_R(r)= NULL;
+Current_Earleme_of_R(r)= -1;
+Furthest_Earleme_of_R(r)= 0;
+YS_Count_of_R(r)= 0;
+bv_clear(r->t_bv_nsyid_is_expected);
+r->t_is_using_leo= 0;
+R_is_Exhausted(r)= 0;
+First_Inconsistent_YS_of_R(r)= -1;
+for(zwaid= 0;zwaid<zwa_count;zwaid++)
+{
+const ZWA zwa= RZWA_by_ID(zwaid);
+Memo_Value_of_ZWA(zwa)= Default_Value_of_ZWA(zwa);
+Memo_YSID_of_ZWA(zwa)= -1;
+}
+MARPA_DSTACK_CLEAR(r->t_alternatives);
+MARPA_DSTACK_CLEAR(r->t_irl_cil_stack);
+MARPA_DSTACK_CLEAR(r->t_yim_work_stack);
+MARPA_DSTACK_CLEAR(r->t_completion_stack);
+MARPA_DSTACK_CLEAR(r->t_earley_set_stack);
+MARPA_DSTACK_CLEAR(r->t_checkpoints);
+ur_node_stack_reset(URS_of_R(r));
+r->t_trace_earley_set= NULL;
+r->t_trace_earley_item= NULL;
+r->t_trace_pim_nsy_p= NULL;
+r->t_trace_postdot_item= NULL;
+r->t_trace_source_link= NULL;
+r->t_trace_source_type= NO_SOURCE;
+}
+
+/*:754*//*826:*/
+#line 9716 "./marpa.w"
+ys_batches_free(r);
+
+/*:826*//*837:*/
+#line 9829 "./marpa.w"
+
+r->t_next_forget_ysid= YS_FORGET_INTERVAL;
+
+/*:837*/
+#line 8362 "./marpa.w"
+
+marpa_obs_rewind(r->t_obs,&r->t_reset_mark);
+return 1;
+}
+
+/*:753*//*764:*/
+#line 8500 "./marpa.w"
+
+Marpa_Earley_Set_ID marpa_r_checkpoint(Marpa_Recognizer r)
+{
+/*1500:*/
+#line 19380 "./marpa.w"
+const int failure_indicator= -2;
+/*:1500*/
+#line 8503 "./marpa.w"
+
+/*585:*/
+#line 6448 "./marpa.w"
+
+const GRAMMAR g= G_of_R(r);
+/*:585*/
+#line 8504 "./marpa.w"
+
+const int xsy_count= XSY_Count_of_G(g);
+CHECKPOINT checkpoint;
+CHECKPOINT previous= NULL;
+YS latest_ys;
+int checkpoint_count;
+int alternative_count;
+/*1521:*/
+#line 19518 "./marpa.w"
+
+if(HEADER_VERSION_MISMATCH){
+MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
+return failure_indicator;
+}
+if(_MARPA_UNLIKELY(!IS_G_OK(g))){
+MARPA_ERROR(g->t_error);
+return failure_indicator;
+}
+
+/*:1521*/
+#line 8511 "./marpa.w"
+
+/*1518:*/
+#line 19494 "./marpa.w"
+
+if(_MARPA_UNLIKELY(Input_Phase_of_R(r)==R_BEFORE_INPUT)){
+MARPA_ERROR(MARPA_ERR_RECCE_NOT_STARTED);
+return failure_indicator;
+}
+/*:1518*/
+#line 8512 "./marpa.w"
+
+/*819:*/
+#line 9668 "./marpa.w"
+
+if(_MARPA_UNLIKELY(R_is_Forgetful(r))){
+MARPA_ERROR(MARPA_ERR_RECCE_IS_FORGETFUL);
+return failure_indicator;
+}
+
+/*:819*/
+#line 8513 "./marpa.w"
+
+latest_ys= Latest_YS_of_R(r);
+checkpoint= MARPA_DSTACK_TOP(r->t_checkpoints,CHECKPOINT_Object);
+if(checkpoint&&checkpoint->t_latest_ys==latest_ys)
+{
+marpa_obs_rewind(r->t_obs,&checkpoint->t_copy_mark);
+}
+else
+{
+checkpoint= MARPA_DSTACK_PUSH(r->t_checkpoints,CHECKPOINT_Object);
+}
+checkpoint_count= MARPA_DSTACK_LENGTH(r->t_checkpoints);
+if(checkpoint_count>=2)
+{
+previous= 
+MARPA_DSTACK_INDEX(r->t_checkpoints,CHECKPOINT_Object,
+checkpoint_count-2);
+}
+marpa_obs_mark(r->t_obs,&checkpoint->t_copy_mark);
+checkpoint->t_latest_ys= latest_ys;
+checkpoint->t_current_earleme= Current_Earleme_of_R(r);
+checkpoint->t_furthest_earleme= Furthest_Earleme_of_R(r);
+checkpoint->t_input_phase= Input_Phase_of_R(r);
+checkpoint->t_is_exhausted= R_is_Exhausted(r);
+if(previous
+&&bv_is_equal(previous->t_bv_nsyid_is_expected,
+r->t_bv_nsyid_is_expected))
+{
+checkpoint->t_bv_nsyid_is_expected= previous->t_bv_nsyid_is_expected;
+}
+else
+{
+checkpoint->t_bv_nsyid_is_expected= 
+bv_obs_clone(r->t_obs,r->t_bv_nsyid_is_expected);
+}
+checkpoint->t_valued_change_count= r->t_valued_change_count;
+if(previous
+&&previous->t_valued_change_count==r->t_valued_change_count)
+{
+checkpoint->t_valued_terminal= previous->t_valued_terminal;
+checkpoint->t_unvalued_terminal= previous->t_unvalued_terminal;
+checkpoint->t_valued= previous->t_valued;
+checkpoint->t_unvalued= previous->t_unvalued;
+checkpoint->t_valued_locked= previous->t_valued_locked;
+}
+else
+{
+checkpoint->t_valued_terminal= 
+lbv_clone(r->t_obs,r->t_valued_terminal,xsy_count);
+checkpoint->t_unvalued_terminal= 
+lbv_clone(r->t_obs,r->t_unvalued_terminal,xsy_count);
+checkpoint->t_valued= lbv_clone(r->t_obs,r->t_valued,xsy_count);
+checkpoint->t_unvalued= lbv_clone(r->t_obs,r->t_unvalued,xsy_count);
+checkpoint->t_valued_locked= 
+lbv_clone(r->t_obs,r->t_valued_locked,xsy_count);
+}
+alternative_count= MARPA_DSTACK_LENGTH(r->t_alternatives);
+checkpoint->t_alternative_count= alternative_count;
+checkpoint->t_alternatives= NULL;
+if(alternative_count> 0)
+{
+int alt_ix;
+const ALT alternatives= 
+MARPA_DSTACK_BASE(r->t_alternatives,ALT_Object);
+checkpoint->t_alternatives= 
+marpa_obs_new(r->t_obs,ALT_Object,alternative_count);
+for(alt_ix= 0;alt_ix<alternative_count;alt_ix++)
+{
+checkpoint->t_alternatives[alt_ix]= alternatives[alt_ix];
+}
+}
+marpa_obs_mark(r->t_obs,&checkpoint->t_mark);
+return Ord_of_YS(latest_ys);
+}
+
+/*:764*//*765:*/
+#line 8601 "./marpa.w"
+
+Marpa_Earley_Set_ID
+marpa_r_rollback(Marpa_Recognizer r,Marpa_Earley_Set_ID ysid)
+{
+/*1500:*/
+#line 19380 "./marpa.w"
+const int failure_indicator= -2;
+/*:1500*/
+#line 8605 "./marpa.w"
+
+/*585:*/
+#line 6448 "./marpa.w"
+
+const GRAMMAR g= G_of_R(r);
+/*:585*/
+#line 8606 "./marpa.w"
+
+CHECKPOINT checkpoint= NULL;
+int checkpoint_ix;
+/*1521:*/
+#line 19518 "./marpa.w"
+
+if(HEADER_VERSION_MISMATCH){
+MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
+return failure_indicator;
+}
+if(_MARPA_UNLIKELY(!IS_G_OK(g))){
+MARPA_ERROR(g->t_error);
+return failure_indicator;
+}
+
+/*:1521*/
+#line 8609 "./marpa.w"
+
+/*1518:*/
+#line 19494 "./marpa.w"
+
+if(_MARPA_UNLIKELY(Input_Phase_of_R(r)==R_BEFORE_INPUT)){
+MARPA_ERROR(MARPA_ERR_RECCE_NOT_STARTED);
+return failure_indicator;
+}
+/*:1518*/
+#line 8610 "./marpa.w"
+
+for(checkpoint_ix= MARPA_DSTACK_LENGTH(r->t_checkpoints)-1;
+checkpoint_ix>=0;checkpoint_ix--)
+{
+checkpoint= 
+MARPA_DSTACK_INDEX(r->t_checkpoints,CHECKPOINT_Object,
+checkpoint_ix);
+if(Ord_of_YS(checkpoint->t_latest_ys)<=ysid)
+break;
+}
+if(_MARPA_UNLIKELY(checkpoint_ix<0
+||Ord_of_YS(checkpoint->t_latest_ys)!=ysid))
+{
+MARPA_ERROR(MARPA_ERR_NO_SUCH_CHECKPOINT);
+return failure_indicator;
+}
+{
+const unsigned int next_generation= R_Generation(r)+1;
+if(next_generation> UINT_MAX-42)
+{
+MARPA_ERROR(MARPA_ERR_DEVELOPMENT);
+return failure_indicator;
+}
+R_Generation(r)= next_generation;
+}
+/*999:*/
+#line 12955 "./marpa.w"
+
+r->t_current_report_item= &progress_report_not_ready;
+if(r->t_progress_report_traverser){
+_marpa_avl_destroy(MARPA_TREE_OF_AVL_TRAV(r->t_progress_report_traverser));
+}
+r->t_progress_report_traverser= NULL;
+/*:999*/
+#line 8635 "./marpa.w"
+
+/*1558:*/
+#line 20038 "./marpa.w"
+{
+r->t_trace_earley_set= NULL;
+trace_earley_item_clear(r);
+/*1570:*/
+#line 20227 "./marpa.w"
+
+r->t_trace_pim_nsy_p= NULL;
+r->t_trace_postdot_item= NULL;
+
+/*:1570*/
+#line 20041 "./marpa.w"
+
+}
+
+/*:1558*/
+#line 8636 "./marpa.w"
+
+
+
+
+if(!G_is_Trivial(g))
+{
+psar_clear(Dot_PSAR_of_R(r));
+}
+G_EVENTS_CLEAR(g);
+/*766:*/
+#line 8659 "./marpa.w"
+
+{
+ZWAID zwaid;
+int alt_ix;
+const int zwa_count= ZWA_Count_of_R(r);
+const int xsy_count= XSY_Count_of_G(g);
+const YS latest_ys= checkpoint->t_latest_ys;
+Next_YS_of_YS(latest_ys)= NULL;
+Latest_YS_of_R(r)= latest_ys;
+YS_Count_of_R(r)= Ord_of_YS(latest_ys)+1;
+Current_Earleme_of_R(r)= checkpoint->t_current_earleme;
+Furthest_Earleme_of_R(r)= checkpoint->t_furthest_earleme;
+Input_Phase_of_R(r)= checkpoint->t_input_phase;
+R_is_Exhausted(r)= checkpoint->t_is_exhausted;
+bv_copy(r->t_bv_nsyid_is_expected,checkpoint->t_bv_nsyid_is_expected);
+lbv_copy(r->t_valued_terminal,checkpoint->t_valued_terminal,xsy_count);
+lbv_copy(r->t_unvalued_terminal,checkpoint->t_unvalued_terminal,
+xsy_count);
+lbv_copy(r->t_valued,checkpoint->t_valued,xsy_count);
+lbv_copy(r->t_unvalued,checkpoint->t_unvalued,xsy_count);
+lbv_copy(r->t_valued_locked,checkpoint->t_valued_locked,xsy_count);
+r->t_valued_change_count= checkpoint->t_valued_change_count;
+MARPA_DSTACK_CLEAR(r->t_alternatives);
+for(alt_ix= 0;alt_ix<checkpoint->t_alternative_count;alt_ix++)
+{
+*MARPA_DSTACK_PUSH(r->t_alternatives,ALT_Object)= 
+checkpoint->t_alternatives[alt_ix];
+}
+if(MARPA_DSTACK_LENGTH(r->t_earley_set_stack)> YS_Count_of_R(r))
+{
+MARPA_DSTACK_COUNT_SET(r->t_earley_set_stack,YS_Count_of_R(r));
+}
+for(zwaid= 0;zwaid<zwa_count;zwaid++)
+{
+const ZWA zwa= RZWA_by_ID(zwaid);
+Memo_YSID_of_ZWA(zwa)= -1;
+}
+MARPA_DSTACK_CLEAR(r->t_yim_work_stack);
+MARPA_DSTACK_CLEAR(r->t_completion_stack);
+ur_node_stack_reset(URS_of_R(r));
+}
+
+/*:766*/
+#line 8645 "./marpa.w"
+
+marpa_obs_rewind(r->t_obs,&checkpoint->t_mark);
+MARPA_DSTACK_COUNT_SET(r->t_checkpoints,checkpoint_ix+1);
+return ysid;
+}
+
+/*:765*//*774:*/
+#line 8782 "./marpa.w"
+
+Marpa_Earleme marpa_r_alternative(
+Marpa_Recognizer r,
+Marpa_Symbol_ID tkn_xsy_id,
+int value,
+int length)
+{
+/*585:*/
+#line 6448 "./marpa.w"
+
+const GRAMMAR g= G_of_R(r);
+/*:585*/
+#line 8789 "./marpa.w"
+
+YS current_earley_set;
+const JEARLEME current_earleme= Current_Earleme_of_R(r);
+JEARLEME target_earleme;
+NSYID tkn_nsyid;
+if(_MARPA_UNLIKELY(!R_is_Consistent(r)))
+{
+MARPA_ERROR(MARPA_ERR_RECCE_IS_INCONSISTENT);
+return MARPA_ERR_RECCE_IS_INCONSISTENT;
+}
+if(_MARPA_UNLIKELY(Input_Phase_of_R(r)!=R_DURING_INPUT))
 {
 MARPA_ERROR(MARPA_ERR_RECCE_NOT_ACCEPTING_INPUT);
 return MARPA_ERR_RECCE_NOT_ACCEPTING_INPUT;
@@ -12365,8 +13410,8 @@ if(_MARPA_UNLIKELY(!XSYID_of_G_Exists(tkn_xsy_id)))
 MARPA_ERROR(MARPA_ERR_NO_SUCH_SYMBOL_ID);
 return MARPA_ERR_NO_SUCH_SYMBOL_ID;
 }
-/*724:*/
-#line 7948 "./marpa.w"
+/*775:*/
+#line 8821 "./marpa.w"
 {
 const XSY_Const tkn= XSY_by_ID(tkn_xsy_id);
 if(length<=0){
@@ -12390,6 +13435,7 @@ return MARPA_ERR_SYMBOL_VALUED_CONFLICT;
 lbv_bit_set(r->t_valued_locked,tkn_xsy_id);
 lbv_bit_set(r->t_valued_terminal,tkn_xsy_id);
 lbv_bit_set(r->t_valued,tkn_xsy_id);
+r->t_valued_change_count++;
 }
 if(!value&&_MARPA_UNLIKELY(!lbv_bit_test(r->t_unvalued_terminal,tkn_xsy_id)))
 {
@@ -12404,14 +13450,15 @@ return MARPA_ERR_SYMBOL_VALUED_CONFLICT;
 lbv_bit_set(r->t_valued_locked,tkn_xsy_id);
 lbv_bit_set(r->t_unvalued_terminal,tkn_xsy_id);
 lbv_bit_set(r->t_unvalued,tkn_xsy_id);
+r->t_valued_change_count++;
 }
 }
 
-/*:724*/
-#line 7941 "./marpa.w"
+/*:775*/
+#line 8814 "./marpa.w"
 
-/*727:*/
-#line 8008 "./marpa.w"
+/*778:*/
+#line 8883 "./marpa.w"
 
 {
 NSY tkn_nsy= NSY_by_XSYID(tkn_xsy_id);
@@ -12434,11 +13481,11 @@ return MARPA_ERR_UNEXPECTED_TOKEN_ID;
 }
 }
 
-/*:727*/
-#line 7942 "./marpa.w"
+/*:778*/
+#line 8815 "./marpa.w"
 
-/*725:*/
-#line 7988 "./marpa.w"
+/*776:*/
+#line 8863 "./marpa.w"
 {
 target_earleme= current_earleme+length;
 if(target_earleme>=JEARLEME_THRESHOLD){
@@ -12447,11 +13494,11 @@ return MARPA_ERR_PARSE_TOO_LONG;
 }
 }
 
-/*:725*/
-#line 7943 "./marpa.w"
+/*:776*/
+#line 8816 "./marpa.w"
 
-/*728:*/
-#line 8046 "./marpa.w"
+/*779:*/
+#line 8921 "./marpa.w"
 
 {
 ALT_Object alternative_object;
@@ -12472,31 +13519,30 @@ return MARPA_ERR_DUPLICATE_TOKEN;
 }
 }
 
-/*:728*/
-#line 7944 "./marpa.w"
+/*:779*/
+#line 8817 "./marpa.w"
 
 return MARPA_ERR_NONE;
 }
 
-/*:723*//*741:*/
-#line 8123 "./marpa.w"
+/*:774*//*792:*/
+#line 8998 "./marpa.w"
 
 int
 marpa_r_earleme_complete(Marpa_Recognizer r)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 9002 "./marpa.w"
 
-/*:1313*/
-#line 8127 "./marpa.w"
-
-/*563:*/
-#line 6125 "./marpa.w"
+/*585:*/
+#line 6448 "./marpa.w"
 
 const GRAMMAR g= G_of_R(r);
-/*:563*/
-#line 8128 "./marpa.w"
+/*:585*/
+#line 9003 "./marpa.w"
 
 YIM*cause_p;
 YS current_earley_set;
@@ -12508,8 +13554,8 @@ JEARLEME current_earleme;
 
 JEARLEME return_value= -2;
 
-/*1331:*/
-#line 15743 "./marpa.w"
+/*1519:*/
+#line 19499 "./marpa.w"
 
 if(_MARPA_UNLIKELY(Input_Phase_of_R(r)!=R_DURING_INPUT)){
 MARPA_ERROR(MARPA_ERR_RECCE_NOT_ACCEPTING_INPUT);
@@ -12521,37 +13567,58 @@ MARPA_ERROR(MARPA_ERR_RECCE_IS_INCONSISTENT);
 return failure_indicator;
 }
 
-/*:1331*/
-#line 8139 "./marpa.w"
+/*:1519*/
+#line 9014 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!R_is_Consistent(r))){
 MARPA_ERROR(MARPA_ERR_RECCE_IS_INCONSISTENT);
 return failure_indicator;
 }
+if(_MARPA_UNLIKELY(memory_limit_is_exceeded(r,0))){
+MARPA_ERROR(MARPA_ERR_MEMORY_LIMIT);
+return failure_indicator;
+}
 
 {
 int count_of_expected_terminals;
-/*742:*/
-#line 8189 "./marpa.w"
+/*793:*/
+#line 9077 "./marpa.w"
 
 const NSYID nsy_count= NSY_Count_of_G(g);
-Bit_Vector bv_ok_for_chain= bv_create(nsy_count);
-struct marpa_obstack*const earleme_complete_obs= marpa_obs_init;
-/*:742*/
-#line 8147 "./marpa.w"
+Bit_Vector bv_ok_for_chain= bv_create(Allocator_of_G(g),nsy_count);
+struct marpa_obstack*const earleme_complete_obs= 
+marpa_obs_cache_init(Chunk_Cache_of_G(g));
+/*1543:*/
+#line 19805 "./marpa.w"
+
+const YS entry_latest_ys= Latest_YS_of_R(r);
+const JEARLEME entry_earleme= Current_Earleme_of_R(r);
+const int entry_alternative_count= 
+MARPA_DSTACK_LENGTH(r->t_alternatives);
+const YS_BATCH entry_ys_batch= r->t_latest_ys_batch;
+struct marpa_obstack*const entry_ys_obs= YS_Obs_of_R(r);
+struct marpa_obstack_mark entry_mark;
+int memory_check_count= 0;
+
+/*:1543*/
+#line 9082 "./marpa.w"
+
+/*:793*/
+#line 9026 "./marpa.w"
 
 G_EVENTS_CLEAR(g);
 psar_dealloc(Dot_PSAR_of_R(r));
-bv_clear(r->t_bv_nsyid_is_expected);
 bv_clear(r->t_bv_irl_seen);
-/*744:*/
-#line 8197 "./marpa.w"
+marpa_obs_mark(entry_ys_obs,&entry_mark);
+/*795:*/
+#line 9087 "./marpa.w"
 {
 current_earleme= ++(Current_Earleme_of_R(r));
 if(current_earleme> Furthest_Earleme_of_R(r))
 {
-/*614:*/
-#line 6625 "./marpa.w"
+bv_clear(r->t_bv_nsyid_is_expected);
+/*638:*/
+#line 6958 "./marpa.w"
 
 {
 R_is_Exhausted(r)= 1;
@@ -12559,8 +13626,8 @@ Input_Phase_of_R(r)= R_AFTER_INPUT;
 event_new(g,MARPA_EVENT_EXHAUSTED);
 }
 
-/*:614*/
-#line 8201 "./marpa.w"
+/*:638*/
+#line 9092 "./marpa.w"
 
 MARPA_ERROR(MARPA_ERR_PARSE_EXHAUSTED);
 return_value= failure_indicator;
@@ -12568,44 +13635,49 @@ goto CLEANUP;
 }
 }
 
-/*:744*/
-#line 8152 "./marpa.w"
+/*:795*/
+#line 9031 "./marpa.w"
 
-/*746:*/
-#line 8220 "./marpa.w"
+/*797:*/
+#line 9111 "./marpa.w"
 {
 ALT end_of_stack= MARPA_DSTACK_TOP(r->t_alternatives,ALT_Object);
 if(!end_of_stack||current_earleme!=End_Earleme_of_ALT(end_of_stack))
 {
+
+
+bv_clear(r->t_bv_lookahead);
+bv_clear(r->t_bv_nsyid_is_expected);
 return_value= 0;
 goto CLEANUP;
 }
 }
 
-/*:746*/
-#line 8153 "./marpa.w"
+/*:797*/
+#line 9032 "./marpa.w"
 
-/*745:*/
-#line 8210 "./marpa.w"
+/*796:*/
+#line 9101 "./marpa.w"
 {
 current_earley_set= earley_set_new(r,current_earleme);
 Next_YS_of_YS(Latest_YS_of_R(r))= current_earley_set;
 Latest_YS_of_R(r)= current_earley_set;
 }
 
-/*:745*/
-#line 8154 "./marpa.w"
+/*:796*/
+#line 9033 "./marpa.w"
 
-/*747:*/
-#line 8229 "./marpa.w"
+/*798:*/
+#line 9124 "./marpa.w"
 
 {
 ALT alternative;
 
 
 while((alternative= alternative_pop(r,current_earleme)))
-/*749:*/
-#line 8248 "./marpa.w"
+{
+/*800:*/
+#line 9146 "./marpa.w"
 
 {
 YS start_earley_set= Start_YS_of_ALT(alternative);
@@ -12620,8 +13692,8 @@ if(predecessor&&YIM_is_Active(predecessor))
 {
 const AHM predecessor_ahm= AHM_of_YIM(predecessor);
 const AHM scanned_ahm= Next_AHM_of_AHM(predecessor_ahm);
-/*750:*/
-#line 8267 "./marpa.w"
+/*801:*/
+#line 9165 "./marpa.w"
 
 {
 const YIM scanned_earley_item= earley_item_assign(r,
@@ -12633,23 +13705,39 @@ YIM_was_Scanned(scanned_earley_item)= 1;
 tkn_link_add(r,scanned_earley_item,predecessor,alternative);
 }
 
-/*:750*/
-#line 8262 "./marpa.w"
+/*:801*/
+#line 9160 "./marpa.w"
 
 }
 }
 }
 
-/*:749*/
-#line 8235 "./marpa.w"
+/*:800*/
+#line 9131 "./marpa.w"
+
+/*1544:*/
+#line 19815 "./marpa.w"
+
+{
+if(_MARPA_UNLIKELY(++memory_check_count>=MEMORY_CHECK_INTERVAL))
+{
+memory_check_count= 0;
+if(memory_limit_is_exceeded(r,0))
+goto MEMORY_LIMIT_EXCEEDED;
+}
+}
+
+/*:1544*/
+#line 9132 "./marpa.w"
 
+}
 }
 
-/*:747*/
-#line 8155 "./marpa.w"
+/*:798*/
+#line 9034 "./marpa.w"
 
-/*751:*/
-#line 8283 "./marpa.w"
+/*802:*/
+#line 9181 "./marpa.w"
 {
 
 
@@ -12669,21 +13757,21 @@ end_of_stack= MARPA_DSTACK_PUSH(r->t_completion_stack,YIM);
 }
 }
 
-/*:751*/
-#line 8156 "./marpa.w"
+/*:802*/
+#line 9035 "./marpa.w"
 
 while((cause_p= MARPA_DSTACK_POP(r->t_completion_stack,YIM))){
 YIM cause= *cause_p;
-/*752:*/
-#line 8304 "./marpa.w"
+/*803:*/
+#line 9202 "./marpa.w"
 
 {
 if(YIM_is_Active(cause)&&YIM_is_Completion(cause))
 {
 NSYID complete_nsyid= LHS_NSYID_of_YIM(cause);
 const YS middle= Origin_of_YIM(cause);
-/*753:*/
-#line 8314 "./marpa.w"
+/*804:*/
+#line 9212 "./marpa.w"
 
 {
 PIM postdot_item;
@@ -12705,9 +13793,9 @@ const LIM leo_item= LIM_of_PIM(postdot_item);
 
 if(!LIM_is_Active(leo_item))goto NEXT_PIM;
 
-/*756:*/
-#line 8381 "./marpa.w"
-{
+/*807:*/
+#line 9279 "./marpa.w"
+{
 const YS origin= Origin_of_LIM(leo_item);
 const AHM effect_ahm= Top_AHM_of_LIM(leo_item);
 const YIM effect= earley_item_assign(r,current_earley_set,
@@ -12717,22 +13805,22 @@ if(Earley_Item_has_No_Source(effect))
 {
 
 
-/*755:*/
-#line 8375 "./marpa.w"
+/*806:*/
+#line 9273 "./marpa.w"
 {
 YIM*end_of_stack= MARPA_DSTACK_PUSH(r->t_completion_stack,YIM);
 *end_of_stack= effect;
 }
 
-/*:755*/
-#line 8391 "./marpa.w"
+/*:806*/
+#line 9289 "./marpa.w"
 
 }
 leo_link_add(r,effect,leo_item,cause);
 }
 
-/*:756*/
-#line 8335 "./marpa.w"
+/*:807*/
+#line 9233 "./marpa.w"
 
 
 
@@ -12746,8 +13834,8 @@ if(!YIM_is_Active(predecessor))continue;
 
 
 
-/*754:*/
-#line 8355 "./marpa.w"
+/*805:*/
+#line 9253 "./marpa.w"
 
 {
 const AHM predecessor_ahm= AHM_of_YIM(predecessor);
@@ -12760,23 +13848,23 @@ if(Earley_Item_has_No_Source(effect)){
 
 
 if(YIM_is_Completion(effect)){
-/*755:*/
-#line 8375 "./marpa.w"
+/*806:*/
+#line 9273 "./marpa.w"
 {
 YIM*end_of_stack= MARPA_DSTACK_PUSH(r->t_completion_stack,YIM);
 *end_of_stack= effect;
 }
 
-/*:755*/
-#line 8367 "./marpa.w"
+/*:806*/
+#line 9265 "./marpa.w"
 
 }
 }
 completion_link_add(r,effect,predecessor,cause);
 }
 
-/*:754*/
-#line 8348 "./marpa.w"
+/*:805*/
+#line 9246 "./marpa.w"
 
 }
 NEXT_PIM:;
@@ -12784,45 +13872,67 @@ NEXT_PIM:;
 LAST_PIM:;
 }
 
-/*:753*/
-#line 8310 "./marpa.w"
+/*:804*/
+#line 9208 "./marpa.w"
+
+}
+}
+
+/*:803*/
+#line 9038 "./marpa.w"
+
+/*1544:*/
+#line 19815 "./marpa.w"
 
+{
+if(_MARPA_UNLIKELY(++memory_check_count>=MEMORY_CHECK_INTERVAL))
+{
+memory_check_count= 0;
+if(memory_limit_is_exceeded(r,0))
+goto MEMORY_LIMIT_EXCEEDED;
 }
 }
 
-/*:752*/
-#line 8159 "./marpa.w"
+/*:1544*/
+#line 9039 "./marpa.w"
 
 }
-/*757:*/
-#line 8396 "./marpa.w"
+if(_MARPA_UNLIKELY(memory_limit_is_exceeded(r,0)))
+goto MEMORY_LIMIT_EXCEEDED;
+/*808:*/
+#line 9300 "./marpa.w"
 
 {
 int ix;
 const int no_of_work_earley_items= 
 MARPA_DSTACK_LENGTH(r->t_yim_work_stack);
+const Bit_Vector bv_ahm_predicted= r->t_bv_ahm_predicted;
+YIK_Object key;
+key.t_origin= current_earley_set;
+key.t_set= current_earley_set;
+predicted_ahms_init(r);
 for(ix= 0;ix<no_of_work_earley_items;ix++)
 {
 YIM earley_item= WORK_YIM_ITEM(r,ix);
 
 int cil_ix;
 const AHM ahm= AHM_of_YIM(earley_item);
-const CIL prediction_cil= Predicted_IRL_CIL_of_AHM(ahm);
-const int prediction_count= Count_of_CIL(prediction_cil);
+const CIL bundle= Prediction_Bundle_of_AHM(ahm);
+const int prediction_count= Count_of_CIL(bundle);
 for(cil_ix= 0;cil_ix<prediction_count;cil_ix++)
 {
-const IRLID prediction_irlid= Item_of_CIL(prediction_cil,cil_ix);
-const IRL prediction_irl= IRL_by_ID(prediction_irlid);
-const AHM prediction_ahm= First_AHM_of_IRL(prediction_irl);
-earley_item_assign(r,current_earley_set,current_earley_set,
-prediction_ahm);
+const AHMID prediction_ahmid= Item_of_CIL(bundle,cil_ix);
+if(bv_bit_test_then_set(bv_ahm_predicted,prediction_ahmid))
+continue;
+key.t_ahm= AHM_by_ID(prediction_ahmid);
+earley_item_create(r,key);
 }
 
 }
 }
 
-/*:757*/
-#line 8161 "./marpa.w"
+/*:808*/
+#line 9043 "./marpa.w"
 
 postdot_items_create(r,bv_ok_for_chain,current_earley_set);
 
@@ -12834,8 +13944,8 @@ count_of_expected_terminals= bv_count(r->t_bv_nsyid_is_expected);
 if(count_of_expected_terminals<=0
 &&MARPA_DSTACK_LENGTH(r->t_alternatives)<=0)
 {
-/*614:*/
-#line 6625 "./marpa.w"
+/*638:*/
+#line 6958 "./marpa.w"
 
 {
 R_is_Exhausted(r)= 1;
@@ -12843,13 +13953,13 @@ Input_Phase_of_R(r)= R_AFTER_INPUT;
 event_new(g,MARPA_EVENT_EXHAUSTED);
 }
 
-/*:614*/
-#line 8172 "./marpa.w"
+/*:638*/
+#line 9054 "./marpa.w"
 
 }
 earley_set_update_items(r,current_earley_set);
-/*659:*/
-#line 7064 "./marpa.w"
+/*688:*/
+#line 7487 "./marpa.w"
 
 {
 const int yim_count= YIM_Count_of_YS(current_earley_set);
@@ -12859,29 +13969,92 @@ int_event_new(g,MARPA_EVENT_EARLEY_ITEM_THRESHOLD,yim_count);
 }
 }
 
-/*:659*/
-#line 8175 "./marpa.w"
+/*:688*/
+#line 9057 "./marpa.w"
 
 if(r->t_active_event_count> 0){
 trigger_events(r);
 }
+/*838:*/
+#line 9832 "./marpa.w"
+
+{
+if(R_is_Forgetful(r)&&YS_Count_of_R(r)>=r->t_next_forget_ysid)
+{
+earley_sets_forget(r);
+}
+}
+
+/*:838*/
+#line 9061 "./marpa.w"
+
 return_value= G_EVENT_COUNT(g);
+goto CLEANUP;
+MEMORY_LIMIT_EXCEEDED:;
+/*1545:*/
+#line 19830 "./marpa.w"
+
+{
+
+
+
+psar_clear(Dot_PSAR_of_R(r));
+Next_YS_of_YS(entry_latest_ys)= NULL;
+Latest_YS_of_R(r)= entry_latest_ys;
+YS_Count_of_R(r)= Ord_of_YS(entry_latest_ys)+1;
+Current_Earleme_of_R(r)= entry_earleme;
+MARPA_DSTACK_COUNT_SET(r->t_alternatives,entry_alternative_count);
+if(MARPA_DSTACK_LENGTH(r->t_earley_set_stack)> YS_Count_of_R(r))
+{
+MARPA_DSTACK_COUNT_SET(r->t_earley_set_stack,YS_Count_of_R(r));
+}
+if(r->t_latest_ys_batch!=entry_ys_batch)
+{
+marpa_obs_free(YS_Obs_of_R(r));
+if(entry_ys_batch)
+{
+entry_ys_batch->t_next= NULL;
+}
+else
+{
+r->t_first_ys_batch= NULL;
+}
+r->t_latest_ys_batch= entry_ys_batch;
+YS_Obs_of_R(r)= entry_ys_obs;
+YS_Batch_is_Closed(r)= 1;
+}
+else
+{
+marpa_obs_rewind(YS_Obs_of_R(r),&entry_mark);
+marpa_obs_spares_free(YS_Obs_of_R(r));
+}
+MARPA_DSTACK_DESTROY(r->t_yim_work_stack);
+MARPA_DSTACK_INIT2(r->t_yim_work_stack,YIM,Allocator_of_G(g));
+MARPA_DSTACK_DESTROY(r->t_completion_stack);
+MARPA_DSTACK_INIT2(r->t_completion_stack,YIM,Allocator_of_G(g));
+}
+
+/*:1545*/
+#line 9065 "./marpa.w"
+
+MARPA_ERROR(MARPA_ERR_MEMORY_LIMIT);
+return_value= failure_indicator;
 CLEANUP:;
-/*743:*/
-#line 8193 "./marpa.w"
+/*794:*/
+#line 9083 "./marpa.w"
 
-bv_free(bv_ok_for_chain);
+bv_free(Allocator_of_G(g),bv_ok_for_chain);
 marpa_obs_free(earleme_complete_obs);
 
-/*:743*/
-#line 8181 "./marpa.w"
+/*:794*/
+#line 9069 "./marpa.w"
 
 }
 return return_value;
 }
 
-/*:741*//*758:*/
-#line 8421 "./marpa.w"
+/*:792*//*809:*/
+#line 9330 "./marpa.w"
 
 PRIVATE void trigger_events(RECCE r)
 {
@@ -12889,7 +14062,8 @@ const GRAMMAR g= G_of_R(r);
 const YS current_earley_set= Latest_YS_of_R(r);
 int min,max,start;
 int yim_ix;
-struct marpa_obstack*const trigger_events_obs= marpa_obs_init;
+struct marpa_obstack*const trigger_events_obs= 
+marpa_obs_cache_init(Chunk_Cache_of_G(g));
 const YIM*yims= YIMs_of_YS(current_earley_set);
 const XSYID xsy_count= XSY_Count_of_G(g);
 const int ahm_count= AHM_Count_of_G(g);
@@ -13028,110 +14202,2705 @@ int_event_new(g,MARPA_EVENT_SYMBOL_NULLED,event_xsyid);
 for(start= 0;bv_scan(bv_prediction_event_trigger,start,&min,&max);
 start= max+2)
 {
-XSYID event_xsyid;
-for(event_xsyid= (NSYID)min;event_xsyid<=(NSYID)max;
-event_xsyid++)
+XSYID event_xsyid;
+for(event_xsyid= (NSYID)min;event_xsyid<=(NSYID)max;
+event_xsyid++)
+{
+if(lbv_bit_test
+(r->t_lbv_xsyid_prediction_event_is_active,event_xsyid))
+{
+int_event_new(g,MARPA_EVENT_SYMBOL_PREDICTED,event_xsyid);
+}
+}
+}
+marpa_obs_free(trigger_events_obs);
+}
+
+/*:809*//*810:*/
+#line 9499 "./marpa.w"
+
+PRIVATE int trigger_trivial_events(RECCE r)
+{
+int cil_ix;
+int event_count= 0;
+GRAMMAR g= G_of_R(r);
+const XSY start_xsy= XSY_by_ID(g->t_start_xsy_id);
+const CIL nulled_xsyids= Nulled_XSYIDs_of_XSY(start_xsy);
+const int cil_count= Count_of_CIL(nulled_xsyids);
+for(cil_ix= 0;cil_ix<cil_count;cil_ix++)
+{
+const XSYID nulled_xsyid= Item_of_CIL(nulled_xsyids,cil_ix);
+if(lbv_bit_test(r->t_lbv_xsyid_nulled_event_is_active,nulled_xsyid)){
+int_event_new(g,MARPA_EVENT_SYMBOL_NULLED,nulled_xsyid);
+event_count++;
+}
+}
+return event_count;
+}
+
+/*:810*//*811:*/
+#line 9519 "./marpa.w"
+
+PRIVATE void earley_set_update_items(RECCE r,YS set)
+{
+YIM*working_earley_items;
+YIM*finished_earley_items;
+int working_earley_item_count;
+int i;
+YIMs_of_YS(set)= marpa_obs_new(YS_Obs_of_R(r),YIM,YIM_Count_of_YS(set));
+finished_earley_items= YIMs_of_YS(set);
+
+working_earley_items= Work_YIMs_of_R(r);
+working_earley_item_count= Work_YIM_Count_of_R(r);
+for(i= 0;i<working_earley_item_count;i++){
+YIM earley_item= working_earley_items[i];
+int ordinal= Ord_of_YIM(earley_item);
+finished_earley_items[ordinal]= earley_item;
+}
+WORK_YIMS_CLEAR(r);
+}
+
+/*:811*//*812:*/
+#line 9548 "./marpa.w"
+
+PRIVATE void r_update_earley_sets(RECCE r)
+{
+YS set;
+YS first_unstacked_earley_set;
+if(!MARPA_DSTACK_IS_INITIALIZED(r->t_earley_set_stack)){
+first_unstacked_earley_set= First_YS_of_R(r);
+MARPA_DSTACK_INIT(r->t_earley_set_stack,YS,
+MAX(1024,YS_Count_of_R(r)),Allocator_of_G(G_of_R(r)));
+}else{
+YS*end_of_stack= MARPA_DSTACK_TOP(r->t_earley_set_stack,YS);
+
+
+first_unstacked_earley_set= end_of_stack
+?Next_YS_of_YS(*end_of_stack):First_YS_of_R(r);
+}
+for(set= first_unstacked_earley_set;set;set= Next_YS_of_YS(set)){
+YS*end_of_stack= MARPA_DSTACK_PUSH(r->t_earley_set_stack,YS);
+(*end_of_stack)= set;
+}
+}
+
+/*:812*//*813:*/
+#line 9582 "./marpa.w"
+
+PRIVATE YS
+ys_of_r_by_ord(RECCE r,YSID ysid)
+{
+int lo= 0;
+int hi;
+if(!R_is_Forgetful(r))
+return YS_of_R_by_Ord(r,ysid);
+hi= MARPA_DSTACK_LENGTH(r->t_earley_set_stack)-1;
+while(hi>=lo)
+{
+const int trial= lo+(hi-lo)/2;
+const YS trial_ys= YS_of_R_by_Ord(r,trial);
+const YSID trial_ysid= Ord_of_YS(trial_ys);
+if(trial_ysid==ysid)
+return YS_is_Forgotten(trial_ys)?NULL:trial_ys;
+if(trial_ysid<ysid)
+{
+lo= trial+1;
+}
+else
+{
+hi= trial-1;
+}
+}
+return NULL;
+}
+
+/*:813*//*817:*/
+#line 9646 "./marpa.w"
+
+int marpa_r_forgetful(Marpa_Recognizer r)
+{
+/*1500:*/
+#line 19380 "./marpa.w"
+const int failure_indicator= -2;
+/*:1500*/
+#line 9649 "./marpa.w"
+
+/*585:*/
+#line 6448 "./marpa.w"
+
+const GRAMMAR g= G_of_R(r);
+/*:585*/
+#line 9650 "./marpa.w"
+
+/*1521:*/
+#line 19518 "./marpa.w"
+
+if(HEADER_VERSION_MISMATCH){
+MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
+return failure_indicator;
+}
+if(_MARPA_UNLIKELY(!IS_G_OK(g))){
+MARPA_ERROR(g->t_error);
+return failure_indicator;
+}
+
+/*:1521*/
+#line 9651 "./marpa.w"
+
+return R_is_Forgetful(r);
+}
+
+/*:817*//*818:*/
+#line 9658 "./marpa.w"
+
+int marpa_r_forgetful_set(Marpa_Recognizer r,int value)
+{
+/*1500:*/
+#line 19380 "./marpa.w"
+const int failure_indicator= -2;
+/*:1500*/
+#line 9661 "./marpa.w"
+
+/*585:*/
+#line 6448 "./marpa.w"
+
+const GRAMMAR g= G_of_R(r);
+/*:585*/
+#line 9662 "./marpa.w"
+
+/*1521:*/
+#line 19518 "./marpa.w"
+
+if(HEADER_VERSION_MISMATCH){
+MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
+return failure_indicator;
+}
+if(_MARPA_UNLIKELY(!IS_G_OK(g))){
+MARPA_ERROR(g->t_error);
+return failure_indicator;
+}
+
+/*:1521*/
+#line 9663 "./marpa.w"
+
+/*1517:*/
+#line 19489 "./marpa.w"
+
+if(_MARPA_UNLIKELY(Input_Phase_of_R(r)!=R_BEFORE_INPUT)){
+MARPA_ERROR(MARPA_ERR_RECCE_STARTED);
+return failure_indicator;
+}
+/*:1517*/
+#line 9664 "./marpa.w"
+
+return R_is_Forgetful(r)= value?1:0;
+}
+
+/*:818*//*827:*/
+#line 9723 "./marpa.w"
+
+PRIVATE void ys_batch_new(RECCE r)
+{
+struct marpa_obstack*const obs= 
+marpa_obs_cache_init(Chunk_Cache_of_G(G_of_R(r)));
+const YS_BATCH batch= marpa_obs_new(obs,struct s_ys_batch,1);
+batch->t_obs= obs;
+batch->t_next= NULL;
+batch->t_first_ysid= YS_Count_of_R(r);
+batch->t_is_needed= 1;
+if(r->t_latest_ys_batch){
+r->t_latest_ys_batch->t_next= batch;
+}else{
+r->t_first_ys_batch= batch;
+}
+r->t_latest_ys_batch= batch;
+YS_Obs_of_R(r)= obs;
+YS_Batch_is_Closed(r)= 0;
+}
+
+/*:827*//*828:*/
+#line 9743 "./marpa.w"
+
+PRIVATE void ys_batches_free(RECCE r)
+{
+YS_BATCH batch= r->t_first_ys_batch;
+while(batch){
+const YS_BATCH next_batch= batch->t_next;
+marpa_obs_free(batch->t_obs);
+batch= next_batch;
+}
+r->t_first_ys_batch= NULL;
+r->t_latest_ys_batch= NULL;
+YS_Obs_of_R(r)= r->t_obs;
+YS_Batch_is_Closed(r)= 1;
+}
+
+/*:828*//*839:*/
+#line 9847 "./marpa.w"
+
+PRIVATE_NOT_INLINE void earley_sets_forget(RECCE r)
+{
+YS*ys_stack;
+int ys_count;
+int kept_count= 0;
+r_update_earley_sets(r);
+ys_stack= MARPA_DSTACK_BASE(r->t_earley_set_stack,YS);
+ys_count= MARPA_DSTACK_LENGTH(r->t_earley_set_stack);
+/*840:*/
+#line 9875 "./marpa.w"
+
+{
+int ys_ix;
+int alternative_ix;
+const int alternative_count= MARPA_DSTACK_LENGTH(r->t_alternatives);
+const ALT alternatives= MARPA_DSTACK_BASE(r->t_alternatives,ALT_Object);
+for(ys_ix= 0;ys_ix<ys_count;ys_ix++)
+{
+YS_is_Needed(ys_stack[ys_ix])= 0;
+YS_is_Root(ys_stack[ys_ix])= 0;
+}
+YS_is_Needed(Latest_YS_of_R(r))= 1;
+YS_is_Root(Latest_YS_of_R(r))= 1;
+for(alternative_ix= 0;alternative_ix<alternative_count;
+alternative_ix++)
+{
+const YS start_ys= Start_YS_of_ALT(alternatives+alternative_ix);
+YS_is_Needed(start_ys)= 1;
+YS_is_Root(start_ys)= 1;
+}
+for(ys_ix= ys_count-1;ys_ix>=0;ys_ix--)
+{
+const YS ys= ys_stack[ys_ix];
+const YIM*const yims= YIMs_of_YS(ys);
+const int yim_count= YIM_Count_of_YS(ys);
+PIM*const postdot_array= ys->t_postdot_ary;
+const int postdot_sym_count= Postdot_SYM_Count_of_YS(ys);
+int yim_ix;
+int pim_ix;
+if(!YS_is_Needed(ys))
+continue;
+kept_count++;
+YS_is_Forgotten(ys)= !YS_is_Root(ys);
+for(yim_ix= 0;yim_ix<yim_count;yim_ix++)
+{
+const YIM yim= yims[yim_ix];
+if(YS_is_Root(ys)||!YIM_is_Completion(yim))
+YS_is_Needed(Origin_of_YIM(yim))= 1;
+}
+for(pim_ix= 0;pim_ix<postdot_sym_count;pim_ix++)
+{
+const PIM pim= postdot_array[pim_ix];
+if(PIM_is_LIM(pim))
+{
+const YS leo_origin= Origin_of_LIM(LIM_of_PIM(pim));
+if(leo_origin)
+YS_is_Needed(leo_origin)= 1;
+}
+}
+}
+}
+
+/*:840*/
+#line 9856 "./marpa.w"
+
+if(kept_count<ys_count)
+{
+
+
+
+
+psar_clear(Dot_PSAR_of_R(r));
+/*841:*/
+#line 9930 "./marpa.w"
+
+{
+int ys_ix;
+YS previous_ys= NULL;
+for(ys_ix= 0;ys_ix<ys_count;ys_ix++)
+{
+const YS ys= ys_stack[ys_ix];
+if(!YS_is_Needed(ys))
+continue;
+if(previous_ys)
+{
+Next_YS_of_YS(previous_ys)= ys;
+}
+else
+{
+First_YS_of_R(r)= ys;
+}
+previous_ys= ys;
+}
+}
+
+/*:841*/
+#line 9864 "./marpa.w"
+
+/*842:*/
+#line 9955 "./marpa.w"
+
+{
+int ys_ix;
+YS_BATCH previous_batch= NULL;
+YS_BATCH batch;
+for(batch= r->t_first_ys_batch;batch;batch= batch->t_next)
+{
+batch->t_is_needed= 0;
+}
+batch= r->t_first_ys_batch;
+for(ys_ix= 0;ys_ix<ys_count;ys_ix++)
+{
+const YS ys= ys_stack[ys_ix];
+if(!YS_is_Needed(ys))
+continue;
+while(batch->t_next&&batch->t_next->t_first_ysid<=Ord_of_YS(ys))
+{
+batch= batch->t_next;
+}
+batch->t_is_needed= 1;
+}
+batch= r->t_first_ys_batch;
+while(batch)
+{
+const YS_BATCH next_batch= batch->t_next;
+if(batch->t_is_needed)
+{
+if(previous_batch)
+{
+previous_batch->t_next= batch;
+}
+else
+{
+r->t_first_ys_batch= batch;
+}
+previous_batch= batch;
+}
+else
+{
+marpa_obs_free(batch->t_obs);
+}
+batch= next_batch;
+}
+previous_batch->t_next= NULL;
+r->t_latest_ys_batch= previous_batch;
+}
+
+/*:842*/
+#line 9865 "./marpa.w"
+
+/*1558:*/
+#line 20038 "./marpa.w"
+{
+r->t_trace_earley_set= NULL;
+trace_earley_item_clear(r);
+/*1570:*/
+#line 20227 "./marpa.w"
+
+r->t_trace_pim_nsy_p= NULL;
+r->t_trace_postdot_item= NULL;
+
+/*:1570*/
+#line 20041 "./marpa.w"
+
+}
+
+/*:1558*/
+#line 9866 "./marpa.w"
+
+R_Generation(r)++;
+}
+MARPA_DSTACK_CLEAR(r->t_earley_set_stack);
+r->t_next_forget_ysid= 
+YS_Count_of_R(r)+MAX(YS_FORGET_INTERVAL,kept_count);
+YS_Batch_is_Closed(r)= 1;
+}
+
+/*:839*//*848:*/
+#line 10038 "./marpa.w"
+
+int marpa_r_lookahead_filter(Marpa_Recognizer r)
+{
+/*1500:*/
+#line 19380 "./marpa.w"
+const int failure_indicator= -2;
+/*:1500*/
+#line 10041 "./marpa.w"
+
+/*585:*/
+#line 6448 "./marpa.w"
+
+const GRAMMAR g= G_of_R(r);
+/*:585*/
+#line 10042 "./marpa.w"
+
+/*1521:*/
+#line 19518 "./marpa.w"
+
+if(HEADER_VERSION_MISMATCH){
+MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
+return failure_indicator;
+}
+if(_MARPA_UNLIKELY(!IS_G_OK(g))){
+MARPA_ERROR(g->t_error);
+return failure_indicator;
+}
+
+/*:1521*/
+#line 10043 "./marpa.w"
+
+return R_is_Lookahead_Filtered(r);
+}
+
+/*:848*//*849:*/
+#line 10050 "./marpa.w"
+
+int marpa_r_lookahead_filter_set(Marpa_Recognizer r,int value)
+{
+/*1500:*/
+#line 19380 "./marpa.w"
+const int failure_indicator= -2;
+/*:1500*/
+#line 10053 "./marpa.w"
+
+/*585:*/
+#line 6448 "./marpa.w"
+
+const GRAMMAR g= G_of_R(r);
+/*:585*/
+#line 10054 "./marpa.w"
+
+/*1521:*/
+#line 19518 "./marpa.w"
+
+if(HEADER_VERSION_MISMATCH){
+MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
+return failure_indicator;
+}
+if(_MARPA_UNLIKELY(!IS_G_OK(g))){
+MARPA_ERROR(g->t_error);
+return failure_indicator;
+}
+
+/*:1521*/
+#line 10055 "./marpa.w"
+
+/*1517:*/
+#line 19489 "./marpa.w"
+
+if(_MARPA_UNLIKELY(Input_Phase_of_R(r)!=R_BEFORE_INPUT)){
+MARPA_ERROR(MARPA_ERR_RECCE_STARTED);
+return failure_indicator;
+}
+/*:1517*/
+#line 10056 "./marpa.w"
+
+return R_is_Lookahead_Filtered(r)= value?1:0;
+}
+
+/*:849*//*850:*/
+#line 10064 "./marpa.w"
+
+int marpa_r_lookahead_add(Marpa_Recognizer r,Marpa_Symbol_ID xsy_id)
+{
+/*1500:*/
+#line 19380 "./marpa.w"
+const int failure_indicator= -2;
+/*:1500*/
+#line 10067 "./marpa.w"
+
+/*585:*/
+#line 6448 "./marpa.w"
+
+const GRAMMAR g= G_of_R(r);
+/*:585*/
+#line 10068 "./marpa.w"
+
+XSY xsy;
+NSY nsy;
+/*1521:*/
+#line 19518 "./marpa.w"
+
+if(HEADER_VERSION_MISMATCH){
+MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
+return failure_indicator;
+}
+if(_MARPA_UNLIKELY(!IS_G_OK(g))){
+MARPA_ERROR(g->t_error);
+return failure_indicator;
+}
+
+/*:1521*/
+#line 10071 "./marpa.w"
+
+if(_MARPA_UNLIKELY(Input_Phase_of_R(r)==R_AFTER_INPUT))
+{
+MARPA_ERROR(MARPA_ERR_RECCE_NOT_ACCEPTING_INPUT);
+return failure_indicator;
+}
+/*1504:*/
+#line 19401 "./marpa.w"
+
+if(_MARPA_UNLIKELY(XSYID_is_Malformed(xsy_id))){
+MARPA_ERROR(MARPA_ERR_INVALID_SYMBOL_ID);
+return failure_indicator;
+}
+/*:1504*/
+#line 10077 "./marpa.w"
+
+/*1506:*/
+#line 19413 "./marpa.w"
+
+if(_MARPA_UNLIKELY(!XSYID_of_G_Exists(xsy_id))){
+MARPA_ERROR(MARPA_ERR_NO_SUCH_SYMBOL_ID);
+return failure_indicator;
+}
+
+/*:1506*/
+#line 10078 "./marpa.w"
+
+xsy= XSY_by_ID(xsy_id);
+if(_MARPA_UNLIKELY(!XSY_is_Terminal(xsy)))
+{
+MARPA_ERROR(MARPA_ERR_TOKEN_IS_NOT_TERMINAL);
+return failure_indicator;
+}
+nsy= NSY_of_XSY(xsy);
+if(nsy)
+{
+bv_bit_set(r->t_bv_lookahead,ID_of_NSY(nsy));
+}
+return 1;
+}
+
+/*:850*//*851:*/
+#line 10099 "./marpa.w"
+
+PRIVATE void
+predicted_ahms_init(RECCE r)
+{
+const GRAMMAR g= G_of_R(r);
+const Bit_Vector bv_ahm_predicted= r->t_bv_ahm_predicted;
+const Bit_Vector bv_lookahead= r->t_bv_lookahead;
+int min,max,start;
+if(!R_is_Lookahead_Filtered(r))
+{
+bv_clear(bv_ahm_predicted);
+bv_clear(bv_lookahead);
+return;
+}
+bv_fill(bv_ahm_predicted);
+for(start= 0;bv_scan(bv_lookahead,start,&min,&max);
+start= max+2)
+{
+NSYID nsyid;
+for(nsyid= min;nsyid<=max;nsyid++)
+{
+int cil_ix;
+const CIL lookahead_cil= Lookahead_CIL_of_NSYID(nsyid);
+const int cil_count= Count_of_CIL(lookahead_cil);
+for(cil_ix= 0;cil_ix<cil_count;cil_ix++)
+{
+bv_bit_clear(bv_ahm_predicted,
+Item_of_CIL(lookahead_cil,cil_ix));
+}
+}
+}
+bv_clear(bv_lookahead);
+}
+
+/*:851*//*856:*/
+#line 10162 "./marpa.w"
+
+int marpa_r_link_free(Marpa_Recognizer r)
+{
+/*1500:*/
+#line 19380 "./marpa.w"
+const int failure_indicator= -2;
+/*:1500*/
+#line 10165 "./marpa.w"
+
+/*585:*/
+#line 6448 "./marpa.w"
+
+const GRAMMAR g= G_of_R(r);
+/*:585*/
+#line 10166 "./marpa.w"
+
+/*1521:*/
+#line 19518 "./marpa.w"
+
+if(HEADER_VERSION_MISMATCH){
+MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
+return failure_indicator;
+}
+if(_MARPA_UNLIKELY(!IS_G_OK(g))){
+MARPA_ERROR(g->t_error);
+return failure_indicator;
+}
+
+/*:1521*/
+#line 10167 "./marpa.w"
+
+return R_is_Link_Free(r);
+}
+
+/*:856*//*857:*/
+#line 10174 "./marpa.w"
+
+int marpa_r_link_free_set(Marpa_Recognizer r,int value)
+{
+/*1500:*/
+#line 19380 "./marpa.w"
+const int failure_indicator= -2;
+/*:1500*/
+#line 10177 "./marpa.w"
+
+/*585:*/
+#line 6448 "./marpa.w"
+
+const GRAMMAR g= G_of_R(r);
+/*:585*/
+#line 10178 "./marpa.w"
+
+/*1521:*/
+#line 19518 "./marpa.w"
+
+if(HEADER_VERSION_MISMATCH){
+MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
+return failure_indicator;
+}
+if(_MARPA_UNLIKELY(!IS_G_OK(g))){
+MARPA_ERROR(g->t_error);
+return failure_indicator;
+}
+
+/*:1521*/
+#line 10179 "./marpa.w"
+
+/*1517:*/
+#line 19489 "./marpa.w"
+
+if(_MARPA_UNLIKELY(Input_Phase_of_R(r)!=R_BEFORE_INPUT)){
+MARPA_ERROR(MARPA_ERR_RECCE_STARTED);
+return failure_indicator;
+}
+/*:1517*/
+#line 10180 "./marpa.w"
+
+return R_is_Link_Free(r)= value?1:0;
+}
+
+/*:857*//*866:*/
+#line 10269 "./marpa.w"
+
+PRIVATE void
+image_int_write(IMAGE_WRITER w,int value)
+{
+if(w->t_length+sizeof(int)<=w->t_capacity)
+{
+memcpy(w->t_buffer+w->t_length,&value,sizeof(int));
+}
+w->t_length+= sizeof(int);
+}
+
+/*:866*//*867:*/
+#line 10283 "./marpa.w"
+
+PRIVATE void
+image_lbv_write(IMAGE_WRITER w,LBV lbv,int bits)
+{
+int ix;
+for(ix= 0;ix<bits;ix+= 32)
+{
+unsigned int word= 0;
+int bit;
+for(bit= 0;bit<32&&ix+bit<bits;bit++)
+{
+if(lbv_bit_test(lbv,ix+bit))
+word|= 1u<<bit;
+}
+image_int_write(w,(int)word);
+}
+}
+
+/*:867*//*868:*/
+#line 10305 "./marpa.w"
+
+PRIVATE void
+image_yim_ref_write(IMAGE_WRITER w,YIM yim)
+{
+if(!yim)
+{
+image_int_write(w,-1);
+image_int_write(w,-1);
+return;
+}
+image_int_write(w,Ord_of_YS(YS_of_YIM(yim)));
+image_int_write(w,Ord_of_YIM(yim));
+}
+
+/*:868*//*869:*/
+#line 10324 "./marpa.w"
+
+PRIVATE void
+image_lim_ref_write(IMAGE_WRITER w,LIM lim)
+{
+YS set;
+if(!lim)
+{
+image_int_write(w,-1);
+image_int_write(w,-1);
+return;
+}
+set= YS_of_LIM(lim);
+image_int_write(w,Ord_of_YS(set));
+image_int_write(w,
+(int)(pim_nsy_p_find(set,Postdot_NSYID_of_LIM(lim))-
+set->t_postdot_ary));
+}
+
+/*:869*//*870:*/
+#line 10343 "./marpa.w"
+
+PRIVATE void
+image_srcl_write(IMAGE_WRITER w,SRCL srcl,unsigned int source_type)
+{
+image_int_write(w,
+(SRCL_is_Rejected(srcl)?IMAGE_IS_REJECTED:0)|
+(SRCL_is_Active(srcl)?IMAGE_IS_ACTIVE:0));
+switch(source_type)
+{
+case SOURCE_IS_TOKEN:
+image_yim_ref_write(w,Predecessor_of_SRCL(srcl));
+image_int_write(w,NSYID_of_SRCL(srcl));
+image_int_write(w,Value_of_SRCL(srcl));
+return;
+case SOURCE_IS_COMPLETION:
+image_yim_ref_write(w,Predecessor_of_SRCL(srcl));
+image_yim_ref_write(w,Cause_of_SRCL(srcl));
+return;
+case SOURCE_IS_LEO:
+image_lim_ref_write(w,LIM_of_SRCL(srcl));
+image_yim_ref_write(w,Cause_of_SRCL(srcl));
+return;
+}
+}
+
+/*:870*//*871:*/
+#line 10368 "./marpa.w"
+
+PRIVATE void
+image_srcl_chain_write(IMAGE_WRITER w,SRCL first_srcl,
+unsigned int source_type)
+{
+SRCL srcl;
+int count= 0;
+for(srcl= first_srcl;srcl;srcl= Next_SRCL_of_SRCL(srcl))
+count++;
+image_int_write(w,count);
+for(srcl= first_srcl;srcl;srcl= Next_SRCL_of_SRCL(srcl))
+image_srcl_write(w,srcl,source_type);
+}
+
+/*:871*//*872:*/
+#line 10385 "./marpa.w"
+
+PRIVATE unsigned int
+grammar_image_hash(GRAMMAR g)
+{
+unsigned int hash= 0;
+AHMID ahm_id;
+const int ahm_count= AHM_Count_of_G(g);
+for(ahm_id= 0;ahm_id<ahm_count;ahm_id++)
+{
+const AHM ahm= AHM_by_ID(ahm_id);
+hash= hash*31u+(unsigned int)IRLID_of_AHM(ahm);
+hash= hash*31u+(unsigned int)Position_of_AHM(ahm);
+hash= hash*31u+(unsigned int)Postdot_NSYID_of_AHM(ahm);
+}
+return hash;
+}
+
+/*:872*//*873:*/
+#line 10402 "./marpa.w"
+
+PRIVATE_NOT_INLINE void
+r_image_write(RECCE r,IMAGE_WRITER w)
+{
+/*585:*/
+#line 6448 "./marpa.w"
+
+const GRAMMAR g= G_of_R(r);
+/*:585*/
+#line 10406 "./marpa.w"
+
+const int xsy_count= XSY_Count_of_G(g);
+const int nsy_count= NSY_Count_of_G(g);
+/*874:*/
+#line 10417 "./marpa.w"
+
+{
+image_int_write(w,IMAGE_MAGIC);
+image_int_write(w,MARPA_LIB_MAJOR_VERSION);
+image_int_write(w,MARPA_LIB_MINOR_VERSION);
+image_int_write(w,MARPA_LIB_MICRO_VERSION);
+image_int_write(w,xsy_count);
+image_int_write(w,nsy_count);
+image_int_write(w,IRL_Count_of_G(g));
+image_int_write(w,AHM_Count_of_G(g));
+image_int_write(w,ZWA_Count_of_R(r));
+image_int_write(w,(int)grammar_image_hash(g));
+}
+
+/*:874*/
+#line 10409 "./marpa.w"
+
+/*875:*/
+#line 10431 "./marpa.w"
+
+{
+image_int_write(w,Input_Phase_of_R(r));
+image_int_write(w,Current_Earleme_of_R(r));
+image_int_write(w,Furthest_Earleme_of_R(r));
+image_int_write(w,R_is_Exhausted(r));
+image_int_write(w,r->t_use_leo_flag);
+image_int_write(w,r->t_is_using_leo);
+image_int_write(w,R_is_Link_Free(r));
+image_int_write(w,R_is_Lookahead_Filtered(r));
+image_int_write(w,r->t_earley_item_warning_threshold);
+image_int_write(w,First_Inconsistent_YS_of_R(r));
+image_int_write(w,r->t_active_event_count);
+image_int_write(w,YS_Count_of_R(r));
+}
+
+/*:875*/
+#line 10410 "./marpa.w"
+
+/*876:*/
+#line 10447 "./marpa.w"
+
+{
+ZWAID zwaid;
+const int zwa_count= ZWA_Count_of_R(r);
+image_lbv_write(w,r->t_lbv_xsyid_completion_event_is_active,xsy_count);
+image_lbv_write(w,r->t_lbv_xsyid_nulled_event_is_active,xsy_count);
+image_lbv_write(w,r->t_lbv_xsyid_prediction_event_is_active,xsy_count);
+image_lbv_write(w,r->t_nsy_expected_is_event,nsy_count);
+image_lbv_write(w,r->t_valued_terminal,xsy_count);
+image_lbv_write(w,r->t_unvalued_terminal,xsy_count);
+image_lbv_write(w,r->t_valued,xsy_count);
+image_lbv_write(w,r->t_unvalued,xsy_count);
+image_lbv_write(w,r->t_valued_locked,xsy_count);
+image_lbv_write(w,r->t_bv_nsyid_is_expected,nsy_count);
+for(zwaid= 0;zwaid<zwa_count;zwaid++)
+{
+const ZWA zwa= RZWA_by_ID(zwaid);
+image_int_write(w,Memo_Value_of_ZWA(zwa));
+image_int_write(w,Memo_YSID_of_ZWA(zwa));
+}
+}
+
+/*:876*/
+#line 10411 "./marpa.w"
+
+/*877:*/
+#line 10477 "./marpa.w"
+
+{
+YS set;
+for(set= First_YS_of_R(r);set;set= Next_YS_of_YS(set))
+{
+const int item_count= YIM_Count_of_YS(set);
+const int slot_count= Postdot_SYM_Count_of_YS(set);
+YIM*const items= YIMs_of_YS(set);
+int item_ix;
+int slot_ix;
+image_int_write(w,Earleme_of_YS(set));
+image_int_write(w,Value_of_YS(set));
+/*878:*/
+#line 10496 "./marpa.w"
+
+{
+image_int_write(w,item_count);
+for(item_ix= 0;item_ix<item_count;item_ix++)
+{
+const YIM item= items[item_ix];
+image_int_write(w,AHMID_of_YIM(item));
+image_int_write(w,Ord_of_YS(Origin_of_YIM(item)));
+image_int_write(w,
+(YIM_is_Rejected(item)?IMAGE_IS_REJECTED:0)|
+(YIM_is_Active(item)?IMAGE_IS_ACTIVE:0)|
+(YIM_was_Scanned(item)?IMAGE_WAS_SCANNED:0)|
+(YIM_was_Fusion(item)?IMAGE_WAS_FUSION:0));
+}
+}
+
+/*:878*/
+#line 10489 "./marpa.w"
+
+/*879:*/
+#line 10513 "./marpa.w"
+
+{
+image_int_write(w,slot_count);
+for(slot_ix= 0;slot_ix<slot_count;slot_ix++)
+{
+const PIM first_pim= set->t_postdot_ary[slot_ix];
+PIM pim;
+int pim_count= 0;
+for(pim= first_pim;pim;pim= Next_PIM_of_PIM(pim))
+pim_count++;
+image_int_write(w,Postdot_NSYID_of_PIM(first_pim));
+image_int_write(w,pim_count);
+for(pim= first_pim;pim;pim= Next_PIM_of_PIM(pim))
+{
+const YIM item= YIM_of_PIM(pim);
+image_int_write(w,item?Ord_of_YIM(item):-1);
+}
+}
+}
+
+/*:879*/
+#line 10490 "./marpa.w"
+
+/*880:*/
+#line 10536 "./marpa.w"
+
+{
+for(slot_ix= 0;slot_ix<slot_count;slot_ix++)
+{
+const PIM pim= set->t_postdot_ary[slot_ix];
+LIM lim;
+CIL cil;
+if(!PIM_is_LIM(pim))
+continue;
+lim= LIM_of_PIM(pim);
+image_int_write(w,
+(LIM_is_Rejected(lim)?IMAGE_IS_REJECTED:0)|
+(LIM_is_Active(lim)?IMAGE_IS_ACTIVE:0));
+image_int_write(w,
+Origin_of_LIM(lim)?Ord_of_YS(Origin_of_LIM(lim)):
+-1);
+image_int_write(w,ID_of_AHM(Top_AHM_of_LIM(lim)));
+image_int_write(w,ID_of_AHM(Trailhead_AHM_of_LIM(lim)));
+image_lim_ref_write(w,Predecessor_LIM_of_LIM(lim));
+image_yim_ref_write(w,Trailhead_YIM_of_LIM(lim));
+cil= CIL_of_LIM(lim);
+if(!cil)
+{
+image_int_write(w,-1);
+}
+else
+{
+int cil_ix;
+const int cil_count= Count_of_CIL(cil);
+image_int_write(w,cil_count);
+for(cil_ix= 0;cil_ix<cil_count;cil_ix++)
+image_int_write(w,Item_of_CIL(cil,cil_ix));
+}
+}
+}
+
+/*:880*/
+#line 10491 "./marpa.w"
+
+/*881:*/
+#line 10580 "./marpa.w"
+
+{
+for(item_ix= 0;item_ix<item_count;item_ix++)
+{
+const YIM item= items[item_ix];
+const unsigned int source_type= Source_Type_of_YIM(item);
+image_int_write(w,(int)source_type);
+if(AHM_is_Unsourced(AHM_of_YIM(item)))
+{
+if(!R_is_Link_Free(r))
+image_int_write(w,IMAGE_IS_ACTIVE);
+continue;
+}
+if(R_is_Link_Free(r))
+{
+if(source_type==SOURCE_IS_AMBIGUOUS)
+image_srcl_chain_write(w,LV_First_Leo_SRCL_of_YIM(item),
+SOURCE_IS_LEO);
+continue;
+}
+switch(source_type)
+{
+case NO_SOURCE:
+{
+const SRC source= SRC_of_YIM(item);
+image_int_write(w,
+(SRC_is_Rejected(source)?IMAGE_IS_REJECTED:
+0)|(SRC_is_Active(source)?IMAGE_IS_ACTIVE:
+0));
+}
+break;
+case SOURCE_IS_TOKEN:
+case SOURCE_IS_COMPLETION:
+case SOURCE_IS_LEO:
+image_srcl_write(w,SRCL_of_YIM(item),source_type);
+break;
+case SOURCE_IS_AMBIGUOUS:
+image_srcl_chain_write(w,LV_First_Leo_SRCL_of_YIM(item),
+SOURCE_IS_LEO);
+image_srcl_chain_write(w,LV_First_Token_SRCL_of_YIM(item),
+SOURCE_IS_TOKEN);
+image_srcl_chain_write(w,LV_First_Completion_SRCL_of_YIM(item),
+SOURCE_IS_COMPLETION);
+break;
+}
+}
+}
+
+/*:881*/
+#line 10492 "./marpa.w"
+
+}
+}
+
+/*:877*/
+#line 10412 "./marpa.w"
+
+/*882:*/
+#line 10628 "./marpa.w"
+
+{
+int alt_ix;
+const int alternative_count= MARPA_DSTACK_LENGTH(r->t_alternatives);
+image_int_write(w,alternative_count);
+for(alt_ix= 0;alt_ix<alternative_count;alt_ix++)
+{
+const ALT alternative= 
+MARPA_DSTACK_INDEX(r->t_alternatives,ALT_Object,alt_ix);
+image_int_write(w,Ord_of_YS(Start_YS_of_ALT(alternative)));
+image_int_write(w,End_Earleme_of_ALT(alternative));
+image_int_write(w,NSYID_of_ALT(alternative));
+image_int_write(w,Value_of_ALT(alternative));
+image_int_write(w,ALT_is_Valued(alternative));
+}
+}
+
+/*:882*/
+#line 10413 "./marpa.w"
+
+image_int_write(w,IMAGE_MAGIC);
+}
+
+/*:873*//*883:*/
+#line 10652 "./marpa.w"
+
+int
+marpa_r_serialize(Marpa_Recognizer r,void*buffer,int buffer_size)
+{
+/*1500:*/
+#line 19380 "./marpa.w"
+const int failure_indicator= -2;
+/*:1500*/
+#line 10656 "./marpa.w"
+
+/*585:*/
+#line 6448 "./marpa.w"
+
+const GRAMMAR g= G_of_R(r);
+/*:585*/
+#line 10657 "./marpa.w"
+
+IMAGE_WRITER_Object writer;
+/*1521:*/
+#line 19518 "./marpa.w"
+
+if(HEADER_VERSION_MISMATCH){
+MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
+return failure_indicator;
+}
+if(_MARPA_UNLIKELY(!IS_G_OK(g))){
+MARPA_ERROR(g->t_error);
+return failure_indicator;
+}
+
+/*:1521*/
+#line 10659 "./marpa.w"
+
+/*1518:*/
+#line 19494 "./marpa.w"
+
+if(_MARPA_UNLIKELY(Input_Phase_of_R(r)==R_BEFORE_INPUT)){
+MARPA_ERROR(MARPA_ERR_RECCE_NOT_STARTED);
+return failure_indicator;
+}
+/*:1518*/
+#line 10660 "./marpa.w"
+
+/*819:*/
+#line 9668 "./marpa.w"
+
+if(_MARPA_UNLIKELY(R_is_Forgetful(r))){
+MARPA_ERROR(MARPA_ERR_RECCE_IS_FORGETFUL);
+return failure_indicator;
+}
+
+/*:819*/
+#line 10661 "./marpa.w"
+
+if(_MARPA_UNLIKELY(buffer_size<0||(buffer_size> 0&&!buffer)))
+{
+MARPA_ERROR(MARPA_ERR_INVALID_IMAGE);
+return failure_indicator;
+}
+writer.t_buffer= buffer;
+writer.t_capacity= (size_t)buffer_size;
+writer.t_length= 0;
+r_image_write(r,&writer);
+if(_MARPA_UNLIKELY(writer.t_length> INT_MAX))
+{
+MARPA_ERROR(MARPA_ERR_INVALID_IMAGE);
+return failure_indicator;
+}
+return(int)writer.t_length;
+}
+
+/*:883*//*884:*/
+#line 10689 "./marpa.w"
+
+PRIVATE int
+image_int_read(IMAGE_READER rd)
+{
+int value;
+if(rd->t_offset+sizeof(int)> rd->t_length)
+{
+rd->t_is_bad= 1;
+return 0;
+}
+memcpy(&value,rd->t_image+rd->t_offset,sizeof(int));
+rd->t_offset+= sizeof(int);
+return value;
+}
+
+/*:884*//*885:*/
+#line 10706 "./marpa.w"
+
+PRIVATE int
+image_int_read_ranged(IMAGE_READER rd,int min,int limit)
+{
+const int value= image_int_read(rd);
+if(value<min||value>=limit)
+{
+rd->t_is_bad= 1;
+return min;
+}
+return value;
+}
+
+/*:885*//*886:*/
+#line 10723 "./marpa.w"
+
+PRIVATE int
+image_count_read(IMAGE_READER rd,int min_ints)
+{
+const int count= image_int_read(rd);
+const size_t ints_left= (rd->t_length-rd->t_offset)/sizeof(int);
+if(count<0||(size_t)count> ints_left/(size_t)min_ints)
+{
+rd->t_is_bad= 1;
+return 0;
+}
+return count;
+}
+
+/*:886*//*887:*/
+#line 10737 "./marpa.w"
+
+PRIVATE void
+image_lbv_read(IMAGE_READER rd,LBV lbv,int bits)
+{
+int ix;
+for(ix= 0;ix<bits;ix+= 32)
+{
+const unsigned int word= (unsigned int)image_int_read(rd);
+int bit;
+for(bit= 0;bit<32&&ix+bit<bits;bit++)
+{
+if(word&(1u<<bit))
+lbv_bit_set(lbv,ix+bit);
+else
+lbv_bit_clear(lbv,ix+bit);
+}
+}
+}
+
+/*:887*//*888:*/
+#line 10760 "./marpa.w"
+
+PRIVATE YIM
+image_yim_ref_read(IMAGE_READER rd,YS*sets,YS set)
+{
+const int set_ord= image_int_read_ranged(rd,-1,Ord_of_YS(set)+1);
+const int item_ord= image_int_read(rd);
+YS item_set;
+if(rd->t_is_bad)
+return NULL;
+if(set_ord<0)
+{
+if(item_ord!=-1)
+rd->t_is_bad= 1;
+return NULL;
+}
+item_set= sets[set_ord];
+if(item_ord<0||item_ord>=YIM_Count_of_YS(item_set))
+{
+rd->t_is_bad= 1;
+return NULL;
+}
+return YIMs_of_YS(item_set)[item_ord];
+}
+
+/*:888*//*889:*/
+#line 10787 "./marpa.w"
+
+PRIVATE LIM
+image_lim_ref_read(IMAGE_READER rd,YS*sets,YS set)
+{
+const int set_ord= image_int_read_ranged(rd,-1,Ord_of_YS(set)+1);
+const int slot= image_int_read(rd);
+YS lim_set;
+PIM pim;
+if(rd->t_is_bad)
+return NULL;
+if(set_ord<0)
+{
+if(slot!=-1)
+rd->t_is_bad= 1;
+return NULL;
+}
+lim_set= sets[set_ord];
+if(slot<0||slot>=Postdot_SYM_Count_of_YS(lim_set))
+{
+rd->t_is_bad= 1;
+return NULL;
+}
+pim= lim_set->t_postdot_ary[slot];
+if(!PIM_is_LIM(pim))
+{
+rd->t_is_bad= 1;
+return NULL;
+}
+return LIM_of_PIM(pim);
+}
+
+/*:889*//*890:*/
+#line 10820 "./marpa.w"
+
+PRIVATE void
+image_srcl_read(IMAGE_READER rd,YS*sets,YS set,SRCL srcl,
+unsigned int source_type,int nsy_count)
+{
+const int flags= image_int_read(rd);
+SRCL_is_Rejected(srcl)= (flags&IMAGE_IS_REJECTED)!=0;
+SRCL_is_Active(srcl)= (flags&IMAGE_IS_ACTIVE)!=0;
+switch(source_type)
+{
+case SOURCE_IS_TOKEN:
+Predecessor_of_SRCL(srcl)= image_yim_ref_read(rd,sets,set);
+NSYID_of_SRCL(srcl)= image_int_read_ranged(rd,0,nsy_count);
+Value_of_SRCL(srcl)= image_int_read(rd);
+return;
+case SOURCE_IS_COMPLETION:
+Predecessor_of_SRCL(srcl)= image_yim_ref_read(rd,sets,set);
+Cause_of_SRCL(srcl)= image_yim_ref_read(rd,sets,set);
+break;
+case SOURCE_IS_LEO:
+Predecessor_of_SRCL(srcl)= image_lim_ref_read(rd,sets,set);
+Cause_of_SRCL(srcl)= image_yim_ref_read(rd,sets,set);
+break;
+}
+if(!Cause_of_SRCL(srcl))
+rd->t_is_bad= 1;
+}
+
+/*:890*//*891:*/
+#line 10848 "./marpa.w"
+
+PRIVATE SRCL
+image_srcl_chain_read(RECCE r,IMAGE_READER rd,YS*sets,YS set,
+unsigned int source_type)
+{
+SRCL first_srcl= NULL;
+SRCL*p_next_srcl= &first_srcl;
+const int count= image_count_read(rd,5);
+const int nsy_count= NSY_Count_of_G(G_of_R(r));
+int ix;
+for(ix= 0;ix<count&&!rd->t_is_bad;ix++)
+{
+const SRCL srcl= marpa_obs_new(YS_Obs_of_R(r),SRCL_Object,1);
+image_srcl_read(rd,sets,set,srcl,source_type,nsy_count);
+Next_SRCL_of_SRCL(srcl)= NULL;
+*p_next_srcl= srcl;
+p_next_srcl= &Next_SRCL_of_SRCL(srcl);
+}
+return first_srcl;
+}
+
+/*:891*//*892:*/
+#line 10872 "./marpa.w"
+
+PRIVATE_NOT_INLINE int
+ys_image_read(RECCE r,IMAGE_READER rd,YS*sets,YS set)
+{
+/*585:*/
+#line 6448 "./marpa.w"
+
+const GRAMMAR g= G_of_R(r);
+/*:585*/
+#line 10876 "./marpa.w"
+
+const int ahm_count= AHM_Count_of_G(g);
+const int nsy_count= NSY_Count_of_G(g);
+int item_count;
+int slot_count;
+int item_ix;
+int slot_ix;
+YIM*items;
+/*893:*/
+#line 10891 "./marpa.w"
+
+{
+item_count= image_count_read(rd,3);
+if(item_count>=YIM_FATAL_THRESHOLD)
+rd->t_is_bad= 1;
+if(rd->t_is_bad)
+return 0;
+items= marpa_obs_new(YS_Obs_of_R(r),YIM,item_count);
+YIMs_of_YS(set)= items;
+YIM_Count_of_YS(set)= item_count;
+for(item_ix= 0;item_ix<item_count;item_ix++)
+{
+YIM item;
+const int ahm_id= image_int_read_ranged(rd,0,ahm_count);
+const int origin_ord= 
+image_int_read_ranged(rd,0,Ord_of_YS(set)+1);
+const int flags= image_int_read(rd);
+if(rd->t_is_bad)
+return 0;
+item= earley_item_alloc(r,AHM_by_ID(ahm_id));
+Origin_of_YIM(item)= sets[origin_ord];
+YS_of_YIM(item)= set;
+AHM_of_YIM_Set(item,AHM_by_ID(ahm_id));
+item->t_source_type= NO_SOURCE;
+YIM_is_Rejected(item)= (flags&IMAGE_IS_REJECTED)!=0;
+YIM_is_Active(item)= (flags&IMAGE_IS_ACTIVE)!=0;
+YIM_was_Scanned(item)= (flags&IMAGE_WAS_SCANNED)!=0;
+YIM_was_Fusion(item)= (flags&IMAGE_WAS_FUSION)!=0;
+Ord_of_YIM(item)= YIM_ORDINAL_CLAMP((unsigned int)item_ix);
+items[item_ix]= item;
+}
+}
+
+/*:893*/
+#line 10884 "./marpa.w"
+
+/*894:*/
+#line 10930 "./marpa.w"
+
+{
+NSYID previous_nsyid= -1;
+slot_count= image_count_read(rd,3);
+if(rd->t_is_bad)
+return 0;
+set->t_postdot_ary= marpa_obs_new(YS_Obs_of_R(r),PIM,slot_count);
+Postdot_SYM_Count_of_YS(set)= slot_count;
+for(slot_ix= 0;slot_ix<slot_count;slot_ix++)
+{
+int pim_ix;
+PIM*p_next_pim= set->t_postdot_ary+slot_ix;
+const NSYID nsyid= 
+image_int_read_ranged(rd,previous_nsyid+1,nsy_count);
+const int pim_count= image_count_read(rd,1);
+if(pim_count<=0)
+rd->t_is_bad= 1;
+for(pim_ix= 0;pim_ix<pim_count&&!rd->t_is_bad;pim_ix++)
+{
+PIM new_pim;
+const int item_ord= image_int_read_ranged(rd,-1,item_count);
+if(item_ord<0)
+{
+if(pim_ix> 0)
+rd->t_is_bad= 1;
+new_pim= 
+PIM_of_LIM(marpa_obs_new(YS_Obs_of_R(r),LIM_Object,1));
+YIM_of_PIM(new_pim)= NULL;
+}
+else
+{
+const YIM item= items[item_ord];
+if(Postdot_NSYID_of_AHM(AHM_of_YIM(item))!=nsyid)
+rd->t_is_bad= 1;
+new_pim= marpa__obs_alloc(YS_Obs_of_R(r),
+sizeof(YIX_Object),
+ALIGNOF(PIM_Object));
+YIM_of_PIM(new_pim)= item;
+}
+Postdot_NSYID_of_PIM(new_pim)= nsyid;
+*p_next_pim= new_pim;
+p_next_pim= &Next_PIM_of_PIM(new_pim);
+}
+*p_next_pim= NULL;
+if(rd->t_is_bad)
+return 0;
+previous_nsyid= nsyid;
+}
+}
+
+/*:894*/
+#line 10885 "./marpa.w"
+
+/*895:*/
+#line 10983 "./marpa.w"
+
+{
+for(slot_ix= 0;slot_ix<slot_count;slot_ix++)
+{
+const PIM pim= set->t_postdot_ary[slot_ix];
+LIM lim;
+int flags;
+int origin_ord;
+int cil_count;
+if(!PIM_is_LIM(pim))
+continue;
+lim= LIM_of_PIM(pim);
+flags= image_int_read(rd);
+LIM_is_Rejected(lim)= (flags&IMAGE_IS_REJECTED)!=0;
+LIM_is_Active(lim)= (flags&IMAGE_IS_ACTIVE)!=0;
+origin_ord= image_int_read_ranged(rd,-1,Ord_of_YS(set)+1);
+Origin_of_LIM(lim)= origin_ord<0?NULL:sets[origin_ord];
+Top_AHM_of_LIM(lim)= 
+AHM_by_ID(image_int_read_ranged(rd,0,ahm_count));
+Trailhead_AHM_of_LIM(lim)= 
+AHM_by_ID(image_int_read_ranged(rd,0,ahm_count));
+Predecessor_LIM_of_LIM(lim)= image_lim_ref_read(rd,sets,set);
+Trailhead_YIM_of_LIM(lim)= image_yim_ref_read(rd,sets,set);
+YS_of_LIM(lim)= set;
+CIL_of_LIM(lim)= NULL;
+cil_count= image_int_read(rd);
+if(rd->t_is_bad)
+return 0;
+if(cil_count>=0)
+{
+int cil_ix;
+int previous_ahm_id= -1;
+cil_buffer_clear(&g->t_cilar);
+for(cil_ix= 0;cil_ix<cil_count&&!rd->t_is_bad;cil_ix++)
+{
+const int ahm_id= 
+image_int_read_ranged(rd,previous_ahm_id+1,ahm_count);
+cil_buffer_push(&g->t_cilar,ahm_id);
+previous_ahm_id= ahm_id;
+}
+if(rd->t_is_bad)
+return 0;
+CIL_of_LIM(lim)= cil_buffer_add(&g->t_cilar);
+}
+}
+}
+
+/*:895*/
+#line 10886 "./marpa.w"
+
+/*896:*/
+#line 11030 "./marpa.w"
+
+{
+for(item_ix= 0;item_ix<item_count&&!rd->t_is_bad;item_ix++)
+{
+const YIM item= items[item_ix];
+const unsigned int source_type= 
+(unsigned int)image_int_read_ranged(rd,NO_SOURCE,
+SOURCE_IS_AMBIGUOUS+1);
+if(rd->t_is_bad)
+return 0;
+Source_Type_of_YIM(item)= source_type&0x7u;
+if(AHM_is_Unsourced(AHM_of_YIM(item)))
+{
+if(source_type!=NO_SOURCE)
+rd->t_is_bad= 1;
+else if(!R_is_Link_Free(r))
+(void)image_int_read(rd);
+continue;
+}
+if(R_is_Link_Free(r))
+{
+if(source_type==SOURCE_IS_AMBIGUOUS)
+LV_First_Leo_SRCL_of_YIM(item)= 
+image_srcl_chain_read(r,rd,sets,set,SOURCE_IS_LEO);
+else if(source_type!=NO_SOURCE)
+rd->t_is_bad= 1;
+continue;
+}
+switch(source_type)
+{
+case NO_SOURCE:
+{
+const SRC source= SRC_of_YIM(item);
+const int flags= image_int_read(rd);
+SRC_is_Rejected(source)= (flags&IMAGE_IS_REJECTED)!=0;
+SRC_is_Active(source)= (flags&IMAGE_IS_ACTIVE)!=0;
+}
+break;
+case SOURCE_IS_TOKEN:
+case SOURCE_IS_COMPLETION:
+case SOURCE_IS_LEO:
+image_srcl_read(rd,sets,set,SRCL_of_YIM(item),source_type,
+nsy_count);
+Next_SRCL_of_SRCL(SRCL_of_YIM(item))= NULL;
+break;
+case SOURCE_IS_AMBIGUOUS:
+LV_First_Leo_SRCL_of_YIM(item)= 
+image_srcl_chain_read(r,rd,sets,set,SOURCE_IS_LEO);
+LV_First_Token_SRCL_of_YIM(item)= 
+image_srcl_chain_read(r,rd,sets,set,SOURCE_IS_TOKEN);
+LV_First_Completion_SRCL_of_YIM(item)= 
+image_srcl_chain_read(r,rd,sets,set,SOURCE_IS_COMPLETION);
+break;
+}
+}
+}
+
+/*:896*/
+#line 10887 "./marpa.w"
+
+return!rd->t_is_bad;
+}
+
+/*:892*//*897:*/
+#line 11091 "./marpa.w"
+
+PRIVATE_NOT_INLINE int
+r_image_read(RECCE r,IMAGE_READER rd)
+{
+/*585:*/
+#line 6448 "./marpa.w"
+
+const GRAMMAR g= G_of_R(r);
+/*:585*/
+#line 11095 "./marpa.w"
+
+const int xsy_count= XSY_Count_of_G(g);
+const int nsy_count= NSY_Count_of_G(g);
+int set_count;
+YS*sets= NULL;
+int return_value= 0;
+/*898:*/
+#line 11114 "./marpa.w"
+
+{
+if(image_int_read(rd)!=IMAGE_MAGIC)
+goto CLEANUP;
+if(image_int_read(rd)!=MARPA_LIB_MAJOR_VERSION)
+goto CLEANUP;
+if(image_int_read(rd)!=MARPA_LIB_MINOR_VERSION)
+goto CLEANUP;
+if(image_int_read(rd)!=MARPA_LIB_MICRO_VERSION)
+goto CLEANUP;
+if(image_int_read(rd)!=xsy_count)
+goto CLEANUP;
+if(image_int_read(rd)!=nsy_count)
+goto CLEANUP;
+if(image_int_read(rd)!=IRL_Count_of_G(g))
+goto CLEANUP;
+if(image_int_read(rd)!=AHM_Count_of_G(g))
+goto CLEANUP;
+if(image_int_read(rd)!=ZWA_Count_of_R(r))
+goto CLEANUP;
+if((unsigned int)image_int_read(rd)!=grammar_image_hash(g))
+goto CLEANUP;
+}
+
+/*:898*/
+#line 11101 "./marpa.w"
+
+/*899:*/
+#line 11141 "./marpa.w"
+
+{
+Input_Phase_of_R(r)= 
+(unsigned int)image_int_read_ranged(rd,R_DURING_INPUT,
+R_AFTER_INPUT+1)&0x3u;
+Current_Earleme_of_R(r)= 
+image_int_read_ranged(rd,0,JEARLEME_THRESHOLD);
+Furthest_Earleme_of_R(r)= 
+image_int_read_ranged(rd,Current_Earleme_of_R(r),JEARLEME_THRESHOLD);
+R_is_Exhausted(r)= image_int_read_ranged(rd,0,2)!=0;
+r->t_use_leo_flag= image_int_read_ranged(rd,0,2)!=0;
+r->t_is_using_leo= image_int_read_ranged(rd,0,2)!=0;
+R_is_Link_Free(r)= image_int_read_ranged(rd,0,2)!=0;
+R_is_Lookahead_Filtered(r)= image_int_read_ranged(rd,0,2)!=0;
+r->t_earley_item_warning_threshold= image_int_read(rd);
+First_Inconsistent_YS_of_R(r)= image_int_read(rd);
+r->t_active_event_count= image_int_read_ranged(rd,0,INT_MAX);
+set_count= image_count_read(rd,5);
+if(set_count<=0)
+rd->t_is_bad= 1;
+if(G_is_Trivial(g)&&Input_Phase_of_R(r)!=R_AFTER_INPUT)
+rd->t_is_bad= 1;
+if(rd->t_is_bad)
+goto CLEANUP;
+}
+
+/*:899*/
+#line 11102 "./marpa.w"
+
+/*900:*/
+#line 11167 "./marpa.w"
+
+{
+ZWAID zwaid;
+const int zwa_count= ZWA_Count_of_R(r);
+r->t_valued_terminal= lbv_obs_new0(r->t_obs,xsy_count);
+r->t_unvalued_terminal= lbv_obs_new0(r->t_obs,xsy_count);
+r->t_valued= lbv_obs_new0(r->t_obs,xsy_count);
+r->t_unvalued= lbv_obs_new0(r->t_obs,xsy_count);
+r->t_valued_locked= lbv_obs_new0(r->t_obs,xsy_count);
+image_lbv_read(rd,r->t_lbv_xsyid_completion_event_is_active,xsy_count);
+image_lbv_read(rd,r->t_lbv_xsyid_nulled_event_is_active,xsy_count);
+image_lbv_read(rd,r->t_lbv_xsyid_prediction_event_is_active,xsy_count);
+image_lbv_read(rd,r->t_nsy_expected_is_event,nsy_count);
+image_lbv_read(rd,r->t_valued_terminal,xsy_count);
+image_lbv_read(rd,r->t_unvalued_terminal,xsy_count);
+image_lbv_read(rd,r->t_valued,xsy_count);
+image_lbv_read(rd,r->t_unvalued,xsy_count);
+image_lbv_read(rd,r->t_valued_locked,xsy_count);
+image_lbv_read(rd,r->t_bv_nsyid_is_expected,nsy_count);
+for(zwaid= 0;zwaid<zwa_count;zwaid++)
+{
+const ZWA zwa= RZWA_by_ID(zwaid);
+Memo_Value_of_ZWA(zwa)= image_int_read_ranged(rd,0,2)!=0;
+Memo_YSID_of_ZWA(zwa)= image_int_read_ranged(rd,-1,set_count);
+}
+if(rd->t_is_bad)
+goto CLEANUP;
+if(!G_is_Trivial(g))
+{
+psar_reset(Dot_PSAR_of_R(r));
+/*944:*/
+#line 12051 "./marpa.w"
+
+r->t_bv_lim_symbols= bv_obs_create(r->t_obs,nsy_count);
+r->t_bv_pim_symbols= bv_obs_create(r->t_obs,nsy_count);
+r->t_pim_workarea= marpa_obs_new(r->t_obs,void*,nsy_count);
+/*:944*//*963:*/
+#line 12333 "./marpa.w"
+
+r->t_lim_chain= marpa_obs_new(r->t_obs,void*,2*nsy_count);
+/*:963*/
+#line 11197 "./marpa.w"
+
+/*782:*/
+#line 8952 "./marpa.w"
+
+{
+if(!MARPA_DSTACK_IS_INITIALIZED(r->t_yim_work_stack))
+{
+MARPA_DSTACK_INIT2(r->t_yim_work_stack,YIM,Allocator_of_G(g));
+}
+}
+/*:782*//*786:*/
+#line 8967 "./marpa.w"
+
+{
+if(!MARPA_DSTACK_IS_INITIALIZED(r->t_completion_stack))
+{
+MARPA_DSTACK_INIT2(r->t_completion_stack,YIM,Allocator_of_G(g));
+}
+}
+/*:786*/
+#line 11198 "./marpa.w"
+
+}
+}
+
+/*:900*/
+#line 11103 "./marpa.w"
+
+/*901:*/
+#line 11205 "./marpa.w"
+
+{
+int set_ix;
+sets= marpa__a_malloc(Allocator_of_G(g),sizeof(YS)*(size_t)set_count);
+for(set_ix= 0;set_ix<set_count;set_ix++)
+{
+YS set;
+const JEARLEME earleme= 
+image_int_read_ranged(rd,
+set_ix?Earleme_of_YS(sets[set_ix-1])+
+1:0,Current_Earleme_of_R(r)+1);
+const int value= image_int_read(rd);
+if(rd->t_is_bad||(set_ix==0&&earleme!=0))
+goto CLEANUP;
+set= earley_set_new(r,earleme);
+Value_of_YS(set)= value;
+sets[set_ix]= set;
+if(set_ix==0)
+{
+First_YS_of_R(r)= set;
+}
+else
+{
+Next_YS_of_YS(sets[set_ix-1])= set;
+}
+Latest_YS_of_R(r)= set;
+if(!ys_image_read(r,rd,sets,set))
+goto CLEANUP;
+}
+}
+
+/*:901*/
+#line 11104 "./marpa.w"
+
+/*902:*/
+#line 11236 "./marpa.w"
+
+{
+int alt_ix;
+const int alternative_count= image_count_read(rd,5);
+for(alt_ix= 0;alt_ix<alternative_count&&!rd->t_is_bad;alt_ix++)
+{
+const ALT alternative= 
+MARPA_DSTACK_PUSH(r->t_alternatives,ALT_Object);
+Start_YS_of_ALT(alternative)= 
+sets[image_int_read_ranged(rd,0,set_count)];
+End_Earleme_of_ALT(alternative)= 
+image_int_read_ranged(rd,Current_Earleme_of_R(r)+1,
+JEARLEME_THRESHOLD);
+NSYID_of_ALT(alternative)= image_int_read_ranged(rd,0,nsy_count);
+Value_of_ALT(alternative)= image_int_read(rd);
+ALT_is_Valued(alternative)= image_int_read_ranged(rd,0,2)!=0;
+}
+if(rd->t_is_bad)
+goto CLEANUP;
+}
+
+/*:902*/
+#line 11105 "./marpa.w"
+
+if(image_int_read(rd)!=IMAGE_MAGIC||rd->t_offset!=rd->t_length)
+goto CLEANUP;
+return_value= !rd->t_is_bad;
+CLEANUP:;
+marpa__a_free(Allocator_of_G(g),sets);
+return return_value;
+}
+
+/*:897*//*903:*/
+#line 11261 "./marpa.w"
+
+Marpa_Recognizer
+marpa_r_deserialize(Marpa_Grammar g,const void*image,int image_size)
+{
+/*1499:*/
+#line 19377 "./marpa.w"
+void*const failure_indicator= NULL;
+/*:1499*/
+#line 11265 "./marpa.w"
+
+RECCE r;
+IMAGE_READER_Object reader;
+/*1503:*/
+#line 19396 "./marpa.w"
+
+if(_MARPA_UNLIKELY(!G_is_Precomputed(g))){
+MARPA_ERROR(MARPA_ERR_NOT_PRECOMPUTED);
+return failure_indicator;
+}
+/*:1503*/
+#line 11268 "./marpa.w"
+
+if(_MARPA_UNLIKELY(!image||image_size<0))
+{
+MARPA_ERROR(MARPA_ERR_INVALID_IMAGE);
+return failure_indicator;
+}
+r= marpa_r_new(g);
+if(!r)
+return failure_indicator;
+G_EVENTS_CLEAR(g);
+reader.t_image= image;
+reader.t_length= (size_t)image_size;
+reader.t_offset= 0;
+reader.t_is_bad= 0;
+if(!r_image_read(r,&reader))
+{
+marpa_r_unref(r);
+MARPA_ERROR(MARPA_ERR_INVALID_IMAGE);
+return failure_indicator;
+}
+return r;
+}
+
+/*:903*//*908:*/
+#line 11329 "./marpa.w"
+
+PRIVATE void
+image_cil_write(IMAGE_WRITER w,CIL cil)
+{
+int ix;
+if(!cil)
+{
+image_int_write(w,-1);
+return;
+}
+image_int_write(w,Count_of_CIL(cil));
+for(ix= 0;ix<Count_of_CIL(cil);ix++)
+{
+image_int_write(w,Item_of_CIL(cil,ix));
+}
+}
+
+/*:908*//*909:*/
+#line 11346 "./marpa.w"
+
+PRIVATE_NOT_INLINE void
+g_image_write(GRAMMAR g,IMAGE_WRITER w)
+{
+const int xsy_count= XSY_Count_of_G(g);
+const int nsy_count= NSY_Count_of_G(g);
+const int xrl_count= XRL_Count_of_G(g);
+const int irl_count= IRL_Count_of_G(g);
+const int ahm_count= AHM_Count_of_G(g);
+const int zwa_count= ZWA_Count_of_G(g);
+const int event_count= G_EVENT_COUNT(g);
+/*910:*/
+#line 11368 "./marpa.w"
+
+{
+image_int_write(w,G_IMAGE_MAGIC);
+image_int_write(w,MARPA_LIB_MAJOR_VERSION);
+image_int_write(w,MARPA_LIB_MINOR_VERSION);
+image_int_write(w,MARPA_LIB_MICRO_VERSION);
+image_int_write(w,xsy_count);
+image_int_write(w,nsy_count);
+image_int_write(w,xrl_count);
+image_int_write(w,irl_count);
+image_int_write(w,ahm_count);
+image_int_write(w,zwa_count);
+image_int_write(w,event_count);
+}
+
+/*:910*/
+#line 11357 "./marpa.w"
+
+/*911:*/
+#line 11383 "./marpa.w"
+
+{
+image_int_write(w,g->t_start_xsy_id);
+image_int_write(w,g->t_start_irl?ID_of_IRL(g->t_start_irl):-1);
+image_int_write(w,Default_Rank_of_G(g));
+image_int_write(w,g->t_force_valued);
+image_int_write(w,SYMI_Count_of_G(g));
+image_int_write(w,g->t_has_cycle);
+}
+
+/*:911*/
+#line 11358 "./marpa.w"
+
+/*912:*/
+#line 11395 "./marpa.w"
+
+{
+XSYID xsy_id;
+for(xsy_id= 0;xsy_id<xsy_count;xsy_id++)
+{
+const XSY xsy= XSY_by_ID(xsy_id);
+image_int_write(w,Rank_of_XSY(xsy));
+image_int_write(w,XSY_is_LHS(xsy));
+image_int_write(w,XSY_is_Sequence_LHS(xsy));
+image_int_write(w,XSY_is_Valued(xsy));
+image_int_write(w,XSY_is_Valued_Locked(xsy));
+image_int_write(w,XSY_is_Accessible(xsy));
+image_int_write(w,xsy->t_is_counted);
+image_int_write(w,XSY_is_Nulling(xsy));
+image_int_write(w,XSY_is_Nullable(xsy));
+image_int_write(w,XSY_is_Terminal(xsy));
+image_int_write(w,XSY_is_Locked_Terminal(xsy));
+image_int_write(w,XSY_is_Productive(xsy));
+image_int_write(w,XSY_is_Completion_Event(xsy));
+image_int_write(w,XSY_Completion_Event_Starts_Active(xsy));
+image_int_write(w,XSY_is_Nulled_Event(xsy));
+image_int_write(w,XSY_Nulled_Event_Starts_Active(xsy));
+image_int_write(w,XSY_is_Prediction_Event(xsy));
+image_int_write(w,XSY_Prediction_Event_Starts_Active(xsy));
+image_cil_write(w,Nulled_XSYIDs_of_XSY(xsy));
+}
+}
+
+/*:912*/
+#line 11359 "./marpa.w"
+
+/*913:*/
+#line 11423 "./marpa.w"
+
+{
+XRLID xrl_id;
+for(xrl_id= 0;xrl_id<xrl_count;xrl_id++)
+{
+const XRL xrl= XRL_by_ID(xrl_id);
+const int length= Length_of_XRL(xrl);
+int symbol_ix;
+image_int_write(w,length);
+for(symbol_ix= 0;symbol_ix<=length;symbol_ix++)
+{
+image_int_write(w,xrl->t_symbols[symbol_ix]);
+}
+image_int_write(w,Rank_of_XRL(xrl));
+image_int_write(w,Null_Ranks_High_of_RULE(xrl));
+image_int_write(w,XRL_is_BNF(xrl));
+image_int_write(w,XRL_is_Sequence(xrl));
+image_int_write(w,Minimum_of_XRL(xrl));
+image_int_write(w,Separator_of_XRL(xrl));
+image_int_write(w,xrl->t_is_discard);
+image_int_write(w,XRL_is_Proper_Separation(xrl));
+image_int_write(w,xrl->t_is_loop);
+image_int_write(w,XRL_is_Nulling(xrl));
+image_int_write(w,XRL_is_Nullable(xrl));
+image_int_write(w,XRL_is_Accessible(xrl));
+image_int_write(w,XRL_is_Productive(xrl));
+image_int_write(w,XRL_is_Used(xrl));
+}
+}
+
+/*:913*/
+#line 11360 "./marpa.w"
+
+/*914:*/
+#line 11453 "./marpa.w"
+
+{
+NSYID nsyid;
+XSYID xsy_id;
+for(nsyid= 0;nsyid<nsy_count;nsyid++)
+{
+const NSY nsy= NSY_by_ID(nsyid);
+const XSY source_xsy= Source_XSY_of_NSY(nsy);
+const XRL lhs_xrl= LHS_XRL_of_NSY(nsy);
+image_int_write(w,source_xsy?ID_of_XSY(source_xsy):-1);
+image_int_write(w,lhs_xrl?ID_of_XRL(lhs_xrl):-1);
+image_int_write(w,XRL_Offset_of_NSY(nsy));
+image_int_write(w,Rank_of_NSY(nsy));
+image_int_write(w,NSY_is_Start(nsy));
+image_int_write(w,NSY_is_LHS(nsy));
+image_int_write(w,NSY_is_Nulling(nsy));
+image_int_write(w,NSY_is_Semantic(nsy));
+image_cil_write(w,LHS_CIL_of_NSY(nsy));
+image_cil_write(w,Lookahead_CIL_of_NSY(nsy));
+}
+for(xsy_id= 0;xsy_id<xsy_count;xsy_id++)
+{
+const XSY xsy= XSY_by_ID(xsy_id);
+const NSY nsy= NSY_of_XSY(xsy);
+const NSY nulling_nsy= Nulling_NSY_of_XSY(xsy);
+image_int_write(w,nsy?ID_of_NSY(nsy):-1);
+image_int_write(w,nulling_nsy?ID_of_NSY(nulling_nsy):-1);
+}
+}
+
+/*:914*/
+#line 11361 "./marpa.w"
+
+/*915:*/
+#line 11483 "./marpa.w"
+
+{
+IRLID irl_id;
+for(irl_id= 0;irl_id<irl_count;irl_id++)
+{
+const IRL irl= IRL_by_ID(irl_id);
+const int length= Length_of_IRL(irl);
+const XRL source_xrl= Source_XRL_of_IRL(irl);
+int symbol_ix;
+image_int_write(w,length);
+for(symbol_ix= 0;symbol_ix<=length;symbol_ix++)
+{
+image_int_write(w,irl->t_nsyid_array[symbol_ix]);
+}
+image_int_write(w,source_xrl?ID_of_XRL(source_xrl):-1);
+image_int_write(w,AHM_Count_of_IRL(irl));
+image_int_write(w,Real_SYM_Count_of_IRL(irl));
+image_int_write(w,Virtual_Start_of_IRL(irl));
+image_int_write(w,Virtual_End_of_IRL(irl));
+image_int_write(w,Rank_of_IRL(irl));
+image_int_write(w,SYMI_of_IRL(irl));
+image_int_write(w,Last_Proper_SYMI_of_IRL(irl));
+image_int_write(w,IRL_has_Virtual_LHS(irl));
+image_int_write(w,IRL_has_Virtual_RHS(irl));
+image_int_write(w,IRL_is_Right_Recursive(irl));
+image_int_write(w,IRL_is_CHAF(irl));
+}
+}
+
+/*:915*/
+#line 11362 "./marpa.w"
+
+/*916:*/
+#line 11512 "./marpa.w"
+
+{
+AHMID ahm_id;
+for(ahm_id= 0;ahm_id<ahm_count;ahm_id++)
+{
+const AHM ahm= AHM_by_ID(ahm_id);
+const XRL xrl= XRL_of_AHM(ahm);
+image_int_write(w,IRLID_of_AHM(ahm));
+image_int_write(w,xrl?ID_of_XRL(xrl):-1);
+image_int_write(w,Postdot_NSYID_of_AHM(ahm));
+image_int_write(w,Null_Count_of_AHM(ahm));
+image_int_write(w,Position_of_AHM(ahm));
+image_int_write(w,Quasi_Position_of_AHM(ahm));
+image_int_write(w,SYMI_of_AHM(ahm));
+image_int_write(w,XRL_Position_of_AHM(ahm));
+image_int_write(w,Event_Group_Size_of_AHM(ahm));
+image_int_write(w,AHM_predicts_ZWA(ahm));
+image_int_write(w,AHM_was_Predicted(ahm));
+image_int_write(w,AHM_is_Initial(ahm));
+image_cil_write(w,Predicted_IRL_CIL_of_AHM(ahm));
+image_cil_write(w,LHS_CIL_of_AHM(ahm));
+image_cil_write(w,Prediction_Bundle_of_AHM(ahm));
+image_cil_write(w,ZWA_CIL_of_AHM(ahm));
+image_cil_write(w,Completion_XSYIDs_of_AHM(ahm));
+image_cil_write(w,Nulled_XSYIDs_of_AHM(ahm));
+image_cil_write(w,Prediction_XSYIDs_of_AHM(ahm));
+image_cil_write(w,Event_AHMIDs_of_AHM(ahm));
+}
+}
+
+/*:916*/
+#line 11363 "./marpa.w"
+
+/*917:*/
+#line 11542 "./marpa.w"
+
+{
+ZWAID zwaid;
+int event_ix;
+for(zwaid= 0;zwaid<zwa_count;zwaid++)
+{
+image_int_write(w,Default_Value_of_GZWA(GZWA_by_ID(zwaid)));
+}
+for(event_ix= 0;event_ix<event_count;event_ix++)
+{
+const GEV event= MARPA_DSTACK_INDEX(g->t_events,GEV_Object,event_ix);
+image_int_write(w,event->t_type);
+image_int_write(w,event->t_value);
+}
+}
+
+/*:917*/
+#line 11364 "./marpa.w"
+
+image_int_write(w,G_IMAGE_MAGIC);
+}
+
+/*:909*//*918:*/
+#line 11563 "./marpa.w"
+
+int
+marpa_g_serialize(Marpa_Grammar g,void*buffer,int buffer_size)
+{
+/*1500:*/
+#line 19380 "./marpa.w"
+const int failure_indicator= -2;
+/*:1500*/
+#line 11567 "./marpa.w"
+
+IMAGE_WRITER_Object writer;
+/*1521:*/
+#line 19518 "./marpa.w"
+
+if(HEADER_VERSION_MISMATCH){
+MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
+return failure_indicator;
+}
+if(_MARPA_UNLIKELY(!IS_G_OK(g))){
+MARPA_ERROR(g->t_error);
+return failure_indicator;
+}
+
+/*:1521*/
+#line 11569 "./marpa.w"
+
+/*1503:*/
+#line 19396 "./marpa.w"
+
+if(_MARPA_UNLIKELY(!G_is_Precomputed(g))){
+MARPA_ERROR(MARPA_ERR_NOT_PRECOMPUTED);
+return failure_indicator;
+}
+/*:1503*/
+#line 11570 "./marpa.w"
+
+if(_MARPA_UNLIKELY(buffer_size<0||(buffer_size> 0&&!buffer)))
+{
+MARPA_ERROR(MARPA_ERR_INVALID_IMAGE);
+return failure_indicator;
+}
+writer.t_buffer= buffer;
+writer.t_capacity= (size_t)buffer_size;
+writer.t_length= 0;
+g_image_write(g,&writer);
+if(_MARPA_UNLIKELY(writer.t_length> INT_MAX))
+{
+MARPA_ERROR(MARPA_ERR_INVALID_IMAGE);
+return failure_indicator;
+}
+return(int)writer.t_length;
+}
+
+/*:918*//*919:*/
+#line 11594 "./marpa.w"
+
+PRIVATE CIL
+image_cil_read(IMAGE_READER rd,CILAR cilar,int limit)
+{
+int count;
+int ix;
+const size_t ints_left= (rd->t_length-rd->t_offset)/sizeof(int);
+count= image_int_read(rd);
+if(count==-1)
+return NULL;
+if(count<0||(size_t)count> ints_left)
+{
+rd->t_is_bad= 1;
+return NULL;
+}
+cil_buffer_clear(cilar);
+for(ix= 0;ix<count;ix++)
+{
+cil_buffer_push(cilar,image_int_read_ranged(rd,0,limit));
+}
+return cil_buffer_add(cilar);
+}
+
+/*:919*//*920:*/
+#line 11621 "./marpa.w"
+
+PRIVATE_NOT_INLINE int
+g_image_read(GRAMMAR g,IMAGE_READER rd)
+{
+int xsy_count;
+int nsy_count;
+int xrl_count;
+int irl_count;
+int ahm_count;
+int zwa_count;
+int event_count;
+int post_census_xsy_count;
+int start_irl_id;
+int return_value= 0;
+/*921:*/
+#line 11655 "./marpa.w"
+
+{
+if(image_int_read(rd)!=G_IMAGE_MAGIC)
+goto CLEANUP;
+if(image_int_read(rd)!=MARPA_LIB_MAJOR_VERSION)
+goto CLEANUP;
+if(image_int_read(rd)!=MARPA_LIB_MINOR_VERSION)
+goto CLEANUP;
+if(image_int_read(rd)!=MARPA_LIB_MICRO_VERSION)
+goto CLEANUP;
+xsy_count= image_count_read(rd,10);
+nsy_count= image_count_read(rd,10);
+xrl_count= image_count_read(rd,10);
+irl_count= image_count_read(rd,10);
+ahm_count= image_count_read(rd,2);
+zwa_count= image_count_read(rd,1);
+event_count= image_count_read(rd,2);
+post_census_xsy_count= xsy_count;
+if(rd->t_is_bad)
+goto CLEANUP;
+}
+
+/*:921*/
+#line 11635 "./marpa.w"
+
+/*922:*/
+#line 11677 "./marpa.w"
+
+{
+g->t_start_xsy_id= image_int_read_ranged(rd,-1,xsy_count);
+start_irl_id= image_int_read_ranged(rd,-1,irl_count);
+Default_Rank_of_G(g)= 
+image_int_read_ranged(rd,MINIMUM_RANK,MAXIMUM_RANK+1);
+g->t_force_valued= image_int_read_ranged(rd,0,2);
+SYMI_Count_of_G(g)= image_int_read_ranged(rd,0,INT_MAX);
+g->t_has_cycle= image_int_read_ranged(rd,0,2)!=0;
+if((start_irl_id>=0)!=(ahm_count> 0))
+rd->t_is_bad= 1;
+if(rd->t_is_bad)
+goto CLEANUP;
+}
+
+/*:922*/
+#line 11636 "./marpa.w"
+
+/*923:*/
+#line 11692 "./marpa.w"
+
+{
+int xsy_ix;
+for(xsy_ix= 0;xsy_ix<xsy_count;xsy_ix++)
+{
+const XSY xsy= symbol_new(g);
+Rank_of_XSY(xsy)= 
+image_int_read_ranged(rd,MINIMUM_RANK,MAXIMUM_RANK+1);
+XSY_is_LHS(xsy)= image_int_read_ranged(rd,0,2)!=0;
+XSY_is_Sequence_LHS(xsy)= image_int_read_ranged(rd,0,2)!=0;
+XSY_is_Valued(xsy)= image_int_read_ranged(rd,0,2)!=0;
+XSY_is_Valued_Locked(xsy)= image_int_read_ranged(rd,0,2)!=0;
+XSY_is_Accessible(xsy)= image_int_read_ranged(rd,0,2)!=0;
+xsy->t_is_counted= image_int_read_ranged(rd,0,2)!=0;
+XSY_is_Nulling(xsy)= image_int_read_ranged(rd,0,2)!=0;
+XSY_is_Nullable(xsy)= image_int_read_ranged(rd,0,2)!=0;
+XSY_is_Terminal(xsy)= image_int_read_ranged(rd,0,2)!=0;
+XSY_is_Locked_Terminal(xsy)= image_int_read_ranged(rd,0,2)!=0;
+XSY_is_Productive(xsy)= image_int_read_ranged(rd,0,2)!=0;
+XSY_is_Completion_Event(xsy)= image_int_read_ranged(rd,0,2)!=0;
+XSY_Completion_Event_Starts_Active(xsy)= 
+image_int_read_ranged(rd,0,2)!=0;
+XSY_is_Nulled_Event(xsy)= image_int_read_ranged(rd,0,2)!=0;
+XSY_Nulled_Event_Starts_Active(xsy)= 
+image_int_read_ranged(rd,0,2)!=0;
+XSY_is_Prediction_Event(xsy)= image_int_read_ranged(rd,0,2)!=0;
+XSY_Prediction_Event_Starts_Active(xsy)= 
+image_int_read_ranged(rd,0,2)!=0;
+Nulled_XSYIDs_of_XSY(xsy)= 
+image_cil_read(rd,&g->t_cilar,xsy_count);
+if(rd->t_is_bad)
+goto CLEANUP;
+}
+}
+
+/*:923*/
+#line 11637 "./marpa.w"
+
+/*924:*/
+#line 11729 "./marpa.w"
+
+{
+int xrl_ix;
+for(xrl_ix= 0;xrl_ix<xrl_count;xrl_ix++)
+{
+XRL xrl;
+int symbol_ix;
+const int length= image_count_read(rd,1);
+const size_t sizeof_xrl= offsetof(struct s_xrl,t_symbols)+
+((size_t)length+1)*sizeof(xrl->t_symbols[0]);
+if(rd->t_is_bad||length> MAX_RHS_LENGTH)
+goto CLEANUP;
+xrl= marpa_obs_start(g->t_xrl_obs,sizeof_xrl,ALIGNOF(XRL));
+Length_of_XRL(xrl)= length;
+for(symbol_ix= 0;symbol_ix<=length;symbol_ix++)
+{
+xrl->t_symbols[symbol_ix]= image_int_read_ranged(rd,0,xsy_count);
+}
+xrl_finish(g,xrl);
+xrl= marpa_obs_finish(g->t_xrl_obs);
+Rank_of_XRL(xrl)= 
+image_int_read_ranged(rd,MINIMUM_RANK,MAXIMUM_RANK+1);
+Null_Ranks_High_of_RULE(xrl)= image_int_read_ranged(rd,0,2)!=0;
+XRL_is_BNF(xrl)= image_int_read_ranged(rd,0,2)!=0;
+XRL_is_Sequence(xrl)= image_int_read_ranged(rd,0,2)!=0;
+Minimum_of_XRL(xrl)= image_int_read_ranged(rd,-1,INT_MAX);
+Separator_of_XRL(xrl)= image_int_read_ranged(rd,-1,xsy_count);
+xrl->t_is_discard= image_int_read_ranged(rd,0,2)!=0;
+XRL_is_Proper_Separation(xrl)= image_int_read_ranged(rd,0,2)!=0;
+xrl->t_is_loop= image_int_read_ranged(rd,0,2)!=0;
+XRL_is_Nulling(xrl)= image_int_read_ranged(rd,0,2)!=0;
+XRL_is_Nullable(xrl)= image_int_read_ranged(rd,0,2)!=0;
+XRL_is_Accessible(xrl)= image_int_read_ranged(rd,0,2)!=0;
+XRL_is_Productive(xrl)= image_int_read_ranged(rd,0,2)!=0;
+XRL_is_Used(xrl)= image_int_read_ranged(rd,0,2)!=0;
+if(rd->t_is_bad)
+goto CLEANUP;
+}
+}
+
+/*:924*/
+#line 11638 "./marpa.w"
+
+/*925:*/
+#line 11769 "./marpa.w"
+
+{
+int nsy_ix;
+XSYID xsy_id;
+/*537:*/
+#line 5693 "./marpa.w"
+
+{
+MARPA_DSTACK_INIT(g->t_nsy_stack,NSY,2*MARPA_DSTACK_CAPACITY(g->t_xsy_stack),Allocator_of_G(g));
+}
+
+/*:537*/
+#line 11773 "./marpa.w"
+
+for(nsy_ix= 0;nsy_ix<nsy_count;nsy_ix++)
+{
+const NSY nsy= nsy_start(g);
+const XSYID source_xsy_id= image_int_read_ranged(rd,-1,xsy_count);
+const XRLID lhs_xrl_id= image_int_read_ranged(rd,-1,xrl_count);
+Source_XSY_of_NSY(nsy)= 
+source_xsy_id>=0?XSY_by_ID(source_xsy_id):NULL;
+LHS_XRL_of_NSY(nsy)= lhs_xrl_id>=0?XRL_by_ID(lhs_xrl_id):NULL;
+XRL_Offset_of_NSY(nsy)= image_int_read(rd);
+Rank_of_NSY(nsy)= image_int_read(rd);
+NSY_is_Start(nsy)= image_int_read_ranged(rd,0,2)!=0;
+NSY_is_LHS(nsy)= image_int_read_ranged(rd,0,2)!=0;
+NSY_is_Nulling(nsy)= image_int_read_ranged(rd,0,2)!=0;
+NSY_is_Semantic(nsy)= image_int_read_ranged(rd,0,2)!=0;
+LHS_CIL_of_NSY(nsy)= image_cil_read(rd,&g->t_cilar,irl_count);
+Lookahead_CIL_of_NSY(nsy)= 
+image_cil_read(rd,&g->t_cilar,ahm_count);
+if(rd->t_is_bad)
+goto CLEANUP;
+}
+for(xsy_id= 0;xsy_id<xsy_count;xsy_id++)
+{
+const XSY xsy= XSY_by_ID(xsy_id);
+const NSYID nsyid= image_int_read_ranged(rd,-1,nsy_count);
+const NSYID nulling_nsyid= image_int_read_ranged(rd,-1,nsy_count);
+NSY_of_XSY(xsy)= nsyid>=0?NSY_by_ID(nsyid):NULL;
+Nulling_NSY_of_XSY(xsy)= 
+nulling_nsyid>=0?NSY_by_ID(nulling_nsyid):NULL;
+}
+if(rd->t_is_bad)
+goto CLEANUP;
+}
+
+/*:925*/
+#line 11639 "./marpa.w"
+
+/*926:*/
+#line 11807 "./marpa.w"
+
+{
+int irl_ix;
+/*536:*/
+#line 5685 "./marpa.w"
+
+MARPA_DSTACK_INIT(g->t_irl_stack,IRL,2*MARPA_DSTACK_CAPACITY(g->t_xrl_stack),Allocator_of_G(g));
+
+/*:536*/
+#line 11810 "./marpa.w"
+
+for(irl_ix= 0;irl_ix<irl_count;irl_ix++)
+{
+IRL irl;
+int symbol_ix;
+XRLID source_xrl_id;
+const int length= image_count_read(rd,1);
+if(rd->t_is_bad||length> MAX_RHS_LENGTH)
+goto CLEANUP;
+irl= irl_start(g,length);
+for(symbol_ix= 0;symbol_ix<=length;symbol_ix++)
+{
+irl->t_nsyid_array[symbol_ix]= 
+image_int_read_ranged(rd,0,nsy_count);
+}
+source_xrl_id= image_int_read_ranged(rd,-1,xrl_count);
+Source_XRL_of_IRL(irl)= 
+source_xrl_id>=0?XRL_by_ID(source_xrl_id):NULL;
+AHM_Count_of_IRL(irl)= image_int_read_ranged(rd,0,ahm_count+1);
+Real_SYM_Count_of_IRL(irl)= image_int_read_ranged(rd,0,length+1);
+Virtual_Start_of_IRL(irl)= image_int_read(rd);
+Virtual_End_of_IRL(irl)= image_int_read(rd);
+Rank_of_IRL(irl)= image_int_read(rd);
+SYMI_of_IRL(irl)= image_int_read(rd);
+Last_Proper_SYMI_of_IRL(irl)= image_int_read(rd);
+IRL_has_Virtual_LHS(irl)= image_int_read_ranged(rd,0,2)!=0;
+IRL_has_Virtual_RHS(irl)= image_int_read_ranged(rd,0,2)!=0;
+IRL_is_Right_Recursive(irl)= image_int_read_ranged(rd,0,2)!=0;
+IRL_is_CHAF(irl)= image_int_read_ranged(rd,0,2)!=0;
+if(rd->t_is_bad)
+goto CLEANUP;
+}
+g->t_start_irl= start_irl_id>=0?IRL_by_ID(start_irl_id):NULL;
+}
+
+/*:926*/
+#line 11640 "./marpa.w"
+
+/*927:*/
+#line 11848 "./marpa.w"
+
+{
+AHMID ahm_id;
+if(ahm_count> 0)
+{
+g->t_ahms= marpa_a_new(Allocator_of_G(g),struct s_ahm,ahm_count);
+AHM_Count_of_G(g)= ahm_count;
+}
+for(ahm_id= 0;ahm_id<ahm_count;ahm_id++)
+{
+const AHM ahm= AHM_by_ID(ahm_id);
+const IRL irl= IRL_by_ID(image_int_read_ranged(rd,0,irl_count));
+const XRLID xrl_id= image_int_read_ranged(rd,-1,xrl_count);
+IRL_of_AHM(ahm)= irl;
+XRL_of_AHM(ahm)= xrl_id>=0?XRL_by_ID(xrl_id):NULL;
+Postdot_NSYID_of_AHM(ahm)= image_int_read_ranged(rd,-1,nsy_count);
+Null_Count_of_AHM(ahm)= 
+image_int_read_ranged(rd,0,Length_of_IRL(irl)+1);
+Position_of_AHM(ahm)= 
+image_int_read_ranged(rd,-1,Length_of_IRL(irl));
+Quasi_Position_of_AHM(ahm)= 
+image_int_read_ranged(rd,0,Length_of_IRL(irl)+1);
+SYMI_of_AHM(ahm)= image_int_read(rd);
+XRL_Position_of_AHM(ahm)= image_int_read(rd);
+Event_Group_Size_of_AHM(ahm)= image_int_read_ranged(rd,0,INT_MAX);
+AHM_predicts_ZWA(ahm)= image_int_read_ranged(rd,0,2)!=0;
+AHM_was_Predicted(ahm)= image_int_read_ranged(rd,0,2)!=0;
+AHM_is_Initial(ahm)= image_int_read_ranged(rd,0,2)!=0;
+Predicted_IRL_CIL_of_AHM(ahm)= 
+image_cil_read(rd,&g->t_cilar,irl_count);
+LHS_CIL_of_AHM(ahm)= image_cil_read(rd,&g->t_cilar,irl_count);
+Prediction_Bundle_of_AHM(ahm)= 
+image_cil_read(rd,&g->t_cilar,ahm_count);
+ZWA_CIL_of_AHM(ahm)= image_cil_read(rd,&g->t_cilar,zwa_count);
+Completion_XSYIDs_of_AHM(ahm)= 
+image_cil_read(rd,&g->t_cilar,xsy_count);
+Nulled_XSYIDs_of_AHM(ahm)= 
+image_cil_read(rd,&g->t_cilar,xsy_count);
+Prediction_XSYIDs_of_AHM(ahm)= 
+image_cil_read(rd,&g->t_cilar,xsy_count);
+Event_AHMIDs_of_AHM(ahm)= image_cil_read(rd,&g->t_cilar,ahm_count);
+if(rd->t_is_bad)
+goto CLEANUP;
+if((Position_of_AHM(ahm)<0)!=(Postdot_NSYID_of_AHM(ahm)<0))
+goto CLEANUP;
+if(Position_of_AHM(ahm)>=0
+&&Postdot_NSYID_of_AHM(ahm)!=RHSID_of_IRL(irl,
+Position_of_AHM
+(ahm)))
+goto CLEANUP;
+}
+}
+
+/*:927*/
+#line 11641 "./marpa.w"
+
+/*928:*/
+#line 11901 "./marpa.w"
+
+{
+int zwa_ix;
+int event_ix;
+for(zwa_ix= 0;zwa_ix<zwa_count;zwa_ix++)
+{
+const GZWA gzwa= marpa_obs_new(g->t_obs,GZWA_Object,1);
+*MARPA_DSTACK_PUSH((g)->t_gzwa_stack,GZWA)= gzwa;
+gzwa->t_id= zwa_ix;
+gzwa->t_default_value= image_int_read_ranged(rd,0,2)!=0;
+}
+G_EVENTS_CLEAR(g);
+for(event_ix= 0;event_ix<event_count;event_ix++)
+{
+const int type= image_int_read(rd);
+const int value= image_int_read(rd);
+int_event_new(g,type,value);
+}
+}
+
+/*:928*/
+#line 11642 "./marpa.w"
+
+if(image_int_read(rd)!=G_IMAGE_MAGIC||rd->t_offset!=rd->t_length)
+goto CLEANUP;
+if(rd->t_is_bad)
+goto CLEANUP;
+/*929:*/
+#line 11926 "./marpa.w"
+
+{
+/*549:*/
+#line 5937 "./marpa.w"
+
+{
+int xsyid;
+g->t_lbv_xsyid_is_completion_event= 
+bv_obs_create(g->t_obs,post_census_xsy_count);
+g->t_lbv_xsyid_completion_event_starts_active= 
+bv_obs_create(g->t_obs,post_census_xsy_count);
+g->t_lbv_xsyid_is_nulled_event= 
+bv_obs_create(g->t_obs,post_census_xsy_count);
+g->t_lbv_xsyid_nulled_event_starts_active= 
+bv_obs_create(g->t_obs,post_census_xsy_count);
+g->t_lbv_xsyid_is_prediction_event= 
+bv_obs_create(g->t_obs,post_census_xsy_count);
+g->t_lbv_xsyid_prediction_event_starts_active= 
+bv_obs_create(g->t_obs,post_census_xsy_count);
+for(xsyid= 0;xsyid<post_census_xsy_count;xsyid++)
+{
+if(XSYID_is_Completion_Event(xsyid))
+{
+lbv_bit_set(g->t_lbv_xsyid_is_completion_event,xsyid);
+}
+if(XSYID_Completion_Event_Starts_Active(xsyid))
+{
+lbv_bit_set(g->t_lbv_xsyid_completion_event_starts_active,xsyid);
+}
+if(XSYID_is_Nulled_Event(xsyid))
+{
+lbv_bit_set(g->t_lbv_xsyid_is_nulled_event,xsyid);
+}
+if(XSYID_Nulled_Event_Starts_Active(xsyid))
+{
+lbv_bit_set(g->t_lbv_xsyid_nulled_event_starts_active,xsyid);
+}
+if(XSYID_is_Prediction_Event(xsyid))
+{
+lbv_bit_set(g->t_lbv_xsyid_is_prediction_event,xsyid);
+}
+if(XSYID_Prediction_Event_Starts_Active(xsyid))
+{
+lbv_bit_set(g->t_lbv_xsyid_prediction_event_starts_active,xsyid);
+}
+}
+}
+
+/*:549*/
+#line 11928 "./marpa.w"
+
+if(!G_is_Trivial(g))
+{
+/*517:*/
+#line 5491 "./marpa.w"
+
+{
+AHM items= g->t_ahms;
+AHMID item_id= (AHMID)ahm_count;
+for(item_id--;item_id>=0;item_id--)
+{
+AHM item= items+item_id;
+IRL irl= IRL_of_AHM(item);
+First_AHM_of_IRL(irl)= item;
+}
+}
+
+/*:517*/
+#line 11931 "./marpa.w"
+
+/*548:*/
+#line 5916 "./marpa.w"
+
+{
+int xsy_id;
+g->t_bv_nsyid_is_terminal= bv_obs_create(g->t_obs,nsy_count);
+for(xsy_id= 0;xsy_id<post_census_xsy_count;xsy_id++)
+{
+if(XSYID_is_Terminal(xsy_id))
 {
-if(lbv_bit_test
-(r->t_lbv_xsyid_prediction_event_is_active,event_xsyid))
+
+
+const NSY nsy= NSY_of_XSY(XSY_by_ID(xsy_id));
+if(nsy)
 {
-int_event_new(g,MARPA_EVENT_SYMBOL_PREDICTED,event_xsyid);
+bv_bit_set(g->t_bv_nsyid_is_terminal,
+ID_of_NSY(nsy));
 }
 }
 }
-marpa_obs_free(trigger_events_obs);
 }
 
-/*:758*//*759:*/
-#line 8589 "./marpa.w"
+/*:548*/
+#line 11932 "./marpa.w"
 
-PRIVATE int trigger_trivial_events(RECCE r)
-{
-int cil_ix;
-int event_count= 0;
-GRAMMAR g= G_of_R(r);
-const XSY start_xsy= XSY_by_ID(g->t_start_xsy_id);
-const CIL nulled_xsyids= Nulled_XSYIDs_of_XSY(start_xsy);
-const int cil_count= Count_of_CIL(nulled_xsyids);
-for(cil_ix= 0;cil_ix<cil_count;cil_ix++)
-{
-const XSYID nulled_xsyid= Item_of_CIL(nulled_xsyids,cil_ix);
-if(lbv_bit_test(r->t_lbv_xsyid_nulled_event_is_active,nulled_xsyid)){
-int_event_new(g,MARPA_EVENT_SYMBOL_NULLED,nulled_xsyid);
-event_count++;
 }
+/*132:*/
+#line 1242 "./marpa.w"
+
+{
+_marpa_avl_destroy((g)->t_xrl_tree);
+(g)->t_xrl_tree= NULL;
 }
-return event_count;
-}
+/*:132*/
+#line 11934 "./marpa.w"
 
-/*:759*//*760:*/
-#line 8609 "./marpa.w"
+g->t_is_precomputed= 1;
+/*381:*/
+#line 3396 "./marpa.w"
 
-PRIVATE void earley_set_update_items(RECCE r,YS set)
-{
-YIM*working_earley_items;
-YIM*finished_earley_items;
-int working_earley_item_count;
-int i;
-YIMs_of_YS(set)= marpa_obs_new(r->t_obs,YIM,YIM_Count_of_YS(set));
-finished_earley_items= YIMs_of_YS(set);
+{cilar_buffer_reinit(&g->t_cilar);}
+/*:381*/
+#line 11936 "./marpa.w"
 
-working_earley_items= Work_YIMs_of_R(r);
-working_earley_item_count= Work_YIM_Count_of_R(r);
-for(i= 0;i<working_earley_item_count;i++){
-YIM earley_item= working_earley_items[i];
-int ordinal= Ord_of_YIM(earley_item);
-finished_earley_items[ordinal]= earley_item;
 }
-WORK_YIMS_CLEAR(r);
+
+/*:929*/
+#line 11647 "./marpa.w"
+
+return_value= 1;
+CLEANUP:;
+return return_value;
 }
 
-/*:760*//*761:*/
-#line 8638 "./marpa.w"
+/*:920*//*930:*/
+#line 11943 "./marpa.w"
 
-PRIVATE void r_update_earley_sets(RECCE r)
+Marpa_Grammar
+marpa_g_deserialize(Marpa_Config*configuration,const void*image,
+int image_size)
 {
-YS set;
-YS first_unstacked_earley_set;
-if(!MARPA_DSTACK_IS_INITIALIZED(r->t_earley_set_stack)){
-first_unstacked_earley_set= First_YS_of_R(r);
-MARPA_DSTACK_INIT(r->t_earley_set_stack,YS,
-MAX(1024,YS_Count_of_R(r)));
-}else{
-YS*end_of_stack= MARPA_DSTACK_TOP(r->t_earley_set_stack,YS);
-first_unstacked_earley_set= Next_YS_of_YS(*end_of_stack);
+GRAMMAR g;
+IMAGE_READER_Object reader;
+if(_MARPA_UNLIKELY(!image||image_size<0))
+{
+if(configuration)
+configuration->t_error= MARPA_ERR_INVALID_IMAGE;
+return NULL;
 }
-for(set= first_unstacked_earley_set;set;set= Next_YS_of_YS(set)){
-YS*end_of_stack= MARPA_DSTACK_PUSH(r->t_earley_set_stack,YS);
-(*end_of_stack)= set;
+g= marpa_g_new(configuration);
+if(!g)
+return NULL;
+reader.t_image= image;
+reader.t_length= (size_t)image_size;
+reader.t_offset= 0;
+reader.t_is_bad= 0;
+if(!g_image_read(g,&reader))
+{
+marpa_g_unref(g);
+if(configuration)
+configuration->t_error= MARPA_ERR_INVALID_IMAGE;
+return NULL;
 }
+return g;
 }
 
-/*:761*//*777:*/
-#line 8742 "./marpa.w"
+/*:930*//*946:*/
+#line 12058 "./marpa.w"
 
 PRIVATE_NOT_INLINE void
 postdot_items_create(RECCE r,
 Bit_Vector bv_ok_for_chain,
 const YS current_earley_set)
 {
-/*563:*/
-#line 6125 "./marpa.w"
+/*585:*/
+#line 6448 "./marpa.w"
 
 const GRAMMAR g= G_of_R(r);
-/*:563*/
-#line 8748 "./marpa.w"
+/*:585*/
+#line 12064 "./marpa.w"
 
-/*776:*/
-#line 8739 "./marpa.w"
+/*945:*/
+#line 12055 "./marpa.w"
 
 bv_clear(r->t_bv_lim_symbols);
 bv_clear(r->t_bv_pim_symbols);
-/*:776*/
-#line 8749 "./marpa.w"
+/*:945*/
+#line 12065 "./marpa.w"
 
-/*778:*/
-#line 8761 "./marpa.w"
+/*947:*/
+#line 12077 "./marpa.w"
 {
 
 YIM*work_earley_items= MARPA_DSTACK_BASE(r->t_yim_work_stack,YIM);
@@ -13150,7 +16919,7 @@ PIM old_pim= NULL;
 PIM new_pim;
 
 
-new_pim= marpa__obs_alloc(r->t_obs,
+new_pim= marpa__obs_alloc(YS_Obs_of_R(r),
 sizeof(YIX_Object),ALIGNOF(PIM_Object));
 
 Postdot_NSYID_of_PIM(new_pim)= postdot_nsyid;
@@ -13165,12 +16934,12 @@ bv_bit_set(r->t_bv_pim_symbols,postdot_nsyid);
 }
 }
 
-/*:778*/
-#line 8750 "./marpa.w"
+/*:947*/
+#line 12066 "./marpa.w"
 
 if(r->t_is_using_leo){
-/*780:*/
-#line 8804 "./marpa.w"
+/*949:*/
+#line 12120 "./marpa.w"
 
 {
 int min,max,start;
@@ -13200,11 +16969,11 @@ const AHM trailhead_ahm=
 Next_AHM_of_AHM(potential_leo_penult_ahm);
 if(AHM_is_Leo_Completion(trailhead_ahm))
 {
-/*781:*/
-#line 8848 "./marpa.w"
+/*950:*/
+#line 12164 "./marpa.w"
 {
 LIM new_lim;
-new_lim= marpa_obs_new(r->t_obs,LIM_Object,1);
+new_lim= marpa_obs_new(YS_Obs_of_R(r),LIM_Object,1);
 LIM_is_Active(new_lim)= 1;
 LIM_is_Rejected(new_lim)= 1;
 Postdot_NSYID_of_LIM(new_lim)= nsyid;
@@ -13221,8 +16990,8 @@ r->t_pim_workarea[nsyid]= new_lim;
 bv_bit_set(r->t_bv_lim_symbols,nsyid);
 }
 
-/*:781*/
-#line 8833 "./marpa.w"
+/*:950*/
+#line 12149 "./marpa.w"
 
 }
 }
@@ -13232,11 +17001,11 @@ NEXT_NSYID:;
 }
 }
 
-/*:780*/
-#line 8752 "./marpa.w"
+/*:949*/
+#line 12068 "./marpa.w"
 
-/*790:*/
-#line 8936 "./marpa.w"
+/*959:*/
+#line 12252 "./marpa.w"
 {
 int min,max,start;
 
@@ -13254,8 +17023,8 @@ LIM predecessor_lim;
 LIM lim_to_process= r->t_pim_workarea[main_loop_nsyid];
 if(LIM_is_Populated(lim_to_process))continue;
 
-/*792:*/
-#line 8992 "./marpa.w"
+/*961:*/
+#line 12308 "./marpa.w"
 
 {
 const YIM base_yim= Trailhead_YIM_of_LIM(lim_to_process);
@@ -13279,12 +17048,12 @@ predecessor_lim=
 PIM_is_LIM(predecessor_pim)?LIM_of_PIM(predecessor_pim):NULL;
 }
 
-/*:792*/
-#line 8953 "./marpa.w"
+/*:961*/
+#line 12269 "./marpa.w"
 
 if(predecessor_lim&&LIM_is_Populated(predecessor_lim)){
-/*800:*/
-#line 9111 "./marpa.w"
+/*969:*/
+#line 12427 "./marpa.w"
 
 {
 const AHM new_top_ahm= Top_AHM_of_LIM(predecessor_lim);
@@ -13314,16 +17083,16 @@ CIL_of_LIM(lim_to_process)= new_cil;
 Top_AHM_of_LIM(lim_to_process)= new_top_ahm;
 }
 
-/*:800*/
-#line 8955 "./marpa.w"
+/*:969*/
+#line 12271 "./marpa.w"
 
 continue;
 }
 if(!predecessor_lim){
 
 
-/*802:*/
-#line 9152 "./marpa.w"
+/*971:*/
+#line 12468 "./marpa.w"
 {
 const AHM trailhead_ahm= Trailhead_AHM_of_LIM(lim_to_process);
 const YIM base_yim= Trailhead_YIM_of_LIM(lim_to_process);
@@ -13331,17 +17100,17 @@ Origin_of_LIM(lim_to_process)= Origin_of_YIM(base_yim);
 CIL_of_LIM(lim_to_process)= Event_AHMIDs_of_AHM(trailhead_ahm);
 }
 
-/*:802*/
-#line 8961 "./marpa.w"
+/*:971*/
+#line 12277 "./marpa.w"
 
 continue;
 }
-/*795:*/
-#line 9019 "./marpa.w"
+/*964:*/
+#line 12335 "./marpa.w"
 {
 int lim_chain_ix;
-/*798:*/
-#line 9039 "./marpa.w"
+/*967:*/
+#line 12355 "./marpa.w"
 
 {
 NSYID postdot_nsyid_of_lim_to_process
@@ -13375,8 +17144,8 @@ if(!bv_bit_test
 break;
 }
 
-/*792:*/
-#line 8992 "./marpa.w"
+/*961:*/
+#line 12308 "./marpa.w"
 
 {
 const YIM base_yim= Trailhead_YIM_of_LIM(lim_to_process);
@@ -13400,8 +17169,8 @@ predecessor_lim=
 PIM_is_LIM(predecessor_pim)?LIM_of_PIM(predecessor_pim):NULL;
 }
 
-/*:792*/
-#line 9072 "./marpa.w"
+/*:961*/
+#line 12388 "./marpa.w"
 
 
 r->t_lim_chain[lim_chain_ix++]= LIM_of_PIM(lim_to_process);
@@ -13424,17 +17193,17 @@ break;
 }
 }
 
-/*:798*/
-#line 9021 "./marpa.w"
+/*:967*/
+#line 12337 "./marpa.w"
 
-/*799:*/
-#line 9094 "./marpa.w"
+/*968:*/
+#line 12410 "./marpa.w"
 
 for(lim_chain_ix--;lim_chain_ix>=0;lim_chain_ix--){
 lim_to_process= r->t_lim_chain[lim_chain_ix];
 if(predecessor_lim&&LIM_is_Populated(predecessor_lim)){
-/*800:*/
-#line 9111 "./marpa.w"
+/*969:*/
+#line 12427 "./marpa.w"
 
 {
 const AHM new_top_ahm= Top_AHM_of_LIM(predecessor_lim);
@@ -13464,12 +17233,12 @@ CIL_of_LIM(lim_to_process)= new_cil;
 Top_AHM_of_LIM(lim_to_process)= new_top_ahm;
 }
 
-/*:800*/
-#line 9098 "./marpa.w"
+/*:969*/
+#line 12414 "./marpa.w"
 
 }else{
-/*802:*/
-#line 9152 "./marpa.w"
+/*971:*/
+#line 12468 "./marpa.w"
 {
 const AHM trailhead_ahm= Trailhead_AHM_of_LIM(lim_to_process);
 const YIM base_yim= Trailhead_YIM_of_LIM(lim_to_process);
@@ -13477,35 +17246,35 @@ Origin_of_LIM(lim_to_process)= Origin_of_YIM(base_yim);
 CIL_of_LIM(lim_to_process)= Event_AHMIDs_of_AHM(trailhead_ahm);
 }
 
-/*:802*/
-#line 9100 "./marpa.w"
+/*:971*/
+#line 12416 "./marpa.w"
 
 }
 predecessor_lim= lim_to_process;
 }
 
-/*:799*/
-#line 9022 "./marpa.w"
+/*:968*/
+#line 12338 "./marpa.w"
 
 }
 
-/*:795*/
-#line 8964 "./marpa.w"
+/*:964*/
+#line 12280 "./marpa.w"
 
 }
 }
 }
 
-/*:790*/
-#line 8753 "./marpa.w"
+/*:959*/
+#line 12069 "./marpa.w"
 
 }
-/*803:*/
-#line 9159 "./marpa.w"
+/*972:*/
+#line 12475 "./marpa.w"
 {
 PIM*postdot_array
 = current_earley_set->t_postdot_ary
-= marpa_obs_new(r->t_obs,PIM,current_earley_set->t_postdot_sym_count);
+= marpa_obs_new(YS_Obs_of_R(r),PIM,current_earley_set->t_postdot_sym_count);
 int min,max,start;
 int postdot_array_ix= 0;
 for(start= 0;bv_scan(r->t_bv_pim_symbols,start,&min,&max);start= max+2){
@@ -13522,31 +17291,30 @@ if(this_pim)postdot_array[postdot_array_ix++]= this_pim;
 }
 
 
-/*:803*/
-#line 8755 "./marpa.w"
+/*:972*/
+#line 12071 "./marpa.w"
 
 bv_and(r->t_bv_nsyid_is_expected,r->t_bv_pim_symbols,g->t_bv_nsyid_is_terminal);
 }
 
-/*:777*//*806:*/
-#line 9195 "./marpa.w"
+/*:946*//*975:*/
+#line 12511 "./marpa.w"
 
 Marpa_Earleme
 marpa_r_clean(Marpa_Recognizer r)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 12515 "./marpa.w"
 
-/*:1313*/
-#line 9199 "./marpa.w"
-
-/*563:*/
-#line 6125 "./marpa.w"
+/*585:*/
+#line 6448 "./marpa.w"
 
 const GRAMMAR g= G_of_R(r);
-/*:563*/
-#line 9200 "./marpa.w"
+/*:585*/
+#line 12516 "./marpa.w"
 
 YSID ysid_to_clean;
 
@@ -13555,19 +17323,20 @@ const YS current_ys= Latest_YS_of_R(r);
 const YSID current_ys_id= Ord_of_YS(current_ys);
 
 int count_of_expected_terminals;
-/*807:*/
-#line 9256 "./marpa.w"
+/*976:*/
+#line 12572 "./marpa.w"
 
 
 
 
-struct marpa_obstack*const method_obstack= marpa_obs_init;
+struct marpa_obstack*const method_obstack= 
+marpa_obs_cache_init(Chunk_Cache_of_G(g));
 
 YIMID*prediction_by_irl= 
 marpa_obs_new(method_obstack,YIMID,IRL_Count_of_G(g));
 
-/*:807*/
-#line 9208 "./marpa.w"
+/*:976*/
+#line 12524 "./marpa.w"
 
 
 
@@ -13576,8 +17345,8 @@ marpa_obs_new(method_obstack,YIMID,IRL_Count_of_G(g));
 
 const JEARLEME return_value= -2;
 
-/*1331:*/
-#line 15743 "./marpa.w"
+/*1519:*/
+#line 19499 "./marpa.w"
 
 if(_MARPA_UNLIKELY(Input_Phase_of_R(r)!=R_DURING_INPUT)){
 MARPA_ERROR(MARPA_ERR_RECCE_NOT_ACCEPTING_INPUT);
@@ -13589,8 +17358,8 @@ MARPA_ERROR(MARPA_ERR_RECCE_IS_INCONSISTENT);
 return failure_indicator;
 }
 
-/*:1331*/
-#line 9216 "./marpa.w"
+/*:1519*/
+#line 12532 "./marpa.w"
 
 
 G_EVENTS_CLEAR(g);
@@ -13608,8 +17377,8 @@ earley_set_update_items(r,current_ys);
 for(ysid_to_clean= First_Inconsistent_YS_of_R(r);
 ysid_to_clean<=current_ys_id;
 ysid_to_clean++){
-/*809:*/
-#line 9270 "./marpa.w"
+/*978:*/
+#line 12587 "./marpa.w"
 
 {
 const YS ys_to_clean= YS_of_R_by_Ord(r,ysid_to_clean);
@@ -13618,8 +17387,8 @@ const int yim_to_clean_count= YIM_Count_of_YS(ys_to_clean);
 Bit_Matrix acceptance_matrix= matrix_obs_create(method_obstack,
 yim_to_clean_count,
 yim_to_clean_count);
-/*810:*/
-#line 9290 "./marpa.w"
+/*979:*/
+#line 12607 "./marpa.w"
 
 {
 int yim_ix= yim_to_clean_count-1;
@@ -13636,11 +17405,11 @@ yim= yims_to_clean[--yim_ix];
 }
 }
 
-/*:810*/
-#line 9278 "./marpa.w"
+/*:979*/
+#line 12595 "./marpa.w"
 
-/*811:*/
-#line 9306 "./marpa.w"
+/*980:*/
+#line 12623 "./marpa.w"
 {
 int yim_to_clean_ix;
 for(yim_to_clean_ix= 0;
@@ -13668,8 +17437,8 @@ if(YIM_is_Rejected(yim_to_clean))continue;
 
 
 
-/*812:*/
-#line 9343 "./marpa.w"
+/*981:*/
+#line 12660 "./marpa.w"
 
 {
 const NSYID postdot_nsyid= Postdot_NSYID_of_YIM(yim_to_clean);
@@ -13690,8 +17459,8 @@ predicted_yim_ix);
 }
 }
 
-/*:812*/
-#line 9333 "./marpa.w"
+/*:981*/
+#line 12650 "./marpa.w"
 
 
 
@@ -13702,12 +17471,12 @@ predicted_yim_ix);
 }
 }
 
-/*:811*/
-#line 9279 "./marpa.w"
+/*:980*/
+#line 12596 "./marpa.w"
 
-transitive_closure(acceptance_matrix);
-/*817:*/
-#line 9403 "./marpa.w"
+transitive_closure(Allocator_of_G(g),acceptance_matrix);
+/*986:*/
+#line 12720 "./marpa.w"
 {
 int cause_yim_ix;
 for(cause_yim_ix= 0;cause_yim_ix<yim_to_clean_count;cause_yim_ix++){
@@ -13745,11 +17514,11 @@ YIM_is_Active(yim_to_accept)= 1;
 }
 }
 
-/*:817*/
-#line 9281 "./marpa.w"
+/*:986*/
+#line 12598 "./marpa.w"
 
-/*818:*/
-#line 9444 "./marpa.w"
+/*987:*/
+#line 12761 "./marpa.w"
 {
 int yim_ix;
 for(yim_ix= 0;yim_ix<yim_to_clean_count;yim_ix++){
@@ -13759,18 +17528,18 @@ YIM_is_Rejected(yim)= 1;
 }
 }
 
-/*:818*/
-#line 9282 "./marpa.w"
+/*:987*/
+#line 12599 "./marpa.w"
 
-/*820:*/
-#line 9458 "./marpa.w"
+/*989:*/
+#line 12775 "./marpa.w"
 {}
 
-/*:820*/
-#line 9283 "./marpa.w"
+/*:989*/
+#line 12600 "./marpa.w"
 
-/*821:*/
-#line 9462 "./marpa.w"
+/*990:*/
+#line 12779 "./marpa.w"
 
 {
 int postdot_sym_ix;
@@ -13810,21 +17579,21 @@ LIM_is_Active(lim)= 1;
 }
 }
 
-/*:821*/
-#line 9284 "./marpa.w"
+/*:990*/
+#line 12601 "./marpa.w"
 
 }
 
-/*:809*/
-#line 9233 "./marpa.w"
+/*:978*/
+#line 12549 "./marpa.w"
 
 }
 
 
 
 
-/*822:*/
-#line 9507 "./marpa.w"
+/*991:*/
+#line 12824 "./marpa.w"
 {
 int old_alt_ix;
 int no_of_alternatives= MARPA_DSTACK_LENGTH(r->t_alternatives);
@@ -13879,24 +17648,24 @@ Furthest_Earleme_of_R(r)= End_Earleme_of_ALT(furthest_alternative);
 
 }
 
-/*:822*/
-#line 9239 "./marpa.w"
+/*:991*/
+#line 12555 "./marpa.w"
 
 
 bv_clear(r->t_bv_nsyid_is_expected);
-/*824:*/
-#line 9587 "./marpa.w"
+/*993:*/
+#line 12904 "./marpa.w"
 {}
 
-/*:824*/
-#line 9242 "./marpa.w"
+/*:993*/
+#line 12558 "./marpa.w"
 
 count_of_expected_terminals= bv_count(r->t_bv_nsyid_is_expected);
 if(count_of_expected_terminals<=0
 &&MARPA_DSTACK_LENGTH(r->t_alternatives)<=0)
 {
-/*614:*/
-#line 6625 "./marpa.w"
+/*638:*/
+#line 6958 "./marpa.w"
 
 {
 R_is_Exhausted(r)= 1;
@@ -13904,28 +17673,28 @@ Input_Phase_of_R(r)= R_AFTER_INPUT;
 event_new(g,MARPA_EVENT_EXHAUSTED);
 }
 
-/*:614*/
-#line 9247 "./marpa.w"
+/*:638*/
+#line 12563 "./marpa.w"
 
 }
 
 First_Inconsistent_YS_of_R(r)= -1;
 
-/*808:*/
-#line 9265 "./marpa.w"
+/*977:*/
+#line 12582 "./marpa.w"
 
 {
 marpa_obs_free(method_obstack);
 }
 
-/*:808*/
-#line 9252 "./marpa.w"
+/*:977*/
+#line 12568 "./marpa.w"
 
 return return_value;
 }
 
-/*:806*//*823:*/
-#line 9561 "./marpa.w"
+/*:975*//*992:*/
+#line 12878 "./marpa.w"
 
 PRIVATE int alternative_is_acceptable(ALT alternative)
 {
@@ -13952,32 +17721,31 @@ if(YIM_is_Active(predecessor_yim))return 1;
 return 0;
 }
 
-/*:823*//*825:*/
-#line 9590 "./marpa.w"
+/*:992*//*994:*/
+#line 12907 "./marpa.w"
 
 int
 marpa_r_zwa_default_set(Marpa_Recognizer r,
 Marpa_Assertion_ID zwaid,
 int default_value)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 12913 "./marpa.w"
 
-/*:1313*/
-#line 9596 "./marpa.w"
-
-/*563:*/
-#line 6125 "./marpa.w"
+/*585:*/
+#line 6448 "./marpa.w"
 
 const GRAMMAR g= G_of_R(r);
-/*:563*/
-#line 9597 "./marpa.w"
+/*:585*/
+#line 12914 "./marpa.w"
 
 ZWA zwa;
 int old_default_value;
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -13988,29 +17756,29 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 9600 "./marpa.w"
+/*:1521*/
+#line 12917 "./marpa.w"
 
-/*1327:*/
-#line 15713 "./marpa.w"
+/*1515:*/
+#line 19469 "./marpa.w"
 
 if(_MARPA_UNLIKELY(ZWAID_is_Malformed(zwaid))){
 MARPA_ERROR(MARPA_ERR_INVALID_ASSERTION_ID);
 return failure_indicator;
 }
 
-/*:1327*/
-#line 9601 "./marpa.w"
+/*:1515*/
+#line 12918 "./marpa.w"
 
-/*1326:*/
-#line 15707 "./marpa.w"
+/*1514:*/
+#line 19463 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!ZWAID_of_G_Exists(zwaid))){
 MARPA_ERROR(MARPA_ERR_NO_SUCH_ASSERTION_ID);
 return failure_indicator;
 }
-/*:1326*/
-#line 9602 "./marpa.w"
+/*:1514*/
+#line 12919 "./marpa.w"
 
 if(_MARPA_UNLIKELY(default_value<0||default_value> 1))
 {
@@ -14023,30 +17791,29 @@ Default_Value_of_ZWA(zwa)= default_value?1:0;
 return old_default_value;
 }
 
-/*:825*//*826:*/
-#line 9614 "./marpa.w"
+/*:994*//*995:*/
+#line 12931 "./marpa.w"
 
 int
 marpa_r_zwa_default(Marpa_Recognizer r,
 Marpa_Assertion_ID zwaid)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 12936 "./marpa.w"
 
-/*:1313*/
-#line 9619 "./marpa.w"
-
-/*563:*/
-#line 6125 "./marpa.w"
+/*585:*/
+#line 6448 "./marpa.w"
 
 const GRAMMAR g= G_of_R(r);
-/*:563*/
-#line 9620 "./marpa.w"
+/*:585*/
+#line 12937 "./marpa.w"
 
 ZWA zwa;
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -14057,36 +17824,36 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 9622 "./marpa.w"
+/*:1521*/
+#line 12939 "./marpa.w"
 
-/*1327:*/
-#line 15713 "./marpa.w"
+/*1515:*/
+#line 19469 "./marpa.w"
 
 if(_MARPA_UNLIKELY(ZWAID_is_Malformed(zwaid))){
 MARPA_ERROR(MARPA_ERR_INVALID_ASSERTION_ID);
 return failure_indicator;
 }
 
-/*:1327*/
-#line 9623 "./marpa.w"
+/*:1515*/
+#line 12940 "./marpa.w"
 
-/*1326:*/
-#line 15707 "./marpa.w"
+/*1514:*/
+#line 19463 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!ZWAID_of_G_Exists(zwaid))){
 MARPA_ERROR(MARPA_ERR_NO_SUCH_ASSERTION_ID);
 return failure_indicator;
 }
-/*:1326*/
-#line 9624 "./marpa.w"
+/*:1514*/
+#line 12941 "./marpa.w"
 
 zwa= RZWA_by_ID(zwaid);
 return Default_Value_of_ZWA(zwa);
 }
 
-/*:826*//*835:*/
-#line 9664 "./marpa.w"
+/*:995*//*1004:*/
+#line 12981 "./marpa.w"
 
 PRIVATE_NOT_INLINE int report_item_cmp(
 const void*ap,
@@ -14104,30 +17871,29 @@ if(Origin_of_PROGRESS(report_a)<Origin_of_PROGRESS(report_b))return-1;
 return 0;
 }
 
-/*:835*//*836:*/
-#line 9681 "./marpa.w"
+/*:1004*//*1005:*/
+#line 12998 "./marpa.w"
 
 int marpa_r_progress_report_start(
 Marpa_Recognizer r,
 Marpa_Earley_Set_ID set_id)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
-
-/*:1313*/
-#line 9686 "./marpa.w"
+/*:1500*/
+#line 13003 "./marpa.w"
 
 YS earley_set;
-/*563:*/
-#line 6125 "./marpa.w"
+/*585:*/
+#line 6448 "./marpa.w"
 
 const GRAMMAR g= G_of_R(r);
-/*:563*/
-#line 9688 "./marpa.w"
+/*:585*/
+#line 13005 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -14138,18 +17904,18 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 9689 "./marpa.w"
+/*:1521*/
+#line 13006 "./marpa.w"
 
-/*1330:*/
-#line 15738 "./marpa.w"
+/*1518:*/
+#line 19494 "./marpa.w"
 
 if(_MARPA_UNLIKELY(Input_Phase_of_R(r)==R_BEFORE_INPUT)){
 MARPA_ERROR(MARPA_ERR_RECCE_NOT_STARTED);
 return failure_indicator;
 }
-/*:1330*/
-#line 9690 "./marpa.w"
+/*:1518*/
+#line 13007 "./marpa.w"
 
 if(set_id<0)
 {
@@ -14162,25 +17928,30 @@ if(!YS_Ord_is_Valid(r,set_id))
 MARPA_ERROR(MARPA_ERR_NO_EARLEY_SET_AT_LOCATION);
 return failure_indicator;
 }
-earley_set= YS_of_R_by_Ord(r,set_id);
+earley_set= ys_of_r_by_ord(r,set_id);
+if(_MARPA_UNLIKELY(!earley_set))
+{
+MARPA_ERROR(MARPA_ERR_EARLEY_SET_FORGOTTEN);
+return failure_indicator;
+}
 
 MARPA_OFF_DEBUG3("At %s, starting progress report Earley set %ld",
 STRLOC,(long)set_id);
 
-/*830:*/
-#line 9638 "./marpa.w"
+/*999:*/
+#line 12955 "./marpa.w"
 
 r->t_current_report_item= &progress_report_not_ready;
 if(r->t_progress_report_traverser){
 _marpa_avl_destroy(MARPA_TREE_OF_AVL_TRAV(r->t_progress_report_traverser));
 }
 r->t_progress_report_traverser= NULL;
-/*:830*/
-#line 9707 "./marpa.w"
+/*:999*/
+#line 13029 "./marpa.w"
 
 {
 const MARPA_AVL_TREE report_tree= 
-_marpa_avl_create(report_item_cmp,NULL);
+_marpa_avl_create(report_item_cmp,NULL,Allocator_of_G(g));
 const YIM*const earley_items= YIMs_of_YS(earley_set);
 const int earley_item_count= YIM_Count_of_YS(earley_set);
 int earley_item_id;
@@ -14189,8 +17960,8 @@ earley_item_id++)
 {
 const YIM earley_item= earley_items[earley_item_id];
 if(!YIM_is_Active(earley_item))continue;
-/*838:*/
-#line 9740 "./marpa.w"
+/*1007:*/
+#line 13062 "./marpa.w"
 
 {
 SRCL leo_source_link= NULL;
@@ -14225,36 +17996,35 @@ MARPA_OFF_DEBUG3("At %s, finished Leo source link %p",STRLOC,leo_source_link);
 }
 }
 
-/*:838*/
-#line 9719 "./marpa.w"
+/*:1007*/
+#line 13041 "./marpa.w"
 
 }
 r->t_progress_report_traverser= _marpa_avl_t_init(report_tree);
 return(int)marpa_avl_count(report_tree);
 }
 }
-/*:836*//*837:*/
-#line 9726 "./marpa.w"
+/*:1005*//*1006:*/
+#line 13048 "./marpa.w"
 
 int marpa_r_progress_report_reset(Marpa_Recognizer r)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
-
-/*:1313*/
-#line 9729 "./marpa.w"
+/*:1500*/
+#line 13051 "./marpa.w"
 
 MARPA_AVL_TRAV traverser= r->t_progress_report_traverser;
-/*563:*/
-#line 6125 "./marpa.w"
+/*585:*/
+#line 6448 "./marpa.w"
 
 const GRAMMAR g= G_of_R(r);
-/*:563*/
-#line 9731 "./marpa.w"
+/*:585*/
+#line 13053 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -14265,21 +18035,21 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 9732 "./marpa.w"
+/*:1521*/
+#line 13054 "./marpa.w"
 
-/*1330:*/
-#line 15738 "./marpa.w"
+/*1518:*/
+#line 19494 "./marpa.w"
 
 if(_MARPA_UNLIKELY(Input_Phase_of_R(r)==R_BEFORE_INPUT)){
 MARPA_ERROR(MARPA_ERR_RECCE_NOT_STARTED);
 return failure_indicator;
 }
-/*:1330*/
-#line 9733 "./marpa.w"
+/*:1518*/
+#line 13055 "./marpa.w"
 
-/*842:*/
-#line 9890 "./marpa.w"
+/*1011:*/
+#line 13212 "./marpa.w"
 
 {
 if(!traverser)
@@ -14289,15 +18059,15 @@ return failure_indicator;
 }
 }
 
-/*:842*/
-#line 9734 "./marpa.w"
+/*:1011*/
+#line 13056 "./marpa.w"
 
 _marpa_avl_t_reset(traverser);
 return 1;
 }
 
-/*:837*//*839:*/
-#line 9774 "./marpa.w"
+/*:1006*//*1008:*/
+#line 13096 "./marpa.w"
 
 PRIVATE void
 progress_report_items_insert(MARPA_AVL_TREE report_tree,
@@ -14376,38 +18146,37 @@ report_ahm,predecessor);
 }
 }
 
-/*:839*//*840:*/
-#line 9852 "./marpa.w"
+/*:1008*//*1009:*/
+#line 13174 "./marpa.w"
 
 int marpa_r_progress_report_finish(Marpa_Recognizer r){
 const int success= 1;
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 13177 "./marpa.w"
 
-/*:1313*/
-#line 9855 "./marpa.w"
-
-/*563:*/
-#line 6125 "./marpa.w"
+/*585:*/
+#line 6448 "./marpa.w"
 
 const GRAMMAR g= G_of_R(r);
-/*:563*/
-#line 9856 "./marpa.w"
+/*:585*/
+#line 13178 "./marpa.w"
 
 const MARPA_AVL_TRAV traverser= r->t_progress_report_traverser;
-/*1330:*/
-#line 15738 "./marpa.w"
+/*1518:*/
+#line 19494 "./marpa.w"
 
 if(_MARPA_UNLIKELY(Input_Phase_of_R(r)==R_BEFORE_INPUT)){
 MARPA_ERROR(MARPA_ERR_RECCE_NOT_STARTED);
 return failure_indicator;
 }
-/*:1330*/
-#line 9858 "./marpa.w"
+/*:1518*/
+#line 13180 "./marpa.w"
 
-/*842:*/
-#line 9890 "./marpa.w"
+/*1011:*/
+#line 13212 "./marpa.w"
 
 {
 if(!traverser)
@@ -14417,47 +18186,122 @@ return failure_indicator;
 }
 }
 
-/*:842*/
-#line 9859 "./marpa.w"
+/*:1011*/
+#line 13181 "./marpa.w"
 
-/*830:*/
-#line 9638 "./marpa.w"
+/*999:*/
+#line 12955 "./marpa.w"
 
 r->t_current_report_item= &progress_report_not_ready;
 if(r->t_progress_report_traverser){
 _marpa_avl_destroy(MARPA_TREE_OF_AVL_TRAV(r->t_progress_report_traverser));
 }
 r->t_progress_report_traverser= NULL;
-/*:830*/
-#line 9860 "./marpa.w"
+/*:999*/
+#line 13182 "./marpa.w"
 
 return success;
 }
 
-/*:840*//*841:*/
-#line 9864 "./marpa.w"
+/*:1009*//*1010:*/
+#line 13186 "./marpa.w"
 
 Marpa_Rule_ID marpa_r_progress_item(
 Marpa_Recognizer r,int*position,Marpa_Earley_Set_ID*origin
 ){
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
-
-/*:1313*/
-#line 9868 "./marpa.w"
+/*:1500*/
+#line 13190 "./marpa.w"
 
 PROGRESS report_item;
 MARPA_AVL_TRAV traverser;
-/*563:*/
-#line 6125 "./marpa.w"
+/*585:*/
+#line 6448 "./marpa.w"
 
 const GRAMMAR g= G_of_R(r);
-/*:563*/
-#line 9871 "./marpa.w"
+/*:585*/
+#line 13193 "./marpa.w"
+
+/*1521:*/
+#line 19518 "./marpa.w"
+
+if(HEADER_VERSION_MISMATCH){
+MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
+return failure_indicator;
+}
+if(_MARPA_UNLIKELY(!IS_G_OK(g))){
+MARPA_ERROR(g->t_error);
+return failure_indicator;
+}
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*:1521*/
+#line 13194 "./marpa.w"
+
+/*1518:*/
+#line 19494 "./marpa.w"
+
+if(_MARPA_UNLIKELY(Input_Phase_of_R(r)==R_BEFORE_INPUT)){
+MARPA_ERROR(MARPA_ERR_RECCE_NOT_STARTED);
+return failure_indicator;
+}
+/*:1518*/
+#line 13195 "./marpa.w"
+
+traverser= r->t_progress_report_traverser;
+if(_MARPA_UNLIKELY(!position||!origin)){
+MARPA_ERROR(MARPA_ERR_POINTER_ARG_NULL);
+return failure_indicator;
+}
+/*1011:*/
+#line 13212 "./marpa.w"
+
+{
+if(!traverser)
+{
+MARPA_ERROR(MARPA_ERR_PROGRESS_REPORT_NOT_STARTED);
+return failure_indicator;
+}
+}
+
+/*:1011*/
+#line 13201 "./marpa.w"
+
+report_item= _marpa_avl_t_next(traverser);
+if(!report_item){
+MARPA_ERROR(MARPA_ERR_PROGRESS_REPORT_EXHAUSTED);
+return-1;
+}
+*position= Position_of_PROGRESS(report_item);
+*origin= Origin_of_PROGRESS(report_item);
+return RULEID_of_PROGRESS(report_item);
+}
+
+/*:1010*//*1012:*/
+#line 13238 "./marpa.w"
+
+int marpa_r_completed_rules(
+Marpa_Recognizer r,
+Marpa_Earley_Set_ID set_id,
+Marpa_Rule_ID*buffer)
+{
+/*1500:*/
+#line 19380 "./marpa.w"
+const int failure_indicator= -2;
+/*:1500*/
+#line 13244 "./marpa.w"
+
+YS earley_set;
+/*585:*/
+#line 6448 "./marpa.w"
+
+const GRAMMAR g= G_of_R(r);
+/*:585*/
+#line 13246 "./marpa.w"
+
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -14468,68 +18312,142 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 9872 "./marpa.w"
+/*:1521*/
+#line 13247 "./marpa.w"
+
+/*1518:*/
+#line 19494 "./marpa.w"
+
+if(_MARPA_UNLIKELY(Input_Phase_of_R(r)==R_BEFORE_INPUT)){
+MARPA_ERROR(MARPA_ERR_RECCE_NOT_STARTED);
+return failure_indicator;
+}
+/*:1518*/
+#line 13248 "./marpa.w"
+
+if(_MARPA_UNLIKELY(!buffer)){
+MARPA_ERROR(MARPA_ERR_POINTER_ARG_NULL);
+return failure_indicator;
+}
+if(set_id<0)
+{
+MARPA_ERROR(MARPA_ERR_INVALID_LOCATION);
+return failure_indicator;
+}
+r_update_earley_sets(r);
+if(!YS_Ord_is_Valid(r,set_id))
+{
+MARPA_ERROR(MARPA_ERR_NO_EARLEY_SET_AT_LOCATION);
+return failure_indicator;
+}
+earley_set= ys_of_r_by_ord(r,set_id);
+if(_MARPA_UNLIKELY(!earley_set))
+{
+MARPA_ERROR(MARPA_ERR_EARLEY_SET_FORGOTTEN);
+return failure_indicator;
+}
+{
+const Bit_Vector bv_completed= r->t_bv_completed_xrl;
+const YIM*const earley_items= YIMs_of_YS(earley_set);
+const int earley_item_count= YIM_Count_of_YS(earley_set);
+int earley_item_id;
+int count= 0;
+int start,min,max;
+bv_clear(bv_completed);
+for(earley_item_id= 0;earley_item_id<earley_item_count;
+earley_item_id++)
+{
+const YIM earley_item= earley_items[earley_item_id];
+SRCL leo_source_link;
+if(!YIM_is_Active(earley_item))continue;
+completed_rules_insert(bv_completed,AHM_of_YIM(earley_item),
+earley_item);
+
 
-/*1330:*/
-#line 15738 "./marpa.w"
 
-if(_MARPA_UNLIKELY(Input_Phase_of_R(r)==R_BEFORE_INPUT)){
-MARPA_ERROR(MARPA_ERR_RECCE_NOT_STARTED);
-return failure_indicator;
+for(leo_source_link= First_Leo_SRCL_of_YIM(earley_item);
+leo_source_link;
+leo_source_link= Next_SRCL_of_SRCL(leo_source_link))
+{
+LIM leo_item;
+if(!SRCL_is_Active(leo_source_link))continue;
+for(leo_item= LIM_of_SRCL(leo_source_link);
+leo_item;leo_item= Predecessor_LIM_of_LIM(leo_item))
+{
+completed_rules_insert(bv_completed,
+Trailhead_AHM_of_LIM(leo_item),
+Trailhead_YIM_of_LIM(leo_item));
 }
-/*:1330*/
-#line 9873 "./marpa.w"
-
-traverser= r->t_progress_report_traverser;
-if(_MARPA_UNLIKELY(!position||!origin)){
-MARPA_ERROR(MARPA_ERR_POINTER_ARG_NULL);
-return failure_indicator;
 }
-/*842:*/
-#line 9890 "./marpa.w"
-
+}
+for(start= 0;bv_scan(bv_completed,start,&min,&max);
+start= max+2)
 {
-if(!traverser)
+XRLID xrl_id;
+for(xrl_id= min;xrl_id<=max;xrl_id++)
 {
-MARPA_ERROR(MARPA_ERR_PROGRESS_REPORT_NOT_STARTED);
-return failure_indicator;
+buffer[count++]= xrl_id;
+}
+}
+return count;
 }
 }
 
-/*:842*/
-#line 9879 "./marpa.w"
+/*:1012*//*1015:*/
+#line 13328 "./marpa.w"
 
-report_item= _marpa_avl_t_next(traverser);
-if(!report_item){
-MARPA_ERROR(MARPA_ERR_PROGRESS_REPORT_EXHAUSTED);
-return-1;
+PRIVATE void
+completed_rules_insert(Bit_Vector bv_completed,
+AHM report_ahm,
+YIM origin_yim)
+{
+const XRL source_xrl= XRL_of_AHM(report_ahm);
+if(!source_xrl)return;
+if(XRL_Position_of_AHM(report_ahm)!=-1)return;
+if(!IRL_has_Virtual_LHS(IRL_of_YIM(origin_yim))){
+if(Origin_Ord_of_YIM(origin_yim)==0){
+bv_bit_set(bv_completed,ID_of_XRL(source_xrl));
+}
+return;
+}
+if(XRL_is_Sequence(source_xrl))return;
+{
+const NSYID lhs_nsyid= LHS_NSYID_of_YIM(origin_yim);
+const YS origin_of_origin_ys= Origin_of_YIM(origin_yim);
+PIM pim= First_PIM_of_YS_by_NSYID(origin_of_origin_ys,lhs_nsyid);
+for(;pim;pim= Next_PIM_of_PIM(pim))
+{
+const YIM predecessor= YIM_of_PIM(pim);
+if(!predecessor)return;
+if(YIM_is_Active(predecessor)){
+completed_rules_insert(bv_completed,
+report_ahm,predecessor);
+}
+}
 }
-*position= Position_of_PROGRESS(report_item);
-*origin= Origin_of_PROGRESS(report_item);
-return RULEID_of_PROGRESS(report_item);
 }
 
-/*:841*//*865:*/
-#line 10075 "./marpa.w"
+/*:1015*//*1038:*/
+#line 13536 "./marpa.w"
 
-PRIVATE void ur_node_stack_init(URS stack)
+PRIVATE void ur_node_stack_init(URS stack,
+struct marpa_obstack_cache*chunk_cache)
 {
-stack->t_obs= marpa_obs_init;
+stack->t_obs= marpa_obs_cache_init(chunk_cache);
 stack->t_base= ur_node_new(stack,0);
 ur_node_stack_reset(stack);
 }
 
-/*:865*//*866:*/
-#line 10083 "./marpa.w"
+/*:1038*//*1039:*/
+#line 13545 "./marpa.w"
 
 PRIVATE void ur_node_stack_reset(URS stack)
 {
 stack->t_top= stack->t_base;
 }
 
-/*:866*//*867:*/
-#line 10089 "./marpa.w"
+/*:1039*//*1040:*/
+#line 13551 "./marpa.w"
 
 PRIVATE void ur_node_stack_destroy(URS stack)
 {
@@ -14537,8 +18455,8 @@ if(stack->t_base)marpa_obs_free(stack->t_obs);
 stack->t_base= NULL;
 }
 
-/*:867*//*868:*/
-#line 10096 "./marpa.w"
+/*:1040*//*1041:*/
+#line 13558 "./marpa.w"
 
 PRIVATE UR ur_node_new(URS stack,UR prev)
 {
@@ -14549,8 +18467,8 @@ Prev_UR_of_UR(new_ur_node)= prev;
 return new_ur_node;
 }
 
-/*:868*//*869:*/
-#line 10106 "./marpa.w"
+/*:1041*//*1042:*/
+#line 13568 "./marpa.w"
 
 PRIVATE void
 ur_node_push(URS stack,YIM earley_item)
@@ -14566,8 +18484,8 @@ Next_UR_of_UR(old_top)= new_top;
 stack->t_top= new_top;
 }
 
-/*:869*//*870:*/
-#line 10121 "./marpa.w"
+/*:1042*//*1043:*/
+#line 13583 "./marpa.w"
 
 PRIVATE UR
 ur_node_pop(URS stack)
@@ -14578,8 +18496,8 @@ stack->t_top= new_top;
 return new_top;
 }
 
-/*:870*//*872:*/
-#line 10158 "./marpa.w"
+/*:1043*//*1045:*/
+#line 13620 "./marpa.w"
 
 PRIVATE void push_ur_if_new(
 struct s_bocage_setup_per_ys*per_ys_data,
@@ -14591,8 +18509,8 @@ ur_node_push(ur_node_stack,yim);
 }
 }
 
-/*:872*//*873:*/
-#line 10174 "./marpa.w"
+/*:1045*//*1046:*/
+#line 13636 "./marpa.w"
 
 PRIVATE int psi_test_and_set(
 struct s_bocage_setup_per_ys*per_ys_data,
@@ -14611,8 +18529,8 @@ return 0;
 return 1;
 }
 
-/*:873*//*875:*/
-#line 10216 "./marpa.w"
+/*:1046*//*1048:*/
+#line 13678 "./marpa.w"
 
 PRIVATE void
 Set_boolean_in_PSI_for_initial_nulls(struct s_bocage_setup_per_ys*per_ys_data,
@@ -14623,8 +18541,8 @@ if(Null_Count_of_AHM(ahm))
 psi_test_and_set(per_ys_data,(yim));
 }
 
-/*:875*//*894:*/
-#line 10474 "./marpa.w"
+/*:1048*//*1067:*/
+#line 13937 "./marpa.w"
 
 PRIVATE OR or_node_new(BOCAGE b)
 {
@@ -14636,14 +18554,14 @@ if(_MARPA_UNLIKELY(or_node_id>=OR_Capacity_of_B(b)))
 {
 OR_Capacity_of_B(b)*= 2;
 ORs_of_B(b)= 
-marpa_renew(OR,ORs_of_B(b),OR_Capacity_of_B(b));
+marpa_a_renew(Allocator_of_G(G_of_B(b)),OR,ORs_of_B(b),OR_Capacity_of_B(b));
 }
 OR_of_B_by_ID(b,or_node_id)= new_or_node;
 return new_or_node;
 }
 
-/*:894*//*904:*/
-#line 10674 "./marpa.w"
+/*:1067*//*1077:*/
+#line 14137 "./marpa.w"
 
 PRIVATE
 DAND draft_and_node_new(struct marpa_obstack*obs,OR predecessor,OR cause)
@@ -14655,8 +18573,8 @@ MARPA_ASSERT(cause!=NULL);
 return draft_and_node;
 }
 
-/*:904*//*905:*/
-#line 10685 "./marpa.w"
+/*:1077*//*1078:*/
+#line 14148 "./marpa.w"
 
 PRIVATE
 void draft_and_node_add(struct marpa_obstack*obs,OR parent,OR predecessor,OR cause)
@@ -14667,8 +18585,8 @@ Next_DAND_of_DAND(new)= DANDs_of_OR(parent);
 DANDs_of_OR(parent)= new;
 }
 
-/*:905*//*913:*/
-#line 10825 "./marpa.w"
+/*:1078*//*1086:*/
+#line 14288 "./marpa.w"
 
 PRIVATE
 OR or_by_origin_and_symi(struct s_bocage_setup_per_ys*per_ys_data,
@@ -14679,8 +18597,8 @@ const PSL or_psl_at_origin= per_ys_data[(origin)].t_or_psl;
 return PSL_Datum(or_psl_at_origin,(symbol_instance));
 }
 
-/*:913*//*918:*/
-#line 10884 "./marpa.w"
+/*:1086*//*1091:*/
+#line 14347 "./marpa.w"
 
 PRIVATE
 int dands_are_equal(OR predecessor_a,OR cause_a,
@@ -14712,8 +18630,8 @@ return irlid_of_a==irlid_of_b;
 
 }
 
-/*:918*//*919:*/
-#line 10918 "./marpa.w"
+/*:1091*//*1092:*/
+#line 14381 "./marpa.w"
 
 PRIVATE
 int dand_is_duplicate(OR parent,OR predecessor,OR cause)
@@ -14729,8 +18647,8 @@ return 1;
 return 0;
 }
 
-/*:919*//*920:*/
-#line 10933 "./marpa.w"
+/*:1092*//*1093:*/
+#line 14396 "./marpa.w"
 
 PRIVATE
 OR set_or_from_yim(struct s_bocage_setup_per_ys*per_ys_data,
@@ -14742,8 +18660,8 @@ const int psi_item_ordinal= Ord_of_YIM(psi_earley_item);
 return OR_by_PSI(per_ys_data,psi_earley_set_ordinal,psi_item_ordinal);
 }
 
-/*:920*//*923:*/
-#line 10991 "./marpa.w"
+/*:1093*//*1096:*/
+#line 14454 "./marpa.w"
 
 PRIVATE
 OR safe_or_from_yim(
@@ -14754,38 +18672,42 @@ if(Position_of_AHM(AHM_of_YIM(yim))<1)return NULL;
 return set_or_from_yim(per_ys_data,yim);
 }
 
-/*:923*//*941:*/
-#line 11155 "./marpa.w"
+/*:1096*//*1114:*/
+#line 14618 "./marpa.w"
 
 int marpa_trv_soft_error(Marpa_Traverser trv)
 {
 return TRV_has_Soft_Error(trv);
 }
 
-/*:941*//*946:*/
-#line 11176 "./marpa.w"
+/*:1114*//*1122:*/
+#line 14652 "./marpa.w"
 
 PRIVATE Marpa_Traverser
 trv_new(RECCE r,YIM yim)
 {
 TRAVERSER trv;
 
-trv= my_malloc(sizeof(*trv));
-/*940:*/
-#line 11153 "./marpa.w"
+trv= marpa__a_malloc(Allocator_of_G(G_of_R(r)),sizeof(*trv));
+/*1113:*/
+#line 14616 "./marpa.w"
 
 TRV_has_Soft_Error(trv)= 0;
-/*:940*//*943:*/
-#line 11164 "./marpa.w"
+/*:1113*//*1116:*/
+#line 14627 "./marpa.w"
 
 R_of_TRV(trv)= r;
 
-/*:943*//*960:*/
-#line 11469 "./marpa.w"
+/*:1116*//*1119:*/
+#line 14639 "./marpa.w"
+
+R_Generation_of_TRV(trv)= R_Generation(r);
+/*:1119*//*1136:*/
+#line 14965 "./marpa.w"
 
 trv->t_ref_count= 1;
-/*:960*/
-#line 11183 "./marpa.w"
+/*:1136*/
+#line 14659 "./marpa.w"
 
 recce_ref(r);
 if(!yim){
@@ -14794,29 +18716,32 @@ return trv;
 }
 TRV_is_Trivial(trv)= 0;
 YIM_of_TRV(trv)= yim;
+if(!R_is_Link_Free(r))
+{
 TOKEN_SRCL_of_TRV(trv)= First_Token_SRCL_of_YIM(yim);
 COMPLETION_SRCL_of_TRV(trv)= First_Completion_SRCL_of_YIM(yim);
+}
 LEO_SRCL_of_TRV(trv)= First_Leo_SRCL_of_YIM(yim);
 return trv;
 }
 
-/*:946*//*947:*/
-#line 11201 "./marpa.w"
+/*:1122*//*1123:*/
+#line 14680 "./marpa.w"
 
 Marpa_Traverser marpa_trv_new(Marpa_Recognizer r,
 Marpa_Earley_Set_ID es_arg,
 Marpa_Earley_Item_ID eim_arg
 )
 {
-/*1312:*/
-#line 15626 "./marpa.w"
+/*1499:*/
+#line 19377 "./marpa.w"
 void*const failure_indicator= NULL;
-/*:1312*/
-#line 11207 "./marpa.w"
+/*:1499*/
+#line 14686 "./marpa.w"
 
 const GRAMMAR g= G_of_R(r);
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -14827,8 +18752,8 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 11209 "./marpa.w"
+/*:1521*/
+#line 14688 "./marpa.w"
 
 
 if(_MARPA_UNLIKELY(es_arg<=-2))
@@ -14842,15 +18767,15 @@ MARPA_ERROR(MARPA_ERR_YIM_ID_INVALID);
 return failure_indicator;
 }
 
-/*1330:*/
-#line 15738 "./marpa.w"
+/*1518:*/
+#line 19494 "./marpa.w"
 
 if(_MARPA_UNLIKELY(Input_Phase_of_R(r)==R_BEFORE_INPUT)){
 MARPA_ERROR(MARPA_ERR_RECCE_NOT_STARTED);
 return failure_indicator;
 }
-/*:1330*/
-#line 11222 "./marpa.w"
+/*:1518*/
+#line 14701 "./marpa.w"
 
 
 if(G_is_Trivial(g)){
@@ -14884,7 +18809,12 @@ if(!YS_Ord_is_Valid(r,es_arg))
 MARPA_ERROR(MARPA_ERR_INVALID_LOCATION);
 return failure_indicator;
 }
-ys= YS_of_R_by_Ord(r,es_arg);
+ys= ys_of_r_by_ord(r,es_arg);
+if(_MARPA_UNLIKELY(!ys))
+{
+MARPA_ERROR(MARPA_ERR_EARLEY_SET_FORGOTTEN);
+return failure_indicator;
+}
 }
 
 item_count= YIM_Count_of_YS(ys);
@@ -14899,30 +18829,29 @@ return trv_new(r,yim);
 }
 }
 
-/*:947*//*948:*/
-#line 11271 "./marpa.w"
+/*:1123*//*1124:*/
+#line 14755 "./marpa.w"
 
 int marpa_trv_at_completion(Marpa_Traverser trv)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 14758 "./marpa.w"
 
-/*:1313*/
-#line 11274 "./marpa.w"
-
-/*944:*/
-#line 11167 "./marpa.w"
+/*1117:*/
+#line 14630 "./marpa.w"
 
 const RECCE r UNUSED= R_of_TRV(trv);
 const GRAMMAR g UNUSED= G_of_R(r);
 
-/*:944*/
-#line 11275 "./marpa.w"
+/*:1117*/
+#line 14759 "./marpa.w"
 
 SRCL srcl;
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -14933,8 +18862,19 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 11277 "./marpa.w"
+/*:1521*/
+#line 14761 "./marpa.w"
+
+/*1120:*/
+#line 14641 "./marpa.w"
+
+if(_MARPA_UNLIKELY(R_Generation_of_TRV(trv)!=R_Generation(r))){
+MARPA_ERROR(MARPA_ERR_BASE_GENERATION_MISMATCH);
+return failure_indicator;
+}
+
+/*:1120*/
+#line 14762 "./marpa.w"
 
 
 if(G_is_Trivial(g))return 0;
@@ -14942,30 +18882,29 @@ srcl= COMPLETION_SRCL_of_TRV(trv);
 return srcl?1:0;
 }
 
-/*:948*//*949:*/
-#line 11285 "./marpa.w"
+/*:1124*//*1125:*/
+#line 14770 "./marpa.w"
 
 int marpa_trv_at_token(Marpa_Traverser trv)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 14773 "./marpa.w"
 
-/*:1313*/
-#line 11288 "./marpa.w"
-
-/*944:*/
-#line 11167 "./marpa.w"
+/*1117:*/
+#line 14630 "./marpa.w"
 
 const RECCE r UNUSED= R_of_TRV(trv);
 const GRAMMAR g UNUSED= G_of_R(r);
 
-/*:944*/
-#line 11289 "./marpa.w"
+/*:1117*/
+#line 14774 "./marpa.w"
 
 SRCL srcl;
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -14976,8 +18915,19 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 11291 "./marpa.w"
+/*:1521*/
+#line 14776 "./marpa.w"
+
+/*1120:*/
+#line 14641 "./marpa.w"
+
+if(_MARPA_UNLIKELY(R_Generation_of_TRV(trv)!=R_Generation(r))){
+MARPA_ERROR(MARPA_ERR_BASE_GENERATION_MISMATCH);
+return failure_indicator;
+}
+
+/*:1120*/
+#line 14777 "./marpa.w"
 
 
 if(G_is_Trivial(g))return 0;
@@ -14985,30 +18935,29 @@ srcl= TOKEN_SRCL_of_TRV(trv);
 return srcl?1:0;
 }
 
-/*:949*//*950:*/
-#line 11299 "./marpa.w"
+/*:1125*//*1126:*/
+#line 14785 "./marpa.w"
 
 int marpa_trv_at_leo(Marpa_Traverser trv)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 14788 "./marpa.w"
 
-/*:1313*/
-#line 11302 "./marpa.w"
-
-/*944:*/
-#line 11167 "./marpa.w"
+/*1117:*/
+#line 14630 "./marpa.w"
 
 const RECCE r UNUSED= R_of_TRV(trv);
 const GRAMMAR g UNUSED= G_of_R(r);
 
-/*:944*/
-#line 11303 "./marpa.w"
+/*:1117*/
+#line 14789 "./marpa.w"
 
 SRCL srcl;
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -15019,8 +18968,19 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 11305 "./marpa.w"
+/*:1521*/
+#line 14791 "./marpa.w"
+
+/*1120:*/
+#line 14641 "./marpa.w"
+
+if(_MARPA_UNLIKELY(R_Generation_of_TRV(trv)!=R_Generation(r))){
+MARPA_ERROR(MARPA_ERR_BASE_GENERATION_MISMATCH);
+return failure_indicator;
+}
+
+/*:1120*/
+#line 14792 "./marpa.w"
 
 
 if(G_is_Trivial(g))return 0;
@@ -15028,30 +18988,30 @@ srcl= LEO_SRCL_of_TRV(trv);
 return srcl?1:0;
 }
 
-/*:950*//*951:*/
-#line 11316 "./marpa.w"
+/*:1126*//*1127:*/
+#line 14803 "./marpa.w"
 
 Marpa_Traverser marpa_trv_completion_predecessor(Marpa_Traverser trv)
 {
-/*1312:*/
-#line 15626 "./marpa.w"
+/*1499:*/
+#line 19377 "./marpa.w"
 void*const failure_indicator= NULL;
-/*:1312*/
-#line 11319 "./marpa.w"
+/*:1499*/
+#line 14806 "./marpa.w"
 
-/*944:*/
-#line 11167 "./marpa.w"
+/*1117:*/
+#line 14630 "./marpa.w"
 
 const RECCE r UNUSED= R_of_TRV(trv);
 const GRAMMAR g UNUSED= G_of_R(r);
 
-/*:944*/
-#line 11320 "./marpa.w"
+/*:1117*/
+#line 14807 "./marpa.w"
 
 SRCL srcl;
 YIM predecessor;
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -15062,8 +19022,30 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 11323 "./marpa.w"
+/*:1521*/
+#line 14810 "./marpa.w"
+
+/*1120:*/
+#line 14641 "./marpa.w"
+
+if(_MARPA_UNLIKELY(R_Generation_of_TRV(trv)!=R_Generation(r))){
+MARPA_ERROR(MARPA_ERR_BASE_GENERATION_MISMATCH);
+return failure_indicator;
+}
+
+/*:1120*/
+#line 14811 "./marpa.w"
+
+/*858:*/
+#line 10184 "./marpa.w"
+
+if(_MARPA_UNLIKELY(R_is_Link_Free(r))){
+MARPA_ERROR(MARPA_ERR_RECCE_IS_LINK_FREE);
+return failure_indicator;
+}
+
+/*:858*/
+#line 14812 "./marpa.w"
 
 TRV_has_Soft_Error(trv)= 0;
 
@@ -15086,30 +19068,30 @@ return NULL;
 return trv_new(r,predecessor);
 }
 
-/*:951*//*952:*/
-#line 11349 "./marpa.w"
+/*:1127*//*1128:*/
+#line 14838 "./marpa.w"
 
 Marpa_LTraverser marpa_trv_lim(Marpa_Traverser trv)
 {
-/*1312:*/
-#line 15626 "./marpa.w"
+/*1499:*/
+#line 19377 "./marpa.w"
 void*const failure_indicator= NULL;
-/*:1312*/
-#line 11352 "./marpa.w"
+/*:1499*/
+#line 14841 "./marpa.w"
 
-/*944:*/
-#line 11167 "./marpa.w"
+/*1117:*/
+#line 14630 "./marpa.w"
 
 const RECCE r UNUSED= R_of_TRV(trv);
 const GRAMMAR g UNUSED= G_of_R(r);
 
-/*:944*/
-#line 11353 "./marpa.w"
+/*:1117*/
+#line 14842 "./marpa.w"
 
 SRCL srcl;
 LIM predecessor;
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -15120,8 +19102,19 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 11356 "./marpa.w"
+/*:1521*/
+#line 14845 "./marpa.w"
+
+/*1120:*/
+#line 14641 "./marpa.w"
+
+if(_MARPA_UNLIKELY(R_Generation_of_TRV(trv)!=R_Generation(r))){
+MARPA_ERROR(MARPA_ERR_BASE_GENERATION_MISMATCH);
+return failure_indicator;
+}
+
+/*:1120*/
+#line 14846 "./marpa.w"
 
 TRV_has_Soft_Error(trv)= 0;
 
@@ -15144,30 +19137,30 @@ return NULL;
 return ltrv_new(r,predecessor);
 }
 
-/*:952*//*953:*/
-#line 11382 "./marpa.w"
+/*:1128*//*1129:*/
+#line 14872 "./marpa.w"
 
 Marpa_Traverser marpa_trv_token_predecessor(Marpa_Traverser trv)
 {
-/*1312:*/
-#line 15626 "./marpa.w"
+/*1499:*/
+#line 19377 "./marpa.w"
 void*const failure_indicator= NULL;
-/*:1312*/
-#line 11385 "./marpa.w"
+/*:1499*/
+#line 14875 "./marpa.w"
 
-/*944:*/
-#line 11167 "./marpa.w"
+/*1117:*/
+#line 14630 "./marpa.w"
 
 const RECCE r UNUSED= R_of_TRV(trv);
 const GRAMMAR g UNUSED= G_of_R(r);
 
-/*:944*/
-#line 11386 "./marpa.w"
+/*:1117*/
+#line 14876 "./marpa.w"
 
 SRCL srcl;
 YIM predecessor;
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -15178,8 +19171,41 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 11389 "./marpa.w"
+/*:1521*/
+#line 14879 "./marpa.w"
+
+/*1120:*/
+#line 14641 "./marpa.w"
+
+if(_MARPA_UNLIKELY(R_Generation_of_TRV(trv)!=R_Generation(r))){
+MARPA_ERROR(MARPA_ERR_BASE_GENERATION_MISMATCH);
+return failure_indicator;
+}
+
+/*:1120*/
+#line 14880 "./marpa.w"
+
+/*819:*/
+#line 9668 "./marpa.w"
+
+if(_MARPA_UNLIKELY(R_is_Forgetful(r))){
+MARPA_ERROR(MARPA_ERR_RECCE_IS_FORGETFUL);
+return failure_indicator;
+}
+
+/*:819*/
+#line 14881 "./marpa.w"
+
+/*858:*/
+#line 10184 "./marpa.w"
+
+if(_MARPA_UNLIKELY(R_is_Link_Free(r))){
+MARPA_ERROR(MARPA_ERR_RECCE_IS_LINK_FREE);
+return failure_indicator;
+}
+
+/*:858*/
+#line 14882 "./marpa.w"
 
 TRV_has_Soft_Error(trv)= 0;
 
@@ -15202,30 +19228,29 @@ return NULL;
 return trv_new(r,predecessor);
 }
 
-/*:953*//*955:*/
-#line 11413 "./marpa.w"
+/*:1129*//*1131:*/
+#line 14906 "./marpa.w"
 
 int marpa_trv_completion_next(Marpa_Traverser trv)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 14909 "./marpa.w"
 
-/*:1313*/
-#line 11416 "./marpa.w"
-
-/*944:*/
-#line 11167 "./marpa.w"
+/*1117:*/
+#line 14630 "./marpa.w"
 
 const RECCE r UNUSED= R_of_TRV(trv);
 const GRAMMAR g UNUSED= G_of_R(r);
 
-/*:944*/
-#line 11417 "./marpa.w"
+/*:1117*/
+#line 14910 "./marpa.w"
 
 SRCL srcl;
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -15236,8 +19261,19 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 11419 "./marpa.w"
+/*:1521*/
+#line 14912 "./marpa.w"
+
+/*1120:*/
+#line 14641 "./marpa.w"
+
+if(_MARPA_UNLIKELY(R_Generation_of_TRV(trv)!=R_Generation(r))){
+MARPA_ERROR(MARPA_ERR_BASE_GENERATION_MISMATCH);
+return failure_indicator;
+}
+
+/*:1120*/
+#line 14913 "./marpa.w"
 
 if(G_is_Trivial(g)){
 return 0;
@@ -15249,30 +19285,29 @@ if(!srcl)return 0;
 return 1;
 }
 
-/*:955*//*956:*/
-#line 11431 "./marpa.w"
+/*:1131*//*1132:*/
+#line 14925 "./marpa.w"
 
 int marpa_trv_leo_next(Marpa_Traverser trv)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 14928 "./marpa.w"
 
-/*:1313*/
-#line 11434 "./marpa.w"
-
-/*944:*/
-#line 11167 "./marpa.w"
+/*1117:*/
+#line 14630 "./marpa.w"
 
 const RECCE r UNUSED= R_of_TRV(trv);
 const GRAMMAR g UNUSED= G_of_R(r);
 
-/*:944*/
-#line 11435 "./marpa.w"
+/*:1117*/
+#line 14929 "./marpa.w"
 
 SRCL srcl;
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -15283,8 +19318,19 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 11437 "./marpa.w"
+/*:1521*/
+#line 14931 "./marpa.w"
+
+/*1120:*/
+#line 14641 "./marpa.w"
+
+if(_MARPA_UNLIKELY(R_Generation_of_TRV(trv)!=R_Generation(r))){
+MARPA_ERROR(MARPA_ERR_BASE_GENERATION_MISMATCH);
+return failure_indicator;
+}
+
+/*:1120*/
+#line 14932 "./marpa.w"
 
 if(G_is_Trivial(g)){
 return 0;
@@ -15296,30 +19342,29 @@ if(!srcl)return 0;
 return 1;
 }
 
-/*:956*//*957:*/
-#line 11449 "./marpa.w"
+/*:1132*//*1133:*/
+#line 14944 "./marpa.w"
 
 int marpa_trv_token_next(Marpa_Traverser trv)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 14947 "./marpa.w"
 
-/*:1313*/
-#line 11452 "./marpa.w"
-
-/*944:*/
-#line 11167 "./marpa.w"
+/*1117:*/
+#line 14630 "./marpa.w"
 
 const RECCE r UNUSED= R_of_TRV(trv);
 const GRAMMAR g UNUSED= G_of_R(r);
 
-/*:944*/
-#line 11453 "./marpa.w"
+/*:1117*/
+#line 14948 "./marpa.w"
 
 SRCL srcl;
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -15330,8 +19375,19 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 11455 "./marpa.w"
+/*:1521*/
+#line 14950 "./marpa.w"
+
+/*1120:*/
+#line 14641 "./marpa.w"
+
+if(_MARPA_UNLIKELY(R_Generation_of_TRV(trv)!=R_Generation(r))){
+MARPA_ERROR(MARPA_ERR_BASE_GENERATION_MISMATCH);
+return failure_indicator;
+}
+
+/*:1120*/
+#line 14951 "./marpa.w"
 
 if(G_is_Trivial(g)){
 return 0;
@@ -15343,8 +19399,8 @@ if(!srcl)return 0;
 return 1;
 }
 
-/*:957*//*961:*/
-#line 11472 "./marpa.w"
+/*:1133*//*1137:*/
+#line 14968 "./marpa.w"
 
 PRIVATE void
 traverser_unref(TRAVERSER trv)
@@ -15362,8 +19418,8 @@ marpa_trv_unref(Marpa_Traverser trv)
 traverser_unref(trv);
 }
 
-/*:961*//*962:*/
-#line 11490 "./marpa.w"
+/*:1137*//*1138:*/
+#line 14986 "./marpa.w"
 
 PRIVATE TRAVERSER
 traverser_ref(TRAVERSER trv)
@@ -15378,60 +19434,60 @@ marpa_trv_ref(Marpa_Traverser trv)
 return traverser_ref(trv);
 }
 
-/*:962*//*964:*/
-#line 11508 "./marpa.w"
+/*:1138*//*1140:*/
+#line 15004 "./marpa.w"
 
 PRIVATE void
 traverser_free(TRAVERSER trv)
 {
-/*944:*/
-#line 11167 "./marpa.w"
+/*1117:*/
+#line 14630 "./marpa.w"
 
 const RECCE r UNUSED= R_of_TRV(trv);
 const GRAMMAR g UNUSED= G_of_R(r);
 
-/*:944*/
-#line 11512 "./marpa.w"
+/*:1117*/
+#line 15008 "./marpa.w"
 
+struct marpa_allocator_s allocator= *Allocator_of_G(g);
 if(trv)
 {
-/*937:*/
-#line 11145 "./marpa.w"
+/*1110:*/
+#line 14608 "./marpa.w"
 
 {
 recce_unref(R_of_TRV(trv));
 }
 
-/*:937*/
-#line 11515 "./marpa.w"
+/*:1110*/
+#line 15012 "./marpa.w"
 ;
 }
-my_free(trv);
+marpa__a_free(&allocator,trv);
 }
 
-/*:964*//*968:*/
-#line 11530 "./marpa.w"
+/*:1140*//*1144:*/
+#line 15027 "./marpa.w"
 
 int marpa_trv_is_trivial(Marpa_Traverser trv)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 15030 "./marpa.w"
 
-/*:1313*/
-#line 11533 "./marpa.w"
-
-/*944:*/
-#line 11167 "./marpa.w"
+/*1117:*/
+#line 14630 "./marpa.w"
 
 const RECCE r UNUSED= R_of_TRV(trv);
 const GRAMMAR g UNUSED= G_of_R(r);
 
-/*:944*/
-#line 11534 "./marpa.w"
+/*:1117*/
+#line 15031 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -15442,34 +19498,44 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 11535 "./marpa.w"
+/*:1521*/
+#line 15032 "./marpa.w"
+
+/*1120:*/
+#line 14641 "./marpa.w"
+
+if(_MARPA_UNLIKELY(R_Generation_of_TRV(trv)!=R_Generation(r))){
+MARPA_ERROR(MARPA_ERR_BASE_GENERATION_MISMATCH);
+return failure_indicator;
+}
+
+/*:1120*/
+#line 15033 "./marpa.w"
 
 return TRV_is_Trivial(trv);
 }
-/*:968*//*971:*/
-#line 11547 "./marpa.w"
+/*:1144*//*1147:*/
+#line 15045 "./marpa.w"
 
 Marpa_Rule_ID marpa_trv_rule_id(Marpa_Traverser trv)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 15048 "./marpa.w"
 
-/*:1313*/
-#line 11550 "./marpa.w"
-
-/*944:*/
-#line 11167 "./marpa.w"
+/*1117:*/
+#line 14630 "./marpa.w"
 
 const RECCE r UNUSED= R_of_TRV(trv);
 const GRAMMAR g UNUSED= G_of_R(r);
 
-/*:944*/
-#line 11551 "./marpa.w"
+/*:1117*/
+#line 15049 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -15480,19 +19546,30 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 11552 "./marpa.w"
+/*:1521*/
+#line 15050 "./marpa.w"
 
-/*969:*/
-#line 11538 "./marpa.w"
+/*1120:*/
+#line 14641 "./marpa.w"
+
+if(_MARPA_UNLIKELY(R_Generation_of_TRV(trv)!=R_Generation(r))){
+MARPA_ERROR(MARPA_ERR_BASE_GENERATION_MISMATCH);
+return failure_indicator;
+}
+
+/*:1120*/
+#line 15051 "./marpa.w"
+
+/*1145:*/
+#line 15036 "./marpa.w"
 
 if(TRV_is_Trivial(trv)){
 MARPA_ERROR(MARPA_ERR_GRAMMAR_IS_TRIVIAL);
 return failure_indicator;
 }
 
-/*:969*/
-#line 11553 "./marpa.w"
+/*:1145*/
+#line 15052 "./marpa.w"
 
 {
 const YIM yim= YIM_of_TRV(trv);
@@ -15503,29 +19580,28 @@ if(xrl)return ID_of_XRL(xrl);
 return-1;
 }
 
-/*:971*//*972:*/
-#line 11564 "./marpa.w"
+/*:1147*//*1148:*/
+#line 15063 "./marpa.w"
 
 int marpa_trv_dot(Marpa_Traverser trv)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 15066 "./marpa.w"
 
-/*:1313*/
-#line 11567 "./marpa.w"
-
-/*944:*/
-#line 11167 "./marpa.w"
+/*1117:*/
+#line 14630 "./marpa.w"
 
 const RECCE r UNUSED= R_of_TRV(trv);
 const GRAMMAR g UNUSED= G_of_R(r);
 
-/*:944*/
-#line 11568 "./marpa.w"
+/*:1117*/
+#line 15067 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -15536,19 +19612,30 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 11569 "./marpa.w"
+/*:1521*/
+#line 15068 "./marpa.w"
 
-/*969:*/
-#line 11538 "./marpa.w"
+/*1120:*/
+#line 14641 "./marpa.w"
+
+if(_MARPA_UNLIKELY(R_Generation_of_TRV(trv)!=R_Generation(r))){
+MARPA_ERROR(MARPA_ERR_BASE_GENERATION_MISMATCH);
+return failure_indicator;
+}
+
+/*:1120*/
+#line 15069 "./marpa.w"
+
+/*1145:*/
+#line 15036 "./marpa.w"
 
 if(TRV_is_Trivial(trv)){
 MARPA_ERROR(MARPA_ERR_GRAMMAR_IS_TRIVIAL);
 return failure_indicator;
 }
 
-/*:969*/
-#line 11570 "./marpa.w"
+/*:1145*/
+#line 15070 "./marpa.w"
 
 {
 const YIM yim= YIM_of_TRV(trv);
@@ -15562,29 +19649,28 @@ return xrl_position;
 }
 }
 
-/*:972*//*973:*/
-#line 11584 "./marpa.w"
+/*:1148*//*1149:*/
+#line 15084 "./marpa.w"
 
 int marpa_trv_origin(Marpa_Traverser trv)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 15087 "./marpa.w"
 
-/*:1313*/
-#line 11587 "./marpa.w"
-
-/*944:*/
-#line 11167 "./marpa.w"
+/*1117:*/
+#line 14630 "./marpa.w"
 
 const RECCE r UNUSED= R_of_TRV(trv);
 const GRAMMAR g UNUSED= G_of_R(r);
 
-/*:944*/
-#line 11588 "./marpa.w"
+/*:1117*/
+#line 15088 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -15595,19 +19681,30 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 11589 "./marpa.w"
+/*:1521*/
+#line 15089 "./marpa.w"
 
-/*969:*/
-#line 11538 "./marpa.w"
+/*1120:*/
+#line 14641 "./marpa.w"
+
+if(_MARPA_UNLIKELY(R_Generation_of_TRV(trv)!=R_Generation(r))){
+MARPA_ERROR(MARPA_ERR_BASE_GENERATION_MISMATCH);
+return failure_indicator;
+}
+
+/*:1120*/
+#line 15090 "./marpa.w"
+
+/*1145:*/
+#line 15036 "./marpa.w"
 
 if(TRV_is_Trivial(trv)){
 MARPA_ERROR(MARPA_ERR_GRAMMAR_IS_TRIVIAL);
 return failure_indicator;
 }
 
-/*:969*/
-#line 11590 "./marpa.w"
+/*:1145*/
+#line 15091 "./marpa.w"
 
 {
 const YIM yim= YIM_of_TRV(trv);
@@ -15615,29 +19712,28 @@ return Origin_Ord_of_YIM(yim);
 }
 }
 
-/*:973*//*974:*/
-#line 11598 "./marpa.w"
+/*:1149*//*1150:*/
+#line 15099 "./marpa.w"
 
 Marpa_IRL_ID marpa_trv_nrl_id(Marpa_Traverser trv)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 15102 "./marpa.w"
 
-/*:1313*/
-#line 11601 "./marpa.w"
-
-/*944:*/
-#line 11167 "./marpa.w"
+/*1117:*/
+#line 14630 "./marpa.w"
 
 const RECCE r UNUSED= R_of_TRV(trv);
 const GRAMMAR g UNUSED= G_of_R(r);
 
-/*:944*/
-#line 11602 "./marpa.w"
+/*:1117*/
+#line 15103 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -15648,19 +19744,30 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 11603 "./marpa.w"
+/*:1521*/
+#line 15104 "./marpa.w"
 
-/*969:*/
-#line 11538 "./marpa.w"
+/*1120:*/
+#line 14641 "./marpa.w"
+
+if(_MARPA_UNLIKELY(R_Generation_of_TRV(trv)!=R_Generation(r))){
+MARPA_ERROR(MARPA_ERR_BASE_GENERATION_MISMATCH);
+return failure_indicator;
+}
+
+/*:1120*/
+#line 15105 "./marpa.w"
+
+/*1145:*/
+#line 15036 "./marpa.w"
 
 if(TRV_is_Trivial(trv)){
 MARPA_ERROR(MARPA_ERR_GRAMMAR_IS_TRIVIAL);
 return failure_indicator;
 }
 
-/*:969*/
-#line 11604 "./marpa.w"
+/*:1145*/
+#line 15106 "./marpa.w"
 
 {
 const YIM yim= YIM_of_TRV(trv);
@@ -15671,29 +19778,28 @@ if(nrl)return ID_of_IRL(nrl);
 return-1;
 }
 
-/*:974*//*975:*/
-#line 11615 "./marpa.w"
+/*:1150*//*1151:*/
+#line 15117 "./marpa.w"
 
 int marpa_trv_nrl_dot(Marpa_Traverser trv)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 15120 "./marpa.w"
 
-/*:1313*/
-#line 11618 "./marpa.w"
-
-/*944:*/
-#line 11167 "./marpa.w"
+/*1117:*/
+#line 14630 "./marpa.w"
 
 const RECCE r UNUSED= R_of_TRV(trv);
 const GRAMMAR g UNUSED= G_of_R(r);
 
-/*:944*/
-#line 11619 "./marpa.w"
+/*:1117*/
+#line 15121 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -15704,19 +19810,30 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 11620 "./marpa.w"
+/*:1521*/
+#line 15122 "./marpa.w"
 
-/*969:*/
-#line 11538 "./marpa.w"
+/*1120:*/
+#line 14641 "./marpa.w"
+
+if(_MARPA_UNLIKELY(R_Generation_of_TRV(trv)!=R_Generation(r))){
+MARPA_ERROR(MARPA_ERR_BASE_GENERATION_MISMATCH);
+return failure_indicator;
+}
+
+/*:1120*/
+#line 15123 "./marpa.w"
+
+/*1145:*/
+#line 15036 "./marpa.w"
 
 if(TRV_is_Trivial(trv)){
 MARPA_ERROR(MARPA_ERR_GRAMMAR_IS_TRIVIAL);
 return failure_indicator;
 }
 
-/*:969*/
-#line 11621 "./marpa.w"
+/*:1145*/
+#line 15124 "./marpa.w"
 
 {
 const YIM yim= YIM_of_TRV(trv);
@@ -15725,67 +19842,71 @@ return Position_of_AHM(ahm);
 }
 }
 
-/*:975*//*985:*/
-#line 11665 "./marpa.w"
+/*:1151*//*1161:*/
+#line 15168 "./marpa.w"
 
 int marpa_ltrv_soft_error(Marpa_LTraverser ltrv)
 {
 return LTRV_has_Soft_Error(ltrv);
 }
 
-/*:985*//*990:*/
-#line 11683 "./marpa.w"
+/*:1161*//*1169:*/
+#line 15199 "./marpa.w"
 
 PRIVATE Marpa_LTraverser
 ltrv_new(RECCE r,LIM lim)
 {
 LTRAVERSER ltrv;
 
-ltrv= my_malloc(sizeof(*ltrv));
-/*984:*/
-#line 11663 "./marpa.w"
+ltrv= marpa__a_malloc(Allocator_of_G(G_of_R(r)),sizeof(*ltrv));
+/*1160:*/
+#line 15166 "./marpa.w"
 
 LTRV_has_Soft_Error(ltrv)= 0;
-/*:984*//*987:*/
-#line 11674 "./marpa.w"
+/*:1160*//*1163:*/
+#line 15177 "./marpa.w"
 
 R_of_LTRV(ltrv)= r;
 
-/*:987*//*997:*/
-#line 11743 "./marpa.w"
+/*:1163*//*1166:*/
+#line 15189 "./marpa.w"
+
+R_Generation_of_LTRV(ltrv)= R_Generation(r);
+/*:1166*//*1176:*/
+#line 15261 "./marpa.w"
 
 ltrv->t_ref_count= 1;
-/*:997*/
-#line 11690 "./marpa.w"
+/*:1176*/
+#line 15206 "./marpa.w"
 
 recce_ref(r);
 LIM_of_LTRV(ltrv)= lim;
 return ltrv;
 }
 
-/*:990*//*991:*/
-#line 11697 "./marpa.w"
+/*:1169*//*1170:*/
+#line 15213 "./marpa.w"
 
 Marpa_LTraverser marpa_ltrv_predecessor(Marpa_LTraverser ltrv)
 {
-/*1312:*/
-#line 15626 "./marpa.w"
+/*1499:*/
+#line 19377 "./marpa.w"
 void*const failure_indicator= NULL;
-/*:1312*/
-#line 11700 "./marpa.w"
+/*:1499*/
+#line 15216 "./marpa.w"
 
-/*988:*/
-#line 11677 "./marpa.w"
+/*1164:*/
+#line 15180 "./marpa.w"
 
 const RECCE r UNUSED= R_of_LTRV(ltrv);
 const GRAMMAR g UNUSED= G_of_R(r);
 
-/*:988*/
-#line 11701 "./marpa.w"
+/*:1164*/
+#line 15217 "./marpa.w"
 
 LIM predecessor;
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -15796,8 +19917,19 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 11703 "./marpa.w"
+/*:1521*/
+#line 15219 "./marpa.w"
+
+/*1167:*/
+#line 15191 "./marpa.w"
+
+if(_MARPA_UNLIKELY(R_Generation_of_LTRV(ltrv)!=R_Generation(r))){
+MARPA_ERROR(MARPA_ERR_BASE_GENERATION_MISMATCH);
+return failure_indicator;
+}
+
+/*:1167*/
+#line 15220 "./marpa.w"
 
 LTRV_has_Soft_Error(ltrv)= 0;
 predecessor= Predecessor_LIM_of_LIM(LIM_of_LTRV(ltrv));
@@ -15808,30 +19940,29 @@ return NULL;
 return ltrv_new(r,predecessor);
 }
 
-/*:991*//*993:*/
-#line 11715 "./marpa.w"
+/*:1170*//*1172:*/
+#line 15232 "./marpa.w"
 
 Marpa_Rule_ID
 marpa_ltrv_trailhead_eim(Marpa_LTraverser ltrv,int*p_dot,Marpa_Earley_Set_ID*p_origin)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 15236 "./marpa.w"
 
-/*:1313*/
-#line 11719 "./marpa.w"
-
-/*988:*/
-#line 11677 "./marpa.w"
+/*1164:*/
+#line 15180 "./marpa.w"
 
 const RECCE r UNUSED= R_of_LTRV(ltrv);
 const GRAMMAR g UNUSED= G_of_R(r);
 
-/*:988*/
-#line 11720 "./marpa.w"
+/*:1164*/
+#line 15237 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -15842,8 +19973,19 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 11721 "./marpa.w"
+/*:1521*/
+#line 15238 "./marpa.w"
+
+/*1167:*/
+#line 15191 "./marpa.w"
+
+if(_MARPA_UNLIKELY(R_Generation_of_LTRV(ltrv)!=R_Generation(r))){
+MARPA_ERROR(MARPA_ERR_BASE_GENERATION_MISMATCH);
+return failure_indicator;
+}
+
+/*:1167*/
+#line 15239 "./marpa.w"
 
 {
 const LIM lim= LIM_of_LTRV(ltrv);
@@ -15861,8 +20003,8 @@ return ID_of_XRL(xrl);
 return-1;
 }
 
-/*:993*//*998:*/
-#line 11746 "./marpa.w"
+/*:1172*//*1177:*/
+#line 15264 "./marpa.w"
 
 PRIVATE void
 ltraverser_unref(LTRAVERSER ltrv)
@@ -15880,8 +20022,8 @@ marpa_ltrv_unref(Marpa_LTraverser ltrv)
 ltraverser_unref(ltrv);
 }
 
-/*:998*//*999:*/
-#line 11764 "./marpa.w"
+/*:1177*//*1178:*/
+#line 15282 "./marpa.w"
 
 PRIVATE LTRAVERSER
 ltraverser_ref(LTRAVERSER ltrv)
@@ -15896,47 +20038,48 @@ marpa_ltrv_ref(Marpa_LTraverser ltrv)
 return ltraverser_ref(ltrv);
 }
 
-/*:999*//*1001:*/
-#line 11781 "./marpa.w"
+/*:1178*//*1180:*/
+#line 15299 "./marpa.w"
 
 PRIVATE void
 ltraverser_free(LTRAVERSER ltrv)
 {
-/*988:*/
-#line 11677 "./marpa.w"
+/*1164:*/
+#line 15180 "./marpa.w"
 
 const RECCE r UNUSED= R_of_LTRV(ltrv);
 const GRAMMAR g UNUSED= G_of_R(r);
 
-/*:988*/
-#line 11785 "./marpa.w"
+/*:1164*/
+#line 15303 "./marpa.w"
 
+struct marpa_allocator_s allocator= *Allocator_of_G(g);
 if(ltrv)
 {
-/*981:*/
-#line 11655 "./marpa.w"
+/*1157:*/
+#line 15158 "./marpa.w"
 
 {
 recce_unref(R_of_LTRV(ltrv));
 }
 
-/*:981*/
-#line 11788 "./marpa.w"
+/*:1157*/
+#line 15307 "./marpa.w"
 ;
 }
-my_free(ltrv);
+marpa__a_free(&allocator,ltrv);
 }
 
-/*:1001*//*1011:*/
-#line 11832 "./marpa.w"
+/*:1180*//*1190:*/
+#line 15351 "./marpa.w"
 
 int marpa_ptrv_soft_error(Marpa_PTraverser ptrv)
 {
 return PTRV_has_Soft_Error(ptrv);
 }
 
-/*:1011*//*1016:*/
-#line 11853 "./marpa.w"
+/*:1190*//*1198:*/
+#line 15385 "./marpa.w"
 
 PRIVATE Marpa_PTraverser
 ptrv_new(RECCE r,YS ys,NSYID nsyid)
@@ -15945,22 +20088,26 @@ PTRAVERSER ptrv;
 const PIM pim= First_PIM_of_YS_by_NSYID(ys,nsyid);
 
 if(!pim)return NULL;
-ptrv= my_malloc(sizeof(*ptrv));
-/*1010:*/
-#line 11830 "./marpa.w"
+ptrv= marpa__a_malloc(Allocator_of_G(G_of_R(r)),sizeof(*ptrv));
+/*1189:*/
+#line 15349 "./marpa.w"
 
 PTRV_has_Soft_Error(ptrv)= 0;
-/*:1010*//*1013:*/
-#line 11841 "./marpa.w"
+/*:1189*//*1192:*/
+#line 15360 "./marpa.w"
 
 R_of_PTRV(ptrv)= r;
 
-/*:1013*//*1024:*/
-#line 11997 "./marpa.w"
+/*:1192*//*1195:*/
+#line 15372 "./marpa.w"
+
+R_Generation_of_PTRV(ptrv)= R_Generation(r);
+/*:1195*//*1206:*/
+#line 15537 "./marpa.w"
 
 ptrv->t_ref_count= 1;
-/*:1024*/
-#line 11862 "./marpa.w"
+/*:1206*/
+#line 15394 "./marpa.w"
 
 recce_ref(r);
 PIM_of_PTRV(ptrv)= pim;
@@ -15969,23 +20116,23 @@ YS_of_PTRV(ptrv)= ys;
 return ptrv;
 }
 
-/*:1016*//*1017:*/
-#line 11874 "./marpa.w"
+/*:1198*//*1199:*/
+#line 15406 "./marpa.w"
 
 Marpa_PTraverser marpa_ptrv_new(Marpa_Recognizer r,
 Marpa_Earley_Set_ID es_arg,
 Marpa_NSY_ID nsyid
 )
 {
-/*1312:*/
-#line 15626 "./marpa.w"
+/*1499:*/
+#line 19377 "./marpa.w"
 void*const failure_indicator= NULL;
-/*:1312*/
-#line 11880 "./marpa.w"
+/*:1499*/
+#line 15412 "./marpa.w"
 
 const GRAMMAR g= G_of_R(r);
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -15996,8 +20143,8 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 11882 "./marpa.w"
+/*:1521*/
+#line 15414 "./marpa.w"
 
 
 if(_MARPA_UNLIKELY(es_arg<=-2))
@@ -16011,15 +20158,15 @@ MARPA_ERROR(MARPA_ERR_YIM_ID_INVALID);
 return failure_indicator;
 }
 
-/*1330:*/
-#line 15738 "./marpa.w"
+/*1518:*/
+#line 19494 "./marpa.w"
 
 if(_MARPA_UNLIKELY(Input_Phase_of_R(r)==R_BEFORE_INPUT)){
 MARPA_ERROR(MARPA_ERR_RECCE_NOT_STARTED);
 return failure_indicator;
 }
-/*:1330*/
-#line 11895 "./marpa.w"
+/*:1518*/
+#line 15427 "./marpa.w"
 
 
 if(G_is_Trivial(g)){
@@ -16046,37 +20193,41 @@ if(!YS_Ord_is_Valid(r,es_arg))
 MARPA_ERROR(MARPA_ERR_INVALID_LOCATION);
 return failure_indicator;
 }
-ys= YS_of_R_by_Ord(r,es_arg);
+ys= ys_of_r_by_ord(r,es_arg);
+if(_MARPA_UNLIKELY(!ys))
+{
+MARPA_ERROR(MARPA_ERR_EARLEY_SET_FORGOTTEN);
+return failure_indicator;
+}
 }
 
 return ptrv_new(r,ys,nsyid);
 }
 }
 
-/*:1017*//*1018:*/
-#line 11929 "./marpa.w"
+/*:1199*//*1200:*/
+#line 15466 "./marpa.w"
 
 int marpa_ptrv_at_lim(Marpa_PTraverser ptrv)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 15469 "./marpa.w"
 
-/*:1313*/
-#line 11932 "./marpa.w"
-
-/*1014:*/
-#line 11844 "./marpa.w"
+/*1193:*/
+#line 15363 "./marpa.w"
 
 const RECCE r UNUSED= R_of_PTRV(ptrv);
 const GRAMMAR g UNUSED= G_of_R(r);
 
-/*:1014*/
-#line 11933 "./marpa.w"
+/*:1193*/
+#line 15470 "./marpa.w"
 
 PIM pim;
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -16087,8 +20238,19 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 11935 "./marpa.w"
+/*:1521*/
+#line 15472 "./marpa.w"
+
+/*1196:*/
+#line 15374 "./marpa.w"
+
+if(_MARPA_UNLIKELY(R_Generation_of_PTRV(ptrv)!=R_Generation(r))){
+MARPA_ERROR(MARPA_ERR_BASE_GENERATION_MISMATCH);
+return failure_indicator;
+}
+
+/*:1196*/
+#line 15473 "./marpa.w"
 
 
 if(G_is_Trivial(g))return 0;
@@ -16097,30 +20259,29 @@ if(!pim)return 0;
 return PIM_is_LIM(pim);
 }
 
-/*:1018*//*1019:*/
-#line 11944 "./marpa.w"
+/*:1200*//*1201:*/
+#line 15482 "./marpa.w"
 
 int marpa_ptrv_at_eim(Marpa_PTraverser ptrv)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 15485 "./marpa.w"
 
-/*:1313*/
-#line 11947 "./marpa.w"
-
-/*1014:*/
-#line 11844 "./marpa.w"
+/*1193:*/
+#line 15363 "./marpa.w"
 
 const RECCE r UNUSED= R_of_PTRV(ptrv);
 const GRAMMAR g UNUSED= G_of_R(r);
 
-/*:1014*/
-#line 11948 "./marpa.w"
+/*:1193*/
+#line 15486 "./marpa.w"
 
 PIM pim;
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -16131,8 +20292,19 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 11950 "./marpa.w"
+/*:1521*/
+#line 15488 "./marpa.w"
+
+/*1196:*/
+#line 15374 "./marpa.w"
+
+if(_MARPA_UNLIKELY(R_Generation_of_PTRV(ptrv)!=R_Generation(r))){
+MARPA_ERROR(MARPA_ERR_BASE_GENERATION_MISMATCH);
+return failure_indicator;
+}
+
+/*:1196*/
+#line 15489 "./marpa.w"
 
 
 if(G_is_Trivial(g))return 0;
@@ -16141,30 +20313,30 @@ if(!pim)return 0;
 return!PIM_is_LIM(pim);
 }
 
-/*:1019*//*1021:*/
-#line 11963 "./marpa.w"
+/*:1201*//*1203:*/
+#line 15502 "./marpa.w"
 
 Marpa_Traverser marpa_ptrv_eim_iter(Marpa_PTraverser ptrv)
 {
-/*1312:*/
-#line 15626 "./marpa.w"
+/*1499:*/
+#line 19377 "./marpa.w"
 void*const failure_indicator= NULL;
-/*:1312*/
-#line 11966 "./marpa.w"
+/*:1499*/
+#line 15505 "./marpa.w"
 
-/*1014:*/
-#line 11844 "./marpa.w"
+/*1193:*/
+#line 15363 "./marpa.w"
 
 const RECCE r UNUSED= R_of_PTRV(ptrv);
 const GRAMMAR g UNUSED= G_of_R(r);
 
-/*:1014*/
-#line 11967 "./marpa.w"
+/*:1193*/
+#line 15506 "./marpa.w"
 
 PIM pim;
 YIM yim;
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -16175,8 +20347,19 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 11970 "./marpa.w"
+/*:1521*/
+#line 15509 "./marpa.w"
+
+/*1196:*/
+#line 15374 "./marpa.w"
+
+if(_MARPA_UNLIKELY(R_Generation_of_PTRV(ptrv)!=R_Generation(r))){
+MARPA_ERROR(MARPA_ERR_BASE_GENERATION_MISMATCH);
+return failure_indicator;
+}
+
+/*:1196*/
+#line 15510 "./marpa.w"
 
 PTRV_has_Soft_Error(ptrv)= 0;
 
@@ -16201,8 +20384,8 @@ PIM_of_PTRV(ptrv)= Next_PIM_of_PIM(pim);
 return trv_new(r,yim);
 }
 
-/*:1021*//*1025:*/
-#line 12000 "./marpa.w"
+/*:1203*//*1207:*/
+#line 15540 "./marpa.w"
 
 PRIVATE void
 ptraverser_unref(PTRAVERSER ptrv)
@@ -16220,8 +20403,8 @@ marpa_ptrv_unref(Marpa_PTraverser ptrv)
 ptraverser_unref(ptrv);
 }
 
-/*:1025*//*1026:*/
-#line 12018 "./marpa.w"
+/*:1207*//*1208:*/
+#line 15558 "./marpa.w"
 
 PRIVATE PTRAVERSER
 ptraverser_ref(PTRAVERSER ptrv)
@@ -16236,60 +20419,60 @@ marpa_ptrv_ref(Marpa_PTraverser ptrv)
 return ptraverser_ref(ptrv);
 }
 
-/*:1026*//*1028:*/
-#line 12036 "./marpa.w"
+/*:1208*//*1210:*/
+#line 15576 "./marpa.w"
 
 PRIVATE void
 ptraverser_free(PTRAVERSER ptrv)
 {
-/*1014:*/
-#line 11844 "./marpa.w"
+/*1193:*/
+#line 15363 "./marpa.w"
 
 const RECCE r UNUSED= R_of_PTRV(ptrv);
 const GRAMMAR g UNUSED= G_of_R(r);
 
-/*:1014*/
-#line 12040 "./marpa.w"
+/*:1193*/
+#line 15580 "./marpa.w"
 
+struct marpa_allocator_s allocator= *Allocator_of_G(g);
 if(ptrv)
 {
-/*1007:*/
-#line 11822 "./marpa.w"
+/*1186:*/
+#line 15341 "./marpa.w"
 
 {
 recce_unref(R_of_PTRV(ptrv));
 }
 
-/*:1007*/
-#line 12043 "./marpa.w"
+/*:1186*/
+#line 15584 "./marpa.w"
 ;
 }
-my_free(ptrv);
+marpa__a_free(&allocator,ptrv);
 }
 
-/*:1028*//*1032:*/
-#line 12058 "./marpa.w"
+/*:1210*//*1214:*/
+#line 15599 "./marpa.w"
 
 int marpa_ptrv_is_trivial(Marpa_PTraverser ptrv)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 15602 "./marpa.w"
 
-/*:1313*/
-#line 12061 "./marpa.w"
-
-/*1014:*/
-#line 11844 "./marpa.w"
+/*1193:*/
+#line 15363 "./marpa.w"
 
 const RECCE r UNUSED= R_of_PTRV(ptrv);
 const GRAMMAR g UNUSED= G_of_R(r);
 
-/*:1014*/
-#line 12062 "./marpa.w"
+/*:1193*/
+#line 15603 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -16300,8 +20483,19 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 12063 "./marpa.w"
+/*:1521*/
+#line 15604 "./marpa.w"
+
+/*1196:*/
+#line 15374 "./marpa.w"
+
+if(_MARPA_UNLIKELY(R_Generation_of_PTRV(ptrv)!=R_Generation(r))){
+MARPA_ERROR(MARPA_ERR_BASE_GENERATION_MISMATCH);
+return failure_indicator;
+}
+
+/*:1196*/
+#line 15605 "./marpa.w"
 
 return PTRV_is_Trivial(ptrv);
 }
@@ -16313,20 +20507,20 @@ return PTRV_is_Trivial(ptrv);
 
 
 
-/*:1032*//*1047:*/
-#line 12150 "./marpa.w"
+/*:1214*//*1229:*/
+#line 15694 "./marpa.w"
 
 Marpa_Bocage marpa_b_new(Marpa_Recognizer r,
 Marpa_Earley_Set_ID ordinal_arg)
 {
-/*1312:*/
-#line 15626 "./marpa.w"
+/*1499:*/
+#line 19377 "./marpa.w"
 void*const failure_indicator= NULL;
-/*:1312*/
-#line 12154 "./marpa.w"
+/*:1499*/
+#line 15698 "./marpa.w"
 
-/*1050:*/
-#line 12221 "./marpa.w"
+/*1232:*/
+#line 15776 "./marpa.w"
 
 const GRAMMAR g= G_of_R(r);
 const int xsy_count= XSY_Count_of_G(g);
@@ -16338,16 +20532,16 @@ struct marpa_obstack*bocage_setup_obs= NULL;
 int count_of_earley_items_in_parse;
 const int earley_set_count_of_r= YS_Count_of_R(r);
 
-/*:1050*//*1053:*/
-#line 12244 "./marpa.w"
+/*:1232*//*1235:*/
+#line 15799 "./marpa.w"
 
 struct s_bocage_setup_per_ys*per_ys_data= NULL;
 
-/*:1053*/
-#line 12155 "./marpa.w"
+/*:1235*/
+#line 15699 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -16358,8 +20552,30 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 12156 "./marpa.w"
+/*:1521*/
+#line 15700 "./marpa.w"
+
+/*819:*/
+#line 9668 "./marpa.w"
+
+if(_MARPA_UNLIKELY(R_is_Forgetful(r))){
+MARPA_ERROR(MARPA_ERR_RECCE_IS_FORGETFUL);
+return failure_indicator;
+}
+
+/*:819*/
+#line 15701 "./marpa.w"
+
+/*858:*/
+#line 10184 "./marpa.w"
+
+if(_MARPA_UNLIKELY(R_is_Link_Free(r))){
+MARPA_ERROR(MARPA_ERR_RECCE_IS_LINK_FREE);
+return failure_indicator;
+}
+
+/*:858*/
+#line 15702 "./marpa.w"
 
 if(_MARPA_UNLIKELY(ordinal_arg<=-2))
 {
@@ -16367,60 +20583,62 @@ MARPA_ERROR(MARPA_ERR_INVALID_LOCATION);
 return failure_indicator;
 }
 
-/*1330:*/
-#line 15738 "./marpa.w"
+/*1518:*/
+#line 19494 "./marpa.w"
 
 if(_MARPA_UNLIKELY(Input_Phase_of_R(r)==R_BEFORE_INPUT)){
 MARPA_ERROR(MARPA_ERR_RECCE_NOT_STARTED);
 return failure_indicator;
 }
-/*:1330*/
-#line 12163 "./marpa.w"
+/*:1518*/
+#line 15709 "./marpa.w"
 
 {
-struct marpa_obstack*const obstack= marpa_obs_init;
+struct marpa_obstack*const obstack= 
+marpa_obs_cache_init(Chunk_Cache_of_G(g));
 b= marpa_obs_new(obstack,struct marpa_bocage,1);
 OBS_of_B(b)= obstack;
 }
-/*1039:*/
-#line 12107 "./marpa.w"
+/*1221:*/
+#line 15649 "./marpa.w"
 
 ORs_of_B(b)= NULL;
 OR_Count_of_B(b)= 0;
+OR_Capacity_of_B(b)= 0;
 ANDs_of_B(b)= NULL;
 AND_Count_of_B(b)= 0;
 Top_ORID_of_B(b)= -1;
 
-/*:1039*//*1042:*/
-#line 12130 "./marpa.w"
+/*:1221*//*1224:*/
+#line 15674 "./marpa.w"
 
 {
 G_of_B(b)= G_of_R(r);
 grammar_ref(g);
 }
 
-/*:1042*//*1049:*/
-#line 12216 "./marpa.w"
+/*:1224*//*1231:*/
+#line 15771 "./marpa.w"
 
 Valued_BV_of_B(b)= lbv_clone(b->t_obs,r->t_valued,xsy_count);
 Valued_Locked_BV_of_B(b)= 
 lbv_clone(b->t_obs,r->t_valued_locked,xsy_count);
 
-/*:1049*//*1063:*/
-#line 12361 "./marpa.w"
+/*:1231*//*1245:*/
+#line 15916 "./marpa.w"
 
 Ambiguity_Metric_of_B(b)= 1;
 
-/*:1063*//*1067:*/
-#line 12375 "./marpa.w"
+/*:1245*//*1249:*/
+#line 15930 "./marpa.w"
 
 b->t_ref_count= 1;
-/*:1067*//*1074:*/
-#line 12433 "./marpa.w"
+/*:1249*//*1256:*/
+#line 15988 "./marpa.w"
 
 B_is_Nulling(b)= 0;
-/*:1074*/
-#line 12169 "./marpa.w"
+/*:1256*/
+#line 15716 "./marpa.w"
 
 
 if(G_is_Trivial(g)){
@@ -16432,8 +20650,8 @@ B_is_Nulling(b)= 1;
 return b;
 }
 r_update_earley_sets(r);
-/*1054:*/
-#line 12247 "./marpa.w"
+/*1236:*/
+#line 15802 "./marpa.w"
 
 {
 if(ordinal_arg==-1)
@@ -16455,8 +20673,8 @@ goto NO_PARSE;
 end_of_parse_earleme= Earleme_of_YS(end_of_parse_earley_set);
 }
 
-/*:1054*/
-#line 12180 "./marpa.w"
+/*:1236*/
+#line 15727 "./marpa.w"
 
 if(end_of_parse_earleme==0)
 {
@@ -16465,8 +20683,8 @@ goto NO_PARSE;
 B_is_Nulling(b)= 1;
 return b;
 }
-/*1057:*/
-#line 12313 "./marpa.w"
+/*1239:*/
+#line 15868 "./marpa.w"
 
 {
 int yim_ix;
@@ -16488,13 +20706,13 @@ break;
 }
 }
 
-/*:1057*/
-#line 12188 "./marpa.w"
+/*:1239*/
+#line 15735 "./marpa.w"
 
 if(!start_yim)goto NO_PARSE;
-bocage_setup_obs= marpa_obs_init;
-/*1055:*/
-#line 12269 "./marpa.w"
+bocage_setup_obs= marpa_obs_cache_init(Chunk_Cache_of_G(g));
+/*1237:*/
+#line 15824 "./marpa.w"
 
 {
 int earley_set_ordinal;
@@ -16523,11 +20741,11 @@ OR_by_PSI(per_ys_data,earley_set_ordinal,item_ordinal)= NULL;
 }
 }
 
-/*:1055*/
-#line 12191 "./marpa.w"
+/*:1237*/
+#line 15738 "./marpa.w"
 
-/*871:*/
-#line 10139 "./marpa.w"
+/*1044:*/
+#line 13601 "./marpa.w"
 
 {
 UR_Const ur_node;
@@ -16541,8 +20759,8 @@ while((ur_node= ur_node_pop(ur_node_stack)))
 
 const YIM parent_earley_item= YIM_of_UR(ur_node);
 MARPA_ASSERT(!YIM_was_Predicted(parent_earley_item))
-/*874:*/
-#line 10192 "./marpa.w"
+/*1047:*/
+#line 13654 "./marpa.w"
 
 {
 SRCL source_link;
@@ -16563,11 +20781,11 @@ push_ur_if_new(per_ys_data,ur_node_stack,predecessor_earley_item);
 }
 }
 
-/*:874*/
-#line 10152 "./marpa.w"
+/*:1047*/
+#line 13614 "./marpa.w"
 
-/*876:*/
-#line 10226 "./marpa.w"
+/*1049:*/
+#line 13688 "./marpa.w"
 
 {
 SRCL source_link;
@@ -16591,11 +20809,11 @@ push_ur_if_new(per_ys_data,ur_node_stack,predecessor_earley_item);
 }
 }
 
-/*:876*/
-#line 10153 "./marpa.w"
+/*:1049*/
+#line 13615 "./marpa.w"
 
-/*877:*/
-#line 10249 "./marpa.w"
+/*1050:*/
+#line 13711 "./marpa.w"
 
 {
 SRCL source_link;
@@ -16630,25 +20848,25 @@ push_ur_if_new(per_ys_data,ur_node_stack,leo_base_yim);
 }
 }
 
-/*:877*/
-#line 10154 "./marpa.w"
+/*:1050*/
+#line 13616 "./marpa.w"
 
 }
 }
 
-/*:871*/
-#line 12192 "./marpa.w"
+/*:1044*/
+#line 15739 "./marpa.w"
 
-/*889:*/
-#line 10376 "./marpa.w"
+/*1062:*/
+#line 13838 "./marpa.w"
 
 {
 PSAR_Object or_per_ys_arena;
 const PSAR or_psar= &or_per_ys_arena;
 int work_earley_set_ordinal;
 OR_Capacity_of_B(b)= count_of_earley_items_in_parse;
-ORs_of_B(b)= marpa_new(OR,OR_Capacity_of_B(b));
-psar_init(or_psar,SYMI_Count_of_G(g));
+ORs_of_B(b)= marpa_a_new(Allocator_of_G(g),OR,OR_Capacity_of_B(b));
+psar_init(or_psar,SYMI_Count_of_G(g),Allocator_of_G(g));
 for(work_earley_set_ordinal= 0;
 work_earley_set_ordinal<earley_set_count_of_r;
 work_earley_set_ordinal++)
@@ -16660,8 +20878,8 @@ PSL this_earley_set_psl;
 psar_dealloc(or_psar);
 this_earley_set_psl
 = psl_claim_by_es(or_psar,per_ys_data,work_earley_set_ordinal);
-/*890:*/
-#line 10402 "./marpa.w"
+/*1063:*/
+#line 13865 "./marpa.w"
 
 {
 int item_ordinal;
@@ -16672,8 +20890,8 @@ if(OR_by_PSI(per_ys_data,work_earley_set_ordinal,item_ordinal))
 {
 const YIM work_earley_item= yims_of_ys[item_ordinal];
 {
-/*891:*/
-#line 10418 "./marpa.w"
+/*1064:*/
+#line 13881 "./marpa.w"
 
 {
 AHM ahm= AHM_of_YIM(work_earley_item);
@@ -16687,8 +20905,8 @@ ahm_symbol_instance= SYMI_of_AHM(ahm);
 {
 PSL or_psl= psl_claim_by_es(or_psar,per_ys_data,work_origin_ordinal);
 OR last_or_node= NULL;
-/*893:*/
-#line 10452 "./marpa.w"
+/*1066:*/
+#line 13915 "./marpa.w"
 
 {
 if(ahm_symbol_instance>=0)
@@ -16711,11 +20929,11 @@ psi_or_node= or_node;
 }
 }
 
-/*:893*/
-#line 10431 "./marpa.w"
+/*:1066*/
+#line 13894 "./marpa.w"
 
-/*896:*/
-#line 10500 "./marpa.w"
+/*1069:*/
+#line 13963 "./marpa.w"
 
 {
 const int null_count= Null_Count_of_AHM(ahm);
@@ -16750,8 +20968,8 @@ psi_or_node= or_node;
 }
 }
 
-/*:896*/
-#line 10432 "./marpa.w"
+/*:1069*/
+#line 13895 "./marpa.w"
 
 }
 
@@ -16764,8 +20982,8 @@ MARPA_OFF_ASSERT(psi_or_node)
 
 OR_by_PSI(per_ys_data,working_ys_ordinal,working_yim_ordinal)
 = psi_or_node;
-/*897:*/
-#line 10535 "./marpa.w"
+/*1070:*/
+#line 13998 "./marpa.w"
 
 {
 SRCL source_link;
@@ -16774,8 +20992,8 @@ source_link;source_link= Next_SRCL_of_SRCL(source_link))
 {
 LIM leo_predecessor= LIM_of_SRCL(source_link);
 if(leo_predecessor){
-/*898:*/
-#line 10552 "./marpa.w"
+/*1071:*/
+#line 14015 "./marpa.w"
 
 {
 LIM this_leo_item= leo_predecessor;
@@ -16788,8 +21006,8 @@ const IRL path_irl= IRL_of_AHM(path_ahm);
 const int symbol_instance_of_path_ahm= SYMI_of_AHM(path_ahm);
 {
 OR last_or_node= NULL;
-/*899:*/
-#line 10574 "./marpa.w"
+/*1072:*/
+#line 14037 "./marpa.w"
 
 {
 {
@@ -16811,11 +21029,11 @@ symbol_instance_of_path_ahm-SYMI_of_IRL(path_irl)+1;
 }
 }
 
-/*:899*/
-#line 10564 "./marpa.w"
+/*:1072*/
+#line 14027 "./marpa.w"
 
-/*900:*/
-#line 10599 "./marpa.w"
+/*1073:*/
+#line 14062 "./marpa.w"
 
 {
 int i;
@@ -16848,39 +21066,39 @@ MARPA_ASSERT(Position_of_OR(or_node)>=SYMI_of_IRL(path_irl))
 }
 }
 
-/*:900*/
-#line 10565 "./marpa.w"
+/*:1073*/
+#line 14028 "./marpa.w"
 
 }
 previous_leo_item= this_leo_item;
 }
 }
 
-/*:898*/
-#line 10543 "./marpa.w"
+/*:1071*/
+#line 14006 "./marpa.w"
 
 }
 }
 }
 
-/*:897*/
-#line 10444 "./marpa.w"
+/*:1070*/
+#line 13907 "./marpa.w"
 
 }
 
-/*:891*/
-#line 10412 "./marpa.w"
+/*:1064*/
+#line 13875 "./marpa.w"
 
 }
 }
 }
 }
 
-/*:890*/
-#line 10395 "./marpa.w"
+/*:1063*/
+#line 13857 "./marpa.w"
 
-/*906:*/
-#line 10695 "./marpa.w"
+/*1079:*/
+#line 14158 "./marpa.w"
 
 {
 int item_ordinal;
@@ -16889,8 +21107,8 @@ for(item_ordinal= 0;item_ordinal<item_count;item_ordinal++)
 OR or_node= OR_by_PSI(per_ys_data,work_earley_set_ordinal,item_ordinal);
 const YIM work_earley_item= yims_of_ys[item_ordinal];
 const int work_origin_ordinal= Ord_of_YS(Origin_of_YIM(work_earley_item));
-/*907:*/
-#line 10712 "./marpa.w"
+/*1080:*/
+#line 14175 "./marpa.w"
 
 {
 while(or_node){
@@ -16905,12 +21123,12 @@ or_node= predecessor_or;
 }
 }
 
-/*:907*/
-#line 10703 "./marpa.w"
+/*:1080*/
+#line 14166 "./marpa.w"
 
 if(or_node){
-/*908:*/
-#line 10726 "./marpa.w"
+/*1081:*/
+#line 14189 "./marpa.w"
 
 {
 const AHM work_ahm= AHM_of_YIM(work_earley_item);
@@ -16918,8 +21136,8 @@ MARPA_ASSERT(work_ahm>=AHM_by_ID(1))
 const int work_symbol_instance= SYMI_of_AHM(work_ahm);
 const OR work_proper_or_node= or_by_origin_and_symi(per_ys_data,
 work_origin_ordinal,work_symbol_instance);
-/*910:*/
-#line 10768 "./marpa.w"
+/*1083:*/
+#line 14231 "./marpa.w"
 
 {
 SRCL source_link;
@@ -16935,8 +21153,8 @@ if(!SRCL_is_Active(source_link))continue;
 cause_earley_item= Cause_of_SRCL(source_link);
 leo_predecessor= LIM_of_SRCL(source_link);
 if(leo_predecessor){
-/*911:*/
-#line 10789 "./marpa.w"
+/*1084:*/
+#line 14252 "./marpa.w"
 
 {
 
@@ -16949,13 +21167,13 @@ OR dand_predecessor;
 OR path_or_node;
 YIM base_earley_item= Trailhead_YIM_of_LIM(path_leo_item);
 dand_predecessor= set_or_from_yim(per_ys_data,base_earley_item);
-/*912:*/
-#line 10816 "./marpa.w"
+/*1085:*/
+#line 14279 "./marpa.w"
 
 {
 if(higher_path_leo_item){
-/*921:*/
-#line 10944 "./marpa.w"
+/*1094:*/
+#line 14407 "./marpa.w"
 
 {
 int symbol_instance;
@@ -16967,19 +21185,19 @@ path_or_node= or_by_origin_and_symi(per_ys_data,origin_ordinal,symbol_instance);
 }
 
 
-/*:921*/
-#line 10819 "./marpa.w"
+/*:1094*/
+#line 14282 "./marpa.w"
 
 }else{
 path_or_node= work_proper_or_node;
 }
 }
 
-/*:912*/
-#line 10801 "./marpa.w"
+/*:1085*/
+#line 14264 "./marpa.w"
 
-/*914:*/
-#line 10835 "./marpa.w"
+/*1087:*/
+#line 14298 "./marpa.w"
 
 {
 const OR dand_cause
@@ -16990,8 +21208,8 @@ dand_predecessor,dand_cause);
 }
 }
 
-/*:914*/
-#line 10802 "./marpa.w"
+/*:1087*/
+#line 14265 "./marpa.w"
 
 previous_path_irl= path_irl;
 while(higher_path_leo_item){
@@ -17000,13 +21218,13 @@ higher_path_leo_item= Predecessor_LIM_of_LIM(path_leo_item);
 base_earley_item= Trailhead_YIM_of_LIM(path_leo_item);
 dand_predecessor
 = set_or_from_yim(per_ys_data,base_earley_item);
-/*912:*/
-#line 10816 "./marpa.w"
+/*1085:*/
+#line 14279 "./marpa.w"
 
 {
 if(higher_path_leo_item){
-/*921:*/
-#line 10944 "./marpa.w"
+/*1094:*/
+#line 14407 "./marpa.w"
 
 {
 int symbol_instance;
@@ -17018,19 +21236,19 @@ path_or_node= or_by_origin_and_symi(per_ys_data,origin_ordinal,symbol_instance);
 }
 
 
-/*:921*/
-#line 10819 "./marpa.w"
+/*:1094*/
+#line 14282 "./marpa.w"
 
 }else{
 path_or_node= work_proper_or_node;
 }
 }
 
-/*:912*/
-#line 10810 "./marpa.w"
+/*:1085*/
+#line 14273 "./marpa.w"
 
-/*917:*/
-#line 10861 "./marpa.w"
+/*1090:*/
+#line 14324 "./marpa.w"
 
 {
 const SYMI symbol_instance= SYMI_of_Completed_IRL(previous_path_irl);
@@ -17042,25 +21260,25 @@ dand_predecessor,dand_cause);
 }
 }
 
-/*:917*/
-#line 10811 "./marpa.w"
+/*:1090*/
+#line 14274 "./marpa.w"
 
 previous_path_irl= path_irl;
 }
 }
 
-/*:911*/
-#line 10783 "./marpa.w"
+/*:1084*/
+#line 14246 "./marpa.w"
 
 }
 }
 }
 
-/*:910*/
-#line 10733 "./marpa.w"
+/*:1083*/
+#line 14196 "./marpa.w"
 
-/*922:*/
-#line 10959 "./marpa.w"
+/*1095:*/
+#line 14422 "./marpa.w"
 
 {
 SRCL tkn_source_link;
@@ -17091,11 +21309,11 @@ dand_predecessor,new_token_or_node);
 }
 }
 
-/*:922*/
-#line 10734 "./marpa.w"
+/*:1095*/
+#line 14197 "./marpa.w"
 
-/*924:*/
-#line 11001 "./marpa.w"
+/*1097:*/
+#line 14464 "./marpa.w"
 
 {
 SRCL source_link;
@@ -17118,36 +21336,44 @@ dand_predecessor,dand_cause);
 }
 }
 
-/*:924*/
-#line 10735 "./marpa.w"
+/*:1097*/
+#line 14198 "./marpa.w"
 
 }
 
-/*:908*/
-#line 10705 "./marpa.w"
+/*:1081*/
+#line 14168 "./marpa.w"
 
 }
 }
 }
 
-/*:906*/
-#line 10396 "./marpa.w"
+/*:1079*/
+#line 13858 "./marpa.w"
 
 }
 psar_destroy(or_psar);
-ORs_of_B(b)= marpa_renew(OR,ORs_of_B(b),OR_Count_of_B(b));
+ORs_of_B(b)= marpa_a_renew(Allocator_of_G(g),OR,ORs_of_B(b),OR_Count_of_B(b));
+OR_Capacity_of_B(b)= OR_Count_of_B(b);
 }
 
-/*:889*/
-#line 12193 "./marpa.w"
+/*:1062*/
+#line 15740 "./marpa.w"
 
-/*930:*/
-#line 11073 "./marpa.w"
+if(_MARPA_UNLIKELY(memory_limit_is_exceeded(r,
+bocage_memory_usage(b)+marpa_obs_allocated(bocage_setup_obs))))
+{
+marpa_obs_free(bocage_setup_obs);
+MARPA_ERROR(MARPA_ERR_MEMORY_LIMIT);
+goto FAILURE;
+}
+/*1103:*/
+#line 14536 "./marpa.w"
 
 {
 int unique_draft_and_node_count= 0;
-/*925:*/
-#line 11026 "./marpa.w"
+/*1098:*/
+#line 14489 "./marpa.w"
 
 {
 const int or_node_count_of_b= OR_Count_of_B(b);
@@ -17165,18 +21391,18 @@ or_node_id++;
 }
 }
 
-/*:925*/
-#line 11076 "./marpa.w"
+/*:1098*/
+#line 14539 "./marpa.w"
 
-/*931:*/
-#line 11080 "./marpa.w"
+/*1104:*/
+#line 14543 "./marpa.w"
 
 {
 const int or_count_of_b= OR_Count_of_B(b);
 int or_node_id;
 int and_node_id= 0;
 const AND ands_of_b= ANDs_of_B(b)= 
-marpa_new(AND_Object,unique_draft_and_node_count);
+marpa_a_new(Allocator_of_G(g),AND_Object,unique_draft_and_node_count);
 for(or_node_id= 0;or_node_id<or_count_of_b;or_node_id++)
 {
 int and_count_of_parent_or= 0;
@@ -17201,16 +21427,16 @@ AND_Count_of_B(b)= and_node_id;
 MARPA_ASSERT(and_node_id==unique_draft_and_node_count);
 }
 
-/*:931*/
-#line 11077 "./marpa.w"
+/*:1104*/
+#line 14540 "./marpa.w"
 
 }
 
-/*:930*/
-#line 12194 "./marpa.w"
+/*:1103*/
+#line 15748 "./marpa.w"
 
-/*1058:*/
-#line 12334 "./marpa.w"
+/*1240:*/
+#line 15889 "./marpa.w"
 
 {
 const YSID end_of_parse_ordinal= Ord_of_YS(end_of_parse_earley_set);
@@ -17220,72 +21446,73 @@ OR_by_PSI(per_ys_data,end_of_parse_ordinal,start_earley_item_ordinal);
 Top_ORID_of_B(b)= ID_of_OR(root_or_node);
 }
 
-/*:1058*/
-#line 12195 "./marpa.w"
+/*:1240*/
+#line 15749 "./marpa.w"
 ;
 marpa_obs_free(bocage_setup_obs);
 return b;
 NO_PARSE:;
 MARPA_ERROR(MARPA_ERR_NO_PARSE);
+FAILURE:;
 if(b){
-/*1070:*/
-#line 12411 "./marpa.w"
+/*1252:*/
+#line 15966 "./marpa.w"
 
-/*1040:*/
-#line 12114 "./marpa.w"
+/*1222:*/
+#line 15657 "./marpa.w"
 
 {
 OR*or_nodes= ORs_of_B(b);
 AND and_nodes= ANDs_of_B(b);
+struct marpa_allocator_s allocator= *Allocator_of_G(G_of_B(b));
 
 grammar_unref(G_of_B(b));
-my_free(or_nodes);
+marpa__a_free(&allocator,or_nodes);
 ORs_of_B(b)= NULL;
-my_free(and_nodes);
+marpa__a_free(&allocator,and_nodes);
 ANDs_of_B(b)= NULL;
 }
 
-/*:1040*/
-#line 12412 "./marpa.w"
+/*:1222*/
+#line 15967 "./marpa.w"
 ;
-/*1046:*/
-#line 12146 "./marpa.w"
+/*1228:*/
+#line 15690 "./marpa.w"
 
 marpa_obs_free(OBS_of_B(b));
 
-/*:1046*/
-#line 12413 "./marpa.w"
+/*:1228*/
+#line 15968 "./marpa.w"
 ;
 
-/*:1070*/
-#line 12201 "./marpa.w"
+/*:1252*/
+#line 15756 "./marpa.w"
 ;
 }
 return NULL;
 }
 
-/*:1047*//*1060:*/
-#line 12345 "./marpa.w"
+/*:1229*//*1242:*/
+#line 15900 "./marpa.w"
 
 Marpa_Or_Node_ID _marpa_b_top_or_node(Marpa_Bocage b)
-{
-/*1313:*/
-#line 15629 "./marpa.w"
+{
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 15903 "./marpa.w"
 
-/*:1313*/
-#line 12348 "./marpa.w"
-
-/*1044:*/
-#line 12138 "./marpa.w"
+/*1226:*/
+#line 15682 "./marpa.w"
 
 const GRAMMAR g UNUSED= G_of_B(b);
 
-/*:1044*/
-#line 12349 "./marpa.w"
+/*:1226*/
+#line 15904 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -17296,34 +21523,33 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 12350 "./marpa.w"
+/*:1521*/
+#line 15905 "./marpa.w"
 
 return Top_ORID_of_B(b);
 }
 
-/*:1060*//*1064:*/
-#line 12364 "./marpa.w"
+/*:1242*//*1246:*/
+#line 15919 "./marpa.w"
 
 int marpa_b_ambiguity_metric(Marpa_Bocage b)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 15922 "./marpa.w"
 
-/*:1313*/
-#line 12367 "./marpa.w"
-
-/*1044:*/
-#line 12138 "./marpa.w"
+/*1226:*/
+#line 15682 "./marpa.w"
 
 const GRAMMAR g UNUSED= G_of_B(b);
 
-/*:1044*/
-#line 12368 "./marpa.w"
+/*:1226*/
+#line 15923 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -17334,14 +21560,14 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 12369 "./marpa.w"
+/*:1521*/
+#line 15924 "./marpa.w"
 
 return Ambiguity_Metric_of_B(b);
 }
 
-/*:1064*//*1068:*/
-#line 12378 "./marpa.w"
+/*:1246*//*1250:*/
+#line 15933 "./marpa.w"
 
 PRIVATE void
 bocage_unref(BOCAGE b)
@@ -17359,8 +21585,8 @@ marpa_b_unref(Marpa_Bocage b)
 bocage_unref(b);
 }
 
-/*:1068*//*1069:*/
-#line 12396 "./marpa.w"
+/*:1250*//*1251:*/
+#line 15951 "./marpa.w"
 
 PRIVATE BOCAGE
 bocage_ref(BOCAGE b)
@@ -17375,79 +21601,79 @@ marpa_b_ref(Marpa_Bocage b)
 return bocage_ref(b);
 }
 
-/*:1069*//*1071:*/
-#line 12417 "./marpa.w"
+/*:1251*//*1253:*/
+#line 15972 "./marpa.w"
 
 PRIVATE void
 bocage_free(BOCAGE b)
 {
-/*1044:*/
-#line 12138 "./marpa.w"
+/*1226:*/
+#line 15682 "./marpa.w"
 
 const GRAMMAR g UNUSED= G_of_B(b);
 
-/*:1044*/
-#line 12421 "./marpa.w"
+/*:1226*/
+#line 15976 "./marpa.w"
 
 if(b)
 {
-/*1070:*/
-#line 12411 "./marpa.w"
+/*1252:*/
+#line 15966 "./marpa.w"
 
-/*1040:*/
-#line 12114 "./marpa.w"
+/*1222:*/
+#line 15657 "./marpa.w"
 
 {
 OR*or_nodes= ORs_of_B(b);
 AND and_nodes= ANDs_of_B(b);
+struct marpa_allocator_s allocator= *Allocator_of_G(G_of_B(b));
 
 grammar_unref(G_of_B(b));
-my_free(or_nodes);
+marpa__a_free(&allocator,or_nodes);
 ORs_of_B(b)= NULL;
-my_free(and_nodes);
+marpa__a_free(&allocator,and_nodes);
 ANDs_of_B(b)= NULL;
 }
 
-/*:1040*/
-#line 12412 "./marpa.w"
+/*:1222*/
+#line 15967 "./marpa.w"
 ;
-/*1046:*/
-#line 12146 "./marpa.w"
+/*1228:*/
+#line 15690 "./marpa.w"
 
 marpa_obs_free(OBS_of_B(b));
 
-/*:1046*/
-#line 12413 "./marpa.w"
+/*:1228*/
+#line 15968 "./marpa.w"
 ;
 
-/*:1070*/
-#line 12424 "./marpa.w"
+/*:1252*/
+#line 15979 "./marpa.w"
 ;
 }
 }
 
-/*:1071*//*1075:*/
-#line 12435 "./marpa.w"
+/*:1253*//*1257:*/
+#line 15990 "./marpa.w"
 
 int marpa_b_is_null(Marpa_Bocage b)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 15993 "./marpa.w"
 
-/*:1313*/
-#line 12438 "./marpa.w"
-
-/*1044:*/
-#line 12138 "./marpa.w"
+/*1226:*/
+#line 15682 "./marpa.w"
 
 const GRAMMAR g UNUSED= G_of_B(b);
 
-/*:1044*/
-#line 12439 "./marpa.w"
+/*:1226*/
+#line 15994 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -17458,34 +21684,34 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 12440 "./marpa.w"
+/*:1521*/
+#line 15995 "./marpa.w"
 
 return B_is_Nulling(b);
 }
 
-/*:1075*//*1082:*/
-#line 12480 "./marpa.w"
+/*:1257*//*1264:*/
+#line 16035 "./marpa.w"
 
 Marpa_Order marpa_o_new(Marpa_Bocage b)
 {
-/*1312:*/
-#line 15626 "./marpa.w"
+/*1499:*/
+#line 19377 "./marpa.w"
 void*const failure_indicator= NULL;
-/*:1312*/
-#line 12483 "./marpa.w"
+/*:1499*/
+#line 16038 "./marpa.w"
 
-/*1044:*/
-#line 12138 "./marpa.w"
+/*1226:*/
+#line 15682 "./marpa.w"
 
 const GRAMMAR g UNUSED= G_of_B(b);
 
-/*:1044*/
-#line 12484 "./marpa.w"
+/*:1226*/
+#line 16039 "./marpa.w"
 
 ORDER o;
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -17496,14 +21722,14 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 12486 "./marpa.w"
+/*:1521*/
+#line 16041 "./marpa.w"
 
-o= my_malloc(sizeof(*o));
+o= marpa__a_malloc(Allocator_of_G(g),sizeof(*o));
 B_of_O(o)= b;
 bocage_ref(b);
-/*1079:*/
-#line 12468 "./marpa.w"
+/*1261:*/
+#line 16023 "./marpa.w"
 
 {
 o->t_and_node_orderings= NULL;
@@ -17511,25 +21737,25 @@ o->t_is_frozen= 0;
 OBS_of_O(o)= NULL;
 }
 
-/*:1079*//*1085:*/
-#line 12498 "./marpa.w"
+/*:1261*//*1267:*/
+#line 16053 "./marpa.w"
 
 o->t_ref_count= 1;
 
-/*:1085*//*1098:*/
-#line 12666 "./marpa.w"
+/*:1267*//*1280:*/
+#line 16222 "./marpa.w"
 
 High_Rank_Count_of_O(o)= 1;
-/*:1098*/
-#line 12490 "./marpa.w"
+/*:1280*/
+#line 16045 "./marpa.w"
 
 O_is_Nulling(o)= B_is_Nulling(b);
 Ambiguity_Metric_of_O(o)= -1;
 return o;
 }
 
-/*:1082*//*1086:*/
-#line 12502 "./marpa.w"
+/*:1264*//*1268:*/
+#line 16057 "./marpa.w"
 
 PRIVATE void
 order_unref(ORDER o)
@@ -17547,8 +21773,8 @@ marpa_o_unref(Marpa_Order o)
 order_unref(o);
 }
 
-/*:1086*//*1087:*/
-#line 12520 "./marpa.w"
+/*:1268*//*1269:*/
+#line 16075 "./marpa.w"
 
 PRIVATE ORDER
 order_ref(ORDER o)
@@ -17563,66 +21789,66 @@ marpa_o_ref(Marpa_Order o)
 return order_ref(o);
 }
 
-/*:1087*//*1088:*/
-#line 12534 "./marpa.w"
+/*:1269*//*1270:*/
+#line 16089 "./marpa.w"
 
 PRIVATE void order_free(ORDER o)
 {
-/*1089:*/
-#line 12543 "./marpa.w"
+/*1271:*/
+#line 16099 "./marpa.w"
 
 const BOCAGE b= B_of_O(o);
-/*1044:*/
-#line 12138 "./marpa.w"
+/*1226:*/
+#line 15682 "./marpa.w"
 
 const GRAMMAR g UNUSED= G_of_B(b);
 
-/*:1044*/
-#line 12545 "./marpa.w"
+/*:1226*/
+#line 16101 "./marpa.w"
 
 
-/*:1089*/
-#line 12537 "./marpa.w"
+/*:1271*/
+#line 16092 "./marpa.w"
 
+struct marpa_allocator_s allocator= *Allocator_of_G(g);
 bocage_unref(b);
 marpa_obs_free(OBS_of_O(o));
-my_free(o);
+marpa__a_free(&allocator,o);
 }
 
-/*:1088*//*1092:*/
-#line 12555 "./marpa.w"
+/*:1270*//*1274:*/
+#line 16111 "./marpa.w"
 
 int marpa_o_ambiguity_metric(Marpa_Order o)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 16114 "./marpa.w"
 
-/*:1313*/
-#line 12558 "./marpa.w"
-
-/*1089:*/
-#line 12543 "./marpa.w"
+/*1271:*/
+#line 16099 "./marpa.w"
 
 const BOCAGE b= B_of_O(o);
-/*1044:*/
-#line 12138 "./marpa.w"
+/*1226:*/
+#line 15682 "./marpa.w"
 
 const GRAMMAR g UNUSED= G_of_B(b);
 
-/*:1044*/
-#line 12545 "./marpa.w"
+/*:1226*/
+#line 16101 "./marpa.w"
 
 
-/*:1089*/
-#line 12559 "./marpa.w"
+/*:1271*/
+#line 16115 "./marpa.w"
 
 const int old_ambiguity_metric_of_o
 = Ambiguity_Metric_of_O(o);
 const int ambiguity_metric_of_b
 = (Ambiguity_Metric_of_B(b)<=1?1:2);
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -17633,8 +21859,8 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 12564 "./marpa.w"
+/*:1521*/
+#line 16120 "./marpa.w"
 
 O_is_Frozen(o)= 1;
 if(old_ambiguity_metric_of_o>=0)
@@ -17646,8 +21872,8 @@ if(ambiguity_metric_of_b<2
 Ambiguity_Metric_of_O(o)= ambiguity_metric_of_b;
 return ambiguity_metric_of_b;
 }
-/*1093:*/
-#line 12583 "./marpa.w"
+/*1275:*/
+#line 16139 "./marpa.w"
 
 {
 ANDID**const and_node_orderings= o->t_and_node_orderings;
@@ -17660,8 +21886,8 @@ Bit_Vector bv_orid_was_stacked;
 Ambiguity_Metric_of_O(o)= 1;
 
 
-bv_orid_was_stacked= bv_create(or_count);
-FSTACK_INIT(or_node_stack,ORID,or_count);
+bv_orid_was_stacked= bv_create(Allocator_of_G(g),or_count);
+FSTACK_INIT(or_node_stack,ORID,or_count,Allocator_of_G(g));
 *(FSTACK_PUSH(or_node_stack))= root_or_id;
 bv_bit_set(bv_orid_was_stacked,root_or_id);
 while((top_of_stack= FSTACK_POP(or_node_stack)))
@@ -17705,46 +21931,45 @@ if(!bv_bit_test_then_set(bv_orid_was_stacked,cause_or_id))
 }
 END_OR_NODE_LOOP:;
 FSTACK_DESTROY(or_node_stack);
-bv_free(bv_orid_was_stacked);
+bv_free(Allocator_of_G(g),bv_orid_was_stacked);
 
 }
 
-/*:1093*/
-#line 12575 "./marpa.w"
+/*:1275*/
+#line 16131 "./marpa.w"
 
 return Ambiguity_Metric_of_O(o);
 }
 
-/*:1092*//*1096:*/
-#line 12649 "./marpa.w"
+/*:1274*//*1278:*/
+#line 16205 "./marpa.w"
 
 int marpa_o_is_null(Marpa_Order o)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 16208 "./marpa.w"
 
-/*:1313*/
-#line 12652 "./marpa.w"
-
-/*1089:*/
-#line 12543 "./marpa.w"
+/*1271:*/
+#line 16099 "./marpa.w"
 
 const BOCAGE b= B_of_O(o);
-/*1044:*/
-#line 12138 "./marpa.w"
+/*1226:*/
+#line 15682 "./marpa.w"
 
 const GRAMMAR g UNUSED= G_of_B(b);
 
-/*:1044*/
-#line 12545 "./marpa.w"
+/*:1226*/
+#line 16101 "./marpa.w"
 
 
-/*:1089*/
-#line 12653 "./marpa.w"
+/*:1271*/
+#line 16209 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -17755,44 +21980,43 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 12654 "./marpa.w"
+/*:1521*/
+#line 16210 "./marpa.w"
 
 return O_is_Nulling(o);
 }
 
-/*:1096*//*1099:*/
-#line 12668 "./marpa.w"
+/*:1278*//*1281:*/
+#line 16224 "./marpa.w"
 
 int marpa_o_high_rank_only_set(
 Marpa_Order o,
 int count)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 16229 "./marpa.w"
 
-/*:1313*/
-#line 12673 "./marpa.w"
-
-/*1089:*/
-#line 12543 "./marpa.w"
+/*1271:*/
+#line 16099 "./marpa.w"
 
 const BOCAGE b= B_of_O(o);
-/*1044:*/
-#line 12138 "./marpa.w"
+/*1226:*/
+#line 15682 "./marpa.w"
 
 const GRAMMAR g UNUSED= G_of_B(b);
 
-/*:1044*/
-#line 12545 "./marpa.w"
+/*:1226*/
+#line 16101 "./marpa.w"
 
 
-/*:1089*/
-#line 12674 "./marpa.w"
+/*:1271*/
+#line 16230 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -17803,8 +22027,8 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 12675 "./marpa.w"
+/*:1521*/
+#line 16231 "./marpa.w"
 
 if(O_is_Frozen(o))
 {
@@ -17819,36 +22043,35 @@ return failure_indicator;
 return High_Rank_Count_of_O(o)= count;
 }
 
-/*:1099*//*1100:*/
-#line 12690 "./marpa.w"
+/*:1281*//*1282:*/
+#line 16246 "./marpa.w"
 
 int marpa_o_high_rank_only(Marpa_Order o)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 16249 "./marpa.w"
 
-/*:1313*/
-#line 12693 "./marpa.w"
-
-/*1089:*/
-#line 12543 "./marpa.w"
+/*1271:*/
+#line 16099 "./marpa.w"
 
 const BOCAGE b= B_of_O(o);
-/*1044:*/
-#line 12138 "./marpa.w"
+/*1226:*/
+#line 15682 "./marpa.w"
 
 const GRAMMAR g UNUSED= G_of_B(b);
 
-/*:1044*/
-#line 12545 "./marpa.w"
+/*:1226*/
+#line 16101 "./marpa.w"
 
 
-/*:1089*/
-#line 12694 "./marpa.w"
+/*:1271*/
+#line 16250 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -17859,45 +22082,44 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 12695 "./marpa.w"
+/*:1521*/
+#line 16251 "./marpa.w"
 
 return High_Rank_Count_of_O(o);
 }
 
-/*:1100*//*1104:*/
-#line 12732 "./marpa.w"
+/*:1282*//*1286:*/
+#line 16288 "./marpa.w"
 
 int marpa_o_rank(Marpa_Order o)
 {
 ANDID**and_node_orderings;
 struct marpa_obstack*obs;
 int bocage_was_reordered= 0;
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 16294 "./marpa.w"
 
-/*:1313*/
-#line 12738 "./marpa.w"
-
-/*1089:*/
-#line 12543 "./marpa.w"
+/*1271:*/
+#line 16099 "./marpa.w"
 
 const BOCAGE b= B_of_O(o);
-/*1044:*/
-#line 12138 "./marpa.w"
+/*1226:*/
+#line 15682 "./marpa.w"
 
 const GRAMMAR g UNUSED= G_of_B(b);
 
-/*:1044*/
-#line 12545 "./marpa.w"
+/*:1226*/
+#line 16101 "./marpa.w"
 
 
-/*:1089*/
-#line 12739 "./marpa.w"
+/*:1271*/
+#line 16295 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -17908,21 +22130,21 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 12740 "./marpa.w"
+/*:1521*/
+#line 16296 "./marpa.w"
 
 if(O_is_Frozen(o))
 {
 MARPA_ERROR(MARPA_ERR_ORDER_FROZEN);
 return failure_indicator;
 }
-/*1110:*/
-#line 12901 "./marpa.w"
+/*1292:*/
+#line 16457 "./marpa.w"
 
 {
 int and_id;
 const int and_count_of_r= AND_Count_of_B(b);
-obs= OBS_of_O(o)= marpa_obs_init;
+obs= OBS_of_O(o)= marpa_obs_cache_init(Chunk_Cache_of_G(g));
 o->t_and_node_orderings= 
 and_node_orderings= 
 marpa_obs_new(obs,ANDID*,and_count_of_r);
@@ -17932,12 +22154,12 @@ and_node_orderings[and_id]= (ANDID*)NULL;
 }
 }
 
-/*:1110*/
-#line 12746 "./marpa.w"
+/*:1292*/
+#line 16302 "./marpa.w"
 
 if(High_Rank_Count_of_O(o)){
-/*1105:*/
-#line 12761 "./marpa.w"
+/*1287:*/
+#line 16317 "./marpa.w"
 
 {
 const AND and_nodes= ANDs_of_B(b);
@@ -17948,8 +22170,8 @@ while(or_node_id<or_node_count_of_b)
 {
 const OR work_or_node= OR_of_B_by_ID(b,or_node_id);
 const ANDID and_count_of_or= AND_Count_of_OR(work_or_node);
-/*1106:*/
-#line 12776 "./marpa.w"
+/*1288:*/
+#line 16332 "./marpa.w"
 
 {
 if(and_count_of_or> 1)
@@ -17970,8 +22192,8 @@ and_node_id++)
 {
 const AND and_node= and_nodes+and_node_id;
 int and_node_rank;
-/*1107:*/
-#line 12814 "./marpa.w"
+/*1289:*/
+#line 16370 "./marpa.w"
 
 {
 const OR cause_or= Cause_OR_of_AND(and_node);
@@ -17983,8 +22205,8 @@ and_node_rank= Rank_of_IRL(IRL_of_OR(cause_or));
 }
 }
 
-/*:1107*/
-#line 12796 "./marpa.w"
+/*:1289*/
+#line 16352 "./marpa.w"
 
 if(and_node_rank> high_rank_so_far)
 {
@@ -18003,33 +22225,33 @@ and_node_orderings[or_node_id]= marpa_obs_finish(obs);
 }
 }
 
-/*:1106*/
-#line 12771 "./marpa.w"
+/*:1288*/
+#line 16327 "./marpa.w"
 
 or_node_id++;
 }
 }
 
-/*:1105*/
-#line 12748 "./marpa.w"
+/*:1287*/
+#line 16304 "./marpa.w"
 
 }else{
-/*1108:*/
-#line 12825 "./marpa.w"
+/*1290:*/
+#line 16381 "./marpa.w"
 
 {
 const AND and_nodes= ANDs_of_B(b);
 const int or_node_count_of_b= OR_Count_of_B(b);
 const int and_node_count_of_b= AND_Count_of_B(b);
 int or_node_id= 0;
-int*rank_by_and_id= marpa_new(int,and_node_count_of_b);
+int*rank_by_and_id= marpa_a_new(Allocator_of_G(g),int,and_node_count_of_b);
 int and_node_id;
 for(and_node_id= 0;and_node_id<and_node_count_of_b;and_node_id++)
 {
 const AND and_node= and_nodes+and_node_id;
 int and_node_rank;
-/*1107:*/
-#line 12814 "./marpa.w"
+/*1289:*/
+#line 16370 "./marpa.w"
 
 {
 const OR cause_or= Cause_OR_of_AND(and_node);
@@ -18041,8 +22263,8 @@ and_node_rank= Rank_of_IRL(IRL_of_OR(cause_or));
 }
 }
 
-/*:1107*/
-#line 12837 "./marpa.w"
+/*:1289*/
+#line 16393 "./marpa.w"
 
 rank_by_and_id[and_node_id]= and_node_rank;
 }
@@ -18050,8 +22272,8 @@ while(or_node_id<or_node_count_of_b)
 {
 const OR work_or_node= OR_of_B_by_ID(b,or_node_id);
 const ANDID and_count_of_or= AND_Count_of_OR(work_or_node);
-/*1109:*/
-#line 12870 "./marpa.w"
+/*1291:*/
+#line 16426 "./marpa.w"
 
 {
 if(and_count_of_or> 1)
@@ -18083,16 +22305,16 @@ order[pre_insertion_ix+1]= new_and_node_id;
 }
 }
 
-/*:1109*/
-#line 12844 "./marpa.w"
+/*:1291*/
+#line 16400 "./marpa.w"
 
 or_node_id++;
 }
-my_free(rank_by_and_id);
+marpa__a_free(Allocator_of_G(g),rank_by_and_id);
 }
 
-/*:1108*/
-#line 12750 "./marpa.w"
+/*:1290*/
+#line 16306 "./marpa.w"
 
 }
 if(!bocage_was_reordered){
@@ -18104,8 +22326,8 @@ O_is_Frozen(o)= 1;
 return 1;
 }
 
-/*:1104*//*1111:*/
-#line 12918 "./marpa.w"
+/*:1286*//*1293:*/
+#line 16474 "./marpa.w"
 
 PRIVATE ANDID and_order_ix_is_valid(ORDER o,OR or_node,int ix)
 {
@@ -18124,8 +22346,8 @@ if(ix>=length)return 0;
 return 1;
 }
 
-/*:1111*//*1112:*/
-#line 12939 "./marpa.w"
+/*:1293*//*1294:*/
+#line 16495 "./marpa.w"
 
 PRIVATE ANDID and_order_get(ORDER o,OR or_node,int ix)
 {
@@ -18140,38 +22362,37 @@ return ordering[1+ix];
 return First_ANDID_of_OR(or_node)+ix;
 }
 
-/*:1112*//*1113:*/
-#line 12953 "./marpa.w"
+/*:1294*//*1295:*/
+#line 16509 "./marpa.w"
 
 Marpa_And_Node_ID _marpa_o_and_order_get(Marpa_Order o,
 Marpa_Or_Node_ID or_node_id,int ix)
 {
 OR or_node;
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 16514 "./marpa.w"
 
-/*:1313*/
-#line 12958 "./marpa.w"
-
-/*1089:*/
-#line 12543 "./marpa.w"
+/*1271:*/
+#line 16099 "./marpa.w"
 
 const BOCAGE b= B_of_O(o);
-/*1044:*/
-#line 12138 "./marpa.w"
+/*1226:*/
+#line 15682 "./marpa.w"
 
 const GRAMMAR g UNUSED= G_of_B(b);
 
-/*:1044*/
-#line 12545 "./marpa.w"
+/*:1226*/
+#line 16101 "./marpa.w"
 
 
-/*:1089*/
-#line 12959 "./marpa.w"
+/*:1271*/
+#line 16515 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -18182,11 +22403,11 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 12960 "./marpa.w"
+/*:1521*/
+#line 16516 "./marpa.w"
 
-/*1400:*/
-#line 16732 "./marpa.w"
+/*1602:*/
+#line 20739 "./marpa.w"
 
 {
 if(_MARPA_UNLIKELY(or_node_id>=OR_Count_of_B(b)))
@@ -18199,11 +22420,11 @@ MARPA_ERROR(MARPA_ERR_ORID_NEGATIVE);
 return failure_indicator;
 }
 }
-/*:1400*/
-#line 12961 "./marpa.w"
+/*:1602*/
+#line 16517 "./marpa.w"
 
-/*1401:*/
-#line 16744 "./marpa.w"
+/*1603:*/
+#line 20751 "./marpa.w"
 
 {
 if(_MARPA_UNLIKELY(!ORs_of_B(b)))
@@ -18214,8 +22435,8 @@ return failure_indicator;
 or_node= OR_of_B_by_ID(b,or_node_id);
 }
 
-/*:1401*/
-#line 12962 "./marpa.w"
+/*:1603*/
+#line 16518 "./marpa.w"
 
 if(ix<0){
 MARPA_ERROR(MARPA_ERR_ANDIX_NEGATIVE);
@@ -18225,8 +22446,8 @@ if(!and_order_ix_is_valid(o,or_node,ix))return-1;
 return and_order_get(o,or_node,ix);
 }
 
-/*:1113*//*1118:*/
-#line 13015 "./marpa.w"
+/*:1295*//*1300:*/
+#line 16571 "./marpa.w"
 
 PRIVATE void tree_exhaust(TREE t)
 {
@@ -18240,41 +22461,41 @@ if(FSTACK_IS_INITIALIZED(t->t_nook_worklist))
 FSTACK_DESTROY(t->t_nook_worklist);
 FSTACK_SAFE(t->t_nook_worklist);
 }
-bv_free(t->t_or_node_in_use);
+bv_free(Allocator_of_G(G_of_B(B_of_O(O_of_T(t)))),t->t_or_node_in_use);
 t->t_or_node_in_use= NULL;
 T_is_Exhausted(t)= 1;
 }
 
-/*:1118*//*1119:*/
-#line 13033 "./marpa.w"
+/*:1300*//*1301:*/
+#line 16589 "./marpa.w"
 
 Marpa_Tree marpa_t_new(Marpa_Order o)
 {
-/*1312:*/
-#line 15626 "./marpa.w"
+/*1499:*/
+#line 19377 "./marpa.w"
 void*const failure_indicator= NULL;
-/*:1312*/
-#line 13036 "./marpa.w"
+/*:1499*/
+#line 16592 "./marpa.w"
 
 TREE t;
-/*1089:*/
-#line 12543 "./marpa.w"
+/*1271:*/
+#line 16099 "./marpa.w"
 
 const BOCAGE b= B_of_O(o);
-/*1044:*/
-#line 12138 "./marpa.w"
+/*1226:*/
+#line 15682 "./marpa.w"
 
 const GRAMMAR g UNUSED= G_of_B(b);
 
-/*:1044*/
-#line 12545 "./marpa.w"
+/*:1226*/
+#line 16101 "./marpa.w"
 
 
-/*:1089*/
-#line 13038 "./marpa.w"
+/*:1271*/
+#line 16594 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -18285,23 +22506,23 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 13039 "./marpa.w"
+/*:1521*/
+#line 16595 "./marpa.w"
 
-t= my_malloc(sizeof(*t));
+t= marpa__a_malloc(Allocator_of_G(g),sizeof(*t));
 O_of_T(t)= o;
 order_ref(o);
 O_is_Frozen(o)= 1;
-/*1132:*/
-#line 13186 "./marpa.w"
+/*1314:*/
+#line 16744 "./marpa.w"
 
 T_is_Exhausted(t)= 0;
 
-/*:1132*/
-#line 13044 "./marpa.w"
+/*:1314*/
+#line 16600 "./marpa.w"
 
-/*1120:*/
-#line 13049 "./marpa.w"
+/*1302:*/
+#line 16605 "./marpa.w"
 
 {
 t->t_parse_count= 0;
@@ -18317,29 +22538,29 @@ else
 const int and_count= AND_Count_of_B(b);
 const int or_count= OR_Count_of_B(b);
 T_is_Nulling(t)= 0;
-t->t_or_node_in_use= bv_create(or_count);
-FSTACK_INIT(t->t_nook_stack,NOOK_Object,and_count);
-FSTACK_INIT(t->t_nook_worklist,int,and_count);
+t->t_or_node_in_use= bv_create(Allocator_of_G(g),or_count);
+FSTACK_INIT(t->t_nook_stack,NOOK_Object,and_count,Allocator_of_G(g));
+FSTACK_INIT(t->t_nook_worklist,int,and_count,Allocator_of_G(g));
 }
 }
 
-/*:1120*//*1123:*/
-#line 13073 "./marpa.w"
+/*:1302*//*1305:*/
+#line 16629 "./marpa.w"
 
 t->t_ref_count= 1;
 
-/*:1123*//*1128:*/
-#line 13125 "./marpa.w"
+/*:1305*//*1310:*/
+#line 16683 "./marpa.w"
 t->t_generation= 0;
 
-/*:1128*/
-#line 13045 "./marpa.w"
+/*:1310*/
+#line 16601 "./marpa.w"
 
 return t;
 }
 
-/*:1119*//*1124:*/
-#line 13077 "./marpa.w"
+/*:1301*//*1306:*/
+#line 16633 "./marpa.w"
 
 PRIVATE void
 tree_unref(TREE t)
@@ -18357,8 +22578,8 @@ marpa_t_unref(Marpa_Tree t)
 tree_unref(t);
 }
 
-/*:1124*//*1125:*/
-#line 13095 "./marpa.w"
+/*:1306*//*1307:*/
+#line 16651 "./marpa.w"
 
 PRIVATE TREE
 tree_ref(TREE t)
@@ -18373,56 +22594,57 @@ marpa_t_ref(Marpa_Tree t)
 return tree_ref(t);
 }
 
-/*:1125*//*1126:*/
-#line 13109 "./marpa.w"
+/*:1307*//*1308:*/
+#line 16665 "./marpa.w"
 
 PRIVATE void tree_free(TREE t)
 {
-order_unref(O_of_T(t));
+struct marpa_allocator_s allocator= 
+*Allocator_of_G(G_of_B(B_of_O(O_of_T(t))));
 tree_exhaust(t);
-my_free(t);
+order_unref(O_of_T(t));
+marpa__a_free(&allocator,t);
 }
 
-/*:1126*//*1129:*/
-#line 13128 "./marpa.w"
+/*:1308*//*1311:*/
+#line 16686 "./marpa.w"
 
 int marpa_t_next(Marpa_Tree t)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
-
-/*:1313*/
-#line 13131 "./marpa.w"
+/*:1500*/
+#line 16689 "./marpa.w"
 
 const int termination_indicator= -1;
 int is_first_tree_attempt= (t->t_parse_count<1);
-/*1117:*/
-#line 13011 "./marpa.w"
+/*1299:*/
+#line 16567 "./marpa.w"
 
 ORDER o= O_of_T(t);
-/*1089:*/
-#line 12543 "./marpa.w"
+/*1271:*/
+#line 16099 "./marpa.w"
 
 const BOCAGE b= B_of_O(o);
-/*1044:*/
-#line 12138 "./marpa.w"
+/*1226:*/
+#line 15682 "./marpa.w"
 
 const GRAMMAR g UNUSED= G_of_B(b);
 
-/*:1044*/
-#line 12545 "./marpa.w"
+/*:1226*/
+#line 16101 "./marpa.w"
 
 
-/*:1089*/
-#line 13013 "./marpa.w"
+/*:1271*/
+#line 16569 "./marpa.w"
 ;
 
-/*:1117*/
-#line 13134 "./marpa.w"
+/*:1299*/
+#line 16692 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -18433,8 +22655,8 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 13135 "./marpa.w"
+/*:1521*/
+#line 16693 "./marpa.w"
 
 {
 const unsigned int next_generation= T_Generation(t)+1;
@@ -18465,8 +22687,8 @@ while(1){
 const AND ands_of_b= ANDs_of_B(b);
 if(is_first_tree_attempt){
 is_first_tree_attempt= 0;
-/*1138:*/
-#line 13215 "./marpa.w"
+/*1320:*/
+#line 16773 "./marpa.w"
 
 {
 ORID root_or_id= Top_ORID_of_B(b);
@@ -18489,12 +22711,12 @@ NOOK_Predecessor_is_Expanded(nook)= 0;
 NOOK_is_Predecessor(nook)= 0;
 }
 
-/*:1138*/
-#line 13165 "./marpa.w"
+/*:1320*/
+#line 16723 "./marpa.w"
 
 }else{
-/*1139:*/
-#line 13240 "./marpa.w"
+/*1321:*/
+#line 16798 "./marpa.w"
 {
 while(1){
 OR iteration_candidate_or_node;
@@ -18537,12 +22759,12 @@ FSTACK_POP(t->t_nook_stack);
 if(Size_of_T(t)<=0)goto TREE_IS_EXHAUSTED;
 }
 
-/*:1139*/
-#line 13167 "./marpa.w"
+/*:1321*/
+#line 16725 "./marpa.w"
 
 }
-/*1140:*/
-#line 13282 "./marpa.w"
+/*1322:*/
+#line 16840 "./marpa.w"
 {
 {
 const int stack_length= Size_of_T(t);
@@ -18600,8 +22822,8 @@ while(0);
 if(!tree_or_node_try(t,ID_of_OR(child_or_node)))goto NEXT_TREE;
 choice= 0;
 if(!and_order_ix_is_valid(o,child_or_node,choice))goto NEXT_TREE;
-/*1141:*/
-#line 13345 "./marpa.w"
+/*1323:*/
+#line 16903 "./marpa.w"
 
 {
 NOOKID new_nook_id= Size_of_T(t);
@@ -18622,16 +22844,16 @@ NOOK_Predecessor_is_Expanded(work_nook)= 1;
 }
 }
 
-/*:1141*/
-#line 13339 "./marpa.w"
+/*:1323*/
+#line 16897 "./marpa.w"
 ;
 NEXT_NOOK_ON_WORKLIST:;
 }
 NEXT_TREE:;
 }
 
-/*:1140*/
-#line 13169 "./marpa.w"
+/*:1322*/
+#line 16727 "./marpa.w"
 
 }
 TREE_IS_FINISHED:;
@@ -18644,67 +22866,66 @@ return termination_indicator;
 
 }
 
-/*:1129*//*1136:*/
-#line 13202 "./marpa.w"
+/*:1311*//*1318:*/
+#line 16760 "./marpa.w"
 
 PRIVATE int tree_or_node_try(TREE tree,ORID or_node_id)
 {
 return!bv_bit_test_then_set(tree->t_or_node_in_use,or_node_id);
 }
-/*:1136*//*1137:*/
-#line 13208 "./marpa.w"
+/*:1318*//*1319:*/
+#line 16766 "./marpa.w"
 
 PRIVATE void tree_or_node_release(TREE tree,ORID or_node_id)
 {
 bv_bit_clear(tree->t_or_node_in_use,or_node_id);
 }
 
-/*:1137*//*1142:*/
-#line 13366 "./marpa.w"
+/*:1319*//*1324:*/
+#line 16924 "./marpa.w"
 
 int marpa_t_parse_count(Marpa_Tree t)
 {
 return t->t_parse_count;
 }
 
-/*:1142*//*1143:*/
-#line 13374 "./marpa.w"
+/*:1324*//*1325:*/
+#line 16932 "./marpa.w"
 
 int _marpa_t_size(Marpa_Tree t)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 16935 "./marpa.w"
 
-/*:1313*/
-#line 13377 "./marpa.w"
-
-/*1117:*/
-#line 13011 "./marpa.w"
+/*1299:*/
+#line 16567 "./marpa.w"
 
 ORDER o= O_of_T(t);
-/*1089:*/
-#line 12543 "./marpa.w"
+/*1271:*/
+#line 16099 "./marpa.w"
 
 const BOCAGE b= B_of_O(o);
-/*1044:*/
-#line 12138 "./marpa.w"
+/*1226:*/
+#line 15682 "./marpa.w"
 
 const GRAMMAR g UNUSED= G_of_B(b);
 
-/*:1044*/
-#line 12545 "./marpa.w"
+/*:1226*/
+#line 16101 "./marpa.w"
 
 
-/*:1089*/
-#line 13013 "./marpa.w"
+/*:1271*/
+#line 16569 "./marpa.w"
 ;
 
-/*:1117*/
-#line 13378 "./marpa.w"
+/*:1299*/
+#line 16936 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -18715,8 +22936,8 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 13379 "./marpa.w"
+/*:1521*/
+#line 16937 "./marpa.w"
 
 if(T_is_Exhausted(t)){
 MARPA_ERROR(MARPA_ERR_TREE_EXHAUSTED);
@@ -18726,43 +22947,43 @@ if(T_is_Nulling(t))return 0;
 return Size_of_T(t);
 }
 
-/*:1143*//*1164:*/
-#line 13592 "./marpa.w"
+/*:1325*//*1346:*/
+#line 17150 "./marpa.w"
 
 Marpa_Value marpa_v_new(Marpa_Tree t)
 {
-/*1312:*/
-#line 15626 "./marpa.w"
+/*1499:*/
+#line 19377 "./marpa.w"
 void*const failure_indicator= NULL;
-/*:1312*/
-#line 13595 "./marpa.w"
+/*:1499*/
+#line 17153 "./marpa.w"
 
-/*1117:*/
-#line 13011 "./marpa.w"
+/*1299:*/
+#line 16567 "./marpa.w"
 
 ORDER o= O_of_T(t);
-/*1089:*/
-#line 12543 "./marpa.w"
+/*1271:*/
+#line 16099 "./marpa.w"
 
 const BOCAGE b= B_of_O(o);
-/*1044:*/
-#line 12138 "./marpa.w"
+/*1226:*/
+#line 15682 "./marpa.w"
 
 const GRAMMAR g UNUSED= G_of_B(b);
 
-/*:1044*/
-#line 12545 "./marpa.w"
+/*:1226*/
+#line 16101 "./marpa.w"
 
 
-/*:1089*/
-#line 13013 "./marpa.w"
+/*:1271*/
+#line 16569 "./marpa.w"
 ;
 
-/*:1117*/
-#line 13596 "./marpa.w"
+/*:1299*/
+#line 17154 "./marpa.w"
 ;
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -18773,8 +22994,8 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 13597 "./marpa.w"
+/*:1521*/
+#line 17155 "./marpa.w"
 
 if(t->t_parse_count<=0){
 MARPA_ERROR(MARPA_ERR_BEFORE_FIRST_TREE);
@@ -18783,13 +23004,14 @@ return NULL;
 if(!T_is_Exhausted(t))
 {
 const XSYID xsy_count= XSY_Count_of_G(g);
-struct marpa_obstack*const obstack= marpa_obs_init;
+struct marpa_obstack*const obstack= 
+marpa_obs_cache_init(Chunk_Cache_of_G(g));
 const VALUE v= marpa_obs_new(obstack,struct s_value,1);
 v->t_obs= obstack;
 Step_Type_of_V(v)= Next_Value_Type_of_V(v)= MARPA_STEP_INITIAL;
 V_T_Generation(v)= T_Generation(t);
-/*1155:*/
-#line 13518 "./marpa.w"
+/*1337:*/
+#line 17076 "./marpa.w"
 
 XSYID_of_V(v)= -1;
 RULEID_of_V(v)= -1;
@@ -18802,30 +23024,30 @@ Rule_Start_of_V(v)= -1;
 Token_Start_of_V(v)= -1;
 YS_ID_of_V(v)= -1;
 
-/*:1155*//*1162:*/
-#line 13581 "./marpa.w"
+/*:1337*//*1344:*/
+#line 17139 "./marpa.w"
 
 MARPA_DSTACK_SAFE(VStack_of_V(v));
-/*:1162*//*1167:*/
-#line 13629 "./marpa.w"
+/*:1344*//*1349:*/
+#line 17188 "./marpa.w"
 
 v->t_ref_count= 1;
 
-/*:1167*//*1177:*/
-#line 13700 "./marpa.w"
+/*:1349*//*1359:*/
+#line 17259 "./marpa.w"
 
 V_is_Nulling(v)= 0;
 
-/*:1177*//*1179:*/
-#line 13707 "./marpa.w"
+/*:1359*//*1361:*/
+#line 17266 "./marpa.w"
 
 V_is_Trace(v)= 0;
-/*:1179*//*1182:*/
-#line 13729 "./marpa.w"
+/*:1361*//*1364:*/
+#line 17288 "./marpa.w"
 
 NOOK_of_V(v)= -1;
-/*:1182*//*1187:*/
-#line 13757 "./marpa.w"
+/*:1364*//*1369:*/
+#line 17316 "./marpa.w"
 
 {
 XSY_is_Valued_BV_of_V(v)= lbv_clone(v->t_obs,Valued_BV_of_B(b),xsy_count);
@@ -18834,8 +23056,8 @@ lbv_clone(v->t_obs,Valued_Locked_BV_of_B(b),xsy_count);
 }
 
 
-/*:1187*/
-#line 13610 "./marpa.w"
+/*:1369*/
+#line 17169 "./marpa.w"
 
 T_of_V(v)= t;
 if(T_is_Nulling(o)){
@@ -18844,7 +23066,7 @@ V_is_Nulling(v)= 1;
 const int minimum_stack_size= (8192/sizeof(int));
 const int initial_stack_size= 
 MAX(Size_of_TREE(t)/1024,minimum_stack_size);
-MARPA_DSTACK_INIT(VStack_of_V(v),int,initial_stack_size);
+MARPA_DSTACK_INIT(VStack_of_V(v),int,initial_stack_size,Allocator_of_G(g));
 }
 return(Marpa_Value)v;
 }
@@ -18852,8 +23074,8 @@ MARPA_ERROR(MARPA_ERR_TREE_EXHAUSTED);
 return NULL;
 }
 
-/*:1164*//*1168:*/
-#line 13633 "./marpa.w"
+/*:1346*//*1350:*/
+#line 17192 "./marpa.w"
 
 PRIVATE void
 value_unref(VALUE v)
@@ -18871,8 +23093,8 @@ marpa_v_unref(Marpa_Value public_v)
 value_unref((VALUE)public_v);
 }
 
-/*:1168*//*1169:*/
-#line 13651 "./marpa.w"
+/*:1350*//*1351:*/
+#line 17210 "./marpa.w"
 
 PRIVATE VALUE
 value_ref(VALUE v)
@@ -18884,47 +23106,47 @@ return v;
 Marpa_Value
 marpa_v_ref(Marpa_Value public_v)
 {
-/*1312:*/
-#line 15626 "./marpa.w"
+/*1499:*/
+#line 19377 "./marpa.w"
 void*const failure_indicator= NULL;
-/*:1312*/
-#line 13662 "./marpa.w"
+/*:1499*/
+#line 17221 "./marpa.w"
 
 const VALUE v= (VALUE)public_v;
-/*1171:*/
-#line 13677 "./marpa.w"
+/*1353:*/
+#line 17236 "./marpa.w"
 
 TREE t= T_of_V(v);
-/*1117:*/
-#line 13011 "./marpa.w"
+/*1299:*/
+#line 16567 "./marpa.w"
 
 ORDER o= O_of_T(t);
-/*1089:*/
-#line 12543 "./marpa.w"
+/*1271:*/
+#line 16099 "./marpa.w"
 
 const BOCAGE b= B_of_O(o);
-/*1044:*/
-#line 12138 "./marpa.w"
+/*1226:*/
+#line 15682 "./marpa.w"
 
 const GRAMMAR g UNUSED= G_of_B(b);
 
-/*:1044*/
-#line 12545 "./marpa.w"
+/*:1226*/
+#line 16101 "./marpa.w"
 
 
-/*:1089*/
-#line 13013 "./marpa.w"
+/*:1271*/
+#line 16569 "./marpa.w"
 ;
 
-/*:1117*/
-#line 13679 "./marpa.w"
+/*:1299*/
+#line 17238 "./marpa.w"
 
 
-/*:1171*/
-#line 13664 "./marpa.w"
+/*:1353*/
+#line 17223 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -18935,30 +23157,30 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 13665 "./marpa.w"
+/*:1521*/
+#line 17224 "./marpa.w"
 
-/*1174:*/
-#line 13689 "./marpa.w"
+/*1356:*/
+#line 17248 "./marpa.w"
 
 if(_MARPA_UNLIKELY(V_T_Generation(v)!=T_Generation(t))){
 MARPA_ERROR(MARPA_ERR_BASE_GENERATION_MISMATCH);
 return failure_indicator;
 }
 
-/*:1174*/
-#line 13666 "./marpa.w"
+/*:1356*/
+#line 17225 "./marpa.w"
 
 return(Marpa_Value)value_ref(v);
 }
 
-/*:1169*//*1170:*/
-#line 13670 "./marpa.w"
+/*:1351*//*1352:*/
+#line 17229 "./marpa.w"
 
 PRIVATE void value_free(VALUE v)
 {
-/*1163:*/
-#line 13583 "./marpa.w"
+/*1345:*/
+#line 17141 "./marpa.w"
 
 {
 if(_MARPA_LIKELY(MARPA_DSTACK_IS_INITIALIZED(VStack_of_V(v))!=NULL))
@@ -18967,66 +23189,65 @@ MARPA_DSTACK_DESTROY(VStack_of_V(v));
 }
 }
 
-/*:1163*/
-#line 13673 "./marpa.w"
+/*:1345*/
+#line 17232 "./marpa.w"
 
-/*1157:*/
-#line 13534 "./marpa.w"
+/*1339:*/
+#line 17092 "./marpa.w"
 
 marpa_obs_free(v->t_obs);
 
-/*:1157*/
-#line 13674 "./marpa.w"
+/*:1339*/
+#line 17233 "./marpa.w"
 
 }
 
-/*:1170*//*1180:*/
-#line 13709 "./marpa.w"
+/*:1352*//*1362:*/
+#line 17268 "./marpa.w"
 
 int _marpa_v_trace(Marpa_Value public_v,int flag)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
-
-/*:1313*/
-#line 13712 "./marpa.w"
+/*:1500*/
+#line 17271 "./marpa.w"
 
 const VALUE v= (VALUE)public_v;
-/*1171:*/
-#line 13677 "./marpa.w"
+/*1353:*/
+#line 17236 "./marpa.w"
 
 TREE t= T_of_V(v);
-/*1117:*/
-#line 13011 "./marpa.w"
+/*1299:*/
+#line 16567 "./marpa.w"
 
 ORDER o= O_of_T(t);
-/*1089:*/
-#line 12543 "./marpa.w"
+/*1271:*/
+#line 16099 "./marpa.w"
 
 const BOCAGE b= B_of_O(o);
-/*1044:*/
-#line 12138 "./marpa.w"
+/*1226:*/
+#line 15682 "./marpa.w"
 
 const GRAMMAR g UNUSED= G_of_B(b);
 
-/*:1044*/
-#line 12545 "./marpa.w"
+/*:1226*/
+#line 16101 "./marpa.w"
 
 
-/*:1089*/
-#line 13013 "./marpa.w"
+/*:1271*/
+#line 16569 "./marpa.w"
 ;
 
-/*:1117*/
-#line 13679 "./marpa.w"
+/*:1299*/
+#line 17238 "./marpa.w"
 
 
-/*:1171*/
-#line 13714 "./marpa.w"
+/*:1353*/
+#line 17273 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -19037,19 +23258,19 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 13715 "./marpa.w"
+/*:1521*/
+#line 17274 "./marpa.w"
 
-/*1174:*/
-#line 13689 "./marpa.w"
+/*1356:*/
+#line 17248 "./marpa.w"
 
 if(_MARPA_UNLIKELY(V_T_Generation(v)!=T_Generation(t))){
 MARPA_ERROR(MARPA_ERR_BASE_GENERATION_MISMATCH);
 return failure_indicator;
 }
 
-/*:1174*/
-#line 13716 "./marpa.w"
+/*:1356*/
+#line 17275 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!V_is_Active(v))){
 MARPA_ERROR(MARPA_ERR_VALUATOR_INACTIVE);
@@ -19059,53 +23280,52 @@ V_is_Trace(v)= Boolean(flag);
 return 1;
 }
 
-/*:1180*//*1183:*/
-#line 13732 "./marpa.w"
+/*:1362*//*1365:*/
+#line 17291 "./marpa.w"
 
 Marpa_Nook_ID _marpa_v_nook(Marpa_Value public_v)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
-
-/*:1313*/
-#line 13735 "./marpa.w"
+/*:1500*/
+#line 17294 "./marpa.w"
 
 const VALUE v= (VALUE)public_v;
-/*1171:*/
-#line 13677 "./marpa.w"
+/*1353:*/
+#line 17236 "./marpa.w"
 
 TREE t= T_of_V(v);
-/*1117:*/
-#line 13011 "./marpa.w"
+/*1299:*/
+#line 16567 "./marpa.w"
 
 ORDER o= O_of_T(t);
-/*1089:*/
-#line 12543 "./marpa.w"
+/*1271:*/
+#line 16099 "./marpa.w"
 
 const BOCAGE b= B_of_O(o);
-/*1044:*/
-#line 12138 "./marpa.w"
+/*1226:*/
+#line 15682 "./marpa.w"
 
 const GRAMMAR g UNUSED= G_of_B(b);
 
-/*:1044*/
-#line 12545 "./marpa.w"
+/*:1226*/
+#line 16101 "./marpa.w"
 
 
-/*:1089*/
-#line 13013 "./marpa.w"
+/*:1271*/
+#line 16569 "./marpa.w"
 ;
 
-/*:1117*/
-#line 13679 "./marpa.w"
+/*:1299*/
+#line 17238 "./marpa.w"
 
 
-/*:1171*/
-#line 13737 "./marpa.w"
+/*:1353*/
+#line 17296 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -19116,19 +23336,19 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 13738 "./marpa.w"
+/*:1521*/
+#line 17297 "./marpa.w"
 
-/*1174:*/
-#line 13689 "./marpa.w"
+/*1356:*/
+#line 17248 "./marpa.w"
 
 if(_MARPA_UNLIKELY(V_T_Generation(v)!=T_Generation(t))){
 MARPA_ERROR(MARPA_ERR_BASE_GENERATION_MISMATCH);
 return failure_indicator;
 }
 
-/*:1174*/
-#line 13739 "./marpa.w"
+/*:1356*/
+#line 17298 "./marpa.w"
 
 if(_MARPA_UNLIKELY(V_is_Nulling(v)))return-1;
 if(_MARPA_UNLIKELY(!V_is_Active(v))){
@@ -19138,8 +23358,8 @@ return failure_indicator;
 return NOOK_of_V(v);
 }
 
-/*:1183*//*1188:*/
-#line 13766 "./marpa.w"
+/*:1365*//*1370:*/
+#line 17325 "./marpa.w"
 
 PRIVATE int symbol_is_valued(
 VALUE v,
@@ -19148,55 +23368,54 @@ Marpa_Symbol_ID xsy_id)
 return lbv_bit_test(XSY_is_Valued_BV_of_V(v),xsy_id);
 }
 
-/*:1188*//*1189:*/
-#line 13775 "./marpa.w"
+/*:1370*//*1371:*/
+#line 17334 "./marpa.w"
 
 int marpa_v_symbol_is_valued(
 Marpa_Value public_v,
 Marpa_Symbol_ID xsy_id)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
-
-/*:1313*/
-#line 13780 "./marpa.w"
+/*:1500*/
+#line 17339 "./marpa.w"
 
 const VALUE v= (VALUE)public_v;
-/*1171:*/
-#line 13677 "./marpa.w"
+/*1353:*/
+#line 17236 "./marpa.w"
 
 TREE t= T_of_V(v);
-/*1117:*/
-#line 13011 "./marpa.w"
+/*1299:*/
+#line 16567 "./marpa.w"
 
 ORDER o= O_of_T(t);
-/*1089:*/
-#line 12543 "./marpa.w"
+/*1271:*/
+#line 16099 "./marpa.w"
 
 const BOCAGE b= B_of_O(o);
-/*1044:*/
-#line 12138 "./marpa.w"
+/*1226:*/
+#line 15682 "./marpa.w"
 
 const GRAMMAR g UNUSED= G_of_B(b);
 
-/*:1044*/
-#line 12545 "./marpa.w"
+/*:1226*/
+#line 16101 "./marpa.w"
 
 
-/*:1089*/
-#line 13013 "./marpa.w"
+/*:1271*/
+#line 16569 "./marpa.w"
 ;
 
-/*:1117*/
-#line 13679 "./marpa.w"
+/*:1299*/
+#line 17238 "./marpa.w"
 
 
-/*:1171*/
-#line 13782 "./marpa.w"
+/*:1353*/
+#line 17341 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -19207,55 +23426,54 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 13783 "./marpa.w"
+/*:1521*/
+#line 17342 "./marpa.w"
 
-/*1174:*/
-#line 13689 "./marpa.w"
+/*1356:*/
+#line 17248 "./marpa.w"
 
 if(_MARPA_UNLIKELY(V_T_Generation(v)!=T_Generation(t))){
 MARPA_ERROR(MARPA_ERR_BASE_GENERATION_MISMATCH);
 return failure_indicator;
 }
 
-/*:1174*/
-#line 13784 "./marpa.w"
+/*:1356*/
+#line 17343 "./marpa.w"
 
-/*1316:*/
-#line 15645 "./marpa.w"
+/*1504:*/
+#line 19401 "./marpa.w"
 
 if(_MARPA_UNLIKELY(XSYID_is_Malformed(xsy_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_SYMBOL_ID);
 return failure_indicator;
 }
-/*:1316*/
-#line 13785 "./marpa.w"
+/*:1504*/
+#line 17344 "./marpa.w"
 
-/*1317:*/
-#line 15652 "./marpa.w"
+/*1505:*/
+#line 19408 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!XSYID_of_G_Exists(xsy_id))){
 MARPA_ERROR(MARPA_ERR_NO_SUCH_SYMBOL_ID);
 return-1;
 }
-/*:1317*/
-#line 13786 "./marpa.w"
+/*:1505*/
+#line 17345 "./marpa.w"
 
 return lbv_bit_test(XSY_is_Valued_BV_of_V(v),xsy_id);
 }
 
-/*:1189*//*1190:*/
-#line 13792 "./marpa.w"
+/*:1371*//*1372:*/
+#line 17351 "./marpa.w"
 
 PRIVATE int symbol_is_valued_set(
 VALUE v,XSYID xsy_id,int value)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
-
-/*:1313*/
-#line 13796 "./marpa.w"
+/*:1500*/
+#line 17355 "./marpa.w"
 
 const int old_value= lbv_bit_test(XSY_is_Valued_BV_of_V(v),xsy_id);
 if(old_value==value){
@@ -19275,65 +23493,64 @@ lbv_bit_clear(XSY_is_Valued_BV_of_V(v),xsy_id);
 return value;
 }
 
-/*:1190*//*1191:*/
-#line 13815 "./marpa.w"
+/*:1372*//*1373:*/
+#line 17374 "./marpa.w"
 
 int marpa_v_symbol_is_valued_set(
 Marpa_Value public_v,Marpa_Symbol_ID xsy_id,int value)
 {
 const VALUE v= (VALUE)public_v;
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 17379 "./marpa.w"
 
-/*:1313*/
-#line 13820 "./marpa.w"
-
-/*1171:*/
-#line 13677 "./marpa.w"
+/*1353:*/
+#line 17236 "./marpa.w"
 
 TREE t= T_of_V(v);
-/*1117:*/
-#line 13011 "./marpa.w"
+/*1299:*/
+#line 16567 "./marpa.w"
 
 ORDER o= O_of_T(t);
-/*1089:*/
-#line 12543 "./marpa.w"
+/*1271:*/
+#line 16099 "./marpa.w"
 
 const BOCAGE b= B_of_O(o);
-/*1044:*/
-#line 12138 "./marpa.w"
+/*1226:*/
+#line 15682 "./marpa.w"
 
 const GRAMMAR g UNUSED= G_of_B(b);
 
-/*:1044*/
-#line 12545 "./marpa.w"
+/*:1226*/
+#line 16101 "./marpa.w"
 
 
-/*:1089*/
-#line 13013 "./marpa.w"
+/*:1271*/
+#line 16569 "./marpa.w"
 ;
 
-/*:1117*/
-#line 13679 "./marpa.w"
+/*:1299*/
+#line 17238 "./marpa.w"
 
 
-/*:1171*/
-#line 13821 "./marpa.w"
+/*:1353*/
+#line 17380 "./marpa.w"
 
-/*1174:*/
-#line 13689 "./marpa.w"
+/*1356:*/
+#line 17248 "./marpa.w"
 
 if(_MARPA_UNLIKELY(V_T_Generation(v)!=T_Generation(t))){
 MARPA_ERROR(MARPA_ERR_BASE_GENERATION_MISMATCH);
 return failure_indicator;
 }
 
-/*:1174*/
-#line 13822 "./marpa.w"
+/*:1356*/
+#line 17381 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -19344,87 +23561,86 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 13823 "./marpa.w"
+/*:1521*/
+#line 17382 "./marpa.w"
 
 if(_MARPA_UNLIKELY(value<0||value> 1))
 {
 MARPA_ERROR(MARPA_ERR_INVALID_BOOLEAN);
 return failure_indicator;
 }
-/*1316:*/
-#line 15645 "./marpa.w"
+/*1504:*/
+#line 19401 "./marpa.w"
 
 if(_MARPA_UNLIKELY(XSYID_is_Malformed(xsy_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_SYMBOL_ID);
 return failure_indicator;
 }
-/*:1316*/
-#line 13829 "./marpa.w"
+/*:1504*/
+#line 17388 "./marpa.w"
 
-/*1317:*/
-#line 15652 "./marpa.w"
+/*1505:*/
+#line 19408 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!XSYID_of_G_Exists(xsy_id))){
 MARPA_ERROR(MARPA_ERR_NO_SUCH_SYMBOL_ID);
 return-1;
 }
-/*:1317*/
-#line 13830 "./marpa.w"
+/*:1505*/
+#line 17389 "./marpa.w"
 
 return symbol_is_valued_set(v,xsy_id,value);
 }
 
-/*:1191*//*1192:*/
-#line 13836 "./marpa.w"
+/*:1373*//*1374:*/
+#line 17395 "./marpa.w"
 
 int
 marpa_v_valued_force(Marpa_Value public_v)
 {
 const VALUE v= (VALUE)public_v;
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
-
-/*:1313*/
-#line 13841 "./marpa.w"
+/*:1500*/
+#line 17400 "./marpa.w"
 
 XSYID xsy_count;
 XSYID xsy_id;
-/*1171:*/
-#line 13677 "./marpa.w"
+/*1353:*/
+#line 17236 "./marpa.w"
 
 TREE t= T_of_V(v);
-/*1117:*/
-#line 13011 "./marpa.w"
+/*1299:*/
+#line 16567 "./marpa.w"
 
 ORDER o= O_of_T(t);
-/*1089:*/
-#line 12543 "./marpa.w"
+/*1271:*/
+#line 16099 "./marpa.w"
 
 const BOCAGE b= B_of_O(o);
-/*1044:*/
-#line 12138 "./marpa.w"
+/*1226:*/
+#line 15682 "./marpa.w"
 
 const GRAMMAR g UNUSED= G_of_B(b);
 
-/*:1044*/
-#line 12545 "./marpa.w"
+/*:1226*/
+#line 16101 "./marpa.w"
 
 
-/*:1089*/
-#line 13013 "./marpa.w"
+/*:1271*/
+#line 16569 "./marpa.w"
 ;
 
-/*:1117*/
-#line 13679 "./marpa.w"
+/*:1299*/
+#line 17238 "./marpa.w"
 
 
-/*:1171*/
-#line 13844 "./marpa.w"
+/*:1353*/
+#line 17403 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -19435,19 +23651,19 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 13845 "./marpa.w"
+/*:1521*/
+#line 17404 "./marpa.w"
 
-/*1174:*/
-#line 13689 "./marpa.w"
+/*1356:*/
+#line 17248 "./marpa.w"
 
 if(_MARPA_UNLIKELY(V_T_Generation(v)!=T_Generation(t))){
 MARPA_ERROR(MARPA_ERR_BASE_GENERATION_MISMATCH);
 return failure_indicator;
 }
 
-/*:1174*/
-#line 13846 "./marpa.w"
+/*:1356*/
+#line 17405 "./marpa.w"
 
 xsy_count= XSY_Count_of_G(g);
 for(xsy_id= 0;xsy_id<xsy_count;xsy_id++)
@@ -19463,54 +23679,53 @@ lbv_bit_set(XSY_is_Valued_BV_of_V(v),xsy_id);
 return xsy_count;
 }
 
-/*:1192*//*1193:*/
-#line 13861 "./marpa.w"
+/*:1374*//*1375:*/
+#line 17420 "./marpa.w"
 
 int marpa_v_rule_is_valued_set(
 Marpa_Value public_v,Marpa_Rule_ID xrl_id,int value)
 {
 const VALUE v= (VALUE)public_v;
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 17425 "./marpa.w"
 
-/*:1313*/
-#line 13866 "./marpa.w"
-
-/*1171:*/
-#line 13677 "./marpa.w"
+/*1353:*/
+#line 17236 "./marpa.w"
 
 TREE t= T_of_V(v);
-/*1117:*/
-#line 13011 "./marpa.w"
+/*1299:*/
+#line 16567 "./marpa.w"
 
 ORDER o= O_of_T(t);
-/*1089:*/
-#line 12543 "./marpa.w"
+/*1271:*/
+#line 16099 "./marpa.w"
 
 const BOCAGE b= B_of_O(o);
-/*1044:*/
-#line 12138 "./marpa.w"
+/*1226:*/
+#line 15682 "./marpa.w"
 
 const GRAMMAR g UNUSED= G_of_B(b);
 
-/*:1044*/
-#line 12545 "./marpa.w"
+/*:1226*/
+#line 16101 "./marpa.w"
 
 
-/*:1089*/
-#line 13013 "./marpa.w"
+/*:1271*/
+#line 16569 "./marpa.w"
 ;
 
-/*:1117*/
-#line 13679 "./marpa.w"
+/*:1299*/
+#line 17238 "./marpa.w"
 
 
-/*:1171*/
-#line 13867 "./marpa.w"
+/*:1353*/
+#line 17426 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -19521,46 +23736,46 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 13868 "./marpa.w"
+/*:1521*/
+#line 17427 "./marpa.w"
 
-/*1174:*/
-#line 13689 "./marpa.w"
+/*1356:*/
+#line 17248 "./marpa.w"
 
 if(_MARPA_UNLIKELY(V_T_Generation(v)!=T_Generation(t))){
 MARPA_ERROR(MARPA_ERR_BASE_GENERATION_MISMATCH);
 return failure_indicator;
 }
 
-/*:1174*/
-#line 13869 "./marpa.w"
+/*:1356*/
+#line 17428 "./marpa.w"
 
 if(_MARPA_UNLIKELY(value<0||value> 1))
 {
 MARPA_ERROR(MARPA_ERR_INVALID_BOOLEAN);
 return failure_indicator;
 }
-/*1325:*/
-#line 15701 "./marpa.w"
+/*1513:*/
+#line 19457 "./marpa.w"
 
 if(_MARPA_UNLIKELY(XRLID_is_Malformed(xrl_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_RULE_ID);
 return failure_indicator;
 }
 
-/*:1325*/
-#line 13875 "./marpa.w"
+/*:1513*/
+#line 17434 "./marpa.w"
 
-/*1323:*/
-#line 15689 "./marpa.w"
+/*1511:*/
+#line 19445 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!XRLID_of_G_Exists(xrl_id))){
 MARPA_ERROR(MARPA_ERR_NO_SUCH_RULE_ID);
 return-1;
 }
 
-/*:1323*/
-#line 13876 "./marpa.w"
+/*:1511*/
+#line 17435 "./marpa.w"
 
 {
 const XRL xrl= XRL_by_ID(xrl_id);
@@ -19569,54 +23784,53 @@ return symbol_is_valued_set(v,xsy_id,value);
 }
 }
 
-/*:1193*//*1194:*/
-#line 13884 "./marpa.w"
+/*:1375*//*1376:*/
+#line 17443 "./marpa.w"
 
 int marpa_v_rule_is_valued(
 Marpa_Value public_v,Marpa_Rule_ID xrl_id)
 {
-const VALUE v= (VALUE)public_v;
-/*1313:*/
-#line 15629 "./marpa.w"
+const VALUE v= (VALUE)public_v;
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 17448 "./marpa.w"
 
-/*:1313*/
-#line 13889 "./marpa.w"
-
-/*1171:*/
-#line 13677 "./marpa.w"
+/*1353:*/
+#line 17236 "./marpa.w"
 
 TREE t= T_of_V(v);
-/*1117:*/
-#line 13011 "./marpa.w"
+/*1299:*/
+#line 16567 "./marpa.w"
 
 ORDER o= O_of_T(t);
-/*1089:*/
-#line 12543 "./marpa.w"
+/*1271:*/
+#line 16099 "./marpa.w"
 
 const BOCAGE b= B_of_O(o);
-/*1044:*/
-#line 12138 "./marpa.w"
+/*1226:*/
+#line 15682 "./marpa.w"
 
 const GRAMMAR g UNUSED= G_of_B(b);
 
-/*:1044*/
-#line 12545 "./marpa.w"
+/*:1226*/
+#line 16101 "./marpa.w"
 
 
-/*:1089*/
-#line 13013 "./marpa.w"
+/*:1271*/
+#line 16569 "./marpa.w"
 ;
 
-/*:1117*/
-#line 13679 "./marpa.w"
+/*:1299*/
+#line 17238 "./marpa.w"
 
 
-/*:1171*/
-#line 13890 "./marpa.w"
+/*:1353*/
+#line 17449 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -19627,41 +23841,41 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 13891 "./marpa.w"
+/*:1521*/
+#line 17450 "./marpa.w"
 
-/*1174:*/
-#line 13689 "./marpa.w"
+/*1356:*/
+#line 17248 "./marpa.w"
 
 if(_MARPA_UNLIKELY(V_T_Generation(v)!=T_Generation(t))){
 MARPA_ERROR(MARPA_ERR_BASE_GENERATION_MISMATCH);
 return failure_indicator;
 }
 
-/*:1174*/
-#line 13892 "./marpa.w"
+/*:1356*/
+#line 17451 "./marpa.w"
 
-/*1325:*/
-#line 15701 "./marpa.w"
+/*1513:*/
+#line 19457 "./marpa.w"
 
 if(_MARPA_UNLIKELY(XRLID_is_Malformed(xrl_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_RULE_ID);
 return failure_indicator;
 }
 
-/*:1325*/
-#line 13893 "./marpa.w"
+/*:1513*/
+#line 17452 "./marpa.w"
 
-/*1323:*/
-#line 15689 "./marpa.w"
+/*1511:*/
+#line 19445 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!XRLID_of_G_Exists(xrl_id))){
 MARPA_ERROR(MARPA_ERR_NO_SUCH_RULE_ID);
 return-1;
 }
 
-/*:1323*/
-#line 13894 "./marpa.w"
+/*:1511*/
+#line 17453 "./marpa.w"
 
 {
 const XRL xrl= XRL_by_ID(xrl_id);
@@ -19670,53 +23884,52 @@ return symbol_is_valued(v,xsy_id);
 }
 }
 
-/*:1194*//*1196:*/
-#line 13909 "./marpa.w"
+/*:1376*//*1378:*/
+#line 17468 "./marpa.w"
 
 Marpa_Step_Type marpa_v_step(Marpa_Value public_v)
 {
 const VALUE v= (VALUE)public_v;
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 17472 "./marpa.w"
 
-/*:1313*/
-#line 13913 "./marpa.w"
-
-/*1171:*/
-#line 13677 "./marpa.w"
+/*1353:*/
+#line 17236 "./marpa.w"
 
 TREE t= T_of_V(v);
-/*1117:*/
-#line 13011 "./marpa.w"
+/*1299:*/
+#line 16567 "./marpa.w"
 
 ORDER o= O_of_T(t);
-/*1089:*/
-#line 12543 "./marpa.w"
+/*1271:*/
+#line 16099 "./marpa.w"
 
 const BOCAGE b= B_of_O(o);
-/*1044:*/
-#line 12138 "./marpa.w"
+/*1226:*/
+#line 15682 "./marpa.w"
 
 const GRAMMAR g UNUSED= G_of_B(b);
 
-/*:1044*/
-#line 12545 "./marpa.w"
+/*:1226*/
+#line 16101 "./marpa.w"
 
 
-/*:1089*/
-#line 13013 "./marpa.w"
+/*:1271*/
+#line 16569 "./marpa.w"
 ;
 
-/*:1117*/
-#line 13679 "./marpa.w"
+/*:1299*/
+#line 17238 "./marpa.w"
 
 
-/*:1171*/
-#line 13914 "./marpa.w"
+/*:1353*/
+#line 17473 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -19727,24 +23940,24 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 13915 "./marpa.w"
+/*:1521*/
+#line 17474 "./marpa.w"
 
-/*1174:*/
-#line 13689 "./marpa.w"
+/*1356:*/
+#line 17248 "./marpa.w"
 
 if(_MARPA_UNLIKELY(V_T_Generation(v)!=T_Generation(t))){
 MARPA_ERROR(MARPA_ERR_BASE_GENERATION_MISMATCH);
 return failure_indicator;
 }
 
-/*:1174*/
-#line 13916 "./marpa.w"
+/*:1356*/
+#line 17475 "./marpa.w"
 
 
 if(V_is_Nulling(v)){
-/*1198:*/
-#line 13998 "./marpa.w"
+/*1380:*/
+#line 17557 "./marpa.w"
 
 {
 while(V_is_Active(v))
@@ -19770,8 +23983,8 @@ return Step_Type_of_V(v)= MARPA_STEP_NULLING_SYMBOL;
 }
 }
 
-/*:1198*/
-#line 13919 "./marpa.w"
+/*:1380*/
+#line 17478 "./marpa.w"
 
 return Step_Type_of_V(v)= MARPA_STEP_INACTIVE;
 }
@@ -19785,8 +23998,8 @@ case MARPA_STEP_INITIAL:
 XSYID xsy_count;
 xsy_count= XSY_Count_of_G(g);
 lbv_fill(Valued_Locked_BV_of_V(v),xsy_count);
-/*1197:*/
-#line 13982 "./marpa.w"
+/*1379:*/
+#line 17541 "./marpa.w"
 
 {
 const LBV xsy_bv= XSY_is_Valued_BV_of_V(v);
@@ -19803,14 +24016,14 @@ lbv_bit_set(xrl_bv,xrlid);
 }
 }
 
-/*:1197*/
-#line 13932 "./marpa.w"
+/*:1379*/
+#line 17491 "./marpa.w"
 
 }
 
 case STEP_GET_DATA:
-/*1199:*/
-#line 14023 "./marpa.w"
+/*1381:*/
+#line 17582 "./marpa.w"
 
 {
 AND and_nodes;
@@ -19954,8 +24167,8 @@ break;
 }
 }
 
-/*:1199*/
-#line 13936 "./marpa.w"
+/*:1381*/
+#line 17495 "./marpa.w"
 
 if(!V_is_Active(v))break;
 
@@ -19998,8 +24211,8 @@ Next_Value_Type_of_V(v)= MARPA_STEP_INACTIVE;
 return Step_Type_of_V(v)= MARPA_STEP_INACTIVE;
 }
 
-/*:1196*//*1201:*/
-#line 14184 "./marpa.w"
+/*:1378*//*1383:*/
+#line 17743 "./marpa.w"
 
 PRIVATE int lbv_bits_to_size(int bits)
 {
@@ -20007,8 +24220,8 @@ const LBW result= (LBW)(((unsigned int)bits+(lbv_wordbits-1))/lbv_wordbits);
 return(int)result;
 }
 
-/*:1201*//*1202:*/
-#line 14192 "./marpa.w"
+/*:1383*//*1384:*/
+#line 17751 "./marpa.w"
 
 PRIVATE Bit_Vector
 lbv_obs_new(struct marpa_obstack*obs,int bits)
@@ -20018,8 +24231,8 @@ LBV lbv= marpa_obs_new(obs,LBW,size);
 return lbv;
 }
 
-/*:1202*//*1203:*/
-#line 14202 "./marpa.w"
+/*:1384*//*1385:*/
+#line 17761 "./marpa.w"
 
 PRIVATE Bit_Vector
 lbv_zero(Bit_Vector lbv,int bits)
@@ -20032,8 +24245,8 @@ while(size--)*addr++= 0u;
 return lbv;
 }
 
-/*:1203*//*1204:*/
-#line 14215 "./marpa.w"
+/*:1385*//*1386:*/
+#line 17774 "./marpa.w"
 
 PRIVATE Bit_Vector
 lbv_obs_new0(struct marpa_obstack*obs,int bits)
@@ -20042,8 +24255,8 @@ LBV lbv= lbv_obs_new(obs,bits);
 return lbv_zero(lbv,bits);
 }
 
-/*:1204*//*1206:*/
-#line 14234 "./marpa.w"
+/*:1386*//*1388:*/
+#line 17793 "./marpa.w"
 
 PRIVATE LBV lbv_clone(
 struct marpa_obstack*obs,LBV old_lbv,int bits)
@@ -20058,8 +24271,23 @@ while(size--)*to_addr++= *from_addr++;
 return new_lbv;
 }
 
-/*:1206*//*1207:*/
-#line 14250 "./marpa.w"
+/*:1388*//*1389:*/
+#line 17808 "./marpa.w"
+
+PRIVATE LBV lbv_copy(
+LBV lbv_to,LBV lbv_from,int bits)
+{
+int size= lbv_bits_to_size(bits);
+if(size> 0){
+LBW*from_addr= lbv_from;
+LBW*to_addr= lbv_to;
+while(size--)*to_addr++= *from_addr++;
+}
+return lbv_to;
+}
+
+/*:1389*//*1390:*/
+#line 17823 "./marpa.w"
 
 PRIVATE LBV lbv_fill(
 LBV lbv,int bits)
@@ -20072,15 +24300,15 @@ while(size--)*to_addr++= ~((LBW)0);
 return lbv;
 }
 
-/*:1207*//*1210:*/
-#line 14286 "./marpa.w"
+/*:1390*//*1393:*/
+#line 17859 "./marpa.w"
 
 PRIVATE unsigned int bv_bits_to_size(int bits)
 {
 return((LBW)bits+bv_modmask)/bv_wordbits;
 }
-/*:1210*//*1211:*/
-#line 14292 "./marpa.w"
+/*:1393*//*1394:*/
+#line 17865 "./marpa.w"
 
 PRIVATE unsigned int bv_bits_to_unused_mask(int bits)
 {
@@ -20089,22 +24317,22 @@ if(mask)mask= (LBW)~(~0uL<<mask);else mask= (LBW)~0uL;
 return(mask);
 }
 
-/*:1211*//*1213:*/
-#line 14306 "./marpa.w"
+/*:1394*//*1396:*/
+#line 17879 "./marpa.w"
 
-PRIVATE Bit_Vector bv_create(int bits)
+PRIVATE Bit_Vector bv_create(MARPA_ALLOCATOR allocator,int bits)
 {
 LBW size= bv_bits_to_size(bits);
 LBW bytes= (size+(LBW)bv_hiddenwords)*(LBW)sizeof(Bit_Vector_Word);
-LBW*addr= (Bit_Vector)my_malloc0((size_t)bytes);
+LBW*addr= (Bit_Vector)marpa__a_malloc0(allocator,(size_t)bytes);
 *addr++= (LBW)bits;
 *addr++= size;
 *addr++= bv_bits_to_unused_mask(bits);
 return addr;
 }
 
-/*:1213*//*1215:*/
-#line 14324 "./marpa.w"
+/*:1396*//*1398:*/
+#line 17897 "./marpa.w"
 
 PRIVATE Bit_Vector
 bv_obs_create(struct marpa_obstack*obs,int bits)
@@ -20123,20 +24351,20 @@ return addr;
 }
 
 
-/*:1215*//*1216:*/
-#line 14345 "./marpa.w"
+/*:1398*//*1399:*/
+#line 17918 "./marpa.w"
 
-PRIVATE Bit_Vector bv_shadow(Bit_Vector bv)
+PRIVATE Bit_Vector bv_shadow(MARPA_ALLOCATOR allocator,Bit_Vector bv)
 {
-return bv_create((int)BV_BITS(bv));
+return bv_create(allocator,(int)BV_BITS(bv));
 }
 PRIVATE Bit_Vector bv_obs_shadow(struct marpa_obstack*obs,Bit_Vector bv)
 {
 return bv_obs_create(obs,(int)BV_BITS(bv));
 }
 
-/*:1216*//*1217:*/
-#line 14359 "./marpa.w"
+/*:1399*//*1400:*/
+#line 17932 "./marpa.w"
 
 PRIVATE
 Bit_Vector bv_copy(Bit_Vector bv_to,Bit_Vector bv_from)
@@ -20151,13 +24379,13 @@ while(count--)*p_to++= *bv_from++;
 return(bv_to);
 }
 
-/*:1217*//*1218:*/
-#line 14377 "./marpa.w"
+/*:1400*//*1401:*/
+#line 17950 "./marpa.w"
 
 PRIVATE
-Bit_Vector bv_clone(Bit_Vector bv)
+Bit_Vector bv_clone(MARPA_ALLOCATOR allocator,Bit_Vector bv)
 {
-return bv_copy(bv_shadow(bv),bv);
+return bv_copy(bv_shadow(allocator,bv),bv);
 }
 
 PRIVATE
@@ -20166,20 +24394,20 @@ Bit_Vector bv_obs_clone(struct marpa_obstack*obs,Bit_Vector bv)
 return bv_copy(bv_obs_shadow(obs,bv),bv);
 }
 
-/*:1218*//*1219:*/
-#line 14391 "./marpa.w"
+/*:1401*//*1402:*/
+#line 17964 "./marpa.w"
 
-PRIVATE void bv_free(Bit_Vector vector)
+PRIVATE void bv_free(MARPA_ALLOCATOR allocator,Bit_Vector vector)
 {
 if(_MARPA_LIKELY(vector!=NULL))
 {
 vector-= bv_hiddenwords;
-my_free(vector);
+marpa__a_free(allocator,vector);
 }
 }
 
-/*:1219*//*1220:*/
-#line 14402 "./marpa.w"
+/*:1402*//*1403:*/
+#line 17975 "./marpa.w"
 
 PRIVATE void bv_fill(Bit_Vector bv)
 {
@@ -20190,8 +24418,8 @@ while(size--)*bv++= ~0u;
 *bv&= BV_MASK(bv);
 }
 
-/*:1220*//*1221:*/
-#line 14413 "./marpa.w"
+/*:1403*//*1404:*/
+#line 17986 "./marpa.w"
 
 PRIVATE void bv_clear(Bit_Vector bv)
 {
@@ -20200,8 +24428,8 @@ if(size<=0)return;
 while(size--)*bv++= 0u;
 }
 
-/*:1221*//*1223:*/
-#line 14427 "./marpa.w"
+/*:1404*//*1406:*/
+#line 18000 "./marpa.w"
 
 PRIVATE void bv_over_clear(Bit_Vector bv,int raw_bit)
 {
@@ -20210,8 +24438,8 @@ LBW length= bit/bv_wordbits+1;
 while(length--)*bv++= 0u;
 }
 
-/*:1223*//*1225:*/
-#line 14436 "./marpa.w"
+/*:1406*//*1408:*/
+#line 18009 "./marpa.w"
 
 PRIVATE void bv_bit_set(Bit_Vector vector,int raw_bit)
 {
@@ -20219,8 +24447,8 @@ const LBW bit= (LBW)raw_bit;
 *(vector+(bit/bv_wordbits))|= (bv_lsb<<(bit%bv_wordbits));
 }
 
-/*:1225*//*1226:*/
-#line 14444 "./marpa.w"
+/*:1408*//*1409:*/
+#line 18017 "./marpa.w"
 
 PRIVATE void bv_bit_clear(Bit_Vector vector,int raw_bit)
 {
@@ -20228,8 +24456,8 @@ const LBW bit= (LBW)raw_bit;
 *(vector+(bit/bv_wordbits))&= ~(bv_lsb<<(bit%bv_wordbits));
 }
 
-/*:1226*//*1227:*/
-#line 14452 "./marpa.w"
+/*:1409*//*1410:*/
+#line 18025 "./marpa.w"
 
 PRIVATE int bv_bit_test(Bit_Vector vector,int raw_bit)
 {
@@ -20237,8 +24465,8 @@ const LBW bit= (LBW)raw_bit;
 return(*(vector+(bit/bv_wordbits))&(bv_lsb<<(bit%bv_wordbits)))!=0u;
 }
 
-/*:1227*//*1228:*/
-#line 14464 "./marpa.w"
+/*:1410*//*1411:*/
+#line 18037 "./marpa.w"
 
 PRIVATE int
 bv_bit_test_then_set(Bit_Vector vector,int raw_bit)
@@ -20252,8 +24480,8 @@ return 1;
 return 0;
 }
 
-/*:1228*//*1229:*/
-#line 14478 "./marpa.w"
+/*:1411*//*1412:*/
+#line 18051 "./marpa.w"
 
 PRIVATE
 int bv_is_empty(Bit_Vector addr)
@@ -20267,8 +24495,18 @@ while(r&&(size--> 0))r= (*addr++==0);
 return(r);
 }
 
-/*:1229*//*1230:*/
-#line 14492 "./marpa.w"
+/*:1412*//*1413:*/
+#line 18066 "./marpa.w"
+
+PRIVATE int bv_is_equal(Bit_Vector X,Bit_Vector Y)
+{
+LBW size= BV_SIZE(X);
+while(size--> 0)if(*X++!=*Y++)return 0;
+return 1;
+}
+
+/*:1413*//*1414:*/
+#line 18075 "./marpa.w"
 
 PRIVATE void bv_not(Bit_Vector X,Bit_Vector Y)
 {
@@ -20278,8 +24516,8 @@ while(size--> 0)*X++= ~*Y++;
 *(--X)&= mask;
 }
 
-/*:1230*//*1231:*/
-#line 14502 "./marpa.w"
+/*:1414*//*1415:*/
+#line 18085 "./marpa.w"
 
 PRIVATE void bv_and(Bit_Vector X,Bit_Vector Y,Bit_Vector Z)
 {
@@ -20289,8 +24527,8 @@ while(size--> 0)*X++= *Y++&*Z++;
 *(--X)&= mask;
 }
 
-/*:1231*//*1232:*/
-#line 14512 "./marpa.w"
+/*:1415*//*1416:*/
+#line 18095 "./marpa.w"
 
 PRIVATE void bv_or(Bit_Vector X,Bit_Vector Y,Bit_Vector Z)
 {
@@ -20300,8 +24538,8 @@ while(size--> 0)*X++= *Y++|*Z++;
 *(--X)&= mask;
 }
 
-/*:1232*//*1233:*/
-#line 14522 "./marpa.w"
+/*:1416*//*1417:*/
+#line 18105 "./marpa.w"
 
 PRIVATE void bv_or_assign(Bit_Vector X,Bit_Vector Y)
 {
@@ -20311,8 +24549,8 @@ while(size--> 0)*X++|= *Y++;
 *(--X)&= mask;
 }
 
-/*:1233*//*1234:*/
-#line 14532 "./marpa.w"
+/*:1417*//*1418:*/
+#line 18115 "./marpa.w"
 
 PRIVATE_NOT_INLINE
 int bv_scan(Bit_Vector bv,int raw_start,int*raw_min,int*raw_max)
@@ -20392,8 +24630,8 @@ max= --start;
 return 1;
 }
 
-/*:1234*//*1235:*/
-#line 14612 "./marpa.w"
+/*:1418*//*1419:*/
+#line 18195 "./marpa.w"
 
 PRIVATE int
 bv_count(Bit_Vector v)
@@ -20407,8 +24645,8 @@ count+= max-min+1;
 return count;
 }
 
-/*:1235*//*1240:*/
-#line 14659 "./marpa.w"
+/*:1419*//*1424:*/
+#line 18242 "./marpa.w"
 
 PRIVATE void
 rhs_closure(GRAMMAR g,Bit_Vector bv,XRLID**xrl_list_x_rh_sym)
@@ -20419,7 +24657,7 @@ Marpa_Symbol_ID*end_of_stack= NULL;
 
 
 FSTACK_DECLARE(stack,XSYID)
-FSTACK_INIT(stack,XSYID,XSY_Count_of_G(g));
+FSTACK_INIT(stack,XSYID,XSY_Count_of_G(g),Allocator_of_G(g));
 
 
 
@@ -20522,8 +24760,8 @@ NEXT_RULE:;
 FSTACK_DESTROY(stack);
 }
 
-/*:1240*//*1245:*/
-#line 14806 "./marpa.w"
+/*:1424*//*1429:*/
+#line 18389 "./marpa.w"
 
 PRIVATE Bit_Matrix
 matrix_buffer_create(void*buffer,int rows,int columns)
@@ -20546,8 +24784,8 @@ while(data_word_counter--)*p_current_word++= 0;
 return matrix_addr;
 }
 
-/*:1245*//*1247:*/
-#line 14829 "./marpa.w"
+/*:1429*//*1431:*/
+#line 18412 "./marpa.w"
 
 PRIVATE size_t matrix_sizeof(int rows,int columns)
 {
@@ -20558,8 +24796,8 @@ return offsetof(struct s_bit_matrix,
 t_row_data)+((size_t)rows)*row_bytes;
 }
 
-/*:1247*//*1249:*/
-#line 14840 "./marpa.w"
+/*:1431*//*1433:*/
+#line 18423 "./marpa.w"
 
 PRIVATE Bit_Matrix matrix_obs_create(
 struct marpa_obstack*obs,
@@ -20572,8 +24810,8 @@ marpa__obs_alloc(obs,matrix_sizeof(rows,columns),ALIGNOF(Bit_Matrix_Object));
 return matrix_buffer_create(matrix_addr,rows,columns);
 }
 
-/*:1249*//*1250:*/
-#line 14853 "./marpa.w"
+/*:1433*//*1434:*/
+#line 18436 "./marpa.w"
 
 PRIVATE void matrix_clear(Bit_Matrix matrix)
 {
@@ -20590,8 +24828,8 @@ row+= words_per_row;
 }
 }
 
-/*:1250*//*1251:*/
-#line 14875 "./marpa.w"
+/*:1434*//*1435:*/
+#line 18458 "./marpa.w"
 
 PRIVATE int matrix_columns(Bit_Matrix matrix)
 {
@@ -20599,8 +24837,8 @@ Bit_Vector row0= matrix->t_row_data+bv_hiddenwords;
 return(int)BV_BITS(row0);
 }
 
-/*:1251*//*1252:*/
-#line 14891 "./marpa.w"
+/*:1435*//*1436:*/
+#line 18474 "./marpa.w"
 
 PRIVATE Bit_Vector matrix_row(Bit_Matrix matrix,int row)
 {
@@ -20609,8 +24847,8 @@ LBW words_per_row= BV_SIZE(row0)+bv_hiddenwords;
 return row0+(LBW)row*words_per_row;
 }
 
-/*:1252*//*1254:*/
-#line 14900 "./marpa.w"
+/*:1436*//*1438:*/
+#line 18483 "./marpa.w"
 
 PRIVATE void matrix_bit_set(Bit_Matrix matrix,int row,int column)
 {
@@ -20618,8 +24856,8 @@ Bit_Vector vector= matrix_row(matrix,row);
 bv_bit_set(vector,column);
 }
 
-/*:1254*//*1256:*/
-#line 14908 "./marpa.w"
+/*:1438*//*1440:*/
+#line 18491 "./marpa.w"
 
 PRIVATE void matrix_bit_clear(Bit_Matrix matrix,int row,int column)
 {
@@ -20627,8 +24865,8 @@ Bit_Vector vector= matrix_row(matrix,row);
 bv_bit_clear(vector,column);
 }
 
-/*:1256*//*1258:*/
-#line 14916 "./marpa.w"
+/*:1440*//*1442:*/
+#line 18499 "./marpa.w"
 
 PRIVATE int matrix_bit_test(Bit_Matrix matrix,int row,int column)
 {
@@ -20636,52 +24874,185 @@ Bit_Vector vector= matrix_row(matrix,row);
 return bv_bit_test(vector,column);
 }
 
-/*:1258*//*1259:*/
-#line 14933 "./marpa.w"
+/*:1442*//*1443:*/
+#line 18536 "./marpa.w"
+
+PRIVATE_NOT_INLINE void
+transitive_closure(MARPA_ALLOCATOR allocator,Bit_Matrix matrix)
+{
+const int size= matrix_columns(matrix);
+int*dfs_ix_by_node;
+int*low_by_node;
+int*scc_by_node;
+int*scc_stack;
+int*call_stack;
+int*next_by_call;
+int scc_stack_count= 0;
+int next_dfs_ix= 0;
+int scc_count= 0;
+int root;
+Bit_Vector closure;
+
+if(size<=0)
+return;
+dfs_ix_by_node= marpa_a_new(allocator,int,6*(size_t)size);
+low_by_node= dfs_ix_by_node+size;
+scc_by_node= low_by_node+size;
+scc_stack= scc_by_node+size;
+call_stack= scc_stack+size;
+next_by_call= call_stack+size;
+closure= bv_create(allocator,size);
+for(root= 0;root<size;root++)
+{
+dfs_ix_by_node[root]= -1;
+scc_by_node[root]= -1;
+}
+
+for(root= 0;root<size;root++)
+{
+int call_count= 0;
+int new_node= root;
+if(dfs_ix_by_node[root]>=0)
+continue;
+/*1444:*/
+#line 18615 "./marpa.w"
+
+{
+dfs_ix_by_node[new_node]= low_by_node[new_node]= next_dfs_ix++;
+scc_stack[scc_stack_count++]= new_node;
+call_stack[call_count]= new_node;
+next_by_call[call_count]= 0;
+call_count++;
+}
+
+/*:1444*/
+#line 18574 "./marpa.w"
+
+while(call_count> 0)
+{
+const int node= call_stack[call_count-1];
+int successor;
+int run_end;
+if(bv_scan(matrix_row(matrix,node),
+next_by_call[call_count-1],&successor,&run_end))
+{
+next_by_call[call_count-1]= successor+1;
+if(dfs_ix_by_node[successor]<0)
+{
+new_node= successor;
+/*1444:*/
+#line 18615 "./marpa.w"
+
+{
+dfs_ix_by_node[new_node]= low_by_node[new_node]= next_dfs_ix++;
+scc_stack[scc_stack_count++]= new_node;
+call_stack[call_count]= new_node;
+next_by_call[call_count]= 0;
+call_count++;
+}
+
+/*:1444*/
+#line 18587 "./marpa.w"
+
+continue;
+}
+
+
+if(scc_by_node[successor]<0
+&&dfs_ix_by_node[successor]<low_by_node[node])
+low_by_node[node]= dfs_ix_by_node[successor];
+continue;
+}
+call_count--;
+if(low_by_node[node]==dfs_ix_by_node[node])
+{
+/*1445:*/
+#line 18634 "./marpa.w"
 
-PRIVATE_NOT_INLINE void transitive_closure(Bit_Matrix matrix)
 {
-int size= matrix_columns(matrix);
-int outer_row;
-for(outer_row= 0;outer_row<size;outer_row++)
+int base= scc_stack_count;
+int member_ix;
+do
+{
+base--;
+scc_by_node[scc_stack[base]]= scc_count;
+}
+while(scc_stack[base]!=node);
+bv_clear(closure);
+for(member_ix= base;member_ix<scc_stack_count;member_ix++)
+{
+int start,min,max;
+const Bit_Vector member_row= 
+matrix_row(matrix,scc_stack[member_ix]);
+for(start= 0;bv_scan(member_row,start,&min,&max);
+start= max+2)
+{
+int next_node;
+for(next_node= min;next_node<=max;next_node++)
+{
+if(scc_by_node[next_node]==scc_count)
+continue;
+if(bv_bit_test(closure,next_node))
+continue;
+bv_bit_set(closure,next_node);
+bv_or_assign(closure,matrix_row(matrix,next_node));
+}
+}
+}
+for(member_ix= base;member_ix<scc_stack_count;member_ix++)
 {
-Bit_Vector outer_row_v= matrix_row(matrix,outer_row);
-int column;
-for(column= 0;column<size;column++)
+bv_or_assign(closure,matrix_row(matrix,scc_stack[member_ix]));
+}
+for(member_ix= base;member_ix<scc_stack_count;member_ix++)
 {
-Bit_Vector inner_row_v= matrix_row(matrix,column);
-if(bv_bit_test(inner_row_v,outer_row))
+bv_copy(matrix_row(matrix,scc_stack[member_ix]),closure);
+}
+scc_stack_count= base;
+scc_count++;
+}
+
+/*:1445*/
+#line 18600 "./marpa.w"
+
+}
+if(call_count> 0)
 {
-bv_or_assign(inner_row_v,outer_row_v);
+const int parent= call_stack[call_count-1];
+if(low_by_node[node]<low_by_node[parent])
+low_by_node[parent]= low_by_node[node];
 }
 }
 }
+
+bv_free(allocator,closure);
+marpa__a_free(allocator,dfs_ix_by_node);
 }
 
-/*:1259*//*1271:*/
-#line 15074 "./marpa.w"
+/*:1443*//*1457:*/
+#line 18801 "./marpa.w"
 
 PRIVATE void
-cilar_init(const CILAR cilar)
+cilar_init(const CILAR cilar,MARPA_ALLOCATOR allocator)
 {
-cilar->t_obs= marpa_obs_init;
-cilar->t_avl= _marpa_avl_create(cil_cmp,NULL);
-MARPA_DSTACK_INIT(cilar->t_buffer,int,2);
+cilar->t_obs= marpa_obs_init(allocator);
+cilar->t_avl= _marpa_avl_create(cil_cmp,NULL,allocator);
+MARPA_DSTACK_INIT(cilar->t_buffer,int,2,allocator);
 *MARPA_DSTACK_INDEX(cilar->t_buffer,int,0)= 0;
 }
-/*:1271*//*1272:*/
-#line 15088 "./marpa.w"
+/*:1457*//*1458:*/
+#line 18815 "./marpa.w"
 
 PRIVATE void
 cilar_buffer_reinit(const CILAR cilar)
 {
+struct marpa_allocator_s allocator= cilar->t_buffer.t_allocator;
 MARPA_DSTACK_DESTROY(cilar->t_buffer);
-MARPA_DSTACK_INIT(cilar->t_buffer,int,2);
+MARPA_DSTACK_INIT(cilar->t_buffer,int,2,&allocator);
 *MARPA_DSTACK_INDEX(cilar->t_buffer,int,0)= 0;
 }
 
-/*:1272*//*1273:*/
-#line 15097 "./marpa.w"
+/*:1458*//*1459:*/
+#line 18825 "./marpa.w"
 
 PRIVATE void cilar_destroy(const CILAR cilar)
 {
@@ -20690,8 +25061,8 @@ marpa_obs_free(cilar->t_obs);
 MARPA_DSTACK_DESTROY((cilar->t_buffer));
 }
 
-/*:1273*//*1274:*/
-#line 15106 "./marpa.w"
+/*:1459*//*1460:*/
+#line 18834 "./marpa.w"
 
 PRIVATE CIL cil_empty(CILAR cilar)
 {
@@ -20701,8 +25072,8 @@ Count_of_CIL(cil)= 0;
 return cil_buffer_add(cilar);
 }
 
-/*:1274*//*1275:*/
-#line 15116 "./marpa.w"
+/*:1460*//*1461:*/
+#line 18844 "./marpa.w"
 
 PRIVATE CIL cil_singleton(CILAR cilar,int element)
 {
@@ -20713,8 +25084,8 @@ Item_of_CIL(cil,0)= element;
 return cil_buffer_add(cilar);
 }
 
-/*:1275*//*1276:*/
-#line 15132 "./marpa.w"
+/*:1461*//*1462:*/
+#line 18860 "./marpa.w"
 
 PRIVATE CIL cil_buffer_add(CILAR cilar)
 {
@@ -20735,8 +25106,8 @@ _marpa_avl_insert(cilar->t_avl,found_cil);
 return found_cil;
 }
 
-/*:1276*//*1277:*/
-#line 15160 "./marpa.w"
+/*:1462*//*1463:*/
+#line 18888 "./marpa.w"
 
 PRIVATE CIL cil_bv_add(CILAR cilar,Bit_Vector bv)
 {
@@ -20753,8 +25124,8 @@ cil_buffer_push(cilar,new_item);
 return cil_buffer_add(cilar);
 }
 
-/*:1277*//*1278:*/
-#line 15177 "./marpa.w"
+/*:1463*//*1464:*/
+#line 18905 "./marpa.w"
 
 PRIVATE void cil_buffer_clear(CILAR cilar)
 {
@@ -20767,8 +25138,8 @@ MARPA_DSTACK_CLEAR(*dstack);
 *MARPA_DSTACK_PUSH(*dstack,int)= 0;
 }
 
-/*:1278*//*1279:*/
-#line 15192 "./marpa.w"
+/*:1464*//*1465:*/
+#line 18920 "./marpa.w"
 
 PRIVATE CIL cil_buffer_push(CILAR cilar,int new_item)
 {
@@ -20783,8 +25154,8 @@ Count_of_CIL(cil_in_buffer)++;
 return cil_in_buffer;
 }
 
-/*:1279*//*1280:*/
-#line 15208 "./marpa.w"
+/*:1465*//*1466:*/
+#line 18936 "./marpa.w"
 
 PRIVATE CIL cil_buffer_reserve(CILAR cilar,int element_count)
 {
@@ -20800,8 +25171,8 @@ MARPA_DSTACK_RESIZE(&(cilar->t_buffer),int,target_capacity);
 return MARPA_DSTACK_BASE(cilar->t_buffer,int);
 }
 
-/*:1280*//*1281:*/
-#line 15227 "./marpa.w"
+/*:1466*//*1467:*/
+#line 18955 "./marpa.w"
 
 PRIVATE CIL cil_merge(CILAR cilar,CIL cil1,CIL cil2)
 {
@@ -20850,8 +25221,8 @@ Count_of_CIL(new_cil)= new_cil_ix;
 return cil_buffer_add(cilar);
 }
 
-/*:1281*//*1282:*/
-#line 15280 "./marpa.w"
+/*:1467*//*1468:*/
+#line 19008 "./marpa.w"
 
 PRIVATE CIL cil_merge_one(CILAR cilar,CIL cil,int new_element)
 {
@@ -20887,8 +25258,8 @@ Count_of_CIL(new_cil)= new_cil_ix;
 return cil_buffer_add(cilar);
 }
 
-/*:1282*//*1283:*/
-#line 15315 "./marpa.w"
+/*:1468*//*1469:*/
+#line 19043 "./marpa.w"
 
 PRIVATE_NOT_INLINE int
 cil_cmp(const void*ap,const void*bp,void*param UNUSED)
@@ -20913,8 +25284,8 @@ return item1> item2?1:-1;
 return 0;
 }
 
-/*:1283*//*1296:*/
-#line 15454 "./marpa.w"
+/*:1469*//*1482:*/
+#line 19183 "./marpa.w"
 
 PRIVATE void
 psar_safe(const PSAR psar)
@@ -20922,17 +25293,18 @@ psar_safe(const PSAR psar)
 psar->t_psl_length= 0;
 psar->t_first_psl= psar->t_first_free_psl= NULL;
 }
-/*:1296*//*1297:*/
-#line 15461 "./marpa.w"
+/*:1482*//*1483:*/
+#line 19190 "./marpa.w"
 
 PRIVATE void
-psar_init(const PSAR psar,int length)
+psar_init(const PSAR psar,int length,MARPA_ALLOCATOR allocator)
 {
 psar->t_psl_length= length;
+psar->t_allocator= *allocator;
 psar->t_first_psl= psar->t_first_free_psl= psl_new(psar);
 }
-/*:1297*//*1298:*/
-#line 15468 "./marpa.w"
+/*:1483*//*1484:*/
+#line 19198 "./marpa.w"
 
 PRIVATE void psar_destroy(const PSAR psar)
 {
@@ -20943,17 +25315,17 @@ PSL next_psl= psl->t_next;
 PSL*owner= psl->t_owner;
 if(owner)
 *owner= NULL;
-my_free(psl);
+marpa__a_free(&psar->t_allocator,psl);
 psl= next_psl;
 }
 }
-/*:1298*//*1299:*/
-#line 15482 "./marpa.w"
+/*:1484*//*1485:*/
+#line 19212 "./marpa.w"
 
 PRIVATE PSL psl_new(const PSAR psar)
 {
 int i;
-PSL new_psl= my_malloc(Sizeof_PSL(psar));
+PSL new_psl= marpa__a_malloc(&psar->t_allocator,Sizeof_PSL(psar));
 new_psl->t_next= NULL;
 new_psl->t_prev= NULL;
 new_psl->t_owner= NULL;
@@ -20962,8 +25334,8 @@ PSL_Datum(new_psl,i)= NULL;
 }
 return new_psl;
 }
-/*:1299*//*1302:*/
-#line 15513 "./marpa.w"
+/*:1485*//*1488:*/
+#line 19243 "./marpa.w"
 
 PRIVATE void psar_reset(const PSAR psar)
 {
@@ -20978,127 +25350,387 @@ psl= psl->t_next;
 psar_dealloc(psar);
 }
 
-/*:1302*//*1304:*/
-#line 15531 "./marpa.w"
+/*:1488*//*1489:*/
+#line 19264 "./marpa.w"
+
+PRIVATE void psar_clear(const PSAR psar)
+{
+PSL psl= psar->t_first_psl;
+while(psl){
+int i;
+for(i= 0;i<psar->t_psl_length;i++){
+PSL_Datum(psl,i)= NULL;
+}
+psl= psl->t_next;
+}
+psar_dealloc(psar);
+}
+
+/*:1489*//*1491:*/
+#line 19282 "./marpa.w"
+
+PRIVATE void psar_dealloc(const PSAR psar)
+{
+PSL psl= psar->t_first_psl;
+while(psl){
+PSL*owner= psl->t_owner;
+if(!owner)break;
+(*owner)= NULL;
+psl->t_owner= NULL;
+psl= psl->t_next;
+}
+psar->t_first_free_psl= psar->t_first_psl;
+}
+
+/*:1491*//*1493:*/
+#line 19302 "./marpa.w"
+
+PRIVATE void psl_claim(
+PSL*const psl_owner,const PSAR psar)
+{
+PSL new_psl= psl_alloc(psar);
+(*psl_owner)= new_psl;
+new_psl->t_owner= psl_owner;
+}
+
+
+/*:1493*//*1494:*/
+#line 19312 "./marpa.w"
+
+PRIVATE PSL psl_claim_by_es(
+PSAR or_psar,
+struct s_bocage_setup_per_ys*per_ys_data,
+YSID ysid)
+{
+PSL*psl_owner= &(per_ys_data[ysid].t_or_psl);
+if(!*psl_owner)
+psl_claim(psl_owner,or_psar);
+return*psl_owner;
+}
+
+/*:1494*//*1495:*/
+#line 19329 "./marpa.w"
+
+PRIVATE PSL psl_alloc(const PSAR psar)
+{
+PSL free_psl= psar->t_first_free_psl;
+PSL next_psl= free_psl->t_next;
+if(!next_psl){
+next_psl= free_psl->t_next= psl_new(psar);
+next_psl->t_prev= free_psl;
+}
+psar->t_first_free_psl= next_psl;
+return free_psl;
+}
+
+/*:1495*//*1524:*/
+#line 19566 "./marpa.w"
+
+PRIVATE_NOT_INLINE void
+set_error(GRAMMAR g,Marpa_Error_Code code,const char*message,unsigned int flags)
+{
+g->t_error= code;
+g->t_error_string= message;
+if(flags&FATAL_FLAG)
+g->t_is_ok= 0;
+}
+/*:1524*//*1525:*/
+#line 19585 "./marpa.w"
+
+PRIVATE Marpa_Error_Code
+clear_error(GRAMMAR g)
+{
+if(!IS_G_OK(g))
+{
+if(g->t_error==MARPA_ERR_NONE)
+g->t_error= MARPA_ERR_I_AM_NOT_OK;
+return g->t_error;
+}
+g->t_error= MARPA_ERR_NONE;
+g->t_error_string= NULL;
+return MARPA_ERR_NONE;
+}
+
+/*:1525*//*1529:*/
+#line 19628 "./marpa.w"
+
+PRIVATE_NOT_INLINE void*
+marpa__default_out_of_memory(void)
+{
+abort();
+return NULL;
+}
+void*(*const marpa__out_of_memory)(void)= marpa__default_out_of_memory;
+
+/*:1529*//*1532:*/
+#line 19658 "./marpa.w"
+
+size_t
+marpa_g_memory_usage(Marpa_Grammar g)
+{
+/*1501:*/
+#line 19384 "./marpa.w"
+
+const size_t failure_indicator= (size_t)-2;
+
+/*:1501*/
+#line 19662 "./marpa.w"
+
+/*1521:*/
+#line 19518 "./marpa.w"
+
+if(HEADER_VERSION_MISMATCH){
+MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
+return failure_indicator;
+}
+if(_MARPA_UNLIKELY(!IS_G_OK(g))){
+MARPA_ERROR(g->t_error);
+return failure_indicator;
+}
+
+/*:1521*/
+#line 19663 "./marpa.w"
+
+return marpa_obs_allocated(g->t_obs)
++marpa_obs_allocated(g->t_xrl_obs)
++marpa_obs_cache_allocated(Chunk_Cache_of_G(g))
++marpa_obs_allocated(g->t_cilar.t_obs)
++DSTACK_Bytes(g->t_cilar.t_buffer,int)
++DSTACK_Bytes(g->t_xsy_stack,XSY)
++DSTACK_Bytes(g->t_nsy_stack,NSY)
++DSTACK_Bytes(g->t_xrl_stack,XRL)
++DSTACK_Bytes(g->t_irl_stack,IRL)
++DSTACK_Bytes(g->t_events,GEV_Object)
++DSTACK_Bytes(g->t_gzwa_stack,GZWA)
++(size_t)AHM_Count_of_G(g)*sizeof(struct s_ahm);
+}
+
+/*:1532*//*1533:*/
+#line 19680 "./marpa.w"
+
+PRIVATE size_t
+recce_memory_usage(RECCE r)
+{
+YS_BATCH batch;
+size_t bytes= marpa_obs_allocated(r->t_obs)
++DSTACK_Bytes(r->t_irl_cil_stack,CIL)
++DSTACK_Bytes(r->t_alternatives,ALT_Object)
++DSTACK_Bytes(r->t_checkpoints,CHECKPOINT_Object)
++DSTACK_Bytes(r->t_yim_work_stack,YIM)
++DSTACK_Bytes(r->t_completion_stack,YIM)
++DSTACK_Bytes(r->t_earley_set_stack,YS);
+for(batch= r->t_first_ys_batch;batch;batch= batch->t_next)
+{
+bytes+= marpa_obs_allocated(batch->t_obs);
+}
+return bytes;
+}
+
+/*:1533*//*1534:*/
+#line 19699 "./marpa.w"
+
+size_t
+marpa_r_memory_usage(Marpa_Recognizer r)
+{
+/*1501:*/
+#line 19384 "./marpa.w"
+
+const size_t failure_indicator= (size_t)-2;
+
+/*:1501*/
+#line 19703 "./marpa.w"
+
+/*585:*/
+#line 6448 "./marpa.w"
+
+const GRAMMAR g= G_of_R(r);
+/*:585*/
+#line 19704 "./marpa.w"
+
+/*1521:*/
+#line 19518 "./marpa.w"
+
+if(HEADER_VERSION_MISMATCH){
+MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
+return failure_indicator;
+}
+if(_MARPA_UNLIKELY(!IS_G_OK(g))){
+MARPA_ERROR(g->t_error);
+return failure_indicator;
+}
+
+/*:1521*/
+#line 19705 "./marpa.w"
+
+return recce_memory_usage(r);
+}
+
+/*:1534*//*1535:*/
+#line 19709 "./marpa.w"
+
+PRIVATE size_t
+bocage_memory_usage(BOCAGE b)
+{
+return marpa_obs_allocated(OBS_of_B(b))
++(size_t)OR_Capacity_of_B(b)*sizeof(OR)
++(size_t)AND_Count_of_B(b)*sizeof(AND_Object);
+}
+
+/*:1535*//*1536:*/
+#line 19718 "./marpa.w"
 
-PRIVATE void psar_dealloc(const PSAR psar)
+size_t
+marpa_b_memory_usage(Marpa_Bocage b)
 {
-PSL psl= psar->t_first_psl;
-while(psl){
-PSL*owner= psl->t_owner;
-if(!owner)break;
-(*owner)= NULL;
-psl->t_owner= NULL;
-psl= psl->t_next;
+/*1501:*/
+#line 19384 "./marpa.w"
+
+const size_t failure_indicator= (size_t)-2;
+
+/*:1501*/
+#line 19722 "./marpa.w"
+
+/*1226:*/
+#line 15682 "./marpa.w"
+
+const GRAMMAR g UNUSED= G_of_B(b);
+
+/*:1226*/
+#line 19723 "./marpa.w"
+
+/*1521:*/
+#line 19518 "./marpa.w"
+
+if(HEADER_VERSION_MISMATCH){
+MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
+return failure_indicator;
 }
-psar->t_first_free_psl= psar->t_first_psl;
+if(_MARPA_UNLIKELY(!IS_G_OK(g))){
+MARPA_ERROR(g->t_error);
+return failure_indicator;
 }
 
-/*:1304*//*1306:*/
-#line 15551 "./marpa.w"
+/*:1521*/
+#line 19724 "./marpa.w"
 
-PRIVATE void psl_claim(
-PSL*const psl_owner,const PSAR psar)
-{
-PSL new_psl= psl_alloc(psar);
-(*psl_owner)= new_psl;
-new_psl->t_owner= psl_owner;
+return bocage_memory_usage(b);
 }
 
+/*:1536*//*1540:*/
+#line 19756 "./marpa.w"
 
-/*:1306*//*1307:*/
-#line 15561 "./marpa.w"
-
-PRIVATE PSL psl_claim_by_es(
-PSAR or_psar,
-struct s_bocage_setup_per_ys*per_ys_data,
-YSID ysid)
+size_t
+marpa_r_memory_limit(Marpa_Recognizer r)
 {
-PSL*psl_owner= &(per_ys_data[ysid].t_or_psl);
-if(!*psl_owner)
-psl_claim(psl_owner,or_psar);
-return*psl_owner;
-}
+/*1501:*/
+#line 19384 "./marpa.w"
 
-/*:1307*//*1308:*/
-#line 15578 "./marpa.w"
+const size_t failure_indicator= (size_t)-2;
 
-PRIVATE PSL psl_alloc(const PSAR psar)
-{
-PSL free_psl= psar->t_first_free_psl;
-PSL next_psl= free_psl->t_next;
-if(!next_psl){
-next_psl= free_psl->t_next= psl_new(psar);
-next_psl->t_prev= free_psl;
+/*:1501*/
+#line 19760 "./marpa.w"
+
+/*585:*/
+#line 6448 "./marpa.w"
+
+const GRAMMAR g= G_of_R(r);
+/*:585*/
+#line 19761 "./marpa.w"
+
+/*1521:*/
+#line 19518 "./marpa.w"
+
+if(HEADER_VERSION_MISMATCH){
+MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
+return failure_indicator;
 }
-psar->t_first_free_psl= next_psl;
-return free_psl;
+if(_MARPA_UNLIKELY(!IS_G_OK(g))){
+MARPA_ERROR(g->t_error);
+return failure_indicator;
 }
 
-/*:1308*//*1336:*/
-#line 15810 "./marpa.w"
+/*:1521*/
+#line 19762 "./marpa.w"
 
-PRIVATE_NOT_INLINE void
-set_error(GRAMMAR g,Marpa_Error_Code code,const char*message,unsigned int flags)
-{
-g->t_error= code;
-g->t_error_string= message;
-if(flags&FATAL_FLAG)
-g->t_is_ok= 0;
+return Memory_Limit_of_R(r);
 }
-/*:1336*//*1337:*/
-#line 15829 "./marpa.w"
 
-PRIVATE Marpa_Error_Code
-clear_error(GRAMMAR g)
-{
-if(!IS_G_OK(g))
+/*:1540*//*1541:*/
+#line 19767 "./marpa.w"
+
+size_t
+marpa_r_memory_limit_set(Marpa_Recognizer r,size_t limit)
 {
-if(g->t_error==MARPA_ERR_NONE)
-g->t_error= MARPA_ERR_I_AM_NOT_OK;
-return g->t_error;
+/*1501:*/
+#line 19384 "./marpa.w"
+
+const size_t failure_indicator= (size_t)-2;
+
+/*:1501*/
+#line 19771 "./marpa.w"
+
+/*585:*/
+#line 6448 "./marpa.w"
+
+const GRAMMAR g= G_of_R(r);
+/*:585*/
+#line 19772 "./marpa.w"
+
+/*1521:*/
+#line 19518 "./marpa.w"
+
+if(HEADER_VERSION_MISMATCH){
+MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
+return failure_indicator;
 }
-g->t_error= MARPA_ERR_NONE;
-g->t_error_string= NULL;
-return MARPA_ERR_NONE;
+if(_MARPA_UNLIKELY(!IS_G_OK(g))){
+MARPA_ERROR(g->t_error);
+return failure_indicator;
 }
 
-/*:1337*//*1341:*/
-#line 15872 "./marpa.w"
+/*:1521*/
+#line 19773 "./marpa.w"
 
-PRIVATE_NOT_INLINE void*
-marpa__default_out_of_memory(void)
+Memory_Limit_of_R(r)= limit;
+return limit;
+}
+
+/*:1541*//*1542:*/
+#line 19781 "./marpa.w"
+
+PRIVATE int
+memory_limit_is_exceeded(RECCE r,size_t extra)
 {
-abort();
-return NULL;
+const size_t limit= Memory_Limit_of_R(r);
+if(limit==0)
+return 0;
+return recce_memory_usage(r)+extra> limit;
 }
-void*(*const marpa__out_of_memory)(void)= marpa__default_out_of_memory;
 
-/*:1341*//*1346:*/
-#line 15910 "./marpa.w"
+/*:1542*//*1548:*/
+#line 19894 "./marpa.w"
 
 Marpa_Earley_Set_ID _marpa_r_trace_earley_set(Marpa_Recognizer r)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 19897 "./marpa.w"
 
-/*:1313*/
-#line 15913 "./marpa.w"
-
-/*563:*/
-#line 6125 "./marpa.w"
+/*585:*/
+#line 6448 "./marpa.w"
 
 const GRAMMAR g= G_of_R(r);
-/*:563*/
-#line 15914 "./marpa.w"
+/*:585*/
+#line 19898 "./marpa.w"
 
 YS trace_earley_set= r->t_trace_earley_set;
-/*1332:*/
-#line 15754 "./marpa.w"
+/*1520:*/
+#line 19510 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -21109,22 +25741,22 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 15755 "./marpa.w"
+/*:1521*/
+#line 19511 "./marpa.w"
 
-/*1330:*/
-#line 15738 "./marpa.w"
+/*1518:*/
+#line 19494 "./marpa.w"
 
 if(_MARPA_UNLIKELY(Input_Phase_of_R(r)==R_BEFORE_INPUT)){
 MARPA_ERROR(MARPA_ERR_RECCE_NOT_STARTED);
 return failure_indicator;
 }
-/*:1330*/
-#line 15756 "./marpa.w"
+/*:1518*/
+#line 19512 "./marpa.w"
 
 
-/*:1332*/
-#line 15916 "./marpa.w"
+/*:1520*/
+#line 19900 "./marpa.w"
 
 if(!trace_earley_set){
 MARPA_ERROR(MARPA_ERR_NO_TRACE_YS);
@@ -21133,30 +25765,29 @@ return failure_indicator;
 return Ord_of_YS(trace_earley_set);
 }
 
-/*:1346*//*1347:*/
-#line 15924 "./marpa.w"
+/*:1548*//*1549:*/
+#line 19908 "./marpa.w"
 
 Marpa_Earley_Set_ID marpa_r_latest_earley_set(Marpa_Recognizer r)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 19911 "./marpa.w"
 
-/*:1313*/
-#line 15927 "./marpa.w"
-
-/*563:*/
-#line 6125 "./marpa.w"
+/*585:*/
+#line 6448 "./marpa.w"
 
 const GRAMMAR g= G_of_R(r);
-/*:563*/
-#line 15928 "./marpa.w"
+/*:585*/
+#line 19912 "./marpa.w"
 
-/*1332:*/
-#line 15754 "./marpa.w"
+/*1520:*/
+#line 19510 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -21167,59 +25798,58 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 15755 "./marpa.w"
+/*:1521*/
+#line 19511 "./marpa.w"
 
-/*1330:*/
-#line 15738 "./marpa.w"
+/*1518:*/
+#line 19494 "./marpa.w"
 
 if(_MARPA_UNLIKELY(Input_Phase_of_R(r)==R_BEFORE_INPUT)){
 MARPA_ERROR(MARPA_ERR_RECCE_NOT_STARTED);
 return failure_indicator;
 }
-/*:1330*/
-#line 15756 "./marpa.w"
+/*:1518*/
+#line 19512 "./marpa.w"
 
 
-/*:1332*/
-#line 15929 "./marpa.w"
+/*:1520*/
+#line 19913 "./marpa.w"
 
 if(G_is_Trivial(g))return 0;
 return Ord_of_YS(Latest_YS_of_R(r));
 }
 
-/*:1347*//*1348:*/
-#line 15934 "./marpa.w"
+/*:1549*//*1550:*/
+#line 19918 "./marpa.w"
 
 Marpa_Earleme marpa_r_earleme(Marpa_Recognizer r,Marpa_Earley_Set_ID set_id)
 {
-/*563:*/
-#line 6125 "./marpa.w"
+/*585:*/
+#line 6448 "./marpa.w"
 
 const GRAMMAR g= G_of_R(r);
-/*:563*/
-#line 15937 "./marpa.w"
+/*:585*/
+#line 19921 "./marpa.w"
 
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
-
-/*:1313*/
-#line 15938 "./marpa.w"
+/*:1500*/
+#line 19922 "./marpa.w"
 
 YS earley_set;
-/*1330:*/
-#line 15738 "./marpa.w"
+/*1518:*/
+#line 19494 "./marpa.w"
 
 if(_MARPA_UNLIKELY(Input_Phase_of_R(r)==R_BEFORE_INPUT)){
 MARPA_ERROR(MARPA_ERR_RECCE_NOT_STARTED);
 return failure_indicator;
 }
-/*:1330*/
-#line 15940 "./marpa.w"
+/*:1518*/
+#line 19924 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -21230,8 +25860,8 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 15941 "./marpa.w"
+/*:1521*/
+#line 19925 "./marpa.w"
 
 if(set_id<0){
 MARPA_ERROR(MARPA_ERR_INVALID_LOCATION);
@@ -21243,42 +25873,46 @@ if(!YS_Ord_is_Valid(r,set_id))
 MARPA_ERROR(MARPA_ERR_NO_EARLEY_SET_AT_LOCATION);
 return failure_indicator;
 }
-earley_set= YS_of_R_by_Ord(r,set_id);
+earley_set= ys_of_r_by_ord(r,set_id);
+if(_MARPA_UNLIKELY(!earley_set))
+{
+MARPA_ERROR(MARPA_ERR_EARLEY_SET_FORGOTTEN);
+return failure_indicator;
+}
 return Earleme_of_YS(earley_set);
 }
 
-/*:1348*//*1350:*/
-#line 15959 "./marpa.w"
+/*:1550*//*1552:*/
+#line 19948 "./marpa.w"
 
 int _marpa_r_earley_set_size(Marpa_Recognizer r,Marpa_Earley_Set_ID set_id)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
-
-/*:1313*/
-#line 15962 "./marpa.w"
+/*:1500*/
+#line 19951 "./marpa.w"
 
 YS earley_set;
-/*563:*/
-#line 6125 "./marpa.w"
+/*585:*/
+#line 6448 "./marpa.w"
 
 const GRAMMAR g= G_of_R(r);
-/*:563*/
-#line 15964 "./marpa.w"
+/*:585*/
+#line 19953 "./marpa.w"
 
-/*1330:*/
-#line 15738 "./marpa.w"
+/*1518:*/
+#line 19494 "./marpa.w"
 
 if(_MARPA_UNLIKELY(Input_Phase_of_R(r)==R_BEFORE_INPUT)){
 MARPA_ERROR(MARPA_ERR_RECCE_NOT_STARTED);
 return failure_indicator;
 }
-/*:1330*/
-#line 15965 "./marpa.w"
+/*:1518*/
+#line 19954 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -21289,8 +25923,8 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 15966 "./marpa.w"
+/*:1521*/
+#line 19955 "./marpa.w"
 
 r_update_earley_sets(r);
 if(!YS_Ord_is_Valid(r,set_id))
@@ -21298,37 +25932,41 @@ if(!YS_Ord_is_Valid(r,set_id))
 MARPA_ERROR(MARPA_ERR_INVALID_LOCATION);
 return failure_indicator;
 }
-earley_set= YS_of_R_by_Ord(r,set_id);
+earley_set= ys_of_r_by_ord(r,set_id);
+if(_MARPA_UNLIKELY(!earley_set))
+{
+MARPA_ERROR(MARPA_ERR_EARLEY_SET_FORGOTTEN);
+return failure_indicator;
+}
 return YIM_Count_of_YS(earley_set);
 }
 
-/*:1350*//*1355:*/
-#line 16008 "./marpa.w"
+/*:1552*//*1557:*/
+#line 20002 "./marpa.w"
 
 Marpa_Earleme
 _marpa_r_earley_set_trace(Marpa_Recognizer r,Marpa_Earley_Set_ID set_id)
 {
 YS earley_set;
 const int es_does_not_exist= -1;
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 20008 "./marpa.w"
 
-/*:1313*/
-#line 16014 "./marpa.w"
-
-/*563:*/
-#line 6125 "./marpa.w"
+/*585:*/
+#line 6448 "./marpa.w"
 
 const GRAMMAR g= G_of_R(r);
-/*:563*/
-#line 16015 "./marpa.w"
+/*:585*/
+#line 20009 "./marpa.w"
 
-/*1332:*/
-#line 15754 "./marpa.w"
+/*1520:*/
+#line 19510 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -21339,22 +25977,22 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 15755 "./marpa.w"
+/*:1521*/
+#line 19511 "./marpa.w"
 
-/*1330:*/
-#line 15738 "./marpa.w"
+/*1518:*/
+#line 19494 "./marpa.w"
 
 if(_MARPA_UNLIKELY(Input_Phase_of_R(r)==R_BEFORE_INPUT)){
 MARPA_ERROR(MARPA_ERR_RECCE_NOT_STARTED);
 return failure_indicator;
 }
-/*:1330*/
-#line 15756 "./marpa.w"
+/*:1518*/
+#line 19512 "./marpa.w"
 
 
-/*:1332*/
-#line 16016 "./marpa.w"
+/*:1520*/
+#line 20010 "./marpa.w"
 
 if(r->t_trace_earley_set&&Ord_of_YS(r->t_trace_earley_set)==set_id)
 {
@@ -21362,24 +26000,24 @@ if(r->t_trace_earley_set&&Ord_of_YS(r->t_trace_earley_set)==set_id)
 
 return Earleme_of_YS(r->t_trace_earley_set);
 }
-/*1356:*/
-#line 16039 "./marpa.w"
+/*1558:*/
+#line 20038 "./marpa.w"
 {
 r->t_trace_earley_set= NULL;
 trace_earley_item_clear(r);
-/*1368:*/
-#line 16228 "./marpa.w"
+/*1570:*/
+#line 20227 "./marpa.w"
 
 r->t_trace_pim_nsy_p= NULL;
 r->t_trace_postdot_item= NULL;
 
-/*:1368*/
-#line 16042 "./marpa.w"
+/*:1570*/
+#line 20041 "./marpa.w"
 
 }
 
-/*:1356*/
-#line 16023 "./marpa.w"
+/*:1558*/
+#line 20017 "./marpa.w"
 
 if(set_id<0)
 {
@@ -21387,44 +26025,48 @@ MARPA_ERROR(MARPA_ERR_INVALID_LOCATION);
 return failure_indicator;
 }
 r_update_earley_sets(r);
-if(set_id>=MARPA_DSTACK_LENGTH(r->t_earley_set_stack))
+if(!YS_Ord_is_Valid(r,set_id))
 {
 return es_does_not_exist;
 }
-earley_set= YS_of_R_by_Ord(r,set_id);
+earley_set= ys_of_r_by_ord(r,set_id);
+if(_MARPA_UNLIKELY(!earley_set))
+{
+MARPA_ERROR(MARPA_ERR_EARLEY_SET_FORGOTTEN);
+return failure_indicator;
+}
 r->t_trace_earley_set= earley_set;
 return Earleme_of_YS(earley_set);
 }
 
-/*:1355*//*1357:*/
-#line 16045 "./marpa.w"
+/*:1557*//*1559:*/
+#line 20044 "./marpa.w"
 
 Marpa_AHM_ID
 _marpa_r_earley_item_trace(Marpa_Recognizer r,Marpa_Earley_Item_ID item_id)
 {
 const int yim_does_not_exist= -1;
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
-
-/*:1313*/
-#line 16050 "./marpa.w"
+/*:1500*/
+#line 20049 "./marpa.w"
 
 YS trace_earley_set;
 YIM earley_item;
 YIM*earley_items;
-/*563:*/
-#line 6125 "./marpa.w"
+/*585:*/
+#line 6448 "./marpa.w"
 
 const GRAMMAR g= G_of_R(r);
-/*:563*/
-#line 16054 "./marpa.w"
+/*:585*/
+#line 20053 "./marpa.w"
 
-/*1332:*/
-#line 15754 "./marpa.w"
+/*1520:*/
+#line 19510 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -21435,44 +26077,44 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 15755 "./marpa.w"
+/*:1521*/
+#line 19511 "./marpa.w"
 
-/*1330:*/
-#line 15738 "./marpa.w"
+/*1518:*/
+#line 19494 "./marpa.w"
 
 if(_MARPA_UNLIKELY(Input_Phase_of_R(r)==R_BEFORE_INPUT)){
 MARPA_ERROR(MARPA_ERR_RECCE_NOT_STARTED);
 return failure_indicator;
 }
-/*:1330*/
-#line 15756 "./marpa.w"
+/*:1518*/
+#line 19512 "./marpa.w"
 
 
-/*:1332*/
-#line 16055 "./marpa.w"
+/*:1520*/
+#line 20054 "./marpa.w"
 
 trace_earley_set= r->t_trace_earley_set;
 if(!trace_earley_set)
 {
-/*1356:*/
-#line 16039 "./marpa.w"
+/*1558:*/
+#line 20038 "./marpa.w"
 {
 r->t_trace_earley_set= NULL;
 trace_earley_item_clear(r);
-/*1368:*/
-#line 16228 "./marpa.w"
+/*1570:*/
+#line 20227 "./marpa.w"
 
 r->t_trace_pim_nsy_p= NULL;
 r->t_trace_postdot_item= NULL;
 
-/*:1368*/
-#line 16042 "./marpa.w"
+/*:1570*/
+#line 20041 "./marpa.w"
 
 }
 
-/*:1356*/
-#line 16059 "./marpa.w"
+/*:1558*/
+#line 20058 "./marpa.w"
 
 MARPA_ERROR(MARPA_ERR_NO_TRACE_YS);
 return failure_indicator;
@@ -21493,47 +26135,46 @@ r->t_trace_earley_item= earley_item;
 return AHMID_of_YIM(earley_item);
 }
 
-/*:1357*//*1359:*/
-#line 16088 "./marpa.w"
+/*:1559*//*1561:*/
+#line 20087 "./marpa.w"
 
 PRIVATE void trace_earley_item_clear(RECCE r)
 {
-/*1358:*/
-#line 16085 "./marpa.w"
+/*1560:*/
+#line 20084 "./marpa.w"
 
 r->t_trace_earley_item= NULL;
 
-/*:1358*/
-#line 16091 "./marpa.w"
+/*:1560*/
+#line 20090 "./marpa.w"
 
 trace_source_link_clear(r);
 }
 
-/*:1359*//*1360:*/
-#line 16095 "./marpa.w"
+/*:1561*//*1562:*/
+#line 20094 "./marpa.w"
 
 Marpa_Earley_Set_ID _marpa_r_earley_item_origin(Marpa_Recognizer r)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
-
-/*:1313*/
-#line 16098 "./marpa.w"
+/*:1500*/
+#line 20097 "./marpa.w"
 
 YIM item= r->t_trace_earley_item;
-/*563:*/
-#line 6125 "./marpa.w"
+/*585:*/
+#line 6448 "./marpa.w"
 
 const GRAMMAR g= G_of_R(r);
-/*:563*/
-#line 16100 "./marpa.w"
+/*:585*/
+#line 20099 "./marpa.w"
 
-/*1332:*/
-#line 15754 "./marpa.w"
+/*1520:*/
+#line 19510 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -21544,31 +26185,31 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 15755 "./marpa.w"
+/*:1521*/
+#line 19511 "./marpa.w"
 
-/*1330:*/
-#line 15738 "./marpa.w"
+/*1518:*/
+#line 19494 "./marpa.w"
 
 if(_MARPA_UNLIKELY(Input_Phase_of_R(r)==R_BEFORE_INPUT)){
 MARPA_ERROR(MARPA_ERR_RECCE_NOT_STARTED);
 return failure_indicator;
 }
-/*:1330*/
-#line 15756 "./marpa.w"
+/*:1518*/
+#line 19512 "./marpa.w"
 
 
-/*:1332*/
-#line 16101 "./marpa.w"
+/*:1520*/
+#line 20100 "./marpa.w"
 
 if(!item){
-/*1358:*/
-#line 16085 "./marpa.w"
+/*1560:*/
+#line 20084 "./marpa.w"
 
 r->t_trace_earley_item= NULL;
 
-/*:1358*/
-#line 16103 "./marpa.w"
+/*:1560*/
+#line 20102 "./marpa.w"
 
 MARPA_ERROR(MARPA_ERR_NO_TRACE_YIM);
 return failure_indicator;
@@ -21576,33 +26217,32 @@ return failure_indicator;
 return Origin_Ord_of_YIM(item);
 }
 
-/*:1360*//*1362:*/
-#line 16115 "./marpa.w"
+/*:1562*//*1564:*/
+#line 20114 "./marpa.w"
 
 Marpa_Symbol_ID _marpa_r_leo_predecessor_symbol(Marpa_Recognizer r)
 {
 const Marpa_Symbol_ID no_predecessor= -1;
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
-
-/*:1313*/
-#line 16119 "./marpa.w"
+/*:1500*/
+#line 20118 "./marpa.w"
 
 PIM postdot_item= r->t_trace_postdot_item;
 LIM predecessor_leo_item;
-/*563:*/
-#line 6125 "./marpa.w"
+/*585:*/
+#line 6448 "./marpa.w"
 
 const GRAMMAR g= G_of_R(r);
-/*:563*/
-#line 16122 "./marpa.w"
+/*:585*/
+#line 20121 "./marpa.w"
 
-/*1332:*/
-#line 15754 "./marpa.w"
+/*1520:*/
+#line 19510 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -21613,22 +26253,22 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 15755 "./marpa.w"
+/*:1521*/
+#line 19511 "./marpa.w"
 
-/*1330:*/
-#line 15738 "./marpa.w"
+/*1518:*/
+#line 19494 "./marpa.w"
 
 if(_MARPA_UNLIKELY(Input_Phase_of_R(r)==R_BEFORE_INPUT)){
 MARPA_ERROR(MARPA_ERR_RECCE_NOT_STARTED);
 return failure_indicator;
 }
-/*:1330*/
-#line 15756 "./marpa.w"
+/*:1518*/
+#line 19512 "./marpa.w"
 
 
-/*:1332*/
-#line 16123 "./marpa.w"
+/*:1520*/
+#line 20122 "./marpa.w"
 
 if(!postdot_item){
 MARPA_ERROR(MARPA_ERR_NO_TRACE_PIM);
@@ -21643,33 +26283,32 @@ if(!predecessor_leo_item)return no_predecessor;
 return Postdot_NSYID_of_LIM(predecessor_leo_item);
 }
 
-/*:1362*//*1363:*/
-#line 16137 "./marpa.w"
+/*:1564*//*1565:*/
+#line 20136 "./marpa.w"
 
 Marpa_Earley_Set_ID _marpa_r_leo_base_origin(Marpa_Recognizer r)
 {
 const JEARLEME pim_is_not_a_leo_item= -1;
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
-
-/*:1313*/
-#line 16141 "./marpa.w"
+/*:1500*/
+#line 20140 "./marpa.w"
 
 PIM postdot_item= r->t_trace_postdot_item;
-/*563:*/
-#line 6125 "./marpa.w"
+/*585:*/
+#line 6448 "./marpa.w"
 
 const GRAMMAR g= G_of_R(r);
-/*:563*/
-#line 16143 "./marpa.w"
+/*:585*/
+#line 20142 "./marpa.w"
 
 YIM base_earley_item;
-/*1332:*/
-#line 15754 "./marpa.w"
+/*1520:*/
+#line 19510 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -21680,22 +26319,22 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 15755 "./marpa.w"
+/*:1521*/
+#line 19511 "./marpa.w"
 
-/*1330:*/
-#line 15738 "./marpa.w"
+/*1518:*/
+#line 19494 "./marpa.w"
 
 if(_MARPA_UNLIKELY(Input_Phase_of_R(r)==R_BEFORE_INPUT)){
 MARPA_ERROR(MARPA_ERR_RECCE_NOT_STARTED);
 return failure_indicator;
 }
-/*:1330*/
-#line 15756 "./marpa.w"
+/*:1518*/
+#line 19512 "./marpa.w"
 
 
-/*:1332*/
-#line 16145 "./marpa.w"
+/*:1520*/
+#line 20144 "./marpa.w"
 
 if(!postdot_item){
 MARPA_ERROR(MARPA_ERR_NO_TRACE_PIM);
@@ -21706,33 +26345,32 @@ base_earley_item= Trailhead_YIM_of_LIM(LIM_of_PIM(postdot_item));
 return Origin_Ord_of_YIM(base_earley_item);
 }
 
-/*:1363*//*1364:*/
-#line 16156 "./marpa.w"
+/*:1565*//*1566:*/
+#line 20155 "./marpa.w"
 
 Marpa_AHM_ID _marpa_r_leo_base_state(Marpa_Recognizer r)
 {
 const JEARLEME pim_is_not_a_leo_item= -1;
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
-
-/*:1313*/
-#line 16160 "./marpa.w"
+/*:1500*/
+#line 20159 "./marpa.w"
 
 PIM postdot_item= r->t_trace_postdot_item;
 YIM base_earley_item;
-/*563:*/
-#line 6125 "./marpa.w"
+/*585:*/
+#line 6448 "./marpa.w"
 
 const GRAMMAR g= G_of_R(r);
-/*:563*/
-#line 16163 "./marpa.w"
+/*:585*/
+#line 20162 "./marpa.w"
 
-/*1332:*/
-#line 15754 "./marpa.w"
+/*1520:*/
+#line 19510 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -21743,22 +26381,22 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 15755 "./marpa.w"
+/*:1521*/
+#line 19511 "./marpa.w"
 
-/*1330:*/
-#line 15738 "./marpa.w"
+/*1518:*/
+#line 19494 "./marpa.w"
 
 if(_MARPA_UNLIKELY(Input_Phase_of_R(r)==R_BEFORE_INPUT)){
 MARPA_ERROR(MARPA_ERR_RECCE_NOT_STARTED);
 return failure_indicator;
 }
-/*:1330*/
-#line 15756 "./marpa.w"
+/*:1518*/
+#line 19512 "./marpa.w"
 
 
-/*:1332*/
-#line 16164 "./marpa.w"
+/*:1520*/
+#line 20163 "./marpa.w"
 
 if(!postdot_item){
 MARPA_ERROR(MARPA_ERR_NO_TRACE_PIM);
@@ -21769,44 +26407,43 @@ base_earley_item= Trailhead_YIM_of_LIM(LIM_of_PIM(postdot_item));
 return AHMID_of_YIM(base_earley_item);
 }
 
-/*:1364*//*1367:*/
-#line 16202 "./marpa.w"
+/*:1566*//*1569:*/
+#line 20201 "./marpa.w"
 
 Marpa_Symbol_ID
 _marpa_r_postdot_symbol_trace(Marpa_Recognizer r,
 Marpa_Symbol_ID nsy_id)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
-
-/*:1313*/
-#line 16207 "./marpa.w"
+/*:1500*/
+#line 20206 "./marpa.w"
 
 YS current_ys= r->t_trace_earley_set;
 PIM*pim_nsy_p;
 PIM pim;
-/*563:*/
-#line 6125 "./marpa.w"
+/*585:*/
+#line 6448 "./marpa.w"
 
 const GRAMMAR g= G_of_R(r);
-/*:563*/
-#line 16211 "./marpa.w"
+/*:585*/
+#line 20210 "./marpa.w"
 
-/*1368:*/
-#line 16228 "./marpa.w"
+/*1570:*/
+#line 20227 "./marpa.w"
 
 r->t_trace_pim_nsy_p= NULL;
 r->t_trace_postdot_item= NULL;
 
-/*:1368*/
-#line 16212 "./marpa.w"
+/*:1570*/
+#line 20211 "./marpa.w"
 
-/*1332:*/
-#line 15754 "./marpa.w"
+/*1520:*/
+#line 19510 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -21817,43 +26454,43 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 15755 "./marpa.w"
+/*:1521*/
+#line 19511 "./marpa.w"
 
-/*1330:*/
-#line 15738 "./marpa.w"
+/*1518:*/
+#line 19494 "./marpa.w"
 
 if(_MARPA_UNLIKELY(Input_Phase_of_R(r)==R_BEFORE_INPUT)){
 MARPA_ERROR(MARPA_ERR_RECCE_NOT_STARTED);
 return failure_indicator;
 }
-/*:1330*/
-#line 15756 "./marpa.w"
+/*:1518*/
+#line 19512 "./marpa.w"
 
 
-/*:1332*/
-#line 16213 "./marpa.w"
+/*:1520*/
+#line 20212 "./marpa.w"
 
-/*1320:*/
-#line 15668 "./marpa.w"
+/*1508:*/
+#line 19424 "./marpa.w"
 
 if(_MARPA_UNLIKELY(NSYID_is_Malformed(nsy_id))){
 MARPA_ERROR(MARPA_ERR_INVALID_SYMBOL_ID);
 return failure_indicator;
 }
-/*:1320*/
-#line 16214 "./marpa.w"
+/*:1508*/
+#line 20213 "./marpa.w"
 
-/*1321:*/
-#line 15675 "./marpa.w"
+/*1509:*/
+#line 19431 "./marpa.w"
 
 if(_MARPA_UNLIKELY(!NSYID_of_G_Exists(nsy_id))){
 MARPA_ERROR(MARPA_ERR_NO_SUCH_SYMBOL_ID);
 return-1;
 }
 
-/*:1321*/
-#line 16215 "./marpa.w"
+/*:1509*/
+#line 20214 "./marpa.w"
 
 if(!current_ys){
 MARPA_ERROR(MARPA_ERR_NO_TRACE_YS);
@@ -21867,43 +26504,42 @@ r->t_trace_postdot_item= pim;
 return nsy_id;
 }
 
-/*:1367*//*1369:*/
-#line 16238 "./marpa.w"
+/*:1569*//*1571:*/
+#line 20237 "./marpa.w"
 
 Marpa_Symbol_ID
 _marpa_r_first_postdot_item_trace(Marpa_Recognizer r)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
-
-/*:1313*/
-#line 16242 "./marpa.w"
+/*:1500*/
+#line 20241 "./marpa.w"
 
 YS current_earley_set= r->t_trace_earley_set;
 PIM pim;
-/*563:*/
-#line 6125 "./marpa.w"
+/*585:*/
+#line 6448 "./marpa.w"
 
 const GRAMMAR g= G_of_R(r);
-/*:563*/
-#line 16245 "./marpa.w"
+/*:585*/
+#line 20244 "./marpa.w"
 
 PIM*pim_nsy_p;
-/*1368:*/
-#line 16228 "./marpa.w"
+/*1570:*/
+#line 20227 "./marpa.w"
 
 r->t_trace_pim_nsy_p= NULL;
 r->t_trace_postdot_item= NULL;
 
-/*:1368*/
-#line 16247 "./marpa.w"
+/*:1570*/
+#line 20246 "./marpa.w"
 
-/*1332:*/
-#line 15754 "./marpa.w"
+/*1520:*/
+#line 19510 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -21914,31 +26550,31 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 15755 "./marpa.w"
+/*:1521*/
+#line 19511 "./marpa.w"
 
-/*1330:*/
-#line 15738 "./marpa.w"
+/*1518:*/
+#line 19494 "./marpa.w"
 
 if(_MARPA_UNLIKELY(Input_Phase_of_R(r)==R_BEFORE_INPUT)){
 MARPA_ERROR(MARPA_ERR_RECCE_NOT_STARTED);
 return failure_indicator;
 }
-/*:1330*/
-#line 15756 "./marpa.w"
+/*:1518*/
+#line 19512 "./marpa.w"
 
 
-/*:1332*/
-#line 16248 "./marpa.w"
+/*:1520*/
+#line 20247 "./marpa.w"
 
 if(!current_earley_set){
-/*1358:*/
-#line 16085 "./marpa.w"
+/*1560:*/
+#line 20084 "./marpa.w"
 
 r->t_trace_earley_item= NULL;
 
-/*:1358*/
-#line 16250 "./marpa.w"
+/*:1560*/
+#line 20249 "./marpa.w"
 
 MARPA_ERROR(MARPA_ERR_NO_TRACE_YS);
 return failure_indicator;
@@ -21951,51 +26587,50 @@ r->t_trace_postdot_item= pim;
 return Postdot_NSYID_of_PIM(pim);
 }
 
-/*:1369*//*1370:*/
-#line 16269 "./marpa.w"
+/*:1571*//*1572:*/
+#line 20268 "./marpa.w"
 
 Marpa_Symbol_ID
 _marpa_r_next_postdot_item_trace(Marpa_Recognizer r)
 {
 const XSYID no_more_postdot_symbols= -1;
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
-
-/*:1313*/
-#line 16274 "./marpa.w"
+/*:1500*/
+#line 20273 "./marpa.w"
 
 YS current_set= r->t_trace_earley_set;
 PIM pim;
 PIM*pim_nsy_p;
-/*563:*/
-#line 6125 "./marpa.w"
+/*585:*/
+#line 6448 "./marpa.w"
 
 const GRAMMAR g= G_of_R(r);
-/*:563*/
-#line 16278 "./marpa.w"
+/*:585*/
+#line 20277 "./marpa.w"
 
 
 pim_nsy_p= r->t_trace_pim_nsy_p;
 pim= r->t_trace_postdot_item;
-/*1368:*/
-#line 16228 "./marpa.w"
+/*1570:*/
+#line 20227 "./marpa.w"
 
 r->t_trace_pim_nsy_p= NULL;
 r->t_trace_postdot_item= NULL;
 
-/*:1368*/
-#line 16282 "./marpa.w"
+/*:1570*/
+#line 20281 "./marpa.w"
 
 if(!pim_nsy_p||!pim){
 MARPA_ERROR(MARPA_ERR_NO_TRACE_PIM);
 return failure_indicator;
 }
-/*1332:*/
-#line 15754 "./marpa.w"
+/*1520:*/
+#line 19510 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -22006,22 +26641,22 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 15755 "./marpa.w"
+/*:1521*/
+#line 19511 "./marpa.w"
 
-/*1330:*/
-#line 15738 "./marpa.w"
+/*1518:*/
+#line 19494 "./marpa.w"
 
 if(_MARPA_UNLIKELY(Input_Phase_of_R(r)==R_BEFORE_INPUT)){
 MARPA_ERROR(MARPA_ERR_RECCE_NOT_STARTED);
 return failure_indicator;
 }
-/*:1330*/
-#line 15756 "./marpa.w"
+/*:1518*/
+#line 19512 "./marpa.w"
 
 
-/*:1332*/
-#line 16287 "./marpa.w"
+/*:1520*/
+#line 20286 "./marpa.w"
 
 if(!current_set){
 MARPA_ERROR(MARPA_ERR_NO_TRACE_YS);
@@ -22042,31 +26677,30 @@ r->t_trace_postdot_item= pim;
 return Postdot_NSYID_of_PIM(pim);
 }
 
-/*:1370*//*1371:*/
-#line 16307 "./marpa.w"
+/*:1572*//*1573:*/
+#line 20306 "./marpa.w"
 
 Marpa_Symbol_ID _marpa_r_postdot_item_symbol(Marpa_Recognizer r)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
-
-/*:1313*/
-#line 16310 "./marpa.w"
+/*:1500*/
+#line 20309 "./marpa.w"
 
 PIM postdot_item= r->t_trace_postdot_item;
-/*563:*/
-#line 6125 "./marpa.w"
+/*585:*/
+#line 6448 "./marpa.w"
 
 const GRAMMAR g= G_of_R(r);
-/*:563*/
-#line 16312 "./marpa.w"
+/*:585*/
+#line 20311 "./marpa.w"
 
-/*1332:*/
-#line 15754 "./marpa.w"
+/*1520:*/
+#line 19510 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -22077,22 +26711,22 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 15755 "./marpa.w"
+/*:1521*/
+#line 19511 "./marpa.w"
 
-/*1330:*/
-#line 15738 "./marpa.w"
+/*1518:*/
+#line 19494 "./marpa.w"
 
 if(_MARPA_UNLIKELY(Input_Phase_of_R(r)==R_BEFORE_INPUT)){
 MARPA_ERROR(MARPA_ERR_RECCE_NOT_STARTED);
 return failure_indicator;
 }
-/*:1330*/
-#line 15756 "./marpa.w"
+/*:1518*/
+#line 19512 "./marpa.w"
 
 
-/*:1332*/
-#line 16313 "./marpa.w"
+/*:1520*/
+#line 20312 "./marpa.w"
 
 if(!postdot_item){
 MARPA_ERROR(MARPA_ERR_NO_TRACE_PIM);
@@ -22101,33 +26735,32 @@ return failure_indicator;
 return Postdot_NSYID_of_PIM(postdot_item);
 }
 
-/*:1371*//*1376:*/
-#line 16343 "./marpa.w"
+/*:1573*//*1578:*/
+#line 20342 "./marpa.w"
 
 Marpa_Symbol_ID _marpa_r_first_token_link_trace(Marpa_Recognizer r)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
-
-/*:1313*/
-#line 16346 "./marpa.w"
+/*:1500*/
+#line 20345 "./marpa.w"
 
 SRCL source_link;
 unsigned int source_type;
 YIM item= r->t_trace_earley_item;
-/*563:*/
-#line 6125 "./marpa.w"
+/*585:*/
+#line 6448 "./marpa.w"
 
 const GRAMMAR g= G_of_R(r);
-/*:563*/
-#line 16350 "./marpa.w"
+/*:585*/
+#line 20349 "./marpa.w"
 
-/*1332:*/
-#line 15754 "./marpa.w"
+/*1520:*/
+#line 19510 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -22138,25 +26771,25 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 15755 "./marpa.w"
+/*:1521*/
+#line 19511 "./marpa.w"
 
-/*1330:*/
-#line 15738 "./marpa.w"
+/*1518:*/
+#line 19494 "./marpa.w"
 
 if(_MARPA_UNLIKELY(Input_Phase_of_R(r)==R_BEFORE_INPUT)){
 MARPA_ERROR(MARPA_ERR_RECCE_NOT_STARTED);
 return failure_indicator;
 }
-/*:1330*/
-#line 15756 "./marpa.w"
+/*:1518*/
+#line 19512 "./marpa.w"
 
 
-/*:1332*/
-#line 16351 "./marpa.w"
+/*:1520*/
+#line 20350 "./marpa.w"
 
-/*1390:*/
-#line 16540 "./marpa.w"
+/*1592:*/
+#line 20541 "./marpa.w"
 
 item= r->t_trace_earley_item;
 if(!item){
@@ -22165,8 +26798,19 @@ MARPA_ERROR(MARPA_ERR_NO_TRACE_YIM);
 return failure_indicator;
 }
 
-/*:1390*/
-#line 16352 "./marpa.w"
+/*:1592*/
+#line 20351 "./marpa.w"
+
+/*858:*/
+#line 10184 "./marpa.w"
+
+if(_MARPA_UNLIKELY(R_is_Link_Free(r))){
+MARPA_ERROR(MARPA_ERR_RECCE_IS_LINK_FREE);
+return failure_indicator;
+}
+
+/*:858*/
+#line 20352 "./marpa.w"
 
 source_type= Source_Type_of_YIM(item);
 switch(source_type)
@@ -22191,32 +26835,31 @@ trace_source_link_clear(r);
 return-1;
 }
 
-/*:1376*//*1379:*/
-#line 16384 "./marpa.w"
+/*:1578*//*1581:*/
+#line 20384 "./marpa.w"
 
 Marpa_Symbol_ID _marpa_r_next_token_link_trace(Marpa_Recognizer r)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
-
-/*:1313*/
-#line 16387 "./marpa.w"
+/*:1500*/
+#line 20387 "./marpa.w"
 
 SRCL source_link;
 YIM item;
-/*563:*/
-#line 6125 "./marpa.w"
+/*585:*/
+#line 6448 "./marpa.w"
 
 const GRAMMAR g= G_of_R(r);
-/*:563*/
-#line 16390 "./marpa.w"
+/*:585*/
+#line 20390 "./marpa.w"
 
-/*1332:*/
-#line 15754 "./marpa.w"
+/*1520:*/
+#line 19510 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -22227,25 +26870,25 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 15755 "./marpa.w"
+/*:1521*/
+#line 19511 "./marpa.w"
 
-/*1330:*/
-#line 15738 "./marpa.w"
+/*1518:*/
+#line 19494 "./marpa.w"
 
 if(_MARPA_UNLIKELY(Input_Phase_of_R(r)==R_BEFORE_INPUT)){
 MARPA_ERROR(MARPA_ERR_RECCE_NOT_STARTED);
 return failure_indicator;
 }
-/*:1330*/
-#line 15756 "./marpa.w"
+/*:1518*/
+#line 19512 "./marpa.w"
 
 
-/*:1332*/
-#line 16391 "./marpa.w"
+/*:1520*/
+#line 20391 "./marpa.w"
 
-/*1390:*/
-#line 16540 "./marpa.w"
+/*1592:*/
+#line 20541 "./marpa.w"
 
 item= r->t_trace_earley_item;
 if(!item){
@@ -22254,8 +26897,8 @@ MARPA_ERROR(MARPA_ERR_NO_TRACE_YIM);
 return failure_indicator;
 }
 
-/*:1390*/
-#line 16392 "./marpa.w"
+/*:1592*/
+#line 20392 "./marpa.w"
 
 if(r->t_trace_source_type!=SOURCE_IS_TOKEN){
 trace_source_link_clear(r);
@@ -22271,33 +26914,32 @@ r->t_trace_source_link= source_link;
 return NSYID_of_SRCL(source_link);
 }
 
-/*:1379*//*1381:*/
-#line 16415 "./marpa.w"
+/*:1581*//*1583:*/
+#line 20415 "./marpa.w"
 
 Marpa_Symbol_ID _marpa_r_first_completion_link_trace(Marpa_Recognizer r)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
-
-/*:1313*/
-#line 16418 "./marpa.w"
+/*:1500*/
+#line 20418 "./marpa.w"
 
 SRCL source_link;
 unsigned int source_type;
 YIM item= r->t_trace_earley_item;
-/*563:*/
-#line 6125 "./marpa.w"
+/*585:*/
+#line 6448 "./marpa.w"
 
 const GRAMMAR g= G_of_R(r);
-/*:563*/
-#line 16422 "./marpa.w"
+/*:585*/
+#line 20422 "./marpa.w"
 
-/*1332:*/
-#line 15754 "./marpa.w"
+/*1520:*/
+#line 19510 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -22308,35 +26950,46 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 15755 "./marpa.w"
+/*:1521*/
+#line 19511 "./marpa.w"
 
-/*1330:*/
-#line 15738 "./marpa.w"
+/*1518:*/
+#line 19494 "./marpa.w"
 
 if(_MARPA_UNLIKELY(Input_Phase_of_R(r)==R_BEFORE_INPUT)){
 MARPA_ERROR(MARPA_ERR_RECCE_NOT_STARTED);
 return failure_indicator;
 }
-/*:1330*/
-#line 15756 "./marpa.w"
+/*:1518*/
+#line 19512 "./marpa.w"
+
 
+/*:1520*/
+#line 20423 "./marpa.w"
+
+/*1592:*/
+#line 20541 "./marpa.w"
+
+item= r->t_trace_earley_item;
+if(!item){
+trace_source_link_clear(r);
+MARPA_ERROR(MARPA_ERR_NO_TRACE_YIM);
+return failure_indicator;
+}
 
-/*:1332*/
-#line 16423 "./marpa.w"
+/*:1592*/
+#line 20424 "./marpa.w"
 
-/*1390:*/
-#line 16540 "./marpa.w"
+/*858:*/
+#line 10184 "./marpa.w"
 
-item= r->t_trace_earley_item;
-if(!item){
-trace_source_link_clear(r);
-MARPA_ERROR(MARPA_ERR_NO_TRACE_YIM);
+if(_MARPA_UNLIKELY(R_is_Link_Free(r))){
+MARPA_ERROR(MARPA_ERR_RECCE_IS_LINK_FREE);
 return failure_indicator;
 }
 
-/*:1390*/
-#line 16424 "./marpa.w"
+/*:858*/
+#line 20425 "./marpa.w"
 
 switch((source_type= Source_Type_of_YIM(item)))
 {
@@ -22360,32 +27013,31 @@ trace_source_link_clear(r);
 return-1;
 }
 
-/*:1381*//*1384:*/
-#line 16455 "./marpa.w"
+/*:1583*//*1586:*/
+#line 20456 "./marpa.w"
 
 Marpa_Symbol_ID _marpa_r_next_completion_link_trace(Marpa_Recognizer r)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
-
-/*:1313*/
-#line 16458 "./marpa.w"
+/*:1500*/
+#line 20459 "./marpa.w"
 
 SRCL source_link;
 YIM item;
-/*563:*/
-#line 6125 "./marpa.w"
+/*585:*/
+#line 6448 "./marpa.w"
 
 const GRAMMAR g= G_of_R(r);
-/*:563*/
-#line 16461 "./marpa.w"
+/*:585*/
+#line 20462 "./marpa.w"
 
-/*1332:*/
-#line 15754 "./marpa.w"
+/*1520:*/
+#line 19510 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -22396,25 +27048,25 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 15755 "./marpa.w"
+/*:1521*/
+#line 19511 "./marpa.w"
 
-/*1330:*/
-#line 15738 "./marpa.w"
+/*1518:*/
+#line 19494 "./marpa.w"
 
 if(_MARPA_UNLIKELY(Input_Phase_of_R(r)==R_BEFORE_INPUT)){
 MARPA_ERROR(MARPA_ERR_RECCE_NOT_STARTED);
 return failure_indicator;
 }
-/*:1330*/
-#line 15756 "./marpa.w"
+/*:1518*/
+#line 19512 "./marpa.w"
 
 
-/*:1332*/
-#line 16462 "./marpa.w"
+/*:1520*/
+#line 20463 "./marpa.w"
 
-/*1390:*/
-#line 16540 "./marpa.w"
+/*1592:*/
+#line 20541 "./marpa.w"
 
 item= r->t_trace_earley_item;
 if(!item){
@@ -22423,8 +27075,8 @@ MARPA_ERROR(MARPA_ERR_NO_TRACE_YIM);
 return failure_indicator;
 }
 
-/*:1390*/
-#line 16463 "./marpa.w"
+/*:1592*/
+#line 20464 "./marpa.w"
 
 if(r->t_trace_source_type!=SOURCE_IS_COMPLETION){
 trace_source_link_clear(r);
@@ -22440,33 +27092,32 @@ r->t_trace_source_link= source_link;
 return Cause_AHMID_of_SRCL(source_link);
 }
 
-/*:1384*//*1386:*/
-#line 16486 "./marpa.w"
+/*:1586*//*1588:*/
+#line 20487 "./marpa.w"
 
 Marpa_Symbol_ID
 _marpa_r_first_leo_link_trace(Marpa_Recognizer r)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
-
-/*:1313*/
-#line 16490 "./marpa.w"
+/*:1500*/
+#line 20491 "./marpa.w"
 
 SRCL source_link;
 YIM item= r->t_trace_earley_item;
-/*563:*/
-#line 6125 "./marpa.w"
+/*585:*/
+#line 6448 "./marpa.w"
 
 const GRAMMAR g= G_of_R(r);
-/*:563*/
-#line 16493 "./marpa.w"
+/*:585*/
+#line 20494 "./marpa.w"
 
-/*1332:*/
-#line 15754 "./marpa.w"
+/*1520:*/
+#line 19510 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -22477,25 +27128,25 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 15755 "./marpa.w"
+/*:1521*/
+#line 19511 "./marpa.w"
 
-/*1330:*/
-#line 15738 "./marpa.w"
+/*1518:*/
+#line 19494 "./marpa.w"
 
 if(_MARPA_UNLIKELY(Input_Phase_of_R(r)==R_BEFORE_INPUT)){
 MARPA_ERROR(MARPA_ERR_RECCE_NOT_STARTED);
 return failure_indicator;
 }
-/*:1330*/
-#line 15756 "./marpa.w"
+/*:1518*/
+#line 19512 "./marpa.w"
 
 
-/*:1332*/
-#line 16494 "./marpa.w"
+/*:1520*/
+#line 20495 "./marpa.w"
 
-/*1390:*/
-#line 16540 "./marpa.w"
+/*1592:*/
+#line 20541 "./marpa.w"
 
 item= r->t_trace_earley_item;
 if(!item){
@@ -22504,8 +27155,8 @@ MARPA_ERROR(MARPA_ERR_NO_TRACE_YIM);
 return failure_indicator;
 }
 
-/*:1390*/
-#line 16495 "./marpa.w"
+/*:1592*/
+#line 20496 "./marpa.w"
 
 source_link= First_Leo_SRCL_of_YIM(item);
 if(source_link){
@@ -22517,33 +27168,32 @@ trace_source_link_clear(r);
 return-1;
 }
 
-/*:1386*//*1389:*/
-#line 16514 "./marpa.w"
+/*:1588*//*1591:*/
+#line 20515 "./marpa.w"
 
 Marpa_Symbol_ID
 _marpa_r_next_leo_link_trace(Marpa_Recognizer r)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
-
-/*:1313*/
-#line 16518 "./marpa.w"
+/*:1500*/
+#line 20519 "./marpa.w"
 
 SRCL source_link;
 YIM item;
-/*563:*/
-#line 6125 "./marpa.w"
+/*585:*/
+#line 6448 "./marpa.w"
 
 const GRAMMAR g= G_of_R(r);
-/*:563*/
-#line 16521 "./marpa.w"
+/*:585*/
+#line 20522 "./marpa.w"
 
-/*1332:*/
-#line 15754 "./marpa.w"
+/*1520:*/
+#line 19510 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -22554,25 +27204,25 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 15755 "./marpa.w"
+/*:1521*/
+#line 19511 "./marpa.w"
 
-/*1330:*/
-#line 15738 "./marpa.w"
+/*1518:*/
+#line 19494 "./marpa.w"
 
 if(_MARPA_UNLIKELY(Input_Phase_of_R(r)==R_BEFORE_INPUT)){
 MARPA_ERROR(MARPA_ERR_RECCE_NOT_STARTED);
 return failure_indicator;
 }
-/*:1330*/
-#line 15756 "./marpa.w"
+/*:1518*/
+#line 19512 "./marpa.w"
 
 
-/*:1332*/
-#line 16522 "./marpa.w"
+/*:1520*/
+#line 20523 "./marpa.w"
 
-/*1390:*/
-#line 16540 "./marpa.w"
+/*1592:*/
+#line 20541 "./marpa.w"
 
 item= r->t_trace_earley_item;
 if(!item){
@@ -22581,8 +27231,8 @@ MARPA_ERROR(MARPA_ERR_NO_TRACE_YIM);
 return failure_indicator;
 }
 
-/*:1390*/
-#line 16523 "./marpa.w"
+/*:1592*/
+#line 20524 "./marpa.w"
 
 if(r->t_trace_source_type!=SOURCE_IS_LEO)
 {
@@ -22600,8 +27250,8 @@ r->t_trace_source_link= source_link;
 return Cause_AHMID_of_SRCL(source_link);
 }
 
-/*:1389*//*1391:*/
-#line 16549 "./marpa.w"
+/*:1591*//*1593:*/
+#line 20550 "./marpa.w"
 
 PRIVATE void trace_source_link_clear(RECCE r)
 {
@@ -22609,32 +27259,31 @@ r->t_trace_source_link= NULL;
 r->t_trace_source_type= NO_SOURCE;
 }
 
-/*:1391*//*1392:*/
-#line 16564 "./marpa.w"
+/*:1593*//*1594:*/
+#line 20565 "./marpa.w"
 
 AHMID _marpa_r_source_predecessor_state(Marpa_Recognizer r)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
-
-/*:1313*/
-#line 16567 "./marpa.w"
+/*:1500*/
+#line 20568 "./marpa.w"
 
 unsigned int source_type;
 SRCL source_link;
-/*563:*/
-#line 6125 "./marpa.w"
+/*585:*/
+#line 6448 "./marpa.w"
 
 const GRAMMAR g= G_of_R(r);
-/*:563*/
-#line 16570 "./marpa.w"
+/*:585*/
+#line 20571 "./marpa.w"
 
-/*1332:*/
-#line 15754 "./marpa.w"
+/*1520:*/
+#line 19510 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -22645,26 +27294,26 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 15755 "./marpa.w"
+/*:1521*/
+#line 19511 "./marpa.w"
 
-/*1330:*/
-#line 15738 "./marpa.w"
+/*1518:*/
+#line 19494 "./marpa.w"
 
 if(_MARPA_UNLIKELY(Input_Phase_of_R(r)==R_BEFORE_INPUT)){
 MARPA_ERROR(MARPA_ERR_RECCE_NOT_STARTED);
 return failure_indicator;
 }
-/*:1330*/
-#line 15756 "./marpa.w"
+/*:1518*/
+#line 19512 "./marpa.w"
 
 
-/*:1332*/
-#line 16571 "./marpa.w"
+/*:1520*/
+#line 20572 "./marpa.w"
 
 source_type= r->t_trace_source_type;
-/*1398:*/
-#line 16716 "./marpa.w"
+/*1600:*/
+#line 20723 "./marpa.w"
 
 source_link= r->t_trace_source_link;
 if(!source_link){
@@ -22672,9 +27321,22 @@ MARPA_ERROR(MARPA_ERR_NO_TRACE_SRCL);
 return failure_indicator;
 }
 
-/*:1398*/
-#line 16573 "./marpa.w"
+/*:1600*/
+#line 20574 "./marpa.w"
+
+if(source_type==SOURCE_IS_TOKEN){
+/*819:*/
+#line 9668 "./marpa.w"
+
+if(_MARPA_UNLIKELY(R_is_Forgetful(r))){
+MARPA_ERROR(MARPA_ERR_RECCE_IS_FORGETFUL);
+return failure_indicator;
+}
+
+/*:819*/
+#line 20576 "./marpa.w"
 
+}
 switch(source_type)
 {
 case SOURCE_IS_TOKEN:
@@ -22688,32 +27350,31 @@ MARPA_ERROR(invalid_source_type_code(source_type));
 return failure_indicator;
 }
 
-/*:1392*//*1393:*/
-#line 16605 "./marpa.w"
+/*:1594*//*1595:*/
+#line 20609 "./marpa.w"
 
 Marpa_Symbol_ID _marpa_r_source_token(Marpa_Recognizer r,int*value_p)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
-
-/*:1313*/
-#line 16608 "./marpa.w"
+/*:1500*/
+#line 20612 "./marpa.w"
 
 unsigned int source_type;
 SRCL source_link;
-/*563:*/
-#line 6125 "./marpa.w"
+/*585:*/
+#line 6448 "./marpa.w"
 
 const GRAMMAR g= G_of_R(r);
-/*:563*/
-#line 16611 "./marpa.w"
+/*:585*/
+#line 20615 "./marpa.w"
 
-/*1332:*/
-#line 15754 "./marpa.w"
+/*1520:*/
+#line 19510 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -22724,26 +27385,26 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 15755 "./marpa.w"
+/*:1521*/
+#line 19511 "./marpa.w"
 
-/*1330:*/
-#line 15738 "./marpa.w"
+/*1518:*/
+#line 19494 "./marpa.w"
 
 if(_MARPA_UNLIKELY(Input_Phase_of_R(r)==R_BEFORE_INPUT)){
 MARPA_ERROR(MARPA_ERR_RECCE_NOT_STARTED);
 return failure_indicator;
 }
-/*:1330*/
-#line 15756 "./marpa.w"
+/*:1518*/
+#line 19512 "./marpa.w"
 
 
-/*:1332*/
-#line 16612 "./marpa.w"
+/*:1520*/
+#line 20616 "./marpa.w"
 
 source_type= r->t_trace_source_type;
-/*1398:*/
-#line 16716 "./marpa.w"
+/*1600:*/
+#line 20723 "./marpa.w"
 
 source_link= r->t_trace_source_link;
 if(!source_link){
@@ -22751,8 +27412,8 @@ MARPA_ERROR(MARPA_ERR_NO_TRACE_SRCL);
 return failure_indicator;
 }
 
-/*:1398*/
-#line 16614 "./marpa.w"
+/*:1600*/
+#line 20618 "./marpa.w"
 
 if(source_type==SOURCE_IS_TOKEN){
 if(value_p)*value_p= Value_of_SRCL(source_link);
@@ -22762,32 +27423,31 @@ MARPA_ERROR(invalid_source_type_code(source_type));
 return failure_indicator;
 }
 
-/*:1393*//*1395:*/
-#line 16636 "./marpa.w"
+/*:1595*//*1597:*/
+#line 20640 "./marpa.w"
 
 Marpa_Symbol_ID _marpa_r_source_leo_transition_symbol(Marpa_Recognizer r)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
-
-/*:1313*/
-#line 16639 "./marpa.w"
+/*:1500*/
+#line 20643 "./marpa.w"
 
 unsigned int source_type;
 SRCL source_link;
-/*563:*/
-#line 6125 "./marpa.w"
+/*585:*/
+#line 6448 "./marpa.w"
 
 const GRAMMAR g= G_of_R(r);
-/*:563*/
-#line 16642 "./marpa.w"
+/*:585*/
+#line 20646 "./marpa.w"
 
-/*1332:*/
-#line 15754 "./marpa.w"
+/*1520:*/
+#line 19510 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -22798,26 +27458,26 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 15755 "./marpa.w"
+/*:1521*/
+#line 19511 "./marpa.w"
 
-/*1330:*/
-#line 15738 "./marpa.w"
+/*1518:*/
+#line 19494 "./marpa.w"
 
 if(_MARPA_UNLIKELY(Input_Phase_of_R(r)==R_BEFORE_INPUT)){
 MARPA_ERROR(MARPA_ERR_RECCE_NOT_STARTED);
 return failure_indicator;
 }
-/*:1330*/
-#line 15756 "./marpa.w"
+/*:1518*/
+#line 19512 "./marpa.w"
 
 
-/*:1332*/
-#line 16643 "./marpa.w"
+/*:1520*/
+#line 20647 "./marpa.w"
 
 source_type= r->t_trace_source_type;
-/*1398:*/
-#line 16716 "./marpa.w"
+/*1600:*/
+#line 20723 "./marpa.w"
 
 source_link= r->t_trace_source_link;
 if(!source_link){
@@ -22825,8 +27485,8 @@ MARPA_ERROR(MARPA_ERR_NO_TRACE_SRCL);
 return failure_indicator;
 }
 
-/*:1398*/
-#line 16645 "./marpa.w"
+/*:1600*/
+#line 20649 "./marpa.w"
 
 switch(source_type)
 {
@@ -22837,33 +27497,32 @@ MARPA_ERROR(invalid_source_type_code(source_type));
 return failure_indicator;
 }
 
-/*:1395*//*1397:*/
-#line 16679 "./marpa.w"
+/*:1597*//*1599:*/
+#line 20683 "./marpa.w"
 
 Marpa_Earley_Set_ID _marpa_r_source_middle(Marpa_Recognizer r)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
-
-/*:1313*/
-#line 16682 "./marpa.w"
+/*:1500*/
+#line 20686 "./marpa.w"
 
 YIM predecessor_yim= NULL;
 unsigned int source_type;
 SRCL source_link;
-/*563:*/
-#line 6125 "./marpa.w"
+/*585:*/
+#line 6448 "./marpa.w"
 
 const GRAMMAR g= G_of_R(r);
-/*:563*/
-#line 16686 "./marpa.w"
+/*:585*/
+#line 20690 "./marpa.w"
 
-/*1332:*/
-#line 15754 "./marpa.w"
+/*1520:*/
+#line 19510 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -22874,26 +27533,26 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 15755 "./marpa.w"
+/*:1521*/
+#line 19511 "./marpa.w"
 
-/*1330:*/
-#line 15738 "./marpa.w"
+/*1518:*/
+#line 19494 "./marpa.w"
 
 if(_MARPA_UNLIKELY(Input_Phase_of_R(r)==R_BEFORE_INPUT)){
 MARPA_ERROR(MARPA_ERR_RECCE_NOT_STARTED);
 return failure_indicator;
 }
-/*:1330*/
-#line 15756 "./marpa.w"
+/*:1518*/
+#line 19512 "./marpa.w"
 
 
-/*:1332*/
-#line 16687 "./marpa.w"
+/*:1520*/
+#line 20691 "./marpa.w"
 
 source_type= r->t_trace_source_type;
-/*1398:*/
-#line 16716 "./marpa.w"
+/*1600:*/
+#line 20723 "./marpa.w"
 
 source_link= r->t_trace_source_link;
 if(!source_link){
@@ -22901,10 +27560,23 @@ MARPA_ERROR(MARPA_ERR_NO_TRACE_SRCL);
 return failure_indicator;
 }
 
-/*:1398*/
-#line 16689 "./marpa.w"
+/*:1600*/
+#line 20693 "./marpa.w"
+
+
+if(source_type==SOURCE_IS_TOKEN){
+/*819:*/
+#line 9668 "./marpa.w"
+
+if(_MARPA_UNLIKELY(R_is_Forgetful(r))){
+MARPA_ERROR(MARPA_ERR_RECCE_IS_FORGETFUL);
+return failure_indicator;
+}
 
+/*:819*/
+#line 20696 "./marpa.w"
 
+}
 switch(source_type)
 {
 case SOURCE_IS_LEO:
@@ -22930,30 +27602,29 @@ return YS_Ord_of_YIM(predecessor_yim);
 return Origin_Ord_of_YIM(r->t_trace_earley_item);
 }
 
-/*:1397*//*1402:*/
-#line 16754 "./marpa.w"
+/*:1599*//*1604:*/
+#line 20761 "./marpa.w"
 
 int _marpa_b_or_node_set(Marpa_Bocage b,
 Marpa_Or_Node_ID or_node_id)
 {
 OR or_node;
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 20766 "./marpa.w"
 
-/*:1313*/
-#line 16759 "./marpa.w"
-
-/*1044:*/
-#line 12138 "./marpa.w"
+/*1226:*/
+#line 15682 "./marpa.w"
 
 const GRAMMAR g UNUSED= G_of_B(b);
 
-/*:1044*/
-#line 16760 "./marpa.w"
+/*:1226*/
+#line 20767 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -22964,11 +27635,11 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 16761 "./marpa.w"
+/*:1521*/
+#line 20768 "./marpa.w"
 
-/*1400:*/
-#line 16732 "./marpa.w"
+/*1602:*/
+#line 20739 "./marpa.w"
 
 {
 if(_MARPA_UNLIKELY(or_node_id>=OR_Count_of_B(b)))
@@ -22981,11 +27652,11 @@ MARPA_ERROR(MARPA_ERR_ORID_NEGATIVE);
 return failure_indicator;
 }
 }
-/*:1400*/
-#line 16762 "./marpa.w"
+/*:1602*/
+#line 20769 "./marpa.w"
 
-/*1401:*/
-#line 16744 "./marpa.w"
+/*1603:*/
+#line 20751 "./marpa.w"
 
 {
 if(_MARPA_UNLIKELY(!ORs_of_B(b)))
@@ -22996,36 +27667,35 @@ return failure_indicator;
 or_node= OR_of_B_by_ID(b,or_node_id);
 }
 
-/*:1401*/
-#line 16763 "./marpa.w"
+/*:1603*/
+#line 20770 "./marpa.w"
 
 return YS_Ord_of_OR(or_node);
 }
 
-/*:1402*//*1403:*/
-#line 16767 "./marpa.w"
+/*:1604*//*1605:*/
+#line 20774 "./marpa.w"
 
 int _marpa_b_or_node_origin(Marpa_Bocage b,
 Marpa_Or_Node_ID or_node_id)
 {
 OR or_node;
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 20779 "./marpa.w"
 
-/*:1313*/
-#line 16772 "./marpa.w"
-
-/*1044:*/
-#line 12138 "./marpa.w"
+/*1226:*/
+#line 15682 "./marpa.w"
 
 const GRAMMAR g UNUSED= G_of_B(b);
 
-/*:1044*/
-#line 16773 "./marpa.w"
+/*:1226*/
+#line 20780 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -23036,11 +27706,11 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 16774 "./marpa.w"
+/*:1521*/
+#line 20781 "./marpa.w"
 
-/*1400:*/
-#line 16732 "./marpa.w"
+/*1602:*/
+#line 20739 "./marpa.w"
 
 {
 if(_MARPA_UNLIKELY(or_node_id>=OR_Count_of_B(b)))
@@ -23053,11 +27723,11 @@ MARPA_ERROR(MARPA_ERR_ORID_NEGATIVE);
 return failure_indicator;
 }
 }
-/*:1400*/
-#line 16775 "./marpa.w"
+/*:1602*/
+#line 20782 "./marpa.w"
 
-/*1401:*/
-#line 16744 "./marpa.w"
+/*1603:*/
+#line 20751 "./marpa.w"
 
 {
 if(_MARPA_UNLIKELY(!ORs_of_B(b)))
@@ -23068,36 +27738,35 @@ return failure_indicator;
 or_node= OR_of_B_by_ID(b,or_node_id);
 }
 
-/*:1401*/
-#line 16776 "./marpa.w"
+/*:1603*/
+#line 20783 "./marpa.w"
 
 return Origin_Ord_of_OR(or_node);
 }
 
-/*:1403*//*1404:*/
-#line 16780 "./marpa.w"
+/*:1605*//*1606:*/
+#line 20787 "./marpa.w"
 
 Marpa_IRL_ID _marpa_b_or_node_irl(Marpa_Bocage b,
 Marpa_Or_Node_ID or_node_id)
 {
 OR or_node;
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 20792 "./marpa.w"
 
-/*:1313*/
-#line 16785 "./marpa.w"
-
-/*1044:*/
-#line 12138 "./marpa.w"
+/*1226:*/
+#line 15682 "./marpa.w"
 
 const GRAMMAR g UNUSED= G_of_B(b);
 
-/*:1044*/
-#line 16786 "./marpa.w"
+/*:1226*/
+#line 20793 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -23108,11 +27777,11 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 16787 "./marpa.w"
+/*:1521*/
+#line 20794 "./marpa.w"
 
-/*1400:*/
-#line 16732 "./marpa.w"
+/*1602:*/
+#line 20739 "./marpa.w"
 
 {
 if(_MARPA_UNLIKELY(or_node_id>=OR_Count_of_B(b)))
@@ -23125,11 +27794,11 @@ MARPA_ERROR(MARPA_ERR_ORID_NEGATIVE);
 return failure_indicator;
 }
 }
-/*:1400*/
-#line 16788 "./marpa.w"
+/*:1602*/
+#line 20795 "./marpa.w"
 
-/*1401:*/
-#line 16744 "./marpa.w"
+/*1603:*/
+#line 20751 "./marpa.w"
 
 {
 if(_MARPA_UNLIKELY(!ORs_of_B(b)))
@@ -23140,36 +27809,35 @@ return failure_indicator;
 or_node= OR_of_B_by_ID(b,or_node_id);
 }
 
-/*:1401*/
-#line 16789 "./marpa.w"
+/*:1603*/
+#line 20796 "./marpa.w"
 
 return IRLID_of_OR(or_node);
 }
 
-/*:1404*//*1405:*/
-#line 16793 "./marpa.w"
+/*:1606*//*1607:*/
+#line 20800 "./marpa.w"
 
 int _marpa_b_or_node_position(Marpa_Bocage b,
 Marpa_Or_Node_ID or_node_id)
 {
 OR or_node;
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 20805 "./marpa.w"
 
-/*:1313*/
-#line 16798 "./marpa.w"
-
-/*1044:*/
-#line 12138 "./marpa.w"
+/*1226:*/
+#line 15682 "./marpa.w"
 
 const GRAMMAR g UNUSED= G_of_B(b);
 
-/*:1044*/
-#line 16799 "./marpa.w"
+/*:1226*/
+#line 20806 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -23180,11 +27848,11 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 16800 "./marpa.w"
+/*:1521*/
+#line 20807 "./marpa.w"
 
-/*1400:*/
-#line 16732 "./marpa.w"
+/*1602:*/
+#line 20739 "./marpa.w"
 
 {
 if(_MARPA_UNLIKELY(or_node_id>=OR_Count_of_B(b)))
@@ -23197,11 +27865,11 @@ MARPA_ERROR(MARPA_ERR_ORID_NEGATIVE);
 return failure_indicator;
 }
 }
-/*:1400*/
-#line 16801 "./marpa.w"
+/*:1602*/
+#line 20808 "./marpa.w"
 
-/*1401:*/
-#line 16744 "./marpa.w"
+/*1603:*/
+#line 20751 "./marpa.w"
 
 {
 if(_MARPA_UNLIKELY(!ORs_of_B(b)))
@@ -23212,36 +27880,35 @@ return failure_indicator;
 or_node= OR_of_B_by_ID(b,or_node_id);
 }
 
-/*:1401*/
-#line 16802 "./marpa.w"
+/*:1603*/
+#line 20809 "./marpa.w"
 
 return Position_of_OR(or_node);
 }
 
-/*:1405*//*1406:*/
-#line 16806 "./marpa.w"
+/*:1607*//*1608:*/
+#line 20813 "./marpa.w"
 
 int _marpa_b_or_node_is_whole(Marpa_Bocage b,
 Marpa_Or_Node_ID or_node_id)
 {
 OR or_node;
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 20818 "./marpa.w"
 
-/*:1313*/
-#line 16811 "./marpa.w"
-
-/*1044:*/
-#line 12138 "./marpa.w"
+/*1226:*/
+#line 15682 "./marpa.w"
 
 const GRAMMAR g UNUSED= G_of_B(b);
 
-/*:1044*/
-#line 16812 "./marpa.w"
+/*:1226*/
+#line 20819 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -23252,11 +27919,11 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 16813 "./marpa.w"
+/*:1521*/
+#line 20820 "./marpa.w"
 
-/*1400:*/
-#line 16732 "./marpa.w"
+/*1602:*/
+#line 20739 "./marpa.w"
 
 {
 if(_MARPA_UNLIKELY(or_node_id>=OR_Count_of_B(b)))
@@ -23269,11 +27936,11 @@ MARPA_ERROR(MARPA_ERR_ORID_NEGATIVE);
 return failure_indicator;
 }
 }
-/*:1400*/
-#line 16814 "./marpa.w"
+/*:1602*/
+#line 20821 "./marpa.w"
 
-/*1401:*/
-#line 16744 "./marpa.w"
+/*1603:*/
+#line 20751 "./marpa.w"
 
 {
 if(_MARPA_UNLIKELY(!ORs_of_B(b)))
@@ -23284,36 +27951,35 @@ return failure_indicator;
 or_node= OR_of_B_by_ID(b,or_node_id);
 }
 
-/*:1401*/
-#line 16815 "./marpa.w"
+/*:1603*/
+#line 20822 "./marpa.w"
 
 return Position_of_OR(or_node)>=Length_of_IRL(IRL_of_OR(or_node))?1:0;
 }
 
-/*:1406*//*1407:*/
-#line 16819 "./marpa.w"
+/*:1608*//*1609:*/
+#line 20826 "./marpa.w"
 
 int _marpa_b_or_node_is_semantic(Marpa_Bocage b,
 Marpa_Or_Node_ID or_node_id)
 {
 OR or_node;
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 20831 "./marpa.w"
 
-/*:1313*/
-#line 16824 "./marpa.w"
-
-/*1044:*/
-#line 12138 "./marpa.w"
+/*1226:*/
+#line 15682 "./marpa.w"
 
 const GRAMMAR g UNUSED= G_of_B(b);
 
-/*:1044*/
-#line 16825 "./marpa.w"
+/*:1226*/
+#line 20832 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -23324,11 +27990,11 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 16826 "./marpa.w"
+/*:1521*/
+#line 20833 "./marpa.w"
 
-/*1400:*/
-#line 16732 "./marpa.w"
+/*1602:*/
+#line 20739 "./marpa.w"
 
 {
 if(_MARPA_UNLIKELY(or_node_id>=OR_Count_of_B(b)))
@@ -23341,11 +28007,11 @@ MARPA_ERROR(MARPA_ERR_ORID_NEGATIVE);
 return failure_indicator;
 }
 }
-/*:1400*/
-#line 16827 "./marpa.w"
+/*:1602*/
+#line 20834 "./marpa.w"
 
-/*1401:*/
-#line 16744 "./marpa.w"
+/*1603:*/
+#line 20751 "./marpa.w"
 
 {
 if(_MARPA_UNLIKELY(!ORs_of_B(b)))
@@ -23356,36 +28022,35 @@ return failure_indicator;
 or_node= OR_of_B_by_ID(b,or_node_id);
 }
 
-/*:1401*/
-#line 16828 "./marpa.w"
+/*:1603*/
+#line 20835 "./marpa.w"
 
 return!IRL_has_Virtual_LHS(IRL_of_OR(or_node));
 }
 
-/*:1407*//*1408:*/
-#line 16832 "./marpa.w"
+/*:1609*//*1610:*/
+#line 20839 "./marpa.w"
 
 int _marpa_b_or_node_first_and(Marpa_Bocage b,
 Marpa_Or_Node_ID or_node_id)
 {
 OR or_node;
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 20844 "./marpa.w"
 
-/*:1313*/
-#line 16837 "./marpa.w"
-
-/*1044:*/
-#line 12138 "./marpa.w"
+/*1226:*/
+#line 15682 "./marpa.w"
 
 const GRAMMAR g UNUSED= G_of_B(b);
 
-/*:1044*/
-#line 16838 "./marpa.w"
+/*:1226*/
+#line 20845 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -23396,11 +28061,11 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 16839 "./marpa.w"
+/*:1521*/
+#line 20846 "./marpa.w"
 
-/*1400:*/
-#line 16732 "./marpa.w"
+/*1602:*/
+#line 20739 "./marpa.w"
 
 {
 if(_MARPA_UNLIKELY(or_node_id>=OR_Count_of_B(b)))
@@ -23413,11 +28078,11 @@ MARPA_ERROR(MARPA_ERR_ORID_NEGATIVE);
 return failure_indicator;
 }
 }
-/*:1400*/
-#line 16840 "./marpa.w"
+/*:1602*/
+#line 20847 "./marpa.w"
 
-/*1401:*/
-#line 16744 "./marpa.w"
+/*1603:*/
+#line 20751 "./marpa.w"
 
 {
 if(_MARPA_UNLIKELY(!ORs_of_B(b)))
@@ -23428,36 +28093,35 @@ return failure_indicator;
 or_node= OR_of_B_by_ID(b,or_node_id);
 }
 
-/*:1401*/
-#line 16841 "./marpa.w"
+/*:1603*/
+#line 20848 "./marpa.w"
 
 return First_ANDID_of_OR(or_node);
 }
 
-/*:1408*//*1409:*/
-#line 16845 "./marpa.w"
+/*:1610*//*1611:*/
+#line 20852 "./marpa.w"
 
 int _marpa_b_or_node_last_and(Marpa_Bocage b,
 Marpa_Or_Node_ID or_node_id)
 {
 OR or_node;
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 20857 "./marpa.w"
 
-/*:1313*/
-#line 16850 "./marpa.w"
-
-/*1044:*/
-#line 12138 "./marpa.w"
+/*1226:*/
+#line 15682 "./marpa.w"
 
 const GRAMMAR g UNUSED= G_of_B(b);
 
-/*:1044*/
-#line 16851 "./marpa.w"
+/*:1226*/
+#line 20858 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -23468,11 +28132,11 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 16852 "./marpa.w"
+/*:1521*/
+#line 20859 "./marpa.w"
 
-/*1400:*/
-#line 16732 "./marpa.w"
+/*1602:*/
+#line 20739 "./marpa.w"
 
 {
 if(_MARPA_UNLIKELY(or_node_id>=OR_Count_of_B(b)))
@@ -23485,11 +28149,11 @@ MARPA_ERROR(MARPA_ERR_ORID_NEGATIVE);
 return failure_indicator;
 }
 }
-/*:1400*/
-#line 16853 "./marpa.w"
+/*:1602*/
+#line 20860 "./marpa.w"
 
-/*1401:*/
-#line 16744 "./marpa.w"
+/*1603:*/
+#line 20751 "./marpa.w"
 
 {
 if(_MARPA_UNLIKELY(!ORs_of_B(b)))
@@ -23500,37 +28164,36 @@ return failure_indicator;
 or_node= OR_of_B_by_ID(b,or_node_id);
 }
 
-/*:1401*/
-#line 16854 "./marpa.w"
+/*:1603*/
+#line 20861 "./marpa.w"
 
 return First_ANDID_of_OR(or_node)
 +AND_Count_of_OR(or_node)-1;
 }
 
-/*:1409*//*1410:*/
-#line 16859 "./marpa.w"
+/*:1611*//*1612:*/
+#line 20866 "./marpa.w"
 
 int _marpa_b_or_node_and_count(Marpa_Bocage b,
 Marpa_Or_Node_ID or_node_id)
 {
 OR or_node;
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 20871 "./marpa.w"
 
-/*:1313*/
-#line 16864 "./marpa.w"
-
-/*1044:*/
-#line 12138 "./marpa.w"
+/*1226:*/
+#line 15682 "./marpa.w"
 
 const GRAMMAR g UNUSED= G_of_B(b);
 
-/*:1044*/
-#line 16865 "./marpa.w"
+/*:1226*/
+#line 20872 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -23541,11 +28204,11 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 16866 "./marpa.w"
+/*:1521*/
+#line 20873 "./marpa.w"
 
-/*1400:*/
-#line 16732 "./marpa.w"
+/*1602:*/
+#line 20739 "./marpa.w"
 
 {
 if(_MARPA_UNLIKELY(or_node_id>=OR_Count_of_B(b)))
@@ -23558,11 +28221,11 @@ MARPA_ERROR(MARPA_ERR_ORID_NEGATIVE);
 return failure_indicator;
 }
 }
-/*:1400*/
-#line 16867 "./marpa.w"
+/*:1602*/
+#line 20874 "./marpa.w"
 
-/*1401:*/
-#line 16744 "./marpa.w"
+/*1603:*/
+#line 20751 "./marpa.w"
 
 {
 if(_MARPA_UNLIKELY(!ORs_of_B(b)))
@@ -23573,43 +28236,42 @@ return failure_indicator;
 or_node= OR_of_B_by_ID(b,or_node_id);
 }
 
-/*:1401*/
-#line 16868 "./marpa.w"
+/*:1603*/
+#line 20875 "./marpa.w"
 
 return AND_Count_of_OR(or_node);
 }
 
-/*:1410*//*1413:*/
-#line 16882 "./marpa.w"
+/*:1612*//*1615:*/
+#line 20889 "./marpa.w"
 
 int _marpa_o_or_node_and_node_count(Marpa_Order o,
 Marpa_Or_Node_ID or_node_id)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 20893 "./marpa.w"
 
-/*:1313*/
-#line 16886 "./marpa.w"
-
-/*1089:*/
-#line 12543 "./marpa.w"
+/*1271:*/
+#line 16099 "./marpa.w"
 
 const BOCAGE b= B_of_O(o);
-/*1044:*/
-#line 12138 "./marpa.w"
+/*1226:*/
+#line 15682 "./marpa.w"
 
 const GRAMMAR g UNUSED= G_of_B(b);
 
-/*:1044*/
-#line 12545 "./marpa.w"
+/*:1226*/
+#line 16101 "./marpa.w"
 
 
-/*:1089*/
-#line 16887 "./marpa.w"
+/*:1271*/
+#line 20894 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -23620,11 +28282,11 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 16888 "./marpa.w"
+/*:1521*/
+#line 20895 "./marpa.w"
 
-/*1400:*/
-#line 16732 "./marpa.w"
+/*1602:*/
+#line 20739 "./marpa.w"
 
 {
 if(_MARPA_UNLIKELY(or_node_id>=OR_Count_of_B(b)))
@@ -23637,8 +28299,8 @@ MARPA_ERROR(MARPA_ERR_ORID_NEGATIVE);
 return failure_indicator;
 }
 }
-/*:1400*/
-#line 16889 "./marpa.w"
+/*:1602*/
+#line 20896 "./marpa.w"
 
 if(!O_is_Default(o))
 {
@@ -23648,8 +28310,8 @@ if(ordering)return ordering[0];
 }
 {
 OR or_node;
-/*1401:*/
-#line 16744 "./marpa.w"
+/*1603:*/
+#line 20751 "./marpa.w"
 
 {
 if(_MARPA_UNLIKELY(!ORs_of_B(b)))
@@ -23660,44 +28322,43 @@ return failure_indicator;
 or_node= OR_of_B_by_ID(b,or_node_id);
 }
 
-/*:1401*/
-#line 16898 "./marpa.w"
+/*:1603*/
+#line 20905 "./marpa.w"
 
 return AND_Count_of_OR(or_node);
 }
 }
 
-/*:1413*//*1414:*/
-#line 16903 "./marpa.w"
+/*:1615*//*1616:*/
+#line 20910 "./marpa.w"
 
 int _marpa_o_or_node_and_node_id_by_ix(Marpa_Order o,
 Marpa_Or_Node_ID or_node_id,int ix)
 {
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 20914 "./marpa.w"
 
-/*:1313*/
-#line 16907 "./marpa.w"
-
-/*1089:*/
-#line 12543 "./marpa.w"
+/*1271:*/
+#line 16099 "./marpa.w"
 
 const BOCAGE b= B_of_O(o);
-/*1044:*/
-#line 12138 "./marpa.w"
+/*1226:*/
+#line 15682 "./marpa.w"
 
 const GRAMMAR g UNUSED= G_of_B(b);
 
-/*:1044*/
-#line 12545 "./marpa.w"
+/*:1226*/
+#line 16101 "./marpa.w"
 
 
-/*:1089*/
-#line 16908 "./marpa.w"
+/*:1271*/
+#line 20915 "./marpa.w"
 
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -23708,11 +28369,11 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 16909 "./marpa.w"
+/*:1521*/
+#line 20916 "./marpa.w"
 
-/*1400:*/
-#line 16732 "./marpa.w"
+/*1602:*/
+#line 20739 "./marpa.w"
 
 {
 if(_MARPA_UNLIKELY(or_node_id>=OR_Count_of_B(b)))
@@ -23725,8 +28386,8 @@ MARPA_ERROR(MARPA_ERR_ORID_NEGATIVE);
 return failure_indicator;
 }
 }
-/*:1400*/
-#line 16910 "./marpa.w"
+/*:1602*/
+#line 20917 "./marpa.w"
 
 if(!O_is_Default(o))
 {
@@ -23736,8 +28397,8 @@ if(ordering)return ordering[1+ix];
 }
 {
 OR or_node;
-/*1401:*/
-#line 16744 "./marpa.w"
+/*1603:*/
+#line 20751 "./marpa.w"
 
 {
 if(_MARPA_UNLIKELY(!ORs_of_B(b)))
@@ -23748,35 +28409,34 @@ return failure_indicator;
 or_node= OR_of_B_by_ID(b,or_node_id);
 }
 
-/*:1401*/
-#line 16919 "./marpa.w"
+/*:1603*/
+#line 20926 "./marpa.w"
 
 return First_ANDID_of_OR(or_node)+ix;
 }
 }
 
-/*:1414*//*1416:*/
-#line 16926 "./marpa.w"
+/*:1616*//*1618:*/
+#line 20933 "./marpa.w"
 
 int _marpa_b_and_node_count(Marpa_Bocage b)
 {
-/*1044:*/
-#line 12138 "./marpa.w"
+/*1226:*/
+#line 15682 "./marpa.w"
 
 const GRAMMAR g UNUSED= G_of_B(b);
 
-/*:1044*/
-#line 16929 "./marpa.w"
+/*:1226*/
+#line 20936 "./marpa.w"
 
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 20937 "./marpa.w"
 
-/*:1313*/
-#line 16930 "./marpa.w"
-
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -23787,36 +28447,35 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 16931 "./marpa.w"
+/*:1521*/
+#line 20938 "./marpa.w"
 
 return AND_Count_of_B(b);
 }
 
-/*:1416*//*1418:*/
-#line 16957 "./marpa.w"
+/*:1618*//*1620:*/
+#line 20964 "./marpa.w"
 
 int _marpa_b_and_node_parent(Marpa_Bocage b,
 Marpa_And_Node_ID and_node_id)
 {
 AND and_node;
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 20969 "./marpa.w"
 
-/*:1313*/
-#line 16962 "./marpa.w"
-
-/*1044:*/
-#line 12138 "./marpa.w"
+/*1226:*/
+#line 15682 "./marpa.w"
 
 const GRAMMAR g UNUSED= G_of_B(b);
 
-/*:1044*/
-#line 16963 "./marpa.w"
+/*:1226*/
+#line 20970 "./marpa.w"
 
-/*1417:*/
-#line 16935 "./marpa.w"
+/*1619:*/
+#line 20942 "./marpa.w"
 
 {
 if(and_node_id>=AND_Count_of_B(b))
@@ -23839,36 +28498,35 @@ and_node= and_nodes+and_node_id;
 }
 }
 
-/*:1417*/
-#line 16964 "./marpa.w"
+/*:1619*/
+#line 20971 "./marpa.w"
 
 return ID_of_OR(OR_of_AND(and_node));
 }
 
-/*:1418*//*1419:*/
-#line 16968 "./marpa.w"
+/*:1620*//*1621:*/
+#line 20975 "./marpa.w"
 
 int _marpa_b_and_node_predecessor(Marpa_Bocage b,
 Marpa_And_Node_ID and_node_id)
 {
 AND and_node;
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 20980 "./marpa.w"
 
-/*:1313*/
-#line 16973 "./marpa.w"
-
-/*1044:*/
-#line 12138 "./marpa.w"
+/*1226:*/
+#line 15682 "./marpa.w"
 
 const GRAMMAR g UNUSED= G_of_B(b);
 
-/*:1044*/
-#line 16974 "./marpa.w"
+/*:1226*/
+#line 20981 "./marpa.w"
 
-/*1417:*/
-#line 16935 "./marpa.w"
+/*1619:*/
+#line 20942 "./marpa.w"
 
 {
 if(and_node_id>=AND_Count_of_B(b))
@@ -23891,8 +28549,8 @@ and_node= and_nodes+and_node_id;
 }
 }
 
-/*:1417*/
-#line 16975 "./marpa.w"
+/*:1619*/
+#line 20982 "./marpa.w"
 
 {
 const OR predecessor_or= Predecessor_OR_of_AND(and_node);
@@ -23902,30 +28560,29 @@ return predecessor_or_id;
 }
 }
 
-/*:1419*//*1420:*/
-#line 16984 "./marpa.w"
+/*:1621*//*1622:*/
+#line 20991 "./marpa.w"
 
 int _marpa_b_and_node_cause(Marpa_Bocage b,
 Marpa_And_Node_ID and_node_id)
 {
 AND and_node;
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 20996 "./marpa.w"
 
-/*:1313*/
-#line 16989 "./marpa.w"
-
-/*1044:*/
-#line 12138 "./marpa.w"
+/*1226:*/
+#line 15682 "./marpa.w"
 
 const GRAMMAR g UNUSED= G_of_B(b);
 
-/*:1044*/
-#line 16990 "./marpa.w"
+/*:1226*/
+#line 20997 "./marpa.w"
 
-/*1417:*/
-#line 16935 "./marpa.w"
+/*1619:*/
+#line 20942 "./marpa.w"
 
 {
 if(and_node_id>=AND_Count_of_B(b))
@@ -23948,8 +28605,8 @@ and_node= and_nodes+and_node_id;
 }
 }
 
-/*:1417*/
-#line 16991 "./marpa.w"
+/*:1619*/
+#line 20998 "./marpa.w"
 
 {
 const OR cause_or= Cause_OR_of_AND(and_node);
@@ -23959,30 +28616,29 @@ return cause_or_id;
 }
 }
 
-/*:1420*//*1421:*/
-#line 17000 "./marpa.w"
+/*:1622*//*1623:*/
+#line 21007 "./marpa.w"
 
 int _marpa_b_and_node_symbol(Marpa_Bocage b,
 Marpa_And_Node_ID and_node_id)
 {
 AND and_node;
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 21012 "./marpa.w"
 
-/*:1313*/
-#line 17005 "./marpa.w"
-
-/*1044:*/
-#line 12138 "./marpa.w"
+/*1226:*/
+#line 15682 "./marpa.w"
 
 const GRAMMAR g UNUSED= G_of_B(b);
 
-/*:1044*/
-#line 17006 "./marpa.w"
+/*:1226*/
+#line 21013 "./marpa.w"
 
-/*1417:*/
-#line 16935 "./marpa.w"
+/*1619:*/
+#line 20942 "./marpa.w"
 
 {
 if(and_node_id>=AND_Count_of_B(b))
@@ -24005,8 +28661,8 @@ and_node= and_nodes+and_node_id;
 }
 }
 
-/*:1417*/
-#line 17007 "./marpa.w"
+/*:1619*/
+#line 21014 "./marpa.w"
 
 {
 const OR cause_or= Cause_OR_of_AND(and_node);
@@ -24016,31 +28672,30 @@ return symbol_id;
 }
 }
 
-/*:1421*//*1422:*/
-#line 17016 "./marpa.w"
+/*:1623*//*1624:*/
+#line 21023 "./marpa.w"
 
 Marpa_Symbol_ID _marpa_b_and_node_token(Marpa_Bocage b,
 Marpa_And_Node_ID and_node_id,int*value_p)
 {
 AND and_node;
 OR cause_or;
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 21029 "./marpa.w"
 
-/*:1313*/
-#line 17022 "./marpa.w"
-
-/*1044:*/
-#line 12138 "./marpa.w"
+/*1226:*/
+#line 15682 "./marpa.w"
 
 const GRAMMAR g UNUSED= G_of_B(b);
 
-/*:1044*/
-#line 17023 "./marpa.w"
+/*:1226*/
+#line 21030 "./marpa.w"
 
-/*1417:*/
-#line 16935 "./marpa.w"
+/*1619:*/
+#line 20942 "./marpa.w"
 
 {
 if(and_node_id>=AND_Count_of_B(b))
@@ -24063,8 +28718,8 @@ and_node= and_nodes+and_node_id;
 }
 }
 
-/*:1417*/
-#line 17024 "./marpa.w"
+/*:1619*/
+#line 21031 "./marpa.w"
 
 
 cause_or= Cause_OR_of_AND(and_node);
@@ -24073,30 +28728,29 @@ if(value_p)*value_p= Value_of_OR(cause_or);
 return NSYID_of_OR(cause_or);
 }
 
-/*:1422*//*1423:*/
-#line 17039 "./marpa.w"
+/*:1624*//*1625:*/
+#line 21046 "./marpa.w"
 
 Marpa_Earley_Set_ID _marpa_b_and_node_middle(Marpa_Bocage b,
 Marpa_And_Node_ID and_node_id)
 {
 AND and_node;
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 21051 "./marpa.w"
 
-/*:1313*/
-#line 17044 "./marpa.w"
-
-/*1044:*/
-#line 12138 "./marpa.w"
+/*1226:*/
+#line 15682 "./marpa.w"
 
 const GRAMMAR g UNUSED= G_of_B(b);
 
-/*:1044*/
-#line 17045 "./marpa.w"
+/*:1226*/
+#line 21052 "./marpa.w"
 
-/*1417:*/
-#line 16935 "./marpa.w"
+/*1619:*/
+#line 20942 "./marpa.w"
 
 {
 if(and_node_id>=AND_Count_of_B(b))
@@ -24119,8 +28773,8 @@ and_node= and_nodes+and_node_id;
 }
 }
 
-/*:1417*/
-#line 17046 "./marpa.w"
+/*:1619*/
+#line 21053 "./marpa.w"
 
 {
 const OR predecessor_or= Predecessor_OR_of_AND(and_node);
@@ -24132,49 +28786,48 @@ return YS_Ord_of_OR(predecessor_or);
 return Origin_Ord_of_OR(OR_of_AND(and_node));
 }
 
-/*:1423*//*1426:*/
-#line 17079 "./marpa.w"
+/*:1625*//*1628:*/
+#line 21086 "./marpa.w"
 
 int _marpa_t_nook_or_node(Marpa_Tree t,int nook_id)
 {
 NOOK nook;
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 21090 "./marpa.w"
 
-/*:1313*/
-#line 17083 "./marpa.w"
-
-/*1117:*/
-#line 13011 "./marpa.w"
+/*1299:*/
+#line 16567 "./marpa.w"
 
 ORDER o= O_of_T(t);
-/*1089:*/
-#line 12543 "./marpa.w"
+/*1271:*/
+#line 16099 "./marpa.w"
 
 const BOCAGE b= B_of_O(o);
-/*1044:*/
-#line 12138 "./marpa.w"
+/*1226:*/
+#line 15682 "./marpa.w"
 
 const GRAMMAR g UNUSED= G_of_B(b);
 
-/*:1044*/
-#line 12545 "./marpa.w"
+/*:1226*/
+#line 16101 "./marpa.w"
 
 
-/*:1089*/
-#line 13013 "./marpa.w"
+/*:1271*/
+#line 16569 "./marpa.w"
 ;
 
-/*:1117*/
-#line 17084 "./marpa.w"
+/*:1299*/
+#line 21091 "./marpa.w"
 
-/*1425:*/
-#line 17061 "./marpa.w"
+/*1627:*/
+#line 21068 "./marpa.w"
 {
 NOOK base_nook;
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -24185,8 +28838,8 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 17063 "./marpa.w"
+/*:1521*/
+#line 21070 "./marpa.w"
 
 if(T_is_Exhausted(t)){
 MARPA_ERROR(MARPA_ERR_BOCAGE_ITERATION_EXHAUSTED);
@@ -24203,55 +28856,54 @@ base_nook= FSTACK_BASE(t->t_nook_stack,NOOK_Object);
 nook= base_nook+nook_id;
 }
 
-/*:1425*/
-#line 17085 "./marpa.w"
+/*:1627*/
+#line 21092 "./marpa.w"
 
 return ID_of_OR(OR_of_NOOK(nook));
 }
 
-/*:1426*//*1427:*/
-#line 17089 "./marpa.w"
+/*:1628*//*1629:*/
+#line 21096 "./marpa.w"
 
 int _marpa_t_nook_choice(Marpa_Tree t,int nook_id)
 {
 NOOK nook;
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 21100 "./marpa.w"
 
-/*:1313*/
-#line 17093 "./marpa.w"
-
-/*1117:*/
-#line 13011 "./marpa.w"
+/*1299:*/
+#line 16567 "./marpa.w"
 
 ORDER o= O_of_T(t);
-/*1089:*/
-#line 12543 "./marpa.w"
+/*1271:*/
+#line 16099 "./marpa.w"
 
 const BOCAGE b= B_of_O(o);
-/*1044:*/
-#line 12138 "./marpa.w"
+/*1226:*/
+#line 15682 "./marpa.w"
 
 const GRAMMAR g UNUSED= G_of_B(b);
 
-/*:1044*/
-#line 12545 "./marpa.w"
+/*:1226*/
+#line 16101 "./marpa.w"
 
 
-/*:1089*/
-#line 13013 "./marpa.w"
+/*:1271*/
+#line 16569 "./marpa.w"
 ;
 
-/*:1117*/
-#line 17094 "./marpa.w"
+/*:1299*/
+#line 21101 "./marpa.w"
 
-/*1425:*/
-#line 17061 "./marpa.w"
+/*1627:*/
+#line 21068 "./marpa.w"
 {
 NOOK base_nook;
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -24262,8 +28914,8 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 17063 "./marpa.w"
+/*:1521*/
+#line 21070 "./marpa.w"
 
 if(T_is_Exhausted(t)){
 MARPA_ERROR(MARPA_ERR_BOCAGE_ITERATION_EXHAUSTED);
@@ -24280,55 +28932,54 @@ base_nook= FSTACK_BASE(t->t_nook_stack,NOOK_Object);
 nook= base_nook+nook_id;
 }
 
-/*:1425*/
-#line 17095 "./marpa.w"
+/*:1627*/
+#line 21102 "./marpa.w"
 
 return Choice_of_NOOK(nook);
 }
 
-/*:1427*//*1428:*/
-#line 17099 "./marpa.w"
+/*:1629*//*1630:*/
+#line 21106 "./marpa.w"
 
 int _marpa_t_nook_parent(Marpa_Tree t,int nook_id)
 {
 NOOK nook;
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 21110 "./marpa.w"
 
-/*:1313*/
-#line 17103 "./marpa.w"
-
-/*1117:*/
-#line 13011 "./marpa.w"
+/*1299:*/
+#line 16567 "./marpa.w"
 
 ORDER o= O_of_T(t);
-/*1089:*/
-#line 12543 "./marpa.w"
+/*1271:*/
+#line 16099 "./marpa.w"
 
 const BOCAGE b= B_of_O(o);
-/*1044:*/
-#line 12138 "./marpa.w"
+/*1226:*/
+#line 15682 "./marpa.w"
 
 const GRAMMAR g UNUSED= G_of_B(b);
 
-/*:1044*/
-#line 12545 "./marpa.w"
+/*:1226*/
+#line 16101 "./marpa.w"
 
 
-/*:1089*/
-#line 13013 "./marpa.w"
+/*:1271*/
+#line 16569 "./marpa.w"
 ;
 
-/*:1117*/
-#line 17104 "./marpa.w"
+/*:1299*/
+#line 21111 "./marpa.w"
 
-/*1425:*/
-#line 17061 "./marpa.w"
+/*1627:*/
+#line 21068 "./marpa.w"
 {
 NOOK base_nook;
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -24339,8 +28990,8 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 17063 "./marpa.w"
+/*:1521*/
+#line 21070 "./marpa.w"
 
 if(T_is_Exhausted(t)){
 MARPA_ERROR(MARPA_ERR_BOCAGE_ITERATION_EXHAUSTED);
@@ -24357,55 +29008,54 @@ base_nook= FSTACK_BASE(t->t_nook_stack,NOOK_Object);
 nook= base_nook+nook_id;
 }
 
-/*:1425*/
-#line 17105 "./marpa.w"
+/*:1627*/
+#line 21112 "./marpa.w"
 
 return Parent_of_NOOK(nook);
 }
 
-/*:1428*//*1429:*/
-#line 17109 "./marpa.w"
+/*:1630*//*1631:*/
+#line 21116 "./marpa.w"
 
 int _marpa_t_nook_cause_is_ready(Marpa_Tree t,int nook_id)
 {
 NOOK nook;
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 21120 "./marpa.w"
 
-/*:1313*/
-#line 17113 "./marpa.w"
-
-/*1117:*/
-#line 13011 "./marpa.w"
+/*1299:*/
+#line 16567 "./marpa.w"
 
 ORDER o= O_of_T(t);
-/*1089:*/
-#line 12543 "./marpa.w"
+/*1271:*/
+#line 16099 "./marpa.w"
 
 const BOCAGE b= B_of_O(o);
-/*1044:*/
-#line 12138 "./marpa.w"
+/*1226:*/
+#line 15682 "./marpa.w"
 
 const GRAMMAR g UNUSED= G_of_B(b);
 
-/*:1044*/
-#line 12545 "./marpa.w"
+/*:1226*/
+#line 16101 "./marpa.w"
 
 
-/*:1089*/
-#line 13013 "./marpa.w"
+/*:1271*/
+#line 16569 "./marpa.w"
 ;
 
-/*:1117*/
-#line 17114 "./marpa.w"
+/*:1299*/
+#line 21121 "./marpa.w"
 
-/*1425:*/
-#line 17061 "./marpa.w"
+/*1627:*/
+#line 21068 "./marpa.w"
 {
 NOOK base_nook;
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -24416,8 +29066,8 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 17063 "./marpa.w"
+/*:1521*/
+#line 21070 "./marpa.w"
 
 if(T_is_Exhausted(t)){
 MARPA_ERROR(MARPA_ERR_BOCAGE_ITERATION_EXHAUSTED);
@@ -24434,55 +29084,54 @@ base_nook= FSTACK_BASE(t->t_nook_stack,NOOK_Object);
 nook= base_nook+nook_id;
 }
 
-/*:1425*/
-#line 17115 "./marpa.w"
+/*:1627*/
+#line 21122 "./marpa.w"
 
 return NOOK_Cause_is_Expanded(nook);
 }
 
-/*:1429*//*1430:*/
-#line 17119 "./marpa.w"
+/*:1631*//*1632:*/
+#line 21126 "./marpa.w"
 
 int _marpa_t_nook_predecessor_is_ready(Marpa_Tree t,int nook_id)
 {
 NOOK nook;
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 21130 "./marpa.w"
 
-/*:1313*/
-#line 17123 "./marpa.w"
-
-/*1117:*/
-#line 13011 "./marpa.w"
+/*1299:*/
+#line 16567 "./marpa.w"
 
 ORDER o= O_of_T(t);
-/*1089:*/
-#line 12543 "./marpa.w"
+/*1271:*/
+#line 16099 "./marpa.w"
 
 const BOCAGE b= B_of_O(o);
-/*1044:*/
-#line 12138 "./marpa.w"
+/*1226:*/
+#line 15682 "./marpa.w"
 
 const GRAMMAR g UNUSED= G_of_B(b);
 
-/*:1044*/
-#line 12545 "./marpa.w"
+/*:1226*/
+#line 16101 "./marpa.w"
 
 
-/*:1089*/
-#line 13013 "./marpa.w"
+/*:1271*/
+#line 16569 "./marpa.w"
 ;
 
-/*:1117*/
-#line 17124 "./marpa.w"
+/*:1299*/
+#line 21131 "./marpa.w"
 
-/*1425:*/
-#line 17061 "./marpa.w"
+/*1627:*/
+#line 21068 "./marpa.w"
 {
 NOOK base_nook;
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -24493,8 +29142,8 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 17063 "./marpa.w"
+/*:1521*/
+#line 21070 "./marpa.w"
 
 if(T_is_Exhausted(t)){
 MARPA_ERROR(MARPA_ERR_BOCAGE_ITERATION_EXHAUSTED);
@@ -24511,55 +29160,54 @@ base_nook= FSTACK_BASE(t->t_nook_stack,NOOK_Object);
 nook= base_nook+nook_id;
 }
 
-/*:1425*/
-#line 17125 "./marpa.w"
+/*:1627*/
+#line 21132 "./marpa.w"
 
 return NOOK_Predecessor_is_Expanded(nook);
 }
 
-/*:1430*//*1431:*/
-#line 17129 "./marpa.w"
+/*:1632*//*1633:*/
+#line 21136 "./marpa.w"
 
 int _marpa_t_nook_is_cause(Marpa_Tree t,int nook_id)
 {
 NOOK nook;
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 21140 "./marpa.w"
 
-/*:1313*/
-#line 17133 "./marpa.w"
-
-/*1117:*/
-#line 13011 "./marpa.w"
+/*1299:*/
+#line 16567 "./marpa.w"
 
 ORDER o= O_of_T(t);
-/*1089:*/
-#line 12543 "./marpa.w"
+/*1271:*/
+#line 16099 "./marpa.w"
 
 const BOCAGE b= B_of_O(o);
-/*1044:*/
-#line 12138 "./marpa.w"
+/*1226:*/
+#line 15682 "./marpa.w"
 
 const GRAMMAR g UNUSED= G_of_B(b);
 
-/*:1044*/
-#line 12545 "./marpa.w"
+/*:1226*/
+#line 16101 "./marpa.w"
 
 
-/*:1089*/
-#line 13013 "./marpa.w"
+/*:1271*/
+#line 16569 "./marpa.w"
 ;
 
-/*:1117*/
-#line 17134 "./marpa.w"
+/*:1299*/
+#line 21141 "./marpa.w"
 
-/*1425:*/
-#line 17061 "./marpa.w"
+/*1627:*/
+#line 21068 "./marpa.w"
 {
 NOOK base_nook;
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -24570,8 +29218,8 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 17063 "./marpa.w"
+/*:1521*/
+#line 21070 "./marpa.w"
 
 if(T_is_Exhausted(t)){
 MARPA_ERROR(MARPA_ERR_BOCAGE_ITERATION_EXHAUSTED);
@@ -24588,55 +29236,54 @@ base_nook= FSTACK_BASE(t->t_nook_stack,NOOK_Object);
 nook= base_nook+nook_id;
 }
 
-/*:1425*/
-#line 17135 "./marpa.w"
+/*:1627*/
+#line 21142 "./marpa.w"
 
 return NOOK_is_Cause(nook);
 }
 
-/*:1431*//*1432:*/
-#line 17139 "./marpa.w"
+/*:1633*//*1634:*/
+#line 21146 "./marpa.w"
 
 int _marpa_t_nook_is_predecessor(Marpa_Tree t,int nook_id)
 {
 NOOK nook;
-/*1313:*/
-#line 15629 "./marpa.w"
+/*1500:*/
+#line 19380 "./marpa.w"
 const int failure_indicator= -2;
+/*:1500*/
+#line 21150 "./marpa.w"
 
-/*:1313*/
-#line 17143 "./marpa.w"
-
-/*1117:*/
-#line 13011 "./marpa.w"
+/*1299:*/
+#line 16567 "./marpa.w"
 
 ORDER o= O_of_T(t);
-/*1089:*/
-#line 12543 "./marpa.w"
+/*1271:*/
+#line 16099 "./marpa.w"
 
 const BOCAGE b= B_of_O(o);
-/*1044:*/
-#line 12138 "./marpa.w"
+/*1226:*/
+#line 15682 "./marpa.w"
 
 const GRAMMAR g UNUSED= G_of_B(b);
 
-/*:1044*/
-#line 12545 "./marpa.w"
+/*:1226*/
+#line 16101 "./marpa.w"
 
 
-/*:1089*/
-#line 13013 "./marpa.w"
+/*:1271*/
+#line 16569 "./marpa.w"
 ;
 
-/*:1117*/
-#line 17144 "./marpa.w"
+/*:1299*/
+#line 21151 "./marpa.w"
 
-/*1425:*/
-#line 17061 "./marpa.w"
+/*1627:*/
+#line 21068 "./marpa.w"
 {
 NOOK base_nook;
-/*1333:*/
-#line 15762 "./marpa.w"
+/*1521:*/
+#line 19518 "./marpa.w"
 
 if(HEADER_VERSION_MISMATCH){
 MARPA_ERROR(MARPA_ERR_HEADERS_DO_NOT_MATCH);
@@ -24647,8 +29294,8 @@ MARPA_ERROR(g->t_error);
 return failure_indicator;
 }
 
-/*:1333*/
-#line 17063 "./marpa.w"
+/*:1521*/
+#line 21070 "./marpa.w"
 
 if(T_is_Exhausted(t)){
 MARPA_ERROR(MARPA_ERR_BOCAGE_ITERATION_EXHAUSTED);
@@ -24665,22 +29312,22 @@ base_nook= FSTACK_BASE(t->t_nook_stack,NOOK_Object);
 nook= base_nook+nook_id;
 }
 
-/*:1425*/
-#line 17145 "./marpa.w"
+/*:1627*/
+#line 21152 "./marpa.w"
 
 return NOOK_is_Predecessor(nook);
 }
 
-/*:1432*//*1434:*/
-#line 17160 "./marpa.w"
+/*:1634*//*1636:*/
+#line 21167 "./marpa.w"
 
 void marpa_debug_handler_set(int(*debug_handler)(const char*,...))
 {
 marpa__debug_handler= debug_handler;
 }
 
-/*:1434*//*1435:*/
-#line 17166 "./marpa.w"
+/*:1636*//*1637:*/
+#line 21173 "./marpa.w"
 
 int marpa_debug_level_set(int new_level)
 {
@@ -24690,8 +29337,8 @@ return old_level;
 }
 
 
-/*:1435*/
-#line 17350 "./marpa.w"
+/*:1637*/
+#line 21362 "./marpa.w"
 
 
-/*:1453*/
+/*:1655*/
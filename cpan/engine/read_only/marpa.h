@@ -42,7 +42,7 @@
 #define MARPA_MICRO_VERSION 0
 
 #line 1 "./marpa.h-err"
-#define MARPA_ERROR_COUNT 102
+#define MARPA_ERROR_COUNT 108
 #define MARPA_ERR_NONE 0
 #define MARPA_ERR_AHFA_IX_NEGATIVE 1
 #define MARPA_ERR_AHFA_IX_OOB 2
@@ -145,6 +145,12 @@
 #define MARPA_ERR_NOT_A_SEQUENCE 99
 #define MARPA_ERR_GRAMMAR_IS_TRIVIAL 100
 #define MARPA_ERR_BASE_GENERATION_MISMATCH 101
+#define MARPA_ERR_EARLEY_SET_FORGOTTEN 102
+#define MARPA_ERR_RECCE_IS_FORGETFUL 103
+#define MARPA_ERR_RECCE_IS_LINK_FREE 104
+#define MARPA_ERR_NO_SUCH_CHECKPOINT 105
+#define MARPA_ERR_INVALID_IMAGE 106
+#define MARPA_ERR_MEMORY_LIMIT 107
 
 
 #line 1 "./marpa.h-event"
@@ -172,28 +178,28 @@
 #define MARPA_STEP_INTERNAL2 6
 #define MARPA_STEP_INITIAL 7
 
-/*1456:*/
-#line 17354 "./marpa.w"
+/*1658:*/
+#line 21366 "./marpa.w"
 
 extern const int marpa_major_version;
 extern const int marpa_minor_version;
 extern const int marpa_micro_version;
 
-/*109:*/
-#line 1040 "./marpa.w"
+/*119:*/
+#line 1148 "./marpa.w"
 
 #define marpa_g_event_value(event) \
     ((event)->t_value)
-/*:109*//*295:*/
-#line 2722 "./marpa.w"
+/*:119*//*307:*/
+#line 2840 "./marpa.w"
 
 #define MARPA_KEEP_SEPARATION  0x1
-/*:295*//*299:*/
-#line 2762 "./marpa.w"
+/*:307*//*311:*/
+#line 2880 "./marpa.w"
 
 #define MARPA_PROPER_SEPARATION  0x2
-/*:299*//*1154:*/
-#line 13480 "./marpa.w"
+/*:311*//*1336:*/
+#line 17038 "./marpa.w"
 
 #define marpa_v_step_type(v) ((v)->t_step_type)
 #define marpa_v_token(v) \
@@ -213,146 +219,152 @@ extern const int marpa_micro_version;
 #define marpa_v_token_start_es_id(v) ((v)->t_token_start_ys_id)
 #define marpa_v_es_id(v) ((v)->t_ys_id)
 
-/*:1154*/
-#line 17359 "./marpa.w"
+/*:1336*/
+#line 21371 "./marpa.w"
 
-/*47:*/
-#line 656 "./marpa.w"
+/*49:*/
+#line 695 "./marpa.w"
 
 struct marpa_g;
 struct marpa_avl_table;
 typedef struct marpa_g*Marpa_Grammar;
-/*:47*//*551:*/
-#line 6032 "./marpa.w"
+/*:49*//*573:*/
+#line 6351 "./marpa.w"
 
 struct marpa_r;
 typedef struct marpa_r*Marpa_Recognizer;
 typedef Marpa_Recognizer Marpa_Recce;
-/*:551*//*670:*/
-#line 7194 "./marpa.w"
+/*:573*//*699:*/
+#line 7617 "./marpa.w"
 
 union _Marpa_PIM_Object;
-/*:670*//*933:*/
-#line 11116 "./marpa.w"
+/*:699*//*1106:*/
+#line 14579 "./marpa.w"
 
 struct marpa_traverser;
 typedef struct marpa_traverser*Marpa_Traverser;
-/*:933*//*977:*/
-#line 11632 "./marpa.w"
+/*:1106*//*1153:*/
+#line 15135 "./marpa.w"
 
 struct marpa_ltraverser;
 typedef struct marpa_ltraverser*Marpa_LTraverser;
-/*:977*//*1003:*/
-#line 11798 "./marpa.w"
+/*:1153*//*1182:*/
+#line 15317 "./marpa.w"
 
 struct marpa_ptraverser;
 typedef struct marpa_ptraverser*Marpa_PTraverser;
-/*:1003*//*1034:*/
-#line 12079 "./marpa.w"
+/*:1182*//*1216:*/
+#line 15621 "./marpa.w"
 
 struct marpa_bocage;
 typedef struct marpa_bocage*Marpa_Bocage;
-/*:1034*//*1076:*/
-#line 12445 "./marpa.w"
+/*:1216*//*1258:*/
+#line 16000 "./marpa.w"
 
 struct marpa_order;
 typedef struct marpa_order*Marpa_Order;
-/*:1076*//*1077:*/
-#line 12448 "./marpa.w"
+/*:1258*//*1259:*/
+#line 16003 "./marpa.w"
 
 typedef Marpa_Order ORDER;
-/*:1077*//*1114:*/
-#line 12983 "./marpa.w"
+/*:1259*//*1296:*/
+#line 16539 "./marpa.w"
 
 struct marpa_tree;
 typedef struct marpa_tree*Marpa_Tree;
-/*:1114*//*1149:*/
-#line 13436 "./marpa.w"
+/*:1296*//*1331:*/
+#line 16994 "./marpa.w"
 
 struct marpa_value;
 typedef struct marpa_value*Marpa_Value;
-/*:1149*/
-#line 17360 "./marpa.w"
+/*:1331*/
+#line 21372 "./marpa.w"
 
-/*91:*/
-#line 933 "./marpa.w"
+/*46:*/
+#line 651 "./marpa.w"
+
+typedef void*(*Marpa_Allocator)(void*context,void*p,
+size_t old_size,size_t new_size);
+
+/*:46*//*101:*/
+#line 1041 "./marpa.w"
 
 typedef int Marpa_Rank;
-/*:91*//*108:*/
-#line 1037 "./marpa.w"
+/*:101*//*118:*/
+#line 1145 "./marpa.w"
 
 struct marpa_event;
 typedef int Marpa_Event_Type;
-/*:108*//*134:*/
-#line 1221 "./marpa.w"
+/*:118*//*144:*/
+#line 1329 "./marpa.w"
 
 typedef int Marpa_Error_Code;
-/*:134*//*141:*/
-#line 1259 "./marpa.w"
+/*:144*//*151:*/
+#line 1367 "./marpa.w"
 
 typedef int Marpa_Symbol_ID;
-/*:141*//*215:*/
-#line 1901 "./marpa.w"
+/*:151*//*225:*/
+#line 2009 "./marpa.w"
 
 typedef int Marpa_NSY_ID;
-/*:215*//*253:*/
-#line 2178 "./marpa.w"
+/*:225*//*265:*/
+#line 2296 "./marpa.w"
 
 typedef int Marpa_Rule_ID;
-/*:253*//*327:*/
-#line 2918 "./marpa.w"
+/*:265*//*339:*/
+#line 3036 "./marpa.w"
 
 typedef int Marpa_IRL_ID;
-/*:327*//*452:*/
-#line 4854 "./marpa.w"
+/*:339*//*471:*/
+#line 5092 "./marpa.w"
 
 typedef int Marpa_AHM_ID;
-/*:452*//*536:*/
-#line 5824 "./marpa.w"
+/*:471*//*558:*/
+#line 6143 "./marpa.w"
 
 typedef int Marpa_Assertion_ID;
 
-/*:536*//*627:*/
-#line 6720 "./marpa.w"
+/*:558*//*651:*/
+#line 7053 "./marpa.w"
 typedef int Marpa_Earleme;
-/*:627*//*629:*/
-#line 6724 "./marpa.w"
+/*:651*//*653:*/
+#line 7057 "./marpa.w"
 typedef int Marpa_Earley_Set_ID;
-/*:629*//*652:*/
-#line 6929 "./marpa.w"
+/*:653*//*676:*/
+#line 7276 "./marpa.w"
 typedef int Marpa_Earley_Item_ID;
-/*:652*//*671:*/
-#line 7196 "./marpa.w"
+/*:676*//*700:*/
+#line 7619 "./marpa.w"
 
 typedef union _Marpa_PIM_Object*_Marpa_PIM;
-/*:671*//*685:*/
-#line 7308 "./marpa.w"
+/*:700*//*714:*/
+#line 7731 "./marpa.w"
 
 struct marpa_source_link_s;
 typedef struct marpa_source_link_s*MARPA_SRCL;
-/*:685*//*878:*/
-#line 10289 "./marpa.w"
+/*:714*//*1051:*/
+#line 13751 "./marpa.w"
 
 typedef int Marpa_Or_Node_ID;
-/*:878*//*926:*/
-#line 11052 "./marpa.w"
+/*:1051*//*1099:*/
+#line 14515 "./marpa.w"
 
 typedef int Marpa_And_Node_ID;
-/*:926*//*1144:*/
-#line 13389 "./marpa.w"
+/*:1099*//*1326:*/
+#line 16947 "./marpa.w"
 
 typedef int Marpa_Nook_ID;
-/*:1144*//*1195:*/
-#line 13905 "./marpa.w"
+/*:1326*//*1377:*/
+#line 17464 "./marpa.w"
 
 typedef int Marpa_Step_Type;
-/*:1195*//*1343:*/
-#line 15884 "./marpa.w"
+/*:1377*//*1531:*/
+#line 19640 "./marpa.w"
 
 typedef const char*Marpa_Message_ID;
 
-/*:1343*/
-#line 17361 "./marpa.w"
+/*:1531*/
+#line 21373 "./marpa.w"
 
 /*44:*/
 #line 610 "./marpa.w"
@@ -361,19 +373,45 @@ struct marpa_config{
 int t_is_ok;
 Marpa_Error_Code t_error;
 const char*t_error_string;
+Marpa_Allocator t_allocator;
+void*t_allocator_context;
 };
 typedef struct marpa_config Marpa_Config;
 
-/*:44*//*110:*/
-#line 1043 "./marpa.w"
+/*:44*//*120:*/
+#line 1151 "./marpa.w"
 
 struct marpa_event{
 Marpa_Event_Type t_type;
 int t_value;
 };
 typedef struct marpa_event Marpa_Event;
-/*:110*//*832:*/
-#line 9646 "./marpa.w"
+/*:120*//*383:*/
+#line 3423 "./marpa.w"
+
+struct marpa_precompute_stats{
+double t_census_ns;
+double t_closure_ns;
+double t_loop_ns;
+double t_rewrite_ns;
+double t_ahm_ns;
+double t_prediction_matrix_ns;
+double t_cil_ns;
+double t_event_ns;
+double t_total_ns;
+int t_xsy_count;
+int t_xrl_count;
+int t_nsy_count;
+int t_irl_count;
+int t_ahm_count;
+int t_cil_count;
+size_t t_precompute_obstack_bytes;
+size_t t_grammar_obstack_bytes;
+};
+typedef struct marpa_precompute_stats Marpa_Precompute_Stats;
+
+/*:383*//*1001:*/
+#line 12963 "./marpa.w"
 
 struct marpa_progress_item{
 Marpa_Rule_ID t_rule_id;
@@ -381,8 +419,8 @@ int t_position;
 int t_origin;
 };
 
-/*:832*//*1153:*/
-#line 13466 "./marpa.w"
+/*:1001*//*1335:*/
+#line 17024 "./marpa.w"
 
 struct marpa_value{
 Marpa_Step_Type t_step_type;
@@ -396,43 +434,48 @@ Marpa_Earley_Set_ID t_token_start_ys_id;
 Marpa_Earley_Set_ID t_rule_start_ys_id;
 Marpa_Earley_Set_ID t_ys_id;
 };
-/*:1153*/
-#line 17362 "./marpa.w"
+/*:1335*/
+#line 21374 "./marpa.w"
 
-/*1342:*/
-#line 15881 "./marpa.w"
+/*1530:*/
+#line 19637 "./marpa.w"
 
 extern void*(*const marpa__out_of_memory)(void);
 
-/*:1342*//*1433:*/
-#line 17155 "./marpa.w"
+/*:1530*//*1635:*/
+#line 21162 "./marpa.w"
 
 extern int marpa__default_debug_handler(const char*format,...);
 extern int(*marpa__debug_handler)(const char*,...);
 extern int marpa__debug_level;
 
-/*:1433*/
-#line 17363 "./marpa.w"
+/*:1635*/
+#line 21375 "./marpa.w"
 
-/*411:*/
-#line 4074 "./marpa.w"
+/*430:*/
+#line 4312 "./marpa.w"
 
 int _marpa_g_irl_is_chaf(
 Marpa_Grammar g,
 Marpa_IRL_ID irl_id);
-/*:411*/
-#line 17364 "./marpa.w"
+/*:430*/
+#line 21376 "./marpa.w"
 
 
-/*:1456*/
+/*:1658*/
 
 #line 1 "./marpa.h.p80"
 Marpa_Error_Code marpa_check_version (int required_major, int required_minor, int required_micro );
 Marpa_Error_Code marpa_version (int* version);
 int marpa_c_init ( Marpa_Config* config);
 Marpa_Error_Code marpa_c_error ( Marpa_Config* config, const char** p_error_string );
+int marpa_c_allocator_set ( Marpa_Config* config, Marpa_Allocator allocator, void* context );
 Marpa_Grammar marpa_g_new ( Marpa_Config* configuration );
+int marpa_g_serialize (Marpa_Grammar g, void *buffer, int buffer_size);
+Marpa_Grammar marpa_g_deserialize ( Marpa_Config* configuration, const void *image, int image_size);
 int marpa_g_force_valued ( Marpa_Grammar g );
+size_t marpa_g_chunk_cache_max_set (Marpa_Grammar g, size_t max);
+size_t marpa_g_chunk_cache_max (Marpa_Grammar g);
 Marpa_Grammar marpa_g_ref (Marpa_Grammar g);
 void marpa_g_unref (Marpa_Grammar g);
 Marpa_Symbol_ID marpa_g_start_symbol (Marpa_Grammar g);
@@ -477,10 +520,16 @@ int marpa_g_symbol_is_prediction_event_set ( Marpa_Grammar g, Marpa_Symbol_ID sy
 int marpa_g_precompute (Marpa_Grammar g);
 int marpa_g_is_precomputed (Marpa_Grammar g);
 int marpa_g_has_cycle (Marpa_Grammar g);
+int marpa_g_precompute_stats (Marpa_Grammar g, Marpa_Precompute_Stats* stats);
 Marpa_Recognizer marpa_r_new ( Marpa_Grammar g );
+int marpa_r_serialize (Marpa_Recognizer r, void *buffer, int buffer_size);
+Marpa_Recognizer marpa_r_deserialize (Marpa_Grammar g, const void *image, int image_size);
 Marpa_Recognizer marpa_r_ref (Marpa_Recognizer r);
 void marpa_r_unref (Marpa_Recognizer r);
 int marpa_r_start_input (Marpa_Recognizer r);
+int marpa_r_reset (Marpa_Recognizer r);
+Marpa_Earley_Set_ID marpa_r_checkpoint (Marpa_Recognizer r);
+Marpa_Earley_Set_ID marpa_r_rollback ( Marpa_Recognizer r, Marpa_Earley_Set_ID checkpoint);
 int marpa_r_alternative (Marpa_Recognizer r, Marpa_Symbol_ID token_id, int value, int length);
 int marpa_r_earleme_complete (Marpa_Recognizer r);
 Marpa_Earleme marpa_r_current_earleme (Marpa_Recognizer r);
@@ -494,6 +543,18 @@ int marpa_r_latest_earley_set_values_set ( Marpa_Recognizer r, int value, void*
 int marpa_r_completion_symbol_activate ( Marpa_Recognizer r, Marpa_Symbol_ID sym_id, int reactivate );
 int marpa_r_earley_item_warning_threshold_set (Marpa_Recognizer r, int threshold);
 int marpa_r_earley_item_warning_threshold (Marpa_Recognizer r);
+size_t marpa_r_memory_limit_set (Marpa_Recognizer r, size_t limit);
+size_t marpa_r_memory_limit (Marpa_Recognizer r);
+size_t marpa_r_memory_usage (Marpa_Recognizer r);
+size_t marpa_g_memory_usage (Marpa_Grammar g);
+size_t marpa_b_memory_usage (Marpa_Bocage b);
+int marpa_r_forgetful_set (Marpa_Recognizer r, int flag);
+int marpa_r_forgetful (Marpa_Recognizer r);
+int marpa_r_link_free_set (Marpa_Recognizer r, int flag);
+int marpa_r_link_free (Marpa_Recognizer r);
+int marpa_r_lookahead_filter_set (Marpa_Recognizer r, int flag);
+int marpa_r_lookahead_filter (Marpa_Recognizer r);
+int marpa_r_lookahead_add (Marpa_Recognizer r, Marpa_Symbol_ID symbol_id);
 int marpa_r_expected_symbol_event_set ( Marpa_Recognizer r, Marpa_Symbol_ID symbol_id, int value);
 int marpa_r_is_exhausted (Marpa_Recognizer r);
 int marpa_r_nulled_symbol_activate ( Marpa_Recognizer r, Marpa_Symbol_ID sym_id, int boolean );
@@ -504,6 +565,7 @@ int marpa_r_progress_report_reset ( Marpa_Recognizer r);
 int marpa_r_progress_report_start ( Marpa_Recognizer r, Marpa_Earley_Set_ID set_id);
 int marpa_r_progress_report_finish ( Marpa_Recognizer r );
 Marpa_Rule_ID marpa_r_progress_item ( Marpa_Recognizer r, int* position, Marpa_Earley_Set_ID* origin );
+int marpa_r_completed_rules ( Marpa_Recognizer r, Marpa_Earley_Set_ID set_id, Marpa_Rule_ID* buffer );
 Marpa_Traverser marpa_trv_new (Marpa_Recognizer r, Marpa_Earley_Set_ID earley_set_ID, Marpa_Earley_Item_ID earley_item_ID);
 Marpa_Traverser marpa_trv_ref (Marpa_Traverser trv);
 void marpa_trv_unref (Marpa_Traverser trv);
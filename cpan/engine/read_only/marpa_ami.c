@@ -26,21 +26,21 @@
  * It is not intended to be modified directly
  */
 
-/*30:*/
-#line 524 "./marpa_ami.w"
+/*34:*/
+#line 629 "./marpa_ami.w"
 
 
 #include "config.h"
 
-/*:30*//*31:*/
-#line 537 "./marpa_ami.w"
+/*:34*//*35:*/
+#line 642 "./marpa_ami.w"
 
 
 #include <stdarg.h> 
 #include <stdio.h> 
 
-/*:31*//*32:*/
-#line 542 "./marpa_ami.w"
+/*:35*//*36:*/
+#line 647 "./marpa_ami.w"
 
 
 #ifndef MARPA_DEBUG
@@ -57,19 +57,19 @@
 #define PRIVATE static inline
 
 /*:5*/
-#line 551 "./marpa_ami.w"
+#line 656 "./marpa_ami.w"
 
 
-/*:32*/
+/*:36*/
 
 #line 1 "./marpa_ami.c.p40"
 
-/*33:*/
-#line 556 "./marpa_ami.w"
+/*37:*/
+#line 661 "./marpa_ami.w"
 
 
-/*20:*/
-#line 365 "./marpa_ami.w"
+/*24:*/
+#line 470 "./marpa_ami.w"
 
 int marpa__default_debug_handler(const char*format,...)
 {
@@ -82,8 +82,8 @@ return 1;
 }
 
 
-/*:20*/
-#line 558 "./marpa_ami.w"
+/*:24*/
+#line 663 "./marpa_ami.w"
 
 
-/*:33*/
+/*:37*/
@@ -26,8 +26,8 @@
  * It is not intended to be modified directly
  */
 
-/*27:*/
-#line 494 "./marpa_ami.w"
+/*31:*/
+#line 599 "./marpa_ami.w"
 
 
 #ifndef _MARPA_AMI_H__
@@ -41,8 +41,8 @@
 #define _MARPA_UNLIKELY(expr) (expr)
 #endif
 
-/*19:*/
-#line 356 "./marpa_ami.w"
+/*23:*/
+#line 461 "./marpa_ami.w"
 
 #define MARPA_OFF_DEBUG1(a)
 #define MARPA_OFF_DEBUG2(a, b)
@@ -50,8 +50,8 @@
 #define MARPA_OFF_DEBUG4(a, b, c, d)
 #define MARPA_OFF_DEBUG5(a, b, c, d, e)
 #define MARPA_OFF_ASSERT(expr)
-/*:19*//*21:*/
-#line 377 "./marpa_ami.w"
+/*:23*//*25:*/
+#line 482 "./marpa_ami.w"
 
 
 #ifndef MARPA_DEBUG
@@ -98,11 +98,11 @@
 #define MARPA_ASSERT(exp) 
 #endif
 
-/*:21*/
-#line 507 "./marpa_ami.w"
+/*:25*/
+#line 612 "./marpa_ami.w"
 
-/*22:*/
-#line 424 "./marpa_ami.w"
+/*26:*/
+#line 529 "./marpa_ami.w"
 
 
 #if     __GNUC__ >  2 || (__GNUC__ == 2 && __GNUC_MINOR__ >  4)
@@ -152,15 +152,15 @@
 # define alignof(type) (offsetof (struct { char __slot1; type __slot2; }, __slot2))
 #endif
 
-/*:22*/
-#line 508 "./marpa_ami.w"
+/*:26*/
+#line 613 "./marpa_ami.w"
 
-/*23:*/
-#line 474 "./marpa_ami.w"
+/*27:*/
+#line 579 "./marpa_ami.w"
 
 typedef unsigned int BITFIELD;
-/*22:*/
-#line 424 "./marpa_ami.w"
+/*26:*/
+#line 529 "./marpa_ami.w"
 
 
 #if     __GNUC__ >  2 || (__GNUC__ == 2 && __GNUC_MINOR__ >  4)
@@ -210,31 +210,39 @@ typedef unsigned int BITFIELD;
 # define alignof(type) (offsetof (struct { char __slot1; type __slot2; }, __slot2))
 #endif
 
-/*:22*/
-#line 476 "./marpa_ami.w"
+/*:26*/
+#line 581 "./marpa_ami.w"
 
 #define Boolean(value) ((value) ? 1 : 0)
 
-/*:23*/
-#line 509 "./marpa_ami.w"
+/*:27*/
+#line 614 "./marpa_ami.w"
 
 
 #define marpa_new(type,count) ((type*) my_malloc((sizeof(type) *((size_t) (count) ) ) ) ) 
 #define marpa_renew(type,p,count)  \
 ((type*) my_realloc((p) ,(sizeof(type) *((size_t) (count) ) ) ) )  \
 
+#define marpa_a_new(allocator,type,count)  \
+((type*) marpa__a_malloc((allocator) ,(sizeof(type) *((size_t) (count) ) ) ) ) 
+#define marpa_a_renew(allocator,type,p,count)  \
+((type*) marpa__a_realloc((allocator) ,(p) ,(sizeof(type) *((size_t) (count) ) ) ) )  \
+
 #define MARPA_DSTACK_DECLARE(this) struct marpa_dstack_s this
-#define MARPA_DSTACK_INIT(this,type,initial_size)  \
+#define MARPA_DSTACK_INIT(this,type,initial_size,allocator)  \
 ( \
 ((this) .t_count= 0) , \
-((this) .t_base= marpa_new(type,((this) .t_capacity= (initial_size) ) ) )  \
+((this) .t_allocator= *(allocator) ) , \
+((this) .t_base= marpa_a_new(&(this) .t_allocator,type, \
+((this) .t_capacity= (initial_size) ) ) )  \
 ) 
-#define MARPA_DSTACK_INIT2(this,type)  \
-MARPA_DSTACK_INIT((this) ,type,MAX(4,1024/sizeof(this) ) )  \
+#define MARPA_DSTACK_INIT2(this,type,allocator)  \
+MARPA_DSTACK_INIT((this) ,type,MAX(4,1024/sizeof(this) ) ,(allocator) )  \
 
 #define MARPA_DSTACK_IS_INITIALIZED(this) ((this) .t_base) 
 #define MARPA_DSTACK_SAFE(this)  \
-(((this) .t_count= (this) .t_capacity= 0) ,((this) .t_base= NULL) )  \
+(((this) .t_count= (this) .t_capacity= 0) ,((this) .t_base= NULL) , \
+((this) .t_allocator.t_function= NULL) )  \
 
 #define MARPA_DSTACK_COUNT_SET(this,n) ((this) .t_count= (n) )  \
 
@@ -255,38 +263,63 @@ MARPA_DSTACK_INIT((this) ,type,MAX(4,1024/sizeof(this) ) )  \
 #define MARPA_DSTACK_LENGTH(this) ((this) .t_count) 
 #define MARPA_DSTACK_CAPACITY(this) ((this) .t_capacity)  \
 
-#define MARPA_STOLEN_DSTACK_DATA_FREE(data) (my_free(data) ) 
-#define MARPA_DSTACK_DESTROY(this) MARPA_STOLEN_DSTACK_DATA_FREE(this.t_base) 
+#define MARPA_STOLEN_DSTACK_DATA_FREE(allocator,data) (marpa__a_free((allocator) ,(data) ) ) 
+#define MARPA_DSTACK_DESTROY(this)  \
+MARPA_STOLEN_DSTACK_DATA_FREE(&(this) .t_allocator,(this) .t_base) 
 #define MARPA_DSTACK_RESIZE(this,type,new_size)  \
 (marpa_dstack_resize((this) ,sizeof(type) ,(new_size) ) ) 
 
-#line 511 "./marpa_ami.w"
+#line 616 "./marpa_ami.w"
 
-/*14:*/
-#line 320 "./marpa_ami.w"
+/*9:*/
+#line 249 "./marpa_ami.w"
+
+struct marpa_allocator_s;
+typedef struct marpa_allocator_s*MARPA_ALLOCATOR;
+/*:9*//*18:*/
+#line 423 "./marpa_ami.w"
 
 struct marpa_dstack_s;
 typedef struct marpa_dstack_s*MARPA_DSTACK;
-/*:14*/
-#line 512 "./marpa_ami.w"
+/*:18*/
+#line 617 "./marpa_ami.w"
 
 
-/*:27*/
+/*:31*/
 static inline void * marpa_dstack_resize2( struct marpa_dstack_s* this, int type_bytes);
 static inline void * marpa_dstack_resize ( struct marpa_dstack_s *this, int type_bytes, int new_size);
-/*28:*/
-#line 515 "./marpa_ami.w"
+/*32:*/
+#line 620 "./marpa_ami.w"
+
+
+/*10:*/
+#line 252 "./marpa_ami.w"
+
+struct marpa_allocator_s{
+Marpa_Allocator t_function;
+void*t_context;
+};
+
+/*:10*//*11:*/
+#line 267 "./marpa_ami.w"
 
+union marpa_allocation_header{
+size_t t_size;
+double t_double;
+void*t_pointer;
+long t_long;
+};
 
-/*15:*/
-#line 323 "./marpa_ami.w"
+/*:11*//*19:*/
+#line 426 "./marpa_ami.w"
 
-struct marpa_dstack_s{int t_count;int t_capacity;void*t_base;};
-/*:15*/
-#line 517 "./marpa_ami.w"
+struct marpa_dstack_s{int t_count;int t_capacity;void*t_base;
+struct marpa_allocator_s t_allocator;};
+/*:19*/
+#line 622 "./marpa_ami.w"
 
-/*7:*/
-#line 200 "./marpa_ami.w"
+/*6:*/
+#line 197 "./marpa_ami.w"
 
 static inline
 void my_free(void*p)
@@ -294,8 +327,8 @@ void my_free(void*p)
 free(p);
 }
 
-/*:7*//*8:*/
-#line 207 "./marpa_ami.w"
+/*:6*//*7:*/
+#line 204 "./marpa_ami.w"
 
 
 static inline
@@ -327,16 +360,74 @@ return newmem;
 return my_malloc(size);
 }
 
-/*:8*//*16:*/
-#line 325 "./marpa_ami.w"
+/*:7*//*12:*/
+#line 275 "./marpa_ami.w"
+
+static inline
+void*marpa__a_malloc(MARPA_ALLOCATOR allocator,size_t size)
+{
+union marpa_allocation_header*header;
+if(_MARPA_LIKELY(!allocator||!allocator->t_function))
+return my_malloc(size);
+header= (*allocator->t_function)(allocator->t_context,NULL,0,
+sizeof(*header)+size);
+if(_MARPA_UNLIKELY(!header)){(*marpa__out_of_memory)();}
+header->t_size= size;
+return header+1;
+}
+
+static inline
+void*
+marpa__a_malloc0(MARPA_ALLOCATOR allocator,size_t size)
+{
+void*newmem= marpa__a_malloc(allocator,size);
+memset(newmem,0,size);
+return newmem;
+}
+
+static inline
+void*
+marpa__a_realloc(MARPA_ALLOCATOR allocator,void*p,size_t size)
+{
+union marpa_allocation_header*header;
+if(_MARPA_LIKELY(!allocator||!allocator->t_function))
+return my_realloc(p,size);
+if(!p)
+return marpa__a_malloc(allocator,size);
+header= (union marpa_allocation_header*)p-1;
+header= (*allocator->t_function)(allocator->t_context,header,
+sizeof(*header)+header->t_size,
+sizeof(*header)+size);
+if(_MARPA_UNLIKELY(!header)){(*marpa__out_of_memory)();}
+header->t_size= size;
+return header+1;
+}
+
+static inline
+void marpa__a_free(MARPA_ALLOCATOR allocator,void*p)
+{
+union marpa_allocation_header*header;
+if(_MARPA_LIKELY(!allocator||!allocator->t_function)){
+my_free(p);
+return;
+}
+if(!p)
+return;
+header= (union marpa_allocation_header*)p-1;
+(*allocator->t_function)(allocator->t_context,header,
+sizeof(*header)+header->t_size,0);
+}
+
+/*:12*//*20:*/
+#line 429 "./marpa_ami.w"
 
 static inline void*marpa_dstack_resize2(struct marpa_dstack_s*this,int type_bytes)
 {
 return marpa_dstack_resize(this,type_bytes,this->t_capacity*2);
 }
 
-/*:16*//*18:*/
-#line 334 "./marpa_ami.w"
+/*:20*//*22:*/
+#line 438 "./marpa_ami.w"
 
 static inline void*
 marpa_dstack_resize(struct marpa_dstack_s*this,int type_bytes,
@@ -346,15 +437,16 @@ if(new_size> this->t_capacity)
 {
 
 this->t_capacity= new_size;
-this->t_base= my_realloc(this->t_base,(size_t)new_size*(size_t)type_bytes);
+this->t_base= marpa__a_realloc(&this->t_allocator,this->t_base,
+(size_t)new_size*(size_t)type_bytes);
 }
 return this->t_base;
 }
 
-/*:18*/
-#line 518 "./marpa_ami.w"
+/*:22*/
+#line 623 "./marpa_ami.w"
 
 
 #endif 
 
-/*:28*/
+/*:32*/
@@ -39,12 +39,15 @@ typedef struct marpa_avl_node* NODE;
 
 /* Creates and returns a new table
    with comparison function |compare| using parameter |param|.
+   Its memory comes from |allocator|, or from the default
+   allocator if |allocator| is NULL.
    */
 MARPA_AVL_TREE 
-_marpa_avl_create (marpa_avl_comparison_func *compare, void *param)
+_marpa_avl_create (marpa_avl_comparison_func *compare, void *param,
+  struct marpa_allocator_s *allocator)
 {
   MARPA_AVL_TREE tree;
-  struct marpa_obstack *avl_obstack = marpa_obs_init;
+  struct marpa_obstack *avl_obstack = marpa_obs_init (allocator);
 
   assert (compare != NULL);
 
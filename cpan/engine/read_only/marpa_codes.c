@@ -139,6 +139,12 @@ const struct marpa_error_description_s marpa_error_description[] = {
   { 99, "MARPA_ERR_NOT_A_SEQUENCE", "Rule is not a sequence" },
   { 100, "MARPA_ERR_GRAMMAR_IS_TRIVIAL", "Grammar is trivial" },
   { 101, "MARPA_ERR_BASE_GENERATION_MISMATCH", "Base object generation does not match." },
+  { 102, "MARPA_ERR_EARLEY_SET_FORGOTTEN", "Earley set has been forgotten" },
+  { 103, "MARPA_ERR_RECCE_IS_FORGETFUL", "Recognizer is forgetful" },
+  { 104, "MARPA_ERR_RECCE_IS_LINK_FREE", "Recognizer is link-free" },
+  { 105, "MARPA_ERR_NO_SUCH_CHECKPOINT", "No checkpoint at this Earley set" },
+  { 106, "MARPA_ERR_INVALID_IMAGE", "Image is not valid" },
+  { 107, "MARPA_ERR_MEMORY_LIMIT", "Memory limit exceeded" },
 };
 
 
@@ -35,8 +35,41 @@
 #define MALLOC_OVERHEAD 32
 #define DEFAULT_CHUNK_SIZE (4096 - MALLOC_OVERHEAD)
 
+/* Get a chunk of SIZE bytes, from CACHE if possible.  */
+static struct marpa_obstack_chunk *
+chunk_new (struct marpa_allocator_s *allocator,
+  struct marpa_obstack_cache *cache, size_t size)
+{
+  if (cache && cache->chunks && size == DEFAULT_CHUNK_SIZE)
+    {
+      struct marpa_obstack_chunk *const chunk = cache->chunks;
+      cache->chunks = chunk->header.prev;
+      cache->allocated -= size;
+      return chunk;
+    }
+  return marpa__a_malloc (allocator, size);
+}
+
+/* Give CHUNK back to CACHE, if it will fit, or else free it.  */
+static void
+chunk_free (struct marpa_allocator_s *allocator,
+  struct marpa_obstack_cache *cache, struct marpa_obstack_chunk *chunk)
+{
+  const size_t size = chunk->header.size;
+  if (cache && size == DEFAULT_CHUNK_SIZE
+      && cache->allocated + size <= cache->max)
+    {
+      chunk->header.prev = cache->chunks;
+      cache->chunks = chunk;
+      cache->allocated += size;
+      return;
+    }
+  marpa__a_free (allocator, chunk);
+}
+
 struct marpa_obstack *
-marpa__obs_begin (size_t size)
+marpa__obs_begin (struct marpa_allocator_s *allocator,
+  struct marpa_obstack_cache *cache, size_t size)
 {
   struct marpa_obstack_chunk *chunk;	/* points to new chunk */
   struct marpa_obstack *h;	/* points to new obstack */
@@ -45,7 +78,7 @@ marpa__obs_begin (size_t size)
 
   /* We ignore |size| if it specifies less than the default */
   size = MAX ((int)DEFAULT_CHUNK_SIZE, size);
-  chunk_base = my_malloc (size);
+  chunk_base = (char *) chunk_new (allocator, cache, size);
 
   /* The chunk header goes at the beginning */
   chunk = (struct marpa_obstack_chunk*)chunk_base;
@@ -59,6 +92,15 @@ marpa__obs_begin (size_t size)
   h = (struct marpa_obstack *)object_base;
   h->chunk = chunk;
   h->minimum_chunk_size = size;
+  h->spare = 0;
+  h->allocated = size;
+  if (allocator)
+    h->allocator = *allocator;
+  else
+    h->allocator.t_function = NULL;
+  h->cache = cache;
+  if (cache)
+    cache->ref_count++;
 
   /* Set the obstack to "idle" with the pointer just after the
      obstack header */
@@ -96,8 +138,28 @@ marpa__obs_newchunk (struct marpa_obstack *h, size_t length, size_t alignment)
   new_size = contents_offset + space_needed_for_alignment + length;
   new_size = MAX(new_size, h->minimum_chunk_size);
 
-  /* Allocate and initialize the new chunk.  */
-  new_chunk = my_malloc( new_size);
+  /* Reuse a spare chunk, if one is big enough.
+     Otherwise allocate and initialize the new chunk.  */
+  {
+    struct marpa_obstack_chunk **p_spare = &h->spare;
+    new_chunk = 0;
+    while (*p_spare)
+      {
+        if ((*p_spare)->header.size >= new_size)
+          {
+            new_chunk = *p_spare;
+            *p_spare = new_chunk->header.prev;
+            new_size = new_chunk->header.size;
+            break;
+          }
+        p_spare = &(*p_spare)->header.prev;
+      }
+  }
+  if (!new_chunk)
+    {
+      new_chunk = chunk_new (&h->allocator, h->cache, new_size);
+      h->allocated += new_size;
+    }
   h->chunk = new_chunk;
   new_chunk->header.prev = old_chunk;
   new_chunk->header.size = new_size;
@@ -107,22 +169,114 @@ marpa__obs_newchunk (struct marpa_obstack *h, size_t length, size_t alignment)
   return h->object_base;
 }
 
+/* Rewind H to MARK, discarding all objects allocated since.
+   The chunks allocated since MARK are moved to the spare list,
+   from which |marpa__obs_newchunk| reuses them.
+   The chunk current at the time of the mark is never
+   freed, because it is still on the chunk list.  */
+void
+marpa__obs_rewind (struct marpa_obstack *h,
+  const struct marpa_obstack_mark *mark)
+{
+  while (h->chunk != mark->chunk)
+    {
+      struct marpa_obstack_chunk *const chunk = h->chunk;
+      h->chunk = chunk->header.prev;
+      chunk->header.prev = h->spare;
+      h->spare = chunk;
+    }
+  h->next_free = h->object_base = mark->next_free;
+}
+
+/* Free the spare chunks of H, so that an obstack which has been
+   rewound after growing too large gives its memory back.  */
+void
+marpa__obs_spares_free (struct marpa_obstack *h)
+{
+  while (h->spare)
+    {
+      struct marpa_obstack_chunk *const chunk = h->spare;
+      h->spare = chunk->header.prev;
+      h->allocated -= chunk->header.size;
+      chunk_free (&h->allocator, h->cache, chunk);
+    }
+}
+
 /* Free everything in H.  */
 void
 marpa__obs_free (struct marpa_obstack *h)
 {
   struct marpa_obstack_chunk *lp;       /* below addr of any objects in this chunk */
   struct marpa_obstack_chunk *plp;      /* point to previous chunk if any */
+  struct marpa_allocator_s allocator;   /* copied, because H is in a chunk */
+  struct marpa_obstack_cache *cache;
 
   if (!h)
     return;                     /* Return safely if never initialized */
+  allocator = h->allocator;
+  cache = h->cache;
+  lp = h->spare;
+  while (lp != 0)
+    {
+      plp = lp->header.prev;
+      chunk_free (&allocator, cache, lp);
+      lp = plp;
+    }
   lp = h->chunk;
   while (lp != 0)
     {
       plp = lp->header.prev;
-      my_free (lp);
+      chunk_free (&allocator, cache, lp);
       lp = plp;
     }
+  if (cache)
+    marpa__obs_cache_unref (cache);
+}
+
+/* Create a chunk cache which keeps at most MAX bytes of free chunks.
+   The caller holds the only reference to it.  */
+struct marpa_obstack_cache *
+marpa__obs_cache_new (struct marpa_allocator_s *allocator, size_t max)
+{
+  struct marpa_obstack_cache *const cache =
+    marpa__a_malloc (allocator, sizeof (*cache));
+  cache->chunks = 0;
+  cache->allocated = 0;
+  cache->max = max;
+  cache->ref_count = 1;
+  if (allocator)
+    cache->allocator = *allocator;
+  else
+    cache->allocator.t_function = NULL;
+  return cache;
+}
+
+/* Change the most bytes of free chunks that CACHE keeps,
+   freeing chunks if it now holds too many.  */
+void
+marpa__obs_cache_max_set (struct marpa_obstack_cache *cache, size_t max)
+{
+  cache->max = max;
+  while (cache->allocated > max)
+    {
+      struct marpa_obstack_chunk *const chunk = cache->chunks;
+      cache->chunks = chunk->header.prev;
+      cache->allocated -= chunk->header.size;
+      marpa__a_free (&cache->allocator, chunk);
+    }
+}
+
+/* Drop a reference to CACHE, destroying it and
+   freeing its chunks when the last reference is gone.  */
+void
+marpa__obs_cache_unref (struct marpa_obstack_cache *cache)
+{
+  struct marpa_allocator_s allocator;
+  if (--cache->ref_count > 0)
+    return;
+  marpa__obs_cache_max_set (cache, 0);
+  allocator = cache->allocator;
+  marpa__a_free (&allocator, cache);
 }
 
 /* vim: set expandtab shiftwidth=4: */
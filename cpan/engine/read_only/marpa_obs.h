@@ -70,6 +70,30 @@ struct marpa_obstack    /* control current object in current chunk */
   char *object_base;
   char *next_free;
   size_t minimum_chunk_size;              /* preferred size to allocate chunks in */
+  struct marpa_obstack_chunk *spare;    /* chunks kept by a rewind, for reuse */
+  size_t allocated;                     /* bytes in all chunks, spares included */
+  struct marpa_allocator_s allocator;   /* allocator for the chunks, copied */
+  struct marpa_obstack_cache *cache;    /* cache of free chunks, or NULL */
+};
+
+/* A cache of free chunks, shared by the obstacks begun from it.
+   When one of those obstacks is freed, its chunks go back to the cache,
+   up to |max| bytes of them, instead of to the allocator,
+   and new obstacks take their chunks from the cache first.
+   Applications which create and free many short-lived obstacks
+   therefore stop calling malloc.
+   Only chunks of the default size are cached.
+   The cache is reference counted.
+   Its creator holds one reference,
+   and each obstack begun from it holds another,
+   so that the cache outlives all of its obstacks.  */
+struct marpa_obstack_cache
+{
+  struct marpa_obstack_chunk *chunks;   /* free chunks, linked by |prev| */
+  size_t allocated;                     /* bytes in the free chunks */
+  size_t max;                           /* most bytes of free chunks to keep */
+  int ref_count;
+  struct marpa_allocator_s allocator;   /* allocator for the chunks, copied */
 };
 
 struct marpa_obstack_chunk_header               /* Lives at front of each chunk. */
@@ -87,23 +111,70 @@ struct marpa_obstack_chunk
 
 extern void* marpa__obs_newchunk (struct marpa_obstack *, size_t, size_t);
 
-extern struct marpa_obstack* marpa__obs_begin (size_t);
+extern struct marpa_obstack* marpa__obs_begin (struct marpa_allocator_s *,
+  struct marpa_obstack_cache *, size_t);
 
 void marpa__obs_free (struct marpa_obstack *__obstack);
 
+struct marpa_obstack_cache *marpa__obs_cache_new (struct marpa_allocator_s *,
+  size_t max);
+void marpa__obs_cache_unref (struct marpa_obstack_cache *cache);
+void marpa__obs_cache_max_set (struct marpa_obstack_cache *cache, size_t max);
+
+/* A mark records a point in the obstack, to which it
+   can later be rewound.
+   Rewinding discards every object allocated since the mark,
+   but keeps the chunks for reuse, so that an obstack
+   which is repeatedly filled and rewound
+   stops calling malloc once it has reached its high water mark.
+   The mark must have been taken while the obstack was idle.  */
+struct marpa_obstack_mark
+{
+  struct marpa_obstack_chunk *chunk;
+  char *next_free;
+};
+
+void marpa__obs_rewind (struct marpa_obstack *h,
+  const struct marpa_obstack_mark *mark);
+
+/* Free the chunks kept for reuse by rewinds.  */
+void marpa__obs_spares_free (struct marpa_obstack *h);
+
 /* Pointer to beginning of object being allocated or to be allocated next.
    Note that this might not be the final address of the object
    because a new chunk might be needed to hold the final size.  */
 
 #define marpa_obs_base(h) ((void *) (h)->object_base)
 
-#define marpa_obs_init  marpa__obs_begin (0)
+/* All the chunks of an obstack come from ALLOCATOR,
+   which may be NULL for the default allocator.  */
+#define marpa_obs_init(allocator)  marpa__obs_begin ((allocator), NULL, 0)
+
+/* An obstack whose chunks come from, and return to, CACHE.  */
+#define marpa_obs_cache_init(cache) \
+  marpa__obs_begin (&(cache)->allocator, (cache), 0)
+
+/* The number of bytes in the free chunks of CACHE.  */
+#define marpa_obs_cache_allocated(cache) ((cache)->allocated)
+#define marpa_obs_cache_max(cache) ((cache)->max)
+
+/* The number of bytes malloc'ed for the obstack.
+   Chunks kept for reuse by a rewind are counted, because
+   they are still allocated.  */
+#define marpa_obs_allocated(h) ((h)->allocated)
 
 # define marpa_obstack_object_size(h) \
  (unsigned) ((h)->next_free - (h)->object_base)
 
 # define marpa_obs_free(h)      (marpa__obs_free((h)))
 
+# define marpa_obs_mark(h, mark) \
+  ((mark)->chunk = (h)->chunk, (mark)->next_free = (h)->next_free)
+
+# define marpa_obs_rewind(h, mark) (marpa__obs_rewind((h), (mark)))
+
+# define marpa_obs_spares_free(h) (marpa__obs_spares_free(h))
+
 /* Reject any object being built, as if it never existed */
 # define marpa_obs_reject(h) \
   ((h)->next_free = (h)->object_base)
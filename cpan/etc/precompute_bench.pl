@@ -0,0 +1,114 @@
+#!perl
+# Copyright 2017 Jeffrey Kegler
+# Marpa::R3 is Copyright (C) 2017, Jeffrey Kegler.
+#
+# This module is free software; you can redistribute it and/or modify it
+# under the same terms as Perl 5.10.1. For more details, see the full text
+# of the licenses in the directory LICENSES.
+#
+# This program is distributed in the hope that it will be
+# useful, but it is provided "as is" and without any express
+# or implied warranties. For details, see the full text of
+# of the licenses in the directory LICENSES.
+
+# Times marpa_g_precompute() on large generated grammars.
+# Precomputation is dominated by the transitive closures
+# of symbol-by-symbol and rule-by-rule matrices,
+# so that this tracks them.
+#
+# Run it from the cpan directory, after building:
+#
+#     perl -Mblib etc/precompute_bench.pl [symbol_count ...]
+#
+# The grammars are built directly with Kollos,
+# so that the SLIF does not add to the times.
+
+use 5.010001;
+use strict;
+use warnings;
+use English qw( -no_match_vars );
+use Getopt::Long;
+
+use Marpa::R3;
+
+my $seed   = 42;
+my $repeat = 1;
+die "usage: $PROGRAM_NAME [--seed=n] [--repeat=n] [symbol_count ...]\n"
+  if not Getopt::Long::GetOptions(
+    'seed=i'   => \$seed,
+    'repeat=i' => \$repeat,
+  );
+my @symbol_counts = @ARGV ? @ARGV : ( 1000, 5000, 20000 );
+
+# Each shape is Lua code which adds the rules for symbols
+# 1 to `n` to `grammar`, using `sym`, an array of their IDs.
+# `term` is the ID of a terminal.
+my %rules_by_shape = (
+
+    # A long right-recursive chain -- every symbol
+    # right-derives every later symbol.
+    chain => <<'END_OF_LUA',
+    for i = 1, n - 1 do
+        grammar:rule_new{sym[i], term, sym[i+1]}
+        grammar:rule_new{sym[i], sym[i+1]}
+    end
+    grammar:rule_new{sym[n], term}
+END_OF_LUA
+
+    # Sparse random rules, mostly referring to later symbols,
+    # with some back references, so that there are cycles
+    # of recursion of all sizes.
+    random => <<'END_OF_LUA',
+    for i = 1, n do
+        local seen = {}
+        for _ = 1, 3 do
+            local rule = { sym[i], term }
+            for _ = 1, math.random(0, 2) do
+                local j = i + math.random(1, 20)
+                if math.random() < 0.02 then j = math.random(1, n) end
+                if j <= n then rule[#rule+1] = sym[j] end
+            end
+            local key = table.concat(rule, ' ')
+            if not seen[key] then
+                seen[key] = true
+                grammar:rule_new(rule)
+            end
+        end
+        grammar:rule_new{sym[i]}
+    end
+END_OF_LUA
+
+);
+
+my $template = <<'END_OF_LUA';
+    local n, seed = %d, %d
+    math.randomseed(seed)
+    local grammar = kollos.grammar_new()
+    local sym = {}
+    for i = 1, n do
+        sym[i] = grammar:symbol_new('S' .. i).id
+    end
+    local term = grammar:symbol_new('term').id
+    grammar:start_symbol_set(sym[1])
+%s
+    local rule_count = grammar:highest_rule_id() + 1
+    local start = os.clock()
+    grammar:precompute()
+    return rule_count, os.clock() - start
+END_OF_LUA
+
+printf "%-8s %8s %8s %10s\n", qw(shape symbols rules seconds);
+for my $shape ( sort keys %rules_by_shape ) {
+    for my $symbol_count (@symbol_counts) {
+        my $code =
+          sprintf $template, $symbol_count, $seed, $rules_by_shape{$shape};
+        for ( 1 .. $repeat ) {
+            my $lua = Marpa::R3::Lua->new();
+            my ( $rule_count, $seconds ) = $lua->exec($code);
+            printf "%-8s %8d %8d %10.3f\n", $shape, $symbol_count,
+              $rule_count, $seconds;
+        }
+    }
+}
+
+# vim: expandtab shiftwidth=4:
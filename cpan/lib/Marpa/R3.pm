@@ -68,10 +68,6 @@ require Marpa::R3::Common;
 ( $version_result = version_ok($Marpa::R3::Common::VERSION) )
     and die 'Marpa::R3::Common::VERSION ', $version_result;
 
-require Marpa::R3::MetaG;
-( $version_result = version_ok($Marpa::R3::MetaG::VERSION) )
-    and die 'Marpa::R3::MetaG::VERSION ', $version_result;
-
 require Marpa::R3::SLG;
 ( $version_result = version_ok($Marpa::R3::Grammar::VERSION) )
     and die 'Marpa::R3::Grammar::VERSION ', $version_result;
@@ -26,6 +26,9 @@ package Marpa::R3::Internal_G;
 
 use Scalar::Util 'blessed';
 use English qw( -no_match_vars );
+use Digest::SHA ();
+use File::Spec;
+use Storable ();
 
 # names of packages for strings
 our $PACKAGE = 'Marpa::R3::Grammar';
@@ -56,10 +59,12 @@ sub Marpa::R3::Internal::meta_grammar {
 
     my $meta_slg = pre_construct('Marpa::R3::Grammar');
 
-    state $hashed_metag = Marpa::R3::Internal::MetaG::hashed_grammar();
     $meta_slg->[Marpa::R3::Internal_G::BLESS_PACKAGE] =
       'Marpa::R3::Internal::MetaAST_Nodes';
-    Marpa::R3::Internal_G::hash_to_runtime( $meta_slg, $hashed_metag );
+
+    # The hashed source of the metagrammar is linked into R3.so,
+    # as Lua bytecode.
+    Marpa::R3::Internal_G::hash_to_runtime( $meta_slg, undef );
     my $registrations = registrations_find($meta_slg );
     registrations_set($meta_slg, $registrations );
 
@@ -78,9 +83,42 @@ sub Marpa::R3::Grammar::new {
       if not $flat_args;
 
     my $p_dsl = Marpa::R3::Internal_G::set( $slg, $flat_args );
-    my $ast        = Marpa::R3::Internal::MetaAST->new($p_dsl);
-    my $hashed_ast = $ast->ast_to_hash($p_dsl);
-    Marpa::R3::Internal_G::hash_to_runtime( $slg, $hashed_ast);
+
+    # On a hit in the compiled grammar cache, the DSL is not parsed,
+    # and the L0 and G1 grammars are read from their images,
+    # instead of being precomputed.
+    my $cache_dir = $slg->[Marpa::R3::Internal_G::CACHE_DIR];
+    my $cache_key;
+    my $cache_entry;
+    if ( defined $cache_dir ) {
+        $cache_key   = Marpa::R3::Internal_G::cache_key($p_dsl);
+        $cache_entry =
+          Marpa::R3::Internal_G::cache_read( $cache_dir, $cache_key );
+    }
+
+    my $hashed_ast;
+    my $grammar_images;
+    if ($cache_entry) {
+        $hashed_ast     = $cache_entry->{source};
+        $grammar_images = $cache_entry->{images};
+    }
+    else {
+        my $ast = Marpa::R3::Internal::MetaAST->new($p_dsl);
+        $hashed_ast = $ast->ast_to_hash($p_dsl);
+    }
+    Marpa::R3::Internal_G::hash_to_runtime( $slg, $hashed_ast,
+        $grammar_images );
+    if ( defined $cache_dir and not $cache_entry ) {
+        Marpa::R3::Internal_G::cache_write(
+            $cache_dir,
+            $cache_key,
+            {
+                key    => $cache_key,
+                source => Marpa::R3::Internal_G::cache_source($hashed_ast),
+                images => Marpa::R3::Internal_G::grammar_images($slg),
+            }
+        );
+    }
     my $registrations = registrations_find($slg );
     registrations_set($slg, $registrations );
     return $slg;
@@ -238,6 +276,21 @@ END_OF_LUA
         delete $flat_args->{'semantics_package'};
     }
 
+    if ( exists $flat_args->{'cache_dir'} ) {
+
+        # Only allowed in new method
+        my $value = $flat_args->{'cache_dir'};
+        if ( not defined $value or not -d $value ) {
+            my $desc = defined $value ? qq{"$value"} : 'undef';
+            Marpa::R3::exception(
+qq{'cache_dir' named argument to Marpa::R3::Grammar->new() is $desc\n},
+                "  It should be the name of a directory\n"
+            );
+        }
+        $slg->[Marpa::R3::Internal_G::CACHE_DIR] = $value;
+        delete $flat_args->{'cache_dir'};
+    }
+
     if ( exists $flat_args->{'ranking_method'} ) {
 
         # Only allowed in new method
@@ -272,8 +325,11 @@ END_OF_LUA
 # before or during hash creation, and space-intensive processing
 # should tend to be done here, in the code that converts the
 # hash to its runtime equivalent.
+#
+# An undefined hashed source means the metagrammar,
+# whose hashed source is built into Kollos.
 sub Marpa::R3::Internal_G::hash_to_runtime {
-    my ( $slg, $hashed_source ) = @_;
+    my ( $slg, $hashed_source, $grammar_images ) = @_;
 
     my $trace_file_handle = $slg->[Marpa::R3::Internal_G::TRACE_FILE_HANDLE];
     # Pre-lexer G1 processing
@@ -281,8 +337,8 @@ sub Marpa::R3::Internal_G::hash_to_runtime {
     $slg->coro_by_tag(
         ( '@' . __FILE__ . ':' . __LINE__ ),
         {
-            signature => 's',
-            args      => [$hashed_source],
+            signature => 'sb',
+            args      => [$hashed_source, $grammar_images // {}],
             handlers  => {
                 trace => sub {
                     my ($msg) = @_;
@@ -292,9 +348,16 @@ sub Marpa::R3::Internal_G::hash_to_runtime {
             }
         },
         <<'END_OF_LUA');
-        local slg, source_hash = ...
+        local slg, source_hash, grammar_images = ...
         _M.wrap(function ()
+            if not source_hash then
+                -- The metagrammar
+                source_hash = require 'kollos.metag'
+                package.loaded['kollos.metag'] = nil
+            end
+            slg.grammar_images = grammar_images
             slg:seriable_to_runtime(source_hash)
+            slg.grammar_images = nil
         end)
 END_OF_LUA
 
@@ -363,6 +426,94 @@ END_OF_LUA
 
 }
 
+# The compiled grammar cache.
+# Each entry is a file, named for a digest of the DSL
+# and of the version of Marpa::R3.
+# It holds the hashed source of the grammar,
+# and images of the precomputed L0 and G1 grammars,
+# each with a digest of the symbols and rules it was made from.
+# An image is only used if its digest matches that of the
+# grammar being built.
+# Entries which cannot be read, or are not valid,
+# are treated as misses.
+# Failure to write an entry is not an error.
+
+sub Marpa::R3::Internal_G::cache_key {
+    my ($p_dsl) = @_;
+    my $dsl = ${$p_dsl};
+    utf8::encode($dsl);
+    return Digest::SHA::sha256_hex( join "\0", 'Marpa::R3',
+        $Marpa::R3::STRING_VERSION, $dsl );
+}
+
+sub Marpa::R3::Internal_G::cache_file {
+    my ( $cache_dir, $cache_key ) = @_;
+    return File::Spec->catfile( $cache_dir, $cache_key . '.slg' );
+}
+
+sub Marpa::R3::Internal_G::cache_read {
+    my ( $cache_dir, $cache_key ) = @_;
+    my $file = Marpa::R3::Internal_G::cache_file( $cache_dir, $cache_key );
+    return if not -f $file;
+
+    # Entries are plain data, so blessing and tying are not allowed
+    local $Storable::flags = 0;
+    my $entry = eval { Storable::retrieve($file) };
+    return if ref $entry ne 'HASH';
+    return if ( $entry->{key} // q{} ) ne $cache_key;
+    return if ref $entry->{source} ne 'HASH';
+    return if ref $entry->{images} ne 'HASH';
+    for my $subg_name (qw(g1 l0)) {
+        my $image = $entry->{images}->{$subg_name};
+        return if ref $image ne 'HASH';
+        return if grep { not defined $image->{$_} } qw(image digest);
+    }
+    return $entry;
+}
+
+sub Marpa::R3::Internal_G::cache_write {
+    my ( $cache_dir, $cache_key, $entry ) = @_;
+    my $file = Marpa::R3::Internal_G::cache_file( $cache_dir, $cache_key );
+
+    # Write to a temporary file, and rename it, so that
+    # readers never see a partial entry
+    my $temp_file = join q{.}, $file, $PROCESS_ID, 'tmp';
+    if ( eval { Storable::store( $entry, $temp_file ); 1 } ) {
+        return if rename $temp_file, $file;
+    }
+    unlink $temp_file;
+    return;
+}
+
+# The hashed source, as plain data.  The meta-recognizer and
+# the DSL are only used for error messages during the parse,
+# and are not needed by the runtime.
+sub Marpa::R3::Internal_G::cache_source {
+    my ($hashed_source) = @_;
+    my %source = %{$hashed_source};
+    delete @source{qw(meta_recce p_dsl)};
+    return \%source;
+}
+
+sub Marpa::R3::Internal_G::grammar_images {
+    my ($slg) = @_;
+    my ( $g1_image, $l0_image, $g1_digest, $l0_digest ) = $slg->call_by_tag(
+        ( '@' . __FILE__ . ':' . __LINE__ ),
+        <<'END_OF_LUA', '');
+    local slg = ...
+    return slg.g1:serialize(), slg.l0:serialize(),
+        slg.g1.digest, slg.l0.digest
+END_OF_LUA
+
+    # Images are byte strings, but strings from Lua come back
+    # flagged as UTF-8.  Turning the flag off restores the bytes.
+    utf8::encode($_) for $g1_image, $l0_image;
+    return {
+        g1 => { image => $g1_image, digest => $g1_digest },
+        l0 => { image => $l0_image, digest => $l0_digest }
+    };
+}
+
 our $kwgen_code_template = <<'END_OF_TEMPLATE';
 END_OF_TEMPLATE
 
@@ -562,6 +713,25 @@ END_OF_LUA
     return $retour;
 }
 
+# Statistics of the precomputation of the G1 and L0 subgrammars
+sub Marpa::R3::Grammar::precompute_stats {
+    my ($slg) = @_;
+    my ($stats) = $slg->call_by_tag(
+        ( '@' . __FILE__ . ':' . __LINE__ ),
+        <<'END_OF_LUA', '>2' );
+    local slg = ...
+    return {
+        g1 = slg.g1:precompute_stats(),
+        l0 = slg.l0:precompute_stats()
+    }
+END_OF_LUA
+
+    # Lua tables come back as arrays of key-value pairs
+    my %stats = @{$stats};
+    $_ = { @{$_} } for values %stats;
+    return \%stats;
+}
+
 # TODO: Census all uses of Marpa::R3::Grammar::g1_symbol_name
 # in pod and tests, and make sure that they are appropriate --
 # that is, that they should not be symbol_name() instead.
@@ -603,6 +773,7 @@ kwgen_opt(__LINE__, qw(lmg_symbols_show lmg_symbols_show si), 0, 0);
 kwgen_opt(__LINE__, qw(g1_symbols_show g1_symbols_show i), 0);
 kwgen_opt(__LINE__, qw(l0_symbols_show l0_symbols_show i), 0);
 
+kwgen(__LINE__, qw(symbol_by_name symbol_by_name s));
 kwgen(__LINE__, qw(lmg_symbol_by_name lmg_symbol_by_name si));
 kwgen(__LINE__, qw(g1_symbol_by_name g1_symbol_by_name i));
 kwgen(__LINE__, qw(l0_symbol_by_name l0_symbol_by_name i));
@@ -167,49 +167,49 @@ sub gen_app_event_handler {
     };
 }
 
-sub gen_codepoint_event_handler {
+# Classifies a page of 256 codepoints against the character classes.
+# Returns, for the page, a flat list of (offset, symbol ID) pairs,
+# sorted by offset.  The symbols for each codepoint are in
+# character class table order.
+sub gen_codepoint_page_handler {
     my ($slr) = @_;
     my $slg = $slr->[Marpa::R3::Internal_R::SLG];
     my $character_class_table =
       $slg->[Marpa::R3::Internal_G::CHARACTER_CLASS_TABLE];
 
     return sub {
-        my ( $codepoint, $trace_terminals ) = @_;
-        my $character = pack( 'U', $codepoint );
-        my $is_graphic = ( $character =~ m/[[:graph:]]+/ );
+        my ($page_ix) = @_;
+        my $first_codepoint = $page_ix * 256;
+        my $page_string;
+        {
+            no warnings 'utf8';
+            $page_string = join q{},
+              map { chr } $first_codepoint .. $first_codepoint + 255;
+        }
 
-        my @symbols;
-        for my $entry ( @{$character_class_table} ) {
+        # Force Unicode semantics for codepoints 0x80 to 0xFF
+        utf8::upgrade($page_string);
 
+        my @symbols_by_offset;
+        for my $entry ( @{$character_class_table} ) {
             my ( $symbol_id, $re ) = @{$entry};
+            while ( $page_string =~ m/$re/g ) {
+                push @{ $symbols_by_offset[ $-[0] ] }, $symbol_id;
+            }
+        }
 
-            # say STDERR "Codepoint %x vs $re\n";
-
-            if ( $character =~ $re ) {
-
-                if ( $trace_terminals >= 2 ) {
-                    my $trace_file_handle =
-                      $slr
-                      ->[ Marpa::R3::Internal_R::TRACE_FILE_HANDLE ];
-                    my $char_desc = character_describe( $slr, $codepoint );
-                    say {$trace_file_handle}
-qq{Registering character $char_desc as symbol $symbol_id: },
-                      $slg->l0_symbol_display_form($symbol_id)
-                      or Marpa::R3::exception("Could not say(): $ERRNO");
-                } ## end if ( $trace_terminals >= 2 )
-
-                push @symbols, $symbol_id;
-
-            } ## end if ( $character =~ $re )
-        } ## end for my $entry ( @{$character_class_table} )
-
-        my $coro_arg = { symbols => \@symbols };
-        $coro_arg->{is_graphic} = 'true' if $is_graphic;
-        return 'ok', $coro_arg;
+        my @pairs;
+        for my $offset ( 0 .. 255 ) {
+            my $symbols = $symbols_by_offset[$offset] // next;
+            push @pairs, map { ( $offset, $_ ) } @{$symbols};
+        }
+        return 'ok', { symbols => \@pairs };
     };
 }
 
-sub Marpa::R3::Recognizer::new {
+# Creates the SLR, without returning the events
+# of its start of input
+sub slr_new {
     my ( $class, @args ) = @_;
 
     my $slr = [];
@@ -288,12 +288,21 @@ sub Marpa::R3::Recognizer::new {
 END_OF_LUA
 
     $slr->[Marpa::R3::Internal_R::REGIX]  = $regix;
+    return $slr;
+} ## end sub slr_new
+
+sub Marpa::R3::Recognizer::new {
+    my ( $class, @args ) = @_;
+
+    my $slr = slr_new( $class, @args );
+    my $trace_file_handle =
+      $slr->[Marpa::R3::Internal_R::TRACE_FILE_HANDLE];
 
     $slr->coro_by_tag(
         ( '@' . __FILE__ . ':' . __LINE__ ),
         {
-            signature => 's',
-            args      => [$flat_args],
+            signature => '',
+            args      => [],
             handlers  => {
                 trace => sub {
                     my ($msg) = @_;
@@ -304,7 +313,7 @@ END_OF_LUA
             }
         },
         <<'END_OF_LUA');
-        local slr, flat_args = ...
+        local slr = ...
         _M.wrap(function ()
             slr:convert_libmarpa_events()
             return 'ok'
@@ -390,6 +399,24 @@ sub Marpa::R3::Recognizer::read {
     return $slr->block_read();
 }
 
+sub Marpa::R3::Recognizer::read_file {
+    my ( $slr, $path, $start_pos, $length ) = @_;
+    if ( $slr->[Marpa::R3::Internal_R::CURRENT_EVENT] ) {
+        Marpa::R3::exception(
+            "$slr->read_file() called from inside a handler\n",
+            "   This is not allowed\n",
+            "   The event was ",
+            $slr->[Marpa::R3::Internal_R::CURRENT_EVENT],
+            "\n",
+        );
+    }
+
+    my $block_id = $slr->block_new_from_file($path);
+    $slr->block_set($block_id);
+    $slr->block_move($start_pos, $length);
+    return $slr->block_read();
+}
+
 sub Marpa::R3::Recognizer::resume {
     my ( $slr, $start_pos, $length ) = @_;
     if ( $slr->[Marpa::R3::Internal_R::CURRENT_EVENT] ) {
@@ -408,6 +435,166 @@ sub Marpa::R3::Recognizer::resume {
     return $slr->block_read();
 }
 
+sub Marpa::R3::Recognizer::checkpoint {
+    my ($slr) = @_;
+    my ($g1_pos) = $slr->call_by_tag(
+    ('@' . __FILE__ . ':' . __LINE__),
+    <<'END_OF_LUA', '');
+    local slr = ...
+    return slr:checkpoint()
+END_OF_LUA
+    return $g1_pos;
+}
+
+sub Marpa::R3::Recognizer::rollback {
+    my ( $slr, $g1_pos ) = @_;
+    if ( $slr->[Marpa::R3::Internal_R::CURRENT_EVENT] ) {
+        Marpa::R3::exception(
+            "$slr->rollback() called from inside a handler\n",
+            "   This is not allowed\n",
+            "   The event was ",
+            $slr->[Marpa::R3::Internal_R::CURRENT_EVENT],
+            "\n",
+        );
+    }
+    $slr->call_by_tag(
+    ('@' . __FILE__ . ':' . __LINE__),
+    <<'END_OF_LUA', 'i', $g1_pos);
+    local slr, g1_pos = ...
+    return slr:rollback(g1_pos)
+END_OF_LUA
+    return $g1_pos;
+}
+
+sub Marpa::R3::Recognizer::edit {
+    my ( $slr, $block_id, $start, $length, $p_string ) = @_;
+    if ( $slr->[Marpa::R3::Internal_R::CURRENT_EVENT] ) {
+        Marpa::R3::exception(
+            "$slr->edit() called from inside a handler\n",
+            "   This is not allowed\n",
+            "   The event was ",
+            $slr->[Marpa::R3::Internal_R::CURRENT_EVENT],
+            "\n",
+        );
+    }
+    if ( not defined $start or not defined $length ) {
+        Marpa::R3::exception(
+            qq{Marpa::R3::Recognizer::edit() requires a start and a length\n}
+        );
+    }
+    if ( ( my $ref_type = ref $p_string ) ne 'SCALAR' ) {
+        my $desc = $ref_type ? "a ref to $ref_type" : 'not a ref';
+        Marpa::R3::exception(
+            qq{Arg to Marpa::R3::Recognizer::edit() is $desc\n},
+            '  It should be a ref to scalar' );
+    }
+    if ( not defined ${$p_string} ) {
+        Marpa::R3::exception(
+            qq{Arg to Marpa::R3::Recognizer::edit() is a ref to an undef\n},
+            '  It should be a ref to a defined scalar' );
+    }
+    Marpa::R3::exception(
+        q{Attempt to use a tainted input string in $slr->edit()},
+        qq{\n  Marpa::R3 is insecure for use with tainted data\n}
+    ) if Scalar::Util::tainted( ${$p_string} );
+
+    my ($offset) = $slr->coro_by_tag(
+        ( '@' . __FILE__ . ':' . __LINE__ ),
+        {
+            signature => 'iiis',
+            args      => [ $block_id, $start, $length, ${$p_string} ],
+            handlers  => {
+                trace => sub {
+                    my ($msg) = @_;
+                    my $trace_file_handle =
+                      $slr->[Marpa::R3::Internal_R::TRACE_FILE_HANDLE];
+                    say {$trace_file_handle} $msg;
+                    return 'ok';
+                },
+                codepoint_page => gen_codepoint_page_handler($slr),
+                event => gen_app_event_handler($slr),
+            },
+        },
+        <<'END_OF_LUA');
+            local slr, block_id_arg, start_arg, length_arg, new_text = ...
+            local block_id, start, eoedit
+                = slr:block_check_range(block_id_arg, start_arg, length_arg)
+            if not block_id then
+               error(start)
+            end
+            local offset
+            _M.wrap(function()
+                    offset = slr:edit(block_id, start, eoedit - start, new_text)
+                    return 'ok', offset
+                end
+            )
+END_OF_LUA
+
+    return $offset;
+}
+
+sub Marpa::R3::Recognizer::save {
+    my ( $slr, $path ) = @_;
+    if ( $slr->[Marpa::R3::Internal_R::CURRENT_EVENT] ) {
+        Marpa::R3::exception(
+            "$slr->save() called from inside a handler\n",
+            "   This is not allowed\n",
+            "   The event was ",
+            $slr->[Marpa::R3::Internal_R::CURRENT_EVENT],
+            "\n",
+        );
+    }
+    if ( not defined $path ) {
+        Marpa::R3::exception(
+            qq{Marpa::R3::Recognizer::save() requires a path\n}
+        );
+    }
+    $slr->call_by_tag(
+    ('@' . __FILE__ . ':' . __LINE__),
+    <<'END_OF_LUA', 's', $path);
+    local slr, path = ...
+    slr:save(path)
+END_OF_LUA
+    return;
+}
+
+sub Marpa::R3::Recognizer::load {
+    my ( $class, $path, @args ) = @_;
+    if ( not defined $path ) {
+        Marpa::R3::exception(
+            qq{Marpa::R3::Recognizer::load() requires a path\n}
+        );
+    }
+
+    my $slr = slr_new( $class, @args );
+    $slr->coro_by_tag(
+        ( '@' . __FILE__ . ':' . __LINE__ ),
+        {
+            signature => 's',
+            args      => [ $path ],
+            handlers  => {
+                trace => sub {
+                    my ($msg) = @_;
+                    my $trace_file_handle =
+                      $slr->[Marpa::R3::Internal_R::TRACE_FILE_HANDLE];
+                    say {$trace_file_handle} $msg;
+                    return 'ok';
+                },
+                codepoint_page => gen_codepoint_page_handler($slr),
+            },
+        },
+        <<'END_OF_LUA');
+            local slr, path = ...
+            _M.wrap(function()
+                    slr:load(path)
+                    return 'ok'
+                end
+            )
+END_OF_LUA
+
+    return $slr;
+}
+
 sub character_describe {
     my ($slr, $codepoint) = @_;
 
@@ -567,6 +754,18 @@ END_OF_LUA
 }
 
 # Latest and current G1 location are the same
+# Memory of the G1 recognizer, in bytes
+sub Marpa::R3::Recognizer::memory_usage {
+    my ($slr) = @_;
+    my ($memory_usage) = $slr->call_by_tag(
+    ('@' . __FILE__ . ':' . __LINE__),
+    <<'END_OF_LUA', '');
+    local recce = ...
+    return recce.g1:memory_usage()
+END_OF_LUA
+    return $memory_usage;
+}
+
 sub Marpa::R3::Recognizer::g1_pos {
     my ($slr) = @_;
     my ($latest_earley_set) = $slr->call_by_tag(
@@ -739,7 +938,7 @@ sub Marpa::R3::Recognizer::lexeme_read_literal {
                     say {$trace_file_handle} $msg;
                     return 'ok';
                },
-               codepoint => gen_codepoint_event_handler($slr),
+               codepoint_page => gen_codepoint_page_handler($slr),
                event => gen_app_event_handler($slr),
            }
         },
@@ -789,7 +988,7 @@ sub Marpa::R3::Recognizer::lexeme_read_block {
                     say {$trace_file_handle} $msg;
                     return 'ok';
                },
-               codepoint => gen_codepoint_event_handler($slr),
+               codepoint_page => gen_codepoint_page_handler($slr),
                event => gen_app_event_handler($slr),
            }
         },
@@ -834,7 +1033,7 @@ sub Marpa::R3::Recognizer::lexeme_read_string {
                     say {$trace_file_handle} $msg;
                     return 'ok';
                },
-               codepoint => gen_codepoint_event_handler($slr),
+               codepoint_page => gen_codepoint_page_handler($slr),
                event => gen_app_event_handler($slr),
            }
         },
@@ -853,6 +1052,61 @@ END_OF_LUA
 
 }
 
+# Returns the number of token entries read
+sub Marpa::R3::Recognizer::lexeme_read_batch {
+    my ( $slr, $tokens, $values, $block_id ) = @_;
+    if ( $slr->[Marpa::R3::Internal_R::CURRENT_EVENT] ) {
+        Marpa::R3::exception(
+            '$recce->lexeme_read_batch() called from inside a handler', "\n",
+            "   This is not allowed\n",
+            "   The event was ",
+            $slr->[Marpa::R3::Internal_R::CURRENT_EVENT],
+            "\n",
+        );
+    }
+    # Packed tokens are passed to Kollos as bytes, and decoded there
+    Marpa::R3::exception(
+        '$recce->lexeme_read_batch(): tokens must be a multiple of 4 integers',
+        "\n" )
+      if ref $tokens ? @{$tokens} % 4 : ( length $tokens ) % 16;
+    $values //= [];
+    Marpa::R3::exception(
+        '$recce->lexeme_read_batch(): values must be an array ref', "\n" )
+      if ref $values ne 'ARRAY';
+    if ( ${^TAINT} and grep { Scalar::Util::tainted($_) } @{$values} ) {
+        Marpa::R3::exception(
+            "Problem in Marpa::R3: Attempt to use a tainted token value\n",
+            "Marpa::R3 is insecure for use with tainted data\n"
+        );
+    }
+
+    my ($count) = $slr->coro_by_tag(
+        ( '@' . __FILE__ . ':' . __LINE__ ),
+        {
+           signature => ( ref $tokens ? 'iAi' : 'bAi' ),
+           args => [ $tokens, $values, $block_id ],
+           handlers => {
+               trace => sub {
+                    my ($msg) = @_;
+                    my $trace_file_handle =
+                        $slr->[Marpa::R3::Internal_R::TRACE_FILE_HANDLE];
+                    say {$trace_file_handle} $msg;
+                    return 'ok';
+               },
+               event => gen_app_event_handler($slr),
+           }
+        },
+        <<'END_OF_LUA');
+      local slr, tokens, values, block_id = ...
+      _M.wrap(function ()
+          return 'ok', slr:lexeme_read_batch(tokens, values, block_id)
+      end
+      )
+END_OF_LUA
+
+      return $count;
+}
+
 sub Marpa::R3::Recognizer::g1_to_block_first {
     my ( $slr, $g1_pos ) = @_;
     return $slr->call_by_tag( ( '@' . __FILE__ . ':' . __LINE__ ),
@@ -948,16 +1202,20 @@ sub Marpa::R3::Recognizer::block_new {
             '  It should be a ref to a defined scalar' );
     } ## end if ( ( my $ref_type = ref $p_string ) ne 'SCALAR' )
 
-    my $character_class_table =
-      $slg->[Marpa::R3::Internal_G::CHARACTER_CLASS_TABLE];
-
     my ($block_id) = $slr->coro_by_tag(
         ( '@' . __FILE__ . ':' . __LINE__ ),
         {
             signature => 's',
             args      => [ ${$p_string} ],
             handlers  => {
-                codepoint => gen_codepoint_event_handler($slr),
+                trace => sub {
+                    my ($msg) = @_;
+                    my $trace_file_handle =
+                      $slr->[Marpa::R3::Internal_R::TRACE_FILE_HANDLE];
+                    say {$trace_file_handle} $msg;
+                    return 'ok';
+                },
+                codepoint_page => gen_codepoint_page_handler($slr),
                 event => gen_app_event_handler($slr),
             },
         },
@@ -974,6 +1232,116 @@ END_OF_LUA
     return $block_id;
 }
 
+sub Marpa::R3::Recognizer::block_new_from_file {
+    my ( $slr, $path ) = @_;
+
+    if ( not defined $path ) {
+        Marpa::R3::exception(
+            q{Marpa::R3::Recognizer::block_new_from_file() called without a path}
+        );
+    }
+    Marpa::R3::exception(
+        q{Attempt to use a tainted file name in $slr->block_new_from_file()},
+        qq{\n  Marpa::R3 is insecure for use with tainted data\n}
+    ) if Scalar::Util::tainted( $path );
+
+    my ($block_id) = $slr->coro_by_tag(
+        ( '@' . __FILE__ . ':' . __LINE__ ),
+        {
+            signature => 's',
+            args      => [ $path ],
+            handlers  => {
+                trace => sub {
+                    my ($msg) = @_;
+                    my $trace_file_handle =
+                      $slr->[Marpa::R3::Internal_R::TRACE_FILE_HANDLE];
+                    say {$trace_file_handle} $msg;
+                    return 'ok';
+                },
+                codepoint_page => gen_codepoint_page_handler($slr),
+                event => gen_app_event_handler($slr),
+            },
+        },
+        <<'END_OF_LUA');
+            local slr, path = ...
+            local new_block_id
+            _M.wrap(function()
+                    new_block_id = slr:block_new_from_file(path)
+                    return 'ok', new_block_id
+                end
+            )
+END_OF_LUA
+
+    return $block_id;
+}
+
+sub Marpa::R3::Recognizer::block_append {
+    my ( $slr, $block_id, $p_string ) = @_;
+
+    if ( ( my $ref_type = ref $p_string ) ne 'SCALAR' ) {
+        my $desc = $ref_type ? "a ref to $ref_type" : 'not a ref';
+        Marpa::R3::exception(
+            qq{Arg to Marpa::R3::Recognizer::block_append() is $desc\n},
+            '  It should be a ref to scalar' );
+    }
+    if ( not defined ${$p_string} ) {
+        Marpa::R3::exception(
+            qq{Arg to Marpa::R3::Recognizer::block_append() is a ref to an undef\n},
+            '  It should be a ref to a defined scalar' );
+    }
+    Marpa::R3::exception(
+        q{Attempt to use a tainted input string in $slr->block_append()},
+        qq{\n  Marpa::R3 is insecure for use with tainted data\n}
+    ) if Scalar::Util::tainted( ${$p_string} );
+
+    my ($length) = $slr->coro_by_tag(
+        ( '@' . __FILE__ . ':' . __LINE__ ),
+        {
+            signature => 'is',
+            args      => [ $block_id, ${$p_string} ],
+            handlers  => {
+                trace => sub {
+                    my ($msg) = @_;
+                    my $trace_file_handle =
+                      $slr->[Marpa::R3::Internal_R::TRACE_FILE_HANDLE];
+                    say {$trace_file_handle} $msg;
+                    return 'ok';
+                },
+                codepoint_page => gen_codepoint_page_handler($slr),
+                event => gen_app_event_handler($slr),
+            },
+        },
+        <<'END_OF_LUA');
+            local slr, block_id_arg, input_string = ...
+            local block_id, erreur = slr:block_check_id(block_id_arg)
+            if not block_id then
+               error(erreur)
+            end
+            local length
+            _M.wrap(function()
+                    length = slr:block_append(block_id, input_string)
+                    return 'ok', length
+                end
+            )
+END_OF_LUA
+
+    return $length;
+}
+
+sub Marpa::R3::Recognizer::block_forget {
+    my ( $slr, $block_id, $pos ) = @_;
+    my ($watermark) = $slr->call_by_tag( ( '@' . __FILE__ . ':' . __LINE__ ),
+        <<'END_OF_LUA', 'ii', $block_id, $pos );
+        local slr, block_id_arg, pos_arg = ...
+        local block_id, pos = slr:block_check_offset(block_id_arg, pos_arg)
+        if not block_id then
+           error(pos)
+        end
+        return slr:block_forget(block_id, pos)
+END_OF_LUA
+    return $watermark;
+}
+
 sub Marpa::R3::Recognizer::block_progress {
     my ($slr, $block_id) = @_;
     my ($l0_pos, $l0_end);
@@ -1074,7 +1442,7 @@ sub Marpa::R3::Recognizer::input_length {
     <<'END_OF_LUA', 'i', ($block_id // -1));
         local slr, block_id  = ...
         local block = block_id > 0 and slr.inputs[block_id] or slr.current_block
-        return #block
+        return block.length
 END_OF_LUA
 
     return $length;
@@ -191,11 +191,8 @@ to provide more convenient behaviors.
 \li The allocators do not return on failed memory allocations.
 \li |my_realloc| is equivalent to |my_malloc| if called with
 a |NULL| pointer.  (This is the GNU C library behavior.)
-@ {\bf To Do}: @^To Do@>
-For the moment, the memory allocators are hard-wired to
-the C89 default |malloc| and |free|.
-At some point I may allow the user to override
-these choices.
+By default, the memory allocators are the
+C89 |malloc| and |free|.
 
 @<Friend static inline functions@> =
 static inline
@@ -240,6 +237,103 @@ my_realloc(void *p, size_t size)
 @d marpa_renew(type, p, count) 
     ((type *)my_realloc((p), (sizeof(type)*((size_t)(count)))))
 
+@*0 User allocators.
+The application may override the default allocators
+with a function of its own, and a context pointer,
+which are kept in a |MARPA_ALLOCATOR|.
+A |NULL| allocator, or one without a function,
+means the default allocators.
+The user's function has the contract of Lua's |lua_Alloc|:
+it frees when |new_size| is zero,
+and otherwise allocates or reallocates.
+@<Friend incomplete structures@> =
+struct marpa_allocator_s;
+typedef struct marpa_allocator_s* MARPA_ALLOCATOR;
+@ @<Friend structures@> =
+struct marpa_allocator_s {
+    Marpa_Allocator t_function;
+    void *t_context;
+};
+
+@ The user's function is told the old size of every block
+that it frees or resizes,
+so that arena and pool allocators, which do not
+track sizes themselves, can be used.
+libmarpa does not know the sizes of all its blocks,
+so each block from a user allocator begins with a header
+which records its size.
+The header is a union, so that the memory which follows it
+is suitably aligned for any type.
+@<Friend structures@> =
+union marpa_allocation_header {
+    size_t t_size;
+    double t_double;
+    void *t_pointer;
+    long t_long;
+};
+
+@ @<Friend static inline functions@> =
+static inline
+void* marpa__a_malloc(MARPA_ALLOCATOR allocator, size_t size)
+{
+    union marpa_allocation_header *header;
+    if (_MARPA_LIKELY(!allocator || !allocator->t_function))
+      return my_malloc(size);
+    header = (*allocator->t_function) (allocator->t_context, NULL, 0,
+                                       sizeof (*header) + size);
+    if (_MARPA_UNLIKELY(!header)) { (*marpa__out_of_memory)(); }
+    header->t_size = size;
+    return header + 1;
+}
+
+static inline
+void*
+marpa__a_malloc0(MARPA_ALLOCATOR allocator, size_t size)
+{
+    void* newmem = marpa__a_malloc(allocator, size);
+    memset (newmem, 0, size);
+    return newmem;
+}
+
+static inline
+void*
+marpa__a_realloc(MARPA_ALLOCATOR allocator, void *p, size_t size)
+{
+    union marpa_allocation_header *header;
+    if (_MARPA_LIKELY(!allocator || !allocator->t_function))
+      return my_realloc(p, size);
+    if (!p)
+      return marpa__a_malloc(allocator, size);
+    header = (union marpa_allocation_header *) p - 1;
+    header = (*allocator->t_function) (allocator->t_context, header,
+                                       sizeof (*header) + header->t_size,
+                                       sizeof (*header) + size);
+    if (_MARPA_UNLIKELY(!header)) { (*marpa__out_of_memory)(); }
+    header->t_size = size;
+    return header + 1;
+}
+
+static inline
+void marpa__a_free(MARPA_ALLOCATOR allocator, void *p)
+{
+    union marpa_allocation_header *header;
+    if (_MARPA_LIKELY(!allocator || !allocator->t_function)) {
+      my_free(p);
+      return;
+    }
+    if (!p)
+      return;
+    header = (union marpa_allocation_header *) p - 1;
+    (*allocator->t_function) (allocator->t_context, header,
+                              sizeof (*header) + header->t_size, 0);
+}
+
+@
+@d marpa_a_new(allocator, type, count)
+    ((type *)marpa__a_malloc((allocator), (sizeof(type)*((size_t)(count)))))
+@d marpa_a_renew(allocator, type, p, count)
+    ((type *)marpa__a_realloc((allocator), (p), (sizeof(type)*((size_t)(count)))))
+
 @** Dynamic stacks.
 |libmarpa| uses stacks and worklists extensively.
 This stack interface resizes itself dynamically.
@@ -259,14 +353,20 @@ to a size convenient for the memory allocator.
 {\bf To Do}: @^To Do@>
 Right now this is hard-wired to 1024, but I should
 use the better calculation made by the obstack code.
+A dstack keeps a copy of the allocator it was initialized with,
+and uses it for all resizing and for its destruction.
+It keeps a copy, rather than a pointer,
+so that it does not depend on the lifetime of its owner.
 @d MARPA_DSTACK_DECLARE(this) struct marpa_dstack_s this
-@d MARPA_DSTACK_INIT(this, type, initial_size)
+@d MARPA_DSTACK_INIT(this, type, initial_size, allocator)
 (
     ((this).t_count = 0),
-    ((this).t_base = marpa_new(type, ((this).t_capacity = (initial_size))))
+    ((this).t_allocator = *(allocator)),
+    ((this).t_base = marpa_a_new(&(this).t_allocator, type,
+        ((this).t_capacity = (initial_size))))
 )
-@d MARPA_DSTACK_INIT2(this, type)
-    MARPA_DSTACK_INIT((this), type, MAX(4, 1024/sizeof(this)))
+@d MARPA_DSTACK_INIT2(this, type, allocator)
+    MARPA_DSTACK_INIT((this), type, MAX(4, 1024/sizeof(this)), (allocator))
 
 @ |MARPA_DSTACK_SAFE| is for cases where the dstack is not
 immediately initialized to a useful value,
@@ -277,7 +377,8 @@ memory has been allocated and therefore no attempt
 to free memory should be made.
 @d MARPA_DSTACK_IS_INITIALIZED(this) ((this).t_base)
 @d MARPA_DSTACK_SAFE(this)
-  (((this).t_count = (this).t_capacity = 0), ((this).t_base = NULL))
+  (((this).t_count = (this).t_capacity = 0), ((this).t_base = NULL),
+    ((this).t_allocator.t_function = NULL))
 
 @ It is up to the caller to ensure that there is sufficient
 capacity for the new count.  Usually this call will be used
@@ -314,14 +415,17 @@ resizings unnecessary.
 The |MARPA_STOLEN_DSTACK_DATA_FREE| macro is intended
 to help the ``thief" container
 deallocate the data it now has ``stolen".
-@d MARPA_STOLEN_DSTACK_DATA_FREE(data) (my_free(data))
-@d MARPA_DSTACK_DESTROY(this) MARPA_STOLEN_DSTACK_DATA_FREE(this.t_base)
+The thief must use the allocator of the stack it stole from.
+@d MARPA_STOLEN_DSTACK_DATA_FREE(allocator, data) (marpa__a_free((allocator), (data)))
+@d MARPA_DSTACK_DESTROY(this)
+    MARPA_STOLEN_DSTACK_DATA_FREE(&(this).t_allocator, (this).t_base)
 @s MARPA_DSTACK int
 @<Friend incomplete structures@> =
 struct marpa_dstack_s;
 typedef struct marpa_dstack_s* MARPA_DSTACK;
 @ @<Friend structures@> =
-struct marpa_dstack_s { int t_count; int t_capacity; void * t_base; };
+struct marpa_dstack_s { int t_count; int t_capacity; void * t_base;
+    struct marpa_allocator_s t_allocator; };
 @ @<Friend static inline functions@> =
 static inline void * marpa_dstack_resize2(struct marpa_dstack_s* this, int type_bytes)
 {
@@ -340,7 +444,8 @@ marpa_dstack_resize (struct marpa_dstack_s *this, int type_bytes,
     {                           /* We do not shrink the stack
                                    in this method */
       this->t_capacity = new_size;
-      this->t_base = my_realloc (this->t_base, (size_t)new_size * (size_t)type_bytes);
+      this->t_base = marpa__a_realloc (&this->t_allocator, this->t_base,
+          (size_t)new_size * (size_t)type_bytes);
     }
   return this->t_base;
 }
@@ -77,7 +77,9 @@ typedef struct marpa_avl_traverser* MARPA_AVL_TRAV;
 #define MARPA_AVL_OBSTACK(table) ((table)->avl_obstack)
 
 /* Table functions. */
-MARPA_AVL_TREE _marpa_avl_create (marpa_avl_comparison_func *, void *);
+struct marpa_allocator_s;
+MARPA_AVL_TREE _marpa_avl_create (marpa_avl_comparison_func *, void *,
+  struct marpa_allocator_s *);
 MARPA_AVL_TREE _marpa_avl_copy (const MARPA_AVL_TREE , marpa_avl_copy_func *,
                             marpa_avl_item_func *, int alignment);
 void _marpa_avl_destroy (MARPA_AVL_TREE );
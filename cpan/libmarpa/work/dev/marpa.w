@@ -612,6 +612,8 @@ struct marpa_config {
      int t_is_ok;
      Marpa_Error_Code t_error;
      const char *t_error_string;
+     Marpa_Allocator t_allocator;
+     void *t_allocator_context;
 };
 typedef struct marpa_config Marpa_Config;
 
@@ -627,6 +629,43 @@ int marpa_c_init (Marpa_Config *config)
     config->t_is_ok = I_AM_OK;
     config->t_error = MARPA_ERR_NONE;
     config->t_error_string = NULL;
+    config->t_allocator = NULL;
+    config->t_allocator_context = NULL;
+    return 0;
+}
+
+@*0 User allocators.
+An application can replace the memory allocator
+which libmarpa uses for a grammar,
+and for every object derived from it.
+The allocator function has the same contract as |lua_Alloc|:
+when |new_size| is zero it must free |p| and return |NULL|;
+otherwise it must return a block of |new_size| bytes,
+containing the first |old_size| bytes of |p|,
+if |p| is not |NULL|.
+An allocator which returns |NULL| is treated
+as having run out of memory.
+Unlike the default allocator, a user allocator is
+always told the sizes of the blocks it is asked
+to free or resize, so that arenas and pools may be used.
+@<Public typedefs@> =
+typedef void* (*Marpa_Allocator) (void *context, void *p,
+    size_t old_size, size_t new_size);
+
+@ The allocator is copied into the grammar
+when the grammar is created, so that changing
+the configuration afterwards does not affect existing grammars.
+A |NULL| allocator restores the default.
+@<Function definitions@> =
+int marpa_c_allocator_set (Marpa_Config *config,
+    Marpa_Allocator allocator, void *context)
+{
+    if (config->t_is_ok != I_AM_OK) {
+        config->t_error = MARPA_ERR_I_AM_NOT_OK;
+        return -2;
+    }
+    config->t_allocator = allocator;
+    config->t_allocator_context = context;
     return 0;
 }
 
@@ -671,17 +710,25 @@ typedef struct marpa_g* GRAMMAR;
 macro should be kept in the production code,
 to help developers who wonder if debugging has been
 successfully turned on.
+The allocator is set first, because the grammar
+itself, and all its elements, are allocated with it.
 @<Function definitions@> =
 Marpa_Grammar marpa_g_new (Marpa_Config* configuration)
 {
     GRAMMAR g;
+    struct marpa_allocator_s allocator = { NULL, NULL };
     MARPA_OFF_DEBUG3("Debugging at level %ld is on: %s\n",
       marpa__debug_level, STRLOC);
     if (configuration && configuration->t_is_ok != I_AM_OK) {
         configuration->t_error = MARPA_ERR_I_AM_NOT_OK;
         return NULL;
     }
-    g = my_malloc(sizeof(struct marpa_g));
+    if (configuration) {
+        allocator.t_function = configuration->t_allocator;
+        allocator.t_context = configuration->t_allocator_context;
+    }
+    g = marpa__a_malloc(&allocator, sizeof(struct marpa_g));
+    *Allocator_of_G(g) = allocator;
     @t}\comment{@>
     /* Set |t_is_ok| to a bad value, just in case */
     g->t_is_ok = 0;
@@ -733,12 +780,73 @@ Marpa_Grammar
 marpa_g_ref (Marpa_Grammar g)
 { return grammar_ref(g); }
 
-@ @<Function definitions@> =
+@ The grammar's allocator is copied before the grammar
+is destroyed, because it is needed to free the grammar itself.
+@<Function definitions@> =
 PRIVATE
 void grammar_free(GRAMMAR g)
 {
+    struct marpa_allocator_s allocator = *Allocator_of_G(g);
     @<Destroy grammar elements@>@;
-    my_free(g);
+    marpa__a_free(&allocator, g);
+}
+
+@*0 The grammar's allocator.
+Every object derived from the grammar ---
+recognizers, bocages, orders, trees and values ---
+allocates its memory with the grammar's allocator.
+The grammar is reference counted, and outlives all of them.
+@d Allocator_of_G(g) (&(g)->t_allocator)
+@<Widely aligned grammar elements@> =
+    struct marpa_allocator_s t_allocator;
+
+@*0 The grammar's chunk cache.
+The obstacks of objects derived from the grammar
+take their chunks from a cache kept by the grammar,
+and give them back to it when they are freed.
+Applications which parse many small inputs with one grammar
+create and destroy many short-lived obstacks ---
+a recognizer, bocage, order and valuator for every parse,
+and a temporary obstack for every earleme.
+The cache lets them reuse chunks, instead of calling |malloc()|
+and |free()| for each of them.
+@ The cache is reference counted, and each obstack holds a reference.
+The destructors of objects derived from the grammar
+may unreference the grammar before freeing their obstacks,
+and the references keep the cache alive for those obstacks.
+@ The grammar's own obstacks last as long as the grammar,
+and do not use the cache.
+@d Chunk_Cache_of_G(g) ((g)->t_chunk_cache)
+@d DEFAULT_CHUNK_CACHE_MAX (64*1024)
+@<Widely aligned grammar elements@> =
+    struct marpa_obstack_cache *t_chunk_cache;
+@ @<Initialize grammar elements@> =
+    Chunk_Cache_of_G(g) =
+      marpa__obs_cache_new(Allocator_of_G(g), DEFAULT_CHUNK_CACHE_MAX);
+@ @<Destroy grammar elements@> =
+    marpa__obs_cache_unref(Chunk_Cache_of_G(g));
+
+@ The limit is in bytes.
+Setting it to zero turns the cache off,
+and frees the chunks it holds.
+Returns the new limit.
+@<Function definitions@> =
+size_t
+marpa_g_chunk_cache_max (Marpa_Grammar g)
+{
+  @<Return |(size_t)-2| on failure@>@;
+  @<Fail if fatal error@>@;
+  return marpa_obs_cache_max (Chunk_Cache_of_G (g));
+}
+
+@ @<Function definitions@> =
+size_t
+marpa_g_chunk_cache_max_set (Marpa_Grammar g, size_t max)
+{
+  @<Return |(size_t)-2| on failure@>@;
+  @<Fail if fatal error@>@;
+  marpa__obs_cache_max_set (Chunk_Cache_of_G (g), max);
+  return max;
 }
 
 @*0 The grammar's symbol list.
@@ -751,7 +859,7 @@ with their
     MARPA_DSTACK_DECLARE(t_nsy_stack);
 
 @ @<Initialize grammar elements@> =
-    MARPA_DSTACK_INIT2(g->t_xsy_stack, XSY );
+    MARPA_DSTACK_INIT2(g->t_xsy_stack, XSY, Allocator_of_G(g));
     MARPA_DSTACK_SAFE(g->t_nsy_stack);
 
 @ @<Destroy grammar elements@> =
@@ -809,7 +917,7 @@ The |rule_tree| is a tree for detecting duplicates.
     MARPA_DSTACK_DECLARE(t_xrl_stack);
     MARPA_DSTACK_DECLARE(t_irl_stack);
 @ @<Initialize grammar elements@> =
-    MARPA_DSTACK_INIT2(g->t_xrl_stack, RULE);
+    MARPA_DSTACK_INIT2(g->t_xrl_stack, RULE, Allocator_of_G(g));
     MARPA_DSTACK_SAFE(g->t_irl_stack);
 
 @ @<Destroy grammar elements@> =
@@ -1058,7 +1166,7 @@ MARPA_DSTACK_DECLARE(t_events);
 @
 @d INITIAL_G_EVENTS_CAPACITY (1024/sizeof(int))
 @<Initialize grammar elements@> =
-MARPA_DSTACK_INIT(g->t_events, GEV_Object, INITIAL_G_EVENTS_CAPACITY);
+MARPA_DSTACK_INIT(g->t_events, GEV_Object, INITIAL_G_EVENTS_CAPACITY, Allocator_of_G(g));
 @ @<Destroy grammar elements@> = MARPA_DSTACK_DESTROY(g->t_events);
 
 @ Callers must be careful.
@@ -1130,7 +1238,7 @@ to help detect BNF rules.
 @<Widely aligned grammar elements@> =
 MARPA_AVL_TREE t_xrl_tree;
 @ @<Initialize grammar elements@> =
-  (g)->t_xrl_tree = _marpa_avl_create (duplicate_rule_cmp, NULL);
+  (g)->t_xrl_tree = _marpa_avl_create (duplicate_rule_cmp, NULL, Allocator_of_G(g));
 @ @<Clear rule duplication tree@> =
 {
     _marpa_avl_destroy ((g)->t_xrl_tree);
@@ -1161,8 +1269,8 @@ This obstack is cleared on exit from a method.
 struct marpa_obstack* t_obs;
 struct marpa_obstack* t_xrl_obs;
 @ @<Initialize grammar elements@> =
-g->t_obs = marpa_obs_init;
-g->t_xrl_obs = marpa_obs_init;
+g->t_obs = marpa_obs_init(Allocator_of_G(g));
+g->t_xrl_obs = marpa_obs_init(Allocator_of_G(g));
 @ @<Destroy grammar elements@> =
 marpa_obs_free(g->t_obs);
 marpa_obs_free(g->t_xrl_obs);
@@ -1177,7 +1285,7 @@ by multiple threads.
 @<Widely aligned grammar elements@> =
 CILAR_Object t_cilar;
 @ @<Initialize grammar elements@> =
-cilar_init(&(g)->t_cilar);
+cilar_init(&(g)->t_cilar, Allocator_of_G(g));
 @ @<Destroy grammar elements@> =
 cilar_destroy(&(g)->t_cilar);
 
@@ -2056,6 +2164,16 @@ is the LHS.
 @<Widely aligned NSY elements@> = CIL t_lhs_cil;
 @ @<Initialize NSY elements@> = LHS_CIL_of_NSY(nsy) = NULL;
 
+@*0 Lookahead CIL.
+A CIL which records the prediction AHM's
+whose FIRST set includes this NSY.
+These are the predictions which a token of this NSY can advance.
+It is the empty CIL for NSY's which are on the LHS of an IRL.
+@d Lookahead_CIL_of_NSY(nsy) ((nsy)->t_lookahead_cil)
+@d Lookahead_CIL_of_NSYID(nsyid) Lookahead_CIL_of_NSY(NSY_by_ID(nsyid))
+@<Widely aligned NSY elements@> = CIL t_lookahead_cil;
+@ @<Initialize NSY elements@> = Lookahead_CIL_of_NSY(nsy) = NULL;
+
 @*0 Semantic XSY.
 Set if the internal symbol is semantically visible
 externally.
@@ -3194,13 +3312,14 @@ int marpa_g_precompute(Marpa_Grammar g)
 {
     @<Return |-2| on failure@>@;
     int return_value = failure_indicator;
-    struct marpa_obstack *obs_precompute = marpa_obs_init;
+    struct marpa_obstack *obs_precompute = marpa_obs_init(Allocator_of_G(g));
     @<Declare precompute variables@>@;
     @<Fail if fatal error@>@;
     G_EVENTS_CLEAR(g);
     @<Fail if no rules@>@;
     @<Fail if precomputed@>@;
     @<Fail if bad start symbol@>@;
+    *stats = precompute_stats_zero;
 
     @t}\comment{@>
     /* After this point, errors are not recoverable */
@@ -3214,7 +3333,9 @@ int marpa_g_precompute(Marpa_Grammar g)
     { /* Scope with only external grammar */
         @<Declare census variables@>@;
         @<Perform census of grammar |g|@>@;
+        phase_clock (&phase_start, &stats->t_census_ns);
         @<Detect cycles@>@;
+        phase_clock (&phase_start, &stats->t_loop_ns);
     }
 
     @t}\comment{@>
@@ -3224,7 +3345,9 @@ int marpa_g_precompute(Marpa_Grammar g)
     @<Rewrite grammar |g| into CHAF form@>@;
     @<Augment grammar |g|@>@;
     post_census_xsy_count = XSY_Count_of_G(g);
+    phase_clock (&phase_start, &stats->t_rewrite_ns);
     @<Populate the event boolean vectors@>@;
+    phase_clock (&phase_start, &stats->t_event_ns);
 
     @t}\comment{@>
     /* Phase 3: memoize the internal grammar */
@@ -3233,16 +3356,20 @@ int marpa_g_precompute(Marpa_Grammar g)
         memoizations@>@;
         @<Calculate Rule by LHS lists@>@;
         @<Create AHMs@>@;
+        phase_clock (&phase_start, &stats->t_ahm_ns);
         @<Construct prediction matrix@>@;
         @<Construct right derivation matrix@>@;
+        phase_clock (&phase_start, &stats->t_prediction_matrix_ns);
         @<Populate the predicted IRL CIL's in the AHM's@>
         @<Populate the terminal boolean vector@>@;
         @<Populate the prediction
           and nulled symbol CILs@>@;
+        phase_clock (&phase_start, &stats->t_cil_ns);
         @<Mark the event AHMs@>@;
         @<Calculate AHM Event Group Sizes@>@;
         @<Find the direct ZWA's for each AHM@>@;
         @<Find the indirect ZWA's for each AHM's@>@;
+        phase_clock (&phase_start, &stats->t_event_ns);
     }
     g->t_is_precomputed = 1;
     if (g->t_has_cycle)
@@ -3256,6 +3383,8 @@ int marpa_g_precompute(Marpa_Grammar g)
     FAILURE:;
     goto CLEANUP;
     CLEANUP:;
+    phase_clock (&precompute_start, &stats->t_total_ns);
+    stats->t_precompute_obstack_bytes = marpa_obs_allocated (obs_precompute);
     marpa_obs_free (obs_precompute);
     return return_value;
 }
@@ -3272,6 +3401,113 @@ This probably is an issue to be dealt with,
 when adding the ability
 to clone grammars.
 
+@*0 Precomputation statistics.
+So that applications can find out which parts of their
+grammars are expensive to precompute,
+|marpa_g_precompute| times each of its phases,
+and |marpa_g_precompute_stats| reports these times,
+together with the sizes of the precomputed grammar.
+
+Times are of processor time,
+as measured by |clock()|, which is in ISO C.
+They are reported in nanoseconds,
+but their resolution is that of |clock()|,
+often a microsecond or worse.
+They are |double|'s, because a |long| of nanoseconds
+would overflow in a few seconds where |long| is 32 bits.
+
+Grammars read from an image are never precomputed,
+and all their times are zero.
+The sizes are counted when they are asked for,
+and so are correct for them.
+@<Public structures@> =
+struct marpa_precompute_stats {
+     double t_census_ns;
+     double t_closure_ns;
+     double t_loop_ns;
+     double t_rewrite_ns;
+     double t_ahm_ns;
+     double t_prediction_matrix_ns;
+     double t_cil_ns;
+     double t_event_ns;
+     double t_total_ns;
+     int t_xsy_count;
+     int t_xrl_count;
+     int t_nsy_count;
+     int t_irl_count;
+     int t_ahm_count;
+     int t_cil_count;
+     size_t t_precompute_obstack_bytes;
+     size_t t_grammar_obstack_bytes;
+};
+typedef struct marpa_precompute_stats Marpa_Precompute_Stats;
+
+@ @d Precompute_Stats_of_G(g) ((g)->t_precompute_stats)
+@<Widely aligned grammar elements@> =
+  struct marpa_precompute_stats t_precompute_stats;
+@ @<Initialize grammar elements@> =
+  Precompute_Stats_of_G(g) = precompute_stats_zero;
+@ @<Global constant variables@> =
+static const struct marpa_precompute_stats precompute_stats_zero = { 0 };
+
+@ @<Declare precompute variables@> =
+  clock_t precompute_start = clock();
+  clock_t phase_start = precompute_start;
+  struct marpa_precompute_stats *const stats = &Precompute_Stats_of_G(g);
+
+@ Add the time since |*p_phase_start| to |*p_nanoseconds|,
+and start the next phase.
+If |clock()| fails, it always returns the same value,
+so that the times are zero.
+@<Function definitions@> =
+PRIVATE void
+phase_clock (clock_t * p_phase_start, double *p_nanoseconds)
+{
+  const clock_t now = clock ();
+  *p_nanoseconds +=
+    (double) (now - *p_phase_start) * (1.0e9 / (double) CLOCKS_PER_SEC);
+  *p_phase_start = now;
+}
+
+@ The census time includes the preliminary checks,
+and the time of the census of symbols, rules and terminals.
+The closure time is that of the reach matrix,
+and of the nullable and productive symbol closures.
+The rewrite time includes the rewrite of sequences into BNF,
+which is done in the same pass over the rules
+as the CHAF rewrite,
+and the augmentation of the grammar.
+The event time includes the event boolean vectors,
+the event AHMs and their groups, and the ZWA's.
+The phases after the rewrite are skipped for trivial grammars,
+and their times are zero.
+
+The CIL count is of the distinct CIL's in the grammar's arena.
+The precompute obstack is freed when precomputation ends,
+so that its byte count is its high water mark.
+The grammar obstack byte count is of the obstacks
+which hold the grammar's symbols, rules, AHM's and CIL's.
+@<Function definitions@> =
+int
+marpa_g_precompute_stats (Marpa_Grammar g, Marpa_Precompute_Stats * p_stats)
+{
+  @<Return |-2| on failure@>@;
+  @<Fail if fatal error@>@;
+  @<Fail if not precomputed@>@;
+  *p_stats = Precompute_Stats_of_G (g);
+  p_stats->t_xsy_count = XSY_Count_of_G (g);
+  p_stats->t_xrl_count = XRL_Count_of_G (g);
+  p_stats->t_nsy_count = NSY_Count_of_G (g);
+  p_stats->t_irl_count = IRL_Count_of_G (g);
+  p_stats->t_ahm_count = AHM_Count_of_G (g);
+  p_stats->t_cil_count = (int) marpa_avl_count (g->t_cilar.t_avl);
+  p_stats->t_grammar_obstack_bytes =
+    marpa_obs_allocated (g->t_obs)
+    + marpa_obs_allocated (g->t_xrl_obs)
+    + marpa_obs_allocated (g->t_cilar.t_obs);
+  return 0;
+}
+
 @** The grammar census.
 
 @*0 Implementation: inacessible and unproductive Rules.
@@ -3307,9 +3543,11 @@ a lot of useless diagnostics.
 {
     @<Census symbols@>@;
     @<Census terminals@>@;
+    phase_clock (&phase_start, &stats->t_census_ns);
     @<Calculate reach matrix@>@;
     @<Census nullable symbols@>@;
     @<Census productive symbols@>@;
+    phase_clock (&phase_start, &stats->t_closure_ns);
     @<Check that start symbol is productive@>@;
     @<Census accessible symbols@>@;
     @<Census nulling symbols@>@;
@@ -3382,7 +3620,7 @@ PRIVATE_NOT_INLINE int sym_rule_cmp(
 
     @t}\comment{@>
   /* AVL tree for RHS symbols */
-  const MARPA_AVL_TREE rhs_avl_tree = _marpa_avl_create (sym_rule_cmp, NULL);
+  const MARPA_AVL_TREE rhs_avl_tree = _marpa_avl_create (sym_rule_cmp, NULL, Allocator_of_G(g));
     /* Size of G is sum of RHS lengths, plus 1 for each rule, which here is necessary
     for separator of sequences */
   struct sym_rule_pair *const p_rh_sym_rule_pair_base =
@@ -3392,7 +3630,7 @@ PRIVATE_NOT_INLINE int sym_rule_cmp(
 
     @t}\comment{@>
   /* AVL tree for LHS symbols */
-  const MARPA_AVL_TREE lhs_avl_tree = _marpa_avl_create (sym_rule_cmp, NULL);
+  const MARPA_AVL_TREE lhs_avl_tree = _marpa_avl_create (sym_rule_cmp, NULL, Allocator_of_G(g));
   struct sym_rule_pair *const p_lh_sym_rule_pair_base =
     marpa_obs_new (MARPA_AVL_OBSTACK (lhs_avl_tree), struct sym_rule_pair,
                     (size_t)xrl_count);
@@ -3652,7 +3890,7 @@ where many of the right hand sides repeat symbols.
 	    }
 	}
     }
-  transitive_closure (reach_matrix);
+  transitive_closure (Allocator_of_G(g), reach_matrix);
 }
 
 @ @<Declare precompute variables@> =
@@ -3682,7 +3920,7 @@ Therefore there is no code to free it.
 reach a terminal symbol.
 @<Census nulling symbols@> =
 {
-  Bit_Vector reaches_terminal_v = bv_shadow (terminal_v);
+  Bit_Vector reaches_terminal_v = bv_shadow (Allocator_of_G(g), terminal_v);
   int nulling_terminal_found = 0;
   int min, max, start;
   for (start = 0; bv_scan (lhs_v, start, &min, &max); start = max + 2)
@@ -3706,7 +3944,7 @@ reach a terminal symbol.
             }
         }
     }
-  bv_free (reaches_terminal_v);
+  bv_free (Allocator_of_G(g), reaches_terminal_v);
   if (_MARPA_UNLIKELY (nulling_terminal_found))
     {
       MARPA_ERROR (MARPA_ERR_NULLING_TERMINAL);
@@ -3875,7 +4113,7 @@ Change so that this runs only if there are prediction events.
     @t}\comment{@>
    /* This matrix is large and very temporary,
    so it does not go on the obstack */
-  void* matrix_buffer = my_malloc(matrix_sizeof(
+  void* matrix_buffer = marpa__a_malloc(Allocator_of_G(g), matrix_sizeof(
      pre_census_xsy_count,
                        pre_census_xsy_count));
   Bit_Matrix nullification_matrix =
@@ -3905,7 +4143,7 @@ Change so that this runs only if there are prediction events.
             }
         }
     }
-  transitive_closure (nullification_matrix);
+  transitive_closure (Allocator_of_G(g), nullification_matrix);
   for (xsyid = 0; xsyid < pre_census_xsy_count; xsyid++)
     {
       Bit_Vector bv_nullifications_by_to_xsy =
@@ -3913,7 +4151,7 @@ Change so that this runs only if there are prediction events.
       Nulled_XSYIDs_of_XSYID (xsyid) =
         cil_bv_add(&g->t_cilar, bv_nullifications_by_to_xsy);
     }
-    my_free(matrix_buffer);
+    marpa__a_free(Allocator_of_G(g), matrix_buffer);
 }
 
 @** The sequence rewrite.
@@ -4746,7 +4984,7 @@ loop rule count, with the final tally.
         matrix_obs_create (obs_precompute, xrl_count,
             xrl_count);
     @<Mark direct unit transitions in |unit_transition_matrix|@>@;
-    transitive_closure(unit_transition_matrix);
+    transitive_closure(Allocator_of_G(g), unit_transition_matrix);
     @<Mark loop rules@>@;
     if (loop_rule_count)
       {
@@ -4890,7 +5128,7 @@ I test that |g->t_ahms| is non-zero.
 @ @<Initialize grammar elements@> =
 g->t_ahms = NULL;
 @ @<Destroy grammar elements@> =
-     my_free(g->t_ahms);
+     marpa__a_free(Allocator_of_G(g), g->t_ahms);
 
 @ Check that AHM ID is in valid range.
 @<Function definitions@> =
@@ -4979,6 +5217,8 @@ so the emphasis is on what precedes the dot position.
 @ @d SYMI_Count_of_G(g) ((g)->t_symbol_instance_count)
 @<Int aligned grammar elements@> =
 int t_symbol_instance_count;
+@ @<Initialize grammar elements@> =
+SYMI_Count_of_G(g) = 0;
 @ @d SYMI_of_IRL(irl) ((irl)->t_symbol_instance_base)
 @d Last_Proper_SYMI_of_IRL(irl) ((irl)->t_last_proper_symi)
 @d SYMI_of_Completed_IRL(irl)
@@ -5002,6 +5242,21 @@ or if not, which one will be needed.
     CIL t_predicted_irl_cil;
     CIL t_lhs_cil;
 
+@*0 Prediction bundle.
+The AHM's which this AHM predicts,
+as a CIL of AHM ID's.
+This is the predicted IRL CIL, with each IRL replaced
+by its first AHM,
+so that the recognizer can add the predictions
+for an Earley item without looking up the IRL's.
+Like the predicted IRL CIL, it is sorted, has no duplicates,
+and is the empty CIL if there are no predictions.
+Since CIL's are shared, AHM's with the same postdot symbol
+share a single bundle.
+@d Prediction_Bundle_of_AHM(ahm) ((ahm)->t_prediction_bundle)
+@<Widely aligned AHM elements@> =
+    CIL t_prediction_bundle;
+
 @*0 Zero-width assertions at this AHM.
 A CIL representing the zero-width assertions at this AHM.
 The empty CIL if there are none.
@@ -5085,7 +5340,7 @@ Marpa_Symbol_ID _marpa_g_ahm_postdot(Marpa_Grammar g,
       const IRL irl = IRL_by_ID(irl_id);
       @<Count the AHMs in a rule@>@;
     }
-    current_item = base_item = marpa_new(struct s_ahm, ahm_count);
+    current_item = base_item = marpa_a_new(Allocator_of_G(g), struct s_ahm, ahm_count);
     for (irl_id = 0; irl_id < irl_count; irl_id++) {
       const IRL irl = IRL_by_ID(irl_id);
       SYMI_of_IRL(irl) = symbol_instance_of_next_rule;
@@ -5098,7 +5353,7 @@ Marpa_Symbol_ID _marpa_g_ahm_postdot(Marpa_Grammar g,
     MARPA_ASSERT(ahm_count == current_item - base_item);
     AHM_Count_of_G(g) = ahm_count;
     MARPA_DEBUG3("At %s, Setting debug count to %ld", STRLOC, (long)ahm_count);
-    g->t_ahms = marpa_renew(struct s_ahm, base_item, ahm_count);
+    g->t_ahms = marpa_a_renew(Allocator_of_G(g), struct s_ahm, base_item, ahm_count);
     @<Populate the first |AHM|'s of the |RULE|'s@>@;
 }
 
@@ -5226,8 +5481,8 @@ memoize_xrl_data_for_AHM(AHM current_item, IRL irl)
 }
 
 @ This is done after creating the AHMs, because in
-theory the |marpa_renew| might have moved them.
-This is not likely since the |marpa_renew| shortened the array,
+theory the |marpa_a_renew| might have moved them.
+This is not likely since the |marpa_a_renew| shortened the array,
 but if you are hoping for portability,
 you want to follow the rules.
 @ Walks backwards through the |AHM|'s, setting each to the the
@@ -5332,11 +5587,11 @@ the bit is set if $|nsy1| = |nsy2|$.
     nsy_by_right_nsy_matrix =
         matrix_obs_create (obs_precompute, nsy_count, nsy_count);
     @<Initialize the |nsy_by_right_nsy_matrix| for right derivations@>@/
-    transitive_closure(nsy_by_right_nsy_matrix);
+    transitive_closure(Allocator_of_G(g), nsy_by_right_nsy_matrix);
     @<Mark the right recursive IRLs@>@/
     matrix_clear(nsy_by_right_nsy_matrix);
     @<Initialize the |nsy_by_right_nsy_matrix| for right recursions@>@/
-    transitive_closure(nsy_by_right_nsy_matrix);
+    transitive_closure(Allocator_of_G(g), nsy_by_right_nsy_matrix);
 }
 
 @ @<Initialize the |nsy_by_right_nsy_matrix| for right derivations@> =
@@ -5428,7 +5683,7 @@ one non-nulling symbol in each IRL. */
 than its length, as a convenient way to deal with issues
 of minimum sizes.
 @<Initialize IRL stack@> =
-    MARPA_DSTACK_INIT(g->t_irl_stack, IRL, 2*MARPA_DSTACK_CAPACITY(g->t_xrl_stack));
+    MARPA_DSTACK_INIT(g->t_irl_stack, IRL, 2*MARPA_DSTACK_CAPACITY(g->t_xrl_stack), Allocator_of_G(g));
 
 @ Clones all the used symbols,
 creating nulling versions as required.
@@ -5437,7 +5692,7 @@ than its length, as a convenient way to deal with issues
 of minimum sizes.
 @<Initialize NSY stack@> =
 {
-  MARPA_DSTACK_INIT (g->t_nsy_stack, NSY, 2 * MARPA_DSTACK_CAPACITY (g->t_xsy_stack));
+  MARPA_DSTACK_INIT (g->t_nsy_stack, NSY, 2 * MARPA_DSTACK_CAPACITY (g->t_xsy_stack), Allocator_of_G(g));
 }
 
 @ @<Calculate Rule by LHS lists@> =
@@ -5447,7 +5702,7 @@ of minimum sizes.
     @t}\comment{@>
    /* This matrix is large and very temporary,
    so it does not go on the obstack */
-  void* matrix_buffer = my_malloc(matrix_sizeof(
+  void* matrix_buffer = marpa__a_malloc(Allocator_of_G(g), matrix_sizeof(
      nsy_count, irl_count));
   Bit_Matrix irl_by_lhs_matrix =
         matrix_buffer_create (matrix_buffer, nsy_count, irl_count);
@@ -5481,7 +5736,7 @@ of minimum sizes.
       LHS_CIL_of_NSYID(lhsid) = cil_buffer_add (&g->t_cilar);
     }
 
-  my_free(matrix_buffer);
+  marpa__a_free(Allocator_of_G(g), matrix_buffer);
 
 }
 
@@ -5497,8 +5752,9 @@ states.
     Bit_Matrix prediction_nsy_by_nsy_matrix =
         matrix_obs_create (obs_precompute, nsy_count, nsy_count);
     @<Initialize the |prediction_nsy_by_nsy_matrix|@>@/
-    transitive_closure(prediction_nsy_by_nsy_matrix);
+    transitive_closure(Allocator_of_G(g), prediction_nsy_by_nsy_matrix);
     @<Create the prediction matrix from the symbol-by-symbol matrix@>@/
+    @<Populate the lookahead CIL's in the NSY's@>@/
 }
 
 @ @<Initialize the |prediction_nsy_by_nsy_matrix|@> =
@@ -5578,11 +5834,52 @@ with |S2| on its LHS.
     }
 }
 
+@ The FIRST set of an IRL is its first postdot symbol,
+together with every symbol which that symbol predicts.
+Inverting this,
+a non-LHS symbol is in the FIRST set of an IRL if it
+is the postdot symbol of the IRL's first AHM,
+or if that postdot symbol predicts it.
+@<Populate the lookahead CIL's in the NSY's@> =
+{
+  NSYID nsyid;
+  const Bit_Vector bv_lookahead_ahms =
+    bv_obs_create (obs_precompute, AHM_Count_of_G (g));
+  for (nsyid = 0; nsyid < nsy_count; nsyid++)
+    {
+      IRLID irl_id;
+      if (NSY_is_LHS (NSY_by_ID (nsyid)))
+        {
+          Lookahead_CIL_of_NSYID (nsyid) = cil_empty (&g->t_cilar);
+          continue;
+        }
+      bv_clear (bv_lookahead_ahms);
+      for (irl_id = 0; irl_id < irl_count; irl_id++)
+        {
+          const AHM first_ahm = First_AHM_of_IRLID (irl_id);
+          const NSYID postdot_nsyid = Postdot_NSYID_of_AHM (first_ahm);
+          if (postdot_nsyid < 0)
+            continue;
+          if (postdot_nsyid == nsyid
+              || matrix_bit_test (prediction_nsy_by_nsy_matrix,
+                                  postdot_nsyid, nsyid))
+            {
+              bv_bit_set (bv_lookahead_ahms, ID_of_AHM (first_ahm));
+            }
+        }
+      Lookahead_CIL_of_NSYID (nsyid) =
+        cil_bv_add (&g->t_cilar, bv_lookahead_ahms);
+    }
+}
+
 @** Populating the predicted IRL CIL's in the AHM's.
-@ @<Populate the predicted IRL CIL's in the AHM's@> =
+@ The prediction bundles are built in a boolean vector
+by AHM ID, so that they come out sorted.
+@<Populate the predicted IRL CIL's in the AHM's@> =
 {
   AHMID ahm_id;
   const int ahm_count = AHM_Count_of_G (g);
+  const Bit_Vector bv_bundle = bv_obs_create (obs_precompute, ahm_count);
   for (ahm_id = 0; ahm_id < ahm_count; ahm_id++)
     {
       const AHM ahm = AHM_by_ID (ahm_id);
@@ -5591,13 +5888,26 @@ with |S2| on its LHS.
 	{
 	  Predicted_IRL_CIL_of_AHM (ahm) = cil_empty (&g->t_cilar);
 	  LHS_CIL_of_AHM (ahm) = cil_empty (&g->t_cilar);
+	  Prediction_Bundle_of_AHM (ahm) = cil_empty (&g->t_cilar);
 	}
       else
 	{
-	  Predicted_IRL_CIL_of_AHM (ahm) =
+	  int cil_ix;
+	  CIL predicted_irl_cil;
+	  int predicted_irl_count;
+	  Predicted_IRL_CIL_of_AHM (ahm) = predicted_irl_cil =
 	    cil_bv_add (&g->t_cilar,
 			matrix_row (prediction_nsy_by_irl_matrix, postdot_nsyid));
 	  LHS_CIL_of_AHM (ahm) = LHS_CIL_of_NSYID(postdot_nsyid);
+	  predicted_irl_count = Count_of_CIL (predicted_irl_cil);
+	  bv_clear (bv_bundle);
+	  for (cil_ix = 0; cil_ix < predicted_irl_count; cil_ix++)
+	    {
+	      const IRLID irlid = Item_of_CIL (predicted_irl_cil, cil_ix);
+	      bv_bit_set (bv_bundle, ID_of_AHM (First_AHM_of_IRLID (irlid)));
+	    }
+	  Prediction_Bundle_of_AHM (ahm) =
+	    cil_bv_add (&g->t_cilar, bv_bundle);
 	}
     }
 }
@@ -5672,9 +5982,9 @@ with |S2| on its LHS.
 {
   AHMID ahm_id;
   const int ahm_count_of_g = AHM_Count_of_G (g);
-  const LBV bv_completion_xsyid = bv_create (post_census_xsy_count);
-  const LBV bv_prediction_xsyid = bv_create (post_census_xsy_count);
-  const LBV bv_nulled_xsyid = bv_create (post_census_xsy_count);
+  const LBV bv_completion_xsyid = bv_create (Allocator_of_G(g), post_census_xsy_count);
+  const LBV bv_prediction_xsyid = bv_create (Allocator_of_G(g), post_census_xsy_count);
+  const LBV bv_nulled_xsyid = bv_create (Allocator_of_G(g), post_census_xsy_count);
   const CILAR cilar = &g->t_cilar;
   for (ahm_id = 0; ahm_id < ahm_count_of_g; ahm_id++)
     {
@@ -5729,9 +6039,9 @@ with |S2| on its LHS.
       Prediction_XSYIDs_of_AHM (ahm) =
         cil_bv_add (cilar, bv_prediction_xsyid);
     }
-  bv_free (bv_completion_xsyid);
-  bv_free (bv_prediction_xsyid);
-  bv_free (bv_nulled_xsyid);
+  bv_free (Allocator_of_G(g), bv_completion_xsyid);
+  bv_free (Allocator_of_G(g), bv_prediction_xsyid);
+  bv_free (Allocator_of_G(g), bv_nulled_xsyid);
 }
 
 @ @<Mark the event AHMs@> =
@@ -5750,13 +6060,28 @@ with |S2| on its LHS.
     }
 }
 
-@ @<Calculate AHM Event Group Sizes@> =
+@ Only event AHMs which are Leo completions are counted
+in the groups of Leo completions,
+so these are gathered first.
+Usually there are few or none of them,
+so that this is much faster than comparing every pair
+of AHMs, which is quadratic in the size of the grammar.
+@<Calculate AHM Event Group Sizes@> =
 {
   const int ahm_count_of_g = AHM_Count_of_G (g);
+  AHMID *const event_leo_ahm_ids =
+    marpa_obs_new (obs_precompute, AHMID, ahm_count_of_g);
+  int event_leo_ahm_count = 0;
   AHMID outer_ahm_id;
   for (outer_ahm_id = 0; outer_ahm_id < ahm_count_of_g; outer_ahm_id++)
     {
-      AHMID inner_ahm_id;
+      const AHM outer_ahm = AHM_by_ID (outer_ahm_id);
+      if (AHM_has_Event (outer_ahm) && AHM_is_Leo_Completion (outer_ahm))
+        event_leo_ahm_ids[event_leo_ahm_count++] = outer_ahm_id;
+    }
+  for (outer_ahm_id = 0; outer_ahm_id < ahm_count_of_g; outer_ahm_id++)
+    {
+      int event_leo_ahm_ix;
       const AHM outer_ahm = AHM_by_ID (outer_ahm_id);
       /* There is no test that |outer_ahm|
          is an event AHM.
@@ -5771,18 +6096,12 @@ with |S2| on its LHS.
                                    so we are done. */
        }
       outer_nsyid = LHSID_of_AHM (outer_ahm);
-      for (inner_ahm_id = 0; inner_ahm_id < ahm_count_of_g;
-           inner_ahm_id++)
+      for (event_leo_ahm_ix = 0; event_leo_ahm_ix < event_leo_ahm_count;
+           event_leo_ahm_ix++)
         {
-          NSYID inner_nsyid;
-          const AHM inner_ahm = AHM_by_ID (inner_ahm_id);
-          if (!AHM_has_Event (inner_ahm))
-            continue;           /* Not in the group, because it
-                                   is not an event AHM. */
-          if (!AHM_is_Leo_Completion(inner_ahm))
-            continue;           /* This AHM is not a Leo completion,
-                                   so we are done. */
-          inner_nsyid = LHSID_of_AHM (inner_ahm);
+          const AHM inner_ahm =
+            AHM_by_ID (event_leo_ahm_ids[event_leo_ahm_ix]);
+          const NSYID inner_nsyid = LHSID_of_AHM (inner_ahm);
           if (matrix_bit_test (nsy_by_right_nsy_matrix,
                                outer_nsyid,
                                inner_nsyid))
@@ -5816,7 +6135,7 @@ typedef struct s_r_zwa* ZWA;
 @<Widely aligned grammar elements@> =
     MARPA_DSTACK_DECLARE(t_gzwa_stack);
 @ @<Initialize grammar elements@> =
-    MARPA_DSTACK_INIT2(g->t_gzwa_stack, GZWA);
+    MARPA_DSTACK_INIT2(g->t_gzwa_stack, GZWA, Allocator_of_G(g));
 @ @<Destroy grammar elements@> =
     MARPA_DSTACK_DESTROY(g->t_gzwa_stack);
 
@@ -5855,7 +6174,7 @@ typedef struct s_zwp ZWP_Object;
 @ @<Widely aligned grammar elements@> =
 MARPA_AVL_TREE t_zwp_tree;
 @ @<Initialize grammar elements@> =
-  (g)->t_zwp_tree = _marpa_avl_create (zwp_cmp, NULL);
+  (g)->t_zwp_tree = _marpa_avl_create (zwp_cmp, NULL, Allocator_of_G(g));
 @ @<Destroy grammar elements@> =
 {
     _marpa_avl_destroy ((g)->t_zwp_tree);
@@ -6056,11 +6375,12 @@ Marpa_Recognizer marpa_r_new( Marpa_Grammar g )
     @<Fail if not precomputed@>@;
     nsy_count = NSY_Count_of_G(g);
     irl_count = IRL_Count_of_G(g);
-    r = my_malloc(sizeof(struct marpa_r));
+    r = marpa__a_malloc(Allocator_of_G(g), sizeof(struct marpa_r));
     @<Initialize recognizer obstack@>@;
     @<Initialize recognizer elements@>@;
     @<Initialize dot PSAR@>@;
     @<Initialize recognizer event variables@>@;
+    @<Take the reset mark@>@;
     return r;
 }
 
@@ -6102,14 +6422,17 @@ marpa_r_ref (Marpa_Recognizer r)
    return recce_ref(r);
 }
 
-@ @<Function definitions@> =
+@ The grammar's allocator is copied, because destroying
+the recognizer elements may also destroy the grammar.
+@<Function definitions@> =
 PRIVATE
 void recce_free(struct marpa_r *r)
 {
     @<Unpack recognizer objects@>@;
+    struct marpa_allocator_s allocator = *Allocator_of_G(g);
     @<Destroy recognizer elements@>@;
     @<Destroy recognizer obstack@>@;
-    my_free( r);
+    marpa__a_free(&allocator, r);
 }
 
 @*0 Base objects.
@@ -6273,7 +6596,7 @@ int marpa_r_terminals_expected(Marpa_Recognizer r, Marpa_Symbol_ID* buffer)
   @<Fail if recognizer not started@>@;
 
   xsy_count = XSY_Count_of_G (g);
-  bv_terminals = bv_create (xsy_count);
+  bv_terminals = bv_create (Allocator_of_G(g), xsy_count);
   for (start = 0; bv_scan (r->t_bv_nsyid_is_expected, start, &min, &max);
        start = max + 2)
     {
@@ -6293,7 +6616,7 @@ int marpa_r_terminals_expected(Marpa_Recognizer r, Marpa_Symbol_ID* buffer)
 	  buffer[next_buffer_ix++] = xsyid;
 	}
     }
-  bv_free (bv_terminals);
+  bv_free (Allocator_of_G(g), bv_terminals);
   return next_buffer_ix;
 }
 
@@ -6606,10 +6929,20 @@ unset otherwise.
   MARPA_DSTACK_DECLARE(t_irl_cil_stack);
 @ @<Initialize recognizer elements@> =
   r->t_bv_irl_seen = bv_obs_create( r->t_obs, irl_count );
-  MARPA_DSTACK_INIT2(r->t_irl_cil_stack, CIL);
+  MARPA_DSTACK_INIT2(r->t_irl_cil_stack, CIL, Allocator_of_G(g));
 @ @<Destroy recognizer elements@> =
   MARPA_DSTACK_DESTROY(r->t_irl_cil_stack);
 
+@*0 Predicted AHM boolean vector.
+A boolean vector by AHM ID,
+used while adding predictions to an Earley set.
+It is set if the AHM has already been predicted
+in the current Earley set, unset otherwise.
+@<Widely aligned recognizer elements@> =
+  Bit_Vector t_bv_ahm_predicted;
+@ @<Initialize recognizer elements@> =
+  r->t_bv_ahm_predicted = bv_obs_create( r->t_obs, AHM_Count_of_G(g) );
+
 @*1 Is the parser exhausted?.
 A parser is ``exhausted" if it cannot accept any more input.
 Both successful and failed parses can be ``exhausted".
@@ -6656,7 +6989,7 @@ Create an obstack with the lifetime of the recognizer.
 This is a very efficient way of allocating memory which won't be
 resized and which will have the same lifetime as the recognizer.
 @<Widely aligned recognizer elements@> = struct marpa_obstack *t_obs;
-@ @<Initialize recognizer obstack@> = r->t_obs = marpa_obs_init;
+@ @<Initialize recognizer obstack@> = r->t_obs = marpa_obs_cache_init(Chunk_Cache_of_G(g));
 @ @<Destroy recognizer obstack@> = marpa_obs_free(r->t_obs);
 
 @*1 The ZWA Array.
@@ -6747,6 +7080,7 @@ struct s_earley_set {
     @<Widely aligned Earley set elements@>@;
     int t_postdot_sym_count;
     @<Int aligned Earley set elements@>@;
+    @<Bit aligned Earley set elements@>@;
 };
 typedef struct s_earley_set YS_Object;
 
@@ -6810,7 +7144,12 @@ int marpa_r_earley_set_value(Marpa_Recognizer r, Marpa_Earley_Set_ID set_id)
       MARPA_ERROR(MARPA_ERR_NO_EARLEY_SET_AT_LOCATION);
       return failure_indicator;
     }
-  earley_set = YS_of_R_by_Ord (r, set_id);
+  earley_set = ys_of_r_by_ord (r, set_id);
+  if (_MARPA_UNLIKELY(!earley_set))
+    {
+      MARPA_ERROR(MARPA_ERR_EARLEY_SET_FORGOTTEN);
+      return failure_indicator;
+    }
   return Value_of_YS(earley_set);
 }
 
@@ -6835,7 +7174,12 @@ marpa_r_earley_set_values(Marpa_Recognizer r, Marpa_Earley_Set_ID set_id,
       MARPA_ERROR(MARPA_ERR_NO_EARLEY_SET_AT_LOCATION);
       return failure_indicator;
     }
-  earley_set = YS_of_R_by_Ord (r, set_id);
+  earley_set = ys_of_r_by_ord (r, set_id);
+  if (_MARPA_UNLIKELY(!earley_set))
+    {
+      MARPA_ERROR(MARPA_ERR_EARLEY_SET_FORGOTTEN);
+      return failure_indicator;
+    }
   if (p_value) *p_value = Value_of_YS(earley_set);
   if (p_pvalue) *p_pvalue = PValue_of_YS(earley_set);
   return 1;
@@ -6875,7 +7219,10 @@ earley_set_new( RECCE r, JEARLEME id)
 {
   YSK_Object key;
   YS set;
-  set = marpa_obs_new (r->t_obs, YS_Object, 1);
+  if (R_is_Forgetful(r) && YS_Batch_is_Closed(r)) {
+      ys_batch_new(r);
+  }
+  set = marpa_obs_new (YS_Obs_of_R(r), YS_Object, 1);
   key.t_earleme = id;
   set->t_key = key;
   set->t_postdot_ary = NULL;
@@ -6930,19 +7277,17 @@ when the Earley item is initialized.
 @ The ID of the Earley item is per-Earley-set, so that
 to uniquely specify the Earley item you must also specify
 the Earley set.
-@d YS_of_YIM(yim) ((yim)->t_key.t_set)
+@d YS_of_YIM(yim) ((yim)->t_set)
 @d YS_Ord_of_YIM(yim) (Ord_of_YS(YS_of_YIM(yim)))
 @d Ord_of_YIM(yim) ((yim)->t_ordinal)
 @d Earleme_of_YIM(yim) Earleme_of_YS(YS_of_YIM(yim))
-@d AHM_of_YIM(yim) ((yim)->t_key.t_ahm)
-@d AHMID_of_YIM(yim) ID_of_AHM(AHM_of_YIM(yim))
 @d Postdot_NSYID_of_YIM(yim) Postdot_NSYID_of_AHM(AHM_of_YIM(yim))
 @d IRL_of_YIM(yim) IRL_of_AHM(AHM_of_YIM(yim))
 @d IRLID_of_YIM(yim) ID_of_IRL(IRL_of_YIM(yim))
 @d XRL_of_YIM(yim) XRL_of_AHM(AHM_of_YIM(yim))
 @d Origin_Earleme_of_YIM(yim) (Earleme_of_YS(Origin_of_YIM(yim)))
 @d Origin_Ord_of_YIM(yim) (Ord_of_YS(Origin_of_YIM(yim)))
-@d Origin_of_YIM(yim) ((yim)->t_key.t_origin)
+@d Origin_of_YIM(yim) ((yim)->t_origin)
 @s YIM int
 @<Private incomplete structures@> =
 struct s_earley_item;
@@ -6954,6 +7299,9 @@ typedef struct s_earley_item_key* YIK;
 @ The layout matters a great deal, because there will be lots of them.
 I reduce the size of the YIM ordinal in order to save one word per
 YIM.
+The source container must be the last field,
+because the Earley items of a link-free recognizer
+are allocated without most of it.
 I could widen it beyond the current count, but
 a limit of over 64,000 Earley items in a single Earley set
 should not be restrictive in practice.
@@ -6972,16 +7320,88 @@ struct s_earley_item_key {
 };
 typedef struct s_earley_item_key YIK_Object;
 struct s_earley_item {
-     YIK_Object t_key;
-     union u_source_container t_container;
+     YS t_origin;
+     YS t_set;
+#if MARPA_COMPACT_YIM
+     AHMID t_ahmid;
+#else
+     AHM t_ahm;
+#endif
      BITFIELD t_ordinal:YIM_ORDINAL_WIDTH;
     BITFIELD t_source_type:3;
     BITFIELD t_is_rejected:1;
     BITFIELD t_is_active:1;
     BITFIELD t_was_scanned:1;
     BITFIELD t_was_fusion:1;
+     union u_source_container t_container;
 };
 typedef struct s_earley_item YIM_Object;
+@<Earley item layout macros@>@;
+
+@ There are two layouts of the Earley item, chosen at build time,
+so that they can be benchmarked against each other.
+The default layout keeps a pointer to the AHM.
+The compact layout is chosen by defining |MARPA_COMPACT_YIM| to 1.
+In the compact layout,
+the AHM is kept as a 32-bit ID,
+which is found through the grammar's AHM array,
+a pointer to which is kept in each Earley set.
+The items of predicted AHMs never have a source,
+and in the compact layout they are allocated without
+a source container.
+On a 64-bit host, an Earley item with sources is 56 bytes
+in the compact layout, instead of 64,
+and the item of a predicted AHM is 24 bytes.
+@ The origin and the set of an Earley item are pointers
+in both layouts.
+Because of alignment, making only one of them a 32-bit ordinal
+would not save any space,
+and making both of them ordinals would mean that an Earley
+item could not be used without its recognizer,
+which is not how most of the code which follows
+source links is written.
+@d AHMs_of_YS(set) ((set)->t_ahms)
+@<Earley item layout macros@> =
+#if MARPA_COMPACT_YIM
+#define AHM_of_YIM(yim) (AHMs_of_YS(YS_of_YIM(yim)) + (yim)->t_ahmid)
+#define AHMID_of_YIM(yim) ((AHMID)(yim)->t_ahmid)
+#define AHM_of_YIM_Set(yim, ahm) \
+  ((yim)->t_ahmid = (AHMID)((ahm) - AHMs_of_YS(YS_of_YIM(yim))))
+#define AHM_is_Unsourced(ahm) AHM_is_Prediction(ahm)
+#else
+#define AHM_of_YIM(yim) ((yim)->t_ahm)
+#define AHMID_of_YIM(yim) ID_of_AHM(AHM_of_YIM(yim))
+#define AHM_of_YIM_Set(yim, ahm) ((yim)->t_ahm = (ahm))
+#define AHM_is_Unsourced(ahm) ((void)(ahm), 0)
+#endif
+@ @<Widely aligned Earley set elements@> =
+#if MARPA_COMPACT_YIM
+AHM t_ahms;
+#endif
+@ @<Initialize Earley set@> =
+#if MARPA_COMPACT_YIM
+   AHMs_of_YS(set) = G_of_R(r)->t_ahms;
+#endif
+
+@ The Earley items of AHMs which are never sourced
+have no source container.
+In the default layout, there are no such AHMs.
+@d Sizeof_Unsourced_YIM (offsetof (YIM_Object, t_container))
+@<Function definitions@> =
+PRIVATE YIM earley_item_alloc(const RECCE r, const AHM ahm)
+{
+  if (AHM_is_Unsourced (ahm))
+    {
+      return marpa__obs_alloc (YS_Obs_of_R (r),
+                               Sizeof_Unsourced_YIM, ALIGNOF (YIM_Object));
+    }
+  if (R_is_Link_Free (r))
+    {
+      return marpa__obs_alloc (YS_Obs_of_R (r),
+                               Sizeof_Link_Free_YIM, ALIGNOF (YIM_Object));
+    }
+  return marpa_obs_new (YS_Obs_of_R (r), struct s_earley_item, 1);
+}
 
 @ Signed as opposed to the the way it is kept (unsigned, for portability,
 because it is a bitfield.  I may have to change this.
@@ -7005,11 +7425,14 @@ PRIVATE YIM earley_item_create(const RECCE r,
   const YS set = key.t_set;
   const int count = ++YIM_Count_of_YS(set);
   @<Check count against Earley item fatal threshold@>@;
-  new_item = marpa_obs_new (r->t_obs, struct s_earley_item, 1);
-  new_item->t_key = key;
+  new_item = earley_item_alloc (r, key.t_ahm);
+  Origin_of_YIM (new_item) = key.t_origin;
+  YS_of_YIM (new_item) = set;
+  AHM_of_YIM_Set (new_item, key.t_ahm);
   new_item->t_source_type = NO_SOURCE;
   YIM_is_Rejected(new_item) = 0;
   YIM_is_Active(new_item) = 1;
+  if (!R_is_Link_Free (r) && !AHM_is_Unsourced (key.t_ahm))
   {
     SRC unique_yim_src = SRC_of_YIM (new_item);
     SRC_is_Rejected (unique_yim_src) = 0;
@@ -7406,6 +7829,11 @@ tkn_link_add (RECCE r,
 {
   SRCL new_link;
   unsigned int previous_source_type = Source_Type_of_YIM (item);
+  if (R_is_Link_Free (r))
+    {
+      @<Mark link-free |item| as sourced@>@;
+      return;
+    }
   if (previous_source_type == NO_SOURCE)
     {
       const SRCL source_link = SRCL_of_YIM(item);
@@ -7420,7 +7848,7 @@ tkn_link_add (RECCE r,
     { // If the sourcing is not already ambiguous, make it so
       earley_item_ambiguate (r, item);
     }
-  new_link = unique_srcl_new (r->t_obs);
+  new_link = unique_srcl_new (YS_Obs_of_R(r));
   new_link->t_next = LV_First_Token_SRCL_of_YIM (item);
   new_link->t_source.t_predecessor = predecessor;
   NSYID_of_Source(new_link->t_source) = NSYID_of_ALT(alternative);
@@ -7438,6 +7866,11 @@ completion_link_add (RECCE r,
 {
   SRCL new_link;
   unsigned int previous_source_type = Source_Type_of_YIM (item);
+  if (R_is_Link_Free (r))
+    {
+      @<Mark link-free |item| as sourced@>@;
+      return;
+    }
   if (previous_source_type == NO_SOURCE)
     {
       const SRCL source_link = SRCL_of_YIM(item);
@@ -7451,7 +7884,7 @@ completion_link_add (RECCE r,
     { // If the sourcing is not already ambiguous, make it so
       earley_item_ambiguate (r, item);
     }
-  new_link = unique_srcl_new (r->t_obs);
+  new_link = unique_srcl_new (YS_Obs_of_R(r));
   new_link->t_next = LV_First_Completion_SRCL_of_YIM (item);
   new_link->t_source.t_predecessor = predecessor;
   Cause_of_Source(new_link->t_source) = cause;
@@ -7467,6 +7900,11 @@ leo_link_add (RECCE r,
 {
   SRCL new_link;
   unsigned int previous_source_type = Source_Type_of_YIM (item);
+  if (R_is_Link_Free (r))
+    {
+      @<Mark link-free |item| as sourced@>@;
+      previous_source_type = SOURCE_IS_AMBIGUOUS;
+    }
   if (previous_source_type == NO_SOURCE)
     {
       const SRCL source_link = SRCL_of_YIM(item);
@@ -7480,7 +7918,7 @@ leo_link_add (RECCE r,
     { // If the sourcing is not already ambiguous, make it so
       earley_item_ambiguate (r, item);
     }
-  new_link = unique_srcl_new (r->t_obs);
+  new_link = unique_srcl_new (YS_Obs_of_R(r));
   new_link->t_next = LV_First_Leo_SRCL_of_YIM (item);
   new_link->t_source.t_predecessor = predecessor;
   Cause_of_Source(new_link->t_source) = cause;
@@ -7525,7 +7963,7 @@ void earley_item_ambiguate (struct marpa_r * r, YIM item)
 }
 
 @ @<Ambiguate token source@> = {
-  SRCL new_link = marpa_obs_new (r->t_obs, SRCL_Object, 1);
+  SRCL new_link = marpa_obs_new (YS_Obs_of_R(r), SRCL_Object, 1);
   *new_link = *SRCL_of_YIM(item);
   LV_First_Leo_SRCL_of_YIM (item) = NULL;
   LV_First_Completion_SRCL_of_YIM (item) = NULL;
@@ -7533,7 +7971,7 @@ void earley_item_ambiguate (struct marpa_r * r, YIM item)
 }
 
 @ @<Ambiguate completion source@> = {
-  SRCL new_link = marpa_obs_new (r->t_obs, SRCL_Object, 1);
+  SRCL new_link = marpa_obs_new (YS_Obs_of_R(r), SRCL_Object, 1);
   *new_link = *SRCL_of_YIM(item);
   LV_First_Leo_SRCL_of_YIM (item) = NULL;
   LV_First_Completion_SRCL_of_YIM (item) = new_link;
@@ -7541,7 +7979,7 @@ void earley_item_ambiguate (struct marpa_r * r, YIM item)
 }
 
 @ @<Ambiguate Leo source@> = {
-  SRCL new_link = marpa_obs_new (r->t_obs, SRCL_Object, 1);
+  SRCL new_link = marpa_obs_new (YS_Obs_of_R(r), SRCL_Object, 1);
   *new_link = *SRCL_of_YIM(item);
   LV_First_Leo_SRCL_of_YIM (item) = new_link;
   LV_First_Completion_SRCL_of_YIM (item) = NULL;
@@ -7576,7 +8014,7 @@ typedef struct s_alternative ALT_Object;
 MARPA_DSTACK_DECLARE(t_alternatives);
 @
 @<Initialize recognizer elements@> =
-MARPA_DSTACK_INIT2(r->t_alternatives, ALT_Object);
+MARPA_DSTACK_INIT2(r->t_alternatives, ALT_Object, Allocator_of_G(g));
 @ @<Destroy recognizer elements@> = MARPA_DSTACK_DESTROY(r->t_alternatives);
 
 @ This functions returns the index at which to insert a new
@@ -7740,6 +8178,7 @@ PRIVATE int alternative_insert(RECCE r, ALT new_alternative)
 
     bv_clear (r->t_bv_irl_seen);
     bv_bit_set (r->t_bv_irl_seen, ID_of_IRL(start_irl));
+    predicted_ahms_init (r);
     MARPA_DSTACK_CLEAR(r->t_irl_cil_stack);
     *MARPA_DSTACK_PUSH(r->t_irl_cil_stack, CIL) = LHS_CIL_of_AHM(start_ahm);
 
@@ -7760,6 +8199,13 @@ PRIVATE int alternative_insert(RECCE r, ALT new_alternative)
                   const IRL prediction_irl = IRL_by_ID (prediction_irlid);
                   const AHM prediction_ahm = First_AHM_of_IRL (prediction_irl);
                   @t}\comment{@>
+                  /* Predictions excluded by the lookahead are marked
+                  as already predicted.
+                  Nothing they predict can be in the lookahead either. */
+                  if (bv_bit_test (r->t_bv_ahm_predicted,
+                                   ID_of_AHM (prediction_ahm)))
+                    continue;
+                  @t}\comment{@>
                   /* If any of the assertions fail, do not add this AHM to
                   the YS, or look at anything predicted by it. */
                   if (!evaluate_zwas(r, 0, prediction_ahm)) continue;
@@ -7827,9 +8273,430 @@ int evaluate_zwas(RECCE r, YSID ysid, AHM ahm)
 @ @<Declare |marpa_r_start_input| locals@> =
     const NSYID nsy_count = NSY_Count_of_G(g);
     const NSYID xsy_count = XSY_Count_of_G(g);
-    Bit_Vector bv_ok_for_chain = bv_create(nsy_count);
+    Bit_Vector bv_ok_for_chain = bv_create(Allocator_of_G(g), nsy_count);
 @ @<Destroy |marpa_r_start_input| locals@> =
-    bv_free(bv_ok_for_chain);
+    bv_free(Allocator_of_G(g), bv_ok_for_chain);
+
+@** Resetting the recognizer.
+A recognizer can be reset to the state it was in
+just after it was created,
+so that it can be used for a fresh parse.
+This is cheaper than destroying the recognizer and
+creating a new one,
+because the reset keeps the memory the recognizer
+has already allocated:
+the chunks of its obstack,
+its dynamic stacks,
+and its bit vectors.
+An application which does many short parses with the same grammar,
+such as a lexer,
+soon stops allocating memory at all.
+@ The settings of the recognizer,
+which are the ones made before input is started,
+survive a reset.
+These are the Earley item warning threshold,
+the Leo flag,
+the forgetful flag,
+the link-free flag,
+the event activations,
+the expected symbol events,
+and the defaults of the zero-width assertions.
+Everything else,
+including the Earley sets, the alternatives and the
+progress report,
+is discarded.
+The recognizer is left in the ``before input'' phase,
+and |marpa_r_start_input| must be called again before
+any input is read.
+@ The reset mark is the point in the recognizer obstack
+to which a reset rewinds.
+Everything allocated on the obstack by |marpa_r_new|
+is below the mark,
+and survives a reset.
+@<Widely aligned recognizer elements@> =
+  struct marpa_obstack_mark t_reset_mark;
+@ The mark must be taken last, after everything else
+that |marpa_r_new| puts on the recognizer obstack.
+@<Take the reset mark@> =
+  marpa_obs_mark(r->t_obs, &r->t_reset_mark);
+
+@*0 Recognizer generations.
+Traversers point into the Earley sets of their recognizer,
+and those Earley sets do not survive a reset.
+Traversers hold a reference to their recognizer,
+so a reset cannot simply be refused while
+traversers exist.
+Instead, the recognizer tracks its ``generation'',
+which is incremented by every reset.
+A traverser remembers the generation in which it was created,
+and it is an error to use a traverser from an earlier
+generation.
+@d R_Generation(r) ((r)->t_generation)
+@<Int aligned recognizer elements@> = unsigned int t_generation;
+@ @<Initialize recognizer elements@> = r->t_generation = 0;
+
+@ On success, returns a non-negative integer.
+On failure, returns |-2|.
+@<Function definitions@> =
+int marpa_r_reset(Marpa_Recognizer r)
+{
+  @<Return |-2| on failure@>@;
+  @<Unpack recognizer objects@>@;
+  @<Fail if fatal error@>@;
+  {
+    const unsigned int next_generation = R_Generation(r)+1;
+    if (next_generation > UINT_MAX - 42)
+      {
+        MARPA_ERROR (MARPA_ERR_DEVELOPMENT);
+        return failure_indicator;
+      }
+    R_Generation(r) = next_generation;
+  }
+  @<Clear progress report in |r|@>@;
+  @t}\comment{@>
+  /* The PSLs have back pointers into the Earley sets,
+  so they must be released before the obstack is rewound */
+  if (!G_is_Trivial(g)) {
+      psar_clear(Dot_PSAR_of_R(r));
+  }
+  @<Reset recognizer elements@>@;
+  marpa_obs_rewind(r->t_obs, &r->t_reset_mark);
+  return 1;
+}
+
+@ The Earley set stack is kept, but emptied.
+|r_update_earley_sets| knows that an initialized
+but empty stack must be rebuilt from the first
+Earley set.
+@<Reset recognizer elements@> =
+{
+  ZWAID zwaid;
+  const int zwa_count = ZWA_Count_of_R(r);
+  bv_clear (r->t_bv_lookahead);
+  Input_Phase_of_R(r) = R_BEFORE_INPUT;
+  First_YS_of_R(r) = NULL;
+  Latest_YS_of_R(r) = NULL;
+  Current_Earleme_of_R(r) = -1;
+  Furthest_Earleme_of_R(r) = 0;
+  YS_Count_of_R(r) = 0;
+  bv_clear (r->t_bv_nsyid_is_expected);
+  r->t_is_using_leo = 0;
+  R_is_Exhausted(r) = 0;
+  First_Inconsistent_YS_of_R(r) = -1;
+  for (zwaid = 0; zwaid < zwa_count; zwaid++)
+    {
+      const ZWA zwa = RZWA_by_ID(zwaid);
+      Memo_Value_of_ZWA(zwa) = Default_Value_of_ZWA(zwa);
+      Memo_YSID_of_ZWA(zwa) = -1;
+    }
+  MARPA_DSTACK_CLEAR(r->t_alternatives);
+  MARPA_DSTACK_CLEAR(r->t_irl_cil_stack);
+  MARPA_DSTACK_CLEAR(r->t_yim_work_stack);
+  MARPA_DSTACK_CLEAR(r->t_completion_stack);
+  MARPA_DSTACK_CLEAR(r->t_earley_set_stack);
+  MARPA_DSTACK_CLEAR(r->t_checkpoints);
+  ur_node_stack_reset(URS_of_R(r));
+  r->t_trace_earley_set = NULL;
+  r->t_trace_earley_item = NULL;
+  r->t_trace_pim_nsy_p = NULL;
+  r->t_trace_postdot_item = NULL;
+  r->t_trace_source_link = NULL;
+  r->t_trace_source_type = NO_SOURCE;
+}
+
+@** Checkpoints.
+A checkpoint records the state of the recognizer
+at its latest Earley set,
+so that the recognizer can later be rolled back to that state,
+and continue from there with different input.
+An application which re-parses after every small change
+to its input,
+such as an editor,
+can roll back to the last checkpoint before the change,
+instead of starting over.
+@ The Earley sets are allocated on the recognizer obstack,
+in order,
+and nothing in an Earley set is changed once the
+next Earley set is started,
+except for the postdot item lists,
+which are cleared by |psar_clear|.
+So a checkpoint is mostly an obstack mark,
+and rolling back is mostly a rewind.
+The rest of a checkpoint is a copy of the small amount of state
+which belongs to the recognizer, rather than to its Earley sets:
+the earlemes, the input phase, the expected terminals,
+the valued status of the terminals,
+and the alternatives which have not yet been scanned.
+Those copies are placed on the obstack below the mark,
+so that they survive a rollback to their own checkpoint.
+A second mark is taken just before the copies are made,
+so that they can be freed when the checkpoint is replaced.
+@ In incremental use, a checkpoint may be taken at every
+Earley set,
+and the bit vectors are most of the size of a checkpoint.
+The valued status of the terminals rarely changes,
+so a count of the changes is kept,
+and a checkpoint shares the copies of the previous checkpoint,
+instead of making its own,
+when the count has not changed since the previous checkpoint was taken.
+The expected terminals change more often,
+and are compared with those of the previous checkpoint.
+The copies of the previous checkpoint are below its mark,
+and so are never freed while a later checkpoint exists.
+@ Checkpoints are kept on a stack,
+in order by Earley set.
+A checkpoint is identified by the ordinal of its Earley set,
+and there is at most one checkpoint for each Earley set.
+A rollback discards the checkpoints after the one rolled back to,
+but keeps that one,
+so that an application can roll back to the same checkpoint
+again and again.
+@ The Earley sets of a forgetful recognizer
+are not allocated on the recognizer obstack,
+and do not survive until a rollback,
+so checkpoints are not allowed for forgetful recognizers.
+@s CHECKPOINT int
+@<Private incomplete structures@> =
+struct s_checkpoint;
+typedef struct s_checkpoint* CHECKPOINT;
+@ @<Private structures@> =
+struct s_checkpoint {
+    struct marpa_obstack_mark t_mark;
+    struct marpa_obstack_mark t_copy_mark;
+    YS t_latest_ys;
+    ALT t_alternatives;
+    Bit_Vector t_bv_nsyid_is_expected;
+    LBV t_valued_terminal;
+    LBV t_unvalued_terminal;
+    LBV t_valued;
+    LBV t_unvalued;
+    LBV t_valued_locked;
+    JEARLEME t_current_earleme;
+    JEARLEME t_furthest_earleme;
+    int t_alternative_count;
+    int t_valued_change_count;
+    BITFIELD t_input_phase:2;
+    BITFIELD t_is_exhausted:1;
+};
+typedef struct s_checkpoint CHECKPOINT_Object;
+
+@ @<Widely aligned recognizer elements@> =
+MARPA_DSTACK_DECLARE(t_checkpoints);
+@ @<Initialize recognizer elements@> =
+MARPA_DSTACK_INIT(r->t_checkpoints, CHECKPOINT_Object, 8, Allocator_of_G(g));
+@ @<Destroy recognizer elements@> = MARPA_DSTACK_DESTROY(r->t_checkpoints);
+
+@ Taking a checkpoint at an Earley set which already has one
+replaces it.
+Nothing has been allocated on the obstack since the old
+checkpoint was taken,
+except the old checkpoint's own copies,
+because nothing is allocated there until a new Earley set is started.
+So the obstack is first rewound to the old copy mark,
+which frees the old copies before the new ones are made.
+On success, returns the ordinal of the latest Earley set,
+which identifies the checkpoint.
+On failure, returns |-2|.
+@<Function definitions@> =
+Marpa_Earley_Set_ID marpa_r_checkpoint(Marpa_Recognizer r)
+{
+  @<Return |-2| on failure@>@;
+  @<Unpack recognizer objects@>@;
+  const int xsy_count = XSY_Count_of_G (g);
+  CHECKPOINT checkpoint;
+  CHECKPOINT previous = NULL;
+  YS latest_ys;
+  int checkpoint_count;
+  int alternative_count;
+  @<Fail if fatal error@>@;
+  @<Fail if recognizer not started@>@;
+  @<Fail if recognizer is forgetful@>@;
+  latest_ys = Latest_YS_of_R (r);
+  checkpoint = MARPA_DSTACK_TOP (r->t_checkpoints, CHECKPOINT_Object);
+  if (checkpoint && checkpoint->t_latest_ys == latest_ys)
+    {
+      marpa_obs_rewind (r->t_obs, &checkpoint->t_copy_mark);
+    }
+  else
+    {
+      checkpoint = MARPA_DSTACK_PUSH (r->t_checkpoints, CHECKPOINT_Object);
+    }
+  checkpoint_count = MARPA_DSTACK_LENGTH (r->t_checkpoints);
+  if (checkpoint_count >= 2)
+    {
+      previous =
+        MARPA_DSTACK_INDEX (r->t_checkpoints, CHECKPOINT_Object,
+                            checkpoint_count - 2);
+    }
+  marpa_obs_mark (r->t_obs, &checkpoint->t_copy_mark);
+  checkpoint->t_latest_ys = latest_ys;
+  checkpoint->t_current_earleme = Current_Earleme_of_R (r);
+  checkpoint->t_furthest_earleme = Furthest_Earleme_of_R (r);
+  checkpoint->t_input_phase = Input_Phase_of_R (r);
+  checkpoint->t_is_exhausted = R_is_Exhausted (r);
+  if (previous
+      && bv_is_equal (previous->t_bv_nsyid_is_expected,
+                      r->t_bv_nsyid_is_expected))
+    {
+      checkpoint->t_bv_nsyid_is_expected = previous->t_bv_nsyid_is_expected;
+    }
+  else
+    {
+      checkpoint->t_bv_nsyid_is_expected =
+        bv_obs_clone (r->t_obs, r->t_bv_nsyid_is_expected);
+    }
+  checkpoint->t_valued_change_count = r->t_valued_change_count;
+  if (previous
+      && previous->t_valued_change_count == r->t_valued_change_count)
+    {
+      checkpoint->t_valued_terminal = previous->t_valued_terminal;
+      checkpoint->t_unvalued_terminal = previous->t_unvalued_terminal;
+      checkpoint->t_valued = previous->t_valued;
+      checkpoint->t_unvalued = previous->t_unvalued;
+      checkpoint->t_valued_locked = previous->t_valued_locked;
+    }
+  else
+    {
+      checkpoint->t_valued_terminal =
+        lbv_clone (r->t_obs, r->t_valued_terminal, xsy_count);
+      checkpoint->t_unvalued_terminal =
+        lbv_clone (r->t_obs, r->t_unvalued_terminal, xsy_count);
+      checkpoint->t_valued = lbv_clone (r->t_obs, r->t_valued, xsy_count);
+      checkpoint->t_unvalued = lbv_clone (r->t_obs, r->t_unvalued, xsy_count);
+      checkpoint->t_valued_locked =
+        lbv_clone (r->t_obs, r->t_valued_locked, xsy_count);
+    }
+  alternative_count = MARPA_DSTACK_LENGTH (r->t_alternatives);
+  checkpoint->t_alternative_count = alternative_count;
+  checkpoint->t_alternatives = NULL;
+  if (alternative_count > 0)
+    {
+      int alt_ix;
+      const ALT alternatives =
+        MARPA_DSTACK_BASE (r->t_alternatives, ALT_Object);
+      checkpoint->t_alternatives =
+        marpa_obs_new (r->t_obs, ALT_Object, alternative_count);
+      for (alt_ix = 0; alt_ix < alternative_count; alt_ix++)
+        {
+          checkpoint->t_alternatives[alt_ix] = alternatives[alt_ix];
+        }
+    }
+  marpa_obs_mark (r->t_obs, &checkpoint->t_mark);
+  return Ord_of_YS (latest_ys);
+}
+
+@ A rollback is like a reset,
+except that the Earley sets up to and including that of the checkpoint
+are kept.
+The traversers become stale,
+and the progress report and the trace data are cleared.
+Events which have not been read are discarded.
+Terminals whose valued status was locked by input read
+after the checkpoint are unlocked again.
+The settings of the recognizer are not changed.
+On success, returns the ordinal of the Earley set
+of the checkpoint,
+which is now the latest Earley set.
+On failure, returns |-2|.
+@<Function definitions@> =
+Marpa_Earley_Set_ID
+marpa_r_rollback (Marpa_Recognizer r, Marpa_Earley_Set_ID ysid)
+{
+  @<Return |-2| on failure@>@;
+  @<Unpack recognizer objects@>@;
+  CHECKPOINT checkpoint = NULL;
+  int checkpoint_ix;
+  @<Fail if fatal error@>@;
+  @<Fail if recognizer not started@>@;
+  for (checkpoint_ix = MARPA_DSTACK_LENGTH (r->t_checkpoints) - 1;
+       checkpoint_ix >= 0; checkpoint_ix--)
+    {
+      checkpoint =
+        MARPA_DSTACK_INDEX (r->t_checkpoints, CHECKPOINT_Object,
+                            checkpoint_ix);
+      if (Ord_of_YS (checkpoint->t_latest_ys) <= ysid)
+        break;
+    }
+  if (_MARPA_UNLIKELY (checkpoint_ix < 0
+                       || Ord_of_YS (checkpoint->t_latest_ys) != ysid))
+    {
+      MARPA_ERROR (MARPA_ERR_NO_SUCH_CHECKPOINT);
+      return failure_indicator;
+    }
+  {
+    const unsigned int next_generation = R_Generation (r) + 1;
+    if (next_generation > UINT_MAX - 42)
+      {
+        MARPA_ERROR (MARPA_ERR_DEVELOPMENT);
+        return failure_indicator;
+      }
+    R_Generation (r) = next_generation;
+  }
+  @<Clear progress report in |r|@>@;
+  @<Clear trace Earley set dependent data@>@;
+  @t}\comment{@>
+  /* The PSLs have back pointers into the Earley sets,
+  so they must be released before the obstack is rewound */
+  if (!G_is_Trivial (g))
+    {
+      psar_clear (Dot_PSAR_of_R (r));
+    }
+  G_EVENTS_CLEAR (g);
+  @<Restore recognizer elements from |checkpoint|@>@;
+  marpa_obs_rewind (r->t_obs, &checkpoint->t_mark);
+  MARPA_DSTACK_COUNT_SET (r->t_checkpoints, checkpoint_ix + 1);
+  return ysid;
+}
+
+@ The Earley set stack is truncated,
+rather than emptied,
+so that |r_update_earley_sets| does not have to rebuild it
+from the first Earley set.
+The memoized values of the zero-width assertions
+are indexed by Earley set ordinal,
+and the ordinals after the checkpoint will be reused,
+so those memos are cleared.
+@<Restore recognizer elements from |checkpoint|@> =
+{
+  ZWAID zwaid;
+  int alt_ix;
+  const int zwa_count = ZWA_Count_of_R (r);
+  const int xsy_count = XSY_Count_of_G (g);
+  const YS latest_ys = checkpoint->t_latest_ys;
+  Next_YS_of_YS (latest_ys) = NULL;
+  Latest_YS_of_R (r) = latest_ys;
+  YS_Count_of_R (r) = Ord_of_YS (latest_ys) + 1;
+  Current_Earleme_of_R (r) = checkpoint->t_current_earleme;
+  Furthest_Earleme_of_R (r) = checkpoint->t_furthest_earleme;
+  Input_Phase_of_R (r) = checkpoint->t_input_phase;
+  R_is_Exhausted (r) = checkpoint->t_is_exhausted;
+  bv_copy (r->t_bv_nsyid_is_expected, checkpoint->t_bv_nsyid_is_expected);
+  lbv_copy (r->t_valued_terminal, checkpoint->t_valued_terminal, xsy_count);
+  lbv_copy (r->t_unvalued_terminal, checkpoint->t_unvalued_terminal,
+            xsy_count);
+  lbv_copy (r->t_valued, checkpoint->t_valued, xsy_count);
+  lbv_copy (r->t_unvalued, checkpoint->t_unvalued, xsy_count);
+  lbv_copy (r->t_valued_locked, checkpoint->t_valued_locked, xsy_count);
+  r->t_valued_change_count = checkpoint->t_valued_change_count;
+  MARPA_DSTACK_CLEAR (r->t_alternatives);
+  for (alt_ix = 0; alt_ix < checkpoint->t_alternative_count; alt_ix++)
+    {
+      *MARPA_DSTACK_PUSH (r->t_alternatives, ALT_Object) =
+        checkpoint->t_alternatives[alt_ix];
+    }
+  if (MARPA_DSTACK_LENGTH (r->t_earley_set_stack) > YS_Count_of_R (r))
+    {
+      MARPA_DSTACK_COUNT_SET (r->t_earley_set_stack, YS_Count_of_R (r));
+    }
+  for (zwaid = 0; zwaid < zwa_count; zwaid++)
+    {
+      const ZWA zwa = RZWA_by_ID (zwaid);
+      Memo_YSID_of_ZWA (zwa) = -1;
+    }
+  MARPA_DSTACK_CLEAR (r->t_yim_work_stack);
+  MARPA_DSTACK_CLEAR (r->t_completion_stack);
+  ur_node_stack_reset (URS_of_R (r));
+}
 
 @** Read a token alternative.
 The ordinary semantics of a parser generator is a token-stream
@@ -7866,6 +8733,12 @@ time they are encountered.
   LBV t_unvalued;
   LBV t_valued_locked;
 
+@ The number of changes to the valued status of the terminals,
+which lets a checkpoint tell whether it can share the copies
+of these vectors made by the previous checkpoint.
+@<Int aligned recognizer elements@> = int t_valued_change_count;
+@ @<Initialize recognizer elements@> = r->t_valued_change_count = 0;
+
 @ @<Set up terminal-related boolean vectors@> =
 {
   XSYID xsy_id;
@@ -7968,6 +8841,7 @@ Marpa_Earleme marpa_r_alternative(
       lbv_bit_set(r->t_valued_locked, tkn_xsy_id);
       lbv_bit_set(r->t_valued_terminal, tkn_xsy_id);
       lbv_bit_set(r->t_valued, tkn_xsy_id);
+      r->t_valued_change_count++;
     }
     if (!value && _MARPA_UNLIKELY(!lbv_bit_test(r->t_unvalued_terminal, tkn_xsy_id)))
     {
@@ -7982,6 +8856,7 @@ Marpa_Earleme marpa_r_alternative(
       lbv_bit_set(r->t_valued_locked, tkn_xsy_id);
       lbv_bit_set(r->t_unvalued_terminal, tkn_xsy_id);
       lbv_bit_set(r->t_unvalued, tkn_xsy_id);
+      r->t_valued_change_count++;
     }
 }
 
@@ -8078,7 +8953,7 @@ This section is devoted to the logic for completion.
 {
   if (!MARPA_DSTACK_IS_INITIALIZED (r->t_yim_work_stack))
     {
-      MARPA_DSTACK_INIT2 (r->t_yim_work_stack, YIM);
+      MARPA_DSTACK_INIT2 (r->t_yim_work_stack, YIM, Allocator_of_G(g));
     }
 }
 @ @<Destroy recognizer elements@> = MARPA_DSTACK_DESTROY(r->t_yim_work_stack);
@@ -8093,7 +8968,7 @@ Large stacks may needed for very ambiguous grammars.
 {
   if (!MARPA_DSTACK_IS_INITIALIZED (r->t_completion_stack))
     {
-      MARPA_DSTACK_INIT2 (r->t_completion_stack, YIM);
+      MARPA_DSTACK_INIT2 (r->t_completion_stack, YIM, Allocator_of_G(g));
     }
 }
 @ @<Destroy recognizer elements@> = MARPA_DSTACK_DESTROY(r->t_completion_stack);
@@ -8141,14 +9016,18 @@ marpa_r_earleme_complete(Marpa_Recognizer r)
       MARPA_ERROR(MARPA_ERR_RECCE_IS_INCONSISTENT);
       return failure_indicator;
   }
+  if (_MARPA_UNLIKELY(memory_limit_is_exceeded(r, 0))) {
+      MARPA_ERROR(MARPA_ERR_MEMORY_LIMIT);
+      return failure_indicator;
+  }
 
   {
     int count_of_expected_terminals;
     @<Declare |marpa_r_earleme_complete| locals@>@;
     G_EVENTS_CLEAR(g);
     psar_dealloc(Dot_PSAR_of_R(r));
-    bv_clear (r->t_bv_nsyid_is_expected);
     bv_clear (r->t_bv_irl_seen);
+    marpa_obs_mark (entry_ys_obs, &entry_mark);
     @<Initialize |current_earleme|@>@;
     @<Return 0 if no alternatives@>@;
     @<Initialize |current_earley_set|@>@;
@@ -8157,7 +9036,10 @@ marpa_r_earleme_complete(Marpa_Recognizer r)
     while ((cause_p = MARPA_DSTACK_POP(r->t_completion_stack, YIM))) {
       YIM cause = *cause_p;
         @<Add new Earley items for |cause|@>@;
+        @<Check the memory limit, every so often@>@;
     }
+    if (_MARPA_UNLIKELY(memory_limit_is_exceeded(r, 0)))
+      goto MEMORY_LIMIT_EXCEEDED;
     @<Add predictions to |current_earley_set|@>@;
     postdot_items_create(r, bv_ok_for_chain, current_earley_set);
 
@@ -8176,7 +9058,13 @@ marpa_r_earleme_complete(Marpa_Recognizer r)
     if (r->t_active_event_count > 0) {
         trigger_events(r);
     }
+    @<Forget Earley sets, if it is time@>@;
     return_value = G_EVENT_COUNT(g);
+    goto CLEANUP;
+    MEMORY_LIMIT_EXCEEDED: ;
+    @<Undo the incomplete Earley set@>@;
+    MARPA_ERROR(MARPA_ERR_MEMORY_LIMIT);
+    return_value = failure_indicator;
     CLEANUP: ;
     @<Destroy |marpa_r_earleme_complete| locals@>@;
   }
@@ -8188,16 +9076,19 @@ and so should only be initialized if they are in use.
 But I expect to use it for other purposes.
 @<Declare |marpa_r_earleme_complete| locals@> =
     const NSYID nsy_count = NSY_Count_of_G(g);
-    Bit_Vector bv_ok_for_chain = bv_create(nsy_count);
-    struct marpa_obstack* const earleme_complete_obs = marpa_obs_init;
+    Bit_Vector bv_ok_for_chain = bv_create(Allocator_of_G(g), nsy_count);
+    struct marpa_obstack* const earleme_complete_obs =
+      marpa_obs_cache_init(Chunk_Cache_of_G(g));
+    @<Declare the memory limit locals of |marpa_r_earleme_complete|@>@;
 @ @<Destroy |marpa_r_earleme_complete| locals@> =
-    bv_free(bv_ok_for_chain);
+    bv_free(Allocator_of_G(g), bv_ok_for_chain);
     marpa_obs_free( earleme_complete_obs );
 
 @ @<Initialize |current_earleme|@> = {
   current_earleme = ++(Current_Earleme_of_R(r));
   if (current_earleme > Furthest_Earleme_of_R (r))
     {
+        bv_clear (r->t_bv_nsyid_is_expected);
         @<Set |r| exhausted@>@;
         MARPA_ERROR(MARPA_ERR_PARSE_EXHAUSTED);
         return_value = failure_indicator;
@@ -8221,6 +9112,10 @@ The return value means success, with no events.
   ALT end_of_stack = MARPA_DSTACK_TOP (r->t_alternatives, ALT_Object);
   if (!end_of_stack || current_earleme != End_Earleme_of_ALT (end_of_stack))
     {
+      @t}\comment{@>
+      /* No Earley set is created, so no token can start here */
+      bv_clear (r->t_bv_lookahead);
+      bv_clear (r->t_bv_nsyid_is_expected);
       return_value = 0;
       goto CLEANUP;
     }
@@ -8232,7 +9127,10 @@ The return value means success, with no events.
     @t}\comment{@>
     /* |alternative_pop()| does not return inactive alternatives */
   while ((alternative = alternative_pop (r, current_earleme)))
-    @<Scan an Earley item from alternative@>@;
+    {
+      @<Scan an Earley item from alternative@>@;
+      @<Check the memory limit, every so often@>@;
+    }
 }
 
 @ The consequences of ignoring Leo items here is that a right
@@ -8393,26 +9291,37 @@ active.
     leo_link_add (r, effect, leo_item, cause);
 }
 
-@ @<Add predictions to |current_earley_set|@> =
+@ Predictions are added from the prediction bundles of the
+Earley items already in the set.
+Until predictions are added,
+no item in the current Earley set has it as its origin,
+so the predicted AHM boolean vector is an exact test for duplicates,
+and the items can be created without consulting the PSL.
+@<Add predictions to |current_earley_set|@> =
 {
   int ix;
   const int no_of_work_earley_items =
     MARPA_DSTACK_LENGTH (r->t_yim_work_stack);
+  const Bit_Vector bv_ahm_predicted = r->t_bv_ahm_predicted;
+  YIK_Object key;
+  key.t_origin = current_earley_set;
+  key.t_set = current_earley_set;
+  predicted_ahms_init (r);
   for (ix = 0; ix < no_of_work_earley_items; ix++)
     {
       YIM earley_item = WORK_YIM_ITEM (r, ix);
 
       int cil_ix;
       const AHM ahm = AHM_of_YIM (earley_item);
-      const CIL prediction_cil = Predicted_IRL_CIL_of_AHM (ahm);
-      const int prediction_count = Count_of_CIL (prediction_cil);
+      const CIL bundle = Prediction_Bundle_of_AHM (ahm);
+      const int prediction_count = Count_of_CIL (bundle);
       for (cil_ix = 0; cil_ix < prediction_count; cil_ix++)
 	{
-	  const IRLID prediction_irlid = Item_of_CIL (prediction_cil, cil_ix);
-	  const IRL prediction_irl = IRL_by_ID (prediction_irlid);
-	  const AHM prediction_ahm = First_AHM_of_IRL (prediction_irl);
-	  earley_item_assign (r, current_earley_set, current_earley_set,
-			      prediction_ahm);
+	  const AHMID prediction_ahmid = Item_of_CIL (bundle, cil_ix);
+	  if (bv_bit_test_then_set (bv_ahm_predicted, prediction_ahmid))
+	    continue;
+	  key.t_ahm = AHM_by_ID (prediction_ahmid);
+	  earley_item_create (r, key);
 	}
 
     }
@@ -8425,7 +9334,8 @@ PRIVATE void trigger_events(RECCE r)
   const YS current_earley_set = Latest_YS_of_R (r);
   int min, max, start;
   int yim_ix;
-  struct marpa_obstack *const trigger_events_obs = marpa_obs_init;
+  struct marpa_obstack *const trigger_events_obs =
+    marpa_obs_cache_init(Chunk_Cache_of_G(g));
   const YIM *yims = YIMs_of_YS (current_earley_set);
   const XSYID xsy_count = XSY_Count_of_G (g);
   const int ahm_count = AHM_Count_of_G (g);
@@ -8613,7 +9523,7 @@ PRIVATE void earley_set_update_items(RECCE r, YS set)
     YIM* finished_earley_items;
     int working_earley_item_count;
     int i;
-    YIMs_of_YS(set) = marpa_obs_new(r->t_obs, YIM, YIM_Count_of_YS(set));
+    YIMs_of_YS(set) = marpa_obs_new(YS_Obs_of_R(r), YIM, YIM_Count_of_YS(set));
     finished_earley_items = YIMs_of_YS(set);
     /* We know that no new earley items will be added in this scope */
     working_earley_items = Work_YIMs_of_R(r);
@@ -8643,15 +9553,2421 @@ PRIVATE void r_update_earley_sets(RECCE r)
     if (!MARPA_DSTACK_IS_INITIALIZED(r->t_earley_set_stack)) {
         first_unstacked_earley_set = First_YS_of_R(r);
         MARPA_DSTACK_INIT (r->t_earley_set_stack, YS,
-                 MAX (1024, YS_Count_of_R(r)));
+                 MAX (1024, YS_Count_of_R(r)), Allocator_of_G(G_of_R(r)));
     } else {
          YS* end_of_stack = MARPA_DSTACK_TOP(r->t_earley_set_stack, YS);
-         first_unstacked_earley_set = Next_YS_of_YS(*end_of_stack);
+         @t}\comment{@>
+         /* The stack is empty after a reset */
+         first_unstacked_earley_set = end_of_stack
+           ? Next_YS_of_YS(*end_of_stack) : First_YS_of_R(r);
+    }
+    for (set = first_unstacked_earley_set; set; set = Next_YS_of_YS(set)) {
+          YS* end_of_stack = MARPA_DSTACK_PUSH(r->t_earley_set_stack, YS);
+          (*end_of_stack) = set;
+    }
+}
+
+@ In a forgetful recognizer,
+the Earley set stack holds only the Earley sets which
+have been kept, in order by ordinal,
+so that the index of an Earley set in the stack
+is not necessarily its ordinal.
+Some of the Earley sets which have been kept are
+nonetheless forgotten.
+This function finds an Earley set by its ordinal,
+using a binary search if the recognizer is forgetful.
+It returns |NULL| if the Earley set has been forgotten.
+The caller must have called |r_update_earley_sets|,
+and must have checked that the ordinal is valid.
+@<Function definitions@> =
+PRIVATE YS
+ys_of_r_by_ord (RECCE r, YSID ysid)
+{
+  int lo = 0;
+  int hi;
+  if (!R_is_Forgetful (r))
+    return YS_of_R_by_Ord (r, ysid);
+  hi = MARPA_DSTACK_LENGTH (r->t_earley_set_stack) - 1;
+  while (hi >= lo)
+    {
+      const int trial = lo + (hi - lo) / 2;
+      const YS trial_ys = YS_of_R_by_Ord (r, trial);
+      const YSID trial_ysid = Ord_of_YS (trial_ys);
+      if (trial_ysid == ysid)
+        return YS_is_Forgotten (trial_ys) ? NULL : trial_ys;
+      if (trial_ysid < ysid)
+        {
+          lo = trial + 1;
+        }
+      else
+        {
+          hi = trial - 1;
+        }
+    }
+  return NULL;
+}
+
+@** Forgetful recognizers.
+A recognizer keeps every Earley set,
+and everything in it,
+for as long as the recognizer exists,
+because a bocage may be created at any Earley set.
+But many applications never create a bocage.
+A validator, for example,
+only wants to know whether its input is accepted,
+and which events occurred along the way.
+For applications like these,
+the recognizer can be made ``forgetful''.
+A forgetful recognizer discards the Earley sets which
+can no longer affect recognition,
+so that its memory is proportional to the part of
+the parse which is still open,
+instead of to the length of the input.
+@ The price is that a bocage cannot be created
+from a forgetful recognizer,
+and that the Earley sets which have been forgotten
+cannot be examined.
+Methods which look at a forgotten Earley set fail with
+|MARPA_ERR_EARLEY_SET_FORGOTTEN|.
+Methods which follow a token link to its predecessor
+fail with |MARPA_ERR_RECCE_IS_FORGETFUL|,
+because that predecessor is in the Earley set
+where the token started,
+and that Earley set is usually not kept.
+@d R_is_Forgetful(r) ((r)->t_is_forgetful)
+@<Bit aligned recognizer elements@> =
+BITFIELD t_is_forgetful:1;
+@ @<Initialize recognizer elements@> =
+R_is_Forgetful(r) = 0;
+
+@ Returns 1 if the recognizer is forgetful,
+0 if not,
+and |-2| if there was an error.
+@<Function definitions@> =
+int marpa_r_forgetful(Marpa_Recognizer r)
+{
+  @<Return |-2| on failure@>@;
+  @<Unpack recognizer objects@>@;
+  @<Fail if fatal error@>@;
+  return R_is_Forgetful(r);
+}
+
+@ Like the Leo flag,
+the forgetful flag may only be set before input starts,
+and it survives a reset.
+@<Function definitions@> =
+int marpa_r_forgetful_set(Marpa_Recognizer r, int value)
+{
+  @<Return |-2| on failure@>@;
+  @<Unpack recognizer objects@>@;
+  @<Fail if fatal error@>@;
+  @<Fail if recognizer started@>@;
+  return R_is_Forgetful(r) = value ? 1 : 0;
+}
+
+@ @<Fail if recognizer is forgetful@> =
+if (_MARPA_UNLIKELY(R_is_Forgetful(r))) {
+    MARPA_ERROR(MARPA_ERR_RECCE_IS_FORGETFUL);
+    return failure_indicator;
+}
+
+@*0 Earley set batches.
+The memory for the Earley sets of a forgetful recognizer
+is allocated in batches of consecutive Earley sets.
+Each batch has its own obstack,
+and everything in the Earley sets of a batch ---
+the Earley sets themselves,
+and their Earley items, postdot items, Leo items
+and source links ---
+is allocated on it.
+A batch is freed when none of its Earley sets is needed.
+A recognizer which is not forgetful
+allocates its Earley sets on the recognizer obstack,
+and has no batches.
+@d YS_Obs_of_R(r) ((r)->t_ys_obs)
+@d YS_Batch_is_Closed(r) ((r)->t_ys_batch_is_closed)
+@s YS_BATCH int
+@<Private incomplete structures@> =
+struct s_ys_batch;
+typedef struct s_ys_batch* YS_BATCH;
+@ @<Private structures@> =
+struct s_ys_batch {
+    struct marpa_obstack* t_obs;
+    YS_BATCH t_next;
+    YSID t_first_ysid;
+    BITFIELD t_is_needed:1;
+};
+@ @<Widely aligned recognizer elements@> =
+struct marpa_obstack* t_ys_obs;
+YS_BATCH t_first_ys_batch;
+YS_BATCH t_latest_ys_batch;
+@ @<Bit aligned recognizer elements@> =
+BITFIELD t_ys_batch_is_closed:1;
+@ @<Initialize recognizer elements@> =
+YS_Obs_of_R(r) = r->t_obs;
+r->t_first_ys_batch = NULL;
+r->t_latest_ys_batch = NULL;
+YS_Batch_is_Closed(r) = 1;
+@ The batches are freed with the recognizer obstack,
+after the PSLs are destroyed,
+because destroying a PSL writes to its owner,
+which may be in a batch.
+@<Destroy recognizer obstack@> = ys_batches_free(r);
+@ @<Reset recognizer elements@> = ys_batches_free(r);
+
+@ A new batch is started by the first Earley set
+created after the latest batch is closed.
+The batch structure is itself
+allocated on the obstack of the batch,
+so that it is freed along with it.
+@<Function definitions@> =
+PRIVATE void ys_batch_new(RECCE r)
+{
+  struct marpa_obstack* const obs =
+    marpa_obs_cache_init(Chunk_Cache_of_G(G_of_R(r)));
+  const YS_BATCH batch = marpa_obs_new (obs, struct s_ys_batch, 1);
+  batch->t_obs = obs;
+  batch->t_next = NULL;
+  batch->t_first_ysid = YS_Count_of_R(r);
+  batch->t_is_needed = 1;
+  if (r->t_latest_ys_batch) {
+      r->t_latest_ys_batch->t_next = batch;
+  } else {
+      r->t_first_ys_batch = batch;
+  }
+  r->t_latest_ys_batch = batch;
+  YS_Obs_of_R(r) = obs;
+  YS_Batch_is_Closed(r) = 0;
+}
+
+@ @<Function definitions@> =
+PRIVATE void ys_batches_free(RECCE r)
+{
+  YS_BATCH batch = r->t_first_ys_batch;
+  while (batch) {
+      const YS_BATCH next_batch = batch->t_next;
+      marpa_obs_free (batch->t_obs);
+      batch = next_batch;
+  }
+  r->t_first_ys_batch = NULL;
+  r->t_latest_ys_batch = NULL;
+  YS_Obs_of_R(r) = r->t_obs;
+  YS_Batch_is_Closed(r) = 1;
+}
+
+@*0 Which Earley sets are needed.
+The latest Earley set is always needed,
+and so is the start Earley set of every pending alternative,
+because scanning looks at its postdot items.
+These are the {\bf root} Earley sets.
+Everything in a root Earley set must stay valid,
+so that it can be examined,
+for example by a progress report or by an event.
+The origins of all the Earley items in a root Earley set
+are needed,
+because the progress report looks at them.
+@ The other Earley sets are needed only for recognition,
+which looks at nothing in them but their postdot items.
+Completion looks in the origin of the cause
+for postdot items,
+and gives the new Earley items the origins
+of the predecessors it finds there.
+So the origins of the Earley items which are not completions
+are needed.
+The origins of completions are not,
+and this is what makes forgetting possible:
+in a left recursion,
+every Earley set contains a completion whose
+origin is the Earley set before it.
+Leo items are followed back to their origins,
+and the Leo items of the Leo links of a root Earley set
+are in the origins of their causes.
+The origins of the Leo items
+are already the origins of needed Earley items,
+but they are cheap to check, and are marked as well.
+@ The progress report follows the predecessors of CHAF rules
+back through the postdot items of the origins,
+and it follows the Leo items back to their trailheads.
+These are all postdot items of needed Earley sets,
+or their origins,
+so the progress report of a root Earley set is safe.
+@ Everything else in a non-root Earley set may point
+into an Earley set which has been freed,
+so a non-root Earley set which is kept is still
+treated as forgotten by the public methods.
+@ An origin is never later than the Earley set of its
+Earley item,
+so a single pass over the Earley sets,
+from latest to earliest,
+finds all of the needed ones.
+@d YS_is_Needed(set) ((set)->t_is_needed)
+@d YS_is_Root(set) ((set)->t_is_root)
+@d YS_is_Forgotten(set) ((set)->t_is_forgotten)
+@<Bit aligned Earley set elements@> =
+BITFIELD t_is_needed:1;
+BITFIELD t_is_root:1;
+BITFIELD t_is_forgotten:1;
+@ @<Initialize Earley set@> =
+YS_is_Needed(set) = 1;
+YS_is_Root(set) = 1;
+YS_is_Forgotten(set) = 0;
+
+@*0 Forgetting Earley sets.
+Finding the needed Earley sets takes time
+proportional to the number of Earley items
+in the Earley sets not yet forgotten.
+To keep the cost per Earley set constant,
+the search is made only after as many Earley sets
+have been added as were kept by the previous search,
+but never more often than once
+every |YS_FORGET_INTERVAL| Earley sets.
+@d YS_FORGET_INTERVAL 64
+@<Int aligned recognizer elements@> =
+YSID t_next_forget_ysid;
+@ @<Initialize recognizer elements@> =
+r->t_next_forget_ysid = YS_FORGET_INTERVAL;
+@ @<Reset recognizer elements@> =
+r->t_next_forget_ysid = YS_FORGET_INTERVAL;
+
+@ @<Forget Earley sets, if it is time@> =
+{
+  if (R_is_Forgetful (r) && YS_Count_of_R (r) >= r->t_next_forget_ysid)
+    {
+      earley_sets_forget (r);
+    }
+}
+
+@ Each search closes the latest batch,
+so that a batch can be freed once
+everything in it has been forgotten.
+If any Earley set is forgotten,
+a new recognizer generation is started,
+so that traversers which might point
+into the forgotten Earley sets become stale.
+@<Function definitions@> =
+PRIVATE_NOT_INLINE void earley_sets_forget(RECCE r)
+{
+  YS* ys_stack;
+  int ys_count;
+  int kept_count = 0;
+  r_update_earley_sets (r);
+  ys_stack = MARPA_DSTACK_BASE (r->t_earley_set_stack, YS);
+  ys_count = MARPA_DSTACK_LENGTH (r->t_earley_set_stack);
+  @<Mark the needed Earley sets@>@;
+  if (kept_count < ys_count)
+    {
+      @t}\comment{@>
+      /* The PSLs contain pointers to Earley items,
+      which are checked for staleness by looking at them,
+      so they must be cleared before anything is freed */
+      psar_clear (Dot_PSAR_of_R (r));
+      @<Unlink the Earley sets which are not needed@>@;
+      @<Free the batches which are not needed@>@;
+      @<Clear trace Earley set dependent data@>@;
+      R_Generation (r)++;
+    }
+  MARPA_DSTACK_CLEAR (r->t_earley_set_stack);
+  r->t_next_forget_ysid =
+    YS_Count_of_R (r) + MAX (YS_FORGET_INTERVAL, kept_count);
+  YS_Batch_is_Closed (r) = 1;
+}
+
+@ @<Mark the needed Earley sets@> =
+{
+  int ys_ix;
+  int alternative_ix;
+  const int alternative_count = MARPA_DSTACK_LENGTH (r->t_alternatives);
+  const ALT alternatives = MARPA_DSTACK_BASE (r->t_alternatives, ALT_Object);
+  for (ys_ix = 0; ys_ix < ys_count; ys_ix++)
+    {
+      YS_is_Needed (ys_stack[ys_ix]) = 0;
+      YS_is_Root (ys_stack[ys_ix]) = 0;
+    }
+  YS_is_Needed (Latest_YS_of_R (r)) = 1;
+  YS_is_Root (Latest_YS_of_R (r)) = 1;
+  for (alternative_ix = 0; alternative_ix < alternative_count;
+       alternative_ix++)
+    {
+      const YS start_ys = Start_YS_of_ALT (alternatives + alternative_ix);
+      YS_is_Needed (start_ys) = 1;
+      YS_is_Root (start_ys) = 1;
+    }
+  for (ys_ix = ys_count - 1; ys_ix >= 0; ys_ix--)
+    {
+      const YS ys = ys_stack[ys_ix];
+      const YIM *const yims = YIMs_of_YS (ys);
+      const int yim_count = YIM_Count_of_YS (ys);
+      PIM *const postdot_array = ys->t_postdot_ary;
+      const int postdot_sym_count = Postdot_SYM_Count_of_YS (ys);
+      int yim_ix;
+      int pim_ix;
+      if (!YS_is_Needed (ys))
+        continue;
+      kept_count++;
+      YS_is_Forgotten (ys) = !YS_is_Root (ys);
+      for (yim_ix = 0; yim_ix < yim_count; yim_ix++)
+        {
+          const YIM yim = yims[yim_ix];
+          if (YS_is_Root (ys) || !YIM_is_Completion (yim))
+            YS_is_Needed (Origin_of_YIM (yim)) = 1;
+        }
+      for (pim_ix = 0; pim_ix < postdot_sym_count; pim_ix++)
+        {
+          const PIM pim = postdot_array[pim_ix];
+          if (PIM_is_LIM (pim))
+            {
+              const YS leo_origin = Origin_of_LIM (LIM_of_PIM (pim));
+              if (leo_origin)
+                YS_is_Needed (leo_origin) = 1;
+            }
+        }
+    }
+}
+
+@ The latest Earley set is always needed,
+so that the list never becomes empty,
+and the end of the list does not change.
+@<Unlink the Earley sets which are not needed@> =
+{
+  int ys_ix;
+  YS previous_ys = NULL;
+  for (ys_ix = 0; ys_ix < ys_count; ys_ix++)
+    {
+      const YS ys = ys_stack[ys_ix];
+      if (!YS_is_Needed (ys))
+        continue;
+      if (previous_ys)
+        {
+          Next_YS_of_YS (previous_ys) = ys;
+        }
+      else
+        {
+          First_YS_of_R (r) = ys;
+        }
+      previous_ys = ys;
+    }
+}
+
+@ The batches, like the Earley set stack,
+are in order by ordinal.
+The latest batch contains the latest Earley set,
+so it is always kept.
+@<Free the batches which are not needed@> =
+{
+  int ys_ix;
+  YS_BATCH previous_batch = NULL;
+  YS_BATCH batch;
+  for (batch = r->t_first_ys_batch; batch; batch = batch->t_next)
+    {
+      batch->t_is_needed = 0;
+    }
+  batch = r->t_first_ys_batch;
+  for (ys_ix = 0; ys_ix < ys_count; ys_ix++)
+    {
+      const YS ys = ys_stack[ys_ix];
+      if (!YS_is_Needed (ys))
+        continue;
+      while (batch->t_next && batch->t_next->t_first_ysid <= Ord_of_YS (ys))
+        {
+          batch = batch->t_next;
+        }
+      batch->t_is_needed = 1;
+    }
+  batch = r->t_first_ys_batch;
+  while (batch)
+    {
+      const YS_BATCH next_batch = batch->t_next;
+      if (batch->t_is_needed)
+        {
+          if (previous_batch)
+            {
+              previous_batch->t_next = batch;
+            }
+          else
+            {
+              r->t_first_ys_batch = batch;
+            }
+          previous_batch = batch;
+        }
+      else
+        {
+          marpa_obs_free (batch->t_obs);
+        }
+      batch = next_batch;
+    }
+  previous_batch->t_next = NULL;
+  r->t_latest_ys_batch = previous_batch;
+}
+
+@** Lookahead filtering.
+Predictions are unconditional:
+every IRL predicted at an Earley set gets an Earley item,
+whether or not any token which could start it follows.
+When the application knows, before an Earley set is built,
+which terminals may start at its earleme,
+it can declare them as the ``lookahead''.
+A ``lookahead-filtered'' recognizer then adds only those
+predictions whose FIRST set includes a terminal in the lookahead.
+The others could never be advanced,
+so leaving them out does not change the parse.
+For grammars with deep expression hierarchies,
+this can remove most of the predictions.
+@ The terminals expected at an Earley set,
+and the prediction events,
+reflect the filtered predictions.
+An application which filters must declare every terminal
+which it may read at an earleme,
+or that terminal will be rejected as unexpected.
+@d R_is_Lookahead_Filtered(r) ((r)->t_is_lookahead_filtered)
+@<Bit aligned recognizer elements@> =
+BITFIELD t_is_lookahead_filtered:1;
+@ @<Initialize recognizer elements@> =
+R_is_Lookahead_Filtered(r) = 0;
+
+@ The lookahead is a boolean vector by NSY ID.
+It is used, and cleared, by the next
+|marpa_r_start_input| or |marpa_r_earleme_complete|.
+@<Widely aligned recognizer elements@> =
+Bit_Vector t_bv_lookahead;
+@ @<Initialize recognizer elements@> =
+r->t_bv_lookahead = bv_obs_create (r->t_obs, nsy_count);
+
+@ Returns 1 if the recognizer is lookahead-filtered,
+0 if not,
+and |-2| if there was an error.
+@<Function definitions@> =
+int marpa_r_lookahead_filter(Marpa_Recognizer r)
+{
+  @<Return |-2| on failure@>@;
+  @<Unpack recognizer objects@>@;
+  @<Fail if fatal error@>@;
+  return R_is_Lookahead_Filtered(r);
+}
+
+@ Like the link-free flag,
+the lookahead filter flag may only be set before input starts,
+and it survives a reset.
+@<Function definitions@> =
+int marpa_r_lookahead_filter_set(Marpa_Recognizer r, int value)
+{
+  @<Return |-2| on failure@>@;
+  @<Unpack recognizer objects@>@;
+  @<Fail if fatal error@>@;
+  @<Fail if recognizer started@>@;
+  return R_is_Lookahead_Filtered(r) = value ? 1 : 0;
+}
+
+@ Adds a terminal to the lookahead.
+Terminals which are not used in the grammar are accepted,
+but have no effect.
+Returns 1 on success, and |-2| if there was an error.
+@<Function definitions@> =
+int marpa_r_lookahead_add(Marpa_Recognizer r, Marpa_Symbol_ID xsy_id)
+{
+  @<Return |-2| on failure@>@;
+  @<Unpack recognizer objects@>@;
+  XSY xsy;
+  NSY nsy;
+  @<Fail if fatal error@>@;
+  if (_MARPA_UNLIKELY (Input_Phase_of_R (r) == R_AFTER_INPUT))
+    {
+      MARPA_ERROR (MARPA_ERR_RECCE_NOT_ACCEPTING_INPUT);
+      return failure_indicator;
+    }
+  @<Fail if |xsy_id| is malformed@>@;
+  @<Fail if |xsy_id| does not exist@>@;
+  xsy = XSY_by_ID (xsy_id);
+  if (_MARPA_UNLIKELY (!XSY_is_Terminal (xsy)))
+    {
+      MARPA_ERROR (MARPA_ERR_TOKEN_IS_NOT_TERMINAL);
+      return failure_indicator;
+    }
+  nsy = NSY_of_XSY (xsy);
+  if (nsy)
+    {
+      bv_bit_set (r->t_bv_lookahead, ID_of_NSY (nsy));
+    }
+  return 1;
+}
+
+@ Before predictions are added to an Earley set,
+the predicted AHM boolean vector is cleared.
+In a lookahead-filtered recognizer,
+it is instead set for every AHM,
+except those which can start with a terminal in the lookahead,
+so that the excluded predictions are treated as duplicates.
+@<Function definitions@> =
+PRIVATE void
+predicted_ahms_init (RECCE r)
+{
+  const GRAMMAR g = G_of_R (r);
+  const Bit_Vector bv_ahm_predicted = r->t_bv_ahm_predicted;
+  const Bit_Vector bv_lookahead = r->t_bv_lookahead;
+  int min, max, start;
+  if (!R_is_Lookahead_Filtered (r))
+    {
+      bv_clear (bv_ahm_predicted);
+      bv_clear (bv_lookahead);
+      return;
+    }
+  bv_fill (bv_ahm_predicted);
+  for (start = 0; bv_scan (bv_lookahead, start, &min, &max);
+       start = max + 2)
+    {
+      NSYID nsyid;
+      for (nsyid = min; nsyid <= max; nsyid++)
+        {
+          int cil_ix;
+          const CIL lookahead_cil = Lookahead_CIL_of_NSYID (nsyid);
+          const int cil_count = Count_of_CIL (lookahead_cil);
+          for (cil_ix = 0; cil_ix < cil_count; cil_ix++)
+            {
+              bv_bit_clear (bv_ahm_predicted,
+                            Item_of_CIL (lookahead_cil, cil_ix));
+            }
+        }
+    }
+  bv_clear (bv_lookahead);
+}
+
+@** Link-free recognizers.
+To make a bocage possible,
+the recognizer records, for every Earley item,
+a source link for every way in which that Earley item was added.
+Applications which never evaluate,
+and which only want to know whether the parse is exhausted,
+and which events occurred,
+pay for these links without using them.
+A ``link-free'' recognizer does not record
+token or completion source links.
+Its Earley items are allocated without most of the source container,
+and the link-handling branches of the link-add functions are skipped.
+@ Leo source links are still kept,
+because events, the progress report and the list of
+completed rules follow them to find the rules which a Leo item
+completes.
+They are few in number.
+@ A bocage cannot be created from a link-free recognizer,
+and methods which trace or follow token or completion links
+fail with |MARPA_ERR_RECCE_IS_LINK_FREE|.
+@d R_is_Link_Free(r) ((r)->t_is_link_free)
+@<Bit aligned recognizer elements@> =
+BITFIELD t_is_link_free:1;
+@ @<Initialize recognizer elements@> =
+R_is_Link_Free(r) = 0;
+
+@ Returns 1 if the recognizer is link-free,
+0 if not,
+and |-2| if there was an error.
+@<Function definitions@> =
+int marpa_r_link_free(Marpa_Recognizer r)
+{
+  @<Return |-2| on failure@>@;
+  @<Unpack recognizer objects@>@;
+  @<Fail if fatal error@>@;
+  return R_is_Link_Free(r);
+}
+
+@ Like the forgetful flag,
+the link-free flag may only be set before input starts,
+and it survives a reset.
+@<Function definitions@> =
+int marpa_r_link_free_set(Marpa_Recognizer r, int value)
+{
+  @<Return |-2| on failure@>@;
+  @<Unpack recognizer objects@>@;
+  @<Fail if fatal error@>@;
+  @<Fail if recognizer started@>@;
+  return R_is_Link_Free(r) = value ? 1 : 0;
+}
+
+@ @<Fail if recognizer is link-free@> =
+if (_MARPA_UNLIKELY(R_is_Link_Free(r))) {
+    MARPA_ERROR(MARPA_ERR_RECCE_IS_LINK_FREE);
+    return failure_indicator;
+}
+
+@ The Earley item of a link-free recognizer
+only has room for the first field of the source container.
+That is the head of the list of Leo source links
+in an ambiguous source.
+@d Sizeof_Link_Free_YIM
+  (offsetof (YIM_Object, t_container) + sizeof (SRCL))
+
+@ In a link-free recognizer,
+a sourced Earley item is always treated as ambiguous,
+with a list of Leo links which may be empty.
+The source type is still set,
+because the callers of the link-add functions
+use it to tell whether an Earley item is new.
+@<Mark link-free |item| as sourced@> =
+if (previous_source_type == NO_SOURCE)
+  {
+    Source_Type_of_YIM (item) = SOURCE_IS_AMBIGUOUS;
+    LV_First_Leo_SRCL_of_YIM (item) = NULL;
+  }
+
+@** Recognizer images.
+A recognizer image is a copy of the state of a recognizer,
+from which an equivalent recognizer can be created later,
+perhaps in another process.
+With it, an application can save a long parse
+and continue it later,
+without reading its input again.
+@ An image is a sequence of |int|'s in the byte order of the host.
+It is only valid for the grammar it was taken from,
+and with the same build of Libmarpa on the same kind of host.
+The grammar is identified by its symbol, rule and AHM counts,
+and a hash of its AHMs,
+which are checked when the image is read.
+@ An image contains every Earley set,
+with its Earley items, postdot items and source links,
+and the recognizer state needed to continue the parse:
+the input phase and earlemes,
+the event and terminal value settings,
+the memos of the zero-width assertions,
+and any alternatives not yet accepted.
+Pointers between these objects become ordinals.
+An Earley item is identified by the ordinal of its Earley set
+and its ordinal within that set.
+A Leo item is identified by the ordinal of its Earley set
+and its index in that set's postdot array.
+@ The pointer values of the Earley sets are not in the image,
+and neither are the checkpoints.
+A forgetful recognizer cannot be imaged,
+because it has discarded some of its Earley sets.
+@d IMAGE_MAGIC 0x4d524931
+@d IMAGE_IS_REJECTED 0x1
+@d IMAGE_IS_ACTIVE 0x2
+@d IMAGE_WAS_SCANNED 0x4
+@d IMAGE_WAS_FUSION 0x8
+@<Private incomplete structures@> =
+struct s_image_writer;
+typedef struct s_image_writer* IMAGE_WRITER;
+struct s_image_reader;
+typedef struct s_image_reader* IMAGE_READER;
+@ @<Private structures@> =
+struct s_image_writer {
+    unsigned char* t_buffer;
+    size_t t_capacity;
+    size_t t_length;
+};
+typedef struct s_image_writer IMAGE_WRITER_Object;
+struct s_image_reader {
+    const unsigned char* t_image;
+    size_t t_length;
+    size_t t_offset;
+    int t_is_bad;
+};
+typedef struct s_image_reader IMAGE_READER_Object;
+
+@*0 Writing images.
+The writer counts every |int|,
+but only stores those for which there is room in the buffer.
+This allows the application to find the size of an image
+by writing it into an empty buffer.
+@<Function definitions@> =
+PRIVATE void
+image_int_write (IMAGE_WRITER w, int value)
+{
+  if (w->t_length + sizeof (int) <= w->t_capacity)
+    {
+      memcpy (w->t_buffer + w->t_length, &value, sizeof (int));
+    }
+  w->t_length += sizeof (int);
+}
+
+@ Boolean vectors are written 32 bits to an |int|.
+Both LBV's and |Bit_Vector|'s can be written this way,
+because they keep their bits in the same layout.
+@<Function definitions@> =
+PRIVATE void
+image_lbv_write (IMAGE_WRITER w, LBV lbv, int bits)
+{
+  int ix;
+  for (ix = 0; ix < bits; ix += 32)
+    {
+      unsigned int word = 0;
+      int bit;
+      for (bit = 0; bit < 32 && ix + bit < bits; bit++)
+        {
+          if (lbv_bit_test (lbv, ix + bit))
+            word |= 1u << bit;
+        }
+      image_int_write (w, (int) word);
+    }
+}
+
+@ A reference to an Earley item is written as
+the ordinal of its Earley set,
+followed by its ordinal within the set.
+A null reference is written as two |-1|'s.
+@<Function definitions@> =
+PRIVATE void
+image_yim_ref_write (IMAGE_WRITER w, YIM yim)
+{
+  if (!yim)
+    {
+      image_int_write (w, -1);
+      image_int_write (w, -1);
+      return;
+    }
+  image_int_write (w, Ord_of_YS (YS_of_YIM (yim)));
+  image_int_write (w, Ord_of_YIM (yim));
+}
+
+@ A reference to a Leo item is written as
+the ordinal of its Earley set,
+followed by its index in the postdot array of that set.
+Leo items are always at the head of their postdot chain,
+so that index can be found with a binary search.
+@<Function definitions@> =
+PRIVATE void
+image_lim_ref_write (IMAGE_WRITER w, LIM lim)
+{
+  YS set;
+  if (!lim)
+    {
+      image_int_write (w, -1);
+      image_int_write (w, -1);
+      return;
+    }
+  set = YS_of_LIM (lim);
+  image_int_write (w, Ord_of_YS (set));
+  image_int_write (w,
+                   (int) (pim_nsy_p_find (set, Postdot_NSYID_of_LIM (lim)) -
+                          set->t_postdot_ary));
+}
+
+@ The source type decides the kind of the predecessor and cause.
+@<Function definitions@> =
+PRIVATE void
+image_srcl_write (IMAGE_WRITER w, SRCL srcl, unsigned int source_type)
+{
+  image_int_write (w,
+                   (SRCL_is_Rejected (srcl) ? IMAGE_IS_REJECTED : 0) |
+                   (SRCL_is_Active (srcl) ? IMAGE_IS_ACTIVE : 0));
+  switch (source_type)
+    {
+    case SOURCE_IS_TOKEN:
+      image_yim_ref_write (w, Predecessor_of_SRCL (srcl));
+      image_int_write (w, NSYID_of_SRCL (srcl));
+      image_int_write (w, Value_of_SRCL (srcl));
+      return;
+    case SOURCE_IS_COMPLETION:
+      image_yim_ref_write (w, Predecessor_of_SRCL (srcl));
+      image_yim_ref_write (w, Cause_of_SRCL (srcl));
+      return;
+    case SOURCE_IS_LEO:
+      image_lim_ref_write (w, LIM_of_SRCL (srcl));
+      image_yim_ref_write (w, Cause_of_SRCL (srcl));
+      return;
+    }
+}
+
+@ @<Function definitions@> =
+PRIVATE void
+image_srcl_chain_write (IMAGE_WRITER w, SRCL first_srcl,
+                        unsigned int source_type)
+{
+  SRCL srcl;
+  int count = 0;
+  for (srcl = first_srcl; srcl; srcl = Next_SRCL_of_SRCL (srcl))
+    count++;
+  image_int_write (w, count);
+  for (srcl = first_srcl; srcl; srcl = Next_SRCL_of_SRCL (srcl))
+    image_srcl_write (w, srcl, source_type);
+}
+
+@ The hash of the AHMs.
+It catches an image being read with a different grammar
+which happens to have the same counts.
+@<Function definitions@> =
+PRIVATE unsigned int
+grammar_image_hash (GRAMMAR g)
+{
+  unsigned int hash = 0;
+  AHMID ahm_id;
+  const int ahm_count = AHM_Count_of_G (g);
+  for (ahm_id = 0; ahm_id < ahm_count; ahm_id++)
+    {
+      const AHM ahm = AHM_by_ID (ahm_id);
+      hash = hash * 31u + (unsigned int) IRLID_of_AHM (ahm);
+      hash = hash * 31u + (unsigned int) Position_of_AHM (ahm);
+      hash = hash * 31u + (unsigned int) Postdot_NSYID_of_AHM (ahm);
+    }
+  return hash;
+}
+
+@ @<Function definitions@> =
+PRIVATE_NOT_INLINE void
+r_image_write (RECCE r, IMAGE_WRITER w)
+{
+  @<Unpack recognizer objects@>@;
+  const int xsy_count = XSY_Count_of_G (g);
+  const int nsy_count = NSY_Count_of_G (g);
+  @<Write the image header@>@;
+  @<Write the recognizer scalars to the image@>@;
+  @<Write the recognizer vectors to the image@>@;
+  @<Write the Earley sets to the image@>@;
+  @<Write the alternatives to the image@>@;
+  image_int_write (w, IMAGE_MAGIC);
+}
+
+@ @<Write the image header@> =
+{
+  image_int_write (w, IMAGE_MAGIC);
+  image_int_write (w, MARPA_LIB_MAJOR_VERSION);
+  image_int_write (w, MARPA_LIB_MINOR_VERSION);
+  image_int_write (w, MARPA_LIB_MICRO_VERSION);
+  image_int_write (w, xsy_count);
+  image_int_write (w, nsy_count);
+  image_int_write (w, IRL_Count_of_G (g));
+  image_int_write (w, AHM_Count_of_G (g));
+  image_int_write (w, ZWA_Count_of_R (r));
+  image_int_write (w, (int) grammar_image_hash (g));
+}
+
+@ @<Write the recognizer scalars to the image@> =
+{
+  image_int_write (w, Input_Phase_of_R (r));
+  image_int_write (w, Current_Earleme_of_R (r));
+  image_int_write (w, Furthest_Earleme_of_R (r));
+  image_int_write (w, R_is_Exhausted (r));
+  image_int_write (w, r->t_use_leo_flag);
+  image_int_write (w, r->t_is_using_leo);
+  image_int_write (w, R_is_Link_Free (r));
+  image_int_write (w, R_is_Lookahead_Filtered (r));
+  image_int_write (w, r->t_earley_item_warning_threshold);
+  image_int_write (w, First_Inconsistent_YS_of_R (r));
+  image_int_write (w, r->t_active_event_count);
+  image_int_write (w, YS_Count_of_R (r));
+}
+
+@ @<Write the recognizer vectors to the image@> =
+{
+  ZWAID zwaid;
+  const int zwa_count = ZWA_Count_of_R (r);
+  image_lbv_write (w, r->t_lbv_xsyid_completion_event_is_active, xsy_count);
+  image_lbv_write (w, r->t_lbv_xsyid_nulled_event_is_active, xsy_count);
+  image_lbv_write (w, r->t_lbv_xsyid_prediction_event_is_active, xsy_count);
+  image_lbv_write (w, r->t_nsy_expected_is_event, nsy_count);
+  image_lbv_write (w, r->t_valued_terminal, xsy_count);
+  image_lbv_write (w, r->t_unvalued_terminal, xsy_count);
+  image_lbv_write (w, r->t_valued, xsy_count);
+  image_lbv_write (w, r->t_unvalued, xsy_count);
+  image_lbv_write (w, r->t_valued_locked, xsy_count);
+  image_lbv_write (w, r->t_bv_nsyid_is_expected, nsy_count);
+  for (zwaid = 0; zwaid < zwa_count; zwaid++)
+    {
+      const ZWA zwa = RZWA_by_ID (zwaid);
+      image_int_write (w, Memo_Value_of_ZWA (zwa));
+      image_int_write (w, Memo_YSID_of_ZWA (zwa));
+    }
+}
+
+@ Each Earley set is written in four passes:
+its Earley items,
+its postdot chains,
+the details of its Leo items,
+and the sources of its Earley items.
+Every object an Earley set refers to is either in an earlier
+Earley set, or in an earlier pass over the same Earley set,
+so that a reader can resolve every reference when it meets it.
+@<Write the Earley sets to the image@> =
+{
+  YS set;
+  for (set = First_YS_of_R (r); set; set = Next_YS_of_YS (set))
+    {
+      const int item_count = YIM_Count_of_YS (set);
+      const int slot_count = Postdot_SYM_Count_of_YS (set);
+      YIM *const items = YIMs_of_YS (set);
+      int item_ix;
+      int slot_ix;
+      image_int_write (w, Earleme_of_YS (set));
+      image_int_write (w, Value_of_YS (set));
+      @<Write the Earley items of |set|@>@;
+      @<Write the postdot chains of |set|@>@;
+      @<Write the Leo items of |set|@>@;
+      @<Write the sources of the Earley items of |set|@>@;
+    }
+}
+
+@ @<Write the Earley items of |set|@> =
+{
+  image_int_write (w, item_count);
+  for (item_ix = 0; item_ix < item_count; item_ix++)
+    {
+      const YIM item = items[item_ix];
+      image_int_write (w, AHMID_of_YIM (item));
+      image_int_write (w, Ord_of_YS (Origin_of_YIM (item)));
+      image_int_write (w,
+                       (YIM_is_Rejected (item) ? IMAGE_IS_REJECTED : 0) |
+                       (YIM_is_Active (item) ? IMAGE_IS_ACTIVE : 0) |
+                       (YIM_was_Scanned (item) ? IMAGE_WAS_SCANNED : 0) |
+                       (YIM_was_Fusion (item) ? IMAGE_WAS_FUSION : 0));
+    }
+}
+
+@ A Leo item is written as |-1| in its postdot chain.
+@<Write the postdot chains of |set|@> =
+{
+  image_int_write (w, slot_count);
+  for (slot_ix = 0; slot_ix < slot_count; slot_ix++)
+    {
+      const PIM first_pim = set->t_postdot_ary[slot_ix];
+      PIM pim;
+      int pim_count = 0;
+      for (pim = first_pim; pim; pim = Next_PIM_of_PIM (pim))
+        pim_count++;
+      image_int_write (w, Postdot_NSYID_of_PIM (first_pim));
+      image_int_write (w, pim_count);
+      for (pim = first_pim; pim; pim = Next_PIM_of_PIM (pim))
+        {
+          const YIM item = YIM_of_PIM (pim);
+          image_int_write (w, item ? Ord_of_YIM (item) : -1);
+        }
+    }
+}
+
+@ A Leo item which was never populated has no origin
+and no CIL.
+These are written as |-1|.
+@<Write the Leo items of |set|@> =
+{
+  for (slot_ix = 0; slot_ix < slot_count; slot_ix++)
+    {
+      const PIM pim = set->t_postdot_ary[slot_ix];
+      LIM lim;
+      CIL cil;
+      if (!PIM_is_LIM (pim))
+        continue;
+      lim = LIM_of_PIM (pim);
+      image_int_write (w,
+                       (LIM_is_Rejected (lim) ? IMAGE_IS_REJECTED : 0) |
+                       (LIM_is_Active (lim) ? IMAGE_IS_ACTIVE : 0));
+      image_int_write (w,
+                       Origin_of_LIM (lim) ? Ord_of_YS (Origin_of_LIM (lim)) :
+                       -1);
+      image_int_write (w, ID_of_AHM (Top_AHM_of_LIM (lim)));
+      image_int_write (w, ID_of_AHM (Trailhead_AHM_of_LIM (lim)));
+      image_lim_ref_write (w, Predecessor_LIM_of_LIM (lim));
+      image_yim_ref_write (w, Trailhead_YIM_of_LIM (lim));
+      cil = CIL_of_LIM (lim);
+      if (!cil)
+        {
+          image_int_write (w, -1);
+        }
+      else
+        {
+          int cil_ix;
+          const int cil_count = Count_of_CIL (cil);
+          image_int_write (w, cil_count);
+          for (cil_ix = 0; cil_ix < cil_count; cil_ix++)
+            image_int_write (w, Item_of_CIL (cil, cil_ix));
+        }
+    }
+}
+
+@ An unsourced Earley item still has the flags of its unique source,
+unless the recognizer is link-free.
+An Earley item without a source container is written
+with the flags of a new one,
+so that the image does not depend on the layout.
+The Earley items of a link-free recognizer are either unsourced
+or ambiguous,
+and an ambiguous one only has its Leo sources.
+@<Write the sources of the Earley items of |set|@> =
+{
+  for (item_ix = 0; item_ix < item_count; item_ix++)
+    {
+      const YIM item = items[item_ix];
+      const unsigned int source_type = Source_Type_of_YIM (item);
+      image_int_write (w, (int) source_type);
+      if (AHM_is_Unsourced (AHM_of_YIM (item)))
+        {
+          if (!R_is_Link_Free (r))
+            image_int_write (w, IMAGE_IS_ACTIVE);
+          continue;
+        }
+      if (R_is_Link_Free (r))
+        {
+          if (source_type == SOURCE_IS_AMBIGUOUS)
+            image_srcl_chain_write (w, LV_First_Leo_SRCL_of_YIM (item),
+                                    SOURCE_IS_LEO);
+          continue;
+        }
+      switch (source_type)
+        {
+        case NO_SOURCE:
+          {
+            const SRC source = SRC_of_YIM (item);
+            image_int_write (w,
+                             (SRC_is_Rejected (source) ? IMAGE_IS_REJECTED :
+                              0) | (SRC_is_Active (source) ? IMAGE_IS_ACTIVE :
+                                    0));
+          }
+          break;
+        case SOURCE_IS_TOKEN:
+        case SOURCE_IS_COMPLETION:
+        case SOURCE_IS_LEO:
+          image_srcl_write (w, SRCL_of_YIM (item), source_type);
+          break;
+        case SOURCE_IS_AMBIGUOUS:
+          image_srcl_chain_write (w, LV_First_Leo_SRCL_of_YIM (item),
+                                  SOURCE_IS_LEO);
+          image_srcl_chain_write (w, LV_First_Token_SRCL_of_YIM (item),
+                                  SOURCE_IS_TOKEN);
+          image_srcl_chain_write (w, LV_First_Completion_SRCL_of_YIM (item),
+                                  SOURCE_IS_COMPLETION);
+          break;
+        }
+    }
+}
+
+@ @<Write the alternatives to the image@> =
+{
+  int alt_ix;
+  const int alternative_count = MARPA_DSTACK_LENGTH (r->t_alternatives);
+  image_int_write (w, alternative_count);
+  for (alt_ix = 0; alt_ix < alternative_count; alt_ix++)
+    {
+      const ALT alternative =
+        MARPA_DSTACK_INDEX (r->t_alternatives, ALT_Object, alt_ix);
+      image_int_write (w, Ord_of_YS (Start_YS_of_ALT (alternative)));
+      image_int_write (w, End_Earleme_of_ALT (alternative));
+      image_int_write (w, NSYID_of_ALT (alternative));
+      image_int_write (w, Value_of_ALT (alternative));
+      image_int_write (w, ALT_is_Valued (alternative));
+    }
+}
+
+@ Returns the size of the image in bytes,
+or |-2| on failure.
+The image is only complete if |buffer_size|
+is at least that size,
+so that an application can call |marpa_r_serialize|
+with an empty buffer to find the size of the image,
+and call it again to write the image.
+@<Function definitions@> =
+int
+marpa_r_serialize (Marpa_Recognizer r, void *buffer, int buffer_size)
+{
+  @<Return |-2| on failure@>@;
+  @<Unpack recognizer objects@>@;
+  IMAGE_WRITER_Object writer;
+  @<Fail if fatal error@>@;
+  @<Fail if recognizer not started@>@;
+  @<Fail if recognizer is forgetful@>@;
+  if (_MARPA_UNLIKELY (buffer_size < 0 || (buffer_size > 0 && !buffer)))
+    {
+      MARPA_ERROR (MARPA_ERR_INVALID_IMAGE);
+      return failure_indicator;
+    }
+  writer.t_buffer = buffer;
+  writer.t_capacity = (size_t) buffer_size;
+  writer.t_length = 0;
+  r_image_write (r, &writer);
+  if (_MARPA_UNLIKELY (writer.t_length > INT_MAX))
+    {
+      MARPA_ERROR (MARPA_ERR_INVALID_IMAGE);
+      return failure_indicator;
+    }
+  return (int) writer.t_length;
+}
+
+@*0 Reading images.
+An image may have been truncated or corrupted,
+so the reader checks every count and ID,
+and every reference,
+before it is used.
+A failed check marks the image bad.
+A read past the end of the image returns zero,
+and also marks it bad.
+Callers can therefore read several fields,
+and check whether the image is bad once afterwards.
+@<Function definitions@> =
+PRIVATE int
+image_int_read (IMAGE_READER rd)
+{
+  int value;
+  if (rd->t_offset + sizeof (int) > rd->t_length)
+    {
+      rd->t_is_bad = 1;
+      return 0;
+    }
+  memcpy (&value, rd->t_image + rd->t_offset, sizeof (int));
+  rd->t_offset += sizeof (int);
+  return value;
+}
+
+@ Read an |int| which must be at least |min|
+and less than |limit|.
+@<Function definitions@> =
+PRIVATE int
+image_int_read_ranged (IMAGE_READER rd, int min, int limit)
+{
+  const int value = image_int_read (rd);
+  if (value < min || value >= limit)
+    {
+      rd->t_is_bad = 1;
+      return min;
+    }
+  return value;
+}
+
+@ Read the count of a list of objects.
+Each of the objects takes at least |min_ints| |int|'s,
+so a count which would not fit in the rest of the image is bad.
+This keeps a corrupt count from causing a huge allocation.
+@<Function definitions@> =
+PRIVATE int
+image_count_read (IMAGE_READER rd, int min_ints)
+{
+  const int count = image_int_read (rd);
+  const size_t ints_left = (rd->t_length - rd->t_offset) / sizeof (int);
+  if (count < 0 || (size_t) count > ints_left / (size_t) min_ints)
+    {
+      rd->t_is_bad = 1;
+      return 0;
+    }
+  return count;
+}
+
+@ @<Function definitions@> =
+PRIVATE void
+image_lbv_read (IMAGE_READER rd, LBV lbv, int bits)
+{
+  int ix;
+  for (ix = 0; ix < bits; ix += 32)
+    {
+      const unsigned int word = (unsigned int) image_int_read (rd);
+      int bit;
+      for (bit = 0; bit < 32 && ix + bit < bits; bit++)
+        {
+          if (word & (1u << bit))
+            lbv_bit_set (lbv, ix + bit);
+          else
+            lbv_bit_clear (lbv, ix + bit);
+        }
+    }
+}
+
+@ Read a reference to an Earley item.
+It must be in |set| or in an earlier Earley set.
+|sets| is the array of the Earley sets read so far,
+by ordinal.
+@<Function definitions@> =
+PRIVATE YIM
+image_yim_ref_read (IMAGE_READER rd, YS * sets, YS set)
+{
+  const int set_ord = image_int_read_ranged (rd, -1, Ord_of_YS (set) + 1);
+  const int item_ord = image_int_read (rd);
+  YS item_set;
+  if (rd->t_is_bad)
+    return NULL;
+  if (set_ord < 0)
+    {
+      if (item_ord != -1)
+        rd->t_is_bad = 1;
+      return NULL;
+    }
+  item_set = sets[set_ord];
+  if (item_ord < 0 || item_ord >= YIM_Count_of_YS (item_set))
+    {
+      rd->t_is_bad = 1;
+      return NULL;
+    }
+  return YIMs_of_YS (item_set)[item_ord];
+}
+
+@ Read a reference to a Leo item.
+It must be in |set| or in an earlier Earley set,
+and the postdot chain it names must be headed by a Leo item.
+@<Function definitions@> =
+PRIVATE LIM
+image_lim_ref_read (IMAGE_READER rd, YS * sets, YS set)
+{
+  const int set_ord = image_int_read_ranged (rd, -1, Ord_of_YS (set) + 1);
+  const int slot = image_int_read (rd);
+  YS lim_set;
+  PIM pim;
+  if (rd->t_is_bad)
+    return NULL;
+  if (set_ord < 0)
+    {
+      if (slot != -1)
+        rd->t_is_bad = 1;
+      return NULL;
+    }
+  lim_set = sets[set_ord];
+  if (slot < 0 || slot >= Postdot_SYM_Count_of_YS (lim_set))
+    {
+      rd->t_is_bad = 1;
+      return NULL;
+    }
+  pim = lim_set->t_postdot_ary[slot];
+  if (!PIM_is_LIM (pim))
+    {
+      rd->t_is_bad = 1;
+      return NULL;
+    }
+  return LIM_of_PIM (pim);
+}
+
+@ Read a source into |srcl|.
+The next link is left for the caller to set.
+@<Function definitions@> =
+PRIVATE void
+image_srcl_read (IMAGE_READER rd, YS * sets, YS set, SRCL srcl,
+                 unsigned int source_type, int nsy_count)
+{
+  const int flags = image_int_read (rd);
+  SRCL_is_Rejected (srcl) = (flags & IMAGE_IS_REJECTED) != 0;
+  SRCL_is_Active (srcl) = (flags & IMAGE_IS_ACTIVE) != 0;
+  switch (source_type)
+    {
+    case SOURCE_IS_TOKEN:
+      Predecessor_of_SRCL (srcl) = image_yim_ref_read (rd, sets, set);
+      NSYID_of_SRCL (srcl) = image_int_read_ranged (rd, 0, nsy_count);
+      Value_of_SRCL (srcl) = image_int_read (rd);
+      return;
+    case SOURCE_IS_COMPLETION:
+      Predecessor_of_SRCL (srcl) = image_yim_ref_read (rd, sets, set);
+      Cause_of_SRCL (srcl) = image_yim_ref_read (rd, sets, set);
+      break;
+    case SOURCE_IS_LEO:
+      Predecessor_of_SRCL (srcl) = image_lim_ref_read (rd, sets, set);
+      Cause_of_SRCL (srcl) = image_yim_ref_read (rd, sets, set);
+      break;
+    }
+  if (!Cause_of_SRCL (srcl))
+    rd->t_is_bad = 1;
+}
+
+@ @<Function definitions@> =
+PRIVATE SRCL
+image_srcl_chain_read (RECCE r, IMAGE_READER rd, YS * sets, YS set,
+                       unsigned int source_type)
+{
+  SRCL first_srcl = NULL;
+  SRCL *p_next_srcl = &first_srcl;
+  const int count = image_count_read (rd, 5);
+  const int nsy_count = NSY_Count_of_G (G_of_R (r));
+  int ix;
+  for (ix = 0; ix < count && !rd->t_is_bad; ix++)
+    {
+      const SRCL srcl = marpa_obs_new (YS_Obs_of_R (r), SRCL_Object, 1);
+      image_srcl_read (rd, sets, set, srcl, source_type, nsy_count);
+      Next_SRCL_of_SRCL (srcl) = NULL;
+      *p_next_srcl = srcl;
+      p_next_srcl = &Next_SRCL_of_SRCL (srcl);
+    }
+  return first_srcl;
+}
+
+@ Read the contents of an Earley set,
+in the four passes in which they were written.
+Returns 1 on success, and 0 if the image is bad.
+@<Function definitions@> =
+PRIVATE_NOT_INLINE int
+ys_image_read (RECCE r, IMAGE_READER rd, YS * sets, YS set)
+{
+  @<Unpack recognizer objects@>@;
+  const int ahm_count = AHM_Count_of_G (g);
+  const int nsy_count = NSY_Count_of_G (g);
+  int item_count;
+  int slot_count;
+  int item_ix;
+  int slot_ix;
+  YIM *items;
+  @<Read the Earley items of |set|@>@;
+  @<Read the postdot chains of |set|@>@;
+  @<Read the Leo items of |set|@>@;
+  @<Read the sources of the Earley items of |set|@>@;
+  return !rd->t_is_bad;
+}
+
+@ @<Read the Earley items of |set|@> =
+{
+  item_count = image_count_read (rd, 3);
+  if (item_count >= YIM_FATAL_THRESHOLD)
+    rd->t_is_bad = 1;
+  if (rd->t_is_bad)
+    return 0;
+  items = marpa_obs_new (YS_Obs_of_R (r), YIM, item_count);
+  YIMs_of_YS (set) = items;
+  YIM_Count_of_YS (set) = item_count;
+  for (item_ix = 0; item_ix < item_count; item_ix++)
+    {
+      YIM item;
+      const int ahm_id = image_int_read_ranged (rd, 0, ahm_count);
+      const int origin_ord =
+        image_int_read_ranged (rd, 0, Ord_of_YS (set) + 1);
+      const int flags = image_int_read (rd);
+      if (rd->t_is_bad)
+        return 0;
+      item = earley_item_alloc (r, AHM_by_ID (ahm_id));
+      Origin_of_YIM (item) = sets[origin_ord];
+      YS_of_YIM (item) = set;
+      AHM_of_YIM_Set (item, AHM_by_ID (ahm_id));
+      item->t_source_type = NO_SOURCE;
+      YIM_is_Rejected (item) = (flags & IMAGE_IS_REJECTED) != 0;
+      YIM_is_Active (item) = (flags & IMAGE_IS_ACTIVE) != 0;
+      YIM_was_Scanned (item) = (flags & IMAGE_WAS_SCANNED) != 0;
+      YIM_was_Fusion (item) = (flags & IMAGE_WAS_FUSION) != 0;
+      Ord_of_YIM (item) = YIM_ORDINAL_CLAMP ((unsigned int) item_ix);
+      items[item_ix] = item;
+    }
+}
+
+@ The postdot array must be sorted by symbol,
+because it is searched with a binary search.
+Every Earley item in a postdot chain must have the symbol of
+the chain as its postdot symbol.
+A Leo item can only be at the head of a chain.
+Its details are read in the next pass.
+@<Read the postdot chains of |set|@> =
+{
+  NSYID previous_nsyid = -1;
+  slot_count = image_count_read (rd, 3);
+  if (rd->t_is_bad)
+    return 0;
+  set->t_postdot_ary = marpa_obs_new (YS_Obs_of_R (r), PIM, slot_count);
+  Postdot_SYM_Count_of_YS (set) = slot_count;
+  for (slot_ix = 0; slot_ix < slot_count; slot_ix++)
+    {
+      int pim_ix;
+      PIM *p_next_pim = set->t_postdot_ary + slot_ix;
+      const NSYID nsyid =
+        image_int_read_ranged (rd, previous_nsyid + 1, nsy_count);
+      const int pim_count = image_count_read (rd, 1);
+      if (pim_count <= 0)
+        rd->t_is_bad = 1;
+      for (pim_ix = 0; pim_ix < pim_count && !rd->t_is_bad; pim_ix++)
+        {
+          PIM new_pim;
+          const int item_ord = image_int_read_ranged (rd, -1, item_count);
+          if (item_ord < 0)
+            {
+              if (pim_ix > 0)
+                rd->t_is_bad = 1;
+              new_pim =
+                PIM_of_LIM (marpa_obs_new (YS_Obs_of_R (r), LIM_Object, 1));
+              YIM_of_PIM (new_pim) = NULL;
+            }
+          else
+            {
+              const YIM item = items[item_ord];
+              if (Postdot_NSYID_of_AHM (AHM_of_YIM (item)) != nsyid)
+                rd->t_is_bad = 1;
+              new_pim = marpa__obs_alloc (YS_Obs_of_R (r),
+                                          sizeof (YIX_Object),
+                                          ALIGNOF (PIM_Object));
+              YIM_of_PIM (new_pim) = item;
+            }
+          Postdot_NSYID_of_PIM (new_pim) = nsyid;
+          *p_next_pim = new_pim;
+          p_next_pim = &Next_PIM_of_PIM (new_pim);
+        }
+      *p_next_pim = NULL;
+      if (rd->t_is_bad)
+        return 0;
+      previous_nsyid = nsyid;
+    }
+}
+
+@ The CIL of a Leo item is interned in the grammar's CILAR,
+which is where the recognizer found it.
+Its items must be AHM IDs, in increasing order.
+@<Read the Leo items of |set|@> =
+{
+  for (slot_ix = 0; slot_ix < slot_count; slot_ix++)
+    {
+      const PIM pim = set->t_postdot_ary[slot_ix];
+      LIM lim;
+      int flags;
+      int origin_ord;
+      int cil_count;
+      if (!PIM_is_LIM (pim))
+        continue;
+      lim = LIM_of_PIM (pim);
+      flags = image_int_read (rd);
+      LIM_is_Rejected (lim) = (flags & IMAGE_IS_REJECTED) != 0;
+      LIM_is_Active (lim) = (flags & IMAGE_IS_ACTIVE) != 0;
+      origin_ord = image_int_read_ranged (rd, -1, Ord_of_YS (set) + 1);
+      Origin_of_LIM (lim) = origin_ord < 0 ? NULL : sets[origin_ord];
+      Top_AHM_of_LIM (lim) =
+        AHM_by_ID (image_int_read_ranged (rd, 0, ahm_count));
+      Trailhead_AHM_of_LIM (lim) =
+        AHM_by_ID (image_int_read_ranged (rd, 0, ahm_count));
+      Predecessor_LIM_of_LIM (lim) = image_lim_ref_read (rd, sets, set);
+      Trailhead_YIM_of_LIM (lim) = image_yim_ref_read (rd, sets, set);
+      YS_of_LIM (lim) = set;
+      CIL_of_LIM (lim) = NULL;
+      cil_count = image_int_read (rd);
+      if (rd->t_is_bad)
+        return 0;
+      if (cil_count >= 0)
+        {
+          int cil_ix;
+          int previous_ahm_id = -1;
+          cil_buffer_clear (&g->t_cilar);
+          for (cil_ix = 0; cil_ix < cil_count && !rd->t_is_bad; cil_ix++)
+            {
+              const int ahm_id =
+                image_int_read_ranged (rd, previous_ahm_id + 1, ahm_count);
+              cil_buffer_push (&g->t_cilar, ahm_id);
+              previous_ahm_id = ahm_id;
+            }
+          if (rd->t_is_bad)
+            return 0;
+          CIL_of_LIM (lim) = cil_buffer_add (&g->t_cilar);
+        }
+    }
+}
+
+@ @<Read the sources of the Earley items of |set|@> =
+{
+  for (item_ix = 0; item_ix < item_count && !rd->t_is_bad; item_ix++)
+    {
+      const YIM item = items[item_ix];
+      const unsigned int source_type =
+        (unsigned int) image_int_read_ranged (rd, NO_SOURCE,
+                                              SOURCE_IS_AMBIGUOUS + 1);
+      if (rd->t_is_bad)
+        return 0;
+      Source_Type_of_YIM (item) = source_type & 0x7u;
+      if (AHM_is_Unsourced (AHM_of_YIM (item)))
+        {
+          if (source_type != NO_SOURCE)
+            rd->t_is_bad = 1;
+          else if (!R_is_Link_Free (r))
+            (void) image_int_read (rd);
+          continue;
+        }
+      if (R_is_Link_Free (r))
+        {
+          if (source_type == SOURCE_IS_AMBIGUOUS)
+            LV_First_Leo_SRCL_of_YIM (item) =
+              image_srcl_chain_read (r, rd, sets, set, SOURCE_IS_LEO);
+          else if (source_type != NO_SOURCE)
+            rd->t_is_bad = 1;
+          continue;
+        }
+      switch (source_type)
+        {
+        case NO_SOURCE:
+          {
+            const SRC source = SRC_of_YIM (item);
+            const int flags = image_int_read (rd);
+            SRC_is_Rejected (source) = (flags & IMAGE_IS_REJECTED) != 0;
+            SRC_is_Active (source) = (flags & IMAGE_IS_ACTIVE) != 0;
+          }
+          break;
+        case SOURCE_IS_TOKEN:
+        case SOURCE_IS_COMPLETION:
+        case SOURCE_IS_LEO:
+          image_srcl_read (rd, sets, set, SRCL_of_YIM (item), source_type,
+                           nsy_count);
+          Next_SRCL_of_SRCL (SRCL_of_YIM (item)) = NULL;
+          break;
+        case SOURCE_IS_AMBIGUOUS:
+          LV_First_Leo_SRCL_of_YIM (item) =
+            image_srcl_chain_read (r, rd, sets, set, SOURCE_IS_LEO);
+          LV_First_Token_SRCL_of_YIM (item) =
+            image_srcl_chain_read (r, rd, sets, set, SOURCE_IS_TOKEN);
+          LV_First_Completion_SRCL_of_YIM (item) =
+            image_srcl_chain_read (r, rd, sets, set, SOURCE_IS_COMPLETION);
+          break;
+        }
+    }
+}
+
+@ Read an image into |r|,
+a recognizer which has just been created.
+Returns 1 on success, and 0 if the image is bad.
+On failure, |r| is only fit to be destroyed.
+@<Function definitions@> =
+PRIVATE_NOT_INLINE int
+r_image_read (RECCE r, IMAGE_READER rd)
+{
+  @<Unpack recognizer objects@>@;
+  const int xsy_count = XSY_Count_of_G (g);
+  const int nsy_count = NSY_Count_of_G (g);
+  int set_count;
+  YS *sets = NULL;
+  int return_value = 0;
+  @<Read the image header@>@;
+  @<Read the recognizer scalars from the image@>@;
+  @<Read the recognizer vectors from the image@>@;
+  @<Read the Earley sets from the image@>@;
+  @<Read the alternatives from the image@>@;
+  if (image_int_read (rd) != IMAGE_MAGIC || rd->t_offset != rd->t_length)
+    goto CLEANUP;
+  return_value = !rd->t_is_bad;
+CLEANUP:;
+  marpa__a_free (Allocator_of_G(g), sets);
+  return return_value;
+}
+
+@ @<Read the image header@> =
+{
+  if (image_int_read (rd) != IMAGE_MAGIC)
+    goto CLEANUP;
+  if (image_int_read (rd) != MARPA_LIB_MAJOR_VERSION)
+    goto CLEANUP;
+  if (image_int_read (rd) != MARPA_LIB_MINOR_VERSION)
+    goto CLEANUP;
+  if (image_int_read (rd) != MARPA_LIB_MICRO_VERSION)
+    goto CLEANUP;
+  if (image_int_read (rd) != xsy_count)
+    goto CLEANUP;
+  if (image_int_read (rd) != nsy_count)
+    goto CLEANUP;
+  if (image_int_read (rd) != IRL_Count_of_G (g))
+    goto CLEANUP;
+  if (image_int_read (rd) != AHM_Count_of_G (g))
+    goto CLEANUP;
+  if (image_int_read (rd) != ZWA_Count_of_R (r))
+    goto CLEANUP;
+  if ((unsigned int) image_int_read (rd) != grammar_image_hash (g))
+    goto CLEANUP;
+}
+
+@ The recognizer of a trivial grammar has no containers
+for further input,
+so its image must be of a recognizer after input.
+@<Read the recognizer scalars from the image@> =
+{
+  Input_Phase_of_R (r) =
+    (unsigned int) image_int_read_ranged (rd, R_DURING_INPUT,
+                                          R_AFTER_INPUT + 1) & 0x3u;
+  Current_Earleme_of_R (r) =
+    image_int_read_ranged (rd, 0, JEARLEME_THRESHOLD);
+  Furthest_Earleme_of_R (r) =
+    image_int_read_ranged (rd, Current_Earleme_of_R (r), JEARLEME_THRESHOLD);
+  R_is_Exhausted (r) = image_int_read_ranged (rd, 0, 2) != 0;
+  r->t_use_leo_flag = image_int_read_ranged (rd, 0, 2) != 0;
+  r->t_is_using_leo = image_int_read_ranged (rd, 0, 2) != 0;
+  R_is_Link_Free (r) = image_int_read_ranged (rd, 0, 2) != 0;
+  R_is_Lookahead_Filtered (r) = image_int_read_ranged (rd, 0, 2) != 0;
+  r->t_earley_item_warning_threshold = image_int_read (rd);
+  First_Inconsistent_YS_of_R (r) = image_int_read (rd);
+  r->t_active_event_count = image_int_read_ranged (rd, 0, INT_MAX);
+  set_count = image_count_read (rd, 5);
+  if (set_count <= 0)
+    rd->t_is_bad = 1;
+  if (G_is_Trivial (g) && Input_Phase_of_R (r) != R_AFTER_INPUT)
+    rd->t_is_bad = 1;
+  if (rd->t_is_bad)
+    goto CLEANUP;
+}
+
+@ @<Read the recognizer vectors from the image@> =
+{
+  ZWAID zwaid;
+  const int zwa_count = ZWA_Count_of_R (r);
+  r->t_valued_terminal = lbv_obs_new0 (r->t_obs, xsy_count);
+  r->t_unvalued_terminal = lbv_obs_new0 (r->t_obs, xsy_count);
+  r->t_valued = lbv_obs_new0 (r->t_obs, xsy_count);
+  r->t_unvalued = lbv_obs_new0 (r->t_obs, xsy_count);
+  r->t_valued_locked = lbv_obs_new0 (r->t_obs, xsy_count);
+  image_lbv_read (rd, r->t_lbv_xsyid_completion_event_is_active, xsy_count);
+  image_lbv_read (rd, r->t_lbv_xsyid_nulled_event_is_active, xsy_count);
+  image_lbv_read (rd, r->t_lbv_xsyid_prediction_event_is_active, xsy_count);
+  image_lbv_read (rd, r->t_nsy_expected_is_event, nsy_count);
+  image_lbv_read (rd, r->t_valued_terminal, xsy_count);
+  image_lbv_read (rd, r->t_unvalued_terminal, xsy_count);
+  image_lbv_read (rd, r->t_valued, xsy_count);
+  image_lbv_read (rd, r->t_unvalued, xsy_count);
+  image_lbv_read (rd, r->t_valued_locked, xsy_count);
+  image_lbv_read (rd, r->t_bv_nsyid_is_expected, nsy_count);
+  for (zwaid = 0; zwaid < zwa_count; zwaid++)
+    {
+      const ZWA zwa = RZWA_by_ID (zwaid);
+      Memo_Value_of_ZWA (zwa) = image_int_read_ranged (rd, 0, 2) != 0;
+      Memo_YSID_of_ZWA (zwa) = image_int_read_ranged (rd, -1, set_count);
+    }
+  if (rd->t_is_bad)
+    goto CLEANUP;
+  if (!G_is_Trivial (g))
+    {
+      psar_reset (Dot_PSAR_of_R (r));
+      @<Allocate recognizer containers@>@;
+      @<Initialize Earley item work stacks@>@;
+    }
+}
+
+@ The earlemes of the Earley sets must increase,
+beginning at zero,
+and must not be after the current earleme.
+@<Read the Earley sets from the image@> =
+{
+  int set_ix;
+  sets = marpa__a_malloc (Allocator_of_G(g), sizeof (YS) * (size_t) set_count);
+  for (set_ix = 0; set_ix < set_count; set_ix++)
+    {
+      YS set;
+      const JEARLEME earleme =
+        image_int_read_ranged (rd,
+                               set_ix ? Earleme_of_YS (sets[set_ix - 1]) +
+                               1 : 0, Current_Earleme_of_R (r) + 1);
+      const int value = image_int_read (rd);
+      if (rd->t_is_bad || (set_ix == 0 && earleme != 0))
+        goto CLEANUP;
+      set = earley_set_new (r, earleme);
+      Value_of_YS (set) = value;
+      sets[set_ix] = set;
+      if (set_ix == 0)
+        {
+          First_YS_of_R (r) = set;
+        }
+      else
+        {
+          Next_YS_of_YS (sets[set_ix - 1]) = set;
+        }
+      Latest_YS_of_R (r) = set;
+      if (!ys_image_read (r, rd, sets, set))
+        goto CLEANUP;
+    }
+}
+
+@ @<Read the alternatives from the image@> =
+{
+  int alt_ix;
+  const int alternative_count = image_count_read (rd, 5);
+  for (alt_ix = 0; alt_ix < alternative_count && !rd->t_is_bad; alt_ix++)
+    {
+      const ALT alternative =
+        MARPA_DSTACK_PUSH (r->t_alternatives, ALT_Object);
+      Start_YS_of_ALT (alternative) =
+        sets[image_int_read_ranged (rd, 0, set_count)];
+      End_Earleme_of_ALT (alternative) =
+        image_int_read_ranged (rd, Current_Earleme_of_R (r) + 1,
+                               JEARLEME_THRESHOLD);
+      NSYID_of_ALT (alternative) = image_int_read_ranged (rd, 0, nsy_count);
+      Value_of_ALT (alternative) = image_int_read (rd);
+      ALT_is_Valued (alternative) = image_int_read_ranged (rd, 0, 2) != 0;
+    }
+  if (rd->t_is_bad)
+    goto CLEANUP;
+}
+
+@ Returns a new recognizer for |g|,
+with the state saved in |image|,
+or |NULL| on failure.
+The recognizer's Earley sets have no values of the pointer type.
+@<Function definitions@> =
+Marpa_Recognizer
+marpa_r_deserialize (Marpa_Grammar g, const void *image, int image_size)
+{
+  @<Return |NULL| on failure@>@;
+  RECCE r;
+  IMAGE_READER_Object reader;
+  @<Fail if not precomputed@>@;
+  if (_MARPA_UNLIKELY (!image || image_size < 0))
+    {
+      MARPA_ERROR (MARPA_ERR_INVALID_IMAGE);
+      return failure_indicator;
+    }
+  r = marpa_r_new (g);
+  if (!r)
+    return failure_indicator;
+  G_EVENTS_CLEAR (g);
+  reader.t_image = image;
+  reader.t_length = (size_t) image_size;
+  reader.t_offset = 0;
+  reader.t_is_bad = 0;
+  if (!r_image_read (r, &reader))
+    {
+      marpa_r_unref (r);
+      MARPA_ERROR (MARPA_ERR_INVALID_IMAGE);
+      return failure_indicator;
+    }
+  return r;
+}
+
+@** Grammar images.
+A grammar image is a copy of a precomputed grammar,
+from which an equivalent precomputed grammar can be created later,
+perhaps in another process,
+without precomputing it again.
+Precomputation rewrites the grammar and builds several
+matrices and lists from scratch,
+so that for an application which starts often,
+but always with the same grammar,
+it can be most of the startup time.
+@ A grammar image is a sequence of |int|'s,
+like a recognizer image,
+and it has the same limitations.
+It is in the byte order of the host,
+and is only valid for the same build of Libmarpa
+on the same kind of host.
+@ An image contains the result of precomputation:
+the external symbols and rules, with the results of the census;
+the internal symbols and rules;
+the AHM's;
+the zero-width assertions;
+the grammar's events;
+and the CIL's of all of these.
+Pointers between these objects become ID's.
+The CIL's are written as lists, and are interned again
+as they are read, so that they are shared just as they were before.
+@ Some data is not in the image, because it is quickly
+recomputed from the rest:
+the external size and the maximum rule length,
+which are recomputed as the XRL's are added;
+the terminal and event boolean vectors,
+and the first AHM of each IRL.
+The zero-width assertion placements are not in the image,
+because they are only used during precomputation.
+@d G_IMAGE_MAGIC 0x4d474931
+
+@*0 Writing grammar images.
+A |NULL| CIL is written as a count of |-1|.
+@<Function definitions@> =
+PRIVATE void
+image_cil_write (IMAGE_WRITER w, CIL cil)
+{
+  int ix;
+  if (!cil)
+    {
+      image_int_write (w, -1);
+      return;
+    }
+  image_int_write (w, Count_of_CIL (cil));
+  for (ix = 0; ix < Count_of_CIL (cil); ix++)
+    {
+      image_int_write (w, Item_of_CIL (cil, ix));
+    }
+}
+
+@ @<Function definitions@> =
+PRIVATE_NOT_INLINE void
+g_image_write (GRAMMAR g, IMAGE_WRITER w)
+{
+  const int xsy_count = XSY_Count_of_G (g);
+  const int nsy_count = NSY_Count_of_G (g);
+  const int xrl_count = XRL_Count_of_G (g);
+  const int irl_count = IRL_Count_of_G (g);
+  const int ahm_count = AHM_Count_of_G (g);
+  const int zwa_count = ZWA_Count_of_G (g);
+  const int event_count = G_EVENT_COUNT (g);
+  @<Write the grammar image header@>@;
+  @<Write the grammar scalars to the image@>@;
+  @<Write the XSY's to the image@>@;
+  @<Write the XRL's to the image@>@;
+  @<Write the NSY's to the image@>@;
+  @<Write the IRL's to the image@>@;
+  @<Write the AHM's to the image@>@;
+  @<Write the grammar ZWA's and events to the image@>@;
+  image_int_write (w, G_IMAGE_MAGIC);
+}
+
+@ @<Write the grammar image header@> =
+{
+  image_int_write (w, G_IMAGE_MAGIC);
+  image_int_write (w, MARPA_LIB_MAJOR_VERSION);
+  image_int_write (w, MARPA_LIB_MINOR_VERSION);
+  image_int_write (w, MARPA_LIB_MICRO_VERSION);
+  image_int_write (w, xsy_count);
+  image_int_write (w, nsy_count);
+  image_int_write (w, xrl_count);
+  image_int_write (w, irl_count);
+  image_int_write (w, ahm_count);
+  image_int_write (w, zwa_count);
+  image_int_write (w, event_count);
+}
+
+@ @<Write the grammar scalars to the image@> =
+{
+  image_int_write (w, g->t_start_xsy_id);
+  image_int_write (w, g->t_start_irl ? ID_of_IRL (g->t_start_irl) : -1);
+  image_int_write (w, Default_Rank_of_G (g));
+  image_int_write (w, g->t_force_valued);
+  image_int_write (w, SYMI_Count_of_G (g));
+  image_int_write (w, g->t_has_cycle);
+}
+
+@ The links from the XSY's to their NSY's are written
+with the NSY's.
+@<Write the XSY's to the image@> =
+{
+  XSYID xsy_id;
+  for (xsy_id = 0; xsy_id < xsy_count; xsy_id++)
+    {
+      const XSY xsy = XSY_by_ID (xsy_id);
+      image_int_write (w, Rank_of_XSY (xsy));
+      image_int_write (w, XSY_is_LHS (xsy));
+      image_int_write (w, XSY_is_Sequence_LHS (xsy));
+      image_int_write (w, XSY_is_Valued (xsy));
+      image_int_write (w, XSY_is_Valued_Locked (xsy));
+      image_int_write (w, XSY_is_Accessible (xsy));
+      image_int_write (w, xsy->t_is_counted);
+      image_int_write (w, XSY_is_Nulling (xsy));
+      image_int_write (w, XSY_is_Nullable (xsy));
+      image_int_write (w, XSY_is_Terminal (xsy));
+      image_int_write (w, XSY_is_Locked_Terminal (xsy));
+      image_int_write (w, XSY_is_Productive (xsy));
+      image_int_write (w, XSY_is_Completion_Event (xsy));
+      image_int_write (w, XSY_Completion_Event_Starts_Active (xsy));
+      image_int_write (w, XSY_is_Nulled_Event (xsy));
+      image_int_write (w, XSY_Nulled_Event_Starts_Active (xsy));
+      image_int_write (w, XSY_is_Prediction_Event (xsy));
+      image_int_write (w, XSY_Prediction_Event_Starts_Active (xsy));
+      image_cil_write (w, Nulled_XSYIDs_of_XSY (xsy));
+    }
+}
+
+@ @<Write the XRL's to the image@> =
+{
+  XRLID xrl_id;
+  for (xrl_id = 0; xrl_id < xrl_count; xrl_id++)
+    {
+      const XRL xrl = XRL_by_ID (xrl_id);
+      const int length = Length_of_XRL (xrl);
+      int symbol_ix;
+      image_int_write (w, length);
+      for (symbol_ix = 0; symbol_ix <= length; symbol_ix++)
+        {
+          image_int_write (w, xrl->t_symbols[symbol_ix]);
+        }
+      image_int_write (w, Rank_of_XRL (xrl));
+      image_int_write (w, Null_Ranks_High_of_RULE (xrl));
+      image_int_write (w, XRL_is_BNF (xrl));
+      image_int_write (w, XRL_is_Sequence (xrl));
+      image_int_write (w, Minimum_of_XRL (xrl));
+      image_int_write (w, Separator_of_XRL (xrl));
+      image_int_write (w, xrl->t_is_discard);
+      image_int_write (w, XRL_is_Proper_Separation (xrl));
+      image_int_write (w, xrl->t_is_loop);
+      image_int_write (w, XRL_is_Nulling (xrl));
+      image_int_write (w, XRL_is_Nullable (xrl));
+      image_int_write (w, XRL_is_Accessible (xrl));
+      image_int_write (w, XRL_is_Productive (xrl));
+      image_int_write (w, XRL_is_Used (xrl));
+    }
+}
+
+@ @<Write the NSY's to the image@> =
+{
+  NSYID nsyid;
+  XSYID xsy_id;
+  for (nsyid = 0; nsyid < nsy_count; nsyid++)
+    {
+      const NSY nsy = NSY_by_ID (nsyid);
+      const XSY source_xsy = Source_XSY_of_NSY (nsy);
+      const XRL lhs_xrl = LHS_XRL_of_NSY (nsy);
+      image_int_write (w, source_xsy ? ID_of_XSY (source_xsy) : -1);
+      image_int_write (w, lhs_xrl ? ID_of_XRL (lhs_xrl) : -1);
+      image_int_write (w, XRL_Offset_of_NSY (nsy));
+      image_int_write (w, Rank_of_NSY (nsy));
+      image_int_write (w, NSY_is_Start (nsy));
+      image_int_write (w, NSY_is_LHS (nsy));
+      image_int_write (w, NSY_is_Nulling (nsy));
+      image_int_write (w, NSY_is_Semantic (nsy));
+      image_cil_write (w, LHS_CIL_of_NSY (nsy));
+      image_cil_write (w, Lookahead_CIL_of_NSY (nsy));
+    }
+  for (xsy_id = 0; xsy_id < xsy_count; xsy_id++)
+    {
+      const XSY xsy = XSY_by_ID (xsy_id);
+      const NSY nsy = NSY_of_XSY (xsy);
+      const NSY nulling_nsy = Nulling_NSY_of_XSY (xsy);
+      image_int_write (w, nsy ? ID_of_NSY (nsy) : -1);
+      image_int_write (w, nulling_nsy ? ID_of_NSY (nulling_nsy) : -1);
+    }
+}
+
+@ @<Write the IRL's to the image@> =
+{
+  IRLID irl_id;
+  for (irl_id = 0; irl_id < irl_count; irl_id++)
+    {
+      const IRL irl = IRL_by_ID (irl_id);
+      const int length = Length_of_IRL (irl);
+      const XRL source_xrl = Source_XRL_of_IRL (irl);
+      int symbol_ix;
+      image_int_write (w, length);
+      for (symbol_ix = 0; symbol_ix <= length; symbol_ix++)
+        {
+          image_int_write (w, irl->t_nsyid_array[symbol_ix]);
+        }
+      image_int_write (w, source_xrl ? ID_of_XRL (source_xrl) : -1);
+      image_int_write (w, AHM_Count_of_IRL (irl));
+      image_int_write (w, Real_SYM_Count_of_IRL (irl));
+      image_int_write (w, Virtual_Start_of_IRL (irl));
+      image_int_write (w, Virtual_End_of_IRL (irl));
+      image_int_write (w, Rank_of_IRL (irl));
+      image_int_write (w, SYMI_of_IRL (irl));
+      image_int_write (w, Last_Proper_SYMI_of_IRL (irl));
+      image_int_write (w, IRL_has_Virtual_LHS (irl));
+      image_int_write (w, IRL_has_Virtual_RHS (irl));
+      image_int_write (w, IRL_is_Right_Recursive (irl));
+      image_int_write (w, IRL_is_CHAF (irl));
+    }
+}
+
+@ @<Write the AHM's to the image@> =
+{
+  AHMID ahm_id;
+  for (ahm_id = 0; ahm_id < ahm_count; ahm_id++)
+    {
+      const AHM ahm = AHM_by_ID (ahm_id);
+      const XRL xrl = XRL_of_AHM (ahm);
+      image_int_write (w, IRLID_of_AHM (ahm));
+      image_int_write (w, xrl ? ID_of_XRL (xrl) : -1);
+      image_int_write (w, Postdot_NSYID_of_AHM (ahm));
+      image_int_write (w, Null_Count_of_AHM (ahm));
+      image_int_write (w, Position_of_AHM (ahm));
+      image_int_write (w, Quasi_Position_of_AHM (ahm));
+      image_int_write (w, SYMI_of_AHM (ahm));
+      image_int_write (w, XRL_Position_of_AHM (ahm));
+      image_int_write (w, Event_Group_Size_of_AHM (ahm));
+      image_int_write (w, AHM_predicts_ZWA (ahm));
+      image_int_write (w, AHM_was_Predicted (ahm));
+      image_int_write (w, AHM_is_Initial (ahm));
+      image_cil_write (w, Predicted_IRL_CIL_of_AHM (ahm));
+      image_cil_write (w, LHS_CIL_of_AHM (ahm));
+      image_cil_write (w, Prediction_Bundle_of_AHM (ahm));
+      image_cil_write (w, ZWA_CIL_of_AHM (ahm));
+      image_cil_write (w, Completion_XSYIDs_of_AHM (ahm));
+      image_cil_write (w, Nulled_XSYIDs_of_AHM (ahm));
+      image_cil_write (w, Prediction_XSYIDs_of_AHM (ahm));
+      image_cil_write (w, Event_AHMIDs_of_AHM (ahm));
+    }
+}
+
+@ @<Write the grammar ZWA's and events to the image@> =
+{
+  ZWAID zwaid;
+  int event_ix;
+  for (zwaid = 0; zwaid < zwa_count; zwaid++)
+    {
+      image_int_write (w, Default_Value_of_GZWA (GZWA_by_ID (zwaid)));
+    }
+  for (event_ix = 0; event_ix < event_count; event_ix++)
+    {
+      const GEV event = MARPA_DSTACK_INDEX (g->t_events, GEV_Object, event_ix);
+      image_int_write (w, event->t_type);
+      image_int_write (w, event->t_value);
+    }
+}
+
+@ Returns the size of the image in bytes,
+or |-2| on failure.
+As with |marpa_r_serialize|,
+the image is only complete if |buffer_size|
+is at least that size.
+@<Function definitions@> =
+int
+marpa_g_serialize (Marpa_Grammar g, void *buffer, int buffer_size)
+{
+  @<Return |-2| on failure@>@;
+  IMAGE_WRITER_Object writer;
+  @<Fail if fatal error@>@;
+  @<Fail if not precomputed@>@;
+  if (_MARPA_UNLIKELY (buffer_size < 0 || (buffer_size > 0 && !buffer)))
+    {
+      MARPA_ERROR (MARPA_ERR_INVALID_IMAGE);
+      return failure_indicator;
+    }
+  writer.t_buffer = buffer;
+  writer.t_capacity = (size_t) buffer_size;
+  writer.t_length = 0;
+  g_image_write (g, &writer);
+  if (_MARPA_UNLIKELY (writer.t_length > INT_MAX))
+    {
+      MARPA_ERROR (MARPA_ERR_INVALID_IMAGE);
+      return failure_indicator;
+    }
+  return (int) writer.t_length;
+}
+
+@*0 Reading grammar images.
+The reader checks every count and ID, as it does for
+recognizer images,
+so that a truncated or corrupt image cannot cause
+a memory error while it is read.
+Every element of a CIL must be less than |limit|.
+@<Function definitions@> =
+PRIVATE CIL
+image_cil_read (IMAGE_READER rd, CILAR cilar, int limit)
+{
+  int count;
+  int ix;
+  const size_t ints_left = (rd->t_length - rd->t_offset) / sizeof (int);
+  count = image_int_read (rd);
+  if (count == -1)
+    return NULL;
+  if (count < 0 || (size_t) count > ints_left)
+    {
+      rd->t_is_bad = 1;
+      return NULL;
+    }
+  cil_buffer_clear (cilar);
+  for (ix = 0; ix < count; ix++)
+    {
+      cil_buffer_push (cilar, image_int_read_ranged (rd, 0, limit));
+    }
+  return cil_buffer_add (cilar);
+}
+
+@ Reads the image into |g|, which must be a new grammar.
+Returns 1 on success, 0 on failure.
+On failure, |g| may be partly built,
+and must be destroyed.
+@<Function definitions@> =
+PRIVATE_NOT_INLINE int
+g_image_read (GRAMMAR g, IMAGE_READER rd)
+{
+  int xsy_count;
+  int nsy_count;
+  int xrl_count;
+  int irl_count;
+  int ahm_count;
+  int zwa_count;
+  int event_count;
+  int post_census_xsy_count;
+  int start_irl_id;
+  int return_value = 0;
+  @<Read the grammar image header@>@;
+  @<Read the grammar scalars from the image@>@;
+  @<Read the XSY's from the image@>@;
+  @<Read the XRL's from the image@>@;
+  @<Read the NSY's from the image@>@;
+  @<Read the IRL's from the image@>@;
+  @<Read the AHM's from the image@>@;
+  @<Read the grammar ZWA's and events from the image@>@;
+  if (image_int_read (rd) != G_IMAGE_MAGIC || rd->t_offset != rd->t_length)
+    goto CLEANUP;
+  if (rd->t_is_bad)
+    goto CLEANUP;
+  @<Recompute the grammar data not in the image@>@;
+  return_value = 1;
+CLEANUP:;
+  return return_value;
+}
+
+@ Each XSY, XRL, NSY and IRL takes at least
+ten |int|'s in the image, and each AHM and event takes at least two.
+@<Read the grammar image header@> =
+{
+  if (image_int_read (rd) != G_IMAGE_MAGIC)
+    goto CLEANUP;
+  if (image_int_read (rd) != MARPA_LIB_MAJOR_VERSION)
+    goto CLEANUP;
+  if (image_int_read (rd) != MARPA_LIB_MINOR_VERSION)
+    goto CLEANUP;
+  if (image_int_read (rd) != MARPA_LIB_MICRO_VERSION)
+    goto CLEANUP;
+  xsy_count = image_count_read (rd, 10);
+  nsy_count = image_count_read (rd, 10);
+  xrl_count = image_count_read (rd, 10);
+  irl_count = image_count_read (rd, 10);
+  ahm_count = image_count_read (rd, 2);
+  zwa_count = image_count_read (rd, 1);
+  event_count = image_count_read (rd, 2);
+  post_census_xsy_count = xsy_count;
+  if (rd->t_is_bad)
+    goto CLEANUP;
+}
+
+@ @<Read the grammar scalars from the image@> =
+{
+  g->t_start_xsy_id = image_int_read_ranged (rd, -1, xsy_count);
+  start_irl_id = image_int_read_ranged (rd, -1, irl_count);
+  Default_Rank_of_G (g) =
+    image_int_read_ranged (rd, MINIMUM_RANK, MAXIMUM_RANK + 1);
+  g->t_force_valued = image_int_read_ranged (rd, 0, 2);
+  SYMI_Count_of_G (g) = image_int_read_ranged (rd, 0, INT_MAX);
+  g->t_has_cycle = image_int_read_ranged (rd, 0, 2) != 0;
+  if ((start_irl_id >= 0) != (ahm_count > 0))
+    rd->t_is_bad = 1;
+  if (rd->t_is_bad)
+    goto CLEANUP;
+}
+
+@ @<Read the XSY's from the image@> =
+{
+  int xsy_ix;
+  for (xsy_ix = 0; xsy_ix < xsy_count; xsy_ix++)
+    {
+      const XSY xsy = symbol_new (g);
+      Rank_of_XSY (xsy) =
+        image_int_read_ranged (rd, MINIMUM_RANK, MAXIMUM_RANK + 1);
+      XSY_is_LHS (xsy) = image_int_read_ranged (rd, 0, 2) != 0;
+      XSY_is_Sequence_LHS (xsy) = image_int_read_ranged (rd, 0, 2) != 0;
+      XSY_is_Valued (xsy) = image_int_read_ranged (rd, 0, 2) != 0;
+      XSY_is_Valued_Locked (xsy) = image_int_read_ranged (rd, 0, 2) != 0;
+      XSY_is_Accessible (xsy) = image_int_read_ranged (rd, 0, 2) != 0;
+      xsy->t_is_counted = image_int_read_ranged (rd, 0, 2) != 0;
+      XSY_is_Nulling (xsy) = image_int_read_ranged (rd, 0, 2) != 0;
+      XSY_is_Nullable (xsy) = image_int_read_ranged (rd, 0, 2) != 0;
+      XSY_is_Terminal (xsy) = image_int_read_ranged (rd, 0, 2) != 0;
+      XSY_is_Locked_Terminal (xsy) = image_int_read_ranged (rd, 0, 2) != 0;
+      XSY_is_Productive (xsy) = image_int_read_ranged (rd, 0, 2) != 0;
+      XSY_is_Completion_Event (xsy) = image_int_read_ranged (rd, 0, 2) != 0;
+      XSY_Completion_Event_Starts_Active (xsy) =
+        image_int_read_ranged (rd, 0, 2) != 0;
+      XSY_is_Nulled_Event (xsy) = image_int_read_ranged (rd, 0, 2) != 0;
+      XSY_Nulled_Event_Starts_Active (xsy) =
+        image_int_read_ranged (rd, 0, 2) != 0;
+      XSY_is_Prediction_Event (xsy) = image_int_read_ranged (rd, 0, 2) != 0;
+      XSY_Prediction_Event_Starts_Active (xsy) =
+        image_int_read_ranged (rd, 0, 2) != 0;
+      Nulled_XSYIDs_of_XSY (xsy) =
+        image_cil_read (rd, &g->t_cilar, xsy_count);
+      if (rd->t_is_bad)
+        goto CLEANUP;
+    }
+}
+
+@ The XRL's are built on the XRL obstack,
+in the same way as |xrl_start| builds them.
+@<Read the XRL's from the image@> =
+{
+  int xrl_ix;
+  for (xrl_ix = 0; xrl_ix < xrl_count; xrl_ix++)
+    {
+      XRL xrl;
+      int symbol_ix;
+      const int length = image_count_read (rd, 1);
+      const size_t sizeof_xrl = offsetof (struct s_xrl, t_symbols) +
+        ((size_t) length + 1) * sizeof (xrl->t_symbols[0]);
+      if (rd->t_is_bad || length > MAX_RHS_LENGTH)
+        goto CLEANUP;
+      xrl = marpa_obs_start (g->t_xrl_obs, sizeof_xrl, ALIGNOF (XRL));
+      Length_of_XRL (xrl) = length;
+      for (symbol_ix = 0; symbol_ix <= length; symbol_ix++)
+        {
+          xrl->t_symbols[symbol_ix] = image_int_read_ranged (rd, 0, xsy_count);
+        }
+      xrl_finish (g, xrl);
+      xrl = marpa_obs_finish (g->t_xrl_obs);
+      Rank_of_XRL (xrl) =
+        image_int_read_ranged (rd, MINIMUM_RANK, MAXIMUM_RANK + 1);
+      Null_Ranks_High_of_RULE (xrl) = image_int_read_ranged (rd, 0, 2) != 0;
+      XRL_is_BNF (xrl) = image_int_read_ranged (rd, 0, 2) != 0;
+      XRL_is_Sequence (xrl) = image_int_read_ranged (rd, 0, 2) != 0;
+      Minimum_of_XRL (xrl) = image_int_read_ranged (rd, -1, INT_MAX);
+      Separator_of_XRL (xrl) = image_int_read_ranged (rd, -1, xsy_count);
+      xrl->t_is_discard = image_int_read_ranged (rd, 0, 2) != 0;
+      XRL_is_Proper_Separation (xrl) = image_int_read_ranged (rd, 0, 2) != 0;
+      xrl->t_is_loop = image_int_read_ranged (rd, 0, 2) != 0;
+      XRL_is_Nulling (xrl) = image_int_read_ranged (rd, 0, 2) != 0;
+      XRL_is_Nullable (xrl) = image_int_read_ranged (rd, 0, 2) != 0;
+      XRL_is_Accessible (xrl) = image_int_read_ranged (rd, 0, 2) != 0;
+      XRL_is_Productive (xrl) = image_int_read_ranged (rd, 0, 2) != 0;
+      XRL_is_Used (xrl) = image_int_read_ranged (rd, 0, 2) != 0;
+      if (rd->t_is_bad)
+        goto CLEANUP;
+    }
+}
+
+@ @<Read the NSY's from the image@> =
+{
+  int nsy_ix;
+  XSYID xsy_id;
+  @<Initialize NSY stack@>@;
+  for (nsy_ix = 0; nsy_ix < nsy_count; nsy_ix++)
+    {
+      const NSY nsy = nsy_start (g);
+      const XSYID source_xsy_id = image_int_read_ranged (rd, -1, xsy_count);
+      const XRLID lhs_xrl_id = image_int_read_ranged (rd, -1, xrl_count);
+      Source_XSY_of_NSY (nsy) =
+        source_xsy_id >= 0 ? XSY_by_ID (source_xsy_id) : NULL;
+      LHS_XRL_of_NSY (nsy) = lhs_xrl_id >= 0 ? XRL_by_ID (lhs_xrl_id) : NULL;
+      XRL_Offset_of_NSY (nsy) = image_int_read (rd);
+      Rank_of_NSY (nsy) = image_int_read (rd);
+      NSY_is_Start (nsy) = image_int_read_ranged (rd, 0, 2) != 0;
+      NSY_is_LHS (nsy) = image_int_read_ranged (rd, 0, 2) != 0;
+      NSY_is_Nulling (nsy) = image_int_read_ranged (rd, 0, 2) != 0;
+      NSY_is_Semantic (nsy) = image_int_read_ranged (rd, 0, 2) != 0;
+      LHS_CIL_of_NSY (nsy) = image_cil_read (rd, &g->t_cilar, irl_count);
+      Lookahead_CIL_of_NSY (nsy) =
+        image_cil_read (rd, &g->t_cilar, ahm_count);
+      if (rd->t_is_bad)
+        goto CLEANUP;
+    }
+  for (xsy_id = 0; xsy_id < xsy_count; xsy_id++)
+    {
+      const XSY xsy = XSY_by_ID (xsy_id);
+      const NSYID nsyid = image_int_read_ranged (rd, -1, nsy_count);
+      const NSYID nulling_nsyid = image_int_read_ranged (rd, -1, nsy_count);
+      NSY_of_XSY (xsy) = nsyid >= 0 ? NSY_by_ID (nsyid) : NULL;
+      Nulling_NSY_of_XSY (xsy) =
+        nulling_nsyid >= 0 ? NSY_by_ID (nulling_nsyid) : NULL;
+    }
+  if (rd->t_is_bad)
+    goto CLEANUP;
+}
+
+@ @<Read the IRL's from the image@> =
+{
+  int irl_ix;
+  @<Initialize IRL stack@>@;
+  for (irl_ix = 0; irl_ix < irl_count; irl_ix++)
+    {
+      IRL irl;
+      int symbol_ix;
+      XRLID source_xrl_id;
+      const int length = image_count_read (rd, 1);
+      if (rd->t_is_bad || length > MAX_RHS_LENGTH)
+        goto CLEANUP;
+      irl = irl_start (g, length);
+      for (symbol_ix = 0; symbol_ix <= length; symbol_ix++)
+        {
+          irl->t_nsyid_array[symbol_ix] =
+            image_int_read_ranged (rd, 0, nsy_count);
+        }
+      source_xrl_id = image_int_read_ranged (rd, -1, xrl_count);
+      Source_XRL_of_IRL (irl) =
+        source_xrl_id >= 0 ? XRL_by_ID (source_xrl_id) : NULL;
+      AHM_Count_of_IRL (irl) = image_int_read_ranged (rd, 0, ahm_count + 1);
+      Real_SYM_Count_of_IRL (irl) = image_int_read_ranged (rd, 0, length + 1);
+      Virtual_Start_of_IRL (irl) = image_int_read (rd);
+      Virtual_End_of_IRL (irl) = image_int_read (rd);
+      Rank_of_IRL (irl) = image_int_read (rd);
+      SYMI_of_IRL (irl) = image_int_read (rd);
+      Last_Proper_SYMI_of_IRL (irl) = image_int_read (rd);
+      IRL_has_Virtual_LHS (irl) = image_int_read_ranged (rd, 0, 2) != 0;
+      IRL_has_Virtual_RHS (irl) = image_int_read_ranged (rd, 0, 2) != 0;
+      IRL_is_Right_Recursive (irl) = image_int_read_ranged (rd, 0, 2) != 0;
+      IRL_is_CHAF (irl) = image_int_read_ranged (rd, 0, 2) != 0;
+      if (rd->t_is_bad)
+        goto CLEANUP;
+    }
+  g->t_start_irl = start_irl_id >= 0 ? IRL_by_ID (start_irl_id) : NULL;
+}
+
+@ The postdot symbol and the position of an AHM
+are checked against the AHM's IRL,
+because the recognizer uses them as indexes.
+@<Read the AHM's from the image@> =
+{
+  AHMID ahm_id;
+  if (ahm_count > 0)
+    {
+      g->t_ahms = marpa_a_new (Allocator_of_G (g), struct s_ahm, ahm_count);
+      AHM_Count_of_G (g) = ahm_count;
+    }
+  for (ahm_id = 0; ahm_id < ahm_count; ahm_id++)
+    {
+      const AHM ahm = AHM_by_ID (ahm_id);
+      const IRL irl = IRL_by_ID (image_int_read_ranged (rd, 0, irl_count));
+      const XRLID xrl_id = image_int_read_ranged (rd, -1, xrl_count);
+      IRL_of_AHM (ahm) = irl;
+      XRL_of_AHM (ahm) = xrl_id >= 0 ? XRL_by_ID (xrl_id) : NULL;
+      Postdot_NSYID_of_AHM (ahm) = image_int_read_ranged (rd, -1, nsy_count);
+      Null_Count_of_AHM (ahm) =
+        image_int_read_ranged (rd, 0, Length_of_IRL (irl) + 1);
+      Position_of_AHM (ahm) =
+        image_int_read_ranged (rd, -1, Length_of_IRL (irl));
+      Quasi_Position_of_AHM (ahm) =
+        image_int_read_ranged (rd, 0, Length_of_IRL (irl) + 1);
+      SYMI_of_AHM (ahm) = image_int_read (rd);
+      XRL_Position_of_AHM (ahm) = image_int_read (rd);
+      Event_Group_Size_of_AHM (ahm) = image_int_read_ranged (rd, 0, INT_MAX);
+      AHM_predicts_ZWA (ahm) = image_int_read_ranged (rd, 0, 2) != 0;
+      AHM_was_Predicted (ahm) = image_int_read_ranged (rd, 0, 2) != 0;
+      AHM_is_Initial (ahm) = image_int_read_ranged (rd, 0, 2) != 0;
+      Predicted_IRL_CIL_of_AHM (ahm) =
+        image_cil_read (rd, &g->t_cilar, irl_count);
+      LHS_CIL_of_AHM (ahm) = image_cil_read (rd, &g->t_cilar, irl_count);
+      Prediction_Bundle_of_AHM (ahm) =
+        image_cil_read (rd, &g->t_cilar, ahm_count);
+      ZWA_CIL_of_AHM (ahm) = image_cil_read (rd, &g->t_cilar, zwa_count);
+      Completion_XSYIDs_of_AHM (ahm) =
+        image_cil_read (rd, &g->t_cilar, xsy_count);
+      Nulled_XSYIDs_of_AHM (ahm) =
+        image_cil_read (rd, &g->t_cilar, xsy_count);
+      Prediction_XSYIDs_of_AHM (ahm) =
+        image_cil_read (rd, &g->t_cilar, xsy_count);
+      Event_AHMIDs_of_AHM (ahm) = image_cil_read (rd, &g->t_cilar, ahm_count);
+      if (rd->t_is_bad)
+        goto CLEANUP;
+      if ((Position_of_AHM (ahm) < 0) != (Postdot_NSYID_of_AHM (ahm) < 0))
+        goto CLEANUP;
+      if (Position_of_AHM (ahm) >= 0
+          && Postdot_NSYID_of_AHM (ahm) != RHSID_of_IRL (irl,
+                                                         Position_of_AHM
+                                                         (ahm)))
+        goto CLEANUP;
+    }
+}
+
+@ @<Read the grammar ZWA's and events from the image@> =
+{
+  int zwa_ix;
+  int event_ix;
+  for (zwa_ix = 0; zwa_ix < zwa_count; zwa_ix++)
+    {
+      const GZWA gzwa = marpa_obs_new (g->t_obs, GZWA_Object, 1);
+      *MARPA_DSTACK_PUSH ((g)->t_gzwa_stack, GZWA) = gzwa;
+      gzwa->t_id = zwa_ix;
+      gzwa->t_default_value = image_int_read_ranged (rd, 0, 2) != 0;
+    }
+  G_EVENTS_CLEAR (g);
+  for (event_ix = 0; event_ix < event_count; event_ix++)
+    {
+      const int type = image_int_read (rd);
+      const int value = image_int_read (rd);
+      int_event_new (g, type, value);
+    }
+}
+
+@ The first AHM of each IRL, and the boolean vectors,
+are recomputed with the same code as in
+|marpa_g_precompute|.
+Finally, the grammar is frozen, as it is at the end of
+precomputation.
+@<Recompute the grammar data not in the image@> =
+{
+  @<Populate the event boolean vectors@>@;
+  if (!G_is_Trivial (g))
+    {
+      @<Populate the first |AHM|'s of the |RULE|'s@>@;
+      @<Populate the terminal boolean vector@>@;
+    }
+  @<Clear rule duplication tree@>@;
+  g->t_is_precomputed = 1;
+  @<Reinitialize the CILAR@>@;
+}
+
+@ Returns a new precomputed grammar, created from |image|,
+or |NULL| on failure.
+As with |marpa_g_new|,
+the error code is set in |configuration|.
+@<Function definitions@> =
+Marpa_Grammar
+marpa_g_deserialize (Marpa_Config * configuration, const void *image,
+                     int image_size)
+{
+  GRAMMAR g;
+  IMAGE_READER_Object reader;
+  if (_MARPA_UNLIKELY (!image || image_size < 0))
+    {
+      if (configuration)
+        configuration->t_error = MARPA_ERR_INVALID_IMAGE;
+      return NULL;
     }
-    for (set = first_unstacked_earley_set; set; set = Next_YS_of_YS(set)) {
-          YS* end_of_stack = MARPA_DSTACK_PUSH(r->t_earley_set_stack, YS);
-          (*end_of_stack) = set;
+  g = marpa_g_new (configuration);
+  if (!g)
+    return NULL;
+  reader.t_image = image;
+  reader.t_length = (size_t) image_size;
+  reader.t_offset = 0;
+  reader.t_is_bad = 0;
+  if (!g_image_read (g, &reader))
+    {
+      marpa_g_unref (g);
+      if (configuration)
+        configuration->t_error = MARPA_ERR_INVALID_IMAGE;
+      return NULL;
     }
+  return g;
 }
 
 @** Create the postdot items.
@@ -8776,7 +12092,7 @@ At this point there are no Leo items.
           PIM new_pim;
 
 	  /* Need to be aligned for a PIM */
-          new_pim = marpa__obs_alloc(r->t_obs,
+          new_pim = marpa__obs_alloc(YS_Obs_of_R(r),
             sizeof(YIX_Object), ALIGNOF(PIM_Object));
 
           Postdot_NSYID_of_PIM(new_pim) = postdot_nsyid;
@@ -8847,7 +12163,7 @@ That may become its actual value,
 once it is populated.
 @<Create a new, unpopulated, LIM@> = {
     LIM new_lim;
-    new_lim = marpa_obs_new(r->t_obs, LIM_Object, 1);
+    new_lim = marpa_obs_new(YS_Obs_of_R(r), LIM_Object, 1);
     LIM_is_Active(new_lim) = 1;
     LIM_is_Rejected(new_lim) = 1;
     Postdot_NSYID_of_LIM(new_lim) = nsyid;
@@ -9159,7 +12475,7 @@ of the base YIM.
 @ @<Copy PIM workarea to postdot item array@> = {
     PIM *postdot_array
         = current_earley_set->t_postdot_ary
-        = marpa_obs_new (r->t_obs, PIM, current_earley_set->t_postdot_sym_count );
+        = marpa_obs_new (YS_Obs_of_R(r), PIM, current_earley_set->t_postdot_sym_count );
     int min, max, start;
     int postdot_array_ix = 0;
     for (start = 0; bv_scan (r->t_bv_pim_symbols, start, &min, &max); start = max + 2) {
@@ -9257,7 +12573,8 @@ marpa_r_clean(Marpa_Recognizer r)
 
 @t}\comment{@>
 /* An obstack whose lifetime is that of the external method */
-struct marpa_obstack* const method_obstack = marpa_obs_init;
+struct marpa_obstack* const method_obstack =
+  marpa_obs_cache_init(Chunk_Cache_of_G(g));
 
 YIMID *prediction_by_irl =
   marpa_obs_new (method_obstack, YIMID, IRL_Count_of_G (g));
@@ -9277,7 +12594,7 @@ YIMID *prediction_by_irl =
     yim_to_clean_count);
   @<Map prediction rules to YIM ordinals in array@>@;
   @<First revision pass over |ys_to_clean|@>@;
-  transitive_closure(acceptance_matrix);
+  transitive_closure(Allocator_of_G(g), acceptance_matrix);
   @<Mark accepted YIM's@>@;
   @<Mark un-accepted YIM's rejected@>@;
   @<Mark accepted SRCL's@>@;
@@ -9699,7 +13016,12 @@ int marpa_r_progress_report_start(
       MARPA_ERROR(MARPA_ERR_NO_EARLEY_SET_AT_LOCATION);
       return failure_indicator;
     }
-  earley_set = YS_of_R_by_Ord (r, set_id);
+  earley_set = ys_of_r_by_ord (r, set_id);
+  if (_MARPA_UNLIKELY(!earley_set))
+    {
+      MARPA_ERROR(MARPA_ERR_EARLEY_SET_FORGOTTEN);
+      return failure_indicator;
+    }
 
   MARPA_OFF_DEBUG3("At %s, starting progress report Earley set %ld",
     STRLOC, (long)set_id);
@@ -9707,7 +13029,7 @@ int marpa_r_progress_report_start(
   @<Clear progress report in |r|@>@;
   {
     const MARPA_AVL_TREE report_tree =
-      _marpa_avl_create (report_item_cmp, NULL);
+      _marpa_avl_create (report_item_cmp, NULL, Allocator_of_G(g));
     const YIM *const earley_items = YIMs_of_YS (earley_set);
     const int earley_item_count = YIM_Count_of_YS (earley_set);
     int earley_item_id;
@@ -9896,6 +13218,145 @@ Marpa_Rule_ID marpa_r_progress_item(
     }
 }
 
+@*0 Completed rules.
+Often all an application needs to know about an Earley set
+is which rules were completed there, starting at the
+beginning of the parse.
+A lexer, for example, needs to know which of its lexeme
+rules have been recognized,
+and the progress report is an expensive way to find this out.
+|marpa_r_completed_rules| lists the rules
+which are complete at Earley set |set_id|
+and which have Earley set 0 as their origin.
+The rules are in ascending order of ID,
+which is the order in which they would appear
+in a progress report.
+|buffer| must have room for the IDs of all the rules
+of the grammar.
+On success, returns the number of rules.
+On failure, returns |-2|.
+@<Function definitions@> =
+int marpa_r_completed_rules(
+  Marpa_Recognizer r,
+  Marpa_Earley_Set_ID set_id,
+  Marpa_Rule_ID* buffer)
+{
+  @<Return |-2| on failure@>@;
+  YS earley_set;
+  @<Unpack recognizer objects@>@;
+  @<Fail if fatal error@>@;
+  @<Fail if recognizer not started@>@;
+  if (_MARPA_UNLIKELY(!buffer)) {
+      MARPA_ERROR (MARPA_ERR_POINTER_ARG_NULL);
+      return failure_indicator;
+  }
+  if (set_id < 0)
+    {
+      MARPA_ERROR (MARPA_ERR_INVALID_LOCATION);
+      return failure_indicator;
+    }
+  r_update_earley_sets (r);
+  if (!YS_Ord_is_Valid (r, set_id))
+    {
+      MARPA_ERROR(MARPA_ERR_NO_EARLEY_SET_AT_LOCATION);
+      return failure_indicator;
+    }
+  earley_set = ys_of_r_by_ord (r, set_id);
+  if (_MARPA_UNLIKELY(!earley_set))
+    {
+      MARPA_ERROR(MARPA_ERR_EARLEY_SET_FORGOTTEN);
+      return failure_indicator;
+    }
+  {
+    const Bit_Vector bv_completed = r->t_bv_completed_xrl;
+    const YIM *const earley_items = YIMs_of_YS (earley_set);
+    const int earley_item_count = YIM_Count_of_YS (earley_set);
+    int earley_item_id;
+    int count = 0;
+    int start, min, max;
+    bv_clear (bv_completed);
+    for (earley_item_id = 0; earley_item_id < earley_item_count;
+         earley_item_id++)
+      {
+        const YIM earley_item = earley_items[earley_item_id];
+        SRCL leo_source_link;
+        if (!YIM_is_Active(earley_item)) continue;
+        completed_rules_insert (bv_completed, AHM_of_YIM (earley_item),
+                                     earley_item);
+        @t}\comment{@>
+        /* As in the progress report, the completions on
+        the Leo paths are also completions at this Earley set */
+        for (leo_source_link = First_Leo_SRCL_of_YIM (earley_item);
+             leo_source_link;
+             leo_source_link = Next_SRCL_of_SRCL (leo_source_link))
+          {
+            LIM leo_item;
+            if (!SRCL_is_Active (leo_source_link)) continue;
+            for (leo_item = LIM_of_SRCL (leo_source_link);
+                 leo_item; leo_item = Predecessor_LIM_of_LIM (leo_item))
+              {
+                completed_rules_insert (bv_completed,
+                                        Trailhead_AHM_of_LIM (leo_item),
+                                        Trailhead_YIM_of_LIM (leo_item));
+              }
+          }
+      }
+    for (start = 0; bv_scan (bv_completed, start, &min, &max);
+         start = max + 2)
+      {
+        XRLID xrl_id;
+        for (xrl_id = min; xrl_id <= max; xrl_id++)
+          {
+            buffer[count++] = xrl_id;
+          }
+      }
+    return count;
+  }
+}
+
+@ A lexer calls |marpa_r_completed_rules| once for every
+codepoint, so its boolean vector of completed rules
+is allocated once, with the recognizer,
+and cleared on each call.
+@<Widely aligned recognizer elements@> =
+  Bit_Vector t_bv_completed_xrl;
+@ @<Initialize recognizer elements@> =
+  r->t_bv_completed_xrl = bv_obs_create( r->t_obs, XRL_Count_of_G(g) );
+
+@ This follows the logic of |progress_report_items_insert|,
+but notes only completed rules with origin 0.
+@<Function definitions@> =
+PRIVATE void
+completed_rules_insert(Bit_Vector bv_completed,
+  AHM report_ahm,
+    YIM origin_yim)
+{
+  const XRL source_xrl = XRL_of_AHM (report_ahm);
+  if (!source_xrl) return;
+  if (XRL_Position_of_AHM (report_ahm) != -1) return;
+  if (!IRL_has_Virtual_LHS (IRL_of_YIM (origin_yim))) {
+    if (Origin_Ord_of_YIM(origin_yim) == 0) {
+      bv_bit_set (bv_completed, ID_of_XRL (source_xrl));
+    }
+    return;
+  }
+  if (XRL_is_Sequence(source_xrl)) return;
+  {
+     const NSYID lhs_nsyid = LHS_NSYID_of_YIM(origin_yim);
+     const YS origin_of_origin_ys = Origin_of_YIM(origin_yim);
+     PIM pim = First_PIM_of_YS_by_NSYID (origin_of_origin_ys, lhs_nsyid);
+     for (; pim; pim = Next_PIM_of_PIM (pim))
+     {
+         const YIM predecessor = YIM_of_PIM (pim);
+         if (!predecessor) return;
+         if (YIM_is_Active(predecessor)) {
+           completed_rules_insert(bv_completed,
+             report_ahm, predecessor);
+         }
+     }
+  }
+}
+
 @** Some notes on evaluation.
 
 @*0 Sources of Leo path items.
@@ -10068,14 +13529,15 @@ struct s_ur_node_stack t_ur_node_stack;
 The lifetime of this stack should be reexamined once its uses
 are settled.
 @<Initialize recognizer elements@> =
-    ur_node_stack_init(URS_of_R(r));
+    ur_node_stack_init(URS_of_R(r), Chunk_Cache_of_G(g));
 @ @<Destroy recognizer elements@> =
     ur_node_stack_destroy(URS_of_R(r));
 
 @ @<Function definitions@> =
-PRIVATE void ur_node_stack_init(URS stack)
+PRIVATE void ur_node_stack_init(URS stack,
+  struct marpa_obstack_cache *chunk_cache)
 {
-    stack->t_obs = marpa_obs_init;
+    stack->t_obs = marpa_obs_cache_init(chunk_cache);
     stack->t_base = ur_node_new(stack, 0);
     ur_node_stack_reset(stack);
 }
@@ -10379,8 +13841,8 @@ static const OR dummy_or_node = (OR)&dummy_or_node_type;
   const PSAR or_psar = &or_per_ys_arena;
   int work_earley_set_ordinal;
   OR_Capacity_of_B(b) = count_of_earley_items_in_parse;
-  ORs_of_B (b) = marpa_new (OR, OR_Capacity_of_B(b));
-  psar_init (or_psar, SYMI_Count_of_G (g));
+  ORs_of_B (b) = marpa_a_new (Allocator_of_G(g), OR, OR_Capacity_of_B(b));
+  psar_init (or_psar, SYMI_Count_of_G (g), Allocator_of_G(g));
   for (work_earley_set_ordinal = 0;
       work_earley_set_ordinal < earley_set_count_of_r;
       work_earley_set_ordinal++)
@@ -10396,7 +13858,8 @@ static const OR dummy_or_node = (OR)&dummy_or_node_type;
     @<Create draft and-nodes for |work_earley_set_ordinal|@>@;
   }
   psar_destroy (or_psar);
-  ORs_of_B(b) = marpa_renew (OR, ORs_of_B(b), OR_Count_of_B(b));
+  ORs_of_B(b) = marpa_a_renew (Allocator_of_G(g), OR, ORs_of_B(b), OR_Count_of_B(b));
+  OR_Capacity_of_B(b) = OR_Count_of_B(b);
 }
 
 @ @<Create the or-nodes for |work_earley_set_ordinal|@> =
@@ -10482,7 +13945,7 @@ PRIVATE OR or_node_new(BOCAGE b)
     {
       OR_Capacity_of_B(b) *= 2;
       ORs_of_B (b) =
-        marpa_renew (OR, ORs_of_B(b), OR_Capacity_of_B(b));
+        marpa_a_renew (Allocator_of_G(G_of_B(b)), OR, ORs_of_B(b), OR_Capacity_of_B(b));
     }
   OR_of_B_by_ID(b,or_node_id) = new_or_node;
   return new_or_node;
@@ -11083,7 +14546,7 @@ typedef struct s_and_node AND_Object;
   int or_node_id;
   int and_node_id = 0;
   const AND ands_of_b = ANDs_of_B (b) =
-    marpa_new (AND_Object, unique_draft_and_node_count);
+    marpa_a_new (Allocator_of_G(g), AND_Object, unique_draft_and_node_count);
   for (or_node_id = 0; or_node_id < or_count_of_b; or_node_id++)
     {
       int and_count_of_parent_or = 0;
@@ -11168,6 +14631,19 @@ int marpa_trv_soft_error(Marpa_Traverser trv)
     const RECCE r @,@, UNUSED = R_of_TRV(trv);
     const GRAMMAR g @,@, UNUSED = G_of_R(r);
 
+@ A traverser is stale if its recognizer has been reset
+since the traverser was created.
+@d R_Generation_of_TRV(trv) ((trv)->t_trv_r_generation)
+@<Int aligned traverser elements@> =
+    unsigned int t_trv_r_generation;
+@ @<Initialize traverser |trv|@> =
+    R_Generation_of_TRV(trv) = R_Generation(r);
+@ @<Fail if traverser is stale@> =
+if (_MARPA_UNLIKELY(R_Generation_of_TRV(trv) != R_Generation(r))) {
+    MARPA_ERROR(MARPA_ERR_BASE_GENERATION_MISMATCH);
+    return failure_indicator;
+}
+
 @*0 Traverser constructors.
 @ There are several traverser constructors,
 because source links are followed by returning
@@ -11179,7 +14655,7 @@ trv_new(RECCE r, YIM yim)
 {
     TRAVERSER trv;
 
-    trv = my_malloc (sizeof (*trv));
+    trv = marpa__a_malloc (Allocator_of_G(G_of_R(r)), sizeof (*trv));
     @<Initialize traverser |trv|@>
     recce_ref(r);
     if (!yim) {
@@ -11188,8 +14664,11 @@ trv_new(RECCE r, YIM yim)
     }
     TRV_is_Trivial(trv) = 0;
     YIM_of_TRV(trv) = yim;
-    TOKEN_SRCL_of_TRV (trv) = First_Token_SRCL_of_YIM (yim);
-    COMPLETION_SRCL_of_TRV (trv) = First_Completion_SRCL_of_YIM (yim);
+    if (!R_is_Link_Free (r))
+      {
+        TOKEN_SRCL_of_TRV (trv) = First_Token_SRCL_of_YIM (yim);
+        COMPLETION_SRCL_of_TRV (trv) = First_Completion_SRCL_of_YIM (yim);
+      }
     LEO_SRCL_of_TRV (trv) = First_Leo_SRCL_of_YIM (yim);
     return trv;
 }
@@ -11252,7 +14731,12 @@ Marpa_Traverser marpa_trv_new(Marpa_Recognizer r,
               MARPA_ERROR(MARPA_ERR_INVALID_LOCATION);
               return failure_indicator;
           }
-          ys = YS_of_R_by_Ord (r, es_arg);
+          ys = ys_of_r_by_ord (r, es_arg);
+          if (_MARPA_UNLIKELY(!ys))
+            {
+              MARPA_ERROR(MARPA_ERR_EARLEY_SET_FORGOTTEN);
+              return failure_indicator;
+            }
       }
 
       item_count = YIM_Count_of_YS (ys);
@@ -11275,6 +14759,7 @@ int marpa_trv_at_completion(Marpa_Traverser trv)
     @<Unpack traverser objects@>@;
     SRCL srcl;
     @<Fail if fatal error@>@;
+    @<Fail if traverser is stale@>@;
 
     if (G_is_Trivial(g)) return 0;
     srcl = COMPLETION_SRCL_of_TRV (trv);
@@ -11289,6 +14774,7 @@ int marpa_trv_at_token(Marpa_Traverser trv)
     @<Unpack traverser objects@>@;
     SRCL srcl;
     @<Fail if fatal error@>@;
+    @<Fail if traverser is stale@>@;
 
     if (G_is_Trivial(g)) return 0;
     srcl = TOKEN_SRCL_of_TRV (trv);
@@ -11303,6 +14789,7 @@ int marpa_trv_at_leo(Marpa_Traverser trv)
     @<Unpack traverser objects@>@;
     SRCL srcl;
     @<Fail if fatal error@>@;
+    @<Fail if traverser is stale@>@;
 
     if (G_is_Trivial(g)) return 0;
     srcl = LEO_SRCL_of_TRV (trv);
@@ -11321,6 +14808,8 @@ Marpa_Traverser marpa_trv_completion_predecessor(Marpa_Traverser trv)
     SRCL srcl;
     YIM predecessor;
     @<Fail if fatal error@>@;
+    @<Fail if traverser is stale@>@;
+    @<Fail if recognizer is link-free@>@;
     TRV_has_Soft_Error(trv) = 0;
 
     if (G_is_Trivial(g)) {
@@ -11354,6 +14843,7 @@ Marpa_LTraverser marpa_trv_lim(Marpa_Traverser trv)
     SRCL srcl;
     LIM predecessor;
     @<Fail if fatal error@>@;
+    @<Fail if traverser is stale@>@;
     TRV_has_Soft_Error(trv) = 0;
 
     if (G_is_Trivial(g)) {
@@ -11387,6 +14877,9 @@ Marpa_Traverser marpa_trv_token_predecessor(Marpa_Traverser trv)
     SRCL srcl;
     YIM predecessor;
     @<Fail if fatal error@>@;
+    @<Fail if traverser is stale@>@;
+    @<Fail if recognizer is forgetful@>@;
+    @<Fail if recognizer is link-free@>@;
     TRV_has_Soft_Error(trv) = 0;
 
     if (G_is_Trivial(g)) {
@@ -11417,6 +14910,7 @@ int marpa_trv_completion_next(Marpa_Traverser trv)
     @<Unpack traverser objects@>@;
     SRCL srcl;
     @<Fail if fatal error@>@;
+    @<Fail if traverser is stale@>@;
     if (G_is_Trivial(g)) {
        return 0;
     }
@@ -11435,6 +14929,7 @@ int marpa_trv_leo_next(Marpa_Traverser trv)
     @<Unpack traverser objects@>@;
     SRCL srcl;
     @<Fail if fatal error@>@;
+    @<Fail if traverser is stale@>@;
     if (G_is_Trivial(g)) {
        return 0;
     }
@@ -11453,6 +14948,7 @@ int marpa_trv_token_next(Marpa_Traverser trv)
     @<Unpack traverser objects@>@;
     SRCL srcl;
     @<Fail if fatal error@>@;
+    @<Fail if traverser is stale@>@;
     if (G_is_Trivial(g)) {
        return 0;
     }
@@ -11510,11 +15006,12 @@ PRIVATE void
 traverser_free (TRAVERSER trv)
 {
   @<Unpack traverser objects@>@;
+  struct marpa_allocator_s allocator = *Allocator_of_G(g);
   if (trv)
     {
       @<Destroy traverser elements@>;
     }
-  my_free(trv);
+  marpa__a_free(&allocator, trv);
 }
 
 @*0 Traverser is trivial?.
@@ -11533,6 +15030,7 @@ int marpa_trv_is_trivial(Marpa_Traverser trv)
   @<Return |-2| on failure@>@;
   @<Unpack traverser objects@>@;
   @<Fail if fatal error@>@;
+  @<Fail if traverser is stale@>@;
   return TRV_is_Trivial(trv);
 }
 @ @<Fail if traverser grammar is trivial@> =
@@ -11550,6 +15048,7 @@ Marpa_Rule_ID marpa_trv_rule_id(Marpa_Traverser trv)
   @<Return |-2| on failure@>@;
   @<Unpack traverser objects@>@;
   @<Fail if fatal error@>@;
+  @<Fail if traverser is stale@>@;
   @<Fail if traverser grammar is trivial@>@;
   {
     const YIM yim = YIM_of_TRV(trv);
@@ -11567,6 +15066,7 @@ int marpa_trv_dot(Marpa_Traverser trv)
   @<Return |-2| on failure@>@;
   @<Unpack traverser objects@>@;
   @<Fail if fatal error@>@;
+  @<Fail if traverser is stale@>@;
   @<Fail if traverser grammar is trivial@>@;
   {
     const YIM yim = YIM_of_TRV(trv);
@@ -11587,6 +15087,7 @@ int marpa_trv_origin(Marpa_Traverser trv)
   @<Return |-2| on failure@>@;
   @<Unpack traverser objects@>@;
   @<Fail if fatal error@>@;
+  @<Fail if traverser is stale@>@;
   @<Fail if traverser grammar is trivial@>@;
   {
     const YIM yim = YIM_of_TRV(trv);
@@ -11601,6 +15102,7 @@ Marpa_IRL_ID marpa_trv_nrl_id(Marpa_Traverser trv)
   @<Return |-2| on failure@>@;
   @<Unpack traverser objects@>@;
   @<Fail if fatal error@>@;
+  @<Fail if traverser is stale@>@;
   @<Fail if traverser grammar is trivial@>@;
   {
     const YIM yim = YIM_of_TRV(trv);
@@ -11618,6 +15120,7 @@ int marpa_trv_nrl_dot(Marpa_Traverser trv)
   @<Return |-2| on failure@>@;
   @<Unpack traverser objects@>@;
   @<Fail if fatal error@>@;
+  @<Fail if traverser is stale@>@;
   @<Fail if traverser grammar is trivial@>@;
   {
     const YIM yim = YIM_of_TRV(trv);
@@ -11678,6 +15181,19 @@ int marpa_ltrv_soft_error(Marpa_LTraverser ltrv)
     const RECCE r @,@, UNUSED = R_of_LTRV(ltrv);
     const GRAMMAR g @,@, UNUSED = G_of_R(r);
 
+@ A LIM traverser is stale if its recognizer has been reset
+since the LIM traverser was created.
+@d R_Generation_of_LTRV(ltrv) ((ltrv)->t_ltrv_r_generation)
+@<Int aligned LIM traverser elements@> =
+    unsigned int t_ltrv_r_generation;
+@ @<Initialize LIM traverser |ltrv|@> =
+    R_Generation_of_LTRV(ltrv) = R_Generation(r);
+@ @<Fail if LIM traverser is stale@> =
+if (_MARPA_UNLIKELY(R_Generation_of_LTRV(ltrv) != R_Generation(r))) {
+    MARPA_ERROR(MARPA_ERR_BASE_GENERATION_MISMATCH);
+    return failure_indicator;
+}
+
 @*0 LIM traverser constructors.
 @
 @<Function definitions@> =
@@ -11686,7 +15202,7 @@ ltrv_new(RECCE r, LIM lim)
 {
     LTRAVERSER ltrv;
 
-    ltrv = my_malloc (sizeof (*ltrv));
+    ltrv = marpa__a_malloc (Allocator_of_G(G_of_R(r)), sizeof (*ltrv));
     @<Initialize LIM  traverser |ltrv|@>
     recce_ref(r);
     LIM_of_LTRV(ltrv) = lim;
@@ -11701,6 +15217,7 @@ Marpa_LTraverser marpa_ltrv_predecessor(Marpa_LTraverser ltrv)
     @<Unpack LIM traverser objects@>@;
     LIM predecessor;
     @<Fail if fatal error@>@;
+    @<Fail if LIM traverser is stale@>@;
     LTRV_has_Soft_Error(ltrv) = 0;
     predecessor = Predecessor_LIM_of_LIM(LIM_of_LTRV(ltrv));
     if (!predecessor) {
@@ -11719,6 +15236,7 @@ marpa_ltrv_trailhead_eim (Marpa_LTraverser ltrv, int*p_dot, Marpa_Earley_Set_ID*
   @<Return |-2| on failure@>@;
   @<Unpack LIM traverser objects@>@;
   @<Fail if fatal error@>@;
+  @<Fail if LIM traverser is stale@>@;
   {
       const LIM lim = LIM_of_LTRV (ltrv);
       const AHM ahm = Trailhead_AHM_of_LIM (lim);
@@ -11783,11 +15301,12 @@ PRIVATE void
 ltraverser_free (LTRAVERSER ltrv)
 {
   @<Unpack LIM traverser objects@>@;
+  struct marpa_allocator_s allocator = *Allocator_of_G(g);
   if (ltrv)
     {
       @<Destroy LIM traverser elements@>;
     }
-  my_free(ltrv);
+  marpa__a_free(&allocator, ltrv);
 }
 
 @** PIM traverser code (PTRV, PTRAVERSER).
@@ -11845,6 +15364,19 @@ int marpa_ptrv_soft_error(Marpa_PTraverser ptrv)
     const RECCE r @,@, UNUSED = R_of_PTRV(ptrv);
     const GRAMMAR g @,@, UNUSED = G_of_R(r);
 
+@ A PIM traverser is stale if its recognizer has been reset
+since the PIM traverser was created.
+@d R_Generation_of_PTRV(ptrv) ((ptrv)->t_ptrv_r_generation)
+@<Int aligned PIM traverser elements@> =
+    unsigned int t_ptrv_r_generation;
+@ @<Initialize PIM traverser |ptrv|@> =
+    R_Generation_of_PTRV(ptrv) = R_Generation(r);
+@ @<Fail if PIM traverser is stale@> =
+if (_MARPA_UNLIKELY(R_Generation_of_PTRV(ptrv) != R_Generation(r))) {
+    MARPA_ERROR(MARPA_ERR_BASE_GENERATION_MISMATCH);
+    return failure_indicator;
+}
+
 @*0 Traverser constructors.
 @ There are several traverser constructors,
 because source links are followed by returning
@@ -11858,7 +15390,7 @@ ptrv_new(RECCE r, YS ys, NSYID nsyid)
     const PIM pim = First_PIM_of_YS_by_NSYID (ys, nsyid);
 
     if (!pim) return NULL;
-    ptrv = my_malloc (sizeof (*ptrv));
+    ptrv = marpa__a_malloc (Allocator_of_G(G_of_R(r)), sizeof (*ptrv));
     @<Initialize PIM traverser |ptrv|@>
     recce_ref(r);
     PIM_of_PTRV(ptrv) = pim;
@@ -11918,7 +15450,12 @@ Marpa_PTraverser marpa_ptrv_new(Marpa_Recognizer r,
               MARPA_ERROR(MARPA_ERR_INVALID_LOCATION);
               return failure_indicator;
           }
-          ys = YS_of_R_by_Ord (r, es_arg);
+          ys = ys_of_r_by_ord (r, es_arg);
+          if (_MARPA_UNLIKELY(!ys))
+            {
+              MARPA_ERROR(MARPA_ERR_EARLEY_SET_FORGOTTEN);
+              return failure_indicator;
+            }
       }
 
       return ptrv_new(r, ys, nsyid);
@@ -11933,6 +15470,7 @@ int marpa_ptrv_at_lim(Marpa_PTraverser ptrv)
     @<Unpack PIM traverser objects@>@;
     PIM pim;
     @<Fail if fatal error@>@;
+    @<Fail if PIM traverser is stale@>@;
 
     if (G_is_Trivial(g)) return 0;
     pim = PIM_of_PTRV(ptrv);
@@ -11948,6 +15486,7 @@ int marpa_ptrv_at_eim(Marpa_PTraverser ptrv)
     @<Unpack PIM traverser objects@>@;
     PIM pim;
     @<Fail if fatal error@>@;
+    @<Fail if PIM traverser is stale@>@;
 
     if (G_is_Trivial(g)) return 0;
     pim = PIM_of_PTRV(ptrv);
@@ -11968,6 +15507,7 @@ Marpa_Traverser marpa_ptrv_eim_iter(Marpa_PTraverser ptrv)
     PIM pim;
     YIM yim;
     @<Fail if fatal error@>@;
+    @<Fail if PIM traverser is stale@>@;
     PTRV_has_Soft_Error(ptrv) = 0;
 
     if (G_is_Trivial(g)) {
@@ -12038,11 +15578,12 @@ PRIVATE void
 ptraverser_free (PTRAVERSER ptrv)
 {
   @<Unpack PIM traverser objects@>@;
+  struct marpa_allocator_s allocator = *Allocator_of_G(g);
   if (ptrv)
     {
       @<Destroy PIM traverser elements@>;
     }
-  my_free(ptrv);
+  marpa__a_free(&allocator, ptrv);
 }
 
 @*0 Traverser is trivial?.
@@ -12061,6 +15602,7 @@ int marpa_ptrv_is_trivial(Marpa_PTraverser ptrv)
   @<Return |-2| on failure@>@;
   @<Unpack PIM traverser objects@>@;
   @<Fail if fatal error@>@;
+  @<Fail if PIM traverser is stale@>@;
   return PTRV_is_Trivial(ptrv);
 }
 
@@ -12107,6 +15649,7 @@ ORID t_top_or_node_id;
 @ @<Initialize bocage elements@> =
 ORs_of_B(b) = NULL;
 OR_Count_of_B(b) = 0;
+OR_Capacity_of_B(b) = 0;
 ANDs_of_B(b) = NULL;
 AND_Count_of_B(b) = 0;
 Top_ORID_of_B(b) = -1;
@@ -12115,11 +15658,12 @@ Top_ORID_of_B(b) = -1;
 {
   OR* or_nodes = ORs_of_B (b);
   AND and_nodes = ANDs_of_B (b);
+  struct marpa_allocator_s allocator = *Allocator_of_G(G_of_B(b));
 
   grammar_unref (G_of_B(b));
-  my_free (or_nodes);
+  marpa__a_free (&allocator, or_nodes);
   ORs_of_B (b) = NULL;
-  my_free (and_nodes);
+  marpa__a_free (&allocator, and_nodes);
   ANDs_of_B (b) = NULL;
 }
 
@@ -12154,6 +15698,8 @@ Marpa_Bocage marpa_b_new(Marpa_Recognizer r,
     @<Return |NULL| on failure@>@;
     @<Declare bocage locals@>@;
     @<Fail if fatal error@>@;
+    @<Fail if recognizer is forgetful@>@;
+    @<Fail if recognizer is link-free@>@;
     if (_MARPA_UNLIKELY( ordinal_arg <= -2 ))
     {
         MARPA_ERROR(MARPA_ERR_INVALID_LOCATION);
@@ -12162,7 +15708,8 @@ Marpa_Bocage marpa_b_new(Marpa_Recognizer r,
 
     @<Fail if recognizer not started@>@;
     {
-        struct marpa_obstack* const obstack = marpa_obs_init;
+        struct marpa_obstack* const obstack =
+          marpa_obs_cache_init(Chunk_Cache_of_G(g));
         b = marpa_obs_new (obstack, struct marpa_bocage, 1);
         OBS_of_B(b) = obstack;
     }
@@ -12187,16 +15734,24 @@ Marpa_Bocage marpa_b_new(Marpa_Recognizer r,
       }
     @<Find |start_yim|@>@;
     if (!start_yim) goto NO_PARSE;
-    bocage_setup_obs = marpa_obs_init;
+    bocage_setup_obs = marpa_obs_cache_init(Chunk_Cache_of_G(g));
     @<Allocate bocage setup working data@>@;
     @<Populate the PSI data@>@;
     @<Create the or-nodes for all earley sets@>@;
+    if (_MARPA_UNLIKELY (memory_limit_is_exceeded (r,
+        bocage_memory_usage (b) + marpa_obs_allocated (bocage_setup_obs))))
+      {
+        marpa_obs_free (bocage_setup_obs);
+        MARPA_ERROR (MARPA_ERR_MEMORY_LIMIT);
+        goto FAILURE;
+      }
     @<Create the final and-nodes for all earley sets@>@;
     @<Set top or node id in |b|@>;
     marpa_obs_free(bocage_setup_obs);
     return b;
     NO_PARSE: ;
           MARPA_ERROR(MARPA_ERR_NO_PARSE);
+    FAILURE: ;
     if (b) {
         @<Destroy bocage elements, all phases@>;
     }
@@ -12484,7 +16039,7 @@ Marpa_Order marpa_o_new(Marpa_Bocage b)
     @<Unpack bocage objects@>@;
     ORDER o;
     @<Fail if fatal error@>@;
-    o = my_malloc(sizeof(*o));
+    o = marpa__a_malloc(Allocator_of_G(g), sizeof(*o));
     B_of_O(o) = b;
     bocage_ref(b);
     @<Pre-initialize order elements@>@;
@@ -12535,9 +16090,10 @@ marpa_o_ref (Marpa_Order o)
 PRIVATE void order_free(ORDER o)
 {
   @<Unpack order objects@>@;
+  struct marpa_allocator_s allocator = *Allocator_of_G(g);
   bocage_unref(b);
   marpa_obs_free(OBS_of_O(o));
-  my_free( o);
+  marpa__a_free(&allocator, o);
 }
 
 @ @<Unpack order objects@> =
@@ -12592,8 +16148,8 @@ and that we are using the high rank order.
     Ambiguity_Metric_of_O(o) = 1;
     /* initialize the ambiguity metric
     to unambiguous */
-    bv_orid_was_stacked = bv_create(or_count);
-    FSTACK_INIT (or_node_stack, ORID, or_count);
+    bv_orid_was_stacked = bv_create(Allocator_of_G(g), or_count);
+    FSTACK_INIT (or_node_stack, ORID, or_count, Allocator_of_G(g));
     *(FSTACK_PUSH(or_node_stack)) = root_or_id;
     bv_bit_set(bv_orid_was_stacked, root_or_id);
     while ((top_of_stack = FSTACK_POP (or_node_stack)))
@@ -12637,7 +16193,7 @@ and that we are using the high rank order.
     }
     END_OR_NODE_LOOP: ;
     FSTACK_DESTROY(or_node_stack);
-    bv_free(bv_orid_was_stacked);
+    bv_free(Allocator_of_G(g), bv_orid_was_stacked);
     // for now copy the bocage metric
 }
 
@@ -12828,7 +16384,7 @@ int marpa_o_rank( Marpa_Order o)
   const int or_node_count_of_b = OR_Count_of_B (b);
   const int and_node_count_of_b = AND_Count_of_B (b);
   int or_node_id = 0;
-  int *rank_by_and_id = marpa_new (int, and_node_count_of_b);
+  int *rank_by_and_id = marpa_a_new (Allocator_of_G(g), int, and_node_count_of_b);
   int and_node_id;
   for (and_node_id = 0; and_node_id < and_node_count_of_b; and_node_id++)
     {
@@ -12844,7 +16400,7 @@ int marpa_o_rank( Marpa_Order o)
         @<Sort |work_or_node| for "rank by rule"@>@;
       or_node_id++;
     }
-   my_free(rank_by_and_id);
+   marpa__a_free(Allocator_of_G(g), rank_by_and_id);
 }
 
 @ An insertion sort is used here, which is
@@ -12902,7 +16458,7 @@ and code-size savings in exchange for the space.
 {
   int and_id;
   const int and_count_of_r = AND_Count_of_B (b);
-  obs = OBS_of_O (o) = marpa_obs_init;
+  obs = OBS_of_O (o) = marpa_obs_cache_init(Chunk_Cache_of_G(g));
   o->t_and_node_orderings =
     and_node_orderings =
     marpa_obs_new (obs, ANDID*, and_count_of_r);
@@ -13025,7 +16581,7 @@ PRIVATE void tree_exhaust(TREE t)
       FSTACK_DESTROY (t->t_nook_worklist);
       FSTACK_SAFE (t->t_nook_worklist);
     }
-  bv_free (t->t_or_node_in_use);
+  bv_free (Allocator_of_G(G_of_B(B_of_O(O_of_T(t)))), t->t_or_node_in_use);
   t->t_or_node_in_use = NULL;
   T_is_Exhausted(t) = 1;
 }
@@ -13037,7 +16593,7 @@ Marpa_Tree marpa_t_new(Marpa_Order o)
     TREE t;
     @<Unpack order objects@>@;
     @<Fail if fatal error@>@;
-    t = my_malloc(sizeof(*t));
+    t = marpa__a_malloc(Allocator_of_G(g), sizeof(*t));
     O_of_T(t) = o;
     order_ref(o);
     O_is_Frozen(o) = 1;
@@ -13061,9 +16617,9 @@ Marpa_Tree marpa_t_new(Marpa_Order o)
       const int and_count = AND_Count_of_B (b);
       const int or_count = OR_Count_of_B (b);
       T_is_Nulling (t) = 0;
-      t->t_or_node_in_use = bv_create (or_count);
-      FSTACK_INIT (t->t_nook_stack, NOOK_Object, and_count);
-      FSTACK_INIT (t->t_nook_worklist, int, and_count);
+      t->t_or_node_in_use = bv_create (Allocator_of_G(g), or_count);
+      FSTACK_INIT (t->t_nook_stack, NOOK_Object, and_count, Allocator_of_G(g));
+      FSTACK_INIT (t->t_nook_worklist, int, and_count, Allocator_of_G(g));
     }
 }
 
@@ -13109,9 +16665,11 @@ marpa_t_ref (Marpa_Tree t)
 @ @<Function definitions@> =
 PRIVATE void tree_free(TREE t)
 {
-    order_unref(O_of_T(t));
+    struct marpa_allocator_s allocator =
+      *Allocator_of_G(G_of_B(B_of_O(O_of_T(t))));
     tree_exhaust(t);
-    my_free( t);
+    order_unref(O_of_T(t));
+    marpa__a_free(&allocator, t);
 }
 
 @*0 Tree generations.
@@ -13602,7 +17160,8 @@ Marpa_Value marpa_v_new(Marpa_Tree t)
     if (!T_is_Exhausted (t))
       {
         const XSYID xsy_count = XSY_Count_of_G (g);
-        struct marpa_obstack* const obstack = marpa_obs_init;
+        struct marpa_obstack* const obstack =
+          marpa_obs_cache_init(Chunk_Cache_of_G(g));
         const VALUE v = marpa_obs_new (obstack, struct s_value, 1);
         v->t_obs = obstack;
         Step_Type_of_V (v) = Next_Value_Type_of_V (v) = MARPA_STEP_INITIAL;
@@ -13615,7 +17174,7 @@ Marpa_Value marpa_v_new(Marpa_Tree t)
           const int minimum_stack_size = (8192 / sizeof (int));
           const int initial_stack_size =
             MAX (Size_of_TREE (t) / 1024, minimum_stack_size);
-          MARPA_DSTACK_INIT (VStack_of_V (v), int, initial_stack_size);
+          MARPA_DSTACK_INIT (VStack_of_V (v), int, initial_stack_size, Allocator_of_G(g));
         }
         return (Marpa_Value)v;
       }
@@ -14245,6 +17804,20 @@ PRIVATE LBV lbv_clone(
   return new_lbv;
 }
 
+@*0 Copy one LBV into another of the same length.
+@<Function definitions@> =
+PRIVATE LBV lbv_copy(
+  LBV lbv_to, LBV lbv_from, int bits)
+{
+  int size = lbv_bits_to_size (bits);
+  if (size > 0) {
+      LBW *from_addr = lbv_from;
+      LBW *to_addr = lbv_to;
+      while (size--) *to_addr++ = *from_addr++;
+  }
+  return lbv_to;
+}
+
 @*0 Fill an LBV with ones.
 No special provision is made for trailing bits.
 @<Function definitions@> =
@@ -14304,11 +17877,11 @@ the pointer returned is to the data.
 This is offset from the |malloc|'d space,
 by |bv_hiddenwords|.
 @<Function definitions@> =
-PRIVATE Bit_Vector bv_create(int bits)
+PRIVATE Bit_Vector bv_create(MARPA_ALLOCATOR allocator, int bits)
 {
     LBW size = bv_bits_to_size(bits);
     LBW bytes = (size + (LBW)bv_hiddenwords) * (LBW)sizeof(Bit_Vector_Word);
-    LBW* addr = (Bit_Vector) my_malloc0((size_t) bytes);
+    LBW* addr = (Bit_Vector) marpa__a_malloc0(allocator, (size_t) bytes);
     *addr++ = (LBW)bits;
     *addr++ = size;
     *addr++ = bv_bits_to_unused_mask(bits);
@@ -14343,9 +17916,9 @@ bv_obs_create (struct marpa_obstack *obs, int bits)
 Create another vector the same size as the original, but with
 all bits unset.
 @<Function definitions@> =
-PRIVATE Bit_Vector bv_shadow(Bit_Vector bv)
+PRIVATE Bit_Vector bv_shadow(MARPA_ALLOCATOR allocator, Bit_Vector bv)
 {
-    return bv_create((int)BV_BITS(bv));
+    return bv_create(allocator, (int)BV_BITS(bv));
 }
 PRIVATE Bit_Vector bv_obs_shadow(struct marpa_obstack * obs, Bit_Vector bv)
 {
@@ -14376,9 +17949,9 @@ an exact duplicate.
 This call allocates a new vector, which must be |free|'d.
 @<Function definitions@> =
 PRIVATE
-Bit_Vector bv_clone(Bit_Vector bv)
+Bit_Vector bv_clone(MARPA_ALLOCATOR allocator, Bit_Vector bv)
 {
-    return bv_copy(bv_shadow(bv), bv);
+    return bv_copy(bv_shadow(allocator, bv), bv);
 }
 
 PRIVATE
@@ -14389,12 +17962,12 @@ Bit_Vector bv_obs_clone(struct marpa_obstack *obs, Bit_Vector bv)
 
 @*0 Free a boolean vector.
 @<Function definitions@> =
-PRIVATE void bv_free(Bit_Vector vector)
+PRIVATE void bv_free(MARPA_ALLOCATOR allocator, Bit_Vector vector)
 {
     if (_MARPA_LIKELY(vector != NULL))
     {
         vector -= bv_hiddenwords;
-        my_free(vector);
+        marpa__a_free(allocator, vector);
     }
 }
 
@@ -14488,6 +18061,16 @@ int bv_is_empty(Bit_Vector addr)
     return(r);
 }
 
+@*0 Compare two boolean vectors of the same length.
+Returns 1 if they are equal, 0 otherwise.
+@<Function definitions@>=
+PRIVATE int bv_is_equal(Bit_Vector X, Bit_Vector Y)
+{
+    LBW size = BV_SIZE(X);
+    while (size-- > 0) if (*X++ != *Y++) return 0;
+    return 1;
+}
+
 @*0 Bitwise-negate a boolean vector.
 @<Function definitions@>=
 PRIVATE void bv_not(Bit_Vector X, Bit_Vector Y)
@@ -14666,7 +18249,7 @@ rhs_closure (GRAMMAR g, Bit_Vector bv, XRLID ** xrl_list_x_rh_sym)
   @t}\comment{@>
   /* Create a work stack. */
   FSTACK_DECLARE (stack, XSYID) @;
-  FSTACK_INIT (stack, XSYID, XSY_Count_of_G (g));
+  FSTACK_INIT (stack, XSYID, XSY_Count_of_G (g), Allocator_of_G(g));
 
   @t}\comment{@>
   /* |bv| is initialized to a set of symbols known to have
@@ -14927,27 +18510,168 @@ of the relation.
 The matrix is assumed to be square.
 The input matrix will be destroyed.
 
-Its uses Warshall's algorithm,
-which is
-$O(n^3)$ where the matrix is $n$x$n$.
+An earlier version used Warshall's algorithm,
+which is $O(n^3)$ where the matrix is $n$x$n$,
+and which tests every bit of the matrix even when
+the relation is sparse, as it almost always is here.
+This version first finds the strongly connected
+components of the relation,
+using an iterative version of Tarjan's algorithm,
+which is $O(n+e)$ where $e$ is the number of bits set.
+All the nodes in a strongly connected component
+have the same closure,
+so that it need only be computed once.
+
+Tarjan's algorithm finishes each strongly connected component
+after all the components it reaches,
+so that the rows of its successors outside the component
+are already final.
+The closure of the component is computed from them
+a word at a time, with |bv_or_assign()|.
+A successor which is already in the closure
+is skipped, because everything it reaches
+is already there.
+In the worst case, this is $O(e \cdot n/w)$,
+where $w$ is the number of bits in a word.
 @<Function definitions@> =
-PRIVATE_NOT_INLINE void transitive_closure(Bit_Matrix matrix)
+PRIVATE_NOT_INLINE void
+transitive_closure (MARPA_ALLOCATOR allocator, Bit_Matrix matrix)
+{
+  const int size = matrix_columns (matrix);
+  int *dfs_ix_by_node;
+  int *low_by_node;
+  int *scc_by_node;
+  int *scc_stack;
+  int *call_stack;
+  int *next_by_call;
+  int scc_stack_count = 0;
+  int next_dfs_ix = 0;
+  int scc_count = 0;
+  int root;
+  Bit_Vector closure;
+
+  if (size <= 0)
+    return;
+  dfs_ix_by_node = marpa_a_new (allocator, int, 6 * (size_t) size);
+  low_by_node = dfs_ix_by_node + size;
+  scc_by_node = low_by_node + size;
+  scc_stack = scc_by_node + size;
+  call_stack = scc_stack + size;
+  next_by_call = call_stack + size;
+  closure = bv_create (allocator, size);
+  for (root = 0; root < size; root++)
+    {
+      dfs_ix_by_node[root] = -1;
+      scc_by_node[root] = -1;
+    }
+
+  for (root = 0; root < size; root++)
+    {
+      int call_count = 0;
+      int new_node = root;
+      if (dfs_ix_by_node[root] >= 0)
+        continue;
+      @<Visit |new_node| in the closure search@>@;
+      while (call_count > 0)
+        {
+          const int node = call_stack[call_count - 1];
+          int successor;
+          int run_end;
+          if (bv_scan (matrix_row (matrix, node),
+                next_by_call[call_count - 1], &successor, &run_end))
+            {
+              next_by_call[call_count - 1] = successor + 1;
+              if (dfs_ix_by_node[successor] < 0)
+                {
+                  new_node = successor;
+                  @<Visit |new_node| in the closure search@>@;
+                  continue;
+                }
+              /* A successor still on the component stack
+                 is in the same component */
+              if (scc_by_node[successor] < 0
+                  && dfs_ix_by_node[successor] < low_by_node[node])
+                low_by_node[node] = dfs_ix_by_node[successor];
+              continue;
+            }
+          call_count--;
+          if (low_by_node[node] == dfs_ix_by_node[node])
+            {
+              @<Finish the strongly connected component of |node|@>@;
+            }
+          if (call_count > 0)
+            {
+              const int parent = call_stack[call_count - 1];
+              if (low_by_node[node] < low_by_node[parent])
+                low_by_node[parent] = low_by_node[node];
+            }
+        }
+    }
+
+  bv_free (allocator, closure);
+  marpa__a_free (allocator, dfs_ix_by_node);
+}
+
+@ @<Visit |new_node| in the closure search@> =
+{
+  dfs_ix_by_node[new_node] = low_by_node[new_node] = next_dfs_ix++;
+  scc_stack[scc_stack_count++] = new_node;
+  call_stack[call_count] = new_node;
+  next_by_call[call_count] = 0;
+  call_count++;
+}
+
+@ The members of the component are on top of the component stack,
+|node| being the deepest of them.
+First, the finished rows of the successors outside the component
+are merged into the closure.
+Second, the rows of the members, which are still those of the
+relation, are merged.
+These add the successors inside the component ---
+all the members, unless the component is a single node
+without a loop.
+Finally, the closure becomes the row of every member.
+@<Finish the strongly connected component of |node|@> =
 {
-  int size = matrix_columns (matrix);
-  int outer_row;
-  for (outer_row = 0; outer_row < size; outer_row++)
+  int base = scc_stack_count;
+  int member_ix;
+  do
+    {
+      base--;
+      scc_by_node[scc_stack[base]] = scc_count;
+    }
+  while (scc_stack[base] != node);
+  bv_clear (closure);
+  for (member_ix = base; member_ix < scc_stack_count; member_ix++)
     {
-      Bit_Vector outer_row_v = matrix_row (matrix, outer_row);
-      int column;
-      for (column = 0; column < size; column++)
+      int start, min, max;
+      const Bit_Vector member_row =
+        matrix_row (matrix, scc_stack[member_ix]);
+      for (start = 0; bv_scan (member_row, start, &min, &max);
+          start = max + 2)
         {
-          Bit_Vector inner_row_v = matrix_row (matrix, column);
-          if (bv_bit_test (inner_row_v, outer_row))
+          int next_node;
+          for (next_node = min; next_node <= max; next_node++)
             {
-              bv_or_assign (inner_row_v, outer_row_v);
+              if (scc_by_node[next_node] == scc_count)
+                continue;
+              if (bv_bit_test (closure, next_node))
+                continue;
+              bv_bit_set (closure, next_node);
+              bv_or_assign (closure, matrix_row (matrix, next_node));
             }
         }
     }
+  for (member_ix = base; member_ix < scc_stack_count; member_ix++)
+    {
+      bv_or_assign (closure, matrix_row (matrix, scc_stack[member_ix]));
+    }
+  for (member_ix = base; member_ix < scc_stack_count; member_ix++)
+    {
+      bv_copy (matrix_row (matrix, scc_stack[member_ix]), closure);
+    }
+  scc_stack_count = base;
+  scc_count++;
 }
 
 @** Efficient stacks and queues.
@@ -14969,10 +18693,13 @@ when compared to hand-written code.
 |libmarpa| uses stacks and worklists extensively.
 Often a reasonable maximum size is known when they are
 set up, in which case they can be made very fast.
-@d FSTACK_DECLARE(stack, type) struct { int t_count; type* t_base; } stack;
+Like a dstack, a fixed size stack keeps a copy of its allocator.
+@d FSTACK_DECLARE(stack, type) struct { int t_count; type* t_base;
+    struct marpa_allocator_s t_allocator; } stack;
 @d FSTACK_CLEAR(stack) ((stack).t_count = 0)
-@d FSTACK_INIT(stack, type, n) (FSTACK_CLEAR(stack),
-    ((stack).t_base = marpa_new(type, n)))
+@d FSTACK_INIT(stack, type, n, allocator) (FSTACK_CLEAR(stack),
+    ((stack).t_allocator = *(allocator)),
+    ((stack).t_base = marpa_a_new(&(stack).t_allocator, type, n)))
 @d FSTACK_SAFE(stack) ((stack).t_base = NULL)
 @d FSTACK_BASE(stack, type) ((type *)(stack).t_base)
 @d FSTACK_INDEX(this, type, ix) (FSTACK_BASE((this), type)+(ix))
@@ -14983,7 +18710,7 @@ set up, in which case they can be made very fast.
 @d FSTACK_PUSH(stack) ((stack).t_base+stack.t_count++)
 @d FSTACK_POP(stack) ((stack).t_count <= 0 ? NULL : (stack).t_base+(--(stack).t_count))
 @d FSTACK_IS_INITIALIZED(stack) ((stack).t_base)
-@d FSTACK_DESTROY(stack) (my_free((stack).t_base))
+@d FSTACK_DESTROY(stack) (marpa__a_free(&(stack).t_allocator, (stack).t_base))
 
 @*0 Dynamic queues.
 This is simply a dynamic stack extended with a second
@@ -14995,8 +18722,8 @@ Instead I define a destructor for the ``thief" container to use
 when it needs to free the data.
 
 @d DQUEUE_DECLARE(this) struct s_dqueue this
-@d DQUEUE_INIT(this, type, initial_size)
-    ((this.t_current=0), MARPA_DSTACK_INIT(this.t_stack, type, initial_size))
+@d DQUEUE_INIT(this, type, initial_size, allocator)
+    ((this.t_current=0), MARPA_DSTACK_INIT(this.t_stack, type, initial_size, (allocator)))
 @d DQUEUE_PUSH(this, type) MARPA_DSTACK_PUSH(this.t_stack, type)
 @d DQUEUE_POP(this, type) MARPA_DSTACK_POP(this.t_stack, type)
 @d DQUEUE_NEXT(this, type) (this.t_current >= MARPA_DSTACK_LENGTH(this.t_stack)
@@ -15004,7 +18731,7 @@ when it needs to free the data.
     : (MARPA_DSTACK_BASE(this.t_stack, type))+this.t_current++)
 @d DQUEUE_BASE(this, type) MARPA_DSTACK_BASE(this.t_stack, type)
 @d DQUEUE_END(this) MARPA_DSTACK_LENGTH(this.t_stack)
-@d STOLEN_DQUEUE_DATA_FREE(data) MARPA_STOLEN_DSTACK_DATA_FREE(data)
+@d STOLEN_DQUEUE_DATA_FREE(allocator, data) MARPA_STOLEN_DSTACK_DATA_FREE(allocator, data)
 
 @<Private incomplete structures@> =
 struct s_dqueue;
@@ -15073,11 +18800,11 @@ Once things settle, |MARPA_DSTACK_INIT| should be changed to
 @d CAPACITY_OF_CILAR(cilar) (CAPACITY_OF_DSTACK(cilar->t_buffer)-1)
 @<Function definitions@> =
 PRIVATE void
-cilar_init (const CILAR cilar)
+cilar_init (const CILAR cilar, MARPA_ALLOCATOR allocator)
 {
-  cilar->t_obs = marpa_obs_init;
-  cilar->t_avl = _marpa_avl_create (cil_cmp, NULL);
-  MARPA_DSTACK_INIT(cilar->t_buffer, int, 2);
+  cilar->t_obs = marpa_obs_init(allocator);
+  cilar->t_avl = _marpa_avl_create (cil_cmp, NULL, allocator);
+  MARPA_DSTACK_INIT(cilar->t_buffer, int, 2, allocator);
   *MARPA_DSTACK_INDEX(cilar->t_buffer, int, 0) = 0;
 }
 @
@@ -15089,8 +18816,9 @@ Once things settle, |MARPA_DSTACK_INIT| should be changed to
 PRIVATE void
 cilar_buffer_reinit (const CILAR cilar)
 {
+  struct marpa_allocator_s allocator = cilar->t_buffer.t_allocator;
   MARPA_DSTACK_DESTROY(cilar->t_buffer);
-  MARPA_DSTACK_INIT(cilar->t_buffer, int, 2);
+  MARPA_DSTACK_INIT(cilar->t_buffer, int, 2, &allocator);
   *MARPA_DSTACK_INDEX(cilar->t_buffer, int, 0) = 0;
 }
 
@@ -15431,6 +19159,7 @@ struct s_per_earley_set_arena {
       int t_psl_length;
       PSL t_first_psl;
       PSL t_first_free_psl;
+      struct marpa_allocator_s t_allocator;
 };
 typedef struct s_per_earley_set_arena PSAR_Object;
 @ @d Dot_PSAR_of_R(r) (&(r)->t_dot_psar_object)
@@ -15441,7 +19170,7 @@ PSAR_Object t_dot_psar_object;
   if (G_is_Trivial(g)) {
     psar_safe(Dot_PSAR_of_R(r));
   } else {
-    psar_init(Dot_PSAR_of_R(r), AHM_Count_of_G (g));
+    psar_init(Dot_PSAR_of_R(r), AHM_Count_of_G (g), Allocator_of_G(g));
   }
 }
 @ @<Destroy recognizer elements@> =
@@ -15460,9 +19189,10 @@ psar_safe (const PSAR psar)
 }
 @ @<Function definitions@> =
 PRIVATE void
-psar_init (const PSAR psar, int length)
+psar_init (const PSAR psar, int length, MARPA_ALLOCATOR allocator)
 {
   psar->t_psl_length = length;
+  psar->t_allocator = *allocator;
   psar->t_first_psl = psar->t_first_free_psl = psl_new (psar);
 }
 @ @<Function definitions@> =
@@ -15475,7 +19205,7 @@ PRIVATE void psar_destroy(const PSAR psar)
         PSL *owner = psl->t_owner;
         if (owner)
           *owner = NULL;
-        my_free ( psl);
+        marpa__a_free (&psar->t_allocator, psl);
         psl = next_psl;
       }
 }
@@ -15483,7 +19213,7 @@ PRIVATE void psar_destroy(const PSAR psar)
 PRIVATE PSL psl_new(const PSAR psar)
 {
      int i;
-     PSL new_psl = my_malloc(Sizeof_PSL(psar));
+     PSL new_psl = marpa__a_malloc(&psar->t_allocator, Sizeof_PSL(psar));
      new_psl->t_next = NULL;
      new_psl->t_prev = NULL;
      new_psl->t_owner = NULL;
@@ -15524,6 +19254,27 @@ PRIVATE void psar_reset(const PSAR psar)
     psar_dealloc(psar);
 }
 
+@ A PSAR clear nulls out the data in all the PSL's,
+including the ones which are not currently owned,
+and then deallocates them.
+Stale-detection logic
+compares the data with the current earleme,
+and cannot be trusted once the earlemes start
+over again, as they do after a recognizer reset.
+@<Function definitions@> =
+PRIVATE void psar_clear(const PSAR psar)
+{
+    PSL psl = psar->t_first_psl;
+    while (psl) {
+        int i;
+        for (i = 0; i < psar->t_psl_length; i++) {
+            PSL_Datum(psl, i) = NULL;
+        }
+        psl = psl->t_next;
+    }
+    psar_dealloc(psar);
+}
+
 @ A PSAR dealloc removes an owner's claim to the all of
 its PSLs,
 and puts them back on the free list.
@@ -15627,6 +19378,11 @@ both the soft and hard failure indicator.
 @ Routines returning integer value use |-2| as the
 general failure indicator.
 @<Return |-2| on failure@> = const int failure_indicator = -2;
+@ Routines returning a size in bytes use |-2|, converted to |size_t|,
+as the failure indicator.
+No object is that large.
+@<Return |(size_t)-2| on failure@> =
+const size_t failure_indicator = (size_t)-2;
 
 @*0 Grammar failures.
 |g| is assumed to be the value of the relevant grammar,
@@ -15884,6 +19640,234 @@ extern void* (* const marpa__out_of_memory)(void);
 @ @<Public typedefs@> =
 typedef const char* Marpa_Message_ID;
 
+@*0 Memory accounting.
+The memory of grammars, recognizers and bocages is counted,
+so that applications can watch it,
+and so that a recognizer can be given a memory limit.
+The count is of the bytes obtained from |malloc()|
+for an object's obstacks, its dynamic stacks,
+and its larger arrays.
+Small fixed-size allocations, and |malloc()|'s own overhead,
+are not counted.
+Chunks and stack space kept for reuse are counted,
+because they are still allocated.
+The free chunks in the grammar's chunk cache are counted
+as part of the grammar.
+@d DSTACK_Bytes(stack, type)
+  ((size_t)MARPA_DSTACK_CAPACITY(stack) * sizeof(type))
+@<Function definitions@> =
+size_t
+marpa_g_memory_usage (Marpa_Grammar g)
+{
+  @<Return |(size_t)-2| on failure@>@;
+  @<Fail if fatal error@>@;
+  return marpa_obs_allocated (g->t_obs)
+    + marpa_obs_allocated (g->t_xrl_obs)
+    + marpa_obs_cache_allocated (Chunk_Cache_of_G (g))
+    + marpa_obs_allocated (g->t_cilar.t_obs)
+    + DSTACK_Bytes (g->t_cilar.t_buffer, int)
+    + DSTACK_Bytes (g->t_xsy_stack, XSY)
+    + DSTACK_Bytes (g->t_nsy_stack, NSY)
+    + DSTACK_Bytes (g->t_xrl_stack, XRL)
+    + DSTACK_Bytes (g->t_irl_stack, IRL)
+    + DSTACK_Bytes (g->t_events, GEV_Object)
+    + DSTACK_Bytes (g->t_gzwa_stack, GZWA)
+    + (size_t) AHM_Count_of_G (g) * sizeof (struct s_ahm);
+}
+
+@ The Earley sets of a forgetful recognizer are
+in their own batches, each with its own obstack.
+@<Function definitions@> =
+PRIVATE size_t
+recce_memory_usage (RECCE r)
+{
+  YS_BATCH batch;
+  size_t bytes = marpa_obs_allocated (r->t_obs)
+    + DSTACK_Bytes (r->t_irl_cil_stack, CIL)
+    + DSTACK_Bytes (r->t_alternatives, ALT_Object)
+    + DSTACK_Bytes (r->t_checkpoints, CHECKPOINT_Object)
+    + DSTACK_Bytes (r->t_yim_work_stack, YIM)
+    + DSTACK_Bytes (r->t_completion_stack, YIM)
+    + DSTACK_Bytes (r->t_earley_set_stack, YS);
+  for (batch = r->t_first_ys_batch; batch; batch = batch->t_next)
+    {
+      bytes += marpa_obs_allocated (batch->t_obs);
+    }
+  return bytes;
+}
+
+@ @<Function definitions@> =
+size_t
+marpa_r_memory_usage (Marpa_Recognizer r)
+{
+  @<Return |(size_t)-2| on failure@>@;
+  @<Unpack recognizer objects@>@;
+  @<Fail if fatal error@>@;
+  return recce_memory_usage (r);
+}
+
+@ @<Function definitions@> =
+PRIVATE size_t
+bocage_memory_usage (BOCAGE b)
+{
+  return marpa_obs_allocated (OBS_of_B (b))
+    + (size_t) OR_Capacity_of_B (b) * sizeof (OR)
+    + (size_t) AND_Count_of_B (b) * sizeof (AND_Object);
+}
+
+@ @<Function definitions@> =
+size_t
+marpa_b_memory_usage (Marpa_Bocage b)
+{
+  @<Return |(size_t)-2| on failure@>@;
+  @<Unpack bocage objects@>@;
+  @<Fail if fatal error@>@;
+  return bocage_memory_usage (b);
+}
+
+@*0 The recognizer memory limit.
+A recognizer may be given a limit, in bytes,
+on its memory.
+The limit exists so that applications can accept
+untrusted input for highly ambiguous grammars
+without risking the exhaustion of memory.
+A limit of zero means there is no limit,
+and is the default.
+@ The limit is checked at the start of
+|marpa_r_earleme_complete|,
+then after every |MEMORY_CHECK_INTERVAL| scans and completions
+while the new Earley set is being built,
+and once more before its predictions are added.
+If a check fails,
+the incomplete Earley set is undone,
+so that the recognizer is left as it was when
+|marpa_r_earleme_complete| was called.
+It is consistent,
+and can still be evaluated at an earlier Earley set.
+The limit may be exceeded by the memory allocated
+between two checks,
+and by the memory of the predictions and postdot items
+of one Earley set,
+which is bounded by the size of the grammar.
+@d MEMORY_CHECK_INTERVAL 256
+@d Memory_Limit_of_R(r) ((r)->t_memory_limit)
+@<Widely aligned recognizer elements@> = size_t t_memory_limit;
+@ @<Initialize recognizer elements@> = Memory_Limit_of_R(r) = 0;
+@ @<Function definitions@> =
+size_t
+marpa_r_memory_limit (Marpa_Recognizer r)
+{
+  @<Return |(size_t)-2| on failure@>@;
+  @<Unpack recognizer objects@>@;
+  @<Fail if fatal error@>@;
+  return Memory_Limit_of_R(r);
+}
+
+@ Returns the new limit.
+@<Function definitions@> =
+size_t
+marpa_r_memory_limit_set (Marpa_Recognizer r, size_t limit)
+{
+  @<Return |(size_t)-2| on failure@>@;
+  @<Unpack recognizer objects@>@;
+  @<Fail if fatal error@>@;
+  Memory_Limit_of_R(r) = limit;
+  return limit;
+}
+
+@ |extra| is memory allocated on behalf of the recognizer,
+but not yet owned by it ---
+a bocage under construction, for example.
+@<Function definitions@> =
+PRIVATE int
+memory_limit_is_exceeded (RECCE r, size_t extra)
+{
+  const size_t limit = Memory_Limit_of_R (r);
+  if (limit == 0)
+    return 0;
+  return recce_memory_usage (r) + extra > limit;
+}
+
+@ The Earley set under construction,
+and everything in it,
+is on the obstack of the Earley sets.
+It is undone by rewinding that obstack to a mark taken
+when |marpa_r_earleme_complete| was called,
+and by restoring the few other things that
+|marpa_r_earleme_complete| has changed by then.
+The obstack keeps the chunks it is rewound past,
+for reuse,
+and those are freed,
+so that the recognizer's memory is really given back.
+In a forgetful recognizer,
+the Earley set under construction may have started a new batch,
+in which case it is the batch that is freed.
+@<Declare the memory limit locals of |marpa_r_earleme_complete|@> =
+    const YS entry_latest_ys = Latest_YS_of_R (r);
+    const JEARLEME entry_earleme = Current_Earleme_of_R (r);
+    const int entry_alternative_count =
+      MARPA_DSTACK_LENGTH (r->t_alternatives);
+    const YS_BATCH entry_ys_batch = r->t_latest_ys_batch;
+    struct marpa_obstack *const entry_ys_obs = YS_Obs_of_R (r);
+    struct marpa_obstack_mark entry_mark;
+    int memory_check_count = 0;
+
+@ @<Check the memory limit, every so often@> =
+{
+  if (_MARPA_UNLIKELY (++memory_check_count >= MEMORY_CHECK_INTERVAL))
+    {
+      memory_check_count = 0;
+      if (memory_limit_is_exceeded (r, 0))
+        goto MEMORY_LIMIT_EXCEEDED;
+    }
+}
+
+@ The alternatives scanned into the Earley set
+are still on the alternatives stack,
+below its top, and are restored by restoring its length.
+The work stacks may have grown large,
+so they are replaced with new stacks of the initial size.
+@<Undo the incomplete Earley set@> =
+{
+  @t}\comment{@>
+  /* The PSLs have back pointers into the Earley sets,
+  so they must be released before the obstack is rewound */
+  psar_clear (Dot_PSAR_of_R (r));
+  Next_YS_of_YS (entry_latest_ys) = NULL;
+  Latest_YS_of_R (r) = entry_latest_ys;
+  YS_Count_of_R (r) = Ord_of_YS (entry_latest_ys) + 1;
+  Current_Earleme_of_R (r) = entry_earleme;
+  MARPA_DSTACK_COUNT_SET (r->t_alternatives, entry_alternative_count);
+  if (MARPA_DSTACK_LENGTH (r->t_earley_set_stack) > YS_Count_of_R (r))
+    {
+      MARPA_DSTACK_COUNT_SET (r->t_earley_set_stack, YS_Count_of_R (r));
+    }
+  if (r->t_latest_ys_batch != entry_ys_batch)
+    {
+      marpa_obs_free (YS_Obs_of_R (r));
+      if (entry_ys_batch)
+        {
+          entry_ys_batch->t_next = NULL;
+        }
+      else
+        {
+          r->t_first_ys_batch = NULL;
+        }
+      r->t_latest_ys_batch = entry_ys_batch;
+      YS_Obs_of_R (r) = entry_ys_obs;
+      YS_Batch_is_Closed (r) = 1;
+    }
+  else
+    {
+      marpa_obs_rewind (YS_Obs_of_R (r), &entry_mark);
+      marpa_obs_spares_free (YS_Obs_of_R (r));
+    }
+  MARPA_DSTACK_DESTROY (r->t_yim_work_stack);
+  MARPA_DSTACK_INIT2 (r->t_yim_work_stack, YIM, Allocator_of_G (g));
+  MARPA_DSTACK_DESTROY (r->t_completion_stack);
+  MARPA_DSTACK_INIT2 (r->t_completion_stack, YIM, Allocator_of_G (g));
+}
+
 @** Trace functions.
 
 The ``trace '' functions were designed for just that --
@@ -15949,7 +19933,12 @@ Marpa_Earleme marpa_r_earleme(Marpa_Recognizer r, Marpa_Earley_Set_ID set_id)
         MARPA_ERROR(MARPA_ERR_NO_EARLEY_SET_AT_LOCATION);
         return failure_indicator;
       }
-    earley_set = YS_of_R_by_Ord (r, set_id);
+    earley_set = ys_of_r_by_ord (r, set_id);
+    if (_MARPA_UNLIKELY(!earley_set))
+      {
+        MARPA_ERROR(MARPA_ERR_EARLEY_SET_FORGOTTEN);
+        return failure_indicator;
+      }
     return Earleme_of_YS (earley_set);
 }
 
@@ -15970,7 +19959,12 @@ int _marpa_r_earley_set_size(Marpa_Recognizer r, Marpa_Earley_Set_ID set_id)
         MARPA_ERROR(MARPA_ERR_INVALID_LOCATION);
         return failure_indicator;
       }
-    earley_set = YS_of_R_by_Ord (r, set_id);
+    earley_set = ys_of_r_by_ord (r, set_id);
+    if (_MARPA_UNLIKELY(!earley_set))
+      {
+        MARPA_ERROR(MARPA_ERR_EARLEY_SET_FORGOTTEN);
+        return failure_indicator;
+      }
     return YIM_Count_of_YS (earley_set);
 }
 
@@ -16027,11 +20021,16 @@ _marpa_r_earley_set_trace (Marpa_Recognizer r, Marpa_Earley_Set_ID set_id)
         return failure_indicator;
     }
   r_update_earley_sets (r);
-    if (set_id >= MARPA_DSTACK_LENGTH (r->t_earley_set_stack))
+    if (!YS_Ord_is_Valid (r, set_id))
       {
         return es_does_not_exist;
       }
-    earley_set = YS_of_R_by_Ord (r, set_id);
+    earley_set = ys_of_r_by_ord (r, set_id);
+    if (_MARPA_UNLIKELY(!earley_set))
+      {
+        MARPA_ERROR(MARPA_ERR_EARLEY_SET_FORGOTTEN);
+        return failure_indicator;
+      }
   r->t_trace_earley_set = earley_set;
   return Earleme_of_YS(earley_set);
 }
@@ -16350,6 +20349,7 @@ Marpa_Symbol_ID _marpa_r_first_token_link_trace(Marpa_Recognizer r)
   @<Unpack recognizer objects@>@;
     @<Fail if not trace-safe@>@;
     @<Set |item|, failing if necessary@>@;
+    @<Fail if recognizer is link-free@>@;
     source_type = Source_Type_of_YIM (item);
     switch (source_type)
       {
@@ -16422,6 +20422,7 @@ Marpa_Symbol_ID _marpa_r_first_completion_link_trace(Marpa_Recognizer r)
   @<Unpack recognizer objects@>@;
     @<Fail if not trace-safe@>@;
     @<Set |item|, failing if necessary@>@;
+    @<Fail if recognizer is link-free@>@;
     switch ((source_type = Source_Type_of_YIM (item)))
       {
       case SOURCE_IS_COMPLETION:
@@ -16571,6 +20572,9 @@ AHMID _marpa_r_source_predecessor_state(Marpa_Recognizer r)
     @<Fail if not trace-safe@>@/
    source_type = r->t_trace_source_type;
     @<Set source link, failing if necessary@>@/
+    if (source_type == SOURCE_IS_TOKEN) {
+      @<Fail if recognizer is forgetful@>@;
+    }
     switch (source_type)
     {
     case SOURCE_IS_TOKEN:
@@ -16688,6 +20692,9 @@ Marpa_Earley_Set_ID _marpa_r_source_middle(Marpa_Recognizer r)
    source_type = r->t_trace_source_type;
     @<Set source link, failing if necessary@>@/
 
+  if (source_type == SOURCE_IS_TOKEN) {
+    @<Fail if recognizer is forgetful@>@;
+  }
   switch (source_type)
     {
     case SOURCE_IS_LEO:
@@ -17314,8 +21321,13 @@ So I add such a comment.
 #define MARPA_DEBUG 0
 #endif
 
+#ifndef MARPA_COMPACT_YIM
+#define MARPA_COMPACT_YIM 0
+#endif
+
 #include "marpa.h"
 #include "marpa_ami.h"
+#include <time.h>
 @h
 #include "marpa_obs.h"
 #include "marpa_avl.h"
@@ -150,6 +150,12 @@ MARPA_ERR_HEADERS_DO_NOT_MATCH
 MARPA_ERR_NOT_A_SEQUENCE
 MARPA_ERR_GRAMMAR_IS_TRIVIAL
 MARPA_ERR_BASE_GENERATION_MISMATCH
+MARPA_ERR_EARLEY_SET_FORGOTTEN
+MARPA_ERR_RECCE_IS_FORGETFUL
+MARPA_ERR_RECCE_IS_LINK_FREE
+MARPA_ERR_NO_SUCH_CHECKPOINT
+MARPA_ERR_INVALID_IMAGE
+MARPA_ERR_MEMORY_LIMIT
 );
 
 my %error_number = map { $error_codes[$_], $_ } (0 .. $#error_codes);
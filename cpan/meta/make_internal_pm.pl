@@ -212,6 +212,8 @@ __DATA__
     CLOSURE_BY_SYMBOL_ID
     CLOSURE_BY_RULE_ID
 
+    CACHE_DIR { Directory of the compiled grammar cache }
+
     :package=Marpa::R3::Internal_R
 
     SLG
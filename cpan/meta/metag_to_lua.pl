@@ -0,0 +1,72 @@
+# Copyright 2017 Jeffrey Kegler
+# Marpa::R3 is Copyright (C) 2017, Jeffrey Kegler.
+#
+# This module is free software; you can redistribute it and/or modify it
+# under the same terms as Perl 5.10.1. For more details, see the full text
+# of the licenses in the directory LICENSES.
+#
+# This program is distributed in the hope that it will be
+# useful, but it is provided "as is" and without any express
+# or implied warranties. For details, see the full text of
+# of the licenses in the directory LICENSES.
+
+# Writes the hashed metagrammar in Marpa::R3::MetaG as a Lua chunk,
+# which returns it as a table.
+# The chunk is compiled to Lua bytecode and linked into R3.so,
+# so that the metagrammar can be built without first compiling
+# MetaG.pm and passing its hash from Perl to Lua.
+
+use 5.010001;
+use strict;
+use warnings;
+use English qw( -no_match_vars );
+use File::Spec;
+
+my ($metag_pm) = @ARGV;
+die "usage: $PROGRAM_NAME MetaG.pm\n" if not defined $metag_pm;
+require File::Spec->rel2abs($metag_pm);
+
+my $hashed_metag = Marpa::R3::Internal::MetaG::hashed_grammar();
+
+print <<'END_OF_HEADER';
+-- EDITS IN THIS FILE WILL BE LOST
+-- This file is auto-generated by metag_to_lua.pl,
+-- from the hashed metagrammar in MetaG.pm
+
+END_OF_HEADER
+print 'return ', to_lua( $hashed_metag, q{} ), "\n";
+
+# All scalars are written as Lua strings, as they would be
+# if the hash were passed from Perl with signature 's'.
+sub to_lua {
+    my ( $value, $indent ) = @_;
+    return 'nil' if not defined $value;
+    my $ref_type = ref $value;
+    return lua_string($value) if not $ref_type;
+    my $inner_indent = $indent . q{  };
+    my @items;
+    if ( $ref_type eq 'ARRAY' ) {
+        @items = map { to_lua( $_, $inner_indent ) } @{$value};
+    }
+    elsif ( $ref_type eq 'HASH' ) {
+        @items = map {
+            '[' . lua_string($_) . '] = ' . to_lua( $value->{$_}, $inner_indent )
+        } sort keys %{$value};
+    }
+    else {
+        die "Cannot write $ref_type in the hashed metagrammar as Lua\n";
+    }
+    return '{}' if not @items;
+    return join q{}, "{\n",
+      ( map { $inner_indent . $_ . ",\n" } @items ), $indent, '}';
+} ## end sub to_lua
+
+sub lua_string {
+    my ($string) = @_;
+    utf8::encode($string);
+    $string =~ s/([\\"])/\\$1/gxms;
+    $string =~ s/([^\x20-\x7e])/sprintf '\\%03d', ord $1/egxms;
+    return qq{"$string"};
+}
+
+# vim: expandtab shiftwidth=4:
@@ -0,0 +1,178 @@
+#!perl
+# Marpa::R3 is Copyright (C) 2017, Jeffrey Kegler.
+#
+# This module is free software; you can redistribute it and/or modify it
+# under the same terms as Perl 5.10.1. For more details, see the full text
+# of the licenses in the directory LICENSES.
+#
+# This program is distributed in the hope that it will be
+# useful, but it is provided "as is" and without any express
+# or implied warranties. For details, see the full text of
+# of the licenses in the directory LICENSES.
+
+# Tests of lexeme_read_batch()
+
+use 5.010001;
+
+use strict;
+use warnings;
+
+use Test::More tests => 9;
+use English qw( -no_match_vars );
+use lib 'inc';
+use Marpa::R3::Test;
+use Marpa::R3;
+
+my $dsl = <<'END_OF_DSL';
+:default ::= action => [values]
+pairs ::= pair+
+pair ::= key eq value
+
+event pair = completed pair
+
+eq ~ '='
+key ~ [a-z]+
+value ~ [a-z0-9]+
+END_OF_DSL
+
+my $grammar = Marpa::R3::Grammar->new( { source => \$dsl } );
+
+# Marpa::R3::Display
+# name: SLG symbol_by_name() synopsis
+
+    my $number_id = $grammar->symbol_by_name('Number');
+
+# Marpa::R3::Display::End
+
+Test::More::is( $number_id, undef, 'symbol_by_name() of missing symbol' );
+
+my $key_id   = $grammar->symbol_by_name('key');
+my $value_id = $grammar->symbol_by_name('value');
+my $eq_id    = $grammar->symbol_by_name('eq');
+
+my $input = 'a=1b=xyz';
+
+# Key and value are both tried at each word,
+# so that every word is read as an ambiguous token
+my @tokens = (
+    $key_id,   -1, 0, 1,
+    $value_id, -1, 0, 1,
+    $eq_id,    -1, 1, 1,
+    $key_id,   0,  2, 1,
+    $value_id, 0,  2, 1,
+    $key_id,   -1, 3, 1,
+    $value_id, -1, 3, 1,
+    $eq_id,    -1, 4, 1,
+    $key_id,   1,  5, 3,
+    $value_id, 1,  5, 3,
+);
+my @values = ( 'one', 'XYZ' );
+
+sub new_recce {
+    my ($events) = @_;
+    my $recce = Marpa::R3::Recognizer->new(
+        {
+            grammar        => $grammar,
+            event_handlers => {
+                pair => sub () {
+                    my ($recce) = @_;
+                    push @{$events}, $recce->g1_pos();
+                    'ok';
+                }
+            },
+        }
+    );
+    $recce->read( \$input, 0, 0 );
+    return $recce;
+}
+
+my $expected_value =
+  [ [ 'a', '=', 'one' ], [ 'b', '=', 'XYZ' ] ];
+
+{
+    my @events = ();
+    my $recce  = new_recce( \@events );
+    my $main_block;
+    ($main_block) = $recce->block_progress();
+    my $count = 0;
+    while ( $count < scalar @tokens / 4 ) {
+        my @rest = @tokens[ $count * 4 .. $#tokens ];
+        $count += $recce->lexeme_read_batch( \@rest, \@values, $main_block );
+    }
+    Test::More::is_deeply( \@events, [ 3, 6 ], 'batch stops at events' );
+    Test::More::is_deeply( ${ $recce->value() }, $expected_value,
+        'value of array ref batch' );
+}
+
+{
+    my @events = ();
+    my $recce  = new_recce( \@events );
+    my $packed = pack 'l*', @tokens;
+    my $first  = $recce->lexeme_read_batch( $packed, \@values );
+    my $second =
+      $recce->lexeme_read_batch( ( substr $packed, $first * 16 ), \@values );
+    Test::More::is_deeply( [ $first, $second ], [ 5, 5 ],
+        'counts of packed batch' );
+    Test::More::is_deeply( ${ $recce->value() }, $expected_value,
+        'value of packed batch' );
+}
+
+sub read_or_die {
+    my ( $recce, @tokens ) = @_;
+    my ($main_block) = $recce->block_progress();
+
+# Marpa::R3::Display
+# name: recognizer lexeme_read_batch() synopsis
+# normalize-whitespace: 1
+
+    my $count = $recce->lexeme_read_batch( \@tokens, \@values, $main_block );
+    if ( $count < scalar @tokens / 4 ) {
+        my ( $symbol_id, $value_ix, $offset, $length ) =
+          @tokens[ $count * 4 .. $count * 4 + 3 ];
+        die qq{Batch stopped at entry $count, before "},
+          $recce->literal( $main_block, $offset, $length ), q{"};
+    }
+
+# Marpa::R3::Display::End
+
+    return $count;
+}
+
+{
+    my $recce   = new_recce( [] );
+    my $eval_ok = eval {
+        read_or_die( $recce, @tokens[ 0 .. 11 ], $eq_id, -1, 2, 1,
+            $key_id, -1, 3, 1 );
+        1;
+    };
+    Test::More::like( ( $eval_ok ? 'no error' : $EVAL_ERROR ),
+        qr/\ABatch\s+stopped\s+at\s+entry\s+3,\s+before\s+"1"/xms,
+        'batch stops before rejected token' );
+}
+
+{
+    my $recce   = new_recce( [] );
+    my $eval_ok = eval {
+        $recce->lexeme_read_batch( [ $key_id, -1, 0, 1, $eq_id ] );
+        1;
+    };
+    Test::More::like( ( $eval_ok ? 'no error' : $EVAL_ERROR ),
+        qr/tokens\s+must\s+be\s+a\s+multiple\s+of\s+4\s+integers/xms,
+        'incomplete batch entry' );
+    $eval_ok = eval {
+        $recce->lexeme_read_batch( pack 'l*', $key_id, -1, 0, 1, $eq_id );
+        1;
+    };
+    Test::More::like( ( $eval_ok ? 'no error' : $EVAL_ERROR ),
+        qr/tokens\s+must\s+be\s+a\s+multiple\s+of\s+4\s+integers/xms,
+        'incomplete packed batch entry' );
+    $eval_ok = eval {
+        $recce->lexeme_read_batch( [ $key_id, 0, 0, 1 ], [] );
+        1;
+    };
+    Test::More::like( ( $eval_ok ? 'no error' : $EVAL_ERROR ),
+        qr/entry\s+0:\s+no\s+value\s+at\s+index\s+0/xms,
+        'batch entry with missing value' );
+}
+
+# vim: expandtab shiftwidth=4:
@@ -0,0 +1,200 @@
+#!perl
+# Marpa::R3 is Copyright (C) 2017, Jeffrey Kegler.
+#
+# This module is free software; you can redistribute it and/or modify it
+# under the same terms as Perl 5.10.1. For more details, see the full text
+# of the licenses in the directory LICENSES.
+#
+# This program is distributed in the hope that it will be
+# useful, but it is provided "as is" and without any express
+# or implied warranties. For details, see the full text of
+# of the licenses in the directory LICENSES.
+
+# Tests of checkpoints and rollback.
+# An input is read, taking checkpoints in an event handler,
+# then the recognizer is rolled back and reads an edited input.
+# The results are compared with a parse of the edited input
+# from the beginning.
+
+use 5.010001;
+
+use strict;
+use warnings;
+
+use Test::More tests => 13;
+use English qw( -no_match_vars );
+use lib 'inc';
+use Marpa::R3::Test;
+use Marpa::R3;
+
+my $grammar = Marpa::R3::Grammar->new(
+    {
+        source => \<<'END_OF_DSL',
+:default ::= action => [values]
+text ::= <text segment>*
+<text segment> ::= subtext
+<text segment> ::= <word>
+subtext ::= '(' text ')'
+subtext ::= '[' list
+list ::= word ']'
+list ::= word list
+
+event subtext = completed <subtext>
+
+word ~ [\w]+
+:discard ~ whitespace
+whitespace ~ [\s]+
+END_OF_DSL
+    }
+);
+
+my $prefix = join q{ }, map { "w$_ v$_ (x$_ (y$_ u$_) z)" } 1 .. 20;
+my $input  = $prefix . ' a b (c (d e) f) [1 2 3] end';
+my $edited = $prefix . ' [p q] r (s (t u v) w) end';
+
+my @checkpoints;
+my @events;
+
+sub new_recce {
+    my (@args) = @_;
+    return Marpa::R3::Recognizer->new(
+        {
+            grammar        => $grammar,
+            event_handlers => {
+                subtext => sub () {
+                    my ($recce) = @_;
+                    my ( $start, $length ) = $recce->last_completed('subtext');
+                    push @events, $recce->g1_literal( $start, $length );
+                    my ( undef, $offset ) = $recce->block_progress();
+                    push @checkpoints,
+                      [ $recce->checkpoint(), $offset, scalar @events ];
+                    'ok';
+                }
+            },
+            @args
+        }
+    );
+}
+
+sub read_all {
+    my ( $recce, $p_string, $pos ) = @_;
+    my $length = length ${$p_string};
+    $pos = $recce->resume($pos) if defined $pos;
+    $pos = $recce->read($p_string) if not defined $pos;
+    while ( $pos < $length ) {
+        $pos = $recce->resume($pos);
+    }
+    return;
+}
+
+sub summary {
+    my ($recce) = @_;
+    return [
+        $recce->g1_pos(),
+        [ $recce->last_completed('text') ],
+        [ map { $recce->progress($_) } 0 .. $recce->g1_pos() ],
+        $recce->value(),
+    ];
+}
+
+@events = ();
+my $full_recce = new_recce();
+read_all( $full_recce, \$edited );
+my $full_summary = summary($full_recce);
+my @full_events  = @events;
+
+@events      = ();
+@checkpoints = ();
+my $recce = new_recce();
+read_all( $recce, \$input );
+my $input_summary = summary($recce);
+
+# The latest checkpoint within the unchanged prefix
+my ($checkpoint) = grep { $_->[1] <= length $prefix } reverse @checkpoints;
+my ( $g1_loc, $offset, $event_count ) = @{$checkpoint};
+Test::More::ok( $offset > length($prefix) / 2, 'checkpoint in prefix' );
+
+Test::More::is( $recce->rollback($g1_loc), $g1_loc, 'rollback() return value' );
+Test::More::is( $recce->g1_pos(), $g1_loc, 'G1 location after rollback' );
+
+$#events = $event_count - 1;
+my $edited_block = $recce->block_new( \$edited );
+$recce->block_set($edited_block);
+read_all( $recce, \$edited, $offset );
+Test::More::is_deeply( \@events, \@full_events, 'events after rollback' );
+Test::More::is_deeply( summary($recce), $full_summary,
+    'edited parse after rollback' );
+
+# Roll back to the same checkpoint again, and re-read the original input
+$recce->rollback($g1_loc);
+$#events = $event_count - 1;
+read_all( $recce, \$input, $offset );
+Test::More::is_deeply( summary($recce), $input_summary,
+    'original parse after second rollback' );
+
+{
+    my $eval_ok = eval { $recce->rollback( $g1_loc + 1 ); 1 };
+    Test::More::like( ( $eval_ok ? 'no error' : $EVAL_ERROR ),
+        qr/no\s+checkpoint\s+at\s+G1\s+location/xms,
+        'rollback() without checkpoint' );
+}
+
+{
+    # Checkpoints after the G1 location of a rollback are discarded
+    my ($later) = grep { $_->[0] > $g1_loc } @checkpoints;
+    $recce->rollback($g1_loc);
+    my $eval_ok = eval { $recce->rollback( $later->[0] ); 1 };
+    Test::More::like( ( $eval_ok ? 'no error' : $EVAL_ERROR ),
+        qr/no\s+checkpoint\s+at\s+G1\s+location/xms,
+        'later checkpoint discarded by rollback' );
+}
+
+{
+    # Roll back to the start of the input
+    my $recce = new_recce();
+    my $start = $recce->checkpoint();
+    Test::More::is( $start, 0, 'checkpoint at start of input' );
+    @events = ();
+    read_all( $recce, \$input );
+    $recce->rollback($start);
+    @events = ();
+    read_all( $recce, \$edited );
+    Test::More::is_deeply( summary($recce), $full_summary,
+        'rollback to start of input' );
+}
+
+{
+    # Replacing a checkpoint frees the copies made for the old one
+    my $recce = new_recce();
+    $recce->checkpoint();
+    my $memory_usage = $recce->memory_usage();
+    $recce->checkpoint() for 1 .. 10_000;
+    Test::More::is( $recce->memory_usage(), $memory_usage,
+        'repeated checkpoint does not use more memory' );
+}
+
+{
+    my $recce = Marpa::R3::Recognizer->new(
+        { grammar => $grammar, forgetful => 1 } );
+    my $eval_ok = eval { $recce->checkpoint(); 1 };
+    Test::More::like( ( $eval_ok ? 'no error' : $EVAL_ERROR ),
+        qr/forgetful/xms, 'no checkpoints in forgetful recognizer' );
+}
+
+{
+    my $recce = Marpa::R3::Recognizer->new(
+        {
+            grammar        => $grammar,
+            event_handlers => {
+                subtext => sub () { $_[0]->rollback(0); 'ok' }
+            }
+        }
+    );
+    $recce->checkpoint();
+    my $eval_ok = eval { read_all( $recce, \$input ); 1 };
+    Test::More::like( ( $eval_ok ? 'no error' : $EVAL_ERROR ),
+        qr/rollback\(\)\s+called\s+from\s+inside\s+a\s+handler/xms,
+        'rollback() not allowed in handler' );
+}
+
+# vim: expandtab shiftwidth=4:
@@ -0,0 +1,142 @@
+#!perl
+# Marpa::R3 is Copyright (C) 2017, Jeffrey Kegler.
+#
+# This module is free software; you can redistribute it and/or modify it
+# under the same terms as Perl 5.10.1. For more details, see the full text
+# of the licenses in the directory LICENSES.
+#
+# This program is distributed in the hope that it will be
+# useful, but it is provided "as is" and without any express
+# or implied warranties. For details, see the full text of
+# of the licenses in the directory LICENSES.
+
+# Tests of the grammar's chunk cache.
+# Repeated parses are made with different limits on the cache,
+# and the memory usage of the grammar, which includes the
+# chunks held by the cache, is checked.
+
+use 5.010001;
+
+use strict;
+use warnings;
+
+use lib 'inc';
+use Marpa::R3::Lua::Test::More;
+use English qw( -no_match_vars );
+use Marpa::R3;
+use POSIX qw(setlocale LC_ALL);
+
+POSIX::setlocale(LC_ALL, "C");
+
+my $marpa_lua = Marpa::R3::Lua->new();
+
+$marpa_lua->exec('strict.off()');
+Marpa::R3::Lua::Test::More::load_me($marpa_lua);
+$marpa_lua->exec('strict.on()');
+
+$marpa_lua->exec(<<'END_OF_LUA');
+    Test.More.plan(9)
+
+    local function grammar_new()
+        local grammar = kollos.grammar_new()
+        grammar:force_valued()
+        local S = grammar:symbol_new('S').id
+        local a = grammar:symbol_new('a').id
+        grammar:rule_new{S, S, S}
+        grammar:rule_new{S, a}
+        grammar:start_symbol_set(S)
+        grammar:precompute()
+        return grammar, a
+    end
+
+    -- Parses an ambiguous input, and evaluates one of its parses,
+    -- so that a recognizer, bocage, order, tree and valuator
+    -- are created and freed
+    local function parse(grammar, a)
+        local recce = kollos.recce_new(grammar)
+        recce:start_input()
+        for _ = 1, 20 do
+            recce:alternative(a, 1, 1)
+            recce:earleme_complete()
+        end
+        local bocage = kollos.bocage_new(recce, recce:latest_earley_set())
+        local tree = kollos.tree_new(kollos.order_new(bocage))
+        tree:next()
+        local value = kollos.value_new(tree)
+        local step_count = 0
+        while true do
+            local ok, step = value:step()
+            if not ok or not step then break end
+            step_count = step_count + 1
+        end
+        return step_count
+    end
+
+    -- The memory usage of the grammar, after the objects
+    -- of the parses are freed
+    local function usage_of(grammar)
+        collectgarbage()
+        return grammar:memory_usage()
+    end
+
+    local grammar, a = grammar_new()
+    Test.More.is(grammar:chunk_cache_max(), 64*1024, 'default cache limit')
+
+    parse(grammar, a)
+    local full_usage = usage_of(grammar)
+    Test.More.is(grammar:chunk_cache_max_set(0), 0, 'cache limit set to 0')
+    local empty_usage = usage_of(grammar)
+    Test.More.ok(empty_usage < full_usage,
+        'a cache limit of 0 frees the held chunks')
+
+    parse(grammar, a)
+    Test.More.is(usage_of(grammar), empty_usage,
+        'no chunks are held with a cache limit of 0')
+
+    grammar:chunk_cache_max_set(64*1024)
+    for _ = 1, 5 do parse(grammar, a) end
+    local held = usage_of(grammar) - empty_usage
+    Test.More.ok(held > 0 and held <= 64*1024,
+        'repeated parses hold at most the cache limit')
+
+    local half = held // 2
+    grammar:chunk_cache_max_set(half)
+    local shrunk_held = usage_of(grammar) - empty_usage
+    Test.More.ok(shrunk_held <= half and shrunk_held < held,
+        'shrinking the cache limit evicts chunks')
+    Test.More.is(grammar:chunk_cache_max(), half, 'shrunk cache limit')
+
+    -- The Lua recognizer refers to its grammar, which would keep it
+    -- alive.  Dropping that reference lets the grammar be freed first,
+    -- so that the obstacks of the recognizer, bocage, order, tree
+    -- and valuator are given back to a cache whose grammar is gone.
+    local step_count = parse(grammar, a)
+    local other_grammar, other_a = grammar_new()
+    local recce = kollos.recce_new(other_grammar)
+    recce.lmw_g = nil
+    other_grammar = nil
+    collectgarbage()
+    recce:start_input()
+    for _ = 1, 20 do
+        recce:alternative(other_a, 1, 1)
+        recce:earleme_complete()
+    end
+    local bocage = kollos.bocage_new(recce, recce:latest_earley_set())
+    local tree = kollos.tree_new(kollos.order_new(bocage))
+    tree:next()
+    local value = kollos.value_new(tree)
+    local other_step_count = 0
+    while true do
+        local ok, step = value:step()
+        if not ok or not step then break end
+        other_step_count = other_step_count + 1
+    end
+    Test.More.is(other_step_count, step_count,
+        'parse after its grammar is freed')
+    recce, bocage, tree, value = nil, nil, nil, nil
+    collectgarbage()
+    Test.More.ok(usage_of(grammar) >= empty_usage,
+        'objects freed after their grammar')
+END_OF_LUA
+
+# vim: expandtab shiftwidth=4:
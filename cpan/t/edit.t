@@ -0,0 +1,162 @@
+#!perl
+# Marpa::R3 is Copyright (C) 2017, Jeffrey Kegler.
+#
+# This module is free software; you can redistribute it and/or modify it
+# under the same terms as Perl 5.10.1. For more details, see the full text
+# of the licenses in the directory LICENSES.
+#
+# This program is distributed in the hope that it will be
+# useful, but it is provided "as is" and without any express
+# or implied warranties. For details, see the full text of
+# of the licenses in the directory LICENSES.
+
+# Tests of incremental reparsing with edit().
+# An incremental recognizer is edited repeatedly,
+# and after each edit the results are compared with
+# a parse of the edited input from the beginning.
+
+use 5.010001;
+
+use strict;
+use warnings;
+
+use Test::More tests => 11;
+use English qw( -no_match_vars );
+use lib 'inc';
+use Marpa::R3::Test;
+use Marpa::R3;
+
+my $grammar = Marpa::R3::Grammar->new(
+    {
+        source => \<<'END_OF_DSL',
+:default ::= action => [values]
+text ::= <text segment>*
+<text segment> ::= subtext
+<text segment> ::= <word>
+subtext ::= '(' text ')'
+subtext ::= '[' list
+list ::= word ']'
+list ::= word list
+
+event subtext = completed <subtext>
+
+word ~ [\w]+
+:discard ~ whitespace
+whitespace ~ [\s]+
+END_OF_DSL
+    }
+);
+
+# Each event is recorded with its G1 location,
+# so that the events after a rollback can be discarded
+sub new_recce {
+    my ( $events, @args ) = @_;
+    return Marpa::R3::Recognizer->new(
+        {
+            grammar        => $grammar,
+            event_handlers => {
+                subtext => sub () {
+                    my ($recce) = @_;
+                    my ( $start, $length ) = $recce->last_completed('subtext');
+                    push @{$events},
+                      [ $recce->g1_pos(), $recce->g1_literal( $start, $length ) ];
+                    'ok';
+                }
+            },
+            @args
+        }
+    );
+}
+
+sub read_all {
+    my ( $recce, $pos ) = @_;
+    my $length = $recce->input_length();
+    while ( $pos < $length ) {
+        $pos = $recce->resume($pos);
+    }
+    return;
+}
+
+sub summary {
+    my ( $recce, $events ) = @_;
+    return [
+        $recce->g1_pos(),
+        [ $recce->last_completed('text') ],
+        [ map { $recce->progress($_) } 0 .. $recce->g1_pos() ],
+        $recce->value(),
+        $events,
+    ];
+}
+
+# Parses `$string` from the beginning
+sub full_parse {
+    my ($string) = @_;
+    my @events = ();
+    my $recce  = new_recce( \@events );
+    read_all( $recce, $recce->read( \$string ) );
+    return summary( $recce, \@events );
+}
+
+my $input = join q{ }, map { "w$_ (x$_ [y$_ u$_] z)" } 1 .. 30;
+
+my @events = ();
+my $recce = new_recce( \@events, incremental => 1 );
+read_all( $recce, $recce->read( \$input ) );
+Test::More::is_deeply( summary( $recce, \@events ),
+    full_parse($input), 'incremental parse' );
+
+# Each edit is the text at which it starts, an offset from there,
+# a length, and the new text.
+# Some of the edits extend or split
+# the lexeme before them.
+my @edits = (
+    [ 'w29',  0, 3, 'v29' ],
+    [ 'w7 ',  2, 0, '77' ],
+    [ 'z)',   0, 0, 'more words ' ],
+    [ 'u3]',  1, 0, ' ' ],
+    [ '(x12', 0, ( length '(x12 [y12 u12] z)' ), '[a b c]' ],
+    [ 'w30',  ( length 'w30 (x30 [y30 u30] z)' ), 0, ' w99 (end)' ],
+    [ 'w1 ',  0, 0, 'start ' ],
+);
+my $edited = $input;
+for my $edit (@edits) {
+    my ( $anchor, $delta, $length, $new_text ) = @{$edit};
+    my $start = ( index $edited, $anchor ) + $delta;
+    substr $edited, $start, $length, $new_text;
+    my $offset = $recce->edit( 1, $start, $length, \$new_text );
+    my $g1_loc = $recce->g1_pos();
+    @events = grep { $_->[0] <= $g1_loc } @events;
+    read_all( $recce, $offset );
+    Test::More::is_deeply( summary( $recce, \@events ),
+        full_parse($edited), qq{edit at $start: "$new_text"} );
+}
+
+{
+    # A change within the last lexeme of the input
+    # must not be read from the checkpoint after that lexeme
+    my $start = ( length $edited ) - 2;
+    my $offset = $recce->edit( 1, $start, 1, \'x' );
+    Test::More::ok( $offset <= ( rindex $edited, 'end' ),
+        'edit() rolls back before a changed lexeme' );
+}
+
+{
+    my $recce = new_recce( [] );
+    $recce->read( \$input );
+    my $eval_ok = eval { $recce->edit( 1, 10, 1, \'x' ); 1 };
+    Test::More::like( ( $eval_ok ? 'no error' : $EVAL_ERROR ),
+        qr/no\s+checkpoint\s+before\s+position/xms,
+        'edit() of recognizer which is not incremental' );
+}
+
+{
+    my $eval_ok = eval {
+        new_recce( [], incremental => 1, forgetful => 1 );
+        1;
+    };
+    Test::More::like( ( $eval_ok ? 'no error' : $EVAL_ERROR ),
+        qr/forgetful\s+recognizer\s+cannot\s+be\s+incremental/xms,
+        'incremental and forgetful' );
+}
+
+# vim: expandtab shiftwidth=4:
@@ -0,0 +1,147 @@
+#!perl
+# Marpa::R3 is Copyright (C) 2017, Jeffrey Kegler.
+#
+# This module is free software; you can redistribute it and/or modify it
+# under the same terms as Perl 5.10.1. For more details, see the full text
+# of the licenses in the directory LICENSES.
+#
+# This program is distributed in the hope that it will be
+# useful, but it is provided "as is" and without any express
+# or implied warranties. For details, see the full text of
+# of the licenses in the directory LICENSES.
+
+# Tests of forgetful and link-free recognizers.
+# A long, ambiguous input is recognized, with events, by an ordinary
+# recognizer and by forgetful, link-free and forgetful link-free
+# recognizers, and the results compared.
+
+use 5.010001;
+
+use strict;
+use warnings;
+
+use Test::More tests => 29;
+use English qw( -no_match_vars );
+use lib 'inc';
+use Marpa::R3::Test;
+use Marpa::R3;
+
+my $grammar = Marpa::R3::Grammar->new(
+    {
+        source => \<<'END_OF_DSL',
+:default ::= action => [values]
+text ::= <text segment>*
+<text segment> ::= subtext
+<text segment> ::= <word>
+<text segment> ::= <word> <word>
+subtext ::= '(' text ')'
+subtext ::= '(' list
+list ::= word ')'
+list ::= word list
+
+event subtext = completed <subtext>
+
+word ~ [\w]+
+:discard ~ whitespace
+whitespace ~ [\s]+
+END_OF_DSL
+    }
+);
+
+# Deep nesting keeps early Earley sets open across
+# many forgetting passes; the word pairs and the final list
+# make the parse ambiguous and right-recursive
+my $nested = ( '(' x 40 ) . 'deep' . ( ')' x 40 );
+my $input = join q{ },
+  ( map { "w$_ v$_ (x$_ (y$_ u$_) z)" } 1 .. 300 ),
+  $nested,
+  '(' . ( join q{ }, 1 .. 50 ) . ')', 'end';
+
+sub recognize {
+    my ( $string, @args ) = @_;
+    my @events;
+    my $recce = Marpa::R3::Recognizer->new(
+        {
+            grammar        => $grammar,
+            event_handlers => {
+                subtext => sub () {
+                    my ($recce) = @_;
+                    my ( $start, $length ) = $recce->last_completed('subtext');
+                    push @events, $recce->g1_literal( $start, $length );
+                    'ok';
+                }
+            },
+            @args
+        }
+    );
+    my $length = length $string;
+    my $pos    = $recce->read( \$string );
+    while ( $pos < $length ) {
+        $pos = $recce->resume($pos);
+    }
+    return $recce, \@events;
+}
+
+my ( $full_recce, $full_events ) = recognize($input);
+Test::More::is( scalar @{$full_events}, 641, 'event count' );
+
+my @configs = (
+    [ 'forgetful', 'forgetful', { forgetful => 1 } ],
+    [ 'link-free', 'link-free', { link_free => 1 } ],
+    [
+        'forgetful and link-free', 'forgetful',
+        { forgetful => 1, link_free => 1 }
+    ],
+);
+
+for my $config (@configs) {
+    my ( $name, $kind, $args ) = @{$config};
+    my ( $recce, $events ) = recognize( $input, %{$args} );
+
+    Test::More::is_deeply( $events, $full_events, "$name: events match" );
+    Test::More::is( $recce->g1_pos(), $full_recce->g1_pos(),
+        "$name: G1 location at end of input" );
+    Test::More::is_deeply( [ $recce->last_completed('text') ],
+        [ 0, $recce->g1_pos() ], "$name: input accepted" );
+    Test::More::is( $recce->exhausted(), $full_recce->exhausted(),
+        "$name: exhausted() matches" );
+    Test::More::is_deeply( $recce->progress(), $full_recce->progress(),
+        "$name: progress() at latest G1 location" );
+
+    if ( $args->{forgetful} ) {
+        my $eval_ok = eval { $recce->progress(10); 1 };
+        Test::More::like( ( $eval_ok ? 'no error' : $EVAL_ERROR ),
+            qr/Earley\s+set\s+has\s+been\s+forgotten/xms,
+            "$name: progress() at forgotten G1 location" );
+    }
+    else {
+        my $last_pos      = $recce->g1_pos();
+        my @progress      = map { $recce->progress($_) } 0 .. $last_pos;
+        my @full_progress = map { $full_recce->progress($_) } 0 .. $last_pos;
+        Test::More::is_deeply( \@progress, \@full_progress,
+            "$name: progress() at every G1 location" );
+    }
+
+    {
+        my $eval_ok = eval { $recce->value(); 1 };
+        Test::More::like( ( $eval_ok ? 'no error' : $EVAL_ERROR ),
+            qr/\Q$kind\E\s+recognizer\s+cannot\s+be\s+evaluated/xms,
+            "$name: value() fails" );
+    }
+
+    for my $arg ( sort keys %{$args} ) {
+        my $eval_ok = eval { $recce->set( { $arg => 1 } ); 1 };
+        Test::More::like( ( $eval_ok ? 'no error' : $EVAL_ERROR ),
+            qr/Bad\s+slr\s+named\s+argument/xms,
+            "$name: $arg not allowed in set()" );
+    }
+
+    {
+        my $eval_ok = eval { recognize( "$input ) more", %{$args} ); 1 };
+        Test::More::like( ( $eval_ok ? 'no error' : $EVAL_ERROR ),
+qr/Parse\s+exhausted|No\s+lexeme\s+found|Error\s+in\s+SLIF\s+parse/xms,
+            "$name: input rejected" );
+    }
+}
+
+# vim: expandtab shiftwidth=4:
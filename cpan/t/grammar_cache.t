@@ -0,0 +1,146 @@
+#!/usr/bin/perl
+# Marpa::R3 is Copyright (C) 2017, Jeffrey Kegler.
+#
+# This module is free software; you can redistribute it and/or modify it
+# under the same terms as Perl 5.10.1. For more details, see the full text
+# of the licenses in the directory LICENSES.
+#
+# This program is distributed in the hope that it will be
+# useful, but it is provided "as is" and without any express
+# or implied warranties. For details, see the full text of
+# of the licenses in the directory LICENSES.
+
+# Tests of the compiled grammar cache
+
+use 5.010001;
+
+use strict;
+use warnings;
+use Test::More tests => 11;
+use English qw( -no_match_vars );
+use Data::Dumper;
+use File::Temp;
+use Storable;
+use POSIX qw(setlocale LC_ALL);
+
+POSIX::setlocale(LC_ALL, "C");
+
+use lib 'inc';
+use Marpa::R3::Test;
+
+## no critic (ErrorHandling::RequireCarping);
+
+use Marpa::R3;
+
+my $dsl = <<'END_OF_SOURCE';
+:default ::= action => ::array
+:start ::= Script
+Script ::= Expression+ separator => comma
+comma ~ [,]
+Expression ::=
+    Number
+    | ('(') Expression (')') assoc => group
+   || Expression ('**') Expression assoc => right
+   || Expression ('*') Expression
+    | Expression ('/') Expression
+   || Expression ('+') Expression
+    | Expression ('-') Expression
+Number ~ [\d]+
+:discard ~ whitespace
+whitespace ~ [\s]+
+END_OF_SOURCE
+
+my $input = '42*2+7/3, 42*(2+7)/3, 2**7-3, 2**(7-3)';
+
+my $cache_dir = File::Temp->newdir();
+
+sub cache_files {
+    opendir my $dh, $cache_dir or die "Cannot open $cache_dir: $ERRNO";
+    my @files = grep { /[.]slg\z/xms } readdir $dh;
+    closedir $dh;
+    return @files;
+}
+
+sub grammar_new {
+    my ($source) = @_;
+    return Marpa::R3::Grammar->new(
+        { source => \$source, cache_dir => "$cache_dir" } );
+}
+
+sub dump_value {
+    my ($value_ref) = @_;
+    local $Data::Dumper::Sortkeys = 1;
+    local $Data::Dumper::Indent   = 0;
+    return Data::Dumper::Dumper($value_ref);
+}
+
+my $plain_grammar = Marpa::R3::Grammar->new( { source => \$dsl } );
+my $expected_value = dump_value( $plain_grammar->parse( \$input ) );
+
+my $first_grammar = grammar_new($dsl);
+my @files         = cache_files();
+Test::More::is( ( scalar @files ), 1, 'cache entry written' );
+
+my $cached_grammar;
+{
+    # On a hit, the DSL must not be parsed
+    no warnings 'redefine';
+    local *Marpa::R3::Internal::MetaAST::new =
+      sub { die "DSL was parsed\n" };
+    $cached_grammar = eval { grammar_new($dsl) };
+}
+Test::More::ok( $cached_grammar, 'grammar from cache entry' )
+  or Test::More::diag($EVAL_ERROR);
+
+Test::More::is( dump_value( $cached_grammar->parse( \$input ) ),
+    $expected_value, 'value with grammar from cache entry' );
+Marpa::R3::Test::is(
+    $cached_grammar->productions_show(),
+    $plain_grammar->productions_show(),
+    'productions of grammar from cache entry'
+);
+Marpa::R3::Test::is(
+    $cached_grammar->ahms_show(),
+    $plain_grammar->ahms_show(),
+    'AHMs of grammar from cache entry'
+);
+
+grammar_new( $dsl . "\n# Another comment\n" );
+Test::More::is( ( scalar cache_files() ), 2,
+    'changed DSL has its own cache entry' );
+
+# A damaged entry is a miss, and is replaced
+my $file = File::Spec->catfile( "$cache_dir", $files[0] );
+{
+    open my $fh, q{>}, $file or die "Cannot open $file: $ERRNO";
+    print {$fh} 'not a cache entry' or die "Cannot write $file: $ERRNO";
+    close $fh;
+}
+my $damaged_grammar = grammar_new($dsl);
+Test::More::is( dump_value( $damaged_grammar->parse( \$input ) ),
+    $expected_value, 'value after damaged cache entry' );
+Test::More::ok( ( -s $file ) > length 'not a cache entry',
+    'damaged cache entry replaced' );
+
+# An image is not used if its digest is not that of the grammar
+# being built, and the grammar is precomputed instead
+{
+    my $entry = Storable::retrieve($file);
+    $entry->{images}->{g1}->{digest} = '0' x 16;
+    Storable::store( $entry, $file );
+    my $grammar = grammar_new($dsl);
+    Test::More::ok( $grammar->precompute_stats()->{g1}->{total_ns} > 0,
+        'image with another digest is not used' );
+    Test::More::is( dump_value( $grammar->parse( \$input ) ),
+        $expected_value, 'value after image with another digest' );
+}
+
+my $eval_ok = eval {
+    Marpa::R3::Grammar->new(
+        { source => \$dsl, cache_dir => "$cache_dir/no_such_dir" } );
+    1;
+};
+Test::More::like( $EVAL_ERROR, qr/cache_dir/xms,
+    'cache_dir which is not a directory' );
+
+# vim: expandtab shiftwidth=4:
@@ -0,0 +1,146 @@
+#!perl
+# Marpa::R3 is Copyright (C) 2017, Jeffrey Kegler.
+#
+# This module is free software; you can redistribute it and/or modify it
+# under the same terms as Perl 5.10.1. For more details, see the full text
+# of the licenses in the directory LICENSES.
+#
+# This program is distributed in the hope that it will be
+# useful, but it is provided "as is" and without any express
+# or implied warranties. For details, see the full text of
+# of the licenses in the directory LICENSES.
+
+# Tests of grammar images.
+# A grammar is written as an image and read back,
+# and parses with the two grammars are compared.
+
+use 5.010001;
+
+use strict;
+use warnings;
+
+use lib 'inc';
+use Marpa::R3::Lua::Test::More;
+use English qw( -no_match_vars );
+use Marpa::R3;
+use POSIX qw(setlocale LC_ALL);
+
+POSIX::setlocale(LC_ALL, "C");
+
+my $marpa_lua = Marpa::R3::Lua->new();
+
+$marpa_lua->exec('strict.off()');
+Marpa::R3::Lua::Test::More::load_me($marpa_lua);
+$marpa_lua->exec('strict.on()');
+
+$marpa_lua->exec(<<'END_OF_LUA');
+    Test.More.plan(8)
+
+    local grammar = kollos.grammar_new()
+    grammar:force_valued()
+    local sym = {}
+    for _, name in ipairs{ 'S', 'list', 'item', 'opt', 'num', 'var',
+        ',', '(', ')' }
+    do
+        sym[name] = grammar:symbol_new(name).id
+    end
+    grammar:rule_new{sym.S, sym.list}
+    grammar:sequence_new{ lhs = sym.list, rhs = sym.item,
+        separator = sym[','], min = 0 }
+    grammar:rule_new{sym.item, sym.num, sym.opt}
+    grammar:rule_new{sym.item, sym.var, sym.opt}
+    grammar:rule_new{sym.item, sym['('], sym.list, sym[')']}
+    grammar:rule_new{sym.opt}
+    grammar:rule_new{sym.opt, sym.var}
+    grammar:start_symbol_set(sym.S)
+
+    kollos.throw = false
+    local image = grammar:serialize()
+    kollos.throw = true
+    Test.More.ok(not image, 'grammar which is not precomputed')
+
+    grammar:precompute()
+    image = grammar:serialize()
+    local loaded = kollos.grammar_deserialize(image)
+    Test.More.ok(loaded, 'grammar read from its image')
+    Test.More.ok(loaded:serialize() == image, 'image of the loaded grammar')
+
+    local input = {}
+    for token in string.gmatch(
+        'num var , ( var , num var ) , ( ) , var var , num', '%S+')
+    do
+        input[#input+1] = sym[token]
+    end
+
+    local function report_of(recce)
+        local report = {}
+        for set_id = 0, recce:latest_earley_set() do
+            recce:progress_report_start(set_id)
+            local items = {}
+            while true do
+                local rule_id, dot_position, origin = recce:progress_item()
+                if not rule_id then break end
+                items[#items+1] = string.format("R%d:%d@%d",
+                    rule_id, dot_position, origin)
+            end
+            table.sort(items)
+            report[#report+1] = table.concat(items, ' ')
+        end
+        recce:progress_report_finish()
+        return table.concat(report, '\n')
+    end
+
+    local function read(recce, from, to)
+        for ix = from, to do
+            recce:alternative(input[ix], 1, 1)
+            recce:earleme_complete()
+        end
+    end
+
+    local function parse(g)
+        local recce = kollos.recce_new(g)
+        recce:start_input()
+        read(recce, 1, #input)
+        return recce
+    end
+
+    local recce = parse(grammar)
+    local loaded_recce = parse(loaded)
+    Test.More.is(report_of(loaded_recce), report_of(recce),
+        'progress reports')
+    Test.More.ok(kollos.bocage_new(loaded_recce,
+        loaded_recce:latest_earley_set()), 'bocage with the loaded grammar')
+
+    -- Recognizer images are interchangeable between the grammars
+    local half = #input // 2
+    local original_recce = kollos.recce_new(grammar)
+    original_recce:start_input()
+    read(original_recce, 1, half)
+    local moved_recce = kollos.recce_deserialize(loaded,
+        original_recce:serialize())
+    read(moved_recce, half + 1, #input)
+    Test.More.is(report_of(moved_recce), report_of(recce),
+        'recognizer image read with the loaded grammar')
+
+    kollos.throw = false
+    local truncated, error_object = kollos.grammar_deserialize(
+        image:sub(1, #image - 4))
+    kollos.throw = true
+    Test.More.ok(not truncated and error_object.code
+        == kollos.err.INVALID_IMAGE, 'truncated image is rejected')
+
+    local rejected = 0
+    for offset = 1, #image, 7 do
+        local byte = image:byte(offset) ~ 0x55
+        local changed = image:sub(1, offset - 1)
+            .. string.char(byte) .. image:sub(offset + 1)
+        kollos.throw = false
+        local g = kollos.grammar_deserialize(changed)
+        kollos.throw = true
+        if not g then rejected = rejected + 1 end
+    end
+    Test.More.ok(rejected > 0,
+        string.format('changed images: %d rejected', rejected))
+END_OF_LUA
+
+# vim: expandtab shiftwidth=4:
@@ -0,0 +1,217 @@
+#!perl
+# Marpa::R3 is Copyright (C) 2017, Jeffrey Kegler.
+#
+# This module is free software; you can redistribute it and/or modify it
+# under the same terms as Perl 5.10.1. For more details, see the full text
+# of the licenses in the directory LICENSES.
+#
+# This program is distributed in the hope that it will be
+# useful, but it is provided "as is" and without any express
+# or implied warranties. For details, see the full text of
+# of the licenses in the directory LICENSES.
+
+# Tests of the L0 DFA.
+# Regular lexemes are read with the DFA, except when
+# terminals are traced, when the Earley L0 recognizer is used.
+# Each input is parsed both ways, and the results compared.
+
+use 5.010001;
+
+use strict;
+use warnings;
+
+use POSIX qw(setlocale LC_ALL);
+
+POSIX::setlocale(LC_ALL, "C");
+
+use Test::More tests => 17;
+use Data::Dumper;
+use English qw( -no_match_vars );
+use lib 'inc';
+use Marpa::R3::Test;
+use Marpa::R3;
+
+sub do_parse {
+    my ( $grammar, $input, $trace_terminals ) = @_;
+    my $trace_output = q{};
+    open my $trace_fh, q{>}, \$trace_output;
+    binmode $trace_fh, ':encoding(UTF-8)';
+    my $recce = Marpa::R3::Recognizer->new(
+        {
+            grammar           => $grammar,
+            trace_terminals   => $trace_terminals,
+            trace_file_handle => $trace_fh
+        }
+    );
+    my $value_ref;
+    my $eval_ok = eval { $recce->read( \$input ); $value_ref = $recce->value(); 1 };
+    close $trace_fh;
+    if ( not $eval_ok ) {
+        my $error = $EVAL_ERROR;
+        # Keep only the first line -- the rest may describe the trace
+        $error =~ s/\n.*//xms;
+        return "Error: $error";
+    }
+    return 'No parse' if not $value_ref;
+    local $Data::Dumper::Indent   = 0;
+    local $Data::Dumper::Sortkeys = 1;
+    return Data::Dumper::Dumper( ${$value_ref} );
+}
+
+sub do_test {
+    my ( $grammar, $input, $name ) = @_;
+    my $dfa_result    = do_parse( $grammar, $input, 0 );
+    my $earley_result = do_parse( $grammar, $input, 1 );
+    Test::More::is( $dfa_result, $earley_result, $name );
+    return;
+}
+
+## no critic (ValuesAndExpressions::ProhibitImplicitNewlines)
+
+my $sequence_dsl = <<'END_OF_SOURCE';
+:default ::= action => [name,values]
+lexeme default = action => [name,value]
+start ::= item+
+item ::= list | word | number
+list ~ '(' elements ')'
+elements ~ element* separator => comma
+element ~ [a-z]+
+comma ~ ','
+word ~ [a-z] word_rest
+word_rest ~ [a-z0-9_]*
+number ~ digits | digits '.' digits | digits 'e' sign digits
+digits ~ [\d]+
+sign ~ [+-]
+sign ~
+:discard ~ ws
+ws ~ [\s]+
+END_OF_SOURCE
+
+my $sequence_grammar =
+    Marpa::R3::Grammar->new( { source => \$sequence_dsl } );
+
+do_test( $sequence_grammar, 'abc 42 x_1', 'Words and numbers' );
+do_test( $sequence_grammar, '() (a) (a,b,cd)', 'Separated sequences' );
+do_test( $sequence_grammar, '(a,)', 'Trailing separator' );
+do_test( $sequence_grammar, '1.5 2e10 3e-1 4.', 'Alternatives and nulling' );
+do_test( $sequence_grammar, '12 ab%', 'Character not in alphabet' );
+do_test( $sequence_grammar, '', 'Empty input' );
+
+my $separated_dsl = <<'END_OF_SOURCE';
+:default ::= action => [values]
+start ::= list+
+list ~ element+ separator => comma
+element ~ [a-z]
+comma ~ ','
+:discard ~ ws
+ws ~ [\s]+
+END_OF_SOURCE
+
+my $separated_grammar = Marpa::R3::Grammar->new( { source => \$separated_dsl } );
+
+do_test( $separated_grammar, 'a,b,c d,e', 'Separated L0 sequence' );
+do_test( $separated_grammar, ',a', 'Leading separator' );
+
+# Longest acceptable token match
+my $latm_dsl = <<'END_OF_SOURCE';
+:default ::= action => [values]
+start ::= prefix rest
+prefix ::= aa | a
+rest ::= b | ab
+aa ~ 'aa'
+a ~ 'a'
+b ~ 'b'
+ab ~ 'ab'
+END_OF_SOURCE
+
+my $latm_grammar = Marpa::R3::Grammar->new( { source => \$latm_dsl } );
+
+do_test( $latm_grammar, 'aab', 'LATM' );
+do_test( $latm_grammar, 'aaab', 'LATM failure' );
+
+my $priority_dsl = <<'END_OF_SOURCE';
+:default ::= action => [name,values]
+lexeme default = action => [name,value]
+start ::= thing+
+thing ::= keyword | name
+:lexeme ~ keyword priority => 1
+keyword ~ 'if' | 'then'
+name ~ [a-z]+
+:discard ~ ws
+ws ~ [\s]+
+END_OF_SOURCE
+
+my $priority_grammar =
+    Marpa::R3::Grammar->new( { source => \$priority_dsl } );
+
+do_test( $priority_grammar, 'if x then y iffy', 'Lexeme priorities' );
+
+my $eager_dsl = <<'END_OF_SOURCE';
+:default ::= action => [values]
+start ::= text+
+text ~ [^/\s]+
+:discard ~ ws
+ws ~ [\s]+
+:discard ~ comment eager => 1
+comment ~ '//' stuff newline
+stuff ~ [\d\D]*
+newline ~ [\n]
+END_OF_SOURCE
+
+my $eager_grammar = Marpa::R3::Grammar->new( { source => \$eager_dsl } );
+
+do_test( $eager_grammar, "abc //xyz\n def //\n", 'Eager discard' );
+
+# The nested comment is not regular, so the Earley L0
+# recognizer is used for it, whenever it is acceptable.
+my $nested_dsl = <<'END_OF_SOURCE';
+:default ::= action => [values]
+start ::= text+
+text ~ [a-z]+
+:discard ~ ws
+ws ~ [\s]+
+:discard ~ comment
+comment ~ '(' inside ')'
+inside ~ piece*
+piece ~ [a-z\s] | comment
+END_OF_SOURCE
+
+my $nested_grammar = Marpa::R3::Grammar->new( { source => \$nested_dsl } );
+
+do_test( $nested_grammar, 'ab (c (d) e) f', 'Nested comment' );
+do_test( $nested_grammar, 'ab (c (d e) f', 'Unclosed nested comment' );
+
+# Regular lexemes, one of them recursive, which is read with the Earley L0
+# recognizer only where G1 expects it.
+my $mixed_dsl = <<'END_OF_SOURCE';
+:default ::= action => [name,values]
+lexeme default = action => [name,value]
+start ::= word bracketed word
+word ~ [a-z]+
+bracketed ~ '[' inner ']'
+inner ~ '[' inner ']'
+inner ~
+:discard ~ ws
+ws ~ [\s]+
+END_OF_SOURCE
+
+my $mixed_grammar = Marpa::R3::Grammar->new( { source => \$mixed_dsl } );
+
+do_test( $mixed_grammar, 'ab [[[]]] cd', 'Mixed regular and recursive lexemes' );
+do_test( $mixed_grammar, 'ab [[[]] cd', 'Mixed lexemes, unbalanced' );
+
+# Non-ASCII input
+my $unicode_dsl = <<'END_OF_SOURCE';
+:default ::= action => [values]
+start ::= word+
+word ~ [\w]+
+:discard ~ ws
+ws ~ [\s]+
+END_OF_SOURCE
+
+my $unicode_grammar = Marpa::R3::Grammar->new( { source => \$unicode_dsl } );
+
+do_test( $unicode_grammar, "caf\x{e9} \x{3b1}\x{3b2}\x{3b3} \x{10400}x",
+    'Multi-byte codepoints' );
+
+# vim: expandtab shiftwidth=4:
@@ -0,0 +1,138 @@
+#!perl
+# Marpa::R3 is Copyright (C) 2017, Jeffrey Kegler.
+#
+# This module is free software; you can redistribute it and/or modify it
+# under the same terms as Perl 5.10.1. For more details, see the full text
+# of the licenses in the directory LICENSES.
+#
+# This program is distributed in the hope that it will be
+# useful, but it is provided "as is" and without any express
+# or implied warranties. For details, see the full text of
+# of the licenses in the directory LICENSES.
+
+# Tests of lookahead filtering of predictions.
+# An expression is parsed with and without a lookahead filter,
+# and the Earley items which are not predictions are compared.
+
+use 5.010001;
+
+use strict;
+use warnings;
+
+use lib 'inc';
+use Marpa::R3::Lua::Test::More;
+use English qw( -no_match_vars );
+use Marpa::R3;
+use POSIX qw(setlocale LC_ALL);
+
+POSIX::setlocale(LC_ALL, "C");
+
+my $marpa_lua = Marpa::R3::Lua->new();
+
+$marpa_lua->exec('strict.off()');
+Marpa::R3::Lua::Test::More::load_me($marpa_lua);
+$marpa_lua->exec('strict.on()');
+
+$marpa_lua->exec(<<'END_OF_LUA');
+    Test.More.plan(7)
+
+    local grammar = kollos.grammar_new()
+    grammar:force_valued()
+    local sym = {}
+    for _, name in ipairs{ 'S', 'or', 'and', 'cmp', 'add', 'mul',
+        'unary', 'primary', 'num', 'var', '|', '&', '<', '+', '*',
+        '-', '(', ')' }
+    do
+        sym[name] = grammar:symbol_new(name).id
+    end
+    grammar:rule_new{sym.S, sym['or']}
+    local levels = { 'or', 'and', 'cmp', 'add', 'mul', 'unary' }
+    local ops = { '|', '&', '<', '+', '*' }
+    for ix = 1, #ops do
+        local this, next = sym[levels[ix]], sym[levels[ix+1]]
+        grammar:rule_new{this, this, sym[ops[ix]], next}
+        grammar:rule_new{this, next}
+    end
+    grammar:rule_new{sym.unary, sym['-'], sym.unary}
+    grammar:rule_new{sym.unary, sym.primary}
+    grammar:rule_new{sym.primary, sym.num}
+    grammar:rule_new{sym.primary, sym.var}
+    grammar:rule_new{sym.primary, sym['('], sym['or'], sym[')']}
+    grammar:start_symbol_set(sym.S)
+    grammar:precompute()
+
+    local input = {}
+    for token in string.gmatch(
+        'num + ( - var * num < var ) | num & ( var + num ) * - num',
+        '%S+')
+    do
+        input[#input+1] = sym[token]
+    end
+
+    local function parse(filtered)
+        local recce = kollos.recce_new(grammar)
+        if filtered then
+            recce:lookahead_filter_set(1)
+            recce:lookahead_add(input[1])
+        end
+        recce:start_input()
+        for ix = 1, #input do
+            recce:alternative(input[ix], 1, 1)
+            if filtered and input[ix+1] then
+                recce:lookahead_add(input[ix+1])
+            end
+            recce:earleme_complete()
+        end
+        local item_count = 0
+        local report = {}
+        for set_id = 0, recce:latest_earley_set() do
+            item_count = item_count + recce:_earley_set_size(set_id)
+            recce:progress_report_start(set_id)
+            local items = {}
+            while true do
+                local rule_id, dot_position, origin = recce:progress_item()
+                if not rule_id then break end
+                if dot_position ~= 0 then
+                    items[#items+1] = string.format("R%d:%d@%d",
+                        rule_id, dot_position, origin)
+                end
+            end
+            table.sort(items)
+            report[#report+1] = table.concat(items, ' ')
+        end
+        recce:progress_report_finish()
+        return recce, item_count, table.concat(report, '\n')
+    end
+
+    local recce, unfiltered_count, unfiltered_report = parse(false)
+    local filtered_recce, filtered_count, filtered_report = parse(true)
+    Test.More.is(filtered_recce:lookahead_filter(), 1, 'lookahead_filter()')
+    Test.More.is(filtered_report, unfiltered_report,
+        'items which are not predictions')
+    Test.More.ok(filtered_count < unfiltered_count,
+        string.format('Earley items: %d filtered, %d unfiltered',
+            filtered_count, unfiltered_count))
+    Test.More.ok(kollos.bocage_new(filtered_recce,
+        filtered_recce:latest_earley_set()), 'bocage of filtered parse')
+
+    -- Only the declared terminals are expected
+    local recce = kollos.recce_new(grammar)
+    recce:lookahead_filter_set(1)
+    recce:lookahead_add(sym.num)
+    recce:start_input()
+    local expected = recce:terminals_expected()
+    Test.More.is(table.concat(expected, ' '), tostring(sym.num),
+        'terminals expected with lookahead')
+    kollos.throw = false
+    local result = recce:alternative(sym.var, 1, 1)
+    kollos.throw = true
+    Test.More.is(result, kollos.err.UNEXPECTED_TOKEN_ID,
+        'undeclared terminal is rejected')
+
+    kollos.throw = false
+    local ok = recce:lookahead_add(sym.S)
+    kollos.throw = true
+    Test.More.ok(not ok, 'lookahead_add() of a non-terminal')
+END_OF_LUA
+
+# vim: expandtab shiftwidth=4:
@@ -0,0 +1,133 @@
+#!perl
+# Marpa::R3 is Copyright (C) 2017, Jeffrey Kegler.
+#
+# This module is free software; you can redistribute it and/or modify it
+# under the same terms as Perl 5.10.1. For more details, see the full text
+# of the licenses in the directory LICENSES.
+#
+# This program is distributed in the hope that it will be
+# useful, but it is provided "as is" and without any express
+# or implied warranties. For details, see the full text of
+# of the licenses in the directory LICENSES.
+
+# Tests of the memory_limit recognizer setting,
+# using a highly ambiguous grammar
+
+use 5.010001;
+
+use strict;
+use warnings;
+
+use Test::More tests => 10;
+use English qw( -no_match_vars );
+use lib 'inc';
+use Marpa::R3::Test;
+use Marpa::R3;
+
+my $dsl = <<'END_OF_DSL';
+S ::= S S
+S ::= a
+a ~ 'a'
+END_OF_DSL
+
+my $grammar = Marpa::R3::Grammar->new( { source => \$dsl } );
+my $input   = 'a' x 100;
+
+my $unlimited_usage;
+{
+    my $recce = Marpa::R3::Recognizer->new(
+        { grammar => $grammar, too_many_earley_items => 0 } );
+    $recce->read( \$input, 0, 20 );
+    my $early_usage = $recce->memory_usage();
+    $recce->resume( undef, -1 );
+    $unlimited_usage = $recce->memory_usage();
+    Test::More::ok( $early_usage > 0 && $early_usage < $unlimited_usage,
+        'memory_usage() grows with the input' );
+}
+
+my $limit = int( $unlimited_usage / 2 );
+{
+
+# Marpa::R3::Display
+# name: recognizer memory_limit named arg
+# normalize-whitespace: 1
+
+    my $recce = Marpa::R3::Recognizer->new(
+        { grammar => $grammar, memory_limit => 4_000_000 } );
+
+# Marpa::R3::Display::End
+
+    $recce->set( { memory_limit => $limit, too_many_earley_items => 0 } );
+    my $eval_ok = eval { $recce->read( \$input ); 1 };
+    Test::More::like( ( $eval_ok ? 'no error' : $EVAL_ERROR ),
+        qr/Memory\s+limit\s+exceeded/xms, 'read() fails at memory limit' );
+    my $g1_pos = $recce->g1_pos();
+    Test::More::ok( $g1_pos > 0 && $g1_pos < length $input,
+        'parse is stopped part way' );
+
+# Marpa::R3::Display
+# name: recognizer memory_usage() synopsis
+# normalize-whitespace: 1
+
+    my $memory_usage = $recce->memory_usage();
+
+# Marpa::R3::Display::End
+
+    Test::More::ok( $memory_usage <= $limit,
+        'usage after failure is within the limit' );
+
+    # The lexeme at which the limit was exceeded is read again,
+    # and the trace reports the duplicate
+    my $trace = q{};
+    open my $trace_fh, q{>}, \$trace;
+    $recce->set( { memory_limit => 0, trace_file_handle => $trace_fh } );
+    $recce->resume( undef, -1 );
+    close $trace_fh;
+    Test::More::is( $recce->g1_pos(), length $input,
+        'parse continues after the limit is removed' );
+}
+
+{
+    # The Earley sets of a forgetful recognizer are in batches,
+    # each with its own obstack
+    my $recce = Marpa::R3::Recognizer->new(
+        {
+            grammar               => $grammar,
+            forgetful             => 1,
+            memory_limit          => $limit,
+            too_many_earley_items => 0
+        }
+    );
+    my $eval_ok = eval { $recce->read( \$input ); 1 };
+    Test::More::like( ( $eval_ok ? 'no error' : $EVAL_ERROR ),
+        qr/Memory\s+limit\s+exceeded/xms,
+        'forgetful read() fails at memory limit' );
+    Test::More::ok( $recce->memory_usage() <= $limit,
+        'forgetful usage after failure is within the limit' );
+    $recce->set( { memory_limit => 0 } );
+    $recce->resume( undef, -1 );
+    Test::More::is( $recce->g1_pos(), length $input,
+        'forgetful parse continues after the limit is removed' );
+}
+
+{
+    # The recognizer fits within the limit, but the bocage does not
+    my $recce = Marpa::R3::Recognizer->new(
+        { grammar => $grammar, too_many_earley_items => 0 } );
+    $recce->read( \$input );
+    $recce->set( { memory_limit => $recce->memory_usage() + 1 } );
+    my $eval_ok =
+      eval { Marpa::R3::Valuer->new( { recognizer => $recce } ); 1 };
+    Test::More::like( ( $eval_ok ? 'no error' : $EVAL_ERROR ),
+        qr/Parse\s+not\s+evaluated:\s+Memory\s+limit\s+exceeded/xms,
+        'valuer fails at memory limit' );
+}
+
+{
+    my $recce   = Marpa::R3::Recognizer->new( { grammar => $grammar } );
+    my $eval_ok = eval { $recce->set( { memory_limit => -1 } ); 1 };
+    Test::More::like( ( $eval_ok ? 'no error' : $EVAL_ERROR ),
+        qr/Bad\s+value\s+for\s+"memory_limit"/xms, 'bad memory_limit' );
+}
+
+# vim: expandtab shiftwidth=4:
@@ -0,0 +1,119 @@
+#!/usr/bin/perl
+# Marpa::R3 is Copyright (C) 2017, Jeffrey Kegler.
+#
+# This module is free software; you can redistribute it and/or modify it
+# under the same terms as Perl 5.10.1. For more details, see the full text
+# of the licenses in the directory LICENSES.
+#
+# This program is distributed in the hope that it will be
+# useful, but it is provided "as is" and without any express
+# or implied warranties. For details, see the full text of
+# of the licenses in the directory LICENSES.
+
+# Tests of the precomputation statistics
+
+use 5.010001;
+
+use strict;
+use warnings;
+use Test::More tests => 10;
+use English qw( -no_match_vars );
+use File::Temp;
+use POSIX qw(setlocale LC_ALL);
+
+POSIX::setlocale(LC_ALL, "C");
+
+use lib 'inc';
+use Marpa::R3::Test;
+
+## no critic (ErrorHandling::RequireCarping);
+
+use Marpa::R3;
+
+my @time_keys = qw(census_ns closure_ns loop_ns rewrite_ns ahm_ns
+  prediction_matrix_ns cil_ns event_ns);
+my @size_keys = qw(xsy_count xrl_count nsy_count irl_count ahm_count
+  cil_count precompute_obstack_bytes grammar_obstack_bytes);
+
+my $dsl = <<'END_OF_SOURCE';
+:default ::= action => ::array
+:start ::= Script
+Script ::= Expression+ separator => comma
+comma ~ [,]
+Expression ::= Number | Optional Expression ('+') Expression
+Optional ::= Number
+Optional ::=
+Number ~ [\d]+
+:discard ~ whitespace
+whitespace ~ [\s]+
+END_OF_SOURCE
+
+my $cache_dir = File::Temp->newdir();
+my $grammar =
+  Marpa::R3::Grammar->new( { source => \$dsl, cache_dir => "$cache_dir" } );
+
+# Marpa::R3::Display
+# name: SLG precompute_stats() synopsis
+# normalize-whitespace: 1
+
+    my $stats = $grammar->precompute_stats();
+    my $g1_total_ns = $stats->{g1}->{total_ns};
+
+# Marpa::R3::Display::End
+
+Test::More::is_deeply( [ sort keys %{$stats} ],
+    [qw(g1 l0)], 'one set of statistics for each subgrammar' );
+Test::More::is_deeply(
+    [ sort keys %{ $stats->{g1} } ],
+    [ sort @time_keys, 'total_ns', @size_keys ],
+    'all statistics are reported'
+);
+
+for my $subg (qw(g1 l0)) {
+    my $subg_stats = $stats->{$subg};
+    my @bad        = grep {
+        my $value = $subg_stats->{$_};
+        not defined $value or $value < 0
+    } keys %{$subg_stats};
+    Test::More::is( "@bad", q{}, "$subg statistics are not negative" );
+    my $phase_total = 0;
+    $phase_total += $subg_stats->{$_} for @time_keys;
+    Test::More::cmp_ok( $phase_total, '<=', $subg_stats->{total_ns},
+        "$subg phases are within the total time" );
+}
+
+my $g1 = $stats->{g1};
+Test::More::ok(
+    (
+              $g1->{xrl_count} > 0
+          and $g1->{irl_count} > $g1->{xrl_count}
+          and $g1->{ahm_count} > $g1->{irl_count}
+          and $g1->{cil_count} > 0
+          and $g1->{grammar_obstack_bytes} > 0
+    ),
+    'G1 sizes reflect the rewrite'
+);
+
+# The second grammar is read from the cache, and is not precomputed
+my $cached_stats =
+  Marpa::R3::Grammar->new( { source => \$dsl, cache_dir => "$cache_dir" } )
+  ->precompute_stats();
+Test::More::is( $cached_stats->{g1}->{total_ns},
+    0, 'cached grammar has no precompute time' );
+Test::More::is_deeply(
+    [ @{ $cached_stats->{g1} }{qw(xsy_count nsy_count irl_count ahm_count)} ],
+    [ @{$g1}{qw(xsy_count nsy_count irl_count ahm_count)} ],
+    'cached grammar has the same sizes'
+);
+
+# Kollos grammars, which are not yet precomputed, fail
+my $lua = Marpa::R3::Lua->new();
+my ($error) = $lua->exec(<<'END_OF_LUA');
+    local grammar = kollos.grammar_new()
+    local ok, error = pcall(function () return grammar:precompute_stats() end)
+    return tostring(error)
+END_OF_LUA
+Test::More::like( $error, qr/not \s+ precomputed/xms,
+    'statistics before precomputation' );
+
+# vim: expandtab shiftwidth=4:
@@ -0,0 +1,126 @@
+#!perl
+# Marpa::R3 is Copyright (C) 2017, Jeffrey Kegler.
+#
+# This module is free software; you can redistribute it and/or modify it
+# under the same terms as Perl 5.10.1. For more details, see the full text
+# of the licenses in the directory LICENSES.
+#
+# This program is distributed in the hope that it will be
+# useful, but it is provided "as is" and without any express
+# or implied warranties. For details, see the full text of
+# of the licenses in the directory LICENSES.
+
+# Tests of read_file() and block_new_from_file().
+# Each input is parsed both from a string and from a file,
+# and the results compared.
+
+use 5.010001;
+
+use strict;
+use warnings;
+
+use Test::More tests => 11;
+use Data::Dumper;
+use English qw( -no_match_vars );
+use File::Temp;
+use lib 'inc';
+use Marpa::R3::Test;
+use Marpa::R3;
+
+my $grammar = Marpa::R3::Grammar->new(
+    {
+        source => \<<'END_OF_DSL',
+:default ::= action => [values]
+pairs ::= pair*
+pair ::= key ('=') value
+key ~ [\w]+
+value ~ [\w]+
+:discard ~ whitespace
+whitespace ~ [\s]+
+END_OF_DSL
+    }
+);
+
+sub file_with {
+    my ($text) = @_;
+    my $fh = File::Temp->new();
+    binmode $fh, ':encoding(UTF-8)';
+    print {$fh} $text;
+    close $fh;
+    return $fh;
+}
+
+sub results {
+    my ($recce) = @_;
+    my $value_ref = $recce->value();
+    local $Data::Dumper::Indent   = 0;
+    local $Data::Dumper::Sortkeys = 1;
+    return [
+        Data::Dumper::Dumper( ${$value_ref} ),
+        $recce->input_length(),
+        $recce->literal( 1, 2, 8 ),
+        join( ',', $recce->line_column( 1, 9 ) ),
+        $recce->g1_literal( 0, 3 ),
+    ];
+}
+
+for my $input (
+    "ab=cd\nef=gh\r\nij=kl",
+    "n\x{e9}=\x{4e2d}\x{6587}\n\x{1d7d8}=z  x=y\n"
+  )
+{
+    my $fh = file_with($input);
+    my $name = Data::Dumper->new( [$input] )->Terse(1)->Useqq(1)->Dump();
+    chomp $name;
+
+    my $string_recce = Marpa::R3::Recognizer->new( { grammar => $grammar } );
+    $string_recce->read( \$input );
+    my $string_results = results($string_recce);
+
+    my $file_recce = Marpa::R3::Recognizer->new( { grammar => $grammar } );
+    $file_recce->read_file( $fh->filename() );
+    Test::More::is_deeply( results($file_recce), $string_results,
+        "read_file() vs. read() for $name" );
+
+    my $block_recce = Marpa::R3::Recognizer->new( { grammar => $grammar } );
+    my $block_id = $block_recce->block_new_from_file( $fh->filename() );
+    Test::More::is( $block_id, 1, "block_new_from_file() ID for $name" );
+    Test::More::is(
+        $block_recce->input_length($block_id),
+        length $input,
+        "block_new_from_file() length for $name"
+    );
+    $block_recce->block_set($block_id);
+    $block_recce->block_move( 0, -1 );
+    $block_recce->block_read();
+    Test::More::is_deeply( results($block_recce), $string_results,
+        "block_new_from_file() vs. read() for $name" );
+}
+
+{
+    my $fh = file_with(q{});
+    my $recce = Marpa::R3::Recognizer->new( { grammar => $grammar } );
+    $recce->read_file( $fh->filename() );
+    Test::More::is( $recce->input_length(), 0, 'read_file() of empty file' );
+}
+
+{
+    my $fh = File::Temp->new();
+    binmode $fh;
+    print {$fh} "ab=\xff\xfe";
+    close $fh;
+    my $recce = Marpa::R3::Recognizer->new( { grammar => $grammar } );
+    my $eval_ok = eval { $recce->read_file( $fh->filename() ); 1 };
+    Test::More::like( ( $eval_ok ? 'no error' : $EVAL_ERROR ),
+        qr/invalid\s+UTF-8\s+code/xms, 'read_file() of invalid UTF-8' );
+}
+
+{
+    my $recce = Marpa::R3::Recognizer->new( { grammar => $grammar } );
+    my $eval_ok =
+      eval { $recce->read_file('/nonexistent/marpa/input/file'); 1 };
+    Test::More::like( ( $eval_ok ? 'no error' : $EVAL_ERROR ),
+        qr/Cannot\s+map\s+file/xms, 'read_file() of missing file' );
+}
+
+# vim: expandtab shiftwidth=4:
@@ -0,0 +1,224 @@
+#!perl
+# Marpa::R3 is Copyright (C) 2017, Jeffrey Kegler.
+#
+# This module is free software; you can redistribute it and/or modify it
+# under the same terms as Perl 5.10.1. For more details, see the full text
+# of the licenses in the directory LICENSES.
+#
+# This program is distributed in the hope that it will be
+# useful, but it is provided "as is" and without any express
+# or implied warranties. For details, see the full text of
+# of the licenses in the directory LICENSES.
+
+# Tests of save() and load().
+# A parse is saved part way through, loaded into a new recognizer,
+# and continued, and the results are compared with
+# a parse which was not interrupted.
+
+use 5.010001;
+
+use strict;
+use warnings;
+
+use Test::More tests => 11;
+use English qw( -no_match_vars );
+use File::Temp;
+use lib 'inc';
+use Marpa::R3::Test;
+use Marpa::R3;
+
+my $dsl = <<'END_OF_DSL';
+:default ::= action => [values]
+text ::= <text segment>*
+<text segment> ::= subtext
+<text segment> ::= <word>
+subtext ::= '(' text ')'
+subtext ::= '[' list
+list ::= word ']'
+list ::= word list
+
+event subtext = completed <subtext>
+
+word ~ [\w]+
+:discard ~ whitespace
+whitespace ~ [\s]+
+END_OF_DSL
+
+my $grammar = Marpa::R3::Grammar->new( { source => \$dsl } );
+
+my $recce_args = sub {
+    my ($events) = @_;
+    return {
+        grammar        => $grammar,
+        event_handlers => {
+            subtext => sub () {
+                my ($recce) = @_;
+                my ( $start, $length ) = $recce->last_completed('subtext');
+                push @{$events},
+                  [ $recce->g1_pos(), $recce->g1_literal( $start, $length ) ];
+                'ok';
+            }
+        },
+    };
+};
+
+sub read_all {
+    my ( $recce, $pos ) = @_;
+    my $length = $recce->input_length();
+    while ( $pos < $length ) {
+        $pos = $recce->resume($pos);
+    }
+    return;
+}
+
+sub summary {
+    my ( $recce, $events ) = @_;
+    return [
+        $recce->g1_pos(),
+        [ $recce->last_completed('text') ],
+        [ map { $recce->progress($_) } 0 .. $recce->g1_pos() ],
+        $recce->value(),
+        $events,
+    ];
+}
+
+my $input = join q{ }, map { "w$_ (x$_ [y$_ u$_] z)" } 1 .. 20;
+my $half = index $input, 'w11';
+
+my $full_summary;
+{
+    my @events = ();
+    my $recce  = Marpa::R3::Recognizer->new( $recce_args->( \@events ) );
+    read_all( $recce, $recce->read( \$input ) );
+    $full_summary = summary( $recce, \@events );
+}
+
+my $dir = File::Temp->newdir();
+my $path = "$dir/recce";
+
+{
+    my @events = ();
+    my $recce  = Marpa::R3::Recognizer->new( $recce_args->( \@events ) );
+    $recce->read( \$input, 0, $half );
+    $recce->save($path);
+    my ( $block_ix, $offset ) = $recce->block_progress();
+
+    my $loaded =
+      Marpa::R3::Recognizer->load( $path, $recce_args->( \@events ) );
+    Test::More::is_deeply( [ $loaded->block_progress() ],
+        [ $block_ix, $offset, $half ], 'block progress after load' );
+    Test::More::is( $loaded->input_length(),
+        length $input, 'input length after load' );
+    read_all( $loaded, $loaded->resume( $offset, -1 ) );
+    Test::More::is_deeply( summary( $loaded, \@events ),
+        $full_summary, 'parse continued after load' );
+}
+
+{
+    # The saved recognizer is not changed by saving it,
+    # and the image does not change with the file
+    my @events = ();
+    my $recce  = Marpa::R3::Recognizer->new( $recce_args->( \@events ) );
+    $recce->read( \$input, 0, $half );
+    $recce->save($path);
+    my @loaded_events = @events;
+    my $loaded =
+      Marpa::R3::Recognizer->load( $path, $recce_args->( \@loaded_events ) );
+    $loaded->save("$path.2");
+    my $image  = do { local $RS = undef; open my $fh, '<', $path; <$fh> };
+    my $image2 = do { local $RS = undef; open my $fh, '<', "$path.2"; <$fh> };
+    Test::More::ok( $image eq $image2, 'image of loaded recognizer' );
+    read_all( $recce, $recce->resume( undef, -1 ) );
+    Test::More::is_deeply( summary( $recce, \@events ),
+        $full_summary, 'parse continued after save' );
+}
+
+{
+    # Event activation is saved
+    my @events = ();
+    my $recce  = Marpa::R3::Recognizer->new( $recce_args->( \@events ) );
+    $recce->read( \$input, 0, $half );
+    $recce->activate( 'subtext', 0 );
+    $recce->save($path);
+    my $event_count = scalar @events;
+    my $loaded =
+      Marpa::R3::Recognizer->load( $path, $recce_args->( \@events ) );
+    read_all( $loaded, $loaded->resume( undef, -1 ) );
+    Test::More::is( scalar @events, $event_count,
+        'deactivated event after load' );
+}
+
+{
+    # A streaming block, whose prefix has been forgotten
+    my @chunks = map { "w$_ (x$_ [y$_ u$_] z) " } 1 .. 20;
+    my @events = ();
+    my $recce  = Marpa::R3::Recognizer->new( $recce_args->( \@events ) );
+    $recce->read( \$chunks[0] );
+    for my $chunk_ix ( 1 .. 9 ) {
+        my $length = $recce->block_append( 1, \$chunks[$chunk_ix] );
+        $recce->resume();
+        $recce->block_forget( 1, $length - 1 );
+    }
+    $recce->save($path);
+    my $loaded =
+      Marpa::R3::Recognizer->load( $path, $recce_args->( \@events ) );
+    for my $chunk_ix ( 10 .. $#chunks ) {
+        my $length = $loaded->block_append( 1, \$chunks[$chunk_ix] );
+        $loaded->resume();
+        $loaded->block_forget( 1, $length - 1 );
+    }
+    my $whole_input = join q{}, @chunks;
+    my $whole_recce = Marpa::R3::Recognizer->new( $recce_args->( [] ) );
+    $whole_recce->read( \$whole_input );
+    my $end = length $whole_input;
+    Test::More::is_deeply(
+        [ $loaded->g1_pos(), $loaded->line_column( 1, $end ) ],
+        [ $whole_recce->g1_pos(), $whole_recce->line_column( 1, $end ) ],
+        'streaming block after load'
+    );
+    my $eval_ok = eval { $loaded->g1_literal( 0, 1 ); 1 };
+    Test::More::like( ( $eval_ok ? 'no error' : $EVAL_ERROR ),
+        qr/G1\s+location\s+0\s+has\s+been\s+forgotten/xms,
+        'forgotten G1 location after load' );
+}
+
+{
+    my $recce =
+      Marpa::R3::Recognizer->new( $recce_args->( [] ), { forgetful => 1 } );
+    $recce->read( \$input, 0, $half );
+    my $eval_ok = eval { $recce->save($path); 1 };
+    Test::More::like( ( $eval_ok ? 'no error' : $EVAL_ERROR ),
+        qr/forgetful\s+recognizer\s+cannot\s+be\s+saved/xms,
+        'save() of forgetful recognizer' );
+}
+
+{
+    my $recce = Marpa::R3::Recognizer->new( $recce_args->( [] ) );
+    $recce->read( \$input, 0, $half );
+    $recce->save($path);
+    ( my $other_dsl = $dsl ) =~ s/ list \s ::= \s word \s list/list ::= list word/xms;
+    my $other_grammar = Marpa::R3::Grammar->new( { source => \$other_dsl } );
+    my $eval_ok = eval {
+        Marpa::R3::Recognizer->load( $path, $recce_args->( [] ),
+            { grammar => $other_grammar } );
+        1;
+    };
+    Test::More::like( ( $eval_ok ? 'no error' : $EVAL_ERROR ),
+        qr/is\s+not\s+a\s+recognizer\s+image\s+for\s+this\s+grammar/xms,
+        'load() with another grammar' );
+}
+
+{
+    open my $fh, '>', $path;
+    print {$fh} 'not an image';
+    close $fh;
+    my $eval_ok = eval {
+        Marpa::R3::Recognizer->load( $path, $recce_args->( [] ) );
+        1;
+    };
+    Test::More::like( ( $eval_ok ? 'no error' : $EVAL_ERROR ),
+        qr/is\s+not\s+a\s+recognizer\s+image/xms,
+        'load() of a file which is not an image' );
+}
+
+# vim: expandtab shiftwidth=4:
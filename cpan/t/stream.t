@@ -0,0 +1,138 @@
+#!perl
+# Marpa::R3 is Copyright (C) 2017, Jeffrey Kegler.
+#
+# This module is free software; you can redistribute it and/or modify it
+# under the same terms as Perl 5.10.1. For more details, see the full text
+# of the licenses in the directory LICENSES.
+#
+# This program is distributed in the hope that it will be
+# useful, but it is provided "as is" and without any express
+# or implied warranties. For details, see the full text of
+# of the licenses in the directory LICENSES.
+
+# Tests of streaming input: block_append() and block_forget().
+# A stream is read in chunks, forgetting as it goes,
+# and compared with a read of the whole input at once.
+
+use 5.010001;
+
+use strict;
+use warnings;
+
+use Test::More tests => 14;
+use English qw( -no_match_vars );
+use lib 'inc';
+use Marpa::R3::Test;
+use Marpa::R3;
+
+my $grammar = Marpa::R3::Grammar->new(
+    {
+        source => \<<'END_OF_DSL',
+:default ::= action => [values]
+lines ::= line*
+line ::= key ('=') value (NL)
+key ~ [\w]+
+value ~ [\w]+
+NL ~ [\n]
+:discard ~ whitespace
+whitespace ~ [ \t\r]+
+END_OF_DSL
+    }
+);
+
+my @chunks = map { "k$_ = v\x{4e2d}$_\n" } 1 .. 200;
+$chunks[50] = "k51 = v51\r";    # CR, then LF in the next chunk
+$chunks[51] = "\nk52 = v52\n";
+my $whole_input = join q{}, @chunks;
+
+my $whole_recce = Marpa::R3::Recognizer->new( { grammar => $grammar } );
+$whole_recce->read( \$whole_input );
+
+my $stream_recce = Marpa::R3::Recognizer->new( { grammar => $grammar } );
+$stream_recce->read( \$chunks[0] );
+my $watermark    = 0;
+my $length_error = q{};
+for my $chunk_ix ( 1 .. $#chunks ) {
+    my $length = $stream_recce->block_append( 1, \$chunks[$chunk_ix] );
+    my $expected_length = length join q{}, @chunks[ 0 .. $chunk_ix ];
+    $length_error .= "Chunk $chunk_ix: length is $length\n"
+      if $length != $expected_length;
+    $stream_recce->resume();
+    $watermark = $stream_recce->block_forget( 1, $expected_length - 1 );
+}
+Test::More::is( $length_error, q{}, 'block_append() lengths' );
+
+my $end = length $whole_input;
+Test::More::is( $watermark, $end - 1, 'block_forget() watermark' );
+Test::More::is_deeply( [ $stream_recce->block_progress() ],
+    [ 1, $end, $end ], 'block progress at end of stream' );
+Test::More::is(
+    $stream_recce->g1_pos(),
+    $whole_recce->g1_pos(),
+    'G1 location at end of stream'
+);
+
+for my $pos ( $end - 1, $end ) {
+    Test::More::is_deeply(
+        [ $stream_recce->line_column( 1, $pos ) ],
+        [ $whole_recce->line_column( 1, $pos ) ],
+        "line and column at $pos"
+    );
+}
+
+my $g1_last = $stream_recce->g1_pos() - 1;
+Test::More::is(
+    $stream_recce->g1_literal( $g1_last, 1 ),
+    $whole_recce->g1_literal( $g1_last, 1 ),
+    'literal of latest G1 location'
+);
+
+{
+    my $eval_ok = eval { $stream_recce->literal( 1, 0, 3 ); 1 };
+    Test::More::like( ( $eval_ok ? 'no error' : $EVAL_ERROR ),
+        qr/Position\s+0\s+of\s+block\s+1\s+has\s+been\s+forgotten/xms,
+        'literal() of forgotten position' );
+}
+
+{
+    my $eval_ok = eval { $stream_recce->g1_literal( 0, 1 ); 1 };
+    Test::More::like( ( $eval_ok ? 'no error' : $EVAL_ERROR ),
+        qr/G1\s+location\s+0\s+has\s+been\s+forgotten/xms,
+        'g1_literal() of forgotten G1 location' );
+}
+
+# The watermark does not move back, or past the current offset
+Test::More::is( $stream_recce->block_forget( 1, 10 ),
+    $end - 1, 'block_forget() does not move back' );
+Test::More::is( $stream_recce->block_forget( 1, -1 ),
+    $end, 'block_forget() to end of block' );
+Test::More::is_deeply(
+    [ $stream_recce->line_column( 1, $end ) ],
+    [ $whole_recce->line_column( 1, $end ) ],
+    'line and column at end, after forgetting all'
+);
+
+# Without forgetting, the position index is extended by every append
+{
+    my $recce = Marpa::R3::Recognizer->new( { grammar => $grammar } );
+    $recce->read( \$chunks[0] );
+    for my $chunk_ix ( 1 .. $#chunks ) {
+        $recce->block_append( 1, \$chunks[$chunk_ix] );
+        $recce->resume();
+    }
+    my $mismatches = q{};
+    for my $pos ( 0 .. $end ) {
+        my @line_column = $recce->line_column( 1, $pos );
+        my @expected    = $whole_recce->line_column( 1, $pos );
+        $mismatches .= "Pos $pos: @line_column vs. @expected\n"
+          if "@line_column" ne "@expected";
+    }
+    Test::More::is( $mismatches, q{},
+        'line and column at every position, after appends' );
+    Test::More::is(
+        $recce->literal( 1, 0, $end ),
+        $whole_input, 'literal of whole block, after appends'
+    );
+}
+
+# vim: expandtab shiftwidth=4:
@@ -935,6 +935,17 @@ static void recursive_coerce_to_lua(
         return;
     }
 
+    /* 'A' is a ref to an array of SV's.  Each element
+     * is coerced as if its signature was 'S'.
+     */
+    if (sig == 'A') {
+        if (!SvROK(sv) || SvTYPE(SvRV(sv)) != SVt_PVAV) {
+            croak ("Internal error: signature 'A' wants an array ref");
+        }
+        coerce_to_lua_sequence(L, visited_ix, (AV*)SvRV(sv), 'S');
+        return;
+    }
+
     if (SvROK(sv)) {
         SV* referent = SvRV(sv);
         if (SvTYPE(referent) == SVt_PVAV) {
@@ -962,6 +973,16 @@ static void recursive_coerce_to_lua(
         }
         break;
     case 's': break;
+    case 'b':
+        /* A byte string, which need not be UTF-8 --
+         * a grammar image, for example.
+         */
+        {
+          STRLEN len;
+          const char *s = SvPVbyte (sv, len);
+          marpa_lua_pushlstring (L, s, (size_t)len);
+        }
+        return;
     default:
         croak
             ("Internal error: invalid sig option %c in xlua EXEC_SIG_BODY", sig);
@@ -990,6 +1011,22 @@ static void recursive_coerce_to_lua(
 #include "inspect_inc.c"
 #include "kollos_inc.c"
 #include "glue_inc.c"
+#include "metag_inc.c"
+
+/* The loader for the "kollos.metag" package, which returns
+ * the hashed source of the metagrammar.  It is preloaded
+ * in every interpreter, but the bytecode is only loaded on
+ * demand, because only the metagrammar needs it.
+ */
+static int metag_package_loader (lua_State* L)
+{
+    if (marpa_luaL_loadbuffer (L, metag_loader, metag_loader_length,
+            MYLUA_TAG) != LUA_OK) {
+        return marpa_lua_error (L);
+    }
+    marpa_lua_call (L, 0, 1);
+    return 1;
+}
 
 MODULE = Marpa::R3        PACKAGE = Marpa::R3::Thin
 
@@ -1119,6 +1156,10 @@ PPCODE:
     }
     marpa_lua_setfield(L, preload_ix, "kollos");
 
+    /* Set up preload of kollos metagrammar package */
+    marpa_lua_pushcfunction(L, metag_package_loader);
+    marpa_lua_setfield(L, preload_ix, "kollos.metag");
+
     /* Actually load glue package
      * This will load the inspect, kollos.metal and kollos
      * packages.